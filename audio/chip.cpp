@@ -22,10 +22,27 @@
 #include "audio/chip.h"
 #include "audio/mixer.h"
 
+#include "common/list.h"
+#include "common/system.h"
 #include "common/timer.h"
 
 namespace Audio {
 
+namespace {
+
+enum {
+	kRenderAheadChunkFrames = 512,
+	kRenderAheadInterval = 10 * 1000
+};
+
+// Chips rendering ahead. Like the chips, this is only accessed with the
+// mixer mutex held, then the list mutex.
+Common::Mutex *g_renderAheadMutex = nullptr;
+Common::List<EmulatedChip *> *g_renderAheadChips = nullptr;
+bool g_renderAheadTimerInstalled = false;
+
+} // End of anonymous namespace
+
 void Chip::start(TimerCallback *callback, int timerFrequency) {
 	_callback.reset(callback);
 	startCallbacks(timerFrequency);
@@ -97,7 +114,15 @@ EmulatedChip::EmulatedChip() :
 	_nextTick(0),
 	_samplesPerTick(0),
 	_baseFreq(0),
-	_handle(new Audio::SoundHandle()) { }
+	_handle(new Audio::SoundHandle()),
+	_writeTime(0),
+	_started(false),
+	_applyingWrites(false),
+	_renderAheadMillis(0),
+	_aheadBuffer(nullptr),
+	_aheadSize(0),
+	_aheadReadPos(0),
+	_aheadFill(0) { }
 
 EmulatedChip::~EmulatedChip() {
 	// Stop callbacks, just in case. If it's still playing at this
@@ -111,29 +136,158 @@ EmulatedChip::~EmulatedChip() {
 
 int EmulatedChip::readBuffer(int16 *buffer, const int numSamples) {
 	const int stereoFactor = isStereo() ? 2 : 1;
-	int len = numSamples / stereoFactor;
-	int step;
+	const int frames = numSamples / stereoFactor;
 
-	do {
-		step = len;
-		if (step > (_nextTick >> FIXP_SHIFT))
-			step = (_nextTick >> FIXP_SHIFT);
+	if (!_aheadBuffer) {
+		render(buffer, frames);
+		return numSamples;
+	}
 
-		generateSamples(buffer, step * stereoFactor);
+	int done = readRenderedAhead(buffer, frames);
+	if (done < frames) {
+		// Rendering ahead has not kept up, so render the rest right away,
+		// after what the timer may have added in the meantime
+		Common::StackLock lock(_renderMutex);
+		done += readRenderedAhead(buffer + done * stereoFactor, frames - done);
+		render(buffer + done * stereoFactor, frames - done);
+	}
+
+	return numSamples;
+}
+
+void EmulatedChip::render(int16 *buffer, int frames) {
+	Common::StackLock lock(_renderMutex);
+	const int stereoFactor = isStereo() ? 2 : 1;
+
+	// Run the callbacks for the whole block first. The register writes
+	// they make are queued at the tick they belong to.
+	int pos = 0;
+	while (pos < frames) {
+		const int step = MIN(frames - pos, _nextTick >> FIXP_SHIFT);
+		pos += step;
 
 		_nextTick -= step << FIXP_SHIFT;
 		if (!(_nextTick >> FIXP_SHIFT)) {
+			{
+				Common::StackLock writeLock(_writeMutex);
+				_writeTime = pos;
+			}
+
 			if (_callback && _callback->isValid())
 				(*_callback)();
 
 			_nextTick += _samplesPerTick;
 		}
+	}
 
-		buffer += step * stereoFactor;
-		len -= step;
-	} while (len);
+	// Then render in runs between the writes. Writes made from now on go
+	// to the next block.
+	Common::StackLock writeLock(_writeMutex);
+	_writeTime = 0;
+	_applyingWrites = true;
+
+	pos = 0;
+	for (uint i = 0; i < _writes.size(); ++i) {
+		const RegisterWrite &write = _writes[i];
+		if (write.time > pos) {
+			generateSamples(buffer + pos * stereoFactor, (write.time - pos) * stereoFactor);
+			pos = write.time;
+		}
 
-	return numSamples;
+		applyRegisterWrite(write.address, write.value, write.port);
+	}
+
+	if (pos < frames)
+		generateSamples(buffer + pos * stereoFactor, (frames - pos) * stereoFactor);
+
+	_writes.resize(0);
+	_applyingWrites = false;
+}
+
+bool EmulatedChip::queueRegisterWrite(int address, int value, bool port) {
+	Common::StackLock lock(_writeMutex);
+
+	// Writes being applied from the queue, and writes while the chip is
+	// not rendered at all, are made right away
+	if (!_started || _applyingWrites)
+		return false;
+
+	RegisterWrite write;
+	write.time = _writeTime;
+	write.address = address;
+	write.value = value;
+	write.port = port;
+	_writes.push_back(write);
+	return true;
+}
+
+void EmulatedChip::clearRegisterWrites() {
+	Common::StackLock lock(_writeMutex);
+
+	// Never while the queue is being applied, from one of the writes
+	if (!_applyingWrites)
+		_writes.resize(0);
+}
+
+void EmulatedChip::setRenderAhead(uint millis) {
+	assert(!_started);
+	_renderAheadMillis = millis;
+}
+
+int EmulatedChip::readRenderedAhead(int16 *buffer, int frames) {
+	Common::StackLock lock(_aheadMutex);
+	const uint stereoFactor = isStereo() ? 2 : 1;
+
+	const uint samples = MIN<uint>(frames * stereoFactor, _aheadFill);
+	const uint first = MIN<uint>(samples, _aheadSize - _aheadReadPos);
+	memcpy(buffer, _aheadBuffer + _aheadReadPos, first * sizeof(int16));
+	memcpy(buffer + first, _aheadBuffer, (samples - first) * sizeof(int16));
+
+	_aheadReadPos = (_aheadReadPos + samples) % _aheadSize;
+	_aheadFill -= samples;
+	return samples / stereoFactor;
+}
+
+bool EmulatedChip::renderAhead() {
+	Common::StackLock lock(_renderMutex);
+	const uint stereoFactor = isStereo() ? 2 : 1;
+
+	uint frames;
+	{
+		Common::StackLock aheadLock(_aheadMutex);
+		frames = MIN<uint>((_aheadSize - _aheadFill) / stereoFactor, kRenderAheadChunkFrames);
+	}
+
+	if (!frames)
+		return false;
+
+	// Samples can only be taken out in the meantime, so the space is still
+	// there afterwards
+	int16 chunk[kRenderAheadChunkFrames * 2];
+	render(chunk, frames);
+
+	Common::StackLock aheadLock(_aheadMutex);
+	const uint samples = frames * stereoFactor;
+	const uint writePos = (_aheadReadPos + _aheadFill) % _aheadSize;
+	const uint first = MIN<uint>(samples, _aheadSize - writePos);
+	memcpy(_aheadBuffer + writePos, chunk, first * sizeof(int16));
+	memcpy(_aheadBuffer, chunk + first, (samples - first) * sizeof(int16));
+	_aheadFill += samples;
+
+	return _aheadFill + stereoFactor <= _aheadSize;
+}
+
+void EmulatedChip::renderAheadProc(void *refCon) {
+	// The callbacks of the chips expect the mixer mutex to be held, as it
+	// is when they are called from the mixer
+	Common::StackLock mixerLock(g_system->getMixer()->mutex());
+	Common::StackLock lock(*g_renderAheadMutex);
+
+	for (Common::List<EmulatedChip *>::iterator i = g_renderAheadChips->begin(); i != g_renderAheadChips->end(); ++i) {
+		// Top up the whole buffer; it is only a few chunks
+		while ((*i)->renderAhead())
+			;
+	}
 }
 
 int EmulatedChip::getRate() const {
@@ -142,11 +296,56 @@ int EmulatedChip::getRate() const {
 
 void EmulatedChip::startCallbacks(int timerFrequency) {
 	setCallbackFrequency(timerFrequency);
+
+	{
+		Common::StackLock lock(_writeMutex);
+		_started = true;
+	}
+
+	if (_renderAheadMillis) {
+		const uint stereoFactor = isStereo() ? 2 : 1;
+		_aheadSize = MAX<uint>(getRate() * _renderAheadMillis / 1000, kRenderAheadChunkFrames) * stereoFactor;
+		_aheadBuffer = new int16[_aheadSize];
+		_aheadReadPos = _aheadFill = 0;
+
+		if (!g_renderAheadMutex) {
+			g_renderAheadMutex = new Common::Mutex();
+			g_renderAheadChips = new Common::List<EmulatedChip *>();
+		}
+
+		{
+			Common::StackLock mixerLock(g_system->getMixer()->mutex());
+			Common::StackLock lock(*g_renderAheadMutex);
+			g_renderAheadChips->push_back(this);
+		}
+
+		if (!g_renderAheadTimerInstalled)
+			g_renderAheadTimerInstalled = g_system->getTimerManager()->installTimerProc(&renderAheadProc, kRenderAheadInterval, nullptr, "EmulatedChip");
+	}
+
 	g_system->getMixer()->playStream(Audio::Mixer::kPlainSoundType, _handle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
 }
 
 void EmulatedChip::stopCallbacks() {
 	g_system->getMixer()->stopHandle(*_handle);
+
+	if (_aheadBuffer) {
+		{
+			Common::StackLock mixerLock(g_system->getMixer()->mutex());
+			Common::StackLock lock(*g_renderAheadMutex);
+			g_renderAheadChips->remove(this);
+		}
+
+		delete[] _aheadBuffer;
+		_aheadBuffer = nullptr;
+		_aheadSize = _aheadReadPos = _aheadFill = 0;
+	}
+
+	// Writes still queued now will never be rendered. They cannot be
+	// applied either, this may be called from the destructor.
+	Common::StackLock lock(_writeMutex);
+	_writes.clear();
+	_started = false;
 }
 
 void EmulatedChip::setCallbackFrequency(int timerFrequency) {
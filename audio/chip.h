@@ -22,7 +22,9 @@
 #ifndef AUDIO_CHIP_H
 #define AUDIO_CHIP_H
 
+#include "common/array.h"
 #include "common/func.h"
+#include "common/mutex.h"
 #include "common/ptr.h"
 
 #include "audio/audiostream.h"
@@ -125,11 +127,46 @@ public:
 	int getRate() const override;
 	bool endOfData() const override { return false; }
 
+	/**
+	 * Render the chip output ahead of the mixer, from a timer callback,
+	 * into a buffer of the given length. The mixer callback then only
+	 * copies samples, unless rendering falls behind.
+	 *
+	 * The callbacks run from the timer then, still with the mixer mutex
+	 * held. Register writes made outside of them are delayed up to the
+	 * length of the buffer. This must be called before start(); 0 renders
+	 * in the mixer callback, which is the default.
+	 */
+	void setRenderAhead(uint millis);
+
 protected:
 	// Chip API
 	void startCallbacks(int timerFrequency) override final;
 	void stopCallbacks() override final;
 
+	/**
+	 * Queue a register write while the chip is playing, so that it is
+	 * applied at the right point of the sample output and the output can be
+	 * rendered in long runs between writes. write() and writeReg() of
+	 * emulators call this first and return if the write was queued; it
+	 * comes back through applyRegisterWrite() when rendering gets to it.
+	 *
+	 * Writes from the callbacks are placed at the tick they were made in,
+	 * all others at the start of the next block rendered.
+	 *
+	 * @param address  The register, or the port for port writes.
+	 * @param value    The value written.
+	 * @param port     Whether this is a write() rather than a writeReg().
+	 * @return true if the write was queued, false if it has to be made now.
+	 */
+	bool queueRegisterWrite(int address, int value, bool port);
+
+	/** Make a register write queued with queueRegisterWrite(). */
+	virtual void applyRegisterWrite(int address, int value, bool port) = 0;
+
+	/** Drop all queued register writes, e.g. when the chip is reset. */
+	void clearRegisterWrites();
+
 	/**
 	 * Read up to 'length' samples.
 	 *
@@ -143,12 +180,44 @@ protected:
 	virtual void generateSamples(int16 *buffer, int numSamples) = 0;
 
 private:
+	struct RegisterWrite {
+		int time;    ///< Frame of the block being rendered to apply the write at.
+		int address;
+		int value;
+		bool port;
+	};
+
+	/** Run the callbacks and render the given number of frames. */
+	void render(int16 *buffer, int frames);
+
+	int readRenderedAhead(int16 *buffer, int frames);
+	bool renderAhead();
+	static void renderAheadProc(void *refCon);
+
 	int _baseFreq;
 
 	int _nextTick;
 	int _samplesPerTick;
 
 	Audio::SoundHandle *_handle;
+
+	/** Held while rendering, to keep the mixer and the timer out of each other's way. */
+	Common::Mutex _renderMutex;
+
+	/** Held while accessing the write queue, and while writes from it are applied. */
+	Common::Mutex _writeMutex;
+	Common::Array<RegisterWrite> _writes;
+	int _writeTime;
+	bool _started;
+	bool _applyingWrites;
+
+	uint _renderAheadMillis;
+	/** Held while accessing the buffer of samples rendered ahead, but never for long. */
+	Common::Mutex _aheadMutex;
+	int16 *_aheadBuffer;
+	uint _aheadSize;
+	uint _aheadReadPos;
+	uint _aheadFill;
 };
 
 } // End of namespace Audio
@@ -0,0 +1,240 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "audio/decodeahead.h"
+#include "audio/audiostream.h"
+
+#include "common/list.h"
+#include "common/mutex.h"
+#include "common/ptr.h"
+#include "common/system.h"
+#include "common/timer.h"
+
+namespace Audio {
+
+namespace {
+
+enum {
+	// Small enough not to hold up the other timer callbacks for long
+	kDecodeChunkSamples = 4096,
+	kDecodeTimerInterval = 10 * 1000
+};
+
+} // End of anonymous namespace
+
+class DecodeAheadStream : public AudioStream {
+public:
+	DecodeAheadStream(AudioStream *parent, uint bufferMillis, DisposeAfterUse::Flag disposeAfterUse);
+	~DecodeAheadStream();
+
+	int readBuffer(int16 *buffer, const int numSamples) override;
+	bool isStereo() const override { return _stereo; }
+	int getRate() const override { return _rate; }
+	bool endOfData() const override;
+	bool endOfStream() const override;
+
+	/**
+	 * Decode up to one chunk into the buffer.
+	 *
+	 * @return true if there is still room left in the buffer.
+	 */
+	bool fill();
+
+private:
+	int readFromBuffer(int16 *buffer, int numSamples);
+	void updateState();
+
+	/** Held while decoding from _parent, which is only accessed with it held. */
+	Common::Mutex _decodeMutex;
+	Common::DisposablePtr<AudioStream> _parent;
+
+	const bool _stereo;
+	const int _rate;
+
+	/** Held while accessing the buffer and the state below, but never for long. */
+	mutable Common::Mutex _bufferMutex;
+	int16 *_buffer;
+	uint _bufferSize;
+	uint _readPos;
+	uint _fill;
+	bool _parentEndOfData;
+	bool _parentEndOfStream;
+
+	int16 _scratch[kDecodeChunkSamples];
+};
+
+namespace {
+
+// Streams are only added and removed with the mutex held, and the timer
+// holds it while filling them, so a stream is never deleted while it is
+// being filled.
+Common::Mutex *g_decodeAheadMutex = nullptr;
+Common::List<DecodeAheadStream *> *g_decodeAheadStreams = nullptr;
+bool g_decodeAheadTimerInstalled = false;
+
+void decodeAheadTimerProc(void *refCon) {
+	fillDecodeAheadStreams();
+}
+
+} // End of anonymous namespace
+
+DecodeAheadStream::DecodeAheadStream(AudioStream *parent, uint bufferMillis, DisposeAfterUse::Flag disposeAfterUse)
+	: _parent(parent, disposeAfterUse), _stereo(parent->isStereo()), _rate(parent->getRate()),
+	  _readPos(0), _fill(0), _parentEndOfData(parent->endOfData()), _parentEndOfStream(parent->endOfStream()) {
+	// Whole frames only, and at least one chunk
+	_bufferSize = MAX<uint>(kDecodeChunkSamples, (uint)((uint64)_rate * bufferMillis / 1000) * (_stereo ? 2 : 1));
+	_buffer = new int16[_bufferSize];
+
+	// The first stream is created from the main thread, before the timer
+	// runs, so creating the shared state lazily is safe
+	if (!g_decodeAheadMutex) {
+		g_decodeAheadMutex = new Common::Mutex();
+		g_decodeAheadStreams = new Common::List<DecodeAheadStream *>();
+	}
+
+	{
+		Common::StackLock lock(*g_decodeAheadMutex);
+		g_decodeAheadStreams->push_back(this);
+	}
+
+	if (!g_decodeAheadTimerInstalled && g_system) {
+		Common::TimerManager *timer = g_system->getTimerManager();
+		g_decodeAheadTimerInstalled = timer && timer->installTimerProc(&decodeAheadTimerProc, kDecodeTimerInterval, nullptr, "decodeAhead");
+	}
+}
+
+DecodeAheadStream::~DecodeAheadStream() {
+	{
+		Common::StackLock lock(*g_decodeAheadMutex);
+		g_decodeAheadStreams->remove(this);
+	}
+
+	delete[] _buffer;
+}
+
+int DecodeAheadStream::readFromBuffer(int16 *buffer, int numSamples) {
+	Common::StackLock lock(_bufferMutex);
+
+	const uint samples = MIN<uint>(numSamples, _fill);
+	const uint first = MIN<uint>(samples, _bufferSize - _readPos);
+	memcpy(buffer, _buffer + _readPos, first * sizeof(int16));
+	memcpy(buffer + first, _buffer, (samples - first) * sizeof(int16));
+
+	_readPos = (_readPos + samples) % _bufferSize;
+	_fill -= samples;
+	return samples;
+}
+
+void DecodeAheadStream::updateState() {
+	// Called with _decodeMutex held
+	const bool endOfData = _parent->endOfData();
+	const bool endOfStream = _parent->endOfStream();
+
+	Common::StackLock lock(_bufferMutex);
+	_parentEndOfData = endOfData;
+	_parentEndOfStream = endOfStream;
+}
+
+int DecodeAheadStream::readBuffer(int16 *buffer, const int numSamples) {
+	int samples = readFromBuffer(buffer, numSamples);
+	if (samples == numSamples)
+		return samples;
+
+	// Decoding has not kept up: decode the rest right away, after what
+	// the timer may have added in the meantime
+	Common::StackLock lock(_decodeMutex);
+	samples += readFromBuffer(buffer + samples, numSamples - samples);
+	if (samples < numSamples) {
+		const int decoded = _parent->readBuffer(buffer + samples, numSamples - samples);
+		if (decoded > 0)
+			samples += decoded;
+		updateState();
+	}
+
+	return samples;
+}
+
+bool DecodeAheadStream::endOfData() const {
+	Common::StackLock lock(_bufferMutex);
+	return _fill == 0 && _parentEndOfData;
+}
+
+bool DecodeAheadStream::endOfStream() const {
+	Common::StackLock lock(_bufferMutex);
+	return _fill == 0 && _parentEndOfStream;
+}
+
+bool DecodeAheadStream::fill() {
+	Common::StackLock lock(_decodeMutex);
+
+	uint space;
+	{
+		Common::StackLock bufferLock(_bufferMutex);
+		if (_parentEndOfStream)
+			return false;
+		space = _bufferSize - _fill;
+	}
+
+	// Keep whole frames in the buffer
+	space = MIN<uint>(space, kDecodeChunkSamples) & (_stereo ? ~1 : ~0);
+	if (!space)
+		return false;
+
+	const int decoded = _parent->readBuffer(_scratch, space);
+	const bool endOfData = _parent->endOfData();
+	const bool endOfStream = _parent->endOfStream();
+
+	Common::StackLock bufferLock(_bufferMutex);
+	if (decoded > 0) {
+		uint writePos = (_readPos + _fill) % _bufferSize;
+		const uint first = MIN<uint>(decoded, _bufferSize - writePos);
+		memcpy(_buffer + writePos, _scratch, first * sizeof(int16));
+		memcpy(_buffer, _scratch + first, (decoded - first) * sizeof(int16));
+		_fill += decoded;
+	}
+	_parentEndOfData = endOfData;
+	_parentEndOfStream = endOfStream;
+
+	return !endOfStream && _fill < _bufferSize;
+}
+
+bool fillDecodeAheadStreams() {
+	if (!g_decodeAheadMutex)
+		return false;
+
+	Common::StackLock lock(*g_decodeAheadMutex);
+
+	bool moreRoom = false;
+	for (Common::List<DecodeAheadStream *>::iterator i = g_decodeAheadStreams->begin(); i != g_decodeAheadStreams->end(); ++i)
+		moreRoom |= (*i)->fill();
+
+	return moreRoom;
+}
+
+AudioStream *makeDecodeAheadStream(AudioStream *stream, uint bufferMillis, DisposeAfterUse::Flag disposeAfterUse) {
+	if (!stream)
+		return nullptr;
+
+	return new DecodeAheadStream(stream, bufferMillis, disposeAfterUse);
+}
+
+} // End of namespace Audio
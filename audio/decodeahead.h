@@ -0,0 +1,73 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef AUDIO_DECODEAHEAD_H
+#define AUDIO_DECODEAHEAD_H
+
+#include "common/scummsys.h"
+#include "common/types.h"
+
+namespace Audio {
+
+/**
+ * @defgroup audio_decodeahead Decode-ahead streams
+ * @ingroup audio
+ *
+ * @brief Decoding of compressed streams ahead of the mixer.
+ * @{
+ */
+
+class AudioStream;
+
+/**
+ * Wrap a stream so that it is decoded ahead of time in the background,
+ * into a buffer of PCM samples the mixer callback then merely copies.
+ * This takes the cost of decoding MP3, Vorbis, FLAC, ... out of the
+ * callback, so the time it takes no longer depends on the codecs in use.
+ *
+ * Decoding happens from a timer callback. If it falls behind, or the
+ * backend has no timer, the stream is decoded on demand as usual.
+ *
+ * Only use this for self-contained streams such as decoders: the wrapped
+ * stream is read from another thread without the mixer mutex being held,
+ * and it must not be accessed by anyone else any more.
+ *
+ * @param stream           The stream to decode ahead.
+ * @param bufferMillis     How far ahead to decode, in milliseconds.
+ * @param disposeAfterUse  Whether to delete the stream with the wrapper.
+ */
+AudioStream *makeDecodeAheadStream(AudioStream *stream, uint bufferMillis = 300, DisposeAfterUse::Flag disposeAfterUse = DisposeAfterUse::YES);
+
+/**
+ * Top up the buffers of all decode-ahead streams by one chunk each.
+ *
+ * This is what the background timer does; it only needs to be called
+ * directly where there is no timer.
+ *
+ * @return true if some stream still has room left in its buffer.
+ */
+bool fillDecodeAheadStreams();
+
+/** @} */
+} // End of namespace Audio
+
+#endif
@@ -32,6 +32,7 @@
 #include "common/util.h"
 
 #include "audio/audiostream.h"
+#include "audio/decoders/seekindex.h"
 
 #define FLAC__NO_DLL // that MS-magic gave me headaches - just link the library you like
 #include <FLAC/export.h>
@@ -45,6 +46,13 @@ namespace Audio {
 
 static const uint MAX_OUTPUT_CHANNELS = 2;
 
+enum {
+	// With seek points this far apart, seeking decodes half a second on average
+	kSeekPointSpacingSeconds = 1,
+	// Searching the file is faster than decoding more to get to the target
+	kMaxSeekDecodeSeconds = 3
+};
+
 
 class FLACStream : public SeekableAudioStream {
 protected:
@@ -65,6 +73,18 @@ protected:
 	/** true if the last sample was decoded from the FLAC-API - there might still be data in the buffer */
 	bool _lastSampleWritten;
 
+	/** Identifies the file in the seek index, see Audio::SeekIndex. */
+	Common::String _indexKey;
+	FLAC__uint64 _nextSeekPoint;
+
+	/** After seeking to a point of the index, samples before the target are dropped */
+	bool _skipping;
+	FLAC__uint64 _skipToSample;
+	/** The first frame after seeking to a point must start where the point says */
+	bool _checkSeekPoint;
+	bool _seekPointFailed;
+	FLAC__uint64 _seekPointSample;
+
 	typedef int16 SampleType;
 	enum { BUFTYPE_BITS = 16 };
 
@@ -115,6 +135,7 @@ protected:
 	inline bool processSingleBlock();
 	inline bool processUntilEndOfMetadata();
 	bool seekAbsolute(FLAC__uint64 sample);
+	bool seekToIndexPoint(FLAC__uint64 target);
 
 	inline ::FLAC__StreamDecoderReadStatus callbackRead(FLAC__byte buffer[], size_t *bytes);
 	inline ::FLAC__StreamDecoderSeekStatus callbackSeek(FLAC__uint64 absoluteByteOffset);
@@ -149,6 +170,8 @@ FLACStream::FLACStream(Common::SeekableReadStream *inStream, bool dispose)
 		_disposeAfterUse(dispose),
 		_length(0, 1000), _lastSample(0),
 		_outBuffer(nullptr), _requestedSamples(0), _lastSampleWritten(false),
+		_nextSeekPoint(0), _skipping(false), _skipToSample(0),
+		_checkSeekPoint(false), _seekPointFailed(false), _seekPointSample(0),
 		_methodConvertBuffers(&FLACStream::convertBuffersGeneric)
 {
 	assert(_inStream);
@@ -176,6 +199,16 @@ FLACStream::FLACStream(Common::SeekableReadStream *inStream, bool dispose)
 		if (processUntilEndOfMetadata() && _streaminfo.channels > 0) {
 			_lastSample = _streaminfo.total_samples + 1;
 			_length = Timestamp(0, _lastSample - 1, getRate());
+
+			// Encoders store the MD5 of the decoded audio in the header
+			_indexKey = Common::String::format("flac-%u-%u-%u-", getRate(), (uint)_streaminfo.total_samples, (uint)_inStream->size());
+			for (uint i = 0; i < ARRAYSIZE(_streaminfo.md5sum); ++i)
+				_indexKey += Common::String::format("%02x", _streaminfo.md5sum[i]);
+
+			// The first frame follows the metadata
+			FLAC__uint64 offset;
+			if (::FLAC__stream_decoder_get_decode_position(_decoder, &offset))
+				SeekIndex::add(_indexKey, 0, offset, 1);
 			return; // no error occurred
 		}
 	}
@@ -221,7 +254,49 @@ bool FLACStream::seek(const Timestamp &where) {
 	_sampleCache.bufReadPos = nullptr;
 	// FLAC uses the sample pair number, thus we always use "false" for the isStereo parameter
 	// of the convertTimeToStreamPos helper.
-	return seekAbsolute((FLAC__uint64)convertTimeToStreamPos(where, getRate(), false).totalNumberOfFrames());
+	const FLAC__uint64 target = convertTimeToStreamPos(where, getRate(), false).totalNumberOfFrames();
+	_nextSeekPoint = 0;
+	if (seekToIndexPoint(target))
+		return true;
+	return seekAbsolute(target);
+}
+
+bool FLACStream::seekToIndexPoint(FLAC__uint64 target) {
+	uint64 sample;
+	int64 offset;
+	if (_indexKey.empty() || !SeekIndex::find(_indexKey, target, sample, offset))
+		return false;
+	if (target - sample > (FLAC__uint64)getRate() * kMaxSeekDecodeSeconds)
+		return false;
+
+	// Restart decoding right at the frame of the point
+	if (!::FLAC__stream_decoder_flush(_decoder) || !_inStream->seek(offset, SEEK_SET))
+		return false;
+
+	_lastSampleWritten = false;
+	_skipping = true;
+	_skipToSample = target;
+	_checkSeekPoint = true;
+	_seekPointFailed = false;
+	_seekPointSample = sample;
+
+	// Decode up to the frame the target is in, which ends up in the sample cache
+	while (_skipping && !_lastSampleWritten && !_seekPointFailed) {
+		if (!processSingleBlock() || getStreamDecoderState() != FLAC__STREAM_DECODER_SEARCH_FOR_FRAME_SYNC)
+			break;
+	}
+
+	const bool found = (!_skipping || _lastSampleWritten) && !_seekPointFailed;
+	if (_seekPointFailed)
+		SeekIndex::remove(_indexKey, sample);
+	_skipping = false;
+	_checkSeekPoint = false;
+
+	if (!found) {
+		_sampleCache.bufFill = 0;
+		_sampleCache.bufReadPos = nullptr;
+	}
+	return found;
 }
 
 int FLACStream::readBuffer(int16 *buffer, const int numSamples) {
@@ -495,19 +570,47 @@ inline ::FLAC__StreamDecoderWriteStatus FLACStream::callbackWrite(const ::FLAC__
 	const FLAC__uint64 firstSampleNumber = (frame->header.number_type == FLAC__FRAME_NUMBER_TYPE_SAMPLE_NUMBER) ?
 		frame->header.number.sample_number : (static_cast<FLAC__uint64>(frame->header.number.frame_number)) * _streaminfo.max_blocksize;
 
+	if (_checkSeekPoint) {
+		_checkSeekPoint = false;
+		if (firstSampleNumber != _seekPointSample) {
+			_seekPointFailed = true;
+			return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+		}
+	}
+
+	// Take note of where the next frame starts
+	const FLAC__uint64 nextSampleNumber = firstSampleNumber + frame->header.blocksize;
+	if (!_indexKey.empty() && nextSampleNumber >= _nextSeekPoint) {
+		FLAC__uint64 offset;
+		if (::FLAC__stream_decoder_get_decode_position(_decoder, &offset))
+			SeekIndex::add(_indexKey, nextSampleNumber, offset, (uint64)getRate() * kSeekPointSpacingSeconds);
+		_nextSeekPoint = nextSampleNumber + (FLAC__uint64)getRate() * kSeekPointSpacingSeconds;
+	}
+
 	// Check whether we are about to reach beyond the last sample we are supposed to play.
 	if (_lastSample != 0 && firstSampleNumber + numSamples >= _lastSample) {
 		numSamples = (uint)(firstSampleNumber >= _lastSample ? 0 : _lastSample - firstSampleNumber);
 		_lastSampleWritten = true;
 	}
 
+	// Drop what comes before the target of a seek to a point of the index
+	uint skipSamples = 0;
+	if (_skipping) {
+		if (firstSampleNumber + numSamples <= _skipToSample && !_lastSampleWritten)
+			return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+		if (_skipToSample > firstSampleNumber)
+			skipSamples = (uint)MIN<FLAC__uint64>(_skipToSample - firstSampleNumber, numSamples);
+		_skipping = false;
+	}
+	numSamples -= skipSamples;
+
 	// The value in _requestedSamples counts raw samples, so if there are more than one
 	// channel, we have to multiply the number of available sample "pairs" by numChannels
 	numSamples *= numChannels;
 
 	const FLAC__int32 *inChannels[MAX_OUTPUT_CHANNELS];
 	for (uint i = 0; i < numChannels; ++i)
-		inChannels[i] = buffer[i];
+		inChannels[i] = buffer[i] + skipSamples;
 
 	// write the incoming samples directly into the buffer provided to us by the mixer
 	if (_requestedSamples > 0) {
@@ -0,0 +1,146 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "audio/decoders/seekindex.h"
+
+#include "common/array.h"
+#include "common/hash-str.h"
+#include "common/hashmap.h"
+#include "common/list.h"
+#include "common/mutex.h"
+
+namespace Audio {
+
+namespace SeekIndex {
+
+namespace {
+
+enum {
+	// Files with seek points kept, the oldest ones are forgotten first
+	kMaxFiles = 64
+};
+
+struct Point {
+	uint64 sample;
+	int64 offset;
+};
+
+typedef Common::Array<Point> PointList;
+typedef Common::HashMap<Common::String, PointList> IndexMap;
+
+// Created from the main thread when the first stream is opened
+Common::Mutex *g_seekIndexMutex = nullptr;
+IndexMap *g_seekIndices = nullptr;
+Common::List<Common::String> *g_seekIndexOrder = nullptr;
+
+void init() {
+	if (!g_seekIndexMutex) {
+		g_seekIndexMutex = new Common::Mutex();
+		g_seekIndices = new IndexMap();
+		g_seekIndexOrder = new Common::List<Common::String>();
+	}
+}
+
+// Index of the first point at or after the sample
+uint lowerBound(const PointList &points, uint64 sample) {
+	uint first = 0, last = points.size();
+	while (first < last) {
+		const uint mid = (first + last) / 2;
+		if (points[mid].sample < sample)
+			first = mid + 1;
+		else
+			last = mid;
+	}
+	return first;
+}
+
+} // End of anonymous namespace
+
+void add(const Common::String &key, uint64 sample, int64 offset, uint64 spacing) {
+	init();
+	Common::StackLock lock(*g_seekIndexMutex);
+
+	IndexMap::iterator index = g_seekIndices->find(key);
+	if (index == g_seekIndices->end()) {
+		if (g_seekIndexOrder->size() >= kMaxFiles) {
+			g_seekIndices->erase(g_seekIndexOrder->front());
+			g_seekIndexOrder->pop_front();
+		}
+		g_seekIndexOrder->push_back(key);
+		(*g_seekIndices)[key] = PointList();
+		index = g_seekIndices->find(key);
+	}
+
+	PointList &points = index->_value;
+	const uint pos = lowerBound(points, sample);
+	if (pos < points.size() && points[pos].sample - sample < spacing)
+		return;
+	if (pos > 0 && sample - points[pos - 1].sample < spacing)
+		return;
+
+	Point point;
+	point.sample = sample;
+	point.offset = offset;
+	points.insert_at(pos, point);
+}
+
+bool find(const Common::String &key, uint64 target, uint64 &sample, int64 &offset) {
+	init();
+	Common::StackLock lock(*g_seekIndexMutex);
+
+	IndexMap::const_iterator index = g_seekIndices->find(key);
+	if (index == g_seekIndices->end())
+		return false;
+
+	const PointList &points = index->_value;
+	const uint pos = lowerBound(points, target + 1);
+	if (pos == 0)
+		return false;
+
+	sample = points[pos - 1].sample;
+	offset = points[pos - 1].offset;
+	return true;
+}
+
+void remove(const Common::String &key, uint64 sample) {
+	init();
+	Common::StackLock lock(*g_seekIndexMutex);
+
+	IndexMap::iterator index = g_seekIndices->find(key);
+	if (index == g_seekIndices->end())
+		return;
+
+	PointList &points = index->_value;
+	const uint pos = lowerBound(points, sample);
+	if (pos < points.size() && points[pos].sample == sample)
+		points.remove_at(pos);
+}
+
+void clear() {
+	init();
+	Common::StackLock lock(*g_seekIndexMutex);
+	g_seekIndices->clear();
+	g_seekIndexOrder->clear();
+}
+
+} // End of namespace SeekIndex
+
+} // End of namespace Audio
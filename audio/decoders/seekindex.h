@@ -0,0 +1,75 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AUDIO_DECODERS_SEEKINDEX_H
+#define AUDIO_DECODERS_SEEKINDEX_H
+
+#include "common/str.h"
+#include "common/types.h"
+
+namespace Audio {
+
+/**
+ * Seek points of compressed audio files, shared by all streams of a file.
+ *
+ * Decoders take note of where in the file the decoding of a sample frame
+ * can start while they decode, and look up the nearest point before the
+ * target when seeking, instead of searching the file every time. Loops
+ * and cue points are then found again with a single seek of the input.
+ *
+ * Files are identified by a key which the decoders derive from their
+ * headers, as streams have no name. Since a key could still be shared by
+ * files with different contents, decoders must check where they ended
+ * up after seeking to a point.
+ *
+ * All functions are thread safe.
+ */
+namespace SeekIndex {
+
+/**
+ * Take note of a seek point of a file.
+ *
+ * @param key       Identifies the file.
+ * @param sample    The first sample frame decoded when starting at the point.
+ * @param offset    Where the decoding starts in the file.
+ * @param spacing   Points are not added closer than this many frames to
+ *                  another one.
+ */
+void add(const Common::String &key, uint64 sample, int64 offset, uint64 spacing);
+
+/**
+ * Find the last seek point of a file at or before a sample frame.
+ *
+ * @return true if a point was found.
+ */
+bool find(const Common::String &key, uint64 target, uint64 &sample, int64 &offset);
+
+/** Forget a seek point which turned out to be wrong. */
+void remove(const Common::String &key, uint64 sample);
+
+/** Forget the seek points of all files. */
+void clear();
+
+} // End of namespace SeekIndex
+
+} // End of namespace Audio
+
+#endif // AUDIO_DECODERS_SEEKINDEX_H
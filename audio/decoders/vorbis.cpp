@@ -34,6 +34,7 @@
 #include "common/util.h"
 
 #include "audio/audiostream.h"
+#include "audio/decoders/seekindex.h"
 
 #ifdef USE_TREMOR
 #ifdef USE_TREMOLO
@@ -49,6 +50,13 @@
 
 namespace Audio {
 
+enum {
+	// With seek points this far apart, seeking decodes half a second on average
+	kSeekPointSpacingSeconds = 1,
+	// Searching the file is faster than decoding more to get to the target
+	kMaxSeekDecodeSeconds = 3
+};
+
 // These are wrapper functions to allow using a SeekableReadStream object to
 // provide data to the OggVorbis_File object.
 
@@ -93,11 +101,16 @@ protected:
 
 	bool _isStereo;
 	int _rate;
+	int _channels;
 
 	Timestamp _length;
 
 	OggVorbis_File _ovFile;
 
+	/** Identifies the file in the seek index, see Audio::SeekIndex. */
+	Common::String _indexKey;
+	ogg_int64_t _nextSeekPoint;
+
 	int16 _buffer[4096];
 	const int16 *_bufferEnd;
 	const int16 *_pos;
@@ -117,11 +130,14 @@ public:
 	Timestamp getLength() const override { return _length; }
 protected:
 	bool refill();
+	bool seekToIndexPoint(uint64 target);
+	bool skipFrames(uint64 frames);
 };
 
 VorbisStream::VorbisStream(Common::SeekableReadStream *inStream, DisposeAfterUse::Flag dispose) :
 	_inStream(inStream, dispose),
 	_length(0, 1000),
+	_nextSeekPoint(0),
 	_bufferEnd(ARRAYEND(_buffer)) {
 
 	int res = ov_open_callbacks(inStream, &_ovFile, nullptr, 0, g_stream_wrap);
@@ -131,14 +147,19 @@ VorbisStream::VorbisStream(Common::SeekableReadStream *inStream, DisposeAfterUse
 		return;
 	}
 
+	// Setup some header information
+	_channels = ov_info(&_ovFile, -1)->channels;
+	_isStereo = _channels >= 2;
+	_rate = ov_info(&_ovFile, -1)->rate;
+
+	// The serial number is random for each encoded file
+	_indexKey = Common::String::format("vorbis-%08x-%u-%u", (uint)ov_serialnumber(&_ovFile, -1),
+		(uint)ov_raw_total(&_ovFile, -1), (uint)ov_pcm_total(&_ovFile, -1));
+
 	// Read in initial data
 	if (!refill())
 		return;
 
-	// Setup some header information
-	_isStereo = ov_info(&_ovFile, -1)->channels >= 2;
-	_rate = ov_info(&_ovFile, -1)->rate;
-
 #ifdef USE_TREMOR
 	_length = Timestamp(ov_time_total(&_ovFile, -1), getRate());
 #else
@@ -169,7 +190,12 @@ int VorbisStream::readBuffer(int16 *buffer, const int numSamples) {
 bool VorbisStream::seek(const Timestamp &where) {
 	// Vorbisfile uses the sample pair number, thus we always use "false" for the isStereo parameter
 	// of the convertTimeToStreamPos helper.
-	int res = ov_pcm_seek(&_ovFile, convertTimeToStreamPos(where, getRate(), false).totalNumberOfFrames());
+	const uint64 target = convertTimeToStreamPos(where, getRate(), false).totalNumberOfFrames();
+	_nextSeekPoint = 0;
+	if (seekToIndexPoint(target))
+		return true;
+
+	int res = ov_pcm_seek(&_ovFile, target);
 	if (res) {
 		warning("Error seeking in Vorbis stream (%d)", res);
 		_pos = _bufferEnd;
@@ -179,7 +205,68 @@ bool VorbisStream::seek(const Timestamp &where) {
 	return refill();
 }
 
+bool VorbisStream::seekToIndexPoint(uint64 target) {
+	uint64 sample;
+	int64 offset;
+	while (SeekIndex::find(_indexKey, target, sample, offset)) {
+		if (target - sample > (uint64)_rate * kMaxSeekDecodeSeconds)
+			return false;
+
+		if (ov_raw_seek(&_ovFile, offset)) {
+			SeekIndex::remove(_indexKey, sample);
+			continue;
+		}
+
+		// Points are noted down while decoding, before the exact sample they
+		// start at is known. Vorbisfile tells it after seeking, so the index
+		// gets corrected the first time a point is used.
+		const ogg_int64_t actual = ov_pcm_tell(&_ovFile);
+		if (actual < 0) {
+			SeekIndex::remove(_indexKey, sample);
+			continue;
+		}
+		if ((uint64)actual != sample) {
+			SeekIndex::remove(_indexKey, sample);
+			SeekIndex::add(_indexKey, actual, offset, 1);
+		}
+
+		if ((uint64)actual <= target)
+			return skipFrames(target - actual);
+	}
+
+	return false;
+}
+
+bool VorbisStream::skipFrames(uint64 frames) {
+	if (!refill())
+		return false;
+
+	uint64 skip = frames * _channels;
+	while (true) {
+		const uint64 available = _bufferEnd - _pos;
+		if (available == 0)
+			return true;
+		if (skip < available) {
+			_pos += skip;
+			return true;
+		}
+
+		skip -= available;
+		if (!refill())
+			return false;
+	}
+}
+
 bool VorbisStream::refill() {
+	// Take note of where decoding the samples to come could start from
+	const ogg_int64_t sample = ov_pcm_tell(&_ovFile);
+	if (sample >= _nextSeekPoint) {
+		const ogg_int64_t offset = ov_raw_tell(&_ovFile);
+		if (offset >= 0)
+			SeekIndex::add(_indexKey, sample, offset, (uint64)_rate * kSeekPointSpacingSeconds);
+		_nextSeekPoint = sample + _rate * kSeekPointSpacingSeconds;
+	}
+
 	// Read the samples
 	uint len_left = sizeof(_buffer);
 	char *read_pos = (char *)_buffer;
@@ -34,6 +34,21 @@
 
 namespace OPL {
 
+namespace {
+
+enum {
+	kRenderAheadMillis = 100
+};
+
+template<class T>
+T *setupEmulator(T *opl) {
+	if (ConfMan.getBool("opl_render_ahead"))
+		opl->setRenderAhead(kRenderAheadMillis);
+	return opl;
+}
+
+} // End of anonymous namespace
+
 // Factory functions
 
 #ifdef USE_ALSA
@@ -64,7 +79,8 @@ enum OplEmulator {
 	kNuked = 4,
 	kOPL2LPT = 5,
 	kOPL3LPT = 6,
-	kRWOPL3 = 7
+	kRWOPL3 = 7,
+	kNukedSIMD = 8
 };
 
 OPL::OPL() {
@@ -85,6 +101,9 @@ const Config::EmulatorDescription Config::_drivers[] = {
 #endif
 #ifndef DISABLE_NUKED_OPL
 	{ "nuked", _s("Nuked OPL emulator"), kNuked, kFlagOpl2 | kFlagDualOpl2 | kFlagOpl3 },
+#if defined(SCUMMVM_SSE2) || defined(SCUMMVM_NEON)
+	{ "nuked_simd", _s("Nuked OPL emulator (SIMD)"), kNukedSIMD, kFlagOpl2 | kFlagDualOpl2 | kFlagOpl3 },
+#endif
 #endif
 #ifdef USE_ALSA
 	{ "alsa", _s("ALSA Direct FM"), kALSA, kFlagOpl2 | kFlagDualOpl2 | kFlagOpl3 },
@@ -201,19 +220,24 @@ OPL *Config::create(DriverId driver, OplType type) {
 	switch (driver) {
 	case kMame:
 		if (type == kOpl2)
-			return new MAME::OPL();
+			return setupEmulator(new MAME::OPL());
 		else
 			warning("MAME OPL emulator only supports OPL2 emulation");
 		return nullptr;
 
 #ifndef DISABLE_DOSBOX_OPL
 	case kDOSBox:
-		return new DOSBox::OPL(type);
+		return setupEmulator(new DOSBox::OPL(type));
 #endif
 
 #ifndef DISABLE_NUKED_OPL
 	case kNuked:
-		return new NUKED::OPL(type);
+		return setupEmulator(new NUKED::OPL(type));
+
+#if defined(SCUMMVM_SSE2) || defined(SCUMMVM_NEON)
+	case kNukedSIMD:
+		return setupEmulator(new NUKED::OPL(type, true));
+#endif
 #endif
 
 #ifdef USE_ALSA
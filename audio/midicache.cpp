@@ -0,0 +1,371 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "audio/midicache.h"
+#include "audio/audiostream.h"
+#include "audio/decoders/raw.h"
+
+#include "common/config-manager.h"
+#include "common/debug.h"
+#include "common/md5.h"
+#include "common/memstream.h"
+#include "common/savefile.h"
+#include "common/substream.h"
+#include "common/system.h"
+#include "common/textconsole.h"
+
+namespace Audio {
+
+enum {
+	kCacheHeaderSize = 12,
+	kCacheFlagLittleEndian = 1 << 0,
+	// Recordings of anything longer are dropped, it might never end
+	kMaxRecordingSeconds = 10 * 60
+};
+
+static const uint32 kCacheTag = MKTAG('M', 'R', 'C', '1');
+
+#ifdef SCUMM_LITTLE_ENDIAN
+static const bool kNativeLittleEndian = true;
+#else
+static const bool kNativeLittleEndian = false;
+#endif
+
+MidiRenderCache::MidiRenderCache(int rate, bool stereo, const Common::String &settings) :
+	_rate(rate),
+	_channels(stereo ? 2 : 1),
+	_settings(settings),
+	_requestedPlaying(false),
+	_state(kStateIdle),
+	_stream(nullptr),
+	_recording(nullptr),
+	_recordingLimit(kMaxRecordingSeconds * rate * _channels * sizeof(int16)),
+	_finished(nullptr),
+	_finishedSize(0),
+	_finishedWritten(true),
+	_writing(false),
+	_sysExState(0) {
+}
+
+MidiRenderCache::~MidiRenderCache() {
+	flush();
+
+	for (uint i = 0; i < _requests.size(); ++i)
+		delete _requests[i].stream;
+	delete _stream;
+	dropRecording();
+	free(_finished);
+	for (uint i = 0; i < _retired.size(); ++i)
+		free(_retired[i]);
+}
+
+bool MidiRenderCache::isEnabled() {
+	return ConfMan.hasKey("midi_render_cache") && ConfMan.getBool("midi_render_cache");
+}
+
+Common::String MidiRenderCache::makeKey(const Common::String &trackKey) const {
+	const Common::String key = Common::String::format("%s|%s|%08x|%u", _settings.c_str(), trackKey.c_str(), _sysExState, _sysExSeen.size());
+	Common::MemoryReadStream stream((const byte *)key.c_str(), key.size());
+	return "midicache-" + Common::computeStreamMD5AsString(stream);
+}
+
+static byte getRawFlags(int channels, bool littleEndian) {
+	return FLAG_16BITS | (channels == 2 ? FLAG_STEREO : 0) | (littleEndian ? FLAG_LITTLE_ENDIAN : 0);
+}
+
+SeekableAudioStream *MidiRenderCache::openCached(const Common::String &key) const {
+	Common::SaveFileManager *saveMan = g_system ? g_system->getSavefileManager() : nullptr;
+	Common::SeekableReadStream *file = saveMan ? saveMan->openForLoading(key) : nullptr;
+	if (!file)
+		return nullptr;
+
+	const uint32 tag = file->readUint32BE();
+	const uint32 rate = file->readUint32LE();
+	const byte channels = file->readByte();
+	const byte flags = file->readByte();
+	file->skip(2);
+
+	if (file->err() || file->eos() || tag != kCacheTag || rate != (uint32)_rate || channels != _channels) {
+		debug(3, "MidiRenderCache: Ignoring unusable cache file '%s'", key.c_str());
+		delete file;
+		return nullptr;
+	}
+
+	int64 end = file->size();
+	end -= (end - kCacheHeaderSize) % (channels * sizeof(int16));
+	Common::SeekableReadStream *samples = new Common::SeekableSubReadStream(file, kCacheHeaderSize, end, DisposeAfterUse::YES);
+	return makeRawStream(samples, _rate, getRawFlags(channels, flags & kCacheFlagLittleEndian));
+}
+
+bool MidiRenderCache::start(const Common::String &trackKey, uint offset) {
+	Common::StackLock lock(_mutex);
+
+	Request request;
+	request.type = Request::kStart;
+	request.offset = offset;
+	request.key = makeKey(trackKey);
+	request.stream = nullptr;
+
+	// A recording which just finished is played from memory
+	if (request.key != _requestedFinished)
+		request.stream = openCached(request.key);
+
+	_requestedPlaying = request.stream || request.key == _requestedFinished;
+	if (_requestedPlaying)
+		_requestedRecording.clear();
+	else
+		_requestedRecording = request.key;
+
+	_requests.push_back(request);
+	return _requestedPlaying;
+}
+
+void MidiRenderCache::finish(uint offset) {
+	Common::StackLock lock(_mutex);
+
+	if (!_requestedRecording.empty())
+		_requestedFinished = _requestedRecording;
+	_requestedRecording.clear();
+	_requestedPlaying = false;
+
+	Request request;
+	request.type = Request::kFinish;
+	request.offset = offset;
+	request.stream = nullptr;
+	_requests.push_back(request);
+}
+
+void MidiRenderCache::stop(uint offset) {
+	Common::StackLock lock(_mutex);
+
+	if (_requestedRecording.empty() && !_requestedPlaying)
+		return;
+	_requestedRecording.clear();
+	_requestedPlaying = false;
+
+	Request request;
+	request.type = Request::kStop;
+	request.offset = offset;
+	request.stream = nullptr;
+	_requests.push_back(request);
+}
+
+bool MidiRenderCache::isPlaying() const {
+	Common::StackLock lock(_mutex);
+	return _requestedPlaying;
+}
+
+void MidiRenderCache::noteSysEx(const byte *msg, uint16 length) {
+	// FNV-1a
+	uint32 hash = 2166136261u;
+	for (uint16 i = 0; i < length; ++i)
+		hash = (hash ^ msg[i]) * 16777619u;
+
+	// Only distinct messages count, so that sending the same ones again,
+	// e.g. with every loop of a track, still finds the same recordings
+	Common::StackLock lock(_mutex);
+	if (!_sysExSeen.contains(hash)) {
+		_sysExSeen[hash] = true;
+		_sysExState += hash;
+	}
+}
+
+bool MidiRenderCache::beginBlock() {
+	Common::StackLock lock(_mutex);
+	return _state == kStatePlaying && _requests.empty();
+}
+
+void MidiRenderCache::endBlock(int16 *data, uint frames, bool cached) {
+	Common::StackLock lock(_mutex);
+
+	if (!_writing) {
+		for (uint i = 0; i < _retired.size(); ++i)
+			free(_retired[i]);
+		_retired.clear();
+	}
+
+	if (_state == kStateIdle && _requests.empty())
+		return;
+
+	// A playback stopped during a block that was not synthesized fills the
+	// rest of it, which is better than a gap
+	SeekableAudioStream *stopped = nullptr;
+	uint pos = 0;
+	for (uint i = 0; i < _requests.size(); ++i) {
+		Request &request = _requests[i];
+		const uint offset = CLIP<uint>(request.offset, pos, frames);
+		process(data, pos, offset, cached, stopped);
+		pos = offset;
+
+		if (_state == kStatePlaying) {
+			if (stopped)
+				delete _stream;
+			else
+				stopped = _stream;
+			_stream = nullptr;
+		}
+
+		apply(request);
+		if (request.type == Request::kStart && _state == kStateIdle && i == _requests.size() - 1) {
+			// The recording to play got dropped
+			_requestedPlaying = false;
+		}
+	}
+	process(data, pos, frames, cached, stopped);
+
+	delete stopped;
+	_requests.clear();
+}
+
+void MidiRenderCache::apply(Request &request) {
+	// Whatever was going on ends here
+	if (_state == kStateRecording && request.type != Request::kFinish)
+		dropRecording();
+	_state = kStateIdle;
+
+	switch (request.type) {
+	case Request::kStart:
+		if (request.stream) {
+			_stream = request.stream;
+			request.stream = nullptr;
+			_state = kStatePlaying;
+		} else if (request.key == _requestedFinished) {
+			if (_finished && request.key == _finishedKey) {
+				_stream = makeRawStream(_finished, _finishedSize, _rate, getRawFlags(_channels, kNativeLittleEndian), DisposeAfterUse::NO);
+				_state = kStatePlaying;
+			}
+		} else {
+			_recording = new Common::MemoryWriteStreamDynamic(DisposeAfterUse::NO);
+			_recordingKey = request.key;
+			_state = kStateRecording;
+		}
+		break;
+
+	case Request::kFinish:
+		if (_recording) {
+			if (_finished)
+				_retired.push_back(_finished);
+			_finished = _recording->getData();
+			_finishedSize = _recording->size();
+			_finishedKey = _recordingKey;
+			_finishedWritten = false;
+
+			delete _recording;
+			_recording = nullptr;
+			_recordingKey.clear();
+		}
+		break;
+
+	case Request::kStop:
+		break;
+	}
+}
+
+void MidiRenderCache::process(int16 *data, uint from, uint to, bool cached, SeekableAudioStream *stopped) {
+	if (from >= to)
+		return;
+
+	int16 *samples = data + from * _channels;
+	const int count = (to - from) * _channels;
+
+	SeekableAudioStream *stream = nullptr;
+	switch (_state) {
+	case kStateRecording:
+		if (_recording->size() + count * sizeof(int16) > _recordingLimit) {
+			debug(3, "MidiRenderCache: Track too long, not caching it");
+			dropRecording();
+			_requestedRecording.clear();
+			_state = kStateIdle;
+		} else {
+			_recording->write(samples, count * sizeof(int16));
+		}
+		return;
+
+	case kStatePlaying:
+		stream = _stream;
+		break;
+
+	case kStateIdle:
+		// Rendered live
+		if (!cached)
+			return;
+		stream = stopped;
+		break;
+	}
+
+	int read = stream ? stream->readBuffer(samples, count) : 0;
+	if (read < 0)
+		read = 0;
+	memset(samples + read, 0, (count - read) * sizeof(int16));
+}
+
+void MidiRenderCache::dropRecording() {
+	if (!_recording)
+		return;
+
+	free(_recording->getData());
+	delete _recording;
+	_recording = nullptr;
+	_recordingKey.clear();
+}
+
+void MidiRenderCache::flush() {
+	byte *data;
+	uint32 size;
+	Common::String key;
+	{
+		Common::StackLock lock(_mutex);
+		if (!_finished || _finishedWritten)
+			return;
+		data = _finished;
+		size = _finishedSize;
+		key = _finishedKey;
+		// Keeps the data around while it is written without the mutex
+		_writing = true;
+	}
+
+	Common::SaveFileManager *saveMan = g_system ? g_system->getSavefileManager() : nullptr;
+	Common::OutSaveFile *file = saveMan ? saveMan->openForSaving(key) : nullptr;
+	if (file) {
+		file->writeUint32BE(kCacheTag);
+		file->writeUint32LE(_rate);
+		file->writeByte(_channels);
+		file->writeByte(kNativeLittleEndian ? kCacheFlagLittleEndian : 0);
+		file->writeUint16LE(0);
+		file->write(data, size);
+		file->finalize();
+
+		const bool failed = file->err();
+		delete file;
+		if (failed) {
+			warning("MidiRenderCache: Could not write '%s'", key.c_str());
+			saveMan->removeSavefile(key);
+		}
+	}
+
+	Common::StackLock lock(_mutex);
+	_writing = false;
+	// Even if writing failed, there is no use in trying again
+	if (data == _finished)
+		_finishedWritten = true;
+}
+
+} // End of namespace Audio
@@ -0,0 +1,187 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef AUDIO_MIDICACHE_H
+#define AUDIO_MIDICACHE_H
+
+#include "common/array.h"
+#include "common/hashmap.h"
+#include "common/mutex.h"
+#include "common/noncopyable.h"
+#include "common/str.h"
+
+namespace Common {
+class MemoryWriteStreamDynamic;
+}
+
+namespace Audio {
+
+/**
+ * @defgroup audio_midicache MIDI render cache
+ * @ingroup audio
+ *
+ * @brief On-disk cache of the output of software synthesizers.
+ * @{
+ */
+
+class SeekableAudioStream;
+
+/**
+ * Records what a software synthesizer renders for a whole MIDI track, and
+ * plays the recording back instead of synthesizing the track again.
+ *
+ * The first time a track plays through from its first to its last tick,
+ * the output is recorded and stored compressed in the saves directory.
+ * From then on the driver streams the recording while the parser only
+ * keeps the time. Recordings are identified by the track data, the synth
+ * settings and the SysEx messages the synth received before, which decide
+ * the instruments it plays with.
+ *
+ * Anything that makes the output differ from the recording ends this:
+ * events not coming from the parser, jumps, tempo changes and loops
+ * inside the track. The parser then brings the synth up to date and
+ * playback goes on rendered live.
+ *
+ * Each MidiDriver_Emulated which supports caching owns one of these; it is
+ * used through the render cache calls of the driver and MidiParser.
+ * Events are requested from the parser callbacks, at a frame offset into
+ * the block the driver is rendering, and take effect when the block is
+ * done.
+ */
+class MidiRenderCache : Common::NonCopyable {
+public:
+	/**
+	 * @param rate      Sample rate of the synth.
+	 * @param stereo    Whether the synth renders in stereo.
+	 * @param settings  Settings of the synth its output depends on.
+	 */
+	MidiRenderCache(int rate, bool stereo, const Common::String &settings);
+	~MidiRenderCache();
+
+	/** Whether the cache is enabled by the user. */
+	static bool isEnabled();
+
+	/**
+	 * Start a track at its first tick, at the given offset into the block.
+	 *
+	 * @return true if the track is played back from the cache.
+	 */
+	bool start(const Common::String &trackKey, uint offset);
+
+	/** The track has played through; keep the recording, if any. */
+	void finish(uint offset);
+
+	/** Drop the recording or stop the playback, if any. */
+	void stop(uint offset);
+
+	/** Whether the track started last is still played back from the cache. */
+	bool isPlaying() const;
+
+	/** Take note of a SysEx message sent to the synth. */
+	void noteSysEx(const byte *msg, uint16 length);
+
+	/**
+	 * Called by the driver before it renders a block.
+	 *
+	 * @return true if the block should not be synthesized, as it is played
+	 *         back from the cache.
+	 */
+	bool beginBlock();
+
+	/**
+	 * Called by the driver when a block has been rendered, to record it or
+	 * to fill in the cached output.
+	 *
+	 * @param data    The samples of the block.
+	 * @param frames  Length of the block in sample frames.
+	 * @param cached  The result of beginBlock().
+	 */
+	void endBlock(int16 *data, uint frames, bool cached);
+
+	/**
+	 * Write a finished recording to disk. This is slow, and done from the
+	 * thread calling it, so it should not be called from the mixer.
+	 */
+	void flush();
+
+private:
+	enum State {
+		kStateIdle,
+		kStateRecording,
+		kStatePlaying
+	};
+
+	struct Request {
+		enum Type {
+			kStart,
+			kFinish,
+			kStop
+		};
+
+		Type type;
+		uint offset;
+		Common::String key;
+		SeekableAudioStream *stream; ///< Cached output from disk, for kStart
+	};
+
+	Common::String makeKey(const Common::String &trackKey) const;
+	SeekableAudioStream *openCached(const Common::String &key) const;
+	void apply(Request &request);
+	void process(int16 *data, uint from, uint to, bool cached, SeekableAudioStream *stream);
+	void dropRecording();
+	void retire(byte *data);
+
+	const int _rate;
+	const int _channels;
+	const Common::String _settings;
+
+	mutable Common::Mutex _mutex;
+
+	/** Requests for the current block. */
+	Common::Array<Request> _requests;
+	/** The state with all requests applied. */
+	Common::String _requestedRecording;
+	Common::String _requestedFinished;
+	bool _requestedPlaying;
+
+	State _state;
+	SeekableAudioStream *_stream;
+	Common::MemoryWriteStreamDynamic *_recording;
+	Common::String _recordingKey;
+	uint32 _recordingLimit;
+
+	/** Last finished recording, kept in memory for playing it again. */
+	byte *_finished;
+	uint32 _finishedSize;
+	Common::String _finishedKey;
+	bool _finishedWritten;
+	bool _writing;
+	Common::Array<byte *> _retired;
+
+	/** Hashes of the distinct SysEx messages seen, and their sum. */
+	Common::HashMap<uint32, bool> _sysExSeen;
+	uint32 _sysExState;
+};
+
+/** @} */
+} // End of namespace Audio
+
+#endif
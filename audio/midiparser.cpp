@@ -21,6 +21,9 @@
 
 #include "audio/midiparser.h"
 #include "audio/mididrv.h"
+#include "audio/softsynth/emumidi.h"
+#include "common/md5.h"
+#include "common/memstream.h"
 #include "common/textconsole.h"
 #include "common/util.h"
 
@@ -50,7 +53,17 @@ _activeTrack(255),
 _abortParse(false),
 _jumpingToTick(false),
 _doParse(true),
-_pause(false) {
+_pause(false),
+_renderCacheDriver(nullptr),
+_renderCacheStart(false),
+_renderCacheMuted(false),
+_tempoEvent(false),
+_jumpCheckpointsEnabled(false),
+_jumpCheckpointsTempo(0),
+_jumpStartTempoMatters(false),
+_jumpEventCount(0),
+_jumpTempoEvent(false),
+_jumpChannelsValid(false) {
 	memset(_activeNotes, 0, sizeof(_activeNotes));
 	memset(_tracks, 0, sizeof(_tracks));
 	memset(_numSubtracks, 1, sizeof(_numSubtracks));
@@ -81,17 +94,30 @@ void MidiParser::property(int prop, int value) {
 	case mpDisableAutoStartPlayback:
 		_disableAutoStartPlayback = (value != 0);
 		break;
+	case mpJumpCheckpoints:
+		_jumpCheckpointsEnabled = (value != 0);
+		clearJumpCheckpoints();
+		break;
 	default:
 		break;
 	}
 }
 
 void MidiParser::sendToDriver(uint32 b) {
+	if (_renderCacheDriver) {
+		if (_renderCacheMuted)
+			return;
+		_renderCacheDriver->setParserEvent(true);
+	}
+
 	if (_source < 0) {
 		_driver->send(b);
 	} else {
 		_driver->send(_source, b);
 	}
+
+	if (_renderCacheDriver)
+		_renderCacheDriver->setParserEvent(false);
 }
 
 void MidiParser::sendMetaEventToDriver(byte type, byte *data, uint16 length) {
@@ -103,6 +129,10 @@ void MidiParser::sendMetaEventToDriver(byte type, byte *data, uint16 length) {
 }
 
 void MidiParser::setTempo(uint32 tempo) {
+	// The recording is only valid for the tempo changes of the track itself
+	if (tempo != _tempo && !_tempoEvent)
+		stopRenderCache(true);
+
 	_tempo = tempo;
 	if (_ppqn)
 		_psecPerTick = (tempo + (_ppqn >> 2)) / _ppqn;
@@ -201,6 +231,12 @@ void MidiParser::onTimer() {
 	if (!_position.isTracking() || !_driver || !_doParse || _pause || !_driver->isReady(_source))
 		return;
 
+	if (_renderCacheStart)
+		startRenderCache();
+	else if (_renderCacheMuted && !_renderCacheDriver->isPlayingRenderCache())
+		// Events from elsewhere stopped the playback
+		stopRenderCache(true);
+
 	_abortParse = false;
 	endTime = _position._playTime + _timerRate;
 
@@ -283,6 +319,8 @@ void MidiParser::onTimer() {
 			// eventually. Reset the tracker time and tick values to prevent
 			// this from happening.
 			rebaseTracking();
+			// Playing through is what gets recorded
+			stopRenderCache(true);
 		}
 	}
 }
@@ -354,11 +392,17 @@ bool MidiParser::processEvent(const EventInfo &info, bool fireEvents) {
 				// the previous SysEx hasn't passed yet.
 				return false;
 
-			uint16 delay;
-			if (info.ext.data[info.length-1] == 0xF7)
-				delay = _driver->sysExNoDelay(info.ext.data, (uint16)info.length-1);
-			else
-				delay = _driver->sysExNoDelay(info.ext.data, (uint16)info.length);
+			uint16 delay = 0;
+			if (!_renderCacheMuted) {
+				if (_renderCacheDriver)
+					_renderCacheDriver->setParserEvent(true);
+				if (info.ext.data[info.length-1] == 0xF7)
+					delay = _driver->sysExNoDelay(info.ext.data, (uint16)info.length-1);
+				else
+					delay = _driver->sysExNoDelay(info.ext.data, (uint16)info.length);
+				if (_renderCacheDriver)
+					_renderCacheDriver->setParserEvent(false);
+			}
 
 			// Set the delay in microseconds so the next
 			// SysEx event will be delayed if necessary.
@@ -373,8 +417,10 @@ bool MidiParser::processEvent(const EventInfo &info, bool fireEvents) {
 			_position.stopTracking(info.subtrack);
 			if (!_position.isTracking()) {
 				// All subtracks have finished playing
+				finishRenderCache();
 				if (_autoLoop) {
 					jumpToTick(0);
+					_renderCacheStart = true;
 				} else {
 					stopPlaying();
 					if (fireEvents)
@@ -387,7 +433,9 @@ bool MidiParser::processEvent(const EventInfo &info, bool fireEvents) {
 			sendEventToDriver = false;
 		} else if (info.ext.type == 0x51) {
 			if (info.length >= 3) {
+				_tempoEvent = true;
 				setTempo(info.ext.data[0] << 16 | info.ext.data[1] << 8 | info.ext.data[2]);
+				_tempoEvent = false;
 			}
 		}
 		if (fireEvents && sendEventToDriver)
@@ -425,10 +473,14 @@ void MidiParser::allNotesOff() {
 	}
 	_hangingNotesCount = 0;
 
-	if (!_disableAllNotesOffMidiEvents) {
+	if (!_disableAllNotesOffMidiEvents && !_renderCacheMuted) {
 		// To be sure, send an "All Note Off" event (but not all MIDI devices
 		// support this...).
+		if (_renderCacheDriver)
+			_renderCacheDriver->setParserEvent(true);
 		_driver->stopAllNotes(_sendSustainOffOnNotesOff);
+		if (_renderCacheDriver)
+			_renderCacheDriver->setParserEvent(false);
 	}
 
 	memset(_activeNotes, 0, sizeof(_activeNotes));
@@ -455,6 +507,12 @@ bool MidiParser::setTrack(int track) {
 	else if (track == _activeTrack && isPlaying())
 		return true;
 
+	stopRenderCache(false);
+	if (MidiDriver_Emulated *synth = dynamic_cast<MidiDriver_Emulated *>(_driver))
+		synth->flushRenderCache();
+	if (track != _activeTrack)
+		clearJumpCheckpoints();
+
 	if (_smartJump)
 		hangAllActiveNotes();
 	else if (isPlaying())
@@ -478,11 +536,13 @@ bool MidiParser::setTrack(int track) {
 		parseNextEvent(_nextSubtrackEvents[i]);
 	}
 	determineNextEvent();
+	_renderCacheStart = true;
 
 	return true;
 }
 
 void MidiParser::stopPlaying() {
+	stopRenderCache(false);
 	if (isPlaying())
 		allNotesOff();
 	resetTracking();
@@ -502,6 +562,7 @@ bool MidiParser::startPlaying() {
 			parseNextEvent(_nextSubtrackEvents[i]);
 		}
 		determineNextEvent();
+		_renderCacheStart = true;
 	}
 
 	_doParse = true;
@@ -510,6 +571,7 @@ bool MidiParser::startPlaying() {
 
 void MidiParser::pausePlaying() {
 	if (isPlaying() && !_pause) {
+		stopRenderCache(true);
 		_pause = true;
 		allNotesOff();
 	}
@@ -572,6 +634,8 @@ bool MidiParser::jumpToTick(uint32 tick, bool fireEvents, bool stopNotes, bool d
 	if (_activeTrack >= _numTracks || _pause)
 		return false;
 
+	stopRenderCache(true);
+
 	assert(!_jumpingToTick); // This function is not re-entrant
 	_jumpingToTick = true;
 
@@ -582,23 +646,58 @@ bool MidiParser::jumpToTick(uint32 tick, bool fireEvents, bool stopNotes, bool d
 		currentSubtrackEvents[i] = _nextSubtrackEvents[i];
 	}
 
-	resetTracking();
-	for (int i = 0; i < _numSubtracks[_activeTrack]; i++) {
-		_position._subtracks[i]._playPos = _tracks[_activeTrack][i];
-		parseNextEvent(_nextSubtrackEvents[i]);
+	const int checkpoint = findJumpCheckpoint(tick, fireEvents, stopNotes, dontSendNoteOn);
+	if (checkpoint >= 0) {
+		restoreJumpCheckpoint(checkpoint, fireEvents);
+	} else {
+		resetTracking();
+		for (int i = 0; i < _numSubtracks[_activeTrack]; i++) {
+			_position._subtracks[i]._playPos = _tracks[_activeTrack][i];
+			parseNextEvent(_nextSubtrackEvents[i]);
+		}
+		determineNextEvent();
+
+		if (_jumpCheckpoints.empty()) {
+			_jumpCheckpointsTempo = _tempo;
+			_jumpStartTempoMatters = false;
+		}
+		_jumpEventCount = 0;
+		_jumpTempoEvent = false;
+		_jumpChannelsValid = true;
+		for (int i = 0; i < 16; i++)
+			_jumpChannels[i].clear();
 	}
-	determineNextEvent();
 	if (tick > 0) {
 		while (true) {
 			EventInfo &info = *_nextEvent;
 			uint8 subtrack = info.subtrack;
 			uint32 eventTick = _position._subtracks[subtrack]._lastEventTick + info.delta;
+
+			if (_jumpCheckpointsEnabled && _jumpEventCount == (_jumpCheckpoints.size() + 1) * kJumpCheckpointSpacing) {
+				_jumpCheckpoints.resize(_jumpCheckpoints.size() + 1);
+				JumpCheckpoint &newCheckpoint = _jumpCheckpoints.back();
+				newCheckpoint.position = _position;
+				for (int i = 0; i < _numSubtracks[_activeTrack]; i++)
+					newCheckpoint.nextSubtrackEvents[i] = _nextSubtrackEvents[i];
+				newCheckpoint.nextEvent = subtrack;
+				newCheckpoint.nextEventTick = eventTick;
+				newCheckpoint.tempo = _tempo;
+				newCheckpoint.tempoEvent = _jumpTempoEvent;
+				newCheckpoint.channelsValid = _jumpChannelsValid;
+				memcpy(newCheckpoint.channels, _jumpChannels, sizeof(_jumpChannels));
+			}
+
 			if (eventTick >= tick) {
 				_position._playTime += (tick - _position._lastEventTick) * _psecPerTick;
 				_position._playTick = tick;
 				break;
 			}
 
+			if (_jumpCheckpointsEnabled) {
+				trackJumpEvent(info, eventTick);
+				_jumpEventCount++;
+			}
+
 			// Some special processing for the fast-forward case
 			if (info.command() == 0x9 && dontSendNoteOn) {
 				// Don't send note on; doing so creates a "warble" with
@@ -667,12 +766,160 @@ bool MidiParser::jumpToTick(uint32 tick, bool fireEvents, bool stopNotes, bool d
 	return true;
 }
 
+void MidiParser::JumpChannelState::clear() {
+	program = -1;
+	memset(programBank, 0xFF, sizeof(programBank));
+	memset(bank, 0xFF, sizeof(bank));
+	memset(controllers, 0xFF, sizeof(controllers));
+	pitchBend = -1;
+	pressure = -1;
+}
+
+void MidiParser::clearJumpCheckpoints() {
+	_jumpCheckpoints.clear();
+}
+
+void MidiParser::trackJumpEvent(const EventInfo &info, uint32 eventTick) {
+	// Until the track sets the tempo, its times depend on the tempo it
+	// was jumped through at
+	if (eventTick > 0 && !_jumpTempoEvent)
+		_jumpStartTempoMatters = true;
+
+	JumpChannelState &channel = _jumpChannels[info.channel()];
+	switch (info.command()) {
+	case 0x8:
+	case 0x9:
+		break;
+	case 0xB:
+		if (info.basic.param1 == 0 || info.basic.param1 == 32) {
+			channel.bank[info.basic.param1 ? 1 : 0] = info.basic.param2;
+		} else if (info.basic.param1 == 6 || info.basic.param1 == 38 || (info.basic.param1 >= 96 && info.basic.param1 <= 101) ||
+		           info.basic.param1 >= 120) {
+			// (N)RPN data entry and channel mode messages depend on what
+			// came before them, they can't be replaced by their last value
+			_jumpChannelsValid = false;
+		} else {
+			channel.controllers[info.basic.param1] = info.basic.param2;
+		}
+		break;
+	case 0xC:
+		channel.program = info.basic.param1;
+		memcpy(channel.programBank, channel.bank, sizeof(channel.bank));
+		break;
+	case 0xD:
+		channel.pressure = info.basic.param1;
+		break;
+	case 0xE:
+		channel.pitchBend = info.basic.param1 | (info.basic.param2 << 7);
+		break;
+	case 0xF:
+		if (info.event == 0xFF) {
+			// Text, time and key signatures and the like don't change
+			// the playback
+			const byte type = info.ext.type;
+			if (type == 0x51)
+				_jumpTempoEvent = true;
+			else if (type > 0x0F && type != 0x20 && type != 0x21 && type != 0x2F && type != 0x54 && type != 0x58 && type != 0x59)
+				_jumpChannelsValid = false;
+		} else {
+			_jumpChannelsValid = false;
+		}
+		break;
+	default:
+		// Polyphonic key pressure is kept by note
+		_jumpChannelsValid = false;
+		break;
+	}
+}
+
+int MidiParser::findJumpCheckpoint(uint32 tick, bool fireEvents, bool stopNotes, bool dontSendNoteOn) {
+	if (!_jumpCheckpointsEnabled || _jumpCheckpoints.empty())
+		return -1;
+
+	if (_jumpStartTempoMatters && _tempo != _jumpCheckpointsTempo) {
+		clearJumpCheckpoints();
+		return -1;
+	}
+
+	// Starting from a checkpoint skips sending the notes up to it, which
+	// only makes no difference when they would have been stopped anyway
+	if (fireEvents && !dontSendNoteOn && (!stopNotes || _smartJump))
+		return -1;
+
+	// The last checkpoint before the event where the jump ends
+	uint first = 0, last = _jumpCheckpoints.size();
+	while (first < last) {
+		const uint mid = (first + last) / 2;
+		if (_jumpCheckpoints[mid].nextEventTick < tick && (!fireEvents || _jumpCheckpoints[mid].channelsValid))
+			first = mid + 1;
+		else
+			last = mid;
+	}
+	return (int)first - 1;
+}
+
+void MidiParser::restoreJumpCheckpoint(uint index, bool fireEvents) {
+	const JumpCheckpoint &checkpoint = _jumpCheckpoints[index];
+
+	_position = checkpoint.position;
+	for (int i = 0; i < _numSubtracks[_activeTrack]; i++)
+		_nextSubtrackEvents[i] = checkpoint.nextSubtrackEvents[i];
+	_nextEvent = &_nextSubtrackEvents[checkpoint.nextEvent];
+
+	// Without a tempo event up to the checkpoint the tempo stays as it is
+	if (checkpoint.tempoEvent) {
+		_tempoEvent = true;
+		setTempo(checkpoint.tempo);
+		_tempoEvent = false;
+	}
+
+	_jumpEventCount = (index + 1) * kJumpCheckpointSpacing;
+	_jumpTempoEvent = checkpoint.tempoEvent;
+	_jumpChannelsValid = checkpoint.channelsValid;
+	memcpy(_jumpChannels, checkpoint.channels, sizeof(_jumpChannels));
+
+	if (!fireEvents)
+		return;
+
+	// Bring the driver to where the events up to the checkpoint would have
+	if (checkpoint.tempoEvent) {
+		byte tempo[3] = { (byte)(checkpoint.tempo >> 16), (byte)(checkpoint.tempo >> 8), (byte)checkpoint.tempo };
+		sendMetaEventToDriver(0x51, tempo, 3);
+	}
+	for (byte i = 0; i < 16; i++) {
+		const JumpChannelState &channel = checkpoint.channels[i];
+		if (channel.program >= 0) {
+			for (int j = 0; j < 2; j++) {
+				if (channel.programBank[j] != 0xFF)
+					sendToDriver(0xB0 | i, j * 32, channel.programBank[j]);
+			}
+			sendToDriver(0xC0 | i, channel.program, 0);
+		}
+		for (int j = 0; j < 2; j++) {
+			if (channel.bank[j] != 0xFF && (channel.program < 0 || channel.bank[j] != channel.programBank[j]))
+				sendToDriver(0xB0 | i, j * 32, channel.bank[j]);
+		}
+		for (byte j = 1; j < ARRAYSIZE(channel.controllers); j++) {
+			if (channel.controllers[j] != 0xFF)
+				sendToDriver(0xB0 | i, j, channel.controllers[j]);
+		}
+		if (channel.pitchBend >= 0)
+			sendToDriver(0xE0 | i, channel.pitchBend & 0x7F, channel.pitchBend >> 7);
+		if (channel.pressure >= 0)
+			sendToDriver(0xD0 | i, channel.pressure, 0);
+	}
+}
+
 void MidiParser::unloadMusic() {
 	if (_numTracks == 0)
 		// No music data loaded
 		return;
 
 	stopPlaying();
+	if (MidiDriver_Emulated *synth = dynamic_cast<MidiDriver_Emulated *>(_driver))
+		synth->flushRenderCache();
+	clearJumpCheckpoints();
+	_renderCacheHash.clear();
 	_numTracks = 0;
 	_activeTrack = 255;
 	_abortParse = true;
@@ -697,3 +944,48 @@ void MidiParser::unloadMusic() {
 		}
 	}
 }
+
+void MidiParser::setRenderCacheData(const byte *data, uint32 size) {
+	_renderCacheHash.clear();
+	// Some callers do not know the size
+	if (!size || !Audio::MidiRenderCache::isEnabled())
+		return;
+
+	Common::MemoryReadStream stream(data, size);
+	_renderCacheHash = Common::computeStreamMD5AsString(stream);
+}
+
+void MidiParser::startRenderCache() {
+	_renderCacheStart = false;
+	_renderCacheMuted = false;
+	_renderCacheDriver = _renderCacheHash.empty() ? nullptr : dynamic_cast<MidiDriver_Emulated *>(_driver);
+	if (!_renderCacheDriver)
+		return;
+
+	// The timer rate decides when the events of the track are sent
+	const Common::String trackKey = Common::String::format("%s-%d-%u", _renderCacheHash.c_str(), _activeTrack, _timerRate);
+	_renderCacheMuted = _renderCacheDriver->startRenderCache(trackKey);
+}
+
+void MidiParser::finishRenderCache() {
+	if (_renderCacheDriver)
+		_renderCacheDriver->finishRenderCache();
+	_renderCacheDriver = nullptr;
+	_renderCacheMuted = false;
+}
+
+void MidiParser::stopRenderCache(bool resync) {
+	_renderCacheStart = false;
+	if (!_renderCacheDriver)
+		return;
+
+	_renderCacheDriver->stopRenderCache();
+	_renderCacheDriver = nullptr;
+
+	if (_renderCacheMuted) {
+		_renderCacheMuted = false;
+		// Catch up with the controllers, programs and SysEx messages the synth missed
+		if (resync && isPlaying() && !_jumpingToTick)
+			jumpToTick(_position._playTick, true, false, true);
+	}
+}
@@ -25,12 +25,15 @@
 #define AUDIO_MIDIPARSER_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
 #include "common/endian.h"
 #include "common/stream.h"
+#include "common/str.h"
 
 #define AUDIO_MIDIPARSER_MAXIMUM_SUBTRACKS 20
 
 class MidiDriver_BASE;
+class MidiDriver_Emulated;
 
 /**
  * @defgroup audio_midiparser MIDI parser
@@ -391,6 +394,56 @@ protected:
 	bool   _doParse;       ///< True if the parser should be parsing; false if it should not be active
 	bool   _pause;		   ///< True if the parser has paused parsing
 
+	// Render cache of software synths, see Audio::MidiRenderCache
+	Common::String _renderCacheHash;          ///< Hash of the music data, empty if not known
+	MidiDriver_Emulated *_renderCacheDriver;  ///< Driver recording or playing back the active track, if any
+	bool   _renderCacheStart;  ///< Start the render cache with the next timer callback
+	bool   _renderCacheMuted;  ///< The driver plays back the track, events are not sent to it
+	bool   _tempoEvent;        ///< True while processing a tempo event of the track
+
+	/**
+	 * The state of a channel, as set by the events of the active track so far.
+	 * Jumping to a checkpoint sends it to the driver instead of all the
+	 * events up to the checkpoint.
+	 */
+	struct JumpChannelState {
+		int16 program;         ///< -1 if there was no program change
+		byte programBank[2];   ///< Bank select MSB and LSB at the program change, 0xFF if not set
+		byte bank[2];          ///< Bank select MSB and LSB, 0xFF if not set
+		byte controllers[120]; ///< Controller values, 0xFF if not set
+		int16 pitchBend;       ///< -1 if not set
+		int16 pressure;        ///< Channel pressure, -1 if not set
+
+		void clear();
+	};
+
+	/**
+	 * A point of the active track that jumpToTick() can carry on parsing
+	 * from, instead of starting over at the beginning of the track.
+	 */
+	struct JumpCheckpoint {
+		Tracker position;
+		EventInfo nextSubtrackEvents[MAXIMUM_SUBTRACKS];
+		uint8 nextEvent;       ///< The subtrack of the next event
+		uint32 nextEventTick;  ///< The tick of the next event
+		uint32 tempo;
+		bool tempoEvent;       ///< The track changed the tempo before this point
+		bool channelsValid;    ///< Sending channels has the same effect as firing the events so far
+		JumpChannelState channels[16];
+	};
+
+	static const uint32 kJumpCheckpointSpacing = 1024; ///< The number of events between two checkpoints
+
+	bool   _jumpCheckpointsEnabled; ///< Record checkpoints of the active track, see mpJumpCheckpoints
+	Common::Array<JumpCheckpoint> _jumpCheckpoints; ///< The checkpoints of the active track, by tick
+	uint32 _jumpCheckpointsTempo;   ///< The tempo the active track was first jumped through at
+	bool   _jumpStartTempoMatters;  ///< Times of the track depend on the tempo before its first tempo event
+	// The state of the jump in progress, since the beginning of the track
+	uint32 _jumpEventCount;
+	bool   _jumpTempoEvent;
+	bool   _jumpChannelsValid;
+	JumpChannelState _jumpChannels[16];
+
 	/**
 	 * The source number to use when sending MIDI messages to the driver.
 	 * When using multiple sources, use source 0 and higher. This must be
@@ -436,6 +489,32 @@ protected:
 	}
 	virtual void sendMetaEventToDriver(byte type, byte *data, uint16 length);
 
+	/**
+	 * Subclasses call this from loadMusic with the music data, which
+	 * identifies its tracks in the render cache of software synths. Tracks
+	 * of parsers which do not are never cached.
+	 */
+	void setRenderCacheData(const byte *data, uint32 size);
+
+	void clearJumpCheckpoints();
+	/** Update the state of the jump in progress with an event it passes. */
+	void trackJumpEvent(const EventInfo &info, uint32 eventTick);
+	/**
+	 * The last checkpoint before tick which the jump can start from, or -1
+	 * if the jump has to start at the beginning of the track.
+	 */
+	int findJumpCheckpoint(uint32 tick, bool fireEvents, bool stopNotes, bool dontSendNoteOn);
+	void restoreJumpCheckpoint(uint index, bool fireEvents);
+
+	void startRenderCache();
+	void finishRenderCache();
+	/**
+	 * Stop recording or playing back the active track. When playing it
+	 * back and resync is set, the synth is brought up to date with the
+	 * events of the track so far.
+	 */
+	void stopRenderCache(bool resync);
+
 	/**
 	 * Platform independent BE uint32 read-and-advance.
 	 * This helper function reads Big Endian 32-bit numbers
@@ -506,7 +585,16 @@ public:
 		  * or setting the track. Use startPlaying to start playback.
 		  * Note that not every parser implementation might support this.
 		  */
-		 mpDisableAutoStartPlayback = 7
+		 mpDisableAutoStartPlayback = 7,
+
+		 /**
+		  * Keep checkpoints of the parse state while jumping through the
+		  * active track, so that later jumps carry on from the closest one
+		  * instead of parsing the track from its beginning.
+		  * Only parsers which keep all their parse state in the Tracker and
+		  * the pre-parsed events can support this. MidiParser_SMF sets it.
+		  */
+		 mpJumpCheckpoints = 8
 	};
 
 public:
@@ -527,7 +615,11 @@ public:
 	virtual int32 determineDataSize(Common::SeekableReadStream *stream) { return -1; };
 
 	virtual void setMidiDriver(MidiDriver_BASE *driver) { _driver = driver; }
-	void setTimerRate(uint32 rate) { _timerRate = rate; }
+	void setTimerRate(uint32 rate) {
+		if (rate != _timerRate)
+			stopRenderCache(true);
+		_timerRate = rate;
+	}
 	virtual void setTempo(uint32 tempo);
 	virtual void onTimer();
 
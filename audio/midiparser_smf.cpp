@@ -27,6 +27,9 @@
 #include "common/util.h"
 
 MidiParser_SMF::MidiParser_SMF(int8 source) : MidiParser(source) {
+	// All of the parsing state is in the tracker
+	_jumpCheckpointsEnabled = true;
+
 	for (int i = 0; i < ARRAYSIZE(_noteChannelToTrack); i++)
 		_noteChannelToTrack[i] = -1;
 }
@@ -125,6 +128,7 @@ bool MidiParser_SMF::loadMusic(byte *data, uint32 size) {
 	byte numTrackChunks;
 
 	unloadMusic();
+	setRenderCacheData(data, size);
 	byte *pos = data;
 
 	if (!memcmp(pos, "RIFF", 4)) {
@@ -339,6 +339,7 @@ bool MidiParser_XMIDI::loadMusic(byte *data, uint32 size) {
 	_loopCount = -1;
 
 	unloadMusic();
+	setRenderCacheData(data, size);
 	byte *pos = data;
 
 	if (!memcmp(pos, "FORM", 4)) {
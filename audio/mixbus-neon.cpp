@@ -0,0 +1,130 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "audio/mixbus.h"
+#include "audio/mixer.h"
+#include "common/util.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Audio {
+
+/**
+ * Divide products by kMaxMixerVolume, rounding towards zero like the
+ * scalar code.
+ */
+static FORCEINLINE int32x4_t scaleVolume(int32x4_t p) {
+	const uint32x4_t bias = vshrq_n_u32(vreinterpretq_u32_s32(vshrq_n_s32(p, 31)), 24);
+	return vshrq_n_s32(vaddq_s32(p, vreinterpretq_s32_u32(bias)), 8);
+}
+
+static FORCEINLINE void accumulate8(int32 *dst, int16x8_t samples, int16x8_t volumes) {
+	const int32x4_t p0 = scaleVolume(vmull_s16(vget_low_s16(samples), vget_low_s16(volumes)));
+	const int32x4_t p1 = scaleVolume(vmull_s16(vget_high_s16(samples), vget_high_s16(volumes)));
+
+	vst1q_s32(dst, vaddq_s32(vld1q_s32(dst), p0));
+	vst1q_s32(dst + 4, vaddq_s32(vld1q_s32(dst + 4), p1));
+}
+
+void mixBusAccumulateNEON(int32 *dst, const st_sample_t *src, uint frames, bool srcStereo, st_volume_t volL, st_volume_t volR) {
+	static_assert(Audio::Mixer::kMaxMixerVolume == 256, "The kernel divides by shifting");
+
+	// Volumes interleaved like the output: L R L R ...
+	const int16x8_t volumes = vreinterpretq_s16_u32(vdupq_n_u32(volL | ((uint32)volR << 16)));
+	uint i = 0;
+
+	if (srcStereo) {
+		for (; i + 4 <= frames; i += 4) {
+			accumulate8(dst, vld1q_s16(src), volumes);
+			src += 8;
+			dst += 8;
+		}
+	} else {
+		for (; i + 8 <= frames; i += 8) {
+			const int16x8_t samples = vld1q_s16(src);
+			// Duplicate each sample into both channels
+			const int16x8x2_t both = vzipq_s16(samples, samples);
+			accumulate8(dst, both.val[0], volumes);
+			accumulate8(dst + 8, both.val[1], volumes);
+			src += 8;
+			dst += 16;
+		}
+	}
+
+	for (; i < frames; ++i) {
+		const int inL = *src++;
+		const int inR = srcStereo ? *src++ : inL;
+
+		*dst++ += (st_sample_t)((inL * (int)volL) / Audio::Mixer::kMaxMixerVolume);
+		*dst++ += (st_sample_t)((inR * (int)volR) / Audio::Mixer::kMaxMixerVolume);
+	}
+}
+
+void mixBusClampNEON(st_sample_t *dst, const int32 *src, uint count) {
+	uint i = 0;
+
+	for (; i + 8 <= count; i += 8) {
+		int16x8_t packed = vcombine_s16(vqmovn_s32(vld1q_s32(src + i)), vqmovn_s32(vld1q_s32(src + i + 4)));
+#ifdef OUTPUT_UNSIGNED_AUDIO
+		packed = veorq_s16(packed, vdupq_n_s16((int16)0x8000));
+#endif
+		vst1q_s16(dst + i, packed);
+	}
+
+	for (; i < count; ++i) {
+		int32 val = CLIP<int32>(src[i], ST_SAMPLE_MIN, ST_SAMPLE_MAX);
+#ifdef OUTPUT_UNSIGNED_AUDIO
+		dst[i] = ((int16)val) ^ 0x8000;
+#else
+		dst[i] = val;
+#endif
+	}
+}
+
+} // End of namespace Audio
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,131 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "audio/mixbus.h"
+#include "audio/mixer.h"
+#include "common/util.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Audio {
+
+/**
+ * Multiply 8 samples by their volumes, divide by kMaxMixerVolume rounding
+ * towards zero like the scalar code, and add the result to dst.
+ */
+static FORCEINLINE void accumulate8(int32 *dst, __m128i samples, __m128i volumes) {
+	const __m128i lo = _mm_mullo_epi16(samples, volumes);
+	const __m128i hi = _mm_mulhi_epi16(samples, volumes);
+
+	__m128i p0 = _mm_unpacklo_epi16(lo, hi);
+	__m128i p1 = _mm_unpackhi_epi16(lo, hi);
+
+	// Add 255 to negative products so that the shift truncates
+	p0 = _mm_srai_epi32(_mm_add_epi32(p0, _mm_srli_epi32(_mm_srai_epi32(p0, 31), 24)), 8);
+	p1 = _mm_srai_epi32(_mm_add_epi32(p1, _mm_srli_epi32(_mm_srai_epi32(p1, 31), 24)), 8);
+
+	_mm_storeu_si128((__m128i *)dst, _mm_add_epi32(_mm_loadu_si128((const __m128i *)dst), p0));
+	_mm_storeu_si128((__m128i *)(dst + 4), _mm_add_epi32(_mm_loadu_si128((const __m128i *)(dst + 4)), p1));
+}
+
+void mixBusAccumulateSSE2(int32 *dst, const st_sample_t *src, uint frames, bool srcStereo, st_volume_t volL, st_volume_t volR) {
+	static_assert(Audio::Mixer::kMaxMixerVolume == 256, "The kernel divides by shifting");
+
+	// Volumes interleaved like the output: L R L R ...
+	const __m128i volumes = _mm_set1_epi32((int)(volL | ((uint32)volR << 16)));
+	uint i = 0;
+
+	if (srcStereo) {
+		for (; i + 4 <= frames; i += 4) {
+			const __m128i samples = _mm_loadu_si128((const __m128i *)src);
+			accumulate8(dst, samples, volumes);
+			src += 8;
+			dst += 8;
+		}
+	} else {
+		for (; i + 8 <= frames; i += 8) {
+			const __m128i samples = _mm_loadu_si128((const __m128i *)src);
+			// Duplicate each sample into both channels
+			accumulate8(dst, _mm_unpacklo_epi16(samples, samples), volumes);
+			accumulate8(dst + 8, _mm_unpackhi_epi16(samples, samples), volumes);
+			src += 8;
+			dst += 16;
+		}
+	}
+
+	for (; i < frames; ++i) {
+		const int inL = *src++;
+		const int inR = srcStereo ? *src++ : inL;
+
+		*dst++ += (st_sample_t)((inL * (int)volL) / Audio::Mixer::kMaxMixerVolume);
+		*dst++ += (st_sample_t)((inR * (int)volR) / Audio::Mixer::kMaxMixerVolume);
+	}
+}
+
+void mixBusClampSSE2(st_sample_t *dst, const int32 *src, uint count) {
+#ifdef OUTPUT_UNSIGNED_AUDIO
+	const __m128i sign = _mm_set1_epi16((int16)0x8000);
+#endif
+	uint i = 0;
+
+	for (; i + 8 <= count; i += 8) {
+		const __m128i a = _mm_loadu_si128((const __m128i *)(src + i));
+		const __m128i b = _mm_loadu_si128((const __m128i *)(src + i + 4));
+		__m128i packed = _mm_packs_epi32(a, b);
+#ifdef OUTPUT_UNSIGNED_AUDIO
+		packed = _mm_xor_si128(packed, sign);
+#endif
+		_mm_storeu_si128((__m128i *)(dst + i), packed);
+	}
+
+	for (; i < count; ++i) {
+		int32 val = CLIP<int32>(src[i], ST_SAMPLE_MIN, ST_SAMPLE_MAX);
+#ifdef OUTPUT_UNSIGNED_AUDIO
+		dst[i] = ((int16)val) ^ 0x8000;
+#else
+		dst[i] = val;
+#endif
+	}
+}
+
+} // End of namespace Audio
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
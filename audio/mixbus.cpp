@@ -0,0 +1,118 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "audio/mixbus.h"
+#include "audio/mixer.h"
+#include "common/system.h"
+
+namespace Audio {
+
+#ifdef SCUMMVM_SSE2
+// Defined in mixbus-sse2.cpp
+void mixBusAccumulateSSE2(int32 *dst, const st_sample_t *src, uint frames, bool srcStereo, st_volume_t volL, st_volume_t volR);
+void mixBusClampSSE2(st_sample_t *dst, const int32 *src, uint count);
+#endif
+
+#ifdef SCUMMVM_NEON
+// Defined in mixbus-neon.cpp
+void mixBusAccumulateNEON(int32 *dst, const st_sample_t *src, uint frames, bool srcStereo, st_volume_t volL, st_volume_t volR);
+void mixBusClampNEON(st_sample_t *dst, const int32 *src, uint count);
+#endif
+
+namespace {
+
+typedef void (*AccumulateFunc)(int32 *dst, const st_sample_t *src, uint frames, bool srcStereo, st_volume_t volL, st_volume_t volR);
+typedef void (*ClampFunc)(st_sample_t *dst, const int32 *src, uint count);
+
+void mixBusAccumulateGeneric(int32 *dst, const st_sample_t *src, uint frames, bool srcStereo, st_volume_t volL, st_volume_t volR) {
+	for (uint i = 0; i < frames; ++i) {
+		const int inL = *src++;
+		const int inR = srcStereo ? *src++ : inL;
+
+		*dst++ += (st_sample_t)((inL * (int)volL) / Audio::Mixer::kMaxMixerVolume);
+		*dst++ += (st_sample_t)((inR * (int)volR) / Audio::Mixer::kMaxMixerVolume);
+	}
+}
+
+void mixBusClampGeneric(st_sample_t *dst, const int32 *src, uint count) {
+	for (uint i = 0; i < count; ++i) {
+		int32 val = CLIP<int32>(src[i], ST_SAMPLE_MIN, ST_SAMPLE_MAX);
+#ifdef OUTPUT_UNSIGNED_AUDIO
+		dst[i] = ((int16)val) ^ 0x8000;
+#else
+		dst[i] = val;
+#endif
+	}
+}
+
+AccumulateFunc accumulateFunc = mixBusAccumulateGeneric;
+ClampFunc clampFunc = mixBusClampGeneric;
+bool kernelsSelected = false;
+
+/**
+ * Pick the kernels for the CPU, the same way BlendBlit picks its blitters.
+ * SSE2 and NEON are part of the x86-64 and AArch64 baselines, elsewhere
+ * the backend has to be asked, once it is up.
+ */
+void selectKernels() {
+	if (kernelsSelected)
+		return;
+
+#if defined(SCUMMVM_SSE2) && (defined(__x86_64__) || defined(_M_X64))
+	accumulateFunc = mixBusAccumulateSSE2;
+	clampFunc = mixBusClampSSE2;
+#elif defined(SCUMMVM_NEON) && defined(__aarch64__)
+	accumulateFunc = mixBusAccumulateNEON;
+	clampFunc = mixBusClampNEON;
+#else
+	if (!g_system)
+		return;
+
+#ifdef SCUMMVM_NEON
+	if (g_system->hasFeature(OSystem::kFeatureCpuNEON)) {
+		accumulateFunc = mixBusAccumulateNEON;
+		clampFunc = mixBusClampNEON;
+	}
+#endif
+#ifdef SCUMMVM_SSE2
+	if (g_system->hasFeature(OSystem::kFeatureCpuSSE2)) {
+		accumulateFunc = mixBusAccumulateSSE2;
+		clampFunc = mixBusClampSSE2;
+	}
+#endif
+#endif
+	kernelsSelected = true;
+}
+
+} // End of anonymous namespace
+
+void mixBusAccumulate(int32 *dst, const st_sample_t *src, uint frames, bool srcStereo, st_volume_t volL, st_volume_t volR) {
+	selectKernels();
+	accumulateFunc(dst, src, frames, srcStereo, volL, volR);
+}
+
+void mixBusClamp(st_sample_t *dst, const int32 *src, uint count) {
+	selectKernels();
+	clampFunc(dst, src, count);
+}
+
+} // End of namespace Audio
@@ -0,0 +1,57 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef AUDIO_MIXBUS_H
+#define AUDIO_MIXBUS_H
+
+#include "audio/rate.h"
+
+namespace Audio {
+
+/**
+ * @defgroup audio_mixbus Mix bus
+ * @ingroup audio
+ *
+ * @brief Kernels for mixing into a 32-bit accumulation buffer.
+ *
+ * Mixing into 32-bit samples needs no clamping per channel: the sum is
+ * clamped once, when the whole buffer has been mixed.
+ * @{
+ */
+
+/**
+ * Mix frames of 16-bit samples into a stereo 32-bit mix bus, scaling the
+ * left and right channel by the given volumes. Mono input is mixed into
+ * both channels.
+ *
+ * The result is the same as the per-sample mixing done by RateConverter,
+ * minus the clamping.
+ */
+void mixBusAccumulate(int32 *dst, const st_sample_t *src, uint frames, bool srcStereo, st_volume_t volL, st_volume_t volR);
+
+/** Clamp count samples of a 32-bit mix bus to 16-bit output samples. */
+void mixBusClamp(st_sample_t *dst, const int32 *src, uint count);
+
+/** @} */
+} // End of namespace Audio
+
+#endif
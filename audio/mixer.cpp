@@ -21,10 +21,13 @@
 
 #include "gui/EventRecorder.h"
 
+#include "common/cyclecounter.h"
+#include "common/profiler.h"
 #include "common/util.h"
 #include "common/textconsole.h"
 
 #include "audio/mixer_intern.h"
+#include "audio/mixbus.h"
 #include "audio/rate.h"
 #include "audio/audiostream.h"
 #include "audio/timestamp.h"
@@ -37,24 +40,52 @@ namespace Audio {
 #pragma mark -
 
 
+/**
+ * Passes a stream through while counting the time spent reading it, to
+ * tell decoding apart from resampling in the mixer stats.
+ */
+class TimedAudioStream : public AudioStream {
+public:
+	TimedAudioStream(AudioStream &stream, uint64 &ticks) : _stream(stream), _ticks(ticks) {}
+
+	int readBuffer(int16 *buffer, const int numSamples) override {
+		const uint64 start = Common::getCycleCount();
+		const int samples = _stream.readBuffer(buffer, numSamples);
+		_ticks += Common::getCycleCount() - start;
+		return samples;
+	}
+
+	bool isStereo() const override { return _stream.isStereo(); }
+	int getRate() const override { return _stream.getRate(); }
+	bool endOfData() const override { return _stream.endOfData(); }
+	bool endOfStream() const override { return _stream.endOfStream(); }
+
+private:
+	AudioStream &_stream;
+	uint64 &_ticks;
+};
+
 /**
  * Channel used by the default Mixer implementation.
  */
 class Channel {
 public:
-	Channel(Mixer *mixer, Mixer::SoundType type, AudioStream *stream, DisposeAfterUse::Flag autofreeStream, bool reverseStereo, int id, bool permanent);
+	Channel(Mixer *mixer, Mixer::SoundType type, AudioStream *stream, DisposeAfterUse::Flag autofreeStream, bool reverseStereo, int id, bool permanent, ResamplerType resampler);
 	~Channel();
 
 	/**
 	 * Mixes the channel's samples into the given buffer.
 	 *
-	 * @param data buffer where to mix the data
+	 * @param data buffer where to mix the data, either 16-bit output
+	 *             samples or a 32-bit mix bus which is not clamped
 	 * @param len  number of sample *pairs*. So a value of
 	 *             10 means that the buffer contains twice 10 sample, each
 	 *             16 bits, for a total of 40 bytes.
+	 * @param timed whether to count the time spent for the stats
 	 * @return number of sample pairs processed (which can still be silence!)
 	 */
-	int mix(int16 *data, uint len);
+	template<class T>
+	int mix(T *data, uint len, bool timed);
 
 	/**
 	 * Queries whether the channel is still playing or not.
@@ -167,6 +198,17 @@ public:
 	 */
 	SoundHandle getHandle() const { return _handle; }
 
+	/**
+	 * Fills in the time spent by the channel since the mixer started
+	 * measuring it.
+	 */
+	void getStats(MixerImpl::ChannelStats &stats);
+
+	/**
+	 * Forgets the time spent so far.
+	 */
+	void resetStats();
+
 private:
 	const Mixer::SoundType _type;
 	SoundHandle _handle;
@@ -188,6 +230,10 @@ private:
 	uint32 _pauseStartTime;
 	uint32 _pauseTime;
 
+	uint64 _decodeTicks;
+	uint64 _convertTicks;
+	uint64 _samplesMixed;
+
 	RateConverter *_converter;
 	Common::DisposablePtr<AudioStream> _stream;
 };
@@ -197,12 +243,14 @@ private:
 #pragma mark -
 
 MixerImpl::MixerImpl(uint sampleRate, bool stereo, uint outBufSize)
-	: _mutex(), _sampleRate(sampleRate), _stereo(stereo), _outBufSize(outBufSize), _mixerReady(false), _handleSeed(0), _soundTypeSettings() {
+	: _mutex(), _sampleRate(sampleRate), _stereo(stereo), _outBufSize(outBufSize), _mixerReady(false), _handleSeed(0), _soundTypeSettings(), _wideMixBus(false), _underrunCount(0), _statsEnabled(false) {
 
 	assert(sampleRate > 0);
 
 	for (int i = 0; i != NUM_CHANNELS; i++)
 		_channels[i] = nullptr;
+
+	resetStats();
 }
 
 MixerImpl::~MixerImpl() {
@@ -212,6 +260,7 @@ MixerImpl::~MixerImpl() {
 
 void MixerImpl::setReady(bool ready) {
 	Common::StackLock lock(_mutex);
+	processCommands();
 
 	_mixerReady = ready;
 }
@@ -228,6 +277,20 @@ uint MixerImpl::getOutputBufSize() const {
 	return _outBufSize;
 }
 
+uint32 MixerImpl::getOutputLatency() const {
+	// A buffer is mixed in one go before the device starts playing it
+	return (uint64)_outBufSize * 1000 / _sampleRate;
+}
+
+void MixerImpl::setOutputBufSize(uint outBufSize) {
+	Common::StackLock lock(_mutex);
+	processCommands();
+	_outBufSize = outBufSize;
+
+	if (_wideMixBus && _outBufSize)
+		_mixBus.reserve(_outBufSize * (_stereo ? 2 : 1));
+}
+
 void MixerImpl::insertChannel(SoundHandle *handle, Channel *chan) {
 	int index = -1;
 	for (int i = 0; i != NUM_CHANNELS; i++) {
@@ -262,6 +325,7 @@ void MixerImpl::playStream(
 			bool permanent,
 			bool reverseStereo) {
 	Common::StackLock lock(_mutex);
+	processCommands();
 
 	if (stream == nullptr) {
 		warning("stream is 0");
@@ -292,25 +356,26 @@ void MixerImpl::playStream(
 #endif
 
 	// Create the channel
-	Channel *chan = new Channel(this, type, stream, autofreeStream, reverseStereo, id, permanent);
+	Channel *chan = new Channel(this, type, stream, autofreeStream, reverseStereo, id, permanent, getConfiguredResampler());
 	chan->setVolume(volume);
 	chan->setBalance(balance);
 	insertChannel(handle, chan);
 }
 
 int MixerImpl::mixCallback(byte *samples, uint len) {
+	PROFILE_ZONE("MixerImpl::mixCallback");
 	assert(samples);
 
+	const uint32 start = g_system->getMillis(true);
+	const uint64 startTicks = Common::getCycleCount();
 	Common::StackLock lock(_mutex);
+	processCommands();
 
 	int16 *buf = (int16 *)samples;
 
 	// Since the mixer callback has been called, the mixer must be ready...
 	_mixerReady = true;
 
-	//  zero the buf
-	memset(buf, 0, len);
-
 	// we store 16-bit samples
 	if (_stereo) {
 		assert(len % 4 == 0);
@@ -320,6 +385,37 @@ int MixerImpl::mixCallback(byte *samples, uint len) {
 		len >>= 1;
 	}
 
+	int res;
+	if (!_wideMixBus) {
+		//  zero the buf
+		memset(buf, 0, len * (_stereo ? 4 : 2));
+		res = mixChannels(buf, len);
+	} else {
+		const uint count = len * (_stereo ? 2 : 1);
+		if (_mixBus.size() < count)
+			_mixBus.resize(count);
+
+		int32 *bus = _mixBus.data();
+		memset(bus, 0, count * sizeof(int32));
+
+		res = mixChannels(bus, len);
+		mixBusClamp(buf, bus, count);
+	}
+
+	// Waiting for the mutex and mixing took longer than the buffer plays:
+	// the output most likely ran dry in the meantime.
+	const bool missedDeadline = g_system->getMillis(true) - start > len * 1000 / _sampleRate;
+	if (missedDeadline)
+		_underrunCount.fetch_add(1, std::memory_order_relaxed);
+
+	if (_statsEnabled)
+		countCallback(Common::getCycleCount() - startTicks, len, missedDeadline);
+
+	return res;
+}
+
+template<class T>
+int MixerImpl::mixChannels(T *buf, uint len) {
 	// mix all channels
 	int res = 0, tmp;
 	for (int i = 0; i != NUM_CHANNELS; i++)
@@ -328,7 +424,7 @@ int MixerImpl::mixCallback(byte *samples, uint len) {
 				delete _channels[i];
 				_channels[i] = nullptr;
 			} else if (!_channels[i]->isPaused()) {
-				tmp = _channels[i]->mix(buf, len);
+				tmp = _channels[i]->mix(buf, len, _statsEnabled);
 
 				if (tmp > res)
 					res = tmp;
@@ -338,8 +434,87 @@ int MixerImpl::mixCallback(byte *samples, uint len) {
 	return res;
 }
 
+void MixerImpl::setWideMixBus(bool enable) {
+	Common::StackLock lock(_mutex);
+	processCommands();
+	_wideMixBus = enable;
+
+	if (enable && _outBufSize)
+		_mixBus.reserve(_outBufSize * (_stereo ? 2 : 1));
+	else if (!enable)
+		_mixBus.clear();
+}
+
+void MixerImpl::enableStats(bool enable) {
+	Common::StackLock lock(_mutex);
+	processCommands();
+
+	if (enable)
+		resetStats();
+	_statsEnabled = enable;
+}
+
+bool MixerImpl::isStatsEnabled() const {
+	Common::StackLock lock(_mutex);
+	return _statsEnabled;
+}
+
+void MixerImpl::getStats(Stats &stats) const {
+	Common::StackLock lock(_mutex);
+
+	stats.elapsedTicks = Common::getCycleCount() - _statsStartTicks;
+	stats.elapsedMillis = g_system->getMillis(true) - _statsStartMillis;
+	stats.callbacks = _statsCallbacks;
+	stats.missedDeadlines = _statsMissedDeadlines;
+	stats.callbackTicks = _statsCallbackTicks;
+	stats.maxCallbackTicks = _statsMaxCallbackTicks;
+	stats.samples = _statsSamples;
+	memcpy(stats.histogram, _statsHistogram, sizeof(stats.histogram));
+
+	stats.channels.clear();
+	for (int i = 0; i != NUM_CHANNELS; i++) {
+		if (_channels[i]) {
+			ChannelStats channel;
+			_channels[i]->getStats(channel);
+			channel.slot = i;
+			stats.channels.push_back(channel);
+		}
+	}
+}
+
+void MixerImpl::resetStats() {
+	_statsStartTicks = Common::getCycleCount();
+	_statsStartMillis = g_system->getMillis(true);
+	_statsCallbacks = 0;
+	_statsMissedDeadlines = 0;
+	_statsCallbackTicks = 0;
+	_statsMaxCallbackTicks = 0;
+	_statsSamples = 0;
+	memset(_statsHistogram, 0, sizeof(_statsHistogram));
+
+	for (int i = 0; i != NUM_CHANNELS; i++) {
+		if (_channels[i])
+			_channels[i]->resetStats();
+	}
+}
+
+void MixerImpl::countCallback(uint64 ticks, uint len, bool missedDeadline) {
+	_statsCallbacks++;
+	if (missedDeadline)
+		_statsMissedDeadlines++;
+	_statsCallbackTicks += ticks;
+	_statsMaxCallbackTicks = MAX(_statsMaxCallbackTicks, ticks);
+	_statsSamples += len;
+
+	uint bucket = 0;
+	while ((ticks >>= 1) && bucket < kStatsHistogramSize - 1)
+		bucket++;
+	_statsHistogram[bucket]++;
+}
+
 void MixerImpl::stopAll() {
 	Common::StackLock lock(_mutex);
+	processCommands();
 	for (int i = 0; i != NUM_CHANNELS; i++) {
 		if (_channels[i] != nullptr && !_channels[i]->isPermanent()) {
 			delete _channels[i];
@@ -350,6 +525,7 @@ void MixerImpl::stopAll() {
 
 void MixerImpl::stopID(int id) {
 	Common::StackLock lock(_mutex);
+	processCommands();
 	for (int i = 0; i != NUM_CHANNELS; i++) {
 		if (_channels[i] != nullptr && _channels[i]->getId() == id) {
 			delete _channels[i];
@@ -360,6 +536,7 @@ void MixerImpl::stopID(int id) {
 
 void MixerImpl::stopHandle(SoundHandle handle) {
 	Common::StackLock lock(_mutex);
+	processCommands();
 
 	// Simply ignore stop requests for handles of sounds that already terminated
 	const int index = handle._val % NUM_CHANNELS;
@@ -386,16 +563,14 @@ bool MixerImpl::isSoundTypeMuted(SoundType type) const {
 }
 
 void MixerImpl::setChannelVolume(SoundHandle handle, byte volume) {
-	Common::StackLock lock(_mutex);
-
-	const int index = handle._val % NUM_CHANNELS;
-	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
-		return;
-
-	_channels[index]->setVolume(volume);
+	Command cmd = { Command::kSetVolume, handle._val, 0, volume };
+	postCommand(cmd);
 }
 
 byte MixerImpl::getChannelVolume(SoundHandle handle) {
+	Common::StackLock lock(_mutex);
+	processCommands();
+
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
 		return 0;
@@ -404,16 +579,14 @@ byte MixerImpl::getChannelVolume(SoundHandle handle) {
 }
 
 void MixerImpl::setChannelBalance(SoundHandle handle, int8 balance) {
-	Common::StackLock lock(_mutex);
-
-	const int index = handle._val % NUM_CHANNELS;
-	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
-		return;
-
-	_channels[index]->setBalance(balance);
+	Command cmd = { Command::kSetBalance, handle._val, 0, balance };
+	postCommand(cmd);
 }
 
 int8 MixerImpl::getChannelBalance(SoundHandle handle) {
+	Common::StackLock lock(_mutex);
+	processCommands();
+
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
 		return 0;
@@ -423,6 +596,7 @@ int8 MixerImpl::getChannelBalance(SoundHandle handle) {
 
 void MixerImpl::setChannelRate(SoundHandle handle, uint32 rate) {
 	Common::StackLock lock(_mutex);
+	processCommands();
 
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
@@ -441,6 +615,7 @@ uint32 MixerImpl::getChannelRate(SoundHandle handle) {
 
 void MixerImpl::resetChannelRate(SoundHandle handle) {
 	Common::StackLock lock(_mutex);
+	processCommands();
 
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
@@ -455,6 +630,7 @@ uint32 MixerImpl::getSoundElapsedTime(SoundHandle handle) {
 
 Timestamp MixerImpl::getElapsedTime(SoundHandle handle) {
 	Common::StackLock lock(_mutex);
+	processCommands();
 
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
@@ -465,6 +641,7 @@ Timestamp MixerImpl::getElapsedTime(SoundHandle handle) {
 
 void MixerImpl::loopChannel(SoundHandle handle) {
 	Common::StackLock lock(_mutex);
+	processCommands();
 
 	const int index = handle._val % NUM_CHANNELS;
 	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
@@ -474,37 +651,79 @@ void MixerImpl::loopChannel(SoundHandle handle) {
 }
 
 void MixerImpl::pauseAll(bool paused) {
-	Common::StackLock lock(_mutex);
-	for (int i = 0; i != NUM_CHANNELS; i++) {
-		if (_channels[i] != nullptr) {
-			_channels[i]->pause(paused);
-		}
-	}
+	Command cmd = { Command::kPauseAll, 0, 0, paused };
+	postCommand(cmd);
 }
 
 void MixerImpl::pauseID(int id, bool paused) {
-	Common::StackLock lock(_mutex);
-	for (int i = 0; i != NUM_CHANNELS; i++) {
-		if (_channels[i] != nullptr && _channels[i]->getId() == id) {
-			_channels[i]->pause(paused);
-			return;
-		}
-	}
+	Command cmd = { Command::kPauseID, 0, id, paused };
+	postCommand(cmd);
 }
 
 void MixerImpl::pauseHandle(SoundHandle handle, bool paused) {
+	Command cmd = { Command::kPauseHandle, handle._val, 0, paused };
+	postCommand(cmd);
+}
+
+void MixerImpl::postCommand(const Command &cmd) {
+	if (_commands.push(cmd))
+		return;
+
+	// The queue is full: apply everything right away
 	Common::StackLock lock(_mutex);
+	processCommands();
+	applyCommand(cmd);
+}
 
-	// Simply ignore (un)pause requests for sounds that already terminated
-	const int index = handle._val % NUM_CHANNELS;
-	if (!_channels[index] || _channels[index]->getHandle()._val != handle._val)
+void MixerImpl::processCommands() {
+	Command cmd;
+	while (_commands.pop(cmd))
+		applyCommand(cmd);
+}
+
+void MixerImpl::applyCommand(const Command &cmd) {
+	if (cmd.type == Command::kPauseAll) {
+		for (int i = 0; i != NUM_CHANNELS; i++) {
+			if (_channels[i] != nullptr) {
+				_channels[i]->pause(cmd.value);
+			}
+		}
 		return;
+	}
 
-	_channels[index]->pause(paused);
+	if (cmd.type == Command::kPauseID) {
+		for (int i = 0; i != NUM_CHANNELS; i++) {
+			if (_channels[i] != nullptr && _channels[i]->getId() == cmd.id) {
+				_channels[i]->pause(cmd.value);
+				return;
+			}
+		}
+		return;
+	}
+
+	// Simply ignore requests for handles of sounds that already terminated
+	const int index = cmd.handle % NUM_CHANNELS;
+	if (!_channels[index] || _channels[index]->getHandle()._val != cmd.handle)
+		return;
+
+	switch (cmd.type) {
+	case Command::kSetVolume:
+		_channels[index]->setVolume(cmd.value);
+		break;
+	case Command::kSetBalance:
+		_channels[index]->setBalance(cmd.value);
+		break;
+	case Command::kPauseHandle:
+		_channels[index]->pause(cmd.value);
+		break;
+	default:
+		break;
+	}
 }
 
 bool MixerImpl::isSoundIDActive(int id) {
 	Common::StackLock lock(_mutex);
+	processCommands();
 
 #ifdef ENABLE_EVENTRECORDER
 	g_eventRec.updateSubsystems();
@@ -518,6 +737,7 @@ bool MixerImpl::isSoundIDActive(int id) {
 
 int MixerImpl::getSoundID(SoundHandle handle) {
 	Common::StackLock lock(_mutex);
+	processCommands();
 	const int index = handle._val % NUM_CHANNELS;
 	if (_channels[index] && _channels[index]->getHandle()._val == handle._val)
 		return _channels[index]->getId();
@@ -526,6 +746,7 @@ int MixerImpl::getSoundID(SoundHandle handle) {
 
 bool MixerImpl::isSoundHandleActive(SoundHandle handle) {
 	Common::StackLock lock(_mutex);
+	processCommands();
 
 #ifdef ENABLE_EVENTRECORDER
 	g_eventRec.updateSubsystems();
@@ -537,6 +758,7 @@ bool MixerImpl::isSoundHandleActive(SoundHandle handle) {
 
 bool MixerImpl::hasActiveChannelOfType(SoundType type) {
 	Common::StackLock lock(_mutex);
+	processCommands();
 	for (int i = 0; i != NUM_CHANNELS; i++)
 		if (_channels[i] && _channels[i]->getType() == type)
 			return true;
@@ -553,6 +775,7 @@ void MixerImpl::setVolumeForSoundType(SoundType type, int volume) {
 	// scaling? See also Player_V2::setMasterVolume
 
 	Common::StackLock lock(_mutex);
+	processCommands();
 	_soundTypeSettings[type].volume = volume;
 
 	for (int i = 0; i != NUM_CHANNELS; ++i) {
@@ -573,16 +796,24 @@ int MixerImpl::getVolumeForSoundType(SoundType type) const {
 #pragma mark -
 
 Channel::Channel(Mixer *mixer, Mixer::SoundType type, AudioStream *stream,
-				 DisposeAfterUse::Flag autofreeStream, bool reverseStereo, int id, bool permanent)
+				 DisposeAfterUse::Flag autofreeStream, bool reverseStereo, int id, bool permanent, ResamplerType resampler)
 	: _type(type), _mixer(mixer), _id(id), _permanent(permanent), _volume(Mixer::kMaxChannelVolume),
 	  _balance(0), _pauseLevel(0), _samplesConsumed(0), _samplesDecoded(0), _mixerTimeStamp(0),
-	  _pauseStartTime(0), _pauseTime(0), _converter(nullptr), _volL(0), _volR(0),
+	  _pauseStartTime(0), _pauseTime(0), _decodeTicks(0), _convertTicks(0), _samplesMixed(0),
+	  _converter(nullptr), _volL(0), _volR(0),
 	  _stream(stream, autofreeStream) {
 	assert(mixer);
 	assert(stream);
 
+	// Streams already at the output rate, such as the ones which mix and
+	// resample their own channels, are only copied: running them through the
+	// sinc filter would just delay them. Should the rate be changed later,
+	// they get linear interpolation.
+	if ((uint)_stream->getRate() == mixer->getOutputRate())
+		resampler = kResamplerLinear;
+
 	// Get a rate converter instance
-	_converter = makeRateConverter(_stream->getRate(), mixer->getOutputRate(), _stream->isStereo(), mixer->getOutputStereo(), reverseStereo);
+	_converter = makeRateConverter(_stream->getRate(), mixer->getOutputRate(), _stream->isStereo(), mixer->getOutputStereo(), reverseStereo, resampler);
 }
 
 Channel::~Channel() {
@@ -707,7 +938,23 @@ void Channel::loop() {
 	}
 }
 
-int Channel::mix(int16 *data, uint len) {
+void Channel::getStats(MixerImpl::ChannelStats &stats) {
+	stats.id = _id;
+	stats.type = _type;
+	stats.rate = getRate();
+	stats.decodeTicks = _decodeTicks;
+	stats.resampleTicks = _convertTicks - _decodeTicks;
+	stats.samples = _samplesMixed;
+}
+
+void Channel::resetStats() {
+	_decodeTicks = 0;
+	_convertTicks = 0;
+	_samplesMixed = 0;
+}
+
+template<class T>
+int Channel::mix(T *data, uint len, bool timed) {
 	assert(_stream);
 	assert(_converter);
 
@@ -716,7 +963,15 @@ int Channel::mix(int16 *data, uint len) {
 		_samplesConsumed = _samplesDecoded;
 		_mixerTimeStamp = g_system->getMillis(true);
 		_pauseTime = 0;
-		res = _converter->convert(*_stream, data, len, _volL, _volR);
+		if (!timed) {
+			res = _converter->convert(*_stream, data, len, _volL, _volR);
+		} else {
+			TimedAudioStream timedStream(*_stream, _decodeTicks);
+			const uint64 start = Common::getCycleCount();
+			res = _converter->convert(timedStream, data, len, _volL, _volR);
+			_convertTicks += Common::getCycleCount() - start;
+			_samplesMixed += res;
+		}
 		_samplesDecoded += res;
 	}
 
@@ -345,6 +345,17 @@ public:
 	 * @return The number of samples processed at each audio callback.
 	 */
 	virtual uint getOutputBufSize() const = 0;
+
+	/**
+	 * Return how long mixed samples take to be heard.
+	 *
+	 * The positions and elapsed times reported for a sound are those of the
+	 * samples just mixed. Code synchronizing animations, subtitles or timing
+	 * windows to what the player hears can subtract this value from them.
+	 *
+	 * @return The output latency in milliseconds, as far as the backend knows it.
+	 */
+	virtual uint32 getOutputLatency() const = 0;
 };
 
 /** @} */
@@ -23,6 +23,8 @@
 #define AUDIO_MIXER_INTERN_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
+#include "common/lockfree-queue.h"
 #include "common/mutex.h"
 #include "audio/mixer.h"
 
@@ -65,7 +67,7 @@ private:
 
 	const uint _sampleRate;
 	const bool _stereo;
-	const uint _outBufSize;
+	std::atomic<uint> _outBufSize;
 	bool _mixerReady;
 	uint32 _handleSeed;
 
@@ -79,6 +81,43 @@ private:
 	SoundTypeSettings _soundTypeSettings[4];
 	Channel *_channels[NUM_CHANNELS];
 
+	bool _wideMixBus;
+	Common::Array<int32> _mixBus;
+
+	/**
+	 * A change of a channel setting, posted by the setters which are
+	 * called all the time, like setChannelVolume(), without taking the
+	 * mixer mutex.
+	 */
+	struct Command {
+		enum Type {
+			kSetVolume,
+			kSetBalance,
+			kPauseHandle,
+			kPauseID,
+			kPauseAll
+		};
+
+		Type type;
+		uint32 handle;
+		int id;
+		int value;
+	};
+
+	/**
+	 * Commands not applied yet. They are applied in order by whoever takes
+	 * the mutex next, so that callers never see them pending.
+	 */
+	Common::LockFreeQueue<Command> _commands;
+
+	std::atomic<uint32> _underrunCount;
+
+	void postCommand(const Command &cmd);
+	void processCommands();
+	void applyCommand(const Command &cmd);
+
+	template<class T>
+	int mixChannels(T *buf, uint len);
 
 public:
 
@@ -135,6 +174,7 @@ public:
 	virtual uint getOutputRate() const;
 	virtual bool getOutputStereo() const;
 	virtual uint getOutputBufSize() const;
+	virtual uint32 getOutputLatency() const;
 
 protected:
 	void insertChannel(SoundHandle *handle, Channel *chan);
@@ -157,6 +197,103 @@ public:
 	 * their audio system has been completed.
 	 */
 	void setReady(bool ready);
+
+	/**
+	 * Choose how channels are mixed together.
+	 *
+	 * By default, every channel is mixed straight into the 16-bit output,
+	 * clamping after each one. With the wide mix bus, channels are summed in
+	 * 32 bits and clamped once per buffer instead, which keeps precision
+	 * when many loud channels play at once and is faster with SIMD. It
+	 * costs a 32-bit buffer the size of the output.
+	 */
+	void setWideMixBus(bool enable);
+
+	/**
+	 * Update the buffer size after the backend reopened its audio device
+	 * with a different one.
+	 */
+	void setOutputBufSize(uint outBufSize);
+
+	/**
+	 * Number of buffers which were probably not ready in time.
+	 *
+	 * The mixer counts callbacks which took longer than the buffer they
+	 * filled lasts. Backends whose audio API reports underruns can add them
+	 * with notifyUnderrun().
+	 */
+	uint32 getUnderrunCount() const { return _underrunCount.load(std::memory_order_relaxed); }
+
+	/** Count an underrun reported by the audio API of the backend. */
+	void notifyUnderrun() { _underrunCount.fetch_add(1, std::memory_order_relaxed); }
+
+	enum {
+		/** Buckets of the callback duration histogram, one per power of two ticks. */
+		kStatsHistogramSize = 32
+	};
+
+	/** Time spent by a channel, see getStats(). */
+	struct ChannelStats {
+		int slot;   ///< Index of the channel in the mixer.
+		int id;
+		SoundType type;
+		uint32 rate;
+		uint64 decodeTicks;   ///< Spent reading the stream.
+		uint64 resampleTicks; ///< Spent converting and mixing it, without decoding.
+		uint64 samples;       ///< Output sample pairs mixed.
+	};
+
+	/**
+	 * Where the time of the mixer goes, see getStats().
+	 *
+	 * Times are in ticks of Common::getCycleCount(). elapsedTicks and
+	 * elapsedMillis give the length of the measurement in both units, to
+	 * convert them.
+	 */
+	struct Stats {
+		uint64 elapsedTicks;
+		uint32 elapsedMillis;
+
+		uint32 callbacks;
+		uint32 missedDeadlines; ///< Callbacks which took longer than their buffer lasts.
+		uint64 callbackTicks;
+		uint64 maxCallbackTicks;
+		uint64 samples;         ///< Output sample pairs of all callbacks.
+
+		/** Callbacks by duration: entry i counts those of less than 2^(i+1) ticks. */
+		uint32 histogram[kStatsHistogramSize];
+
+		/** The channels playing at the moment. */
+		Common::Array<ChannelStats> channels;
+	};
+
+	/**
+	 * Start or stop measuring the time spent in the mixer.
+	 *
+	 * While enabled, the duration of every callback and the time every
+	 * channel spends decoding and resampling is counted. This costs a few
+	 * reads of the cycle counter per channel and buffer, and an extra
+	 * virtual call per read from the streams. Enabling resets the numbers.
+	 */
+	void enableStats(bool enable);
+	bool isStatsEnabled() const;
+
+	/** Fill in the numbers measured since stats were enabled. */
+	void getStats(Stats &stats) const;
+
+private:
+	void resetStats();
+	void countCallback(uint64 ticks, uint len, bool missedDeadline);
+
+	bool _statsEnabled;
+	uint64 _statsStartTicks;
+	uint32 _statsStartMillis;
+	uint32 _statsCallbacks;
+	uint32 _statsMissedDeadlines;
+	uint64 _statsCallbackTicks;
+	uint64 _statsMaxCallbackTicks;
+	uint64 _statsSamples;
+	uint32 _statsHistogram[kStatsHistogramSize];
 };
 
 /** @} */
@@ -7,8 +7,10 @@ MODULE_OBJS := \
 	casio.o \
 	chip.o \
 	cms.o \
+	decodeahead.o \
 	fmopl.o \
 	mac_plugin.o \
+	midicache.o \
 	mididrv.o \
 	mididrv_ms.o \
 	midiparser_qt.o \
@@ -18,6 +20,7 @@ MODULE_OBJS := \
 	midiplayer.o \
 	miles_adlib.o \
 	miles_midi.o \
+	mixbus.o \
 	mixer.o \
 	mpu401.o \
 	mt32gm.o \
@@ -39,6 +42,7 @@ MODULE_OBJS := \
 	decoders/qdm2.o \
 	decoders/quicktime.o \
 	decoders/raw.o \
+	decoders/seekindex.o \
 	decoders/voc.o \
 	decoders/vorbis.o \
 	decoders/wave.o \
@@ -68,6 +72,25 @@ MODULE_OBJS := \
 ifndef DISABLE_NUKED_OPL
 MODULE_OBJS += \
 	softsynth/opl/nuked.o
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	softsynth/opl/nuked-neon.o
+endif
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	softsynth/opl/nuked-sse2.o
+endif
+endif
+
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	mixbus-neon.o \
+	rate-neon.o
+endif
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	mixbus-sse2.o \
+	rate-sse2.o
 endif
 
 ifdef USE_A52
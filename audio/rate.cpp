@@ -28,10 +28,16 @@
  */
 
 #include "audio/audiostream.h"
+#include "audio/mixbus.h"
 #include "audio/rate.h"
 #include "audio/mixer.h"
+#include "common/array.h"
+#include "common/config-manager.h"
+#include "common/system.h"
 #include "common/util.h"
 
+#include <math.h>
+
 namespace Audio {
 
 /**
@@ -45,6 +51,74 @@ enum {
 	FRAC_HALF_LOW = (1L << (FRAC_BITS_LOW-1))
 };
 
+/** Mix a sample into a 16-bit output buffer, clamping the sum. */
+static inline void mixSample(int16 &a, int b) {
+	clampedAdd(a, b);
+}
+
+/** Mix a sample into a 32-bit mix bus, which is clamped only at the end. */
+static inline void mixSample(int32 &a, int b) {
+	a += b;
+}
+
+/**
+ * Mix a run of input frames into the output in one go, with the volume
+ * applied. This is only worth it on the 32-bit mix bus, where no clamping
+ * is needed in between.
+ *
+ * @return false if the run has to be mixed sample by sample instead.
+ */
+static inline bool mixRun(int16 *, const st_sample_t *, uint, bool, st_volume_t, st_volume_t) {
+	return false;
+}
+
+static inline bool mixRun(int32 *outBuffer, const st_sample_t *inBuffer, uint frames, bool inStereo, st_volume_t volL, st_volume_t volR) {
+	mixBusAccumulate(outBuffer, inBuffer, frames, inStereo, volL, volR);
+	return true;
+}
+
+#ifdef SCUMMVM_SSE2
+// Defined in rate-sse2.cpp
+int32 dotProduct16SSE2(const int16 *samples, const int16 *coefs);
+#endif
+
+#ifdef SCUMMVM_NEON
+// Defined in rate-neon.cpp
+int32 dotProduct16NEON(const int16 *samples, const int16 *coefs);
+#endif
+
+/** Dot product of 16 samples with 16 filter coefficients. */
+static int32 dotProduct16Generic(const int16 *samples, const int16 *coefs) {
+	int32 sum = 0;
+	for (int i = 0; i < 16; ++i)
+		sum += samples[i] * coefs[i];
+	return sum;
+}
+
+typedef int32 (*DotProductFunc)(const int16 *samples, const int16 *coefs);
+
+/** Pick the dot product kernel for the CPU, like the mix bus kernels. */
+static DotProductFunc getDotProduct16() {
+	DotProductFunc func = dotProduct16Generic;
+#if defined(SCUMMVM_SSE2) && (defined(__x86_64__) || defined(_M_X64))
+	func = dotProduct16SSE2;
+#elif defined(SCUMMVM_NEON) && defined(__aarch64__)
+	func = dotProduct16NEON;
+#else
+	if (g_system) {
+#ifdef SCUMMVM_NEON
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON))
+			func = dotProduct16NEON;
+#endif
+#ifdef SCUMMVM_SSE2
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+			func = dotProduct16SSE2;
+#endif
+	}
+#endif
+	return func;
+}
+
 template<bool inStereo, bool outStereo, bool reverseStereo>
 class RateConverter_Impl : public RateConverter {
 private:
@@ -76,15 +150,33 @@ private:
 	/** Current sample(s) in the input stream (left/right channel) */
 	st_sample_t _inCurL, _inCurR;
 
-	int copyConvert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r);
-	int simpleConvert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r);
-	int interpolateConvert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r);
+	template<typename T>
+	int copyConvert(AudioStream &input, T *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r);
+	template<typename T>
+	int simpleConvert(AudioStream &input, T *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r);
+	template<typename T>
+	int interpolateConvert(AudioStream &input, T *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r);
+
+	template<int factor, typename T>
+	int upsampleConvert(AudioStream &input, T *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r);
+
+	template<typename T>
+	int convertTo(AudioStream &input, T *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r);
+
+	template<typename T>
+	void mixFrames(T *outBuffer, const st_sample_t *frames, uint count, st_volume_t vol_l, st_volume_t vol_r);
 
 public:
 	RateConverter_Impl(st_rate_t inputRate, st_rate_t outputRate);
 	virtual ~RateConverter_Impl() {}
 
-	int convert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r) override;
+	int convert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r) override {
+		return convertTo(input, outBuffer, numSamples, vol_l, vol_r);
+	}
+
+	int convert(AudioStream &input, int32 *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r) override {
+		return convertTo(input, outBuffer, numSamples, vol_l, vol_r);
+	}
 
 	void setInputRate(st_rate_t inputRate) override { _inRate = inputRate; }
 	void setOutputRate(st_rate_t outputRate) override { _outRate = outputRate; }
@@ -96,8 +188,9 @@ public:
 };
 
 template<bool inStereo, bool outStereo, bool reverseStereo>
-int RateConverter_Impl<inStereo, outStereo, reverseStereo>::copyConvert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t volL, st_volume_t volR) {
-	st_sample_t *outStart, *outEnd;
+template<typename T>
+int RateConverter_Impl<inStereo, outStereo, reverseStereo>::copyConvert(AudioStream &input, T *outBuffer, st_size_t numSamples, st_volume_t volL, st_volume_t volR) {
+	T *outStart, *outEnd;
 
 	outStart = outBuffer;
 	outEnd = outBuffer + numSamples * (outStereo ? 2 : 1);
@@ -112,6 +205,17 @@ int RateConverter_Impl<inStereo, outStereo, reverseStereo>::copyConvert(AudioStr
 				return (outBuffer - outStart) / (outStereo ? 2 : 1);
 		}
 
+		if (outStereo && !reverseStereo) {
+			// Mix as much of the buffer as fits in one go, if possible
+			const uint frames = MIN<uint>(_bufferSize / (inStereo ? 2 : 1), (outEnd - outBuffer) / 2);
+			if (mixRun(outBuffer, _bufferPos, frames, inStereo, volL, volR)) {
+				_bufferPos += frames * (inStereo ? 2 : 1);
+				_bufferSize -= frames * (inStereo ? 2 : 1);
+				outBuffer += frames * 2;
+				continue;
+			}
+		}
+
 		// Mix the data into the output buffer
 		st_sample_t inL, inR;
 		inL = *_bufferPos++;
@@ -124,15 +228,15 @@ int RateConverter_Impl<inStereo, outStereo, reverseStereo>::copyConvert(AudioStr
 
 		if (outStereo) {
 			// Output left channel
-			clampedAdd(outBuffer[reverseStereo    ], outL);
+			mixSample(outBuffer[reverseStereo    ], outL);
 
 			// Output right channel
-			clampedAdd(outBuffer[reverseStereo ^ 1], outR);
+			mixSample(outBuffer[reverseStereo ^ 1], outR);
 
 			outBuffer += 2;
 		} else {
 			// Output mono channel
-			clampedAdd(outBuffer[0], (outL + outR) / 2);
+			mixSample(outBuffer[0], (outL + outR) / 2);
 
 			outBuffer += 1;
 		}
@@ -142,11 +246,12 @@ int RateConverter_Impl<inStereo, outStereo, reverseStereo>::copyConvert(AudioStr
 }
 
 template<bool inStereo, bool outStereo, bool reverseStereo>
-int RateConverter_Impl<inStereo, outStereo, reverseStereo>::simpleConvert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t volL, st_volume_t volR) {
+template<typename T>
+int RateConverter_Impl<inStereo, outStereo, reverseStereo>::simpleConvert(AudioStream &input, T *outBuffer, st_size_t numSamples, st_volume_t volL, st_volume_t volR) {
 	// How much to increment _outPos by
 	frac_t outPos_inc = _inRate / _outRate;
 
-	st_sample_t *outStart, *outEnd;
+	T *outStart, *outEnd;
 
 	outStart = outBuffer;
 	outEnd = outBuffer + numSamples * (outStereo ? 2 : 1);
@@ -184,15 +289,15 @@ int RateConverter_Impl<inStereo, outStereo, reverseStereo>::simpleConvert(AudioS
 
 		if (outStereo) {
 			// output left channel
-			clampedAdd(outBuffer[reverseStereo    ], outL);
+			mixSample(outBuffer[reverseStereo    ], outL);
 
 			// output right channel
-			clampedAdd(outBuffer[reverseStereo ^ 1], outR);
+			mixSample(outBuffer[reverseStereo ^ 1], outR);
 
 			outBuffer += 2;
 		} else {
 			// output mono channel
-			clampedAdd(outBuffer[0], (outL + outR) / 2);
+			mixSample(outBuffer[0], (outL + outR) / 2);
 
 			outBuffer += 1;
 		}
@@ -201,11 +306,12 @@ int RateConverter_Impl<inStereo, outStereo, reverseStereo>::simpleConvert(AudioS
 }
 
 template<bool inStereo, bool outStereo, bool reverseStereo>
-int RateConverter_Impl<inStereo, outStereo, reverseStereo>::interpolateConvert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t volL, st_volume_t volR) {
+template<typename T>
+int RateConverter_Impl<inStereo, outStereo, reverseStereo>::interpolateConvert(AudioStream &input, T *outBuffer, st_size_t numSamples, st_volume_t volL, st_volume_t volR) {
 	// How much to increment _outPosFrac by
 	frac_t outPos_inc = (_inRate << FRAC_BITS_LOW) / _outRate;
 
-	st_sample_t *outStart, *outEnd;
+	T *outStart, *outEnd;
 	outStart = outBuffer;
 	outEnd = outBuffer + numSamples * (outStereo ? 2 : 1);
 
@@ -249,15 +355,15 @@ int RateConverter_Impl<inStereo, outStereo, reverseStereo>::interpolateConvert(A
 
 			if (outStereo) {
 				// Output left channel
-				clampedAdd(outBuffer[reverseStereo    ], outL);
+				mixSample(outBuffer[reverseStereo    ], outL);
 
 				// Output right channel
-				clampedAdd(outBuffer[reverseStereo ^ 1], outR);
+				mixSample(outBuffer[reverseStereo ^ 1], outR);
 
 				outBuffer += 2;
 			} else {
 				// Output mono channel
-				clampedAdd(outBuffer[0], (outL + outR) / 2);
+				mixSample(outBuffer[0], (outL + outR) / 2);
 
 				outBuffer += 1;
 			}
@@ -269,6 +375,119 @@ int RateConverter_Impl<inStereo, outStereo, reverseStereo>::interpolateConvert(A
 	return (outBuffer - outStart) / (outStereo ? 2 : 1);
 }
 
+template<bool inStereo, bool outStereo, bool reverseStereo>
+template<int factor, typename T>
+int RateConverter_Impl<inStereo, outStereo, reverseStereo>::upsampleConvert(AudioStream &input, T *outBuffer, st_size_t numSamples, st_volume_t volL, st_volume_t volR) {
+	// With an integer ratio, every input sample gets the same factor output
+	// positions, so whole groups can be interpolated with constant weights.
+	// This gives the same output as interpolateConvert().
+	const frac_t outPos_inc = FRAC_ONE_LOW / factor;
+	const int kBlockGroups = 64;
+	st_sample_t block[kBlockGroups * factor * 2];
+
+	T *outStart, *outEnd;
+	outStart = outBuffer;
+	outEnd = outBuffer + numSamples * (outStereo ? 2 : 1);
+
+	while (outBuffer < outEnd) {
+		if ((frac_t)FRAC_ONE_LOW <= _outPosFrac) {
+			// Check if we have to refill the buffer
+			if (_bufferSize == 0) {
+				_bufferPos = _buffer;
+				_bufferSize = input.readBuffer(_buffer, ARRAYSIZE(_buffer));
+
+				if (_bufferSize <= 0)
+					return (outBuffer - outStart) / (outStereo ? 2 : 1);
+			}
+
+			_bufferSize -= (inStereo ? 2 : 1);
+			_inLastL = _inCurL;
+			_inCurL = *_bufferPos++;
+
+			if (inStereo) {
+				_inLastR = _inCurR;
+				_inCurR = *_bufferPos++;
+			}
+
+			_outPosFrac -= FRAC_ONE_LOW;
+		}
+
+		// Interpolate as many whole groups as there are input samples
+		// buffered and room in the output
+		if (_outPosFrac == 0) {
+			uint groups = MIN<uint>((outEnd - outBuffer) / (outStereo ? 2 : 1) / factor, kBlockGroups);
+			groups = MIN<uint>(groups, 1 + _bufferSize / (inStereo ? 2 : 1));
+
+			if (groups) {
+				st_sample_t *dst = block;
+				for (uint g = 0; g < groups; ++g) {
+					if (g) {
+						_bufferSize -= (inStereo ? 2 : 1);
+						_inLastL = _inCurL;
+						_inCurL = *_bufferPos++;
+
+						if (inStereo) {
+							_inLastR = _inCurR;
+							_inCurR = *_bufferPos++;
+						}
+					}
+
+					const int diffL = _inCurL - _inLastL;
+					const int diffR = inStereo ? _inCurR - _inLastR : diffL;
+					const int lastR = inStereo ? _inLastR : _inLastL;
+					for (int k = 0; k < factor; ++k) {
+						*dst++ = (st_sample_t)(_inLastL + ((diffL * k * outPos_inc + FRAC_HALF_LOW) >> FRAC_BITS_LOW));
+						*dst++ = (st_sample_t)(lastR + ((diffR * k * outPos_inc + FRAC_HALF_LOW) >> FRAC_BITS_LOW));
+					}
+				}
+
+				mixFrames(outBuffer, block, groups * factor, volL, volR);
+				outBuffer += groups * factor * (outStereo ? 2 : 1);
+				_outPosFrac = FRAC_ONE_LOW;
+				continue;
+			}
+		}
+
+		// Not enough room left for a whole group, or an odd position left
+		// by a rate change: same as interpolateConvert()
+		while (_outPosFrac < (frac_t)FRAC_ONE_LOW && outBuffer < outEnd) {
+			st_sample_t frame[2];
+			frame[0] = (st_sample_t)(_inLastL + (((_inCurL - _inLastL) * _outPosFrac + FRAC_HALF_LOW) >> FRAC_BITS_LOW));
+			frame[1] = (inStereo ?
+						(st_sample_t)(_inLastR + (((_inCurR - _inLastR) * _outPosFrac + FRAC_HALF_LOW) >> FRAC_BITS_LOW)) :
+						frame[0]);
+
+			mixFrames(outBuffer, frame, 1, volL, volR);
+			outBuffer += (outStereo ? 2 : 1);
+			_outPosFrac += outPos_inc;
+		}
+	}
+	return (outBuffer - outStart) / (outStereo ? 2 : 1);
+}
+
+template<bool inStereo, bool outStereo, bool reverseStereo>
+template<typename T>
+void RateConverter_Impl<inStereo, outStereo, reverseStereo>::mixFrames(T *outBuffer, const st_sample_t *frames, uint count, st_volume_t volL, st_volume_t volR) {
+	// The frames are always stereo here
+	if (outStereo && !reverseStereo && mixRun(outBuffer, frames, count, true, volL, volR))
+		return;
+
+	for (uint i = 0; i < count; ++i) {
+		st_sample_t outL, outR;
+		outL = (frames[2 * i] * (int)volL) / Audio::Mixer::kMaxMixerVolume;
+		outR = (frames[2 * i + 1] * (int)volR) / Audio::Mixer::kMaxMixerVolume;
+
+		if (outStereo) {
+			mixSample(outBuffer[reverseStereo    ], outL);
+			mixSample(outBuffer[reverseStereo ^ 1], outR);
+			outBuffer += 2;
+		} else {
+			mixSample(outBuffer[0], (outL + outR) / 2);
+			outBuffer += 1;
+		}
+	}
+}
+
 template<bool inStereo, bool outStereo, bool reverseStereo>
 RateConverter_Impl<inStereo, outStereo, reverseStereo>::RateConverter_Impl(st_rate_t inputRate, st_rate_t outputRate) :
 	_inRate(inputRate),
@@ -283,11 +502,16 @@ RateConverter_Impl<inStereo, outStereo, reverseStereo>::RateConverter_Impl(st_ra
 	_bufferPos(nullptr) {}
 
 template<bool inStereo, bool outStereo, bool reverseStereo>
-int RateConverter_Impl<inStereo, outStereo, reverseStereo>::convert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t volL, st_volume_t volR) {
+template<typename T>
+int RateConverter_Impl<inStereo, outStereo, reverseStereo>::convertTo(AudioStream &input, T *outBuffer, st_size_t numSamples, st_volume_t volL, st_volume_t volR) {
 	assert(input.isStereo() == inStereo);
 
 	if (_inRate == _outRate) {
 		return copyConvert(input, outBuffer, numSamples, volL, volR);
+	} else if (_outRate == 2 * _inRate) {
+		return upsampleConvert<2>(input, outBuffer, numSamples, volL, volR);
+	} else if (_outRate == 4 * _inRate) {
+		return upsampleConvert<4>(input, outBuffer, numSamples, volL, volR);
 	} else {
 		if ((_inRate % _outRate) == 0 && (_inRate < 65536)) {
 			return simpleConvert(input, outBuffer, numSamples, volL, volR);
@@ -297,20 +521,302 @@ int RateConverter_Impl<inStereo, outStereo, reverseStereo>::convert(AudioStream
 	}
 }
 
-RateConverter *makeRateConverter(st_rate_t inRate, st_rate_t outRate, bool inStereo, bool outStereo, bool reverseStereo) {
+/** Size of the windowed-sinc filter */
+enum {
+	SINC_TAPS = 16,
+	SINC_PHASE_BITS = 8,
+	SINC_PHASES = (1L << SINC_PHASE_BITS),
+	SINC_COEF_BITS = 14
+};
+
+/** Fill filter with the coefficients of all phases of a windowed-sinc lowpass filter. */
+static void buildSincFilter(int16 *filter, double cutoff) {
+	const double center = SINC_TAPS / 2 - 1;
+
+	for (int phase = 0; phase < SINC_PHASES; ++phase) {
+		const double frac = (double)phase / SINC_PHASES;
+		double coefs[SINC_TAPS];
+		double sum = 0;
+
+		for (int i = 0; i < SINC_TAPS; ++i) {
+			// Distance of tap i from the output position, which lies
+			// between the two middle taps
+			const double x = i - center - frac;
+			const double sinc = (x == 0) ? 1.0 : sin(M_PI * cutoff * x) / (M_PI * cutoff * x);
+			// Blackman window over the width of the filter
+			const double w = x * M_PI / (SINC_TAPS / 2);
+			const double window = 0.42 + 0.5 * cos(w) + 0.08 * cos(2 * w);
+
+			coefs[i] = sinc * window;
+			sum += coefs[i];
+		}
+
+		// Normalize each phase to unity gain, and make the rounded
+		// coefficients add up exactly
+		int total = 0;
+		int16 *out = filter + phase * SINC_TAPS;
+		for (int i = 0; i < SINC_TAPS; ++i) {
+			out[i] = (int16)floor(coefs[i] / sum * (1 << SINC_COEF_BITS) + 0.5);
+			total += out[i];
+		}
+		out[SINC_TAPS / 2 - (frac < 0.5 ? 1 : 0)] += (1 << SINC_COEF_BITS) - total;
+	}
+}
+
+static const int16 *getSincUpsamplingFilter() {
+	// Upsampling always cuts off at the input's Nyquist frequency,
+	// so all converters share the same filter.
+	static int16 *filter = nullptr;
+	if (!filter) {
+		int16 *newFilter = new int16[SINC_PHASES * SINC_TAPS];
+		buildSincFilter(newFilter, 0.95);
+		filter = newFilter;
+	}
+	return filter;
+}
+
+/**
+ * Resampling with a windowed-sinc filter.
+ *
+ * Each output sample is the dot product of the last SINC_TAPS input samples
+ * with one of SINC_PHASES sets of filter coefficients, picked by the position
+ * of the output sample between two input samples. The filter cuts off just
+ * below the lower of the two Nyquist frequencies, so upsampling does not
+ * leave the images linear interpolation does, and downsampling does not
+ * alias.
+ *
+ * The output lags SINC_TAPS / 2 samples behind the input; that many samples
+ * of silence are fed at the end of the stream to flush the filter.
+ */
+template<bool inStereo, bool outStereo, bool reverseStereo>
+class RateConverter_Sinc : public RateConverter {
+private:
+	/** Input and output rates */
+	st_rate_t _inRate, _outRate;
+
+	/** The intermediate input cache */
+	st_sample_t _buffer[512];
+
+	/** Current position inside the buffer */
+	const st_sample_t *_bufferPos;
+
+	/** Size of data currently loaded into the buffer */
+	int _bufferSize;
+
+	/**
+	 * The last SINC_TAPS input samples of each channel. Every sample is stored
+	 * twice, SINC_TAPS apart, so the window starting at _historyPos is always
+	 * contiguous.
+	 */
+	int16 _historyL[2 * SINC_TAPS];
+	int16 _historyR[2 * SINC_TAPS];
+	uint _historyPos;
+
+	/** Samples of silence still to feed once the stream has ended */
+	uint _tailLeft;
+
+	/** Fractional position of the output stream in input stream unit */
+	frac_t _outPosFrac;
+
+	/** SINC_PHASES x SINC_TAPS filter coefficients, for the current rates */
+	const int16 *_filter;
+	Common::Array<int16> _ownFilter;
+	st_rate_t _filterInRate, _filterOutRate;
+
+	DotProductFunc _dotProduct;
+
+	void updateFilter();
+	bool nextInputSample(AudioStream &input);
+
+	template<typename T>
+	int convertTo(AudioStream &input, T *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r);
+
+public:
+	RateConverter_Sinc(st_rate_t inputRate, st_rate_t outputRate);
+	virtual ~RateConverter_Sinc() {}
+
+	int convert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r) override {
+		return convertTo(input, outBuffer, numSamples, vol_l, vol_r);
+	}
+
+	int convert(AudioStream &input, int32 *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r) override {
+		return convertTo(input, outBuffer, numSamples, vol_l, vol_r);
+	}
+
+	void setInputRate(st_rate_t inputRate) override { _inRate = inputRate; }
+	void setOutputRate(st_rate_t outputRate) override { _outRate = outputRate; }
+
+	st_rate_t getInputRate() const override { return _inRate; }
+	st_rate_t getOutputRate() const override { return _outRate; }
+
+	bool needsDraining() const override { return _bufferSize != 0 || _tailLeft != 0; }
+};
+
+template<bool inStereo, bool outStereo, bool reverseStereo>
+RateConverter_Sinc<inStereo, outStereo, reverseStereo>::RateConverter_Sinc(st_rate_t inputRate, st_rate_t outputRate) :
+	_inRate(inputRate),
+	_outRate(outputRate),
+	_bufferPos(nullptr),
+	_bufferSize(0),
+	_historyPos(0),
+	_tailLeft(0),
+	_outPosFrac(FRAC_ONE_LOW),
+	_filter(nullptr),
+	_filterInRate(0),
+	_filterOutRate(0),
+	_dotProduct(getDotProduct16()) {
+	memset(_historyL, 0, sizeof(_historyL));
+	memset(_historyR, 0, sizeof(_historyR));
+}
+
+template<bool inStereo, bool outStereo, bool reverseStereo>
+void RateConverter_Sinc<inStereo, outStereo, reverseStereo>::updateFilter() {
+	if (_filter && _filterInRate == _inRate && _filterOutRate == _outRate)
+		return;
+
+	_filterInRate = _inRate;
+	_filterOutRate = _outRate;
+
+	if (_inRate <= _outRate) {
+		_filter = getSincUpsamplingFilter();
+		_ownFilter.clear();
+	} else {
+		// Cut off below the output's Nyquist frequency
+		_ownFilter.resize(SINC_PHASES * SINC_TAPS);
+		buildSincFilter(_ownFilter.data(), 0.95 * _outRate / _inRate);
+		_filter = _ownFilter.data();
+	}
+}
+
+template<bool inStereo, bool outStereo, bool reverseStereo>
+bool RateConverter_Sinc<inStereo, outStereo, reverseStereo>::nextInputSample(AudioStream &input) {
+	int16 inL, inR;
+
+	// Check if we have to refill the buffer
+	if (_bufferSize == 0) {
+		_bufferPos = _buffer;
+		_bufferSize = input.readBuffer(_buffer, ARRAYSIZE(_buffer));
+
+		if (_bufferSize <= 0) {
+			_bufferSize = 0;
+
+			// Flush the filter with silence at the end of the stream
+			if (!_tailLeft || !input.endOfStream())
+				return false;
+
+			_tailLeft--;
+			inL = inR = 0;
+		}
+	}
+
+	if (_bufferSize) {
+		_bufferSize -= (inStereo ? 2 : 1);
+		inL = *_bufferPos++;
+		inR = (inStereo ? *_bufferPos++ : inL);
+		_tailLeft = SINC_TAPS / 2;
+	}
+
+	_historyL[_historyPos] = _historyL[_historyPos + SINC_TAPS] = inL;
+	if (inStereo)
+		_historyR[_historyPos] = _historyR[_historyPos + SINC_TAPS] = inR;
+	_historyPos = (_historyPos + 1) % SINC_TAPS;
+	return true;
+}
+
+template<bool inStereo, bool outStereo, bool reverseStereo>
+template<typename T>
+int RateConverter_Sinc<inStereo, outStereo, reverseStereo>::convertTo(AudioStream &input, T *outBuffer, st_size_t numSamples, st_volume_t volL, st_volume_t volR) {
+	assert(input.isStereo() == inStereo);
+
+	updateFilter();
+
+	// How much to increment _outPosFrac by
+	const frac_t outPos_inc = (_inRate << FRAC_BITS_LOW) / _outRate;
+
+	T *outStart, *outEnd;
+	outStart = outBuffer;
+	outEnd = outBuffer + numSamples * (outStereo ? 2 : 1);
+
+	while (outBuffer < outEnd) {
+		// Read enough input samples so that _outPosFrac < 1
+		while ((frac_t)FRAC_ONE_LOW <= _outPosFrac) {
+			if (!nextInputSample(input))
+				return (outBuffer - outStart) / (outStereo ? 2 : 1);
+
+			_outPosFrac -= FRAC_ONE_LOW;
+		}
+
+		while (_outPosFrac < (frac_t)FRAC_ONE_LOW && outBuffer < outEnd) {
+			const int16 *windowL = _historyL + _historyPos;
+			const int16 *windowR = inStereo ? _historyR + _historyPos : windowL;
+
+			st_sample_t inL, inR;
+			if (_inRate == _outRate) {
+				// Nothing to filter, just keep the same delay
+				inL = windowL[SINC_TAPS / 2 - 1];
+				inR = windowR[SINC_TAPS / 2 - 1];
+			} else {
+				const int16 *coefs = _filter + (_outPosFrac >> (FRAC_BITS_LOW - SINC_PHASE_BITS)) * SINC_TAPS;
+				const int32 half = 1 << (SINC_COEF_BITS - 1);
+
+				// The filter overshoots on steep edges
+				inL = (st_sample_t)CLIP<int32>((_dotProduct(windowL, coefs) + half) >> SINC_COEF_BITS, ST_SAMPLE_MIN, ST_SAMPLE_MAX);
+				inR = inStereo ? (st_sample_t)CLIP<int32>((_dotProduct(windowR, coefs) + half) >> SINC_COEF_BITS, ST_SAMPLE_MIN, ST_SAMPLE_MAX) : inL;
+			}
+
+			st_sample_t outL, outR;
+			outL = (inL * (int)volL) / Audio::Mixer::kMaxMixerVolume;
+			outR = (inR * (int)volR) / Audio::Mixer::kMaxMixerVolume;
+
+			if (outStereo) {
+				// Output left channel
+				mixSample(outBuffer[reverseStereo    ], outL);
+
+				// Output right channel
+				mixSample(outBuffer[reverseStereo ^ 1], outR);
+
+				outBuffer += 2;
+			} else {
+				// Output mono channel
+				mixSample(outBuffer[0], (outL + outR) / 2);
+
+				outBuffer += 1;
+			}
+
+			// Increment output position
+			_outPosFrac += outPos_inc;
+		}
+	}
+	return (outBuffer - outStart) / (outStereo ? 2 : 1);
+}
+
+ResamplerType getConfiguredResampler() {
+	if (ConfMan.get("resampler") == "sinc")
+		return kResamplerSinc;
+	return kResamplerLinear;
+}
+
+template<bool inStereo, bool outStereo, bool reverseStereo>
+static RateConverter *makeRateConverterImpl(st_rate_t inRate, st_rate_t outRate, ResamplerType type) {
+	if (type == kResamplerSinc)
+		return new RateConverter_Sinc<inStereo, outStereo, reverseStereo>(inRate, outRate);
+	return new RateConverter_Impl<inStereo, outStereo, reverseStereo>(inRate, outRate);
+}
+
+RateConverter *makeRateConverter(st_rate_t inRate, st_rate_t outRate, bool inStereo, bool outStereo, bool reverseStereo, ResamplerType type) {
 	if (inStereo) {
 		if (outStereo) {
 			if (reverseStereo)
-				return new RateConverter_Impl<true, true, true>(inRate, outRate);
+				return makeRateConverterImpl<true, true, true>(inRate, outRate, type);
 			else
-				return new RateConverter_Impl<true, true, false>(inRate, outRate);
+				return makeRateConverterImpl<true, true, false>(inRate, outRate, type);
 		} else
-			return new RateConverter_Impl<true, false, false>(inRate, outRate);
+			return makeRateConverterImpl<true, false, false>(inRate, outRate, type);
 	} else {
 		if (outStereo) {
-			return new RateConverter_Impl<false, true, false>(inRate, outRate);
+			return makeRateConverterImpl<false, true, false>(inRate, outRate, type);
 		} else
-			return new RateConverter_Impl<false, false, false>(inRate, outRate);
+			return makeRateConverterImpl<false, false, false>(inRate, outRate, type);
 	}
 }
 
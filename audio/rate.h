@@ -90,6 +90,15 @@ public:
 	 */
 	virtual int convert(AudioStream &input, st_sample_t *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r) = 0;
 
+	/**
+	 * Convert the provided AudioStream to the target sample rate, and mix
+	 * it into a 32-bit mix bus. Unlike the 16-bit variant, the samples are
+	 * not clamped: that is done once all channels have been mixed.
+	 *
+	 * @see mixBusClamp
+	 */
+	virtual int convert(AudioStream &input, int32 *outBuffer, st_size_t numSamples, st_volume_t vol_l, st_volume_t vol_r) = 0;
+
 	virtual void setInputRate(st_rate_t inputRate) = 0;
 	virtual void setOutputRate(st_rate_t outputRate) = 0;
 
@@ -104,7 +113,19 @@ public:
 	virtual bool needsDraining() const = 0;
 };
 
-RateConverter *makeRateConverter(st_rate_t inRate, st_rate_t outRate, bool inStereo, bool outStereo, bool reverseStereo);
+/** Algorithms available to resample streams. */
+enum ResamplerType {
+	kResamplerLinear,	///< Linear interpolation between input samples. Cheap, but leaves some aliasing.
+	kResamplerSinc		///< Windowed-sinc polyphase filter. Much cleaner, at a few times the cost.
+};
+
+/**
+ * Get the resampler named by the "resampler" configuration key, which is
+ * "linear" or "sinc".
+ */
+ResamplerType getConfiguredResampler();
+
+RateConverter *makeRateConverter(st_rate_t inRate, st_rate_t outRate, bool inStereo, bool outStereo, bool reverseStereo, ResamplerType type = kResamplerLinear);
 
 /** @} */
 } // End of namespace Audio
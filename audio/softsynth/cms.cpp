@@ -85,6 +85,9 @@ static const int amplitude_lookup[16] = {
 };
 
 void DOSBoxCMS::write(int a, int v) {
+	if (queueRegisterWrite(a, v, true))
+		return;
+
 	switch (a-_basePort) {
 	case 0:
 		portWriteIntern(0, 0, v);
@@ -109,6 +112,9 @@ void DOSBoxCMS::write(int a, int v) {
 }
 
 void DOSBoxCMS::writeReg(int r, int v) {
+	if (queueRegisterWrite(r, v, false))
+		return;
+
 	int chip = 0;
 	if (r >= 0x100)
 		chip = 1;
@@ -117,6 +123,13 @@ void DOSBoxCMS::writeReg(int r, int v) {
 	portWriteIntern(chip, 0, v);
 }
 
+void DOSBoxCMS::applyRegisterWrite(int a, int v, bool port) {
+	if (port)
+		write(a, v);
+	else
+		writeReg(a, v);
+}
+
 void DOSBoxCMS::generateSamples(int16 *buffer, const int numSamples) {
 	update(0, &buffer[0], numSamples);
 	update(1, &buffer[0], numSamples);
@@ -128,6 +141,7 @@ bool DOSBoxCMS::init() {
 }
 
 void DOSBoxCMS::reset() {
+	clearRegisterWrites();
 	memset(_saa1099, 0, sizeof(SAA1099) * 2);
 }
 
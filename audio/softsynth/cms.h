@@ -81,6 +81,7 @@ public:
 	bool isStereo() const override { return true; }
 
 protected:
+	void applyRegisterWrite(int a, int v, bool port) override;
 	void generateSamples(int16 *buffer, int numSamples) override;
 
 private:
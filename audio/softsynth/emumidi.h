@@ -23,6 +23,7 @@
 #define AUDIO_SOFTSYNTH_EMUMIDI_H
 
 #include "audio/audiostream.h"
+#include "audio/midicache.h"
 #include "audio/mididrv.h"
 #include "audio/mixer.h"
 
@@ -43,12 +44,46 @@ private:
 	int _nextTick;
 	int _samplesPerTick;
 
+	Audio::MidiRenderCache *_renderCache;
+	bool _inBlock;
+	int _blockPos;      ///< Sample frames of the current block rendered so far
+	bool _parserEvent;
+
+	uint getBlockOffset() const { return _inBlock ? _blockPos : 0; }
+
 protected:
 	int _baseFreq;
 
 	virtual void generateSamples(int16 *buf, int len) = 0;
 	virtual void onTimer() {}
 
+	/**
+	 * Called once the callbacks for a block have run, for drivers which
+	 * synthesize the whole block at once rather than in generateSamples().
+	 */
+	virtual void finishBlock(int16 *data, int numSamples) {}
+
+	/**
+	 * The settings of the synth its output depends on, other than the
+	 * events it receives, for the render cache. Drivers return an empty
+	 * string if their output cannot be cached.
+	 */
+	virtual Common::String getRenderCacheSettings() { return Common::String(); }
+
+	/**
+	 * Drivers supporting the render cache call this for every event they
+	 * receive, with the data of SysEx messages, so the cache can tell when
+	 * the output no longer matches its recording.
+	 */
+	void noteRenderCacheEvent(const byte *sysex = nullptr, uint16 length = 0) {
+		if (!_renderCache)
+			return;
+		if (sysex)
+			_renderCache->noteSysEx(sysex, length);
+		if (!_parserEvent)
+			_renderCache->stop(getBlockOffset());
+	}
+
 public:
 	MidiDriver_Emulated(Audio::Mixer *mixer) :
 		_mixer(mixer),
@@ -57,9 +92,17 @@ public:
 		_timerParam(0),
 		_nextTick(0),
 		_samplesPerTick(0),
+		_renderCache(nullptr),
+		_inBlock(false),
+		_blockPos(0),
+		_parserEvent(false),
 		_baseFreq(250) {
 	}
 
+	virtual ~MidiDriver_Emulated() {
+		delete _renderCache;
+	}
+
 	// MidiDriver API
 	virtual int open() {
 		_isOpen = true;
@@ -72,6 +115,14 @@ public:
 
 		_samplesPerTick = (d << FIXP_SHIFT) + (r << FIXP_SHIFT) / _baseFreq;
 
+		delete _renderCache;
+		_renderCache = nullptr;
+		if (Audio::MidiRenderCache::isEnabled()) {
+			Common::String settings = getRenderCacheSettings();
+			if (!settings.empty())
+				_renderCache = new Audio::MidiRenderCache(getRate(), isStereo(), settings);
+		}
+
 		return 0;
 	}
 
@@ -86,18 +137,72 @@ public:
 		return 1000000 / _baseFreq;
 	}
 
+	/**
+	 * @name Render cache
+	 * Used by MidiParser to play tracks from the render cache of the driver,
+	 * see Audio::MidiRenderCache. They do nothing if the driver does not
+	 * support it or it is disabled.
+	 * @{
+	 */
+
+	/**
+	 * Start recording or playing back the track with the given key.
+	 *
+	 * @return true if the track is played back, and the events of the
+	 *         track must not be sent any more.
+	 */
+	bool startRenderCache(const Common::String &trackKey) {
+		return _renderCache && _renderCache->start(trackKey, getBlockOffset());
+	}
+
+	/** The track has played through. */
+	void finishRenderCache() {
+		if (_renderCache)
+			_renderCache->finish(getBlockOffset());
+	}
+
+	/** The track no longer plays like it was recorded. */
+	void stopRenderCache() {
+		if (_renderCache)
+			_renderCache->stop(getBlockOffset());
+	}
+
+	/** Whether the playback has not been stopped since it was started. */
+	bool isPlayingRenderCache() const {
+		return _renderCache && _renderCache->isPlaying();
+	}
+
+	/** Write finished recordings to disk. Not to be called from callbacks. */
+	void flushRenderCache() {
+		if (_renderCache)
+			_renderCache->flush();
+	}
+
+	/** Mark the events sent meanwhile as coming from the parser. */
+	void setParserEvent(bool parserEvent) { _parserEvent = parserEvent; }
+
+	/** @} */
+
 	// AudioStream API
 	virtual int readBuffer(int16 *data, const int numSamples) {
 		const int stereoFactor = isStereo() ? 2 : 1;
+		int16 *block = data;
 		int len = numSamples / stereoFactor;
 		int step;
 
+		// Blocks played back from the render cache are not synthesized
+		const bool cached = _renderCache && _renderCache->beginBlock();
+		_inBlock = true;
+		_blockPos = 0;
+
 		do {
 			step = len;
 			if (step > (_nextTick >> FIXP_SHIFT))
 				step = (_nextTick >> FIXP_SHIFT);
 
-			generateSamples(data, step);
+			if (!cached)
+				generateSamples(data, step);
+			_blockPos += step;
 
 			_nextTick -= step << FIXP_SHIFT;
 			if (!(_nextTick >> FIXP_SHIFT)) {
@@ -113,6 +218,11 @@ public:
 			len -= step;
 		} while (len);
 
+		_inBlock = false;
+		finishBlock(block, numSamples);
+		if (_renderCache)
+			_renderCache->endBlock(block, numSamples / stereoFactor, cached);
+
 		return numSamples;
 	}
 
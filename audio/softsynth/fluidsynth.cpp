@@ -109,6 +109,7 @@ protected:
 	void setStr(const char *name, const char *str);
 
 	void generateSamples(int16 *buf, int len) override;
+	Common::String getRenderCacheSettings() override;
 
 public:
 	MidiDriver_FluidSynth(Audio::Mixer *mixer);
@@ -526,6 +527,7 @@ void MidiDriver_FluidSynth::send(uint32 b) {
 		return;
 
 	midiDriverCommonSend(b);
+	noteRenderCacheEvent();
 
 	//byte param3 = (byte) ((b >> 24) & 0xFF);
 	uint param2 = (byte) ((b >> 16) & 0xFF);
@@ -580,6 +582,27 @@ void MidiDriver_FluidSynth::generateSamples(int16 *data, int len) {
 	fluid_synth_write_s16(_synth, len, data, 0, 2, data, 1, 2);
 }
 
+Common::String MidiDriver_FluidSynth::getRenderCacheSettings() {
+	// There is no telling SoundFonts supplied by the engine apart
+	if (_engineSoundFontData && !ConfMan.getActiveDomain()->contains("soundfont"))
+		return Common::String();
+
+	static const char *const keys[] = {
+		"midi_gain",
+		"fluidsynth_chorus_activate", "fluidsynth_chorus_nr", "fluidsynth_chorus_level",
+		"fluidsynth_chorus_speed", "fluidsynth_chorus_depth", "fluidsynth_chorus_waveform",
+		"fluidsynth_reverb_activate", "fluidsynth_reverb_roomsize", "fluidsynth_reverb_damping",
+		"fluidsynth_reverb_width", "fluidsynth_reverb_level",
+		"fluidsynth_misc_interpolation"
+	};
+
+	Common::String settings = Common::String::format("fluidsynth|%d|%s", _outputRate,
+		getSoundFontPath().toString(Common::Path::kNativeSeparator).c_str());
+	for (int i = 0; i < ARRAYSIZE(keys); ++i)
+		settings += "|" + ConfMan.get(keys[i]);
+	return settings;
+}
+
 void MidiDriver_FluidSynth::setEngineSoundFont(Common::SeekableReadStream *soundFontData) {
 	_engineSoundFontData = soundFontData;
 }
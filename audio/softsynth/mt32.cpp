@@ -107,6 +107,14 @@ class MidiChannel_MT32 : public MidiChannel_MPU401 {
 	void chorusLevel(byte value) override { }
 };
 
+enum {
+	kRenderAheadChunkFrames = 512,
+	kRenderAheadInterval = 10 * 1000
+};
+
+// Whether a driver is rendering ahead already
+static bool s_renderingAhead = false;
+
 class MidiDriver_MT32 : public MidiDriver_Emulated {
 private:
 	MidiChannel_MT32 _midiChannels[16];
@@ -118,8 +126,31 @@ private:
 
 	int _outputRate;
 
+	/**
+	 * While the callbacks for a block run, events are queued with the
+	 * time they belong to and the block is rendered in one go afterwards.
+	 */
+	bool _deferRendering;
+	MT32Emu::Bit32u _blockStart;
+	uint _blockFrames;
+
+	/** Buffer of samples rendered ahead, filled from a timer callback. */
+	Common::Mutex _aheadMutex;
+	int16 *_aheadBuffer;
+	uint _aheadSize;
+	uint _aheadReadPos;
+	uint _aheadFill;
+
+	void renderBlock(int16 *data, int numSamples);
+	void playSysexDeferred(const byte *sysex, uint32 length);
+	void writeSysex(byte device, const byte *data, uint32 length);
+	bool renderAhead();
+	static void renderAheadProc(void *refCon);
+
 protected:
 	void generateSamples(int16 *buf, int len) override;
+	void finishBlock(int16 *data, int numSamples) override;
+	Common::String getRenderCacheSettings() override;
 
 public:
 	MidiDriver_MT32(Audio::Mixer *mixer);
@@ -136,6 +167,7 @@ public:
 	MidiChannel *getPercussionChannel() override;
 
 	// AudioStream API
+	int readBuffer(int16 *data, const int numSamples) override;
 	bool isStereo() const override { return true; }
 	int getRate() const override { return _outputRate; }
 };
@@ -155,6 +187,11 @@ MidiDriver_MT32::MidiDriver_MT32(Audio::Mixer *mixer) : MidiDriver_Emulated(mixe
 	_outputRate = 0;
 	_controlData = nullptr;
 	_pcmData = nullptr;
+	_deferRendering = false;
+	_blockStart = 0;
+	_blockFrames = 0;
+	_aheadBuffer = nullptr;
+	_aheadSize = _aheadReadPos = _aheadFill = 0;
 }
 
 MidiDriver_MT32::~MidiDriver_MT32() {
@@ -200,6 +237,13 @@ int MidiDriver_MT32::open() {
 
 	pcmFile.close();
 
+	// The float renderer suits CPUs with a fast FPU better, backends can
+	// make it their default
+	if (ConfMan.get("mt32_renderer") == "float")
+		_service.selectRendererType(MT32Emu::RendererType_FLOAT);
+	else
+		_service.selectRendererType(MT32Emu::RendererType_BIT16S);
+
 	if (_service.openSynth() != MT32EMU_RC_OK)
 		return MERR_DEVICE_NOT_AVAILABLE;
 
@@ -220,6 +264,20 @@ int MidiDriver_MT32::open() {
 
 	MidiDriver_Emulated::open();
 
+	// Only one driver can render ahead, the timer callback is shared
+	const int renderAheadMillis = ConfMan.getInt("mt32_render_ahead");
+	if (renderAheadMillis > 0 && !s_renderingAhead) {
+		_aheadSize = MAX<uint>(_outputRate * renderAheadMillis / 1000, kRenderAheadChunkFrames) * 2;
+		_aheadBuffer = new int16[_aheadSize];
+		_aheadReadPos = _aheadFill = 0;
+
+		s_renderingAhead = g_system->getTimerManager()->installTimerProc(&renderAheadProc, kRenderAheadInterval, this, "MT32RenderAhead");
+		if (!s_renderingAhead) {
+			delete[] _aheadBuffer;
+			_aheadBuffer = nullptr;
+		}
+	}
+
 	_mixer->playStream(Audio::Mixer::kPlainSoundType, &_mixerSoundHandle, this, -1, Audio::Mixer::kMaxChannelVolume, 0, DisposeAfterUse::NO, true);
 
 	return 0;
@@ -227,9 +285,42 @@ int MidiDriver_MT32::open() {
 
 void MidiDriver_MT32::send(uint32 b) {
 	midiDriverCommonSend(b);
+	noteRenderCacheEvent();
 
 	Common::StackLock lock(_mutex);
-	_service.playMsg(b);
+	if (!_deferRendering || _service.playMsgAt(b, _blockStart + _blockFrames) != MT32EMU_RC_OK)
+		_service.playMsg(b);
+}
+
+void MidiDriver_MT32::playSysexDeferred(const byte *sysex, uint32 length) {
+	// Called with _mutex held
+	if (!_deferRendering || _service.playSysexAt(sysex, length, _blockStart + _blockFrames) != MT32EMU_RC_OK)
+		_service.playSysex(sysex, length);
+}
+
+void MidiDriver_MT32::writeSysex(byte device, const byte *data, uint32 length) {
+	// Called with _mutex held
+	if (!_deferRendering) {
+		_service.writeSysex(device, data, length);
+		return;
+	}
+
+	// Writes have no time of their own, so they are queued as DT1 messages
+	// to keep them in order with the rest. Direct writes skip the checksum
+	// test, so a valid checksum is computed rather than passed through.
+	byte *sysex = new byte[length + 7];
+	const byte header[] = { 0xF0, 0x41, device, 0x16, 0x12 };
+	memcpy(sysex, header, sizeof(header));
+	memcpy(sysex + sizeof(header), data, length);
+
+	byte checksum = 0;
+	for (uint32 i = 0; i < length; ++i)
+		checksum -= data[i];
+	sysex[length + 5] = checksum & 0x7F;
+	sysex[length + 6] = 0xF7;
+
+	playSysexDeferred(sysex, length + 7);
+	delete[] sysex;
 }
 
 // Indiana Jones and the Fate of Atlantis (including the demo) uses
@@ -239,15 +330,17 @@ void MidiDriver_MT32::setPitchBendRange(byte channel, uint range) {
 		warning("setPitchBendRange() called with range > 24: %d", range);
 	}
 	byte benderRangeSysex[4] = { 0, 0, 4, (uint8)range };
+	noteRenderCacheEvent(benderRangeSysex, 4);
 	Common::StackLock lock(_mutex);
-	_service.writeSysex(channel, benderRangeSysex, 4);
+	writeSysex(channel, benderRangeSysex, 4);
 }
 
 void MidiDriver_MT32::sysEx(const byte *msg, uint16 length) {
 	midiDriverCommonSysEx(msg, length);
+	noteRenderCacheEvent(msg, length);
 	if (msg[0] == 0xf0) {
 		Common::StackLock lock(_mutex);
-		_service.playSysex(msg, length);
+		playSysexDeferred(msg, length);
 	} else {
 		enum {
 			SYSEX_CMD_DT1 = 0x12,
@@ -256,7 +349,7 @@ void MidiDriver_MT32::sysEx(const byte *msg, uint16 length) {
 
 		if (msg[3] == SYSEX_CMD_DT1 || msg[3] == SYSEX_CMD_DAT) {
 			Common::StackLock lock(_mutex);
-			_service.writeSysex(msg[1], msg + 4, length - 5);
+			writeSysex(msg[1], msg + 4, length - 5);
 		} else {
 			warning("Unused sysEx command %d", msg[3]);
 		}
@@ -268,11 +361,21 @@ void MidiDriver_MT32::close() {
 		return;
 	_isOpen = false;
 
+	// Stop rendering ahead. Once removed, the timer callback no longer runs.
+	if (_aheadBuffer) {
+		g_system->getTimerManager()->removeTimerProc(&renderAheadProc);
+		s_renderingAhead = false;
+	}
+
 	// Detach the player callback handler
 	setTimerCallback(nullptr, nullptr);
 	// Detach the mixer callback handler
 	_mixer->stopHandle(_mixerSoundHandle);
 
+	delete[] _aheadBuffer;
+	_aheadBuffer = nullptr;
+	_aheadSize = _aheadReadPos = _aheadFill = 0;
+
 	Common::StackLock lock(_mutex);
 	_service.closeSynth();
 	_service.freeContext();
@@ -284,154 +387,133 @@ void MidiDriver_MT32::close() {
 
 void MidiDriver_MT32::generateSamples(int16 *data, int len) {
 	Common::StackLock lock(_mutex);
-	_service.renderBit16s(data, len);
+	if (_deferRendering)
+		_blockFrames += len;
+	else
+		_service.renderBit16s(data, len);
 }
 
-uint32 MidiDriver_MT32::property(int prop, uint32 param) {
-	switch (prop) {
-	case PROP_CHANNEL_MASK:
-		_channelMask = param & 0xFFFF;
-		return 1;
-	default:
-		break;
+void MidiDriver_MT32::renderBlock(int16 *data, int numSamples) {
+	{
+		Common::StackLock lock(_mutex);
+		_deferRendering = true;
+		_blockStart = _service.getInternalRenderedSampleCount();
+		_blockFrames = 0;
 	}
 
-	return 0;
+	// Run the callbacks, which only count the samples in generateSamples(),
+	// and render the block in finishBlock(). _mutex must not be held
+	// meanwhile, the callbacks lock engine mutexes which are held while
+	// sending from the main thread.
+	MidiDriver_Emulated::readBuffer(data, numSamples);
 }
 
-MidiChannel *MidiDriver_MT32::allocateChannel() {
-	MidiChannel_MT32 *chan;
-	uint i;
-
-	for (i = 0; i < ARRAYSIZE(_midiChannels); ++i) {
-		if (i == 9 || !(_channelMask & (1 << i)))
-			continue;
-		chan = &_midiChannels[i];
-		if (chan->allocate()) {
-			return chan;
-		}
-	}
-	return nullptr;
+void MidiDriver_MT32::finishBlock(int16 *data, int numSamples) {
+	// Events sent from now on are played right away, after this block
+	Common::StackLock lock(_mutex);
+	_deferRendering = false;
+	_service.renderBit16s(data, _blockFrames);
 }
 
-MidiChannel *MidiDriver_MT32::getPercussionChannel() {
-	return &_midiChannels[9];
+Common::String MidiDriver_MT32::getRenderCacheSettings() {
+	mt32emu_rom_info romInfo;
+	_service.getROMInfo(&romInfo);
+
+	return Common::String::format("mt32|%s|%d|%d|%s|%s|%s", _service.getLibraryVersionString(), _outputRate,
+		ConfMan.getInt("midi_gain"), ConfMan.get("mt32_renderer").c_str(),
+		romInfo.control_rom_sha1_digest ? romInfo.control_rom_sha1_digest : "",
+		romInfo.pcm_rom_sha1_digest ? romInfo.pcm_rom_sha1_digest : "");
 }
 
-// This code should be used when calling the timer callback from the mixer thread is undesirable.
-// Note that it results in less accurate timing.
-#if 0
-class MidiEvent_MT32 {
-public:
-	MidiEvent_MT32 *_next;
-	uint32 _msg; // 0xFFFFFFFF indicates a sysex message
-	byte *_data;
-	uint32 _len;
-
-	MidiEvent_MT32(uint32 msg, byte *data, uint32 len) {
-		_msg = msg;
-		if (len > 0) {
-			_data = new byte[len];
-			memcpy(_data, data, len);
-		}
-		_len = len;
-		_next = NULL;
+int MidiDriver_MT32::readBuffer(int16 *data, const int numSamples) {
+	if (!_aheadBuffer) {
+		renderBlock(data, numSamples);
+		return numSamples;
 	}
 
-	MidiEvent_MT32() {
-		if (_len > 0)
-			delete _data;
-	}
-};
+	Common::StackLock lock(_aheadMutex);
 
-class MidiDriver_ThreadedMT32 : public MidiDriver_MT32 {
-private:
-	OSystem::Mutex _eventMutex;
-	MidiEvent_MT32 *_events;
-	TimerManager::TimerProc _timer_proc;
+	const uint samples = MIN<uint>(numSamples, _aheadFill);
+	const uint first = MIN<uint>(samples, _aheadSize - _aheadReadPos);
+	memcpy(data, _aheadBuffer + _aheadReadPos, first * sizeof(int16));
+	memcpy(data + first, _aheadBuffer, (samples - first) * sizeof(int16));
+	_aheadReadPos = (_aheadReadPos + samples) % _aheadSize;
+	_aheadFill -= samples;
 
-	void pushMidiEvent(MidiEvent_MT32 *event);
-	MidiEvent_MT32 *popMidiEvent();
+	// Waiting for the timer could deadlock, as the callbacks it runs may
+	// lock the mixer. Dropping out is the lesser evil.
+	if (samples < (uint)numSamples) {
+		memset(data + samples, 0, (numSamples - samples) * sizeof(int16));
+		debug(5, "MT-32 emulator: Rendering ahead fell behind by %d samples", numSamples - samples);
+	}
 
-protected:
-	void send(uint32 b);
-	void sysEx(const byte *msg, uint16 length);
+	return numSamples;
+}
 
-public:
-	MidiDriver_ThreadedMT32(Audio::Mixer *mixer);
+bool MidiDriver_MT32::renderAhead() {
+	uint frames;
+	{
+		Common::StackLock lock(_aheadMutex);
+		frames = MIN<uint>((_aheadSize - _aheadFill) / 2, kRenderAheadChunkFrames);
+	}
 
-	void onTimer();
-	void close();
-	void setTimerCallback(void *timer_param, TimerManager::TimerProc timer_proc);
-};
+	if (!frames)
+		return false;
 
+	// Samples can only be taken out in the meantime, so the space is still
+	// there afterwards
+	int16 chunk[kRenderAheadChunkFrames * 2];
+	renderBlock(chunk, frames * 2);
 
-MidiDriver_ThreadedMT32::MidiDriver_ThreadedMT32(Audio::Mixer *mixer) : MidiDriver_MT32(mixer) {
-	_events = NULL;
-	_timer_proc = NULL;
-}
+	Common::StackLock lock(_aheadMutex);
+	const uint samples = frames * 2;
+	const uint writePos = (_aheadReadPos + _aheadFill) % _aheadSize;
+	const uint first = MIN<uint>(samples, _aheadSize - writePos);
+	memcpy(_aheadBuffer + writePos, chunk, first * sizeof(int16));
+	memcpy(_aheadBuffer, chunk + first, (samples - first) * sizeof(int16));
+	_aheadFill += samples;
 
-void MidiDriver_ThreadedMT32::close() {
-	MidiDriver_MT32::close();
-	while ((popMidiEvent() != NULL)) {
-		// Just eat any leftover events
-	}
+	return true;
 }
 
-void MidiDriver_ThreadedMT32::setTimerCallback(void *timer_param, TimerManager::TimerProc timer_proc) {
-	if (!_timer_proc || !timer_proc) {
-		if (_timer_proc)
-			_vm->_timer->removeTimerProc(_timer_proc);
-		_timer_proc = timer_proc;
-		if (timer_proc)
-			_vm->_timer->installTimerProc(timer_proc, getBaseTempo(), timer_param, "MT32tempo");
-	}
+void MidiDriver_MT32::renderAheadProc(void *refCon) {
+	// Like with hardware MIDI devices, the player callbacks now run from the
+	// timer, without the mixer mutex held
+	MidiDriver_MT32 *driver = static_cast<MidiDriver_MT32 *>(refCon);
+	while (driver->renderAhead())
+		;
 }
 
-void MidiDriver_ThreadedMT32::pushMidiEvent(MidiEvent_MT32 *event) {
-	Common::StackLock lock(_eventMutex);
-	if (_events == NULL) {
-		_events = event;
-	} else {
-		MidiEvent_MT32 *last = _events;
-		while (last->_next != NULL)
-			last = last->_next;
-		last->_next = event;
+uint32 MidiDriver_MT32::property(int prop, uint32 param) {
+	switch (prop) {
+	case PROP_CHANNEL_MASK:
+		_channelMask = param & 0xFFFF;
+		return 1;
+	default:
+		break;
 	}
-}
-
-MidiEvent_MT32 *MidiDriver_ThreadedMT32::popMidiEvent() {
-	Common::StackLock lock(_eventMutex);
-	MidiEvent_MT32 *event;
-	event = _events;
-	if (event != NULL)
-		_events = event->_next;
-	return event;
-}
 
-void MidiDriver_ThreadedMT32::send(uint32 b) {
-	MidiEvent_MT32 *event = new MidiEvent_MT32(b, NULL, 0);
-	pushMidiEvent(event);
+	return 0;
 }
 
-void MidiDriver_ThreadedMT32::sysEx(const byte *msg, uint16 length) {
-	MidiEvent_MT32 *event = new MidiEvent_MT32(0xFFFFFFFF, msg, length);
-	pushMidiEvent(event);
-}
+MidiChannel *MidiDriver_MT32::allocateChannel() {
+	MidiChannel_MT32 *chan;
+	uint i;
 
-void MidiDriver_ThreadedMT32::onTimer() {
-	MidiEvent_MT32 *event;
-	while ((event = popMidiEvent()) != NULL) {
-		if (event->_msg == 0xFFFFFFFF) {
-			MidiDriver_MT32::sysEx(event->_data, event->_len);
-		} else {
-			MidiDriver_MT32::send(event->_msg);
+	for (i = 0; i < ARRAYSIZE(_midiChannels); ++i) {
+		if (i == 9 || !(_channelMask & (1 << i)))
+			continue;
+		chan = &_midiChannels[i];
+		if (chan->allocate()) {
+			return chan;
 		}
-		delete event;
 	}
+	return nullptr;
 }
-#endif
 
+MidiChannel *MidiDriver_MT32::getPercussionChannel() {
+	return &_midiChannels[9];
+}
 
 // Plugin interface
 
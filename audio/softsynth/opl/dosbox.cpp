@@ -184,10 +184,14 @@ bool OPL::init() {
 }
 
 void OPL::reset() {
+	clearRegisterWrites();
 	init();
 }
 
 void OPL::write(int port, int val) {
+	if (queueRegisterWrite(port, val, true))
+		return;
+
 	if (port&1) {
 		switch (_type) {
 		case Config::kOpl2:
@@ -236,6 +240,9 @@ void OPL::write(int port, int val) {
 }
 
 void OPL::writeReg(int r, int v) {
+	if (queueRegisterWrite(r, v, false))
+		return;
+
 	int tempReg = 0;
 	switch (_type) {
 	case Config::kOpl2:
@@ -297,6 +304,13 @@ void OPL::dualWrite(uint8 index, uint8 reg, uint8 val) {
 	_emulator->WriteReg(fullReg, val);
 }
 
+void OPL::applyRegisterWrite(int a, int v, bool port) {
+	if (port)
+		write(a, v);
+	else
+		writeReg(a, v);
+}
+
 void OPL::generateSamples(int16 *buffer, int length) {
 	const uint bufferLength = 512;
 	int32 tempBuffer[bufferLength * 2];
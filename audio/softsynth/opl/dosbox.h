@@ -96,6 +96,7 @@ public:
 	bool isStereo() const { return _type != Config::kOpl2; }
 
 protected:
+	void applyRegisterWrite(int a, int v, bool port);
 	void generateSamples(int16 *buffer, int length);
 };
 
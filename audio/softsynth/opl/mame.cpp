@@ -64,17 +64,31 @@ bool OPL::init() {
 }
 
 void OPL::reset() {
+	clearRegisterWrites();
 	MAME::OPLResetChip(_opl);
 }
 
 void OPL::write(int a, int v) {
+	if (queueRegisterWrite(a, v, true))
+		return;
+
 	MAME::OPLWrite(_opl, a, v);
 }
 
 void OPL::writeReg(int r, int v) {
+	if (queueRegisterWrite(r, v, false))
+		return;
+
 	MAME::OPLWriteReg(_opl, r, v);
 }
 
+void OPL::applyRegisterWrite(int a, int v, bool port) {
+	if (port)
+		write(a, v);
+	else
+		writeReg(a, v);
+}
+
 void OPL::generateSamples(int16 *buffer, int length) {
 	MAME::YM3812UpdateOne(_opl, buffer, length);
 }
@@ -190,6 +190,7 @@ public:
 	bool isStereo() const { return false; }
 
 protected:
+	void applyRegisterWrite(int a, int v, bool port);
 	void generateSamples(int16 *buffer, int length);
 };
 
@@ -0,0 +1,79 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "audio/softsynth/opl/nuked.h"
+
+#if defined(SCUMMVM_NEON) && !defined(DISABLE_NUKED_OPL)
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace OPL {
+namespace NUKED {
+
+static FORCEINLINE int32_t horizontalSum(int32x4_t sum) {
+	int32x2_t half = vadd_s32(vget_low_s32(sum), vget_high_s32(sum));
+	half = vpadd_s32(half, half);
+	return vget_lane_s32(half, 0);
+}
+
+void OPL3_MixChannelsNEON(const int16_t *accm, const uint16_t *mask0, const uint16_t *mask1, int32_t *mix) {
+	int32x4_t sum0 = vdupq_n_s32(0);
+	int32x4_t sum1 = vdupq_n_s32(0);
+
+	for (int i = 0; i < OPL_MIX_LANES; i += 8) {
+		const int16x8_t out = vld1q_s16(accm + i);
+		const int16x8_t m0 = vreinterpretq_s16_u16(vld1q_u16(mask0 + i));
+		const int16x8_t m1 = vreinterpretq_s16_u16(vld1q_u16(mask1 + i));
+		// Pairs of 16-bit lanes are summed into 32 bits, exactly
+		sum0 = vpadalq_s16(sum0, vandq_s16(out, m0));
+		sum1 = vpadalq_s16(sum1, vandq_s16(out, m1));
+	}
+
+	mix[0] = horizontalSum(sum0);
+	mix[1] = horizontalSum(sum1);
+}
+
+} // End of namespace NUKED
+} // End of namespace OPL
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // defined(SCUMMVM_NEON) && !defined(DISABLE_NUKED_OPL)
@@ -0,0 +1,80 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "audio/softsynth/opl/nuked.h"
+
+#ifndef DISABLE_NUKED_OPL
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace OPL {
+namespace NUKED {
+
+static FORCEINLINE int32_t horizontalSum(__m128i sum) {
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+	sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_cvtsi128_si32(sum);
+}
+
+void OPL3_MixChannelsSSE2(const int16_t *accm, const uint16_t *mask0, const uint16_t *mask1, int32_t *mix) {
+	// Multiplying by one sums pairs of 16-bit lanes into 32 bits, exactly
+	const __m128i ones = _mm_set1_epi16(1);
+	__m128i sum0 = _mm_setzero_si128();
+	__m128i sum1 = _mm_setzero_si128();
+
+	for (int i = 0; i < OPL_MIX_LANES; i += 8) {
+		const __m128i out = _mm_loadu_si128((const __m128i *)(accm + i));
+		const __m128i m0 = _mm_loadu_si128((const __m128i *)(mask0 + i));
+		const __m128i m1 = _mm_loadu_si128((const __m128i *)(mask1 + i));
+		sum0 = _mm_add_epi32(sum0, _mm_madd_epi16(_mm_and_si128(out, m0), ones));
+		sum1 = _mm_add_epi32(sum1, _mm_madd_epi16(_mm_and_si128(out, m1), ones));
+	}
+
+	mix[0] = horizontalSum(sum0);
+	mix[1] = horizontalSum(sum1);
+}
+
+} // End of namespace NUKED
+} // End of namespace OPL
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
+
+#endif // !DISABLE_NUKED_OPL
@@ -977,6 +977,16 @@ static void OPL3_ChannelUpdateAlg(opl3_channel *channel)
     }
 }
 
+static void OPL3_ChannelUpdateMixMask(opl3_channel *channel)
+{
+    opl3_chip *chip = channel->chip;
+
+    chip->mixmask[0][channel->ch_num] = channel->cha;
+    chip->mixmask[1][channel->ch_num] = channel->chb;
+    chip->mixmask[2][channel->ch_num] = channel->chc;
+    chip->mixmask[3][channel->ch_num] = channel->chd;
+}
+
 static void OPL3_ChannelWriteC0(opl3_channel *channel, uint8_t data)
 {
     channel->fb = (data & 0x0e) >> 1;
@@ -1002,6 +1012,7 @@ static void OPL3_ChannelWriteC0(opl3_channel *channel, uint8_t data)
         channel->rightpan = channel->chb << 16;
     }
 #endif
+    OPL3_ChannelUpdateMixMask(channel);
 }
 
 #if OPL_ENABLE_STEREOEXT
@@ -1103,6 +1114,20 @@ static int16_t OPL3_ClipSample(int32_t sample)
     return (int16_t)sample;
 }
 
+static void OPL3_GatherChannels(opl3_chip *chip)
+{
+    opl3_channel *channel;
+    int16_t **out;
+    uint8_t ii;
+
+    for (ii = 0; ii < 18; ii++)
+    {
+        channel = &chip->channel[ii];
+        out = channel->out;
+        chip->mixaccm[ii] = *out[0] + *out[1] + *out[2] + *out[3];
+    }
+}
+
 static void OPL3_ProcessSlot(opl3_slot *slot)
 {
     OPL3_SlotCalcFB(slot);
@@ -1133,18 +1158,28 @@ inline void OPL3_Generate4Ch(opl3_chip *chip, int16_t *buf4)
         OPL3_ProcessSlot(&chip->slot[ii]);
     }
 
-    mix[0] = mix[1] = 0;
-    for (ii = 0; ii < 18; ii++)
+#if !OPL_ENABLE_STEREOEXT
+    if (chip->mixfunc)
     {
-        channel = &chip->channel[ii];
-        out = channel->out;
-        accm = *out[0] + *out[1] + *out[2] + *out[3];
+        OPL3_GatherChannels(chip);
+        chip->mixfunc(chip->mixaccm, chip->mixmask[0], chip->mixmask[2], mix);
+    }
+    else
+#endif
+    {
+        mix[0] = mix[1] = 0;
+        for (ii = 0; ii < 18; ii++)
+        {
+            channel = &chip->channel[ii];
+            out = channel->out;
+            accm = *out[0] + *out[1] + *out[2] + *out[3];
 #if OPL_ENABLE_STEREOEXT
-        mix[0] += (int16_t)((accm * channel->leftpan) >> 16);
+            mix[0] += (int16_t)((accm * channel->leftpan) >> 16);
 #else
-        mix[0] += (int16_t)(accm & channel->cha);
+            mix[0] += (int16_t)(accm & channel->cha);
 #endif
-        mix[1] += (int16_t)(accm & channel->chc);
+            mix[1] += (int16_t)(accm & channel->chc);
+        }
     }
     chip->mixbuff[0] = mix[0];
     chip->mixbuff[2] = mix[1];
@@ -1166,18 +1201,28 @@ inline void OPL3_Generate4Ch(opl3_chip *chip, int16_t *buf4)
     }
 #endif
 
-    mix[0] = mix[1] = 0;
-    for (ii = 0; ii < 18; ii++)
+#if !OPL_ENABLE_STEREOEXT
+    if (chip->mixfunc)
     {
-        channel = &chip->channel[ii];
-        out = channel->out;
-        accm = *out[0] + *out[1] + *out[2] + *out[3];
+        OPL3_GatherChannels(chip);
+        chip->mixfunc(chip->mixaccm, chip->mixmask[1], chip->mixmask[3], mix);
+    }
+    else
+#endif
+    {
+        mix[0] = mix[1] = 0;
+        for (ii = 0; ii < 18; ii++)
+        {
+            channel = &chip->channel[ii];
+            out = channel->out;
+            accm = *out[0] + *out[1] + *out[2] + *out[3];
 #if OPL_ENABLE_STEREOEXT
-        mix[0] += (int16_t)((accm * channel->rightpan) >> 16);
+            mix[0] += (int16_t)((accm * channel->rightpan) >> 16);
 #else
-        mix[0] += (int16_t)(accm & channel->chb);
- #endif
-        mix[1] += (int16_t)(accm & channel->chd);
+            mix[0] += (int16_t)(accm & channel->chb);
+#endif
+            mix[1] += (int16_t)(accm & channel->chd);
+        }
     }
     chip->mixbuff[1] = mix[0];
     chip->mixbuff[3] = mix[1];
@@ -1342,6 +1387,7 @@ void OPL3_Reset(opl3_chip *chip, uint32_t samplerate)
         channel->rightpan = 0x10000;
 #endif
         channel->ch_num = channum;
+        OPL3_ChannelUpdateMixMask(channel);
         OPL3_ChannelSetupAlg(channel);
     }
     chip->noise = 1;
@@ -1532,7 +1578,32 @@ void OPL3_GenerateStream(opl3_chip *chip, int16_t *sndptr, uint32_t numsamples)
     }
 }
 
-OPL::OPL(Config::OplType type) : _type(type), _rate(0) {
+/*
+ * SSE2 and NEON are part of the x86-64 and AArch64 baselines, elsewhere
+ * the backend has to be asked.
+ */
+opl3_mixfunc OPL3_GetSIMDMixFunc()
+{
+#if defined(SCUMMVM_SSE2) && (defined(__x86_64__) || defined(_M_X64))
+    return OPL3_MixChannelsSSE2;
+#elif defined(SCUMMVM_NEON) && defined(__aarch64__)
+    return OPL3_MixChannelsNEON;
+#else
+    if (!g_system)
+        return nullptr;
+#ifdef SCUMMVM_SSE2
+    if (g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+        return OPL3_MixChannelsSSE2;
+#endif
+#ifdef SCUMMVM_NEON
+    if (g_system->hasFeature(OSystem::kFeatureCpuNEON))
+        return OPL3_MixChannelsNEON;
+#endif
+    return nullptr;
+#endif
+}
+
+OPL::OPL(Config::OplType type, bool simd) : _type(type), _rate(0), _simd(simd) {
 }
 
 OPL::~OPL() {
@@ -1541,7 +1612,7 @@ OPL::~OPL() {
 
 bool OPL::init() {
 	_rate = g_system->getMixer()->getOutputRate();
-	OPL3_Reset(&chip, _rate);
+	resetChip();
 
 	if (_type == Config::kDualOpl2) {
 		OPL3_WriteReg(&chip, 0x105, 0x01);
@@ -1551,10 +1622,19 @@ bool OPL::init() {
 }
 
 void OPL::reset() {
+	clearRegisterWrites();
+	resetChip();
+}
+
+void OPL::resetChip() {
 	OPL3_Reset(&chip, _rate);
+	chip.mixfunc = _simd ? OPL3_GetSIMDMixFunc() : nullptr;
 }
 
 void OPL::write(int port, int val) {
+	if (queueRegisterWrite(port, val, true))
+		return;
+
 	if (port & 1) {
 		switch (_type) {
 		case Config::kOpl2:
@@ -1603,6 +1683,9 @@ void OPL::write(int port, int val) {
 
 
 void OPL::writeReg(int r, int v) {
+	if (queueRegisterWrite(r, v, false))
+		return;
+
 	OPL3_WriteRegBuffered(&chip, (uint16_t)r, (uint8_t)v);
 }
 
@@ -1626,8 +1709,15 @@ void OPL::dualWrite(uint8 index, uint8 reg, uint8 val) {
 	OPL3_WriteRegBuffered(&chip, (uint16_t)fullReg, (uint8_t)val);
 }
 
+void OPL::applyRegisterWrite(int a, int v, bool port) {
+	if (port)
+		write(a, v);
+	else
+		writeReg(a, v);
+}
+
 void OPL::generateSamples(int16*buffer, int length) {
-	OPL3_GenerateStream(&chip, (int16_t*)buffer, (uint16_t)length / 2);
+	OPL3_GenerateStream(&chip, (int16_t*)buffer, (uint32_t)length / 2);
 }
 
 }
@@ -41,6 +41,9 @@
 #define OPL_WRITEBUF_SIZE   1024
 #define OPL_WRITEBUF_DELAY  2
 
+/* Channels padded to a multiple of 8 for the vectorized mixing */
+#define OPL_MIX_LANES       24
+
 namespace OPL {
 namespace NUKED {
 
@@ -48,6 +51,12 @@ typedef struct _opl3_slot opl3_slot;
 typedef struct _opl3_channel opl3_channel;
 typedef struct _opl3_chip opl3_chip;
 
+/*
+ * Sums the masked channel outputs for both outputs of one side, like the
+ * mixing loops of OPL3_Generate4Ch.
+ */
+typedef void (*opl3_mixfunc)(const int16_t *accm, const uint16_t *mask0, const uint16_t *mask1, int32_t *mix);
+
 struct _opl3_slot {
     opl3_channel *channel;
     opl3_chip *chip;
@@ -151,6 +160,11 @@ struct _opl3_chip {
     uint32_t writebuf_last;
     uint64_t writebuf_lasttime;
     opl3_writebuf writebuf[OPL_WRITEBUF_SIZE];
+
+    /* Vectorized channel mixing, when mixfunc is set */
+    opl3_mixfunc mixfunc;
+    int16_t mixaccm[OPL_MIX_LANES];
+    uint16_t mixmask[4][OPL_MIX_LANES];
 };
 
 void OPL3_Generate(opl3_chip *chip, int16_t *buf);
@@ -164,16 +178,35 @@ void OPL3_Generate4Ch(opl3_chip *chip, int16_t *buf4);
 void OPL3_Generate4ChResampled(opl3_chip *chip, int16_t *buf4);
 void OPL3_Generate4ChStream(opl3_chip *chip, int16_t *sndptr1, int16_t *sndptr2, uint32_t numsamples);
 
+/*
+ * Returns the vectorized channel mixing for the CPU, or nullptr if there is
+ * none. Its output is identical to that of the scalar code.
+ */
+opl3_mixfunc OPL3_GetSIMDMixFunc();
+
+#ifdef SCUMMVM_SSE2
+void OPL3_MixChannelsSSE2(const int16_t *accm, const uint16_t *mask0, const uint16_t *mask1, int32_t *mix);
+#endif
+#ifdef SCUMMVM_NEON
+void OPL3_MixChannelsNEON(const int16_t *accm, const uint16_t *mask0, const uint16_t *mask1, int32_t *mix);
+#endif
+
 class OPL : public ::OPL::OPL, public Audio::EmulatedChip {
 private:
 	Config::OplType _type;
 	uint _rate;
+	bool _simd;
 	opl3_chip chip;
 	uint address[2];
 	void dualWrite(uint8 index, uint8 reg, uint8 val);
+	void resetChip();
 
 public:
-	OPL(Config::OplType type);
+	/**
+	 * @param simd  Whether to use the vectorized variant of the emulator,
+	 *              where the CPU supports it.
+	 */
+	OPL(Config::OplType type, bool simd = false);
 	~OPL();
 
 	bool init();
@@ -186,6 +219,7 @@ public:
 	bool isStereo() const { return true; }
 
 protected:
+	void applyRegisterWrite(int a, int v, bool port);
 	void generateSamples(int16 *buffer, int length);
 };
 
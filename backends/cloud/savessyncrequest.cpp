@@ -35,9 +35,40 @@
 
 namespace Cloud {
 
+namespace {
+
+/** The number of transfers done at the same time, unless configured. */
+const uint32 kDefaultTransfers = 4;
+
+/** The number of finished transfers after which the timestamps are saved. */
+const uint32 kTimestampsSaveInterval = 16;
+
+/**
+ * A callback to a SavesSyncRequest method that also gets the name of the
+ * file the transfer is for, since several run at the same time.
+ */
+template<typename R>
+class TransferCallback : public Common::BaseCallback<const R &> {
+	typedef void (SavesSyncRequest::*Method)(const Common::String &, const R &);
+
+	SavesSyncRequest *_object;
+	Method _method;
+	Common::String _name;
+
+public:
+	TransferCallback(SavesSyncRequest *object, Method method, const Common::String &name) :
+		_object(object), _method(method), _name(name) {}
+
+	void operator()(const R &data) override {
+		(_object->*_method)(_name, data);
+	}
+};
+
+} // End of anonymous namespace
+
 SavesSyncRequest::SavesSyncRequest(Storage *storage, Storage::BoolCallback callback, Networking::ErrorCallback ecb):
-	Request(nullptr, ecb), _storage(storage), _boolCallback(callback),
-	_workingRequest(nullptr), _ignoreCallback(false), _bytesToDownload(0), _bytesDownloaded(0) {
+	Request(nullptr, ecb), _storage(storage), _boolCallback(callback), _maxTransfers(kDefaultTransfers),
+	_unsavedTimestamps(0), _workingRequest(nullptr), _ignoreCallback(false), _bytesToDownload(0), _bytesDownloaded(0) {
 	start();
 }
 
@@ -45,6 +76,7 @@ SavesSyncRequest::~SavesSyncRequest() {
 	_ignoreCallback = true;
 	if (_workingRequest)
 		_workingRequest->finish();
+	stopTransfers();
 	delete _boolCallback;
 }
 
@@ -53,14 +85,18 @@ void SavesSyncRequest::start() {
 	_ignoreCallback = true;
 	if (_workingRequest)
 		_workingRequest->finish();
-	_currentDownloadingFile = StorageFile();
-	_currentUploadingFile = "";
+	stopTransfers();
 	_filesToDownload.clear();
 	_filesToUpload.clear();
 	_localFilesTimestamps.clear();
+	_unsavedTimestamps = 0;
 	_totalFilesToHandle = 0;
 	_ignoreCallback = false;
 
+	_maxTransfers = kDefaultTransfers;
+	if (ConfMan.hasKey("sync_transfers", ConfMan.kCloudDomain))
+		_maxTransfers = CLIP<int>(ConfMan.getInt("sync_transfers", ConfMan.kCloudDomain), 1, 16);
+
 	//load timestamps
 	_localFilesTimestamps = DefaultSaveFileManager::loadTimestamps();
 
@@ -162,12 +198,7 @@ void SavesSyncRequest::directoryListedCallback(const Storage::ListDirectoryRespo
 	}
 	_totalFilesToHandle = _filesToDownload.size() + _filesToUpload.size();
 
-	// Start downloading files
-	if (!_filesToDownload.empty()) {
-		downloadNextFile();
-	} else {
-		uploadNextFile();
-	}
+	startTransfers();
 }
 
 void SavesSyncRequest::directoryListedErrorCallback(const Networking::ErrorResponse &error) {
@@ -271,104 +302,185 @@ void SavesSyncRequest::directoryCreatedErrorCallback(const Networking::ErrorResp
 	finishError(error);
 }
 
-void SavesSyncRequest::downloadNextFile() {
-	if (_filesToDownload.empty()) {
-		_currentDownloadingFile = StorageFile("", 0, 0, false); //so getFilesToDownload() would return an empty array
-		uploadNextFile();
+void SavesSyncRequest::startTransfers() {
+	// All files are downloaded before anything is uploaded, like they were
+	// when this did one transfer at a time
+	while (_state != Networking::FINISHED && _downloads.size() < _maxTransfers && !_filesToDownload.empty()) {
+		const StorageFile file = _filesToDownload.back();
+		_filesToDownload.pop_back();
+		startDownload(file);
+	}
+
+	if (_state == Networking::FINISHED || !_downloads.empty())
 		return;
+
+	while (_state != Networking::FINISHED && _uploads.size() < _maxTransfers && !_filesToUpload.empty()) {
+		const Common::String name = _filesToUpload.back();
+		_filesToUpload.pop_back();
+		startUpload(name);
 	}
 
-	_currentDownloadingFile = _filesToDownload.back();
-	_filesToDownload.pop_back();
+	if (_state != Networking::FINISHED && _uploads.empty())
+		finishSync(true);
+}
+
+void SavesSyncRequest::startDownload(const StorageFile &file) {
+	debug(9, "\nSavesSyncRequest: downloading %s (%d %%)", file.name().c_str(), (int)(getProgress() * 100));
 
-	debug(9, "\nSavesSyncRequest: downloading %s (%d %%)", _currentDownloadingFile.name().c_str(), (int)(getProgress() * 100));
-	_workingRequest = _storage->downloadById(
-		_currentDownloadingFile.id(),
-		DefaultSaveFileManager::concatWithSavesPath(_currentDownloadingFile.name()),
-		new Common::Callback<SavesSyncRequest, const Storage::BoolResponse &>(this, &SavesSyncRequest::fileDownloadedCallback),
-		new Common::Callback<SavesSyncRequest, const Networking::ErrorResponse &>(this, &SavesSyncRequest::fileDownloadedErrorCallback)
+	// The transfer is registered first, in case the callback comes right away
+	_downloads.push_back(Transfer(file));
+	Request *request = _storage->downloadById(
+		file.id(),
+		DefaultSaveFileManager::concatWithSavesPath(file.name()),
+		new TransferCallback<Storage::BoolResponse>(this, &SavesSyncRequest::fileDownloadedCallback, file.name()),
+		new TransferCallback<Networking::ErrorResponse>(this, &SavesSyncRequest::fileDownloadedErrorCallback, file.name())
 	);
-	if (!_workingRequest)
-		finishError(Networking::ErrorResponse(this, "SavesSyncRequest::downloadNextFile: Storage couldn't create Request to download a file"));
+	if (!request) {
+		removeTransfer(_downloads, file.name());
+		finishError(Networking::ErrorResponse(this, "SavesSyncRequest::startDownload: Storage couldn't create Request to download a file"));
+		return;
+	}
+
+	for (auto &transfer : _downloads) {
+		if (transfer.file.name() == file.name())
+			transfer.request = request;
+	}
 }
 
-void SavesSyncRequest::fileDownloadedCallback(const Storage::BoolResponse &response) {
-	_workingRequest = nullptr;
+void SavesSyncRequest::startUpload(const Common::String &name) {
+	debug(9, "\nSavesSyncRequest: uploading %s (%d %%)", name.c_str(), (int)(getProgress() * 100));
+
+	_uploads.push_back(Transfer(StorageFile(name, 0, 0, false)));
+	Request *request;
+	if (_storage->uploadStreamSupported()) {
+		request = _storage->upload(
+			_storage->savesDirectoryPath() + name,
+			g_system->getSavefileManager()->openRawFile(name),
+			new TransferCallback<Storage::UploadResponse>(this, &SavesSyncRequest::fileUploadedCallback, name),
+			new TransferCallback<Networking::ErrorResponse>(this, &SavesSyncRequest::fileUploadedErrorCallback, name)
+		);
+	} else {
+		request = _storage->upload(
+			_storage->savesDirectoryPath() + name,
+			DefaultSaveFileManager::concatWithSavesPath(name),
+			new TransferCallback<Storage::UploadResponse>(this, &SavesSyncRequest::fileUploadedCallback, name),
+			new TransferCallback<Networking::ErrorResponse>(this, &SavesSyncRequest::fileUploadedErrorCallback, name)
+		);
+	}
+	if (!request) {
+		removeTransfer(_uploads, name);
+		finishError(Networking::ErrorResponse(this, "SavesSyncRequest::startUpload: Storage couldn't create Request to upload a file"));
+		return;
+	}
+
+	for (auto &transfer : _uploads) {
+		if (transfer.file.name() == name)
+			transfer.request = request;
+	}
+}
+
+bool SavesSyncRequest::removeTransfer(Common::Array<Transfer> &transfers, const Common::String &name, Transfer *transfer) {
+	for (uint32 i = 0; i < transfers.size(); ++i) {
+		if (transfers[i].file.name() == name) {
+			if (transfer)
+				*transfer = transfers[i];
+			transfers.remove_at(i);
+			return true;
+		}
+	}
+	return false;
+}
+
+void SavesSyncRequest::stopTransfers() {
+	// Finishing the requests calls their callbacks, which should be ignored
+	const bool ignoreCallback = _ignoreCallback;
+	_ignoreCallback = true;
+	for (auto &transfer : _downloads) {
+		if (transfer.request)
+			transfer.request->finish();
+	}
+	for (auto &transfer : _uploads) {
+		if (transfer.request)
+			transfer.request->finish();
+	}
+	_ignoreCallback = ignoreCallback;
+
+	_downloads.clear();
+	_uploads.clear();
+}
+
+void SavesSyncRequest::updateTimestamp(const Common::String &name, uint32 timestamp) {
+	_localFilesTimestamps[name] = timestamp;
+
+	// Losing some of them only means transferring these files again
+	if (++_unsavedTimestamps >= kTimestampsSaveInterval)
+		saveTimestamps();
+}
+
+void SavesSyncRequest::saveTimestamps() {
+	if (!_unsavedTimestamps)
+		return;
+
+	_unsavedTimestamps = 0;
+	DefaultSaveFileManager::saveTimestamps(_localFilesTimestamps);
+}
+
+void SavesSyncRequest::fileDownloadedCallback(const Common::String &name, const Storage::BoolResponse &response) {
 	if (_ignoreCallback)
 		return;
 
+	Transfer transfer;
+	if (!removeTransfer(_downloads, name, &transfer))
+		return;
+
 	//stop syncing if download failed
 	if (!response.value) {
 		//delete the incomplete file
-		g_system->getSavefileManager()->removeSavefile(_currentDownloadingFile.name());
+		g_system->getSavefileManager()->removeSavefile(name);
 		finishError(Networking::ErrorResponse(this, false, true, "SavesSyncRequest::fileDownloadedCallback: failed to download a file", -1));
 		return;
 	}
 
 	//update local timestamp for downloaded file
-	_localFilesTimestamps[_currentDownloadingFile.name()] = _currentDownloadingFile.timestamp();
-	DefaultSaveFileManager::saveTimestamps(_localFilesTimestamps);
-	_bytesDownloaded += _currentDownloadingFile.size();
+	updateTimestamp(name, transfer.file.timestamp());
+	_bytesDownloaded += transfer.file.size();
 
 	//continue downloading files
-	downloadNextFile();
+	startTransfers();
 }
 
-void SavesSyncRequest::fileDownloadedErrorCallback(const Networking::ErrorResponse &error) {
-	_workingRequest = nullptr;
+void SavesSyncRequest::fileDownloadedErrorCallback(const Common::String &name, const Networking::ErrorResponse &error) {
 	if (_ignoreCallback)
 		return;
 
+	//delete the incomplete file
+	if (removeTransfer(_downloads, name))
+		g_system->getSavefileManager()->removeSavefile(name);
+
 	//stop syncing if download failed
 	finishError(error);
 }
 
-void SavesSyncRequest::uploadNextFile() {
-	if (_filesToUpload.empty()) {
-		finishSync(true);
+void SavesSyncRequest::fileUploadedCallback(const Common::String &name, const Storage::UploadResponse &response) {
+	if (_ignoreCallback)
 		return;
-	}
-
-	_currentUploadingFile = _filesToUpload.back();
-	_filesToUpload.pop_back();
-
-	debug(9, "\nSavesSyncRequest: uploading %s (%d %%)", _currentUploadingFile.c_str(), (int)(getProgress() * 100));
-	if (_storage->uploadStreamSupported()) {
-		_workingRequest = _storage->upload(
-			_storage->savesDirectoryPath() + _currentUploadingFile,
-			g_system->getSavefileManager()->openRawFile(_currentUploadingFile),
-			new Common::Callback<SavesSyncRequest, const Storage::UploadResponse &>(this, &SavesSyncRequest::fileUploadedCallback),
-			new Common::Callback<SavesSyncRequest, const Networking::ErrorResponse &>(this, &SavesSyncRequest::fileUploadedErrorCallback)
-		);
-	} else {
-		_workingRequest = _storage->upload(
-			_storage->savesDirectoryPath() + _currentUploadingFile,
-			DefaultSaveFileManager::concatWithSavesPath(_currentUploadingFile),
-			new Common::Callback<SavesSyncRequest, const Storage::UploadResponse &>(this, &SavesSyncRequest::fileUploadedCallback),
-			new Common::Callback<SavesSyncRequest, const Networking::ErrorResponse &>(this, &SavesSyncRequest::fileUploadedErrorCallback)
-		);
-	}
-	if (!_workingRequest) finishError(Networking::ErrorResponse(this, "SavesSyncRequest::uploadNextFile: Storage couldn't create Request to upload a file"));
-}
 
-void SavesSyncRequest::fileUploadedCallback(const Storage::UploadResponse &response) {
-	_workingRequest = nullptr;
-	if (_ignoreCallback)
+	if (!removeTransfer(_uploads, name))
 		return;
 
 	//update local timestamp for the uploaded file
-	_localFilesTimestamps[_currentUploadingFile] = response.value.timestamp();
-	DefaultSaveFileManager::saveTimestamps(_localFilesTimestamps);
+	updateTimestamp(name, response.value.timestamp());
 
 	//continue uploading files
-	uploadNextFile();
+	startTransfers();
 }
 
-void SavesSyncRequest::fileUploadedErrorCallback(const Networking::ErrorResponse &error) {
-	_workingRequest = nullptr;
+void SavesSyncRequest::fileUploadedErrorCallback(const Common::String &name, const Networking::ErrorResponse &error) {
 	if (_ignoreCallback)
 		return;
 
+	removeTransfer(_uploads, name);
+
 	//stop syncing if upload failed
 	finishError(error);
 }
@@ -384,7 +496,7 @@ double SavesSyncRequest::getDownloadingProgress() const {
 		return 0; //directory not listed yet
 	}
 
-	if (_totalFilesToHandle == _filesToUpload.size())
+	if (_totalFilesToHandle == _filesToUpload.size() + _uploads.size())
 		return 1; //nothing to download => download complete
 
 	if (_bytesToDownload > 0) {
@@ -392,8 +504,8 @@ double SavesSyncRequest::getDownloadingProgress() const {
 		return (double)(getDownloadedBytes()) / (double)(_bytesToDownload);
 	}
 
-	uint32 totalFilesToDownload = _totalFilesToHandle - _filesToUpload.size();
-	uint32 filesLeftToDownload = _filesToDownload.size() + (_currentDownloadingFile.name() != "" ? 1 : 0);
+	uint32 totalFilesToDownload = _totalFilesToHandle - _filesToUpload.size() - _uploads.size();
+	uint32 filesLeftToDownload = _filesToDownload.size() + _downloads.size();
 	if (filesLeftToDownload > totalFilesToDownload)
 		filesLeftToDownload = totalFilesToDownload;
 	return (double)(totalFilesToDownload - filesLeftToDownload) / (double)(totalFilesToDownload);
@@ -403,8 +515,8 @@ void SavesSyncRequest::getDownloadingInfo(Storage::SyncDownloadingInfo &info) co
 	info.bytesDownloaded = getDownloadedBytes();
 	info.bytesToDownload = getBytesToDownload();
 
-	uint32 totalFilesToDownload = _totalFilesToHandle - _filesToUpload.size();
-	uint32 filesLeftToDownload = _filesToDownload.size() + (_currentDownloadingFile.name() != "" ? 1 : 0);
+	uint32 totalFilesToDownload = _totalFilesToHandle - _filesToUpload.size() - _uploads.size();
+	uint32 filesLeftToDownload = _filesToDownload.size() + _downloads.size();
 	if (filesLeftToDownload > totalFilesToDownload)
 		filesLeftToDownload = totalFilesToDownload;
 	info.filesDownloaded = totalFilesToDownload - filesLeftToDownload;
@@ -427,19 +539,23 @@ Common::Array<Common::String> SavesSyncRequest::getFilesToDownload() {
 	Common::Array<Common::String> result;
 	for (uint32 i = 0; i < _filesToDownload.size(); ++i)
 		result.push_back(_filesToDownload[i].name());
-	if (_currentDownloadingFile.name() != "")
-		result.push_back(_currentDownloadingFile.name());
+	for (uint32 i = 0; i < _downloads.size(); ++i)
+		result.push_back(_downloads[i].file.name());
 	return result;
 }
 
 uint32 SavesSyncRequest::getDownloadedBytes() const {
-	double currentFileProgress = 0;
-	if (const DownloadRequest *downloadRequest = dynamic_cast<DownloadRequest *>(_workingRequest))
-		currentFileProgress = downloadRequest->getProgress();
-	else if (const Id::IdDownloadRequest *idDownloadRequest = dynamic_cast<Id::IdDownloadRequest *>(_workingRequest))
-		currentFileProgress = idDownloadRequest->getProgress();
+	double downloadingBytes = 0;
+	for (const auto &transfer : _downloads) {
+		double fileProgress = 0;
+		if (const DownloadRequest *downloadRequest = dynamic_cast<DownloadRequest *>(transfer.request))
+			fileProgress = downloadRequest->getProgress();
+		else if (const Id::IdDownloadRequest *idDownloadRequest = dynamic_cast<Id::IdDownloadRequest *>(transfer.request))
+			fileProgress = idDownloadRequest->getProgress();
+		downloadingBytes += fileProgress * transfer.file.size();
+	}
 
-	return _bytesDownloaded + currentFileProgress * _currentDownloadingFile.size();
+	return _bytesDownloaded + downloadingBytes;
 }
 
 uint32 SavesSyncRequest::getBytesToDownload() const {
@@ -448,9 +564,11 @@ uint32 SavesSyncRequest::getBytesToDownload() const {
 
 void SavesSyncRequest::finishError(const Networking::ErrorResponse &error, Networking::RequestState state) {
 	debug(9, "SavesSync::finishError");
-	//if we were downloading a file - remember the name
-	//and make the Request close() it, so we can delete it
-	Common::String name = _currentDownloadingFile.name();
+	//if we were downloading files - remember the names
+	//and make the Requests close() them, so we can delete them
+	Common::Array<Common::String> names;
+	for (uint32 i = 0; i < _downloads.size(); ++i)
+		names.push_back(_downloads[i].file.name());
 	if (_workingRequest) {
 		_ignoreCallback = true;
 		_workingRequest->finish();
@@ -458,15 +576,18 @@ void SavesSyncRequest::finishError(const Networking::ErrorResponse &error, Netwo
 		_ignoreCallback = false;
 	}
 	//unlock all the files by making getFilesToDownload() return empty array
-	_currentDownloadingFile = StorageFile();
+	stopTransfers();
 	_filesToDownload.clear();
-	//delete the incomplete file
-	if (name != "")
-		g_system->getSavefileManager()->removeSavefile(name);
+	_filesToUpload.clear();
+	//delete the incomplete files
+	for (uint32 i = 0; i < names.size(); ++i)
+		g_system->getSavefileManager()->removeSavefile(names[i]);
+	saveTimestamps();
 	Request::finishError(error);
 }
 
 void SavesSyncRequest::finishSync(bool success) {
+	saveTimestamps();
 	Request::finishSuccess();
 
 	//update last successful sync date
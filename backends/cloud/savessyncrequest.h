@@ -30,13 +30,24 @@
 namespace Cloud {
 
 class SavesSyncRequest: public Networking::Request {
+	/** A download or upload in progress. */
+	struct Transfer {
+		StorageFile file;
+		Request *request;
+
+		Transfer() : request(nullptr) {}
+		Transfer(const StorageFile &f) : file(f), request(nullptr) {}
+	};
+
 	Storage *_storage;
 	Storage::BoolCallback _boolCallback;
 	Common::HashMap<Common::String, uint32> _localFilesTimestamps;
 	Common::Array<StorageFile> _filesToDownload;
 	Common::Array<Common::String> _filesToUpload;
-	StorageFile _currentDownloadingFile;
-	Common::String _currentUploadingFile;
+	Common::Array<Transfer> _downloads;
+	Common::Array<Transfer> _uploads;
+	uint32 _maxTransfers;
+	uint32 _unsavedTimestamps;
 	Request *_workingRequest;
 	bool _ignoreCallback;
 	uint32 _totalFilesToHandle;
@@ -48,12 +59,17 @@ class SavesSyncRequest: public Networking::Request {
 	void directoryListedErrorCallback(const Networking::ErrorResponse &error);
 	void directoryCreatedCallback(const Storage::BoolResponse &response);
 	void directoryCreatedErrorCallback(const Networking::ErrorResponse &error);
-	void fileDownloadedCallback(const Storage::BoolResponse &response);
-	void fileDownloadedErrorCallback(const Networking::ErrorResponse &error);
-	void fileUploadedCallback(const Storage::UploadResponse &response);
-	void fileUploadedErrorCallback(const Networking::ErrorResponse &error);
-	void downloadNextFile();
-	void uploadNextFile();
+	void fileDownloadedCallback(const Common::String &name, const Storage::BoolResponse &response);
+	void fileDownloadedErrorCallback(const Common::String &name, const Networking::ErrorResponse &error);
+	void fileUploadedCallback(const Common::String &name, const Storage::UploadResponse &response);
+	void fileUploadedErrorCallback(const Common::String &name, const Networking::ErrorResponse &error);
+	void startTransfers();
+	void startDownload(const StorageFile &file);
+	void startUpload(const Common::String &name);
+	bool removeTransfer(Common::Array<Transfer> &transfers, const Common::String &name, Transfer *transfer = nullptr);
+	void stopTransfers();
+	void updateTimestamp(const Common::String &name, uint32 timestamp);
+	void saveTimestamps();
 	void finishError(const Networking::ErrorResponse &error, Networking::RequestState state = Networking::FINISHED) override;
 	void finishSync(bool success);
 
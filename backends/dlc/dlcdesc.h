@@ -46,7 +46,8 @@ public:
 	Common::String extra;
 	Common::String engineid;
 	Common::String guioptions;
-	uint32 size = 0;
+	uint64 size = 0;
+	uint64 downloadedSize = 0;
 	uint32 idx = 0;
 	State state = State::kAvailable;
 };
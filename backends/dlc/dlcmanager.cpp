@@ -19,6 +19,7 @@
  *
  */
 
+#include "common/config-manager.h"
 #include "common/system.h"
 
 #include "backends/dlc/dlcmanager.h"
@@ -36,6 +37,9 @@ DECLARE_SINGLETON(DLC::DLCManager);
 
 namespace DLC {
 
+// number of DLCs downloaded at the same time, unless configured
+static const uint32 kDefaultTransfers = 3;
+
 DLCManager::DLCManager() : CommandSender(nullptr) {
 	_store = g_system->getDLCStore();
 }
@@ -66,59 +70,92 @@ void DLCManager::setLauncher(GUI::LauncherDialog *launcher) {
 	_launcher = launcher;
 }
 
+uint32 DLCManager::getMaxTransfers() const {
+	if (ConfMan.hasKey("dlc_transfers"))
+		return CLIP<int>(ConfMan.getInt("dlc_transfers"), 1, 8);
+	return kDefaultTransfers;
+}
+
 void DLCManager::addDownload(uint32 idx) {
 	if (_dlcs[idx]->state == DLCDesc::kInProgress) {
 		// if DLC is already in queue, don't add again
 		return;
 	}
 	_dlcs[idx]->state = DLCDesc::kInProgress;
+	_dlcs[idx]->downloadedSize = 0;
 	_queuedDownloadTasks.push(_dlcs[idx]);
 	_dlcsInProgress.push_back(_dlcs[idx]);
-	if (!_isDLCDownloading) {
-		// if queue is not already processing
-		DLCManager::processDownloadQueue();
-	}
+	processDownloadQueue();
 }
 
 void DLCManager::processDownloadQueue() {
-	_currentDownloadedSize = 0;
-	_isDLCDownloading = true;
-	if (!_queuedDownloadTasks.empty()) {
-		if (_queuedDownloadTasks.front()->state == DLCDesc::kInProgress) {
-			_currentDownloadingDLC = _queuedDownloadTasks.front()->id;
-			DLCManager::startDownloadAsync(_queuedDownloadTasks.front()->id, _queuedDownloadTasks.front()->url);
+	while (_activeDownloads.size() < getMaxTransfers() && !_queuedDownloadTasks.empty()) {
+		DLCDesc *dlc = _queuedDownloadTasks.pop();
+		if (dlc->state == DLCDesc::kInProgress) {
+			_activeDownloads.push_back(dlc);
+			startDownloadAsync(dlc->id, dlc->url);
 		} else {
 			// state is already cancelled/downloaded -> skip download
-			_queuedDownloadTasks.pop();
-			_dlcsInProgress.remove_at(0);
-			// process next download in the queue
-			processDownloadQueue();
+			downloadFinished(dlc);
 		}
-	} else {
-		// no more download in queue
-		_isDLCDownloading = false;
-		_currentDownloadingDLC = "";
 	}
 }
 
+void DLCManager::transferFinished(DLCDesc *dlc) {
+	for (uint32 i = 0; i < _activeDownloads.size(); ++i) {
+		if (_activeDownloads[i] == dlc) {
+			_activeDownloads.remove_at(i);
+			break;
+		}
+	}
+	// handle next download in the queue
+	processDownloadQueue();
+}
+
+void DLCManager::downloadFinished(DLCDesc *dlc) {
+	for (uint32 i = 0; i < _dlcsInProgress.size(); ++i) {
+		if (_dlcsInProgress[i] == dlc) {
+			_dlcsInProgress.remove_at(i);
+			break;
+		}
+	}
+	refreshDLCList();
+}
+
+uint64 DLCManager::getActiveDownloadedSize() const {
+	uint64 size = 0;
+	for (uint32 i = 0; i < _activeDownloads.size(); ++i)
+		size += _activeDownloads[i]->downloadedSize;
+	return size;
+}
+
+uint64 DLCManager::getActiveDownloadSize() const {
+	uint64 size = 0;
+	for (uint32 i = 0; i < _activeDownloads.size(); ++i)
+		size += _activeDownloads[i]->size;
+	return size;
+}
+
 void DLCManager::startDownloadAsync(const Common::String &id, const Common::String &url) {
 	_store->startDownloadAsync(id, url);
 }
 
 bool DLCManager::cancelDownload(uint32 idx) {
-	if (_queuedDownloadTasks.front()->idx == idx) {
-		// if already downloading, interrupt startDownloadAsync
-		_interruptCurrentDownload = true;
-	} else {
-		// if not started, skip it in processDownload()
-		_dlcs[idx]->state = DLCDesc::kCancelled;
-		DLCMan.refreshDLCList();
+	for (uint32 i = 0; i < _activeDownloads.size(); ++i) {
+		if (_activeDownloads[i]->idx == idx) {
+			// if already downloading, interrupt the transfer
+			_store->cancelDownload(_activeDownloads[i]->id);
+			return true;
+		}
 	}
+	// if not started, skip it in processDownloadQueue()
+	_dlcs[idx]->state = DLCDesc::kCancelled;
+	DLCMan.refreshDLCList();
 	return true;
 }
 
 Common::String DLCManager::getCurrentDownloadingDLC() const {
-	return _currentDownloadingDLC;
+	return _activeDownloads.empty() ? Common::String() : _activeDownloads[0]->id;
 }
 
 uint DLCManager::getDLCIdxFromId(const Common::String &id) const {
@@ -47,13 +47,13 @@ class DLCManager : public Common::Singleton<DLCManager>, public GUI::CommandSend
 	Store *_store;
 	GUI::LauncherDialog *_launcher;
 
-	bool _isDLCDownloading = false;
-	Common::String _currentDownloadingDLC;
+	// transfers running at the same time
+	Common::Array<DLCDesc*> _activeDownloads;
+
+	uint32 getMaxTransfers() const;
 
 public:
 	bool _fetchDLCs = false;
-	bool _interruptCurrentDownload = false;
-	uint32 _currentDownloadedSize;
 	Common::String _errorText;
 	Common::Array<DLCDesc*> _dlcs;
 	Common::Array<DLCDesc*> _dlcsInProgress;
@@ -80,6 +80,18 @@ public:
 
 	void processDownloadQueue();
 
+	// the store is done transferring the DLC, the next one in the queue may start
+	void transferFinished(DLCDesc *dlc);
+
+	// the DLC is downloaded and extracted, or has failed or was cancelled
+	void downloadFinished(DLCDesc *dlc);
+
+	const Common::Array<DLCDesc*> &getActiveDownloads() const { return _activeDownloads; }
+
+	uint64 getActiveDownloadedSize() const;
+
+	uint64 getActiveDownloadSize() const;
+
 	Common::String getCurrentDownloadingDLC() const;
 
 	uint getDLCIdxFromId(const Common::String &id) const;
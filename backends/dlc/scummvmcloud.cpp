@@ -27,10 +27,12 @@
 
 #include "common/archive.h"
 #include "common/compression/unzip.h"
+#include "common/concatstream.h"
 #include "common/file.h"
 #include "common/punycode.h"
 #include "common/config-manager.h"
 #include "common/formats/json.h"
+#include "common/timer.h"
 
 #include "gui/gui-manager.h"
 
@@ -44,6 +46,60 @@
 namespace DLC {
 namespace ScummVMCloud {
 
+namespace {
+
+// failed transfers restarted in a row before giving up
+const uint32 kMaxAttempts = 5;
+
+// bytes unpacked per timer tick
+const uint32 kExtractionBytesPerTick = 4 * 1024 * 1024;
+const uint32 kExtractionChunkSize = 256 * 1024;
+const int32 kExtractionTimerInterval = 50000;
+
+/**
+ * A callback to a ScummVMCloud method that also gets the id of the DLC
+ * the transfer is for, since several run at the same time.
+ */
+template<typename R>
+class DownloadCallback : public Common::BaseCallback<const R &> {
+	typedef void (ScummVMCloud::*Method)(const Common::String &, const R &);
+
+	ScummVMCloud *_object;
+	Method _method;
+	Common::String _id;
+
+public:
+	DownloadCallback(ScummVMCloud *object, Method method, const Common::String &id) :
+		_object(object), _method(method), _id(id) {}
+
+	void operator()(const R &data) override {
+		(_object->*_method)(_id, data);
+	}
+};
+
+void extractionTimer(void *refCon) {
+	((ScummVMCloud *)refCon)->handleExtractions();
+}
+
+} // End of anonymous namespace
+
+ScummVMCloud::~ScummVMCloud() {
+	if (_extractionTimerStarted)
+		g_system->getTimerManager()->removeTimerProc(extractionTimer);
+
+	for (uint32 i = 0; i < _downloads.size(); ++i) {
+		if (_downloads[i]->request)
+			_downloads[i]->request->close();
+		delete _downloads[i];
+	}
+	for (uint32 i = 0; i < _extractions.size(); ++i) {
+		delete _extractions[i]->out;
+		delete _extractions[i]->member;
+		delete _extractions[i]->archive;
+		delete _extractions[i];
+	}
+}
+
 void ScummVMCloud::jsonCallbackGetAllDLCs(const Networking::JsonResponse &response) {
 	const Common::JSONValue *json = response.value;
 	if (json == nullptr || !json->isObject()) {
@@ -95,98 +151,365 @@ void ScummVMCloud::getAllDLCs() {
 	request->execute();
 }
 
-void ScummVMCloud::downloadFileCallback(const Networking::DataResponse &r) {
+ScummVMCloud::Download *ScummVMCloud::findDownload(const Common::String &id) const {
+	for (uint32 i = 0; i < _downloads.size(); ++i) {
+		if (_downloads[i]->dlc->id == id)
+			return _downloads[i];
+	}
+	return nullptr;
+}
+
+Common::Path ScummVMCloud::segmentPath(const Common::String &id, uint32 segment) const {
+	// the first one keeps the name a single transfer has always used
+	if (segment == 0)
+		return Common::Path(id);
+	return Common::Path(Common::String::format("%s.%u", id.c_str(), segment));
+}
+
+void ScummVMCloud::removeSegments(const Common::String &id, uint32 segments) {
+	for (uint32 i = 0; i <= segments; ++i)
+		removeCacheFile(segmentPath(id, i));
+}
+
+void ScummVMCloud::startDownloadAsync(const Common::String &id, const Common::String &url) {
+	uint idx = DLCMan.getDLCIdxFromId(id);
+	if (idx >= DLCMan._dlcs.size() || findDownload(id))
+		return;
+
+	Download *download = new Download();
+	download->dlc = DLCMan._dlcs[idx];
+	download->url = url;
+	download->request = nullptr;
+	download->segments = 0;
+	download->segmentStart = 0;
+	download->attempts = 0;
+	download->interrupted = false;
+	download->openFailed = false;
+	_downloads.push_back(download);
+
+	// pick up what an earlier, failed or interrupted, download left
+	Common::Path dlcPath(ConfMan.getPath("dlcspath"));
+	while (true) {
+		Common::FSNode node(dlcPath.join(segmentPath(id, download->segments)));
+		if (!node.exists())
+			break;
+		Common::SeekableReadStream *stream = node.createReadStream();
+		int64 size = stream ? stream->size() : 0;
+		delete stream;
+		if (size <= 0)
+			break;
+		download->segmentStart += size;
+		++download->segments;
+	}
+	if (download->dlc->size && download->segmentStart > download->dlc->size) {
+		// that's not what we are downloading now
+		removeSegments(id, download->segments);
+		download->segments = 0;
+		download->segmentStart = 0;
+	}
+	download->dlc->downloadedSize = download->segmentStart;
+
+	if (download->segments && download->segmentStart == download->dlc->size) {
+		debug(1, "Already downloaded: %s", download->dlc->name.c_str());
+		downloadComplete(download);
+		return;
+	}
+
+	if (download->segmentStart)
+		debug(1, "Resuming %s from %llu", download->dlc->name.c_str(), (unsigned long long)download->segmentStart);
+	requestSegment(download);
+}
+
+void ScummVMCloud::requestSegment(Download *download) {
+	const Common::String &id = download->dlc->id;
+	Common::Path localFile(ConfMan.getPath("dlcspath").join(segmentPath(id, download->segments)));
+
+	Networking::DataCallback callback = new DownloadCallback<Networking::DataResponse>(this, &ScummVMCloud::downloadFileCallback, id);
+	Networking::ErrorCallback failureCallback = new DownloadCallback<Networking::ErrorResponse>(this, &ScummVMCloud::errorCallback, id);
+	download->openFailed = false;
+	Networking::SessionRequest *rq = new Networking::SessionRequest(download->url, localFile, callback, failureCallback);
+	if (download->openFailed) {
+		// the cache file couldn't be created, errorCallback() was already called from the constructor
+		rq->close();
+		downloadFailed(download, download->dlc->name + ": Failed to create the download cache file");
+		return;
+	}
+
+	if (download->segmentStart)
+		rq->addHeader(Common::String::format("Range: bytes=%llu-", (unsigned long long)download->segmentStart));
+	download->request = rq;
+	rq->start();
+}
+
+void ScummVMCloud::cancelDownload(const Common::String &id) {
+	// checked in downloadFileCallback(), as the transfer is handled on the network thread
+	Download *download = findDownload(id);
+	if (download)
+		download->interrupted = true;
+}
+
+void ScummVMCloud::downloadFileCallback(const Common::String &id, const Networking::DataResponse &r) {
+	Download *download = findDownload(id);
+	if (download == nullptr || download->request == nullptr)
+		return;
+
 	Networking::SessionFileResponse *response = static_cast<Networking::SessionFileResponse *>(r.value);
-	DLCMan._currentDownloadedSize += response->len;
-	if (DLCMan._interruptCurrentDownload) {
-		_rq->close();
-		DLCMan._interruptCurrentDownload = false;
-		// delete the download cache (the incomplete .zip)
-		Common::Path relativeFilePath = Common::Path(DLCMan._queuedDownloadTasks.front()->id);
-		removeCacheFile(relativeFilePath);
-
-		DLCMan._queuedDownloadTasks.front()->state = DLCDesc::kCancelled;
-		DLCMan.refreshDLCList();
-
-		// handle next download
-		DLCMan._queuedDownloadTasks.pop();
-		DLCMan._dlcsInProgress.remove_at(0);
-		DLCMan.processDownloadQueue();
-	}
-	if (response->eos) {
-		DLC::DLCDesc *dlc = DLCMan._queuedDownloadTasks.front();
-		debug(1, "Downloaded: %s", dlc->name.c_str());
-
-		_rq->close(); // delete request
-
-		Common::Path relativeFilePath = Common::Path(dlc->id);
-
-		// extract the downloaded zip
-		Common::String gameDir = Common::punycode_encodefilename(dlc->name);
-		Common::Path destPath(ConfMan.getPath("dlcspath").appendComponent(gameDir));
-		Common::Error error = extractZip(relativeFilePath, destPath);
-
-		// remove cache (the downloaded .zip)
-		removeCacheFile(relativeFilePath);
-
-		if (error.getCode() == Common::kNoError) {
-			// add downloaded game entry in scummvm configuration file
-			addEntryToConfig(destPath);
-			dlc->state = DLCDesc::kDownloaded;
-			DLCMan._errorText = "";
-		} else {
-			// if there is any error in extraction
-			dlc->state = DLCDesc::kErrorDownloading;
-			DLCMan._errorText = error.getDesc();
-		}
+	download->dlc->downloadedSize += response->len;
+
+	if (download->interrupted) {
+		downloadCancelled(download);
+		return;
+	}
+
+	if (download->segmentStart && download->request->httpResponseCode() == 200) {
+		// server ignored the Range header and sends everything again
+		warning("ScummVMCloud: Server can't resume %s, restarting the download", download->dlc->name.c_str());
+		download->request->close();
+		download->request = nullptr;
+		removeSegments(id, download->segments);
+		download->segments = 0;
+		download->segmentStart = 0;
+		download->dlc->downloadedSize = 0;
+		requestSegment(download);
+		return;
+	}
 
-		DLCMan.refreshDLCList();
+	// the last callback comes from finishSuccess(), once the cache file is closed
+	if (response->eos && download->request->complete()) {
+		debug(1, "Downloaded: %s", download->dlc->name.c_str());
 
-		// handle next download
-		DLCMan._queuedDownloadTasks.pop();
-		DLCMan._dlcsInProgress.remove_at(0);
-		DLCMan.processDownloadQueue();
+		download->request->close(); // delete request
+		download->request = nullptr;
+		++download->segments;
+		download->segmentStart = download->dlc->downloadedSize;
+		downloadComplete(download);
 	}
 }
 
-void ScummVMCloud::errorCallback(const Networking::ErrorResponse &error) {
-	// error downloading - start next download in queue
-	DLCMan._queuedDownloadTasks.front()->state = DLCDesc::kErrorDownloading;
-	DLCMan._queuedDownloadTasks.pop();
-	DLCMan._dlcsInProgress.remove_at(0);
-	DLCMan.processDownloadQueue();
+void ScummVMCloud::errorCallback(const Common::String &id, const Networking::ErrorResponse &error) {
+	Download *download = findDownload(id);
+	if (download == nullptr)
+		return;
+
+	if (download->request == nullptr) {
+		// called from the SessionRequest constructor, see requestSegment()
+		download->openFailed = true;
+		return;
+	}
+
+	download->request->close();
+	download->request = nullptr;
+
+	if (download->interrupted) {
+		downloadCancelled(download);
+		return;
+	}
+
+	// keep what was received, the next transfer goes on from there
+	uint64 received = download->dlc->downloadedSize - download->segmentStart;
+	if (received) {
+		++download->segments;
+		download->segmentStart = download->dlc->downloadedSize;
+		download->attempts = 0;
+	} else {
+		removeCacheFile(segmentPath(id, download->segments));
+	}
+
+	if (error.httpResponseCode == 416 && download->segmentStart) {
+		// Range Not Satisfiable: there is nothing more to download
+		downloadComplete(download);
+		return;
+	}
+
+	if (++download->attempts < kMaxAttempts) {
+		warning("ScummVMCloud: Download of %s failed, resuming from %llu", download->dlc->name.c_str(), (unsigned long long)download->segmentStart);
+		requestSegment(download);
+		return;
+	}
+
+	// what was downloaded stays in the cache, so downloading again resumes it
+	downloadFailed(download, download->dlc->name + ": Download failed, please try again");
 }
 
-void ScummVMCloud::startDownloadAsync(const Common::String &id, const Common::String &url) {
-	Common::Path localFile(ConfMan.getPath("dlcspath").appendComponent(id));
+void ScummVMCloud::downloadComplete(Download *download) {
+	Extraction *extraction = new Extraction();
+	extraction->dlc = download->dlc;
+	extraction->segments = download->segments;
+	Common::String gameDir = Common::punycode_encodefilename(download->dlc->name);
+	extraction->destPath = ConfMan.getPath("dlcspath").appendComponent(gameDir);
+	extraction->archive = nullptr;
+	extraction->member = nullptr;
+	extraction->out = nullptr;
+	_extractions.push_back(extraction);
+
+	// the transfer slot is free, the next DLC downloads while this one gets extracted
+	DLCDesc *dlc = download->dlc;
+	removeDownload(download);
+	DLCMan.transferFinished(dlc);
+
+	if (!_extractionTimerStarted) {
+		if (g_system->getTimerManager()->installTimerProc(extractionTimer, kExtractionTimerInterval, this, "DLC::ScummVMCloud's extraction timer"))
+			_extractionTimerStarted = true;
+		else
+			handleExtractions(); // no timer, extract everything right away
+	}
+}
 
-	Networking::DataCallback callback = new Common::Callback<ScummVMCloud, const Networking::DataResponse &>(this, &ScummVMCloud::downloadFileCallback);
-	Networking::ErrorCallback failureCallback = new Common::Callback<ScummVMCloud, const Networking::ErrorResponse &>(this, &ScummVMCloud::errorCallback);
-	_rq = new Networking::SessionRequest(url, localFile, callback, failureCallback);
+void ScummVMCloud::downloadFailed(Download *download, const Common::String &error) {
+	DLCDesc *dlc = download->dlc;
+	dlc->state = DLCDesc::kErrorDownloading;
+	DLCMan._errorText = error;
+	removeDownload(download);
+	DLCMan.transferFinished(dlc);
+	DLCMan.downloadFinished(dlc);
+}
+
+void ScummVMCloud::downloadCancelled(Download *download) {
+	DLCDesc *dlc = download->dlc;
+	if (download->request) {
+		download->request->close();
+		download->request = nullptr;
+	}
+	// delete the download cache (the incomplete .zip)
+	removeSegments(dlc->id, download->segments);
 
-	_rq->start();
+	dlc->state = DLCDesc::kCancelled;
+	removeDownload(download);
+	DLCMan.transferFinished(dlc);
+	DLCMan.downloadFinished(dlc);
 }
 
-Common::Error ScummVMCloud::extractZip(const Common::Path &file, const Common::Path &destPath) {
-	Common::Archive *dataArchive = nullptr;
+void ScummVMCloud::removeDownload(Download *download) {
+	for (uint32 i = 0; i < _downloads.size(); ++i) {
+		if (_downloads[i] == download) {
+			_downloads.remove_at(i);
+			break;
+		}
+	}
+	delete download;
+}
+
+void ScummVMCloud::handleExtractions() {
+	uint32 budget = kExtractionBytesPerTick;
+	while (!_extractions.empty() && budget) {
+		Extraction *extraction = _extractions.front();
+		bool done = false;
+		Common::Error error = Common::kNoError;
+		if (!extraction->archive && !startExtraction(extraction))
+			error = Common::Error(Common::kCreatingFileFailed, extraction->dlc->name + "Archive is broken, please re-download");
+		else
+			error = extractSome(extraction, budget, done);
+
+		if (error.getCode() != Common::kNoError || done)
+			finishExtraction(extraction, error);
+	}
+
+	if (_extractions.empty() && _extractionTimerStarted) {
+		g_system->getTimerManager()->removeTimerProc(extractionTimer);
+		_extractionTimerStarted = false;
+	}
+}
+
+bool ScummVMCloud::startExtraction(Extraction *extraction) {
 	Common::Path dlcPath(ConfMan.getPath("dlcspath"));
-	Common::FSNode *fs = new Common::FSNode(dlcPath.join(file));
+	Common::Array<Common::SharedPtr<Common::SeekableReadStream> > streams;
+	for (uint32 i = 0; i < extraction->segments; ++i) {
+		Common::SeekableReadStream *stream = Common::FSNode(dlcPath.join(segmentPath(extraction->dlc->id, i))).createReadStream();
+		if (!stream)
+			return false;
+		streams.push_back(Common::SharedPtr<Common::SeekableReadStream>(stream));
+	}
+	if (streams.empty())
+		return false;
+
+	// archive is nullptr if zip file is incomplete
+	extraction->archive = Common::makeZipArchive(new Common::ConcatReadStream(streams));
+	if (!extraction->archive)
+		return false;
+
+	extraction->archive->listMembers(extraction->members);
+	extraction->next = extraction->members.begin();
+	return true;
+}
+
+Common::Error ScummVMCloud::extractSome(Extraction *extraction, uint32 &budget, bool &done) {
+	byte *buffer = new byte[kExtractionChunkSize];
 	Common::Error error = Common::kNoError;
-	if (fs->exists()) {
-		dataArchive = Common::makeZipArchive(*fs);
-		// dataArchive is nullptr if zip file is incomplete
-		if (dataArchive != nullptr) {
-			error = dataArchive->dumpArchive(destPath);
-		} else {
-			error = Common::Error(Common::kCreatingFileFailed, DLCMan._queuedDownloadTasks.front()->name + "Archive is broken, please re-download");
+
+	while (budget) {
+		if (!extraction->member) {
+			if (extraction->next == extraction->members.end()) {
+				done = true;
+				break;
+			}
+
+			Common::Path filePath = (*extraction->next)->getPathInArchive().punycodeEncode();
+			debug(1, "ScummVMCloud: Extracting %s", filePath.toString().c_str());
+			extraction->member = (*extraction->next)->createReadStream();
+			++extraction->next;
+
+			// skip if it represents a directory
+			if (filePath.isSeparatorTerminated() || !extraction->member) {
+				delete extraction->member;
+				extraction->member = nullptr;
+				continue;
+			}
+
+			extraction->out = new Common::DumpFile();
+			Common::Path outPath = extraction->destPath.join(filePath);
+			if (!extraction->out->open(outPath, true)) {
+				error = Common::Error(Common::kCreatingFileFailed, "Cannot open/create dump file " + outPath.toString(Common::Path::kNativeSeparator));
+				break;
+			}
+		}
+
+		uint32 readBytes = extraction->member->read(buffer, MIN(budget, kExtractionChunkSize));
+		if (readBytes && extraction->out->write(buffer, readBytes) < readBytes) {
+			error = Common::Error(Common::kWritingFailed, "Not enough storage space! Please free up some storage and try again");
+			break;
+		}
+		budget -= MIN(budget, MAX<uint32>(readBytes, 1));
+
+		if (readBytes == 0 || extraction->member->eos()) {
+			extraction->out->flush();
+			extraction->out->close();
+			delete extraction->out;
+			extraction->out = nullptr;
+			delete extraction->member;
+			extraction->member = nullptr;
 		}
 	}
-	delete fs;
-	delete dataArchive;
 
+	delete[] buffer;
 	return error;
 }
 
+void ScummVMCloud::finishExtraction(Extraction *extraction, const Common::Error &error) {
+	DLCDesc *dlc = extraction->dlc;
+
+	delete extraction->out;
+	delete extraction->member;
+	delete extraction->archive;
+	_extractions.remove_at(0);
+
+	// remove cache (the downloaded .zip)
+	removeSegments(dlc->id, extraction->segments);
+
+	if (error.getCode() == Common::kNoError) {
+		// add downloaded game entry in scummvm configuration file
+		addEntryToConfig(extraction->destPath, dlc);
+		dlc->state = DLCDesc::kDownloaded;
+		DLCMan._errorText = "";
+	} else {
+		// if there is any error in extraction
+		dlc->state = DLCDesc::kErrorDownloading;
+		DLCMan._errorText = error.getDesc();
+	}
+	delete extraction;
+
+	DLCMan.downloadFinished(dlc);
+}
+
 void ScummVMCloud::removeCacheFile(const Common::Path &file) {
 	Common::Path dlcPath(ConfMan.getPath("dlcspath"));
 	Common::Path fileToDelete = dlcPath.join(file);
@@ -199,7 +522,7 @@ void ScummVMCloud::removeCacheFile(const Common::Path &file) {
 #endif
 }
 
-void ScummVMCloud::addEntryToConfig(Common::Path gamePath) {
+void ScummVMCloud::addEntryToConfig(Common::Path gamePath, DLCDesc *dlc) {
 	Common::FSNode dir(gamePath);
 	Common::FSList fsnodes;
 	if (!dir.getChildren(fsnodes, Common::FSNode::kListAll)) {
@@ -211,7 +534,6 @@ void ScummVMCloud::addEntryToConfig(Common::Path gamePath) {
 		gamePath = gamePath.appendComponent(fsnodes[0].getFileName());
 	}
 	// add a new entry in scummvm config file
-	DLC::DLCDesc *dlc = DLCMan._queuedDownloadTasks.front();
 	Common::String domain = EngineMan.generateUniqueDomain(dlc->gameid);
 	ConfMan.addGameDomain(domain);
 	ConfMan.set("engineid", dlc->engineid, domain);
@@ -22,6 +22,7 @@
 #ifndef BACKENDS_DLC_SCUMMVMCLOUD_H
 #define BACKENDS_DLC_SCUMMVMCLOUD_H
 
+#include "common/archive.h"
 #include "common/error.h"
 #include "common/queue.h"
 
@@ -29,6 +30,10 @@
 #include "backends/networking/curl/request.h"
 #include "backends/networking/curl/curljsonrequest.h"
 
+namespace Common {
+class DumpFile;
+}
+
 namespace Networking {
 class SessionRequest;
 }
@@ -38,31 +43,74 @@ namespace ScummVMCloud {
 
 class ScummVMCloud : public DLC::Store {
 
-	Networking::SessionRequest *_rq;
-
-public:	
-	ScummVMCloud() {}
-	virtual ~ScummVMCloud() {}
+	// A DLC being downloaded. Every (re)started transfer writes into its own
+	// cache file with a Range request, the archive is their concatenation.
+	struct Download {
+		DLCDesc *dlc;
+		Common::String url;
+		Networking::SessionRequest *request;
+		uint32 segments; // finished cache files
+		uint64 segmentStart; // their total size, i.e. where the transfer resumes
+		uint32 attempts;
+		bool interrupted;
+		bool openFailed;
+	};
+
+	// A downloaded DLC being unpacked, a bit every timer tick, so that it
+	// doesn't stall the other transfers
+	struct Extraction {
+		DLCDesc *dlc;
+		uint32 segments;
+		Common::Path destPath;
+		Common::Archive *archive;
+		Common::ArchiveMemberList members;
+		Common::ArchiveMemberList::const_iterator next;
+		Common::SeekableReadStream *member;
+		Common::DumpFile *out;
+	};
+
+	Common::Array<Download *> _downloads;
+	Common::Array<Extraction *> _extractions;
+	bool _extractionTimerStarted;
+
+	Download *findDownload(const Common::String &id) const;
+	Common::Path segmentPath(const Common::String &id, uint32 segment) const;
+	void removeSegments(const Common::String &id, uint32 segments);
+	void requestSegment(Download *download);
+	void downloadComplete(Download *download);
+	void downloadFailed(Download *download, const Common::String &error);
+	void downloadCancelled(Download *download);
+	void removeDownload(Download *download);
+
+	bool startExtraction(Extraction *extraction);
+	Common::Error extractSome(Extraction *extraction, uint32 &budget, bool &done);
+	void finishExtraction(Extraction *extraction, const Common::Error &error);
+
+public:
+	ScummVMCloud() : _extractionTimerStarted(false) {}
+	virtual ~ScummVMCloud();
 
 	virtual void getAllDLCs() override;
 
 	virtual void startDownloadAsync(const Common::String &id, const Common::String &url) override;
 
+	virtual void cancelDownload(const Common::String &id) override;
+
 	virtual void removeCacheFile(const Common::Path &file) override;
 
-	// extracts the provided zip in the provided destination path
-	Common::Error extractZip(const Common::Path &file, const Common::Path &destPath);
+	// extracts downloaded archives, called by a timer while there are any
+	void handleExtractions();
 
-	void addEntryToConfig(Common::Path gamePath);
+	void addEntryToConfig(Common::Path gamePath, DLCDesc *dlc);
 
 	// callback functions
 	void jsonCallbackGetAllDLCs(const Networking::JsonResponse &response);
 
 	void errorCallbackGetAllDLCs(const Networking::ErrorResponse &error);
 
-	void downloadFileCallback(const Networking::DataResponse &response);
+	void downloadFileCallback(const Common::String &id, const Networking::DataResponse &response);
 
-	void errorCallback(const Networking::ErrorResponse &error);
+	void errorCallback(const Common::String &id, const Networking::ErrorResponse &error);
 };
 
 } // End of namespace ScummVMCloud
@@ -39,6 +39,9 @@ public:
 
 	virtual void startDownloadAsync(const Common::String &id, const Common::String &url) = 0;
 
+	// stops a download started with startDownloadAsync() and removes what was downloaded
+	virtual void cancelDownload(const Common::String &id) = 0;
+
 	virtual void removeCacheFile(const Common::Path &file) = 0;
 };
 
@@ -257,6 +257,14 @@ void DefaultEventManager::pushEvent(const Common::Event &event) {
 		_artificialEventSource.addEvent(event);
 }
 
+bool DefaultEventManager::waitForEventOrDeadline(uint32 deadline) {
+	// Events already queued here don't wake the backend up
+	if (!_eventQueue.empty() || _artificialEventSource.hasEvents())
+		return true;
+
+	return g_system->waitForEventOrDeadline(deadline);
+}
+
 void DefaultEventManager::purgeMouseEvents() {
 	_dispatcher.dispatch();
 
@@ -65,6 +65,7 @@ public:
 	void init() override;
 	bool pollEvent(Common::Event &event) override;
 	void pushEvent(const Common::Event &event) override;
+	bool waitForEventOrDeadline(uint32 deadline) override;
 	void purgeMouseEvents() override;
 	void purgeKeyboardEvents() override;
 
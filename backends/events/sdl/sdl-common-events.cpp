@@ -36,6 +36,28 @@ SdlEventSource::~SdlEventSource() {
 	closeJoystick();
 }
 
+bool SdlEventSource::waitForEvent(uint32 timeout) {
+	// The events pollEvent() makes up itself
+	if (_queuedFakeMouseMove || g_system->getScreenChangeID() != _lastScreenID)
+		return true;
+
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	if (_queuedFakeKeyUp)
+		return true;
+
+	// Simulated clicks are released after a while
+	for (const auto &panel : _touchPanels) {
+		if (panel._value._simulatedClickStartTime[0] || panel._value._simulatedClickStartTime[1])
+			timeout = MIN<uint32>(timeout, SIMULATED_CLICK_DURATION);
+	}
+
+	return SDL_WaitEventTimeout(nullptr, timeout);
+#else
+	SDL_Delay(timeout);
+	return false;
+#endif
+}
+
 bool SdlEventSource::processMouseEvent(Common::Event &event, int x, int y, int relx, int rely) {
 	_mouseX = x;
 	_mouseY = y;
@@ -49,6 +49,14 @@ public:
 	 */
 	virtual bool pollEvent(Common::Event &event);
 
+	/**
+	 * Sleeps until there is an event for pollEvent() or the timeout in
+	 * milliseconds passes. The event is left in the queue.
+	 *
+	 * @return Whether an event is available.
+	 */
+	bool waitForEvent(uint32 timeout);
+
 	/**
 	 * Emulates a mouse movement that would normally be caused by a mouse warp
 	 * of the system mouse.
@@ -172,6 +172,12 @@ public:
 	 */
 	virtual bool isWritable() const = 0;
 
+	/**
+	 * Gets the size and the modification time of the file, see FSNode::getFileStamp().
+	 * The default implementation does not know them.
+	 */
+	virtual bool getFileStamp(int64 &size, int64 &modified) const { return false; }
+
 
 	/**
 	 * Creates a SeekableReadStream instance corresponding to the file
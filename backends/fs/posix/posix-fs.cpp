@@ -34,6 +34,10 @@
 #include "backends/fs/posix/posix-fs.h"
 #include "backends/fs/posix/posix-iostream.h"
 #include "common/algorithm.h"
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/mutex.h"
+#include "common/system.h"
 
 #include <sys/param.h>
 #include <sys/stat.h>
@@ -48,6 +52,7 @@
 #include <stdio.h>
 #include <errno.h>
 #include <fcntl.h>
+#include <time.h>
 #include <unistd.h>
 
 #ifdef __OS2__
@@ -55,6 +60,178 @@
 #include <os2.h>
 #endif
 
+namespace {
+
+enum EntryType {
+	kEntryFile,
+	kEntryDirectory,
+	kEntryLink,   ///< Symbolic link, the type of the target is checked with stat()
+	kEntryUnknown ///< Checked with stat()
+};
+
+struct DirectoryEntry {
+	Common::String name;
+	EntryType type;
+};
+
+typedef Common::Array<DirectoryEntry> DirectoryListing;
+
+/** What a cached listing is checked against. */
+struct DirectoryStamp {
+	dev_t device;
+	ino_t inode;
+	time_t modified;
+
+	bool operator==(const DirectoryStamp &other) const {
+		return device == other.device && inode == other.inode && modified == other.modified;
+	}
+};
+
+struct CachedListing {
+	DirectoryStamp stamp;
+	DirectoryListing listing;
+};
+
+// Some file systems only keep the modification time in steps of up to two
+// seconds, directories changed more recently than this are not cached.
+const time_t kMinCachedAge = 3;
+
+// When the cached listings have more entries than this, they start over
+const uint kMaxCachedEntries = 256 * 1024;
+
+/**
+ * The listings of the directories, shared by all nodes. Detecting games
+ * goes through whole directory trees every time, which takes long on
+ * network shares. A cached listing costs a stat() of the directory
+ * instead of reading it again.
+ */
+class DirectoryCache {
+public:
+	static DirectoryCache *instance() {
+		// Mutexes come from the backend
+		if (!g_system)
+			return nullptr;
+		static DirectoryCache cache;
+		return &cache;
+	}
+
+	bool get(const Common::String &path, const DirectoryStamp &stamp, DirectoryListing &listing) {
+		Common::StackLock lock(_mutex);
+		ListingMap::const_iterator i = _listings.find(path);
+		if (i == _listings.end() || !(i->_value.stamp == stamp))
+			return false;
+		listing = i->_value.listing;
+		return true;
+	}
+
+	void put(const Common::String &path, const DirectoryStamp &stamp, const DirectoryListing &listing) {
+		Common::StackLock lock(_mutex);
+		if (_entries + listing.size() > kMaxCachedEntries) {
+			_listings.clear();
+			_entries = 0;
+		}
+
+		ListingMap::iterator i = _listings.find(path);
+		if (i != _listings.end())
+			_entries -= i->_value.listing.size();
+
+		CachedListing &cached = _listings[path];
+		cached.stamp = stamp;
+		cached.listing = listing;
+		_entries += listing.size();
+	}
+
+private:
+	DirectoryCache() : _entries(0) {}
+
+	typedef Common::HashMap<Common::String, CachedListing> ListingMap;
+
+	Common::Mutex _mutex;
+	ListingMap _listings;
+	uint _entries;
+};
+
+bool readDirectory(const Common::String &path, DirectoryListing &listing) {
+	DIR *dirp = opendir(path.c_str());
+	struct dirent *dp;
+
+	if (dirp == NULL)
+		return false;
+
+	// loop over dir entries using readdir
+	while ((dp = readdir(dirp)) != NULL) {
+		// Skip '.' and '..' to avoid cycles
+		if ((dp->d_name[0] == '.' && dp->d_name[1] == 0) || (dp->d_name[0] == '.' && dp->d_name[1] == '.')) {
+			continue;
+		}
+
+		DirectoryEntry entry;
+		entry.name = dp->d_name;
+
+#if defined(SYSTEM_NOT_SUPPORTING_D_TYPE)
+		/* TODO: d_type is not part of POSIX, so it might not be supported
+		 * on some of our targets. For those systems where it isn't supported,
+		 * add this #elif case, which tries to use stat() instead.
+		 *
+		 * The d_type method is used to avoid costly recurrent stat() calls in big
+		 * directories.
+		 */
+		entry.type = kEntryUnknown;
+#else
+		switch (dp->d_type) {
+		case DT_DIR:
+			entry.type = kEntryDirectory;
+			break;
+		case DT_REG:
+			entry.type = kEntryFile;
+			break;
+		case DT_LNK:
+			entry.type = kEntryLink;
+			break;
+		case DT_UNKNOWN:
+		default:
+			// Fall back to stat()
+			//
+			// It's important NOT to limit this to DT_UNKNOWN, because d_type can
+			// be unreliable on some OSes and filesystems; a confirmed example is
+			// macOS 10.4, where d_type can hold bogus values when iterating over
+			// the files of a cddafs mount point (as used by MacOSXAudioCDManager).
+			entry.type = kEntryUnknown;
+			break;
+		}
+#endif
+
+		listing.push_back(entry);
+	}
+	closedir(dirp);
+
+	return true;
+}
+
+/** Read a directory, or take its listing from the cache if it hasn't changed. */
+bool listDirectory(const Common::String &path, DirectoryListing &listing) {
+	DirectoryCache *cache = DirectoryCache::instance();
+	struct stat st;
+	if (!cache || stat(path.c_str(), &st) != 0)
+		return readDirectory(path, listing);
+
+	DirectoryStamp stamp;
+	stamp.device = st.st_dev;
+	stamp.inode = st.st_ino;
+	stamp.modified = st.st_mtime;
+	if (cache->get(path, stamp, listing))
+		return true;
+
+	if (!readDirectory(path, listing))
+		return false;
+
+	if (time(nullptr) - st.st_mtime >= kMinCachedAge)
+		cache->put(path, stamp, listing);
+	return true;
+}
+
+} // End of anonymous namespace
+
 bool POSIXFilesystemNode::exists() const {
 	return access(_path.c_str(), F_OK) == 0;
 }
@@ -67,6 +244,16 @@ bool POSIXFilesystemNode::isWritable() const {
 	return access(_path.c_str(), W_OK) == 0;
 }
 
+bool POSIXFilesystemNode::getFileStamp(int64 &size, int64 &modified) const {
+	struct stat st;
+	if (stat(_path.c_str(), &st) != 0 || !S_ISREG(st.st_mode))
+		return false;
+
+	size = st.st_size;
+	modified = st.st_mtime;
+	return true;
+}
+
 void POSIXFilesystemNode::setFlags() {
 	struct stat st;
 
@@ -168,47 +355,32 @@ bool POSIXFilesystemNode::getChildren(AbstractFSList &myList, ListMode mode, boo
 	}
 #endif
 
-	DIR *dirp = opendir(_path.c_str());
-	struct dirent *dp;
-
-	if (dirp == NULL)
+	DirectoryListing listing;
+	if (!listDirectory(_path, listing))
 		return false;
 
-	// loop over dir entries using readdir
-	while ((dp = readdir(dirp)) != NULL) {
+	for (uint i = 0; i < listing.size(); ++i) {
+		const Common::String &name = listing[i].name;
+
 		// Skip 'invisible' files if necessary
-		if (dp->d_name[0] == '.' && !hidden) {
-			continue;
-		}
-		// Skip '.' and '..' to avoid cycles
-		if ((dp->d_name[0] == '.' && dp->d_name[1] == 0) || (dp->d_name[0] == '.' && dp->d_name[1] == '.')) {
+		if (name[0] == '.' && !hidden) {
 			continue;
 		}
 
 		// Start with a clone of this node, with the correct path set
 		POSIXFilesystemNode entry(*this);
-		entry._displayName = dp->d_name;
+		entry._displayName = name;
 		if (_path.lastChar() != '/')
 			entry._path += '/';
 		entry._path += entry._displayName;
 
-#if defined(SYSTEM_NOT_SUPPORTING_D_TYPE)
-		/* TODO: d_type is not part of POSIX, so it might not be supported
-		 * on some of our targets. For those systems where it isn't supported,
-		 * add this #elif case, which tries to use stat() instead.
-		 *
-		 * The d_type method is used to avoid costly recurrent stat() calls in big
-		 * directories.
-		 */
-		entry.setFlags();
-#else
-		switch (dp->d_type) {
-		case DT_DIR:
-		case DT_REG:
+		switch (listing[i].type) {
+		case kEntryDirectory:
+		case kEntryFile:
 			entry._isValid = true;
-			entry._isDirectory = (dp->d_type == DT_DIR);
+			entry._isDirectory = (listing[i].type == kEntryDirectory);
 			break;
-		case DT_LNK:
+		case kEntryLink:
 			entry._isValid = true;
 			struct stat st;
 			if (stat(entry._path.c_str(), &st) == 0)
@@ -216,18 +388,11 @@ bool POSIXFilesystemNode::getChildren(AbstractFSList &myList, ListMode mode, boo
 			else
 				entry._isDirectory = false;
 			break;
-		case DT_UNKNOWN:
+		case kEntryUnknown:
 		default:
-			// Fall back to stat()
-			//
-			// It's important NOT to limit this to DT_UNKNOWN, because d_type can
-			// be unreliable on some OSes and filesystems; a confirmed example is
-			// macOS 10.4, where d_type can hold bogus values when iterating over
-			// the files of a cddafs mount point (as used by MacOSXAudioCDManager).
 			entry.setFlags();
 			break;
 		}
-#endif
 
 		// Skip files that are invalid for some reason (e.g. because we couldn't
 		// properly stat them).
@@ -241,7 +406,6 @@ bool POSIXFilesystemNode::getChildren(AbstractFSList &myList, ListMode mode, boo
 
 		myList.push_back(new POSIXFilesystemNode(entry));
 	}
-	closedir(dirp);
 
 	return true;
 }
@@ -276,6 +440,13 @@ AbstractFSNode *POSIXFilesystemNode::getParent() const {
 }
 
 Common::SeekableReadStream *POSIXFilesystemNode::createReadStream() {
+#ifdef HAS_MMAP
+	Common::SeekableReadStream *mapped = PosixMappedReadStream::makeFromPath(getPath());
+	if (mapped) {
+		return mapped;
+	}
+#endif
+
 	return PosixIoStream::makeFromPath(getPath(), StdioStream::WriteMode_Read);
 }
 
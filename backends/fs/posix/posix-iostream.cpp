@@ -24,6 +24,11 @@
 #include "backends/fs/posix/posix-iostream.h"
 
 #include <sys/stat.h>
+#ifdef HAS_MMAP
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
 
 PosixIoStream::PosixIoStream(void *handle) :
 		StdioStream(handle) {
@@ -44,3 +49,47 @@ int64 PosixIoStream::size() const {
 
 	return st.st_size;
 }
+
+#ifdef HAS_MMAP
+
+// Mapping small files costs more in page faults and VMA bookkeeping than the
+// copy it saves, so those keep going through stdio.
+static const int64 kMinMappedFileSize = 64 * 1024;
+
+// Keep well clear of exhausting the address space on 32-bit hosts.
+static const int64 kMaxMappedFileSize = sizeof(void *) >= 8 ? 0xFFFFFFFF : 256 * 1024 * 1024;
+
+PosixMappedReadStream::PosixMappedReadStream(void *mapping, uint32 size) :
+		Common::MemoryReadStream((const byte *)mapping, size, DisposeAfterUse::NO),
+		_mapping(mapping), _mappingSize(size) {
+}
+
+PosixMappedReadStream::~PosixMappedReadStream() {
+	munmap(_mapping, _mappingSize);
+}
+
+Common::SeekableReadStream *PosixMappedReadStream::makeFromPath(const Common::String &path) {
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd == -1) {
+		return nullptr;
+	}
+
+	struct stat st;
+	if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode) ||
+			st.st_size < kMinMappedFileSize || st.st_size > kMaxMappedFileSize) {
+		close(fd);
+		return nullptr;
+	}
+
+	void *mapping = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	// The mapping keeps its own reference to the file
+	close(fd);
+
+	if (mapping == MAP_FAILED) {
+		return nullptr;
+	}
+
+	return new PosixMappedReadStream(mapping, (uint32)st.st_size);
+}
+
+#endif
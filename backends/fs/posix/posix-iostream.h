@@ -23,6 +23,7 @@
 #define BACKENDS_FS_POSIX_POSIXIOSTREAM_H
 
 #include "backends/fs/stdiostream.h"
+#include "common/memstream.h"
 
 /**
  * A file input / output stream using POSIX interfaces
@@ -39,4 +40,33 @@ public:
 	int64 size() const override;
 };
 
+#ifdef HAS_MMAP
+/**
+ * A read-only file stream backed by a memory mapping of the whole file.
+ *
+ * Reads are served straight out of the OS page cache instead of going
+ * through a stdio buffer, and the mapped pages are shared with every other
+ * process which has the same file open.
+ */
+class PosixMappedReadStream final : public Common::MemoryReadStream {
+public:
+	/**
+	 * Map the file at the given path.
+	 *
+	 * Returns nullptr if the file is not a regular file, is too small or too
+	 * large to be worth mapping, or if the mapping failed. Callers are
+	 * expected to fall back to PosixIoStream in that case.
+	 */
+	static Common::SeekableReadStream *makeFromPath(const Common::String &path);
+
+	~PosixMappedReadStream() override;
+
+private:
+	PosixMappedReadStream(void *mapping, uint32 size);
+
+	void *_mapping;
+	uint32 _mappingSize;
+};
+#endif
+
 #endif
@@ -138,6 +138,10 @@ void Framebuffer::applyBlendState() {
 			GL_CALL(glEnable(GL_BLEND));
 			GL_CALL(glBlendFunc(GL_ONE_MINUS_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA));
 			break;
+		case kBlendModeMultiplyByAlpha:
+			GL_CALL(glEnable(GL_BLEND));
+			GL_CALL(glBlendFunc(GL_ZERO, GL_SRC_ALPHA));
+			break;
 		default:
 			break;
 	}
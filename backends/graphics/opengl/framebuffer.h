@@ -79,6 +79,12 @@ public:
 		 * add inversions of the pixels based on the color.
 		 */
 		kBlendModeMaskAlphaAndInvertByColor,
+
+		/**
+		 * Existing pixels are multiplied with the alpha value of newly drawn
+		 * pixels, which are not drawn themselves. This applies a mask.
+		 */
+		kBlendModeMultiplyByAlpha,
 	};
 
 	/**
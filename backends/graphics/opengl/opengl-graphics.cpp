@@ -76,7 +76,8 @@ OpenGLGraphicsManager::OpenGLGraphicsManager()
 	  _cursor(nullptr), _cursorMask(nullptr),
 	  _cursorHotspotX(0), _cursorHotspotY(0),
 	  _cursorHotspotXScaled(0), _cursorHotspotYScaled(0), _cursorWidthScaled(0), _cursorHeightScaled(0),
-	  _cursorKeyColor(0), _cursorUseKey(true), _cursorDontScale(false), _cursorPaletteEnabled(false), _shakeOffsetScaled()
+	  _cursorKeyColor(0), _cursorUseKey(true), _cursorDontScale(false), _cursorPaletteEnabled(false), _shakeOffsetScaled(),
+	  _screenshotBuffer(0), _screenshotWidth(0), _screenshotHeight(0), _screenshotReadbackPending(false)
 #if !USE_FORCED_GLES
 	  , _libretroPipeline(nullptr)
 #endif
@@ -948,7 +949,7 @@ void OpenGLGraphicsManager::setMouseCursor(const void *buf, uint w, uint h, int
 		} else {
 			textureFormat = _defaultFormatAlpha;
 		}
-		_cursor = createSurface(textureFormat, true, wantScaler, wantMask);
+		_cursor = createSurface(textureFormat, true, wantScaler);
 		assert(_cursor);
 
 		updateLinearFiltering();
@@ -1436,6 +1437,14 @@ void OpenGLGraphicsManager::notifyContextCreate(ContextType type,
 }
 
 void OpenGLGraphicsManager::notifyContextDestroy() {
+#ifdef USE_GLAD
+	if (_screenshotBuffer) {
+		GL_CALL(glDeleteBuffers(1, &_screenshotBuffer));
+		_screenshotBuffer = 0;
+	}
+#endif
+	_screenshotReadbackPending = false;
+
 	if (_gameScreen) {
 		_gameScreen->destroy();
 	}
@@ -1485,27 +1494,40 @@ void OpenGLGraphicsManager::notifyContextDestroy() {
 	OpenGLContext.reset();
 }
 
-Surface *OpenGLGraphicsManager::createSurface(const Graphics::PixelFormat &format, bool wantAlpha, bool wantScaler, bool wantMask) {
+Surface *OpenGLGraphicsManager::createSurface(const Graphics::PixelFormat &format, bool wantAlpha, bool wantScaler) {
 	GLenum glIntFormat, glFormat, glType;
 
 #ifdef USE_SCALERS
 	if (wantScaler) {
 		// TODO: Ensure that the requested pixel format is supported by the scaler
-		if (getGLPixelFormat(format, glIntFormat, glFormat, glType)) {
-			return new ScaledTextureSurface(glIntFormat, glFormat, glType, format, format);
-		} else {
+		Graphics::PixelFormat textureFormat = format;
+		if (!getGLPixelFormat(format, glIntFormat, glFormat, glType)) {
+			glIntFormat = GL_RGBA;
+			glFormat = GL_RGBA;
+			glType = GL_UNSIGNED_BYTE;
 #ifdef SCUMM_LITTLE_ENDIAN
-			return new ScaledTextureSurface(GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE, Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24), format);
+			textureFormat = Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24);
 #else
-			return new ScaledTextureSurface(GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE, Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0), format);
+			textureFormat = Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0);
 #endif
 		}
+
+#if !USE_FORCED_GLES
+		// Scalers with a built-in shader are done on the GPU, which saves
+		// both the scaling and uploading the scaled image.
+		if (ScaledTextureSurfaceGPU::isSupportedByContext()
+		    && ScaledTextureSurfaceGPU::isSupportedByScaler(_currentState.scalerIndex, _currentState.scaleFactor)) {
+			return new ScaledTextureSurfaceGPU(glIntFormat, glFormat, glType, textureFormat, format);
+		}
+#endif
+
+		return new ScaledTextureSurface(glIntFormat, glFormat, glType, textureFormat, format);
 	}
 #endif
 
 	if (format.bytesPerPixel == 1) {
 #if !USE_FORCED_GLES
-		if (TextureSurfaceCLUT8GPU::isSupportedByContext() && !wantMask) {
+		if (TextureSurfaceCLUT8GPU::isSupportedByContext()) {
 			return new TextureSurfaceCLUT8GPU();
 		}
 #endif
@@ -1768,50 +1790,143 @@ const Graphics::Font *OpenGLGraphicsManager::getFontOSD() const {
 }
 #endif
 
-bool OpenGLGraphicsManager::saveScreenshot(const Common::Path &filename) const {
-	const uint width  = _windowWidth;
-	const uint height = _windowHeight;
-
-	// GL_PACK_ALIGNMENT is 4 so each row must be aligned to 4 bytes boundary
-	// A line of a BMP image must also have a size divisible by 4.
-	// Calculate lineSize as the next multiple of 4 after the real line size
+namespace {
+// GL_PACK_ALIGNMENT is 4 so each row must be aligned to 4 bytes boundary
+void getScreenshotLayout(uint width, uint &lineSize, GLenum &glFormat, Graphics::PixelFormat &format) {
 #ifdef EMSCRIPTEN
-	const uint lineSize        = width * 4; // RGBA (see comment below)
+	// WebGL doesn't support GL_RGB, see https://registry.khronos.org/webgl/specs/latest/1.0/#5.14.12:
+	// "Only two combinations of format and type are accepted. The first is format RGBA and type UNSIGNED_BYTE.
+	// The second is an implementation-chosen format. " and the implementation-chosen formats are buggy:
+	// https://github.com/KhronosGroup/WebGL/issues/2747
+	lineSize = width * 4;
+	glFormat = GL_RGBA;
+	format = Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24);
+#else
+	lineSize = (width * 3 + 3) & ~3;
+	glFormat = GL_RGB;
+#ifdef SCUMM_LITTLE_ENDIAN
+	format = Graphics::PixelFormat(3, 8, 8, 8, 0, 0, 8, 16, 0);
 #else
-	const uint lineSize        = (width * 3 + 3) & ~3;
+	format = Graphics::PixelFormat(3, 8, 8, 8, 0, 16, 8, 0, 0);
 #endif
+#endif
+}
+
+// GL rows go bottom up
+void copyScreenshotRows(Graphics::Surface &surface, const byte *pixels, uint width, uint height, uint lineSize, const Graphics::PixelFormat &format) {
+	surface.create(width, height, format);
+	for (uint y = 0; y < height; ++y) {
+		memcpy(surface.getBasePtr(0, y), pixels + (height - 1 - y) * lineSize, width * format.bytesPerPixel);
+	}
+}
+} // End of anonymous namespace
 
+bool OpenGLGraphicsManager::saveScreenshot(const Common::Path &filename) const {
 	Common::DumpFile out;
 	if (!out.open(filename)) {
 		return false;
 	}
 
+	Graphics::Surface data;
+	if (!readScreenshot(data)) {
+		return false;
+	}
+
+#ifdef USE_PNG
+	const bool success = Image::writePNG(out, data);
+#else
+	const bool success = Image::writeBMP(out, data);
+#endif
+	data.free();
+	return success;
+}
+
+bool OpenGLGraphicsManager::readScreenshot(Graphics::Surface &surface) const {
+	const uint width  = _windowWidth;
+	const uint height = _windowHeight;
+
+	uint lineSize;
+	GLenum glFormat;
+	Graphics::PixelFormat format;
+	getScreenshotLayout(width, lineSize, glFormat, format);
+
 	Common::Array<uint8> pixels;
 	pixels.resize(lineSize * height);
-#ifdef EMSCRIPTEN
-	// WebGL doesn't support GL_RGB, see https://registry.khronos.org/webgl/specs/latest/1.0/#5.14.12:
-	// "Only two combinations of format and type are accepted. The first is format RGBA and type UNSIGNED_BYTE.
-	// The second is an implementation-chosen format. " and the implementation-chosen formats are buggy:
-	// https://github.com/KhronosGroup/WebGL/issues/2747
-	GL_CALL(glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, &pixels.front()));
-	const Graphics::PixelFormat format(4, 8, 8, 8, 8, 0, 8, 16, 24);
-#else
-	GL_CALL(glReadPixels(0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, &pixels.front()));
+	GL_CALL(glReadPixels(0, 0, width, height, glFormat, GL_UNSIGNED_BYTE, &pixels.front()));
 
-#ifdef SCUMM_LITTLE_ENDIAN
-	const Graphics::PixelFormat format(3, 8, 8, 8, 0, 0, 8, 16, 0);
+	copyScreenshotRows(surface, &pixels.front(), width, height, lineSize, format);
+	return true;
+}
+
+bool OpenGLGraphicsManager::beginScreenshotReadback() {
+#ifdef USE_GLAD
+	if (!OpenGLContext.pixelBufferObjectSupported || _screenshotReadbackPending) {
+		return false;
+	}
+
+	uint lineSize;
+	GLenum glFormat;
+	Graphics::PixelFormat format;
+	getScreenshotLayout(_windowWidth, lineSize, glFormat, format);
+
+	if (!_screenshotBuffer) {
+		GL_CALL(glGenBuffers(1, &_screenshotBuffer));
+	}
+
+	// With a pack buffer bound, glReadPixels only queues the transfer
+	GL_CALL(glBindBuffer(GL_PIXEL_PACK_BUFFER, _screenshotBuffer));
+	GL_CALL(glBufferData(GL_PIXEL_PACK_BUFFER, lineSize * _windowHeight, nullptr, GL_STREAM_READ));
+	GL_CALL(glReadPixels(0, 0, _windowWidth, _windowHeight, glFormat, GL_UNSIGNED_BYTE, nullptr));
+	GL_CALL(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+	_screenshotWidth = _windowWidth;
+	_screenshotHeight = _windowHeight;
+	_screenshotReadbackPending = true;
+	return true;
 #else
-	const Graphics::PixelFormat format(3, 8, 8, 8, 0, 16, 8, 0, 0);
-#endif
+	return false;
 #endif
-	Graphics::Surface data;
-	data.init(width, height, lineSize, &pixels.front(), format);
-	data.flipVertical(Common::Rect(width, height));
+}
 
-#ifdef USE_PNG
-	return Image::writePNG(out, data);
+bool OpenGLGraphicsManager::finishScreenshotReadback(Graphics::Surface &surface) {
+#ifdef USE_GLAD
+	if (!_screenshotReadbackPending) {
+		return false;
+	}
+	_screenshotReadbackPending = false;
+
+	uint lineSize;
+	GLenum glFormat;
+	Graphics::PixelFormat format;
+	getScreenshotLayout(_screenshotWidth, lineSize, glFormat, format);
+	const uint size = lineSize * _screenshotHeight;
+
+	GL_CALL(glBindBuffer(GL_PIXEL_PACK_BUFFER, _screenshotBuffer));
+
+	const byte *pixels;
+	GL_ASSIGN(pixels, (const byte *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT));
+	if (pixels) {
+		copyScreenshotRows(surface, pixels, _screenshotWidth, _screenshotHeight, lineSize, format);
+	}
+
+	GLboolean unmapped = GL_FALSE;
+	if (pixels) {
+		GL_ASSIGN(unmapped, glUnmapBuffer(GL_PIXEL_PACK_BUFFER));
+	}
+	GL_CALL(glBindBuffer(GL_PIXEL_PACK_BUFFER, 0));
+
+	// Don't hold on to a window sized buffer
+	GL_CALL(glDeleteBuffers(1, &_screenshotBuffer));
+	_screenshotBuffer = 0;
+
+	if (!unmapped) {
+		// The contents were lost, e.g. because the display mode changed
+		surface.free();
+		return false;
+	}
+	return true;
 #else
-	return Image::writeBMP(out, data);
+	return false;
 #endif
 }
 
@@ -174,7 +174,7 @@ protected:
 	 * @param wantScaler Whether or not a software scaler should be used.
 	 * @return A pointer to the surface or nullptr on failure.
 	 */
-	Surface *createSurface(const Graphics::PixelFormat &format, bool wantAlpha = false, bool wantScaler = false, bool wantMask = false);
+	Surface *createSurface(const Graphics::PixelFormat &format, bool wantAlpha = false, bool wantScaler = false);
 
 	//
 	// Transaction support
@@ -293,7 +293,41 @@ protected:
 	// Do not hide the argument-less saveScreenshot from the base class
 	using WindowedGraphicsManager::saveScreenshot;
 
+	/**
+	 * Read the entire window back, excluding window decorations.
+	 *
+	 * @param surface Created with the contents of the window.
+	 * @return true on success, false otherwise
+	 */
+	bool readScreenshot(Graphics::Surface &surface) const;
+
+	/**
+	 * Start reading the window back into a pixel buffer object, without
+	 * waiting for the GPU to get there.
+	 *
+	 * @return false if pixel buffer objects are not available or a
+	 *         readback is already pending.
+	 */
+	bool beginScreenshotReadback();
+
+	/** Whether beginScreenshotReadback() waits for finishScreenshotReadback(). */
+	bool isScreenshotReadbackPending() const { return _screenshotReadbackPending; }
+
+	/**
+	 * Get the pixels requested by beginScreenshotReadback(). Called a frame
+	 * later, the transfer is done by then and this does not stall.
+	 *
+	 * @param surface Created with the contents of the window.
+	 * @return true on success, false otherwise
+	 */
+	bool finishScreenshotReadback(Graphics::Surface &surface);
+
 private:
+	/** Pixel buffer object of beginScreenshotReadback(). */
+	GLuint _screenshotBuffer;
+	uint _screenshotWidth, _screenshotHeight;
+	bool _screenshotReadbackPending;
+
 	//
 	// OpenGL utilities
 	//
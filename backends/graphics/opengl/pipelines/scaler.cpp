@@ -0,0 +1,67 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "backends/graphics/opengl/pipelines/scaler.h"
+#include "backends/graphics/opengl/framebuffer.h"
+#include "graphics/opengl/debug.h"
+
+#include "math/vector2d.h"
+
+namespace OpenGL {
+
+#if !USE_FORCED_GLES
+ScalerPipeline::ScalerPipeline(ShaderManager::ShaderUsage shader)
+	: ShaderPipeline(ShaderMan.query(shader)) {
+}
+
+bool ScalerPipeline::findShader(const char *scalerName, uint scaleFactor, ShaderManager::ShaderUsage &shader) {
+	const Common::String name(scalerName);
+
+	if (name == "normal") {
+		// Nearest filtering of the input does the whole job.
+		shader = ShaderManager::kDefault;
+	} else if (name == "advmame" && scaleFactor == 2) {
+		shader = ShaderManager::kScalerAdvMame2x;
+	} else if (name == "advmame" && scaleFactor == 3) {
+		shader = ShaderManager::kScalerAdvMame3x;
+	} else if (name == "tv" && scaleFactor == 2) {
+		shader = ShaderManager::kScalerTV;
+	} else if (name == "dotmatrix" && scaleFactor == 2) {
+		shader = ShaderManager::kScalerDotMatrix;
+	} else {
+		return false;
+	}
+
+	return true;
+}
+
+void ScalerPipeline::drawTextureInternal(const Texture &texture, const GLfloat *coordinates, const GLfloat *texcoords) {
+	assert(isActive());
+
+	_activeShader->setUniform("textureSize", Math::Vector2d(texture.getWidth(), texture.getHeight()));
+	_activeShader->setUniform("inputSize", Math::Vector2d(texture.getLogicalWidth(), texture.getLogicalHeight()));
+
+	ShaderPipeline::drawTextureInternal(texture, coordinates, texcoords);
+}
+#endif // !USE_FORCED_GLES
+
+} // End of namespace OpenGL
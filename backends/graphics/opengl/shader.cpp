@@ -78,6 +78,128 @@ const char *const g_lookUpFragmentShader =
 	"\tgl_FragColor = blendColor * texture2D(palette, vec2(index.a * adjustFactor, 0.0));\n"
 	"}\n";
 
+// The scaler shaders are drawn into a target of the scaled size with the
+// input texture at its logical size, nearest filtered. Each fragment works
+// out the source pixel and the part of it that it covers, the way the
+// software scalers write all output pixels of one source pixel at a time.
+#define SCALER_FRAGMENT_HEADER \
+	"varying vec2 texCoord;\n" \
+	"varying vec4 blendColor;\n" \
+	"\n" \
+	"uniform sampler2D shaderTexture;\n" \
+	"uniform vec2 textureSize;\n" \
+	"uniform vec2 inputSize;\n" \
+	"\n" \
+	"vec4 fetch(vec2 texel, vec2 offset) {\n" \
+	"\tvec2 pos = clamp(texel + offset, vec2(0.0), inputSize - 1.0);\n" \
+	"\treturn texture2D(shaderTexture, (pos + 0.5) / textureSize);\n" \
+	"}\n" \
+	"\n"
+
+const char *const g_advMame2xFragmentShader =
+	SCALER_FRAGMENT_HEADER
+	"void main(void) {\n"
+	"\tvec2 pos = texCoord * textureSize;\n"
+	"\tvec2 texel = floor(pos);\n"
+	"\tvec2 side = step(0.5, pos - texel) * 2.0 - 1.0;\n"
+	"\n"
+	"\tvec4 E = fetch(texel, vec2(0.0, 0.0));\n"
+	"\tvec4 X = fetch(texel, vec2(side.x, 0.0));\n"
+	"\tvec4 XO = fetch(texel, vec2(-side.x, 0.0));\n"
+	"\tvec4 Y = fetch(texel, vec2(0.0, side.y));\n"
+	"\tvec4 YO = fetch(texel, vec2(0.0, -side.y));\n"
+	"\n"
+	"\tvec4 result = E;\n"
+	"\tif (Y != YO && X != XO && X == Y)\n"
+	"\t\tresult = X;\n"
+	"\tgl_FragColor = blendColor * result;\n"
+	"}\n";
+
+const char *const g_advMame3xFragmentShader =
+	SCALER_FRAGMENT_HEADER
+	"void main(void) {\n"
+	"\tvec2 pos = texCoord * textureSize;\n"
+	"\tvec2 texel = floor(pos);\n"
+	"\tvec2 cell = floor((pos - texel) * 3.0);\n"
+	"\n"
+	"\tvec4 A = fetch(texel, vec2(-1.0, -1.0));\n"
+	"\tvec4 B = fetch(texel, vec2( 0.0, -1.0));\n"
+	"\tvec4 C = fetch(texel, vec2( 1.0, -1.0));\n"
+	"\tvec4 D = fetch(texel, vec2(-1.0,  0.0));\n"
+	"\tvec4 E = fetch(texel, vec2( 0.0,  0.0));\n"
+	"\tvec4 F = fetch(texel, vec2( 1.0,  0.0));\n"
+	"\tvec4 G = fetch(texel, vec2(-1.0,  1.0));\n"
+	"\tvec4 H = fetch(texel, vec2( 0.0,  1.0));\n"
+	"\tvec4 I = fetch(texel, vec2( 1.0,  1.0));\n"
+	"\n"
+	"\tvec4 result = E;\n"
+	"\tif (B != H && D != F) {\n"
+	"\t\tif (cell.y < 0.5) {\n"
+	"\t\t\tif (cell.x < 0.5)\n"
+	"\t\t\t\tresult = D == B ? D : E;\n"
+	"\t\t\telse if (cell.x < 1.5)\n"
+	"\t\t\t\tresult = ((D == B && E != C) || (F == B && E != A)) ? B : E;\n"
+	"\t\t\telse\n"
+	"\t\t\t\tresult = F == B ? F : E;\n"
+	"\t\t} else if (cell.y < 1.5) {\n"
+	"\t\t\tif (cell.x < 0.5)\n"
+	"\t\t\t\tresult = ((D == B && E != G) || (D == H && E != A)) ? D : E;\n"
+	"\t\t\telse if (cell.x > 1.5)\n"
+	"\t\t\t\tresult = ((F == B && E != I) || (F == H && E != C)) ? F : E;\n"
+	"\t\t} else {\n"
+	"\t\t\tif (cell.x < 0.5)\n"
+	"\t\t\t\tresult = D == H ? D : E;\n"
+	"\t\t\telse if (cell.x < 1.5)\n"
+	"\t\t\t\tresult = ((D == H && E != I) || (F == H && E != G)) ? H : E;\n"
+	"\t\t\telse\n"
+	"\t\t\t\tresult = F == H ? F : E;\n"
+	"\t\t}\n"
+	"\t}\n"
+	"\tgl_FragColor = blendColor * result;\n"
+	"}\n";
+
+const char *const g_tvFragmentShader =
+	SCALER_FRAGMENT_HEADER
+	"void main(void) {\n"
+	"\tvec2 pos = texCoord * textureSize;\n"
+	"\tvec2 texel = floor(pos);\n"
+	"\tvec4 color = fetch(texel, vec2(0.0, 0.0));\n"
+	"\n"
+	"\t// The lower line of every pixel is darkened to 7/8.\n"
+	"\tif (pos.y - texel.y >= 0.5)\n"
+	"\t\tcolor.rgb = floor(floor(color.rgb * 255.0 + 0.5) * 7.0 / 8.0) / 255.0;\n"
+	"\tgl_FragColor = blendColor * color;\n"
+	"}\n";
+
+const char *const g_dotMatrixFragmentShader =
+	SCALER_FRAGMENT_HEADER
+	"void main(void) {\n"
+	"\tvec2 pos = texCoord * textureSize;\n"
+	"\tvec4 color = fetch(floor(pos), vec2(0.0, 0.0));\n"
+	"\n"
+	"\t// Which channels lose a quarter of their value follows a 4x4\n"
+	"\t// pattern of output pixels: odd lines dim everything in every\n"
+	"\t// other pixel, even lines cycle through green, blue, red, none.\n"
+	"\tvec2 cell = mod(floor(pos * 2.0), 4.0);\n"
+	"\tvec3 mask = vec3(0.0);\n"
+	"\tif (mod(cell.y, 2.0) > 0.5) {\n"
+	"\t\tif (mod(cell.x, 2.0) < 0.5)\n"
+	"\t\t\tmask = vec3(1.0);\n"
+	"\t} else {\n"
+	"\t\tfloat k = mod(cell.x + cell.y, 4.0);\n"
+	"\t\tif (k < 0.5)\n"
+	"\t\t\tmask = vec3(0.0, 1.0, 0.0);\n"
+	"\t\telse if (k < 1.5)\n"
+	"\t\t\tmask = vec3(0.0, 0.0, 1.0);\n"
+	"\t\telse if (k < 2.5)\n"
+	"\t\t\tmask = vec3(1.0, 0.0, 0.0);\n"
+	"\t}\n"
+	"\tcolor.rgb -= mask * floor(floor(color.rgb * 255.0 + 0.5) / 4.0) / 255.0;\n"
+	"\tgl_FragColor = blendColor * color;\n"
+	"}\n";
+
+#undef SCALER_FRAGMENT_HEADER
+
 } // End of anonymous namespace
 
 ShaderManager::ShaderManager() {
@@ -106,6 +228,10 @@ void ShaderManager::notifyCreate() {
 	_builtIn[kDefault] = Shader::fromStrings("default", g_defaultVertexShader, g_defaultFragmentShader, g_defaultShaderAttributes, 110);
 	_builtIn[kCLUT8LookUp] = Shader::fromStrings("clut8lookup", g_defaultVertexShader, g_lookUpFragmentShader, g_defaultShaderAttributes, 110);
 	_builtIn[kCLUT8LookUp]->setUniform("palette", 1);
+	_builtIn[kScalerAdvMame2x] = Shader::fromStrings("advmame2x", g_defaultVertexShader, g_advMame2xFragmentShader, g_defaultShaderAttributes, 110);
+	_builtIn[kScalerAdvMame3x] = Shader::fromStrings("advmame3x", g_defaultVertexShader, g_advMame3xFragmentShader, g_defaultShaderAttributes, 110);
+	_builtIn[kScalerTV] = Shader::fromStrings("tv", g_defaultVertexShader, g_tvFragmentShader, g_defaultShaderAttributes, 110);
+	_builtIn[kScalerDotMatrix] = Shader::fromStrings("dotmatrix", g_defaultVertexShader, g_dotMatrixFragmentShader, g_defaultShaderAttributes, 110);
 
 	for (uint i = 0; i < kMaxUsages; ++i) {
 		_builtIn[i]->setUniform("shaderTexture", 0);
@@ -41,6 +41,18 @@ public:
 		/** CLUT8 look up shader. */
 		kCLUT8LookUp,
 
+		/** Scale2x, as done by the AdvMame2x scaler. */
+		kScalerAdvMame2x,
+
+		/** Scale3x, as done by the AdvMame3x scaler. */
+		kScalerAdvMame3x,
+
+		/** Scan lines, as done by the TV scaler. */
+		kScalerTV,
+
+		/** Dot pattern, as done by the DotMatrix scaler. */
+		kScalerDotMatrix,
+
 		/** Number of built-in shaders. Should not be used for query. */
 		kMaxUsages
 	};
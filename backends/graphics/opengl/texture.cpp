@@ -23,6 +23,8 @@
 #include "backends/graphics/opengl/shader.h"
 #include "backends/graphics/opengl/pipelines/pipeline.h"
 #include "backends/graphics/opengl/pipelines/clut8.h"
+#include "backends/graphics/opengl/pipelines/scaler.h"
+#include "backends/graphics/opengl/pipelines/shader.h"
 #include "backends/graphics/opengl/framebuffer.h"
 #include "graphics/opengl/debug.h"
 
@@ -43,8 +45,23 @@ namespace OpenGL {
 // Surface
 //
 
+namespace {
+
+enum {
+	// Pixels of unchanged area which may be added by merging two dirty
+	// rects, on top of what they cover together. This is less than the
+	// cost of an extra upload.
+	kDirtyMergeSlack = 64 * 64
+};
+
+uint rectArea(const Common::Rect &r) {
+	return r.width() * r.height();
+}
+
+} // End of anonymous namespace
+
 Surface::Surface()
-	: _allDirty(false), _dirtyArea() {
+	: _allDirty(false), _dirtyRects() {
 }
 
 void Surface::copyRectToTexture(uint x, uint y, uint w, uint h, const void *srcPtr, uint srcPitch) {
@@ -85,22 +102,57 @@ void Surface::fill(const Common::Rect &r, uint32 color) {
 }
 
 void Surface::addDirtyArea(const Common::Rect &r) {
-	// *sigh* Common::Rect::extend behaves unexpected whenever one of the two
-	// parameters is an empty rect. Thus, we check whether the current dirty
-	// area is valid. In case it is not we simply use the parameters as new
-	// dirty area. Otherwise, we simply call extend.
-	if (_dirtyArea.isEmpty()) {
-		_dirtyArea = r;
-	} else {
-		_dirtyArea.extend(r);
+	// Common::Rect::extend behaves unexpected whenever one of the two
+	// parameters is an empty rect, so those are never kept.
+	if (_allDirty || r.isEmpty()) {
+		return;
+	}
+
+	// Merge with every rect the union with which adds little unchanged
+	// area. Start over after each merge, as the bigger rect might now be
+	// worth merging with rects checked before.
+	Common::Rect area = r;
+	for (uint i = 0; i < _dirtyRects.size();) {
+		Common::Rect merged = _dirtyRects[i];
+		merged.extend(area);
+
+		if (rectArea(merged) <= rectArea(_dirtyRects[i]) + rectArea(area) + kDirtyMergeSlack) {
+			area = merged;
+			_dirtyRects.remove_at(i);
+			i = 0;
+		} else {
+			++i;
+		}
 	}
+
+	if (_dirtyRects.size() < kMaxDirtyRects) {
+		_dirtyRects.push_back(area);
+		return;
+	}
+
+	// No room left: extend the rect which grows the least from it.
+	uint best = 0;
+	uint bestGrowth = 0xFFFFFFFF;
+	for (uint i = 0; i < _dirtyRects.size(); ++i) {
+		Common::Rect merged = _dirtyRects[i];
+		merged.extend(area);
+
+		const uint growth = rectArea(merged) - rectArea(_dirtyRects[i]);
+		if (growth < bestGrowth) {
+			best = i;
+			bestGrowth = growth;
+		}
+	}
+	_dirtyRects[best].extend(area);
 }
 
-Common::Rect Surface::getDirtyArea() const {
+Surface::DirtyRectList Surface::getDirtyRects() const {
 	if (_allDirty) {
-		return Common::Rect(getWidth(), getHeight());
+		DirtyRectList all;
+		all.push_back(Common::Rect(getWidth(), getHeight()));
+		return all;
 	} else {
-		return _dirtyArea;
+		return _dirtyRects;
 	}
 }
 
@@ -111,6 +163,8 @@ Common::Rect Surface::getDirtyArea() const {
 TextureSurface::TextureSurface(GLenum glIntFormat, GLenum glFormat, GLenum glType, const Graphics::PixelFormat &format)
 	: Surface(), _format(format), _glTexture(glIntFormat, glFormat, glType),
 	  _textureData(), _userPixelData() {
+	// Most of these are updated all the time, e.g. the game screen.
+	_glTexture.enablePixelBuffers(true);
 }
 
 TextureSurface::~TextureSurface() {
@@ -161,15 +215,19 @@ void TextureSurface::updateGLTexture() {
 		return;
 	}
 
-	Common::Rect dirtyArea = getDirtyArea();
+	DirtyRectList dirtyRects = getDirtyRects();
 
-	updateGLTexture(dirtyArea);
+	updateGLTexture(dirtyRects);
 }
 
-void TextureSurface::updateGLTexture(Common::Rect &dirtyArea) {
-	// In case we use linear filtering we might need to duplicate the last
-	// pixel row/column to avoid glitches with filtering.
-	if (_glTexture.isLinearFilteringEnabled()) {
+void TextureSurface::updateGLTexture(DirtyRectList &dirtyRects) {
+	for (Common::Rect &dirtyArea : dirtyRects) {
+		// In case we use linear filtering we might need to duplicate the last
+		// pixel row/column to avoid glitches with filtering.
+		if (!_glTexture.isLinearFilteringEnabled()) {
+			continue;
+		}
+
 		if (dirtyArea.right == _userPixelData.w && _userPixelData.w != _textureData.w) {
 			uint height = dirtyArea.height();
 
@@ -196,7 +254,7 @@ void TextureSurface::updateGLTexture(Common::Rect &dirtyArea) {
 		}
 	}
 
-	_glTexture.updateArea(dirtyArea, _textureData);
+	_glTexture.updateAreas(dirtyRects.data(), dirtyRects.size(), _textureData);
 
 	// We should have handled everything, thus not dirty anymore.
 	clearDirty();
@@ -279,17 +337,22 @@ void FakeTextureSurface::updateGLTexture() {
 	}
 
 	// Convert color space.
-	Graphics::Surface *outSurf = TextureSurface::getSurface();
+	const DirtyRectList dirtyRects = getDirtyRects();
+	for (const Common::Rect &dirtyArea : dirtyRects) {
+		convertArea(dirtyArea);
+	}
 
-	const Common::Rect dirtyArea = getDirtyArea();
+	// Do generic handling of updating the texture.
+	TextureSurface::updateGLTexture();
+}
+
+void FakeTextureSurface::convertArea(const Common::Rect &dirtyArea) {
+	Graphics::Surface *outSurf = TextureSurface::getSurface();
 
 	byte *dst = (byte *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top);
 	const byte *src = (const byte *)_rgbData.getBasePtr(dirtyArea.left, dirtyArea.top);
 
 	applyPaletteAndMask(dst, src, outSurf->pitch, _rgbData.pitch, _rgbData.w, dirtyArea, outSurf->format, _rgbData.format);
-
-	// Do generic handling of updating the texture.
-	TextureSurface::updateGLTexture();
 }
 
 void FakeTextureSurface::applyPaletteAndMask(byte *dst, const byte *src, uint dstPitch, uint srcPitch, uint srcWidth, const Common::Rect &dirtyArea, const Graphics::PixelFormat &dstFormat, const Graphics::PixelFormat &srcFormat) const {
@@ -330,16 +393,10 @@ TextureSurfaceRGB555::TextureSurfaceRGB555()
 	: FakeTextureSurface(GL_RGB, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0), Graphics::PixelFormat(2, 5, 5, 5, 0, 10, 5, 0, 0)) {
 }
 
-void TextureSurfaceRGB555::updateGLTexture() {
-	if (!isDirty()) {
-		return;
-	}
-
+void TextureSurfaceRGB555::convertArea(const Common::Rect &dirtyArea) {
 	// Convert color space.
 	Graphics::Surface *outSurf = TextureSurface::getSurface();
 
-	const Common::Rect dirtyArea = getDirtyArea();
-
 	uint16 *dst = (uint16 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top);
 	const uint dstAdd = outSurf->pitch - 2 * dirtyArea.width();
 
@@ -358,9 +415,6 @@ void TextureSurfaceRGB555::updateGLTexture() {
 		src = (const uint16 *)((const byte *)src + srcAdd);
 		dst = (uint16 *)((byte *)dst + dstAdd);
 	}
-
-	// Do generic handling of updating the texture.
-	TextureSurface::updateGLTexture();
 }
 
 TextureSurfaceRGBA8888Swap::TextureSurfaceRGBA8888Swap()
@@ -372,16 +426,10 @@ TextureSurfaceRGBA8888Swap::TextureSurfaceRGBA8888Swap()
 	  {
 }
 
-void TextureSurfaceRGBA8888Swap::updateGLTexture() {
-	if (!isDirty()) {
-		return;
-	}
-
+void TextureSurfaceRGBA8888Swap::convertArea(const Common::Rect &dirtyArea) {
 	// Convert color space.
 	Graphics::Surface *outSurf = TextureSurface::getSurface();
 
-	const Common::Rect dirtyArea = getDirtyArea();
-
 	uint32 *dst = (uint32 *)outSurf->getBasePtr(dirtyArea.left, dirtyArea.top);
 	const uint dstAdd = outSurf->pitch - 4 * dirtyArea.width();
 
@@ -398,9 +446,6 @@ void TextureSurfaceRGBA8888Swap::updateGLTexture() {
 		src = (const uint32 *)((const byte *)src + srcAdd);
 		dst = (uint32 *)((byte *)dst + dstAdd);
 	}
-
-	// Do generic handling of updating the texture.
-	TextureSurface::updateGLTexture();
 }
 
 #ifdef USE_SCALERS
@@ -444,11 +489,19 @@ void ScaledTextureSurface::updateGLTexture() {
 		return;
 	}
 
+	DirtyRectList dirtyRects = getDirtyRects();
+	for (Common::Rect &dirtyArea : dirtyRects) {
+		scaleArea(dirtyArea);
+	}
+
+	// Do generic handling of updating the texture.
+	TextureSurface::updateGLTexture(dirtyRects);
+}
+
+void ScaledTextureSurface::scaleArea(Common::Rect &dirtyArea) {
 	// Convert color space.
 	Graphics::Surface *outSurf = TextureSurface::getSurface();
 
-	Common::Rect dirtyArea = getDirtyArea();
-
 	// Extend the dirty region for scalers
 	// that "smear" the screen, e.g. 2xSAI
 	dirtyArea.grow(_extraPixels);
@@ -484,9 +537,6 @@ void ScaledTextureSurface::updateGLTexture() {
 	dirtyArea.right  *= _scaleFactor;
 	dirtyArea.top    *= _scaleFactor;
 	dirtyArea.bottom *= _scaleFactor;
-
-	// Do generic handling of updating the texture.
-	TextureSurface::updateGLTexture(dirtyArea);
 }
 
 void ScaledTextureSurface::setScaler(uint scalerIndex, int scaleFactor) {
@@ -520,35 +570,40 @@ void ScaledTextureSurface::setScaler(uint scalerIndex, int scaleFactor) {
 TextureSurfaceCLUT8GPU::TextureSurfaceCLUT8GPU()
 	: _clut8Texture(GL_ALPHA, GL_ALPHA, GL_UNSIGNED_BYTE),
 	  _paletteTexture(GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE),
-	  _target(new TextureTarget()), _clut8Pipeline(new CLUT8LookUpPipeline()),
-	  _clut8Vertices(), _clut8Data(), _userPixelData(), _palette(),
-	  _paletteDirty(false) {
+	  _maskTexture(GL_ALPHA, GL_ALPHA, GL_UNSIGNED_BYTE),
+	  _target(new TextureTarget()), _clut8Pipeline(nullptr), _maskPipeline(nullptr),
+	  _clut8Vertices(), _clut8Data(), _userPixelData(), _maskData(), _palette(),
+	  _paletteDirty(false), _maskDirty(false) {
 	// Allocate space for 256 colors.
 	_paletteTexture.setSize(256, 1);
+	_clut8Texture.enablePixelBuffers(true);
 
-	// Setup pipeline.
-	_clut8Pipeline->setFramebuffer(_target);
-	_clut8Pipeline->setPaletteTexture(&_paletteTexture);
-	_clut8Pipeline->setColor(1.0f, 1.0f, 1.0f, 1.0f);
+	createPipelines();
 }
 
 TextureSurfaceCLUT8GPU::~TextureSurfaceCLUT8GPU() {
 	delete _clut8Pipeline;
+	delete _maskPipeline;
 	delete _target;
 	_clut8Data.free();
+	_maskData.free();
 }
 
 void TextureSurfaceCLUT8GPU::destroy() {
 	_clut8Texture.destroy();
 	_paletteTexture.destroy();
+	_maskTexture.destroy();
 	_target->destroy();
 	delete _clut8Pipeline;
 	_clut8Pipeline = nullptr;
+	delete _maskPipeline;
+	_maskPipeline = nullptr;
 }
 
 void TextureSurfaceCLUT8GPU::recreate() {
 	_clut8Texture.create();
 	_paletteTexture.create();
+	_maskTexture.create();
 	_target->create();
 
 	// In case image date exists assure it will be completely refreshed next
@@ -557,7 +612,14 @@ void TextureSurfaceCLUT8GPU::recreate() {
 		flagDirty();
 		_paletteDirty = true;
 	}
+	if (_maskData.getPixels()) {
+		_maskDirty = true;
+	}
 
+	createPipelines();
+}
+
+void TextureSurfaceCLUT8GPU::createPipelines() {
 	if (_clut8Pipeline == nullptr) {
 		_clut8Pipeline = new CLUT8LookUpPipeline();
 		// Setup pipeline.
@@ -565,6 +627,14 @@ void TextureSurfaceCLUT8GPU::recreate() {
 		_clut8Pipeline->setPaletteTexture(&_paletteTexture);
 		_clut8Pipeline->setColor(1.0f, 1.0f, 1.0f, 1.0f);
 	}
+
+	if (_maskPipeline == nullptr) {
+		// Draws the alpha of the mask, which the blend mode multiplies
+		// the looked up colors with.
+		_maskPipeline = new ShaderPipeline(ShaderMan.query(ShaderManager::kDefault));
+		_maskPipeline->setFramebuffer(_target);
+		_maskPipeline->setColor(1.0f, 1.0f, 1.0f, 1.0f);
+	}
 }
 
 void TextureSurfaceCLUT8GPU::enableLinearFiltering(bool enable) {
@@ -586,6 +656,12 @@ void TextureSurfaceCLUT8GPU::allocate(uint width, uint height) {
 	// Create a sub-buffer for raw access.
 	_userPixelData = _clut8Data.getSubArea(Common::Rect(width, height));
 
+	// A mask for the old size does not apply anymore.
+	if (_maskData.getPixels() && (_maskData.w != (int)width || _maskData.h != (int)height)) {
+		_maskData.free();
+		_maskDirty = false;
+	}
+
 	// Setup structures for internal rendering to _glTexture.
 	_clut8Vertices[0] = 0;
 	_clut8Vertices[1] = 0;
@@ -606,6 +682,34 @@ void TextureSurfaceCLUT8GPU::allocate(uint width, uint height) {
 	flagDirty();
 }
 
+void TextureSurfaceCLUT8GPU::setMask(const byte *mask) {
+	if (mask) {
+		const uint width = _userPixelData.w;
+		const uint height = _userPixelData.h;
+
+		if (_maskData.w != (int)width || _maskData.h != (int)height) {
+			_maskData.create(width, height, Graphics::PixelFormat::createFormatCLUT8());
+			_maskTexture.setSize(width, height);
+		}
+
+		// The mask holds 0 for transparent and 1 for opaque pixels, the
+		// texture the alpha value to multiply the colors with.
+		for (uint y = 0; y < height; ++y) {
+			byte *dst = (byte *)_maskData.getBasePtr(0, y);
+			for (uint x = 0; x < width; ++x) {
+				dst[x] = *mask++ ? 0xFF : 0x00;
+			}
+		}
+
+		_maskDirty = true;
+	} else if (_maskData.getPixels()) {
+		_maskData.free();
+
+		// Look up the colors again without the mask.
+		_maskDirty = true;
+	}
+}
+
 Graphics::PixelFormat TextureSurfaceCLUT8GPU::getFormat() const {
 	return Graphics::PixelFormat::createFormatCLUT8();
 }
@@ -642,11 +746,12 @@ const Texture &TextureSurfaceCLUT8GPU::getGLTexture() const {
 }
 
 void TextureSurfaceCLUT8GPU::updateGLTexture() {
-	const bool needLookUp = Surface::isDirty() || _paletteDirty;
+	const bool needLookUp = Surface::isDirty() || _paletteDirty || _maskDirty;
 
 	// Update CLUT8 texture if necessary.
 	if (Surface::isDirty()) {
-		_clut8Texture.updateArea(getDirtyArea(), _clut8Data);
+		const DirtyRectList dirtyRects = getDirtyRects();
+		_clut8Texture.updateAreas(dirtyRects.data(), dirtyRects.size(), _clut8Data);
 		clearDirty();
 	}
 
@@ -665,6 +770,14 @@ void TextureSurfaceCLUT8GPU::updateGLTexture() {
 		_paletteDirty = false;
 	}
 
+	// Update mask if necessary.
+	if (_maskDirty) {
+		if (_maskData.getPixels()) {
+			_maskTexture.updateArea(Common::Rect(_maskData.w, _maskData.h), _maskData);
+		}
+		_maskDirty = false;
+	}
+
 	// In case any data changed, do color look up and store result in _target.
 	if (needLookUp) {
 		lookUpColors();
@@ -679,7 +792,140 @@ void TextureSurfaceCLUT8GPU::lookUpColors() {
 	_clut8Pipeline->drawTexture(_clut8Texture, _clut8Vertices);
 
 	_clut8Pipeline->deactivate();
+
+	// Clear the masked out pixels.
+	if (_maskData.getPixels()) {
+		_target->enableBlend(Framebuffer::kBlendModeMultiplyByAlpha);
+		_maskPipeline->activate();
+		_maskPipeline->drawTexture(_maskTexture, _clut8Vertices);
+		_maskPipeline->deactivate();
+		_target->enableBlend(Framebuffer::kBlendModeDisabled);
+	}
 }
 #endif // !USE_FORCED_GLES
 
+#if defined(USE_SCALERS) && !USE_FORCED_GLES
+ScaledTextureSurfaceGPU::ScaledTextureSurfaceGPU(GLenum glIntFormat, GLenum glFormat, GLenum glType, const Graphics::PixelFormat &format, const Graphics::PixelFormat &fakeFormat)
+	: FakeTextureSurface(glIntFormat, glFormat, glType, format, fakeFormat),
+	  _target(new TextureTarget()), _pipeline(nullptr), _scaledVertices(),
+	  _scalerIndex(0), _scaleFactor(1) {
+}
+
+ScaledTextureSurfaceGPU::~ScaledTextureSurfaceGPU() {
+	delete _pipeline;
+	delete _target;
+}
+
+void ScaledTextureSurfaceGPU::destroy() {
+	FakeTextureSurface::destroy();
+	_target->destroy();
+	delete _pipeline;
+	_pipeline = nullptr;
+}
+
+void ScaledTextureSurfaceGPU::recreate() {
+	FakeTextureSurface::recreate();
+	_target->create();
+	createPipeline();
+}
+
+void ScaledTextureSurfaceGPU::createPipeline() {
+	if (_pipeline) {
+		return;
+	}
+
+	const PluginList &scalerPlugins = ScalerMan.getPlugins();
+	const ScalerPluginObject &scalerPlugin = scalerPlugins[_scalerIndex]->get<ScalerPluginObject>();
+
+	ShaderManager::ShaderUsage shader;
+	if (!ScalerPipeline::findShader(scalerPlugin.getName(), _scaleFactor, shader)) {
+		// createSurface only picks this surface for supported scalers.
+		warning("OpenGL: No scaler shader for '%s' at %dx", scalerPlugin.getName(), _scaleFactor);
+		shader = ShaderManager::kDefault;
+	}
+
+	_pipeline = new ScalerPipeline(shader);
+	_pipeline->setFramebuffer(_target);
+	_pipeline->setColor(1.0f, 1.0f, 1.0f, 1.0f);
+}
+
+void ScaledTextureSurfaceGPU::enableLinearFiltering(bool enable) {
+	// The scaler shaders need the input pixels unfiltered, so only the
+	// scaled result is filtered.
+	_target->getTexture()->enableLinearFiltering(enable);
+}
+
+void ScaledTextureSurfaceGPU::allocate(uint width, uint height) {
+	FakeTextureSurface::allocate(width, height);
+
+	const uint scaledWidth = width * _scaleFactor;
+	const uint scaledHeight = height * _scaleFactor;
+	_target->setSize(scaledWidth, scaledHeight, Common::kRotationNormal);
+
+	_scaledVertices[0] = 0;
+	_scaledVertices[1] = 0;
+
+	_scaledVertices[2] = scaledWidth;
+	_scaledVertices[3] = 0;
+
+	_scaledVertices[4] = 0;
+	_scaledVertices[5] = scaledHeight;
+
+	_scaledVertices[6] = scaledWidth;
+	_scaledVertices[7] = scaledHeight;
+
+	flagDirty();
+}
+
+const Texture &ScaledTextureSurfaceGPU::getGLTexture() const {
+	return *_target->getTexture();
+}
+
+void ScaledTextureSurfaceGPU::updateGLTexture() {
+	if (!isDirty()) {
+		return;
+	}
+
+	// Upload the changed areas at their logical size.
+	FakeTextureSurface::updateGLTexture();
+
+	scaleTexture();
+}
+
+void ScaledTextureSurfaceGPU::scaleTexture() {
+	createPipeline();
+
+	_pipeline->activate();
+	_pipeline->drawTexture(FakeTextureSurface::getGLTexture(), _scaledVertices);
+	_pipeline->deactivate();
+}
+
+void ScaledTextureSurfaceGPU::setScaler(uint scalerIndex, int scaleFactor) {
+	const PluginList &scalerPlugins = ScalerMan.getPlugins();
+	const ScalerPluginObject &scalerPlugin = scalerPlugins[scalerIndex]->get<ScalerPluginObject>();
+
+	// Resolve the factor the same way the software scaler would.
+	uint factor = scaleFactor;
+	if (!scalerPlugin.hasFactor(factor)) {
+		factor = scalerPlugin.getDefaultFactor();
+	}
+
+	if (scalerIndex != _scalerIndex || factor != _scaleFactor) {
+		delete _pipeline;
+		_pipeline = nullptr;
+	}
+
+	_scalerIndex = scalerIndex;
+	_scaleFactor = factor;
+}
+
+bool ScaledTextureSurfaceGPU::isSupportedByScaler(uint scalerIndex, uint scaleFactor) {
+	const PluginList &scalerPlugins = ScalerMan.getPlugins();
+	const ScalerPluginObject &scalerPlugin = scalerPlugins[scalerIndex]->get<ScalerPluginObject>();
+
+	ShaderManager::ShaderUsage shader;
+	return ScalerPipeline::findShader(scalerPlugin.getName(), scaleFactor, shader);
+}
+#endif
+
 } // End of namespace OpenGL
@@ -29,6 +29,7 @@
 #include "graphics/pixelformat.h"
 #include "graphics/surface.h"
 
+#include "common/array.h"
 #include "common/rect.h"
 
 class Scaler;
@@ -99,7 +100,7 @@ public:
 	void fill(const Common::Rect &r, uint32 color);
 
 	void flagDirty() { _allDirty = true; }
-	virtual bool isDirty() const { return _allDirty || !_dirtyArea.isEmpty(); }
+	virtual bool isDirty() const { return _allDirty || !_dirtyRects.empty(); }
 
 	virtual uint getWidth() const = 0;
 	virtual uint getHeight() const = 0;
@@ -139,13 +140,29 @@ public:
 	 */
 	virtual const Texture &getGLTexture() const = 0;
 protected:
-	void clearDirty() { _allDirty = false; _dirtyArea = Common::Rect(); }
+	enum {
+		/** The most rects kept apart before the closest ones are merged. */
+		kMaxDirtyRects = 8
+	};
 
+	typedef Common::SmallArray<Common::Rect, kMaxDirtyRects> DirtyRectList;
+
+	void clearDirty() { _allDirty = false; _dirtyRects.clear(); }
+
+	/**
+	 * Mark an area as changed.
+	 *
+	 * Areas which overlap or are close to each other are merged, as long
+	 * as that does not add much unchanged area, so that a few small
+	 * changes far apart do not make the whole surface be uploaded again.
+	 */
 	void addDirtyArea(const Common::Rect &r);
-	Common::Rect getDirtyArea() const;
+
+	/** The areas changed since the last update, the whole surface if flagged dirty. */
+	DirtyRectList getDirtyRects() const;
 private:
 	bool _allDirty;
-	Common::Rect _dirtyArea;
+	DirtyRectList _dirtyRects;
 };
 
 /**
@@ -189,7 +206,11 @@ public:
 protected:
 	const Graphics::PixelFormat _format;
 
-	void updateGLTexture(Common::Rect &dirtyArea);
+	/**
+	 * Upload the given areas of the texture data. The areas may be
+	 * extended to the edge pixels duplicated for linear filtering.
+	 */
+	void updateGLTexture(DirtyRectList &dirtyRects);
 
 private:
 	Texture _glTexture;
@@ -218,6 +239,9 @@ public:
 
 	void updateGLTexture() override;
 protected:
+	/** Convert an area of the user data into the texture data. */
+	virtual void convertArea(const Common::Rect &dirtyArea);
+
 	void applyPaletteAndMask(byte *dst, const byte *src, uint dstPitch, uint srcPitch, uint srcWidth, const Common::Rect &dirtyArea, const Graphics::PixelFormat &dstFormat, const Graphics::PixelFormat &srcFormat) const;
 
 	Graphics::Surface _rgbData;
@@ -231,7 +255,8 @@ public:
 	TextureSurfaceRGB555();
 	~TextureSurfaceRGB555() override {}
 
-	void updateGLTexture() override;
+protected:
+	void convertArea(const Common::Rect &dirtyArea) override;
 };
 
 class TextureSurfaceRGBA8888Swap : public FakeTextureSurface {
@@ -239,7 +264,8 @@ public:
 	TextureSurfaceRGBA8888Swap();
 	~TextureSurfaceRGBA8888Swap() override {}
 
-	void updateGLTexture() override;
+protected:
+	void convertArea(const Common::Rect &dirtyArea) override;
 };
 
 #ifdef USE_SCALERS
@@ -263,6 +289,9 @@ public:
 
 	void setScaler(uint scalerIndex, int scaleFactor) override;
 protected:
+	/** Scale an area into the texture data, and turn it into the area of the texture. */
+	void scaleArea(Common::Rect &dirtyArea);
+
 	Graphics::Surface *_convData;
 	Scaler *_scaler;
 	uint _scalerIndex;
@@ -274,7 +303,14 @@ protected:
 #if !USE_FORCED_GLES
 class TextureTarget;
 class CLUT8LookUpPipeline;
+class ShaderPipeline;
 
+/**
+ * A CLUT8 surface whose colors are looked up on the GPU.
+ *
+ * Only the changed indices and the 256x1 palette are uploaded, so palette
+ * changes, e.g. for color cycling, cost no conversion at all.
+ */
 class TextureSurfaceCLUT8GPU : public Surface {
 public:
 	TextureSurfaceCLUT8GPU();
@@ -287,8 +323,9 @@ public:
 	void enableLinearFiltering(bool enable) override;
 
 	void allocate(uint width, uint height) override;
+	void setMask(const byte *mask) override;
 
-	bool isDirty() const override { return _paletteDirty || Surface::isDirty(); }
+	bool isDirty() const override { return _paletteDirty || _maskDirty || Surface::isDirty(); }
 
 	uint getWidth() const override { return _userPixelData.w; }
 	uint getHeight() const override { return _userPixelData.h; }
@@ -312,24 +349,82 @@ public:
 		    && OpenGLContext.framebufferObjectSupported;
 	}
 private:
+	void createPipelines();
 	void lookUpColors();
 
 	Texture _clut8Texture;
 	Texture _paletteTexture;
+	Texture _maskTexture;
 
 	TextureTarget *_target;
 	CLUT8LookUpPipeline *_clut8Pipeline;
+	ShaderPipeline *_maskPipeline;
 
 	GLfloat _clut8Vertices[4*2];
 
 	Graphics::Surface _clut8Data;
 	Graphics::Surface _userPixelData;
+	Graphics::Surface _maskData;
 
 	byte _palette[4 * 256];
 	bool _paletteDirty;
+	bool _maskDirty;
 };
 #endif // !USE_FORCED_GLES
 
+#if defined(USE_SCALERS) && !USE_FORCED_GLES
+class ScalerPipeline;
+
+/**
+ * A surface scaled on the GPU by the built-in shader matching a scaler
+ * plugin.
+ *
+ * The image is uploaded at its logical size and drawn into a texture
+ * target of the scaled size, which is what gets displayed. See
+ * ScalerPipeline::findShader for the scalers this can be used for.
+ */
+class ScaledTextureSurfaceGPU : public FakeTextureSurface {
+public:
+	ScaledTextureSurfaceGPU(GLenum glIntFormat, GLenum glFormat, GLenum glType, const Graphics::PixelFormat &format, const Graphics::PixelFormat &fakeFormat);
+	~ScaledTextureSurfaceGPU() override;
+
+	void destroy() override;
+
+	void recreate() override;
+
+	void enableLinearFiltering(bool enable) override;
+
+	void allocate(uint width, uint height) override;
+
+	void updateGLTexture() override;
+	const Texture &getGLTexture() const override;
+
+	void setScaler(uint scalerIndex, int scaleFactor) override;
+
+	static bool isSupportedByContext() {
+		return OpenGLContext.shadersSupported
+		    && OpenGLContext.framebufferObjectSupported;
+	}
+
+	/**
+	 * @return Whether the scaler with the given factor can be done on the
+	 *         GPU.
+	 */
+	static bool isSupportedByScaler(uint scalerIndex, uint scaleFactor);
+private:
+	void createPipeline();
+	void scaleTexture();
+
+	TextureTarget *_target;
+	ScalerPipeline *_pipeline;
+
+	GLfloat _scaledVertices[4*2];
+
+	uint _scalerIndex;
+	uint _scaleFactor;
+};
+#endif
+
 } // End of namespace OpenGL
 
 #endif
@@ -338,6 +338,8 @@ void OpenGLSdlGraphicsManager::initSize(uint w, uint h, const Graphics::PixelFor
 }
 
 void OpenGLSdlGraphicsManager::updateScreen() {
+	updateScreenshots();
+
 #if SDL_VERSION_ATLEAST(2, 0, 0)
 	static uint32 lastUpdateTime = 0;
 
@@ -551,6 +553,25 @@ bool OpenGLSdlGraphicsManager::saveScreenshot(const Common::Path &filename) cons
 	return OpenGLGraphicsManager::saveScreenshot(filename);
 }
 
+SdlGraphicsManager::ScreenshotCapture OpenGLSdlGraphicsManager::captureScreenshot(SdlScreenshotWriter::Screenshot &shot) {
+	// The pixels are fetched from the pack buffer on the next frame, by
+	// then the GPU is done and mapping it does not stall
+	if (beginScreenshotReadback()) {
+		return kScreenshotPending;
+	}
+
+	return readScreenshot(shot.surface) ? kScreenshotCaptured : kScreenshotFailed;
+}
+
+SdlGraphicsManager::ScreenshotCapture OpenGLSdlGraphicsManager::completeScreenshotCapture(SdlScreenshotWriter::Screenshot &shot) {
+	if (!isScreenshotReadbackPending()) {
+		// The context was destroyed in between
+		return kScreenshotFailed;
+	}
+
+	return finishScreenshotReadback(shot.surface) ? kScreenshotCaptured : kScreenshotFailed;
+}
+
 bool OpenGLSdlGraphicsManager::setupMode(uint width, uint height) {
 	// In case we request a fullscreen mode we will use the mode the user
 	// has chosen last time or the biggest mode available.
@@ -63,6 +63,8 @@ protected:
 	void handleResizeImpl(const int width, const int height) override;
 
 	bool saveScreenshot(const Common::Path &filename) const override;
+	ScreenshotCapture captureScreenshot(SdlScreenshotWriter::Screenshot &shot) override;
+	ScreenshotCapture completeScreenshotCapture(SdlScreenshotWriter::Screenshot &shot) override;
 
 private:
 	bool setupMode(uint width, uint height);
@@ -69,7 +69,7 @@ static void getMouseState(int *x, int *y) {
 }
 
 SdlGraphicsManager::SdlGraphicsManager(SdlEventSource *source, SdlWindow *window)
-	: _eventSource(source), _window(window), _hwScreen(nullptr)
+	: _eventSource(source), _window(window), _hwScreen(nullptr), _pendingScreenshot(nullptr)
 #if SDL_VERSION_ATLEAST(2, 0, 0)
 	, _allowWindowSizeReset(false), _hintedWidth(0), _hintedHeight(0), _lastFlags(0)
 #endif
@@ -79,6 +79,10 @@ SdlGraphicsManager::SdlGraphicsManager(SdlEventSource *source, SdlWindow *window
 	getMouseState(&_cursorX, &_cursorY);
 }
 
+SdlGraphicsManager::~SdlGraphicsManager() {
+	delete _pendingScreenshot;
+}
+
 void SdlGraphicsManager::activateManager() {
 	_eventSource->setGraphicsManager(this);
 
@@ -444,7 +448,49 @@ void SdlGraphicsManager::saveScreenshot() {
 		}
 	}
 
-	if (saveScreenshot(screenshotsPath.appendComponent(filename))) {
+	// Copy the frame now and encode it on another thread. Another capture
+	// still being read back makes this one synchronous.
+	SdlScreenshotWriter::Screenshot *shot = new SdlScreenshotWriter::Screenshot(screenshotsPath, filename);
+	ScreenshotCapture capture = _pendingScreenshot ? kScreenshotFailed : captureScreenshot(*shot);
+	if (capture == kScreenshotFailed) {
+		delete shot;
+		screenshotSaved(screenshotsPath, filename, saveScreenshot(screenshotsPath.appendComponent(filename)));
+		return;
+	}
+
+	if (!shot->file.open(shot->getPath())) {
+		delete shot;
+		screenshotSaved(screenshotsPath, filename, false);
+		return;
+	}
+
+	if (capture == kScreenshotPending)
+		_pendingScreenshot = shot;
+	else
+		_screenshotWriter.write(shot);
+}
+
+void SdlGraphicsManager::updateScreenshots() {
+	if (_pendingScreenshot) {
+		ScreenshotCapture capture = completeScreenshotCapture(*_pendingScreenshot);
+		if (capture == kScreenshotCaptured) {
+			_screenshotWriter.write(_pendingScreenshot);
+			_pendingScreenshot = nullptr;
+		} else if (capture == kScreenshotFailed) {
+			screenshotSaved(_pendingScreenshot->directory, _pendingScreenshot->filename, false);
+			delete _pendingScreenshot;
+			_pendingScreenshot = nullptr;
+		}
+	}
+
+	while (SdlScreenshotWriter::Screenshot *shot = _screenshotWriter.takeFinished()) {
+		screenshotSaved(shot->directory, shot->filename, shot->success);
+		delete shot;
+	}
+}
+
+void SdlGraphicsManager::screenshotSaved(const Common::Path &screenshotsPath, const Common::String &filename, bool success) {
+	if (success) {
 		if (screenshotsPath.empty())
 			debug("Saved screenshot '%s' in current directory", filename.c_str());
 		else
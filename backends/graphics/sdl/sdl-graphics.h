@@ -23,6 +23,7 @@
 #define BACKENDS_GRAPHICS_SDL_SDLGRAPHICS_H
 
 #include "backends/graphics/windowed.h"
+#include "backends/graphics/sdl/sdl-screenshot.h"
 #include "backends/platform/sdl/sdl-window.h"
 
 #include "common/events.h"
@@ -38,7 +39,7 @@ class SdlEventSource;
 class SdlGraphicsManager : virtual public WindowedGraphicsManager, public Common::EventObserver {
 public:
 	SdlGraphicsManager(SdlEventSource *source, SdlWindow *window);
-	virtual ~SdlGraphicsManager() {}
+	virtual ~SdlGraphicsManager();
 
 	/**
 	 * Makes this graphics manager active. That means it should be ready to
@@ -152,6 +153,35 @@ protected:
 		kActionPreviousScaleFilter
 	};
 
+	enum ScreenshotCapture {
+		kScreenshotFailed,   ///< Nothing was captured
+		kScreenshotCaptured, ///< The frame has been copied into the screenshot
+		kScreenshotPending   ///< The frame is still on its way, see completeScreenshotCapture()
+	};
+
+	/**
+	 * Copy the current frame into shot.surface, and its palette if any, so
+	 * that saveScreenshot() can write it on another thread. When this
+	 * fails, saveScreenshot(const Common::Path &) is used instead.
+	 */
+	virtual ScreenshotCapture captureScreenshot(SdlScreenshotWriter::Screenshot &shot) { return kScreenshotFailed; }
+
+	/**
+	 * Finish a capture for which captureScreenshot() returned
+	 * kScreenshotPending. It is tried once per frame until it returns
+	 * something else.
+	 */
+	virtual ScreenshotCapture completeScreenshotCapture(SdlScreenshotWriter::Screenshot &shot) { return kScreenshotFailed; }
+
+	/**
+	 * Pass on pending captures and report the screenshots written since the
+	 * last call. Managers capturing asynchronously call it once per frame.
+	 */
+	void updateScreenshots();
+
+	/** Log the outcome of saving a screenshot and show it on the OSD. */
+	void screenshotSaved(const Common::Path &screenshotsPath, const Common::String &filename, bool success);
+
 	/** Obtain the user configured fullscreen resolution, or default to the desktop resolution */
 	Common::Rect getPreferredFullscreenResolution();
 
@@ -212,6 +242,9 @@ protected:
 private:
 	void toggleFullScreen();
 
+	SdlScreenshotWriter _screenshotWriter;
+	SdlScreenshotWriter::Screenshot *_pendingScreenshot;
+
 #if defined(USE_IMGUI) && SDL_VERSION_ATLEAST(2, 0, 0)
 public:
 	void setImGuiCallbacks(const ImGuiCallbacks &callbacks) override;
@@ -0,0 +1,103 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "common/scummsys.h"
+
+#if defined(SDL_BACKEND)
+
+#include "backends/graphics/sdl/sdl-screenshot.h"
+#include "common/textconsole.h"
+
+#ifdef USE_PNG
+#include "image/png.h"
+#else
+#include "image/bmp.h"
+#endif
+
+SdlScreenshotWriter::~SdlScreenshotWriter() {
+	for (uint i = 0; i < _jobs.size(); ++i) {
+		if (_jobs[i]->thread)
+			SDL_WaitThread(_jobs[i]->thread, nullptr);
+		delete _jobs[i]->shot;
+		delete _jobs[i];
+	}
+}
+
+void SdlScreenshotWriter::write(Screenshot *shot) {
+	Job *job = new Job();
+	job->shot = shot;
+	job->done = false;
+
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	job->thread = SDL_CreateThread(writeProc, "ScummVM Screenshot", job);
+#else
+	job->thread = SDL_CreateThread(writeProc, job);
+#endif
+	if (!job->thread) {
+		debug(1, "Could not create screenshot thread: %s", SDL_GetError());
+		encode(*shot);
+		job->done = true;
+	}
+
+	_jobs.push_back(job);
+}
+
+SdlScreenshotWriter::Screenshot *SdlScreenshotWriter::takeFinished() {
+	for (uint i = 0; i < _jobs.size(); ++i) {
+		Job *job = _jobs[i];
+		if (!job->done.load(std::memory_order_acquire))
+			continue;
+
+		if (job->thread)
+			SDL_WaitThread(job->thread, nullptr);
+
+		Screenshot *shot = job->shot;
+		_jobs.remove_at(i);
+		delete job;
+		return shot;
+	}
+	return nullptr;
+}
+
+int SdlScreenshotWriter::writeProc(void *data) {
+	Job *job = (Job *)data;
+	encode(*job->shot);
+	job->done.store(true, std::memory_order_release);
+	return 0;
+}
+
+void SdlScreenshotWriter::encode(Screenshot &shot) {
+	const byte *palette = shot.hasPalette ? shot.palette : nullptr;
+
+#ifdef USE_PNG
+	shot.success = Image::writePNG(shot.file, shot.surface, palette);
+#else
+	shot.success = Image::writeBMP(shot.file, shot.surface, palette);
+#endif
+	shot.success = shot.success && shot.file.flush() && !shot.file.err();
+	shot.file.close();
+
+	// The pixels are not needed any more, don't keep them around until polled
+	shot.surface.free();
+}
+
+#endif
@@ -0,0 +1,91 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef BACKENDS_GRAPHICS_SDL_SCREENSHOT_H
+#define BACKENDS_GRAPHICS_SDL_SCREENSHOT_H
+
+#include "backends/platform/sdl/sdl-sys.h"
+#include "common/array.h"
+#include "common/file.h"
+#include "common/noncopyable.h"
+#include "common/path.h"
+#include "common/str.h"
+#include "graphics/surface.h"
+
+#include <atomic>
+
+/**
+ * Encodes screenshots on threads of their own, so that the frame they are
+ * taken on only pays for copying the pixels.
+ *
+ * The graphics managers capture the frame into a Screenshot, write() hands
+ * it over and takeFinished() returns it once the file is written, on the
+ * thread polling it. Without threads the encoding happens in write().
+ */
+class SdlScreenshotWriter : Common::NonCopyable {
+public:
+	struct Screenshot : Common::NonCopyable {
+		Screenshot(const Common::Path &dir, const Common::String &name) : directory(dir), filename(name), hasPalette(false), success(false) {}
+		~Screenshot() { surface.free(); }
+
+		Common::Path getPath() const { return directory.appendComponent(filename); }
+
+		Common::Path directory;
+		Common::String filename;
+		/** Opened when the screenshot is taken, so the name stays reserved. */
+		Common::DumpFile file;
+
+		/** Owned copy of the frame. */
+		Graphics::Surface surface;
+		byte palette[256 * 3];
+		bool hasPalette;
+
+		bool success;
+	};
+
+	SdlScreenshotWriter() {}
+	/** Waits for the screenshots still being written, dropping them. */
+	~SdlScreenshotWriter();
+
+	/** Write shot->surface to shot->file, taking ownership of shot. */
+	void write(Screenshot *shot);
+
+	/**
+	 * Return a screenshot which was written since the last call, or null.
+	 * The caller owns it.
+	 */
+	Screenshot *takeFinished();
+
+private:
+	struct Job {
+		Screenshot *shot;
+		SDL_Thread *thread;
+		std::atomic<bool> done;
+	};
+
+	static int writeProc(void *data);
+	static void encode(Screenshot &shot);
+
+	Common::Array<Job *> _jobs;
+};
+
+#endif
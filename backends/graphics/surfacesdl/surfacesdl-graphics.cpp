@@ -190,7 +190,7 @@ SurfaceSdlGraphicsManager::SurfaceSdlGraphicsManager(SdlEventSource *sdlEventSou
 	_enableFocusRectDebugCode(false), _enableFocusRect(false), _focusRect(),
 #endif
 	_transactionMode(kTransactionNone),
-	_scalerPlugins(ScalerMan.getPlugins()), _scalerPlugin(nullptr), _scaler(nullptr),
+	_scalerPlugins(ScalerMan.getPlugins()), _scalerPlugin(nullptr), _scaler(nullptr), _scalerJobs(nullptr),
 	_needRestoreAfterOverlay(false), _isInOverlayPalette(false), _isDoubleBuf(false), _prevForceRedraw(false), _numPrevDirtyRects(0),
 	_prevCursorNeedsRedraw(false),
 	_mouseKeyColor(0), _disableMouseKeyColor(false) {
@@ -228,6 +228,10 @@ SurfaceSdlGraphicsManager::SurfaceSdlGraphicsManager(SdlEventSource *sdlEventSou
 	_scaler = nullptr;
 	_maxExtraPixels = ScalerMan.getMaxExtraPixels();
 
+	uint scalerThreads = ScalerJobPool::getConfiguredThreads();
+	if (scalerThreads > 1)
+		_scalerJobs = new ScalerJobPool(scalerThreads);
+
 	_videoMode.fullscreen = ConfMan.getBool("fullscreen");
 	_videoMode.filtering = ConfMan.getBool("filtering");
 #if SDL_VERSION_ATLEAST(2, 0, 0)
@@ -241,6 +245,7 @@ SurfaceSdlGraphicsManager::SurfaceSdlGraphicsManager(SdlEventSource *sdlEventSou
 
 SurfaceSdlGraphicsManager::~SurfaceSdlGraphicsManager() {
 	unloadGFXMode();
+	delete _scalerJobs;
 	delete _scaler;
 	delete _mouseScaler;
 	if (_mouseOrigSurface) {
@@ -1265,6 +1270,9 @@ bool SurfaceSdlGraphicsManager::hotswapGFXMode() {
 void SurfaceSdlGraphicsManager::updateScreen() {
 	assert(_transactionMode == kTransactionNone);
 
+	// Before locking, reporting a screenshot shows an OSD message
+	updateScreenshots();
+
 	Common::StackLock lock(_graphicsMutex);	// Lock the mutex until this function ends
 
 	internUpdateScreen();
@@ -1514,7 +1522,7 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 				if (_videoMode.aspectRatioCorrection && !_overlayInGUI)
 					dst_y = real2Aspect(dst_y);
 
-				_scaler->scale((byte *)srcSurf->pixels + (src_x + _maxExtraPixels) * bpp + (src_y + _maxExtraPixels) * srcPitch, srcPitch,
+				scaleRect((byte *)srcSurf->pixels + (src_x + _maxExtraPixels) * bpp + (src_y + _maxExtraPixels) * srcPitch, srcPitch,
 						(byte *)_hwScreen->pixels + dst_x * bpp + dst_y * dstPitch, dstPitch, dst_w, dst_h, src_x, src_y);
 
 				r->x = dst_x;
@@ -1665,6 +1673,49 @@ void SurfaceSdlGraphicsManager::internUpdateScreen() {
 #endif
 }
 
+void SurfaceSdlGraphicsManager::scaleRect(const byte *srcPtr, uint32 srcPitch, byte *dstPtr, uint32 dstPitch, int width, int height, int x, int y) {
+	// Scalers comparing against the previous source keep state between
+	// calls, and plain copies are not worth splitting up
+	if (_scalerJobs && !_useOldSrc && _scaler->getFactor() > 1)
+		_scalerJobs->scale(_scaler, srcPtr, srcPitch, dstPtr, dstPitch, width, height, x, y);
+	else
+		_scaler->scale(srcPtr, srcPitch, dstPtr, dstPitch, width, height, x, y);
+}
+
+SdlGraphicsManager::ScreenshotCapture SurfaceSdlGraphicsManager::captureScreenshot(SdlScreenshotWriter::Screenshot &shot) {
+	assert(_hwScreen != nullptr);
+
+	Common::StackLock lock(_graphicsMutex);
+
+	if (!lockSurface(_hwScreen)) {
+		warning("Could not lock RGB surface");
+		return kScreenshotFailed;
+	}
+
+	// Only the copy is done on this thread, see SdlScreenshotWriter
+	Graphics::Surface data;
+	data.init(_hwScreen->w, _hwScreen->h, _hwScreen->pitch, _hwScreen->pixels, convertSDLPixelFormat(_hwScreen->format));
+	shot.surface.copyFrom(data);
+
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+	SDL_Palette *sdlPalette = SDL_CreateSurfacePalette(_hwScreen);
+#else
+	SDL_Palette *sdlPalette = _hwScreen->format->palette;
+#endif
+	if (sdlPalette) {
+		for (int i = 0; i < sdlPalette->ncolors; i++) {
+			shot.palette[(i * 3) + 0] = sdlPalette->colors[i].r;
+			shot.palette[(i * 3) + 1] = sdlPalette->colors[i].g;
+			shot.palette[(i * 3) + 2] = sdlPalette->colors[i].b;
+		}
+		shot.hasPalette = true;
+	}
+
+	SDL_UnlockSurface(_hwScreen);
+
+	return kScreenshotCaptured;
+}
+
 bool SurfaceSdlGraphicsManager::saveScreenshot(const Common::Path &filename) const {
 	assert(_hwScreen != nullptr);
 
@@ -2085,9 +2136,9 @@ void SurfaceSdlGraphicsManager::clearOverlay() {
 	}
 
 #if SDL_VERSION_ATLEAST(3, 0, 0)
-	_scaler->scale((byte *)(_tmpscreen->pixels) + _maxExtraPixels * _tmpscreen->pitch + _maxExtraPixels * pixelFormatDetails->bytes_per_pixel, _tmpscreen->pitch,
+	scaleRect((byte *)(_tmpscreen->pixels) + _maxExtraPixels * _tmpscreen->pitch + _maxExtraPixels * pixelFormatDetails->bytes_per_pixel, _tmpscreen->pitch,
 #else
-	_scaler->scale((byte *)(_tmpscreen->pixels) + _maxExtraPixels * _tmpscreen->pitch + _maxExtraPixels * _tmpscreen->format->BytesPerPixel, _tmpscreen->pitch,
+	scaleRect((byte *)(_tmpscreen->pixels) + _maxExtraPixels * _tmpscreen->pitch + _maxExtraPixels * _tmpscreen->format->BytesPerPixel, _tmpscreen->pitch,
 #endif
 	(byte *)_overlayscreen->pixels, _overlayscreen->pitch, _videoMode.screenWidth, _videoMode.screenHeight, 0, 0);
 
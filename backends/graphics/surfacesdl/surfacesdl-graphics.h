@@ -24,6 +24,7 @@
 
 #include "backends/graphics/graphics.h"
 #include "backends/graphics/sdl/sdl-graphics.h"
+#include "backends/graphics/surfacesdl/surfacesdl-scalerjobs.h"
 #include "graphics/pixelformat.h"
 #include "graphics/scaler.h"
 #include "graphics/scalerplugin.h"
@@ -343,6 +344,8 @@ protected:
 	const PluginList &_scalerPlugins;
 	ScalerPluginObject *_scalerPlugin;
 	Scaler *_scaler, *_mouseScaler;
+	/** Worker threads for the game screen scaler, null when running serially */
+	ScalerJobPool *_scalerJobs;
 	uint _maxExtraPixels;
 	uint _extraPixels;
 
@@ -435,6 +438,8 @@ protected:
 	virtual void blitCursor();
 
 	virtual void internUpdateScreen();
+	/** Run _scaler on a rect, on several threads when possible. */
+	void scaleRect(const byte *srcPtr, uint32 srcPitch, byte *dstPtr, uint32 dstPitch, int width, int height, int x, int y);
 	virtual void updateScreen(SDL_Rect *dirtyRectList, int actualDirtyRects);
 
 	virtual bool loadGFXMode();
@@ -446,6 +451,7 @@ protected:
 	void setVSync(bool enable);
 
 	bool saveScreenshot(const Common::Path &filename) const override;
+	ScreenshotCapture captureScreenshot(SdlScreenshotWriter::Screenshot &shot) override;
 	virtual void setGraphicsModeIntern();
 	virtual void getDefaultResolution(uint &w, uint &h);
 
@@ -0,0 +1,161 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#if defined(SDL_BACKEND)
+
+#include "backends/graphics/surfacesdl/surfacesdl-scalerjobs.h"
+#include "common/config-manager.h"
+#include "common/textconsole.h"
+#include "graphics/scalerplugin.h"
+
+enum {
+	// Bands smaller than this are not worth the synchronization
+	kMinBandHeight = 16
+};
+
+ScalerJobPool::ScalerJobPool(uint numThreads) : _quit(false) {
+	assert(numThreads > 0);
+
+	_done = SDL_CreateSemaphore(0);
+	if (!_done)
+		error("SDL_CreateSemaphore failed: %s", SDL_GetError());
+
+	for (uint i = 1; i < numThreads; ++i) {
+		Worker *worker = new Worker();
+		worker->pool = this;
+		worker->start = SDL_CreateSemaphore(0);
+		if (!worker->start)
+			error("SDL_CreateSemaphore failed: %s", SDL_GetError());
+
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+		worker->thread = SDL_CreateThread(workerProc, "ScummVM Scaler", worker);
+#else
+		worker->thread = SDL_CreateThread(workerProc, worker);
+#endif
+		if (!worker->thread) {
+			warning("Could not create scaler thread: %s", SDL_GetError());
+			SDL_DestroySemaphore(worker->start);
+			delete worker;
+			break;
+		}
+		_workers.push_back(worker);
+	}
+}
+
+ScalerJobPool::~ScalerJobPool() {
+	_quit = true;
+	for (uint i = 0; i < _workers.size(); ++i) {
+		post(_workers[i]->start);
+		SDL_WaitThread(_workers[i]->thread, nullptr);
+		SDL_DestroySemaphore(_workers[i]->start);
+		delete _workers[i];
+	}
+	SDL_DestroySemaphore(_done);
+}
+
+uint ScalerJobPool::getConfiguredThreads() {
+	int threads = ConfMan.getInt("scaler_threads");
+	if (threads <= 0) {
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+		threads = SDL_GetNumLogicalCPUCores();
+#elif SDL_VERSION_ATLEAST(2, 0, 0)
+		threads = SDL_GetCPUCount();
+#else
+		// No way to know, stay on the safe side
+		threads = 1;
+#endif
+	}
+	return CLIP(threads, 1, 16);
+}
+
+void ScalerJobPool::scale(Scaler *scaler, const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr,
+                          uint32 dstPitch, int width, int height, int x, int y) {
+	uint numBands = MIN<uint>(getNumThreads(), height / kMinBandHeight);
+	if (numBands <= 1) {
+		scaler->scale(srcPtr, srcPitch, dstPtr, dstPitch, width, height, x, y);
+		return;
+	}
+
+	const uint factor = scaler->getFactor();
+	const int bandHeight = height / numBands;
+
+	// Hand out all bands but the last one, which is done by this thread
+	int row = 0;
+	for (uint i = 0; i < numBands - 1; ++i) {
+		Job &job = _workers[i]->job;
+		job.scaler = scaler;
+		job.srcPtr = srcPtr + row * srcPitch;
+		job.srcPitch = srcPitch;
+		job.dstPtr = dstPtr + row * factor * dstPitch;
+		job.dstPitch = dstPitch;
+		job.width = width;
+		job.height = bandHeight;
+		job.x = x;
+		job.y = y + row;
+		post(_workers[i]->start);
+		row += bandHeight;
+	}
+
+	scaler->scale(srcPtr + row * srcPitch, srcPitch, dstPtr + row * factor * dstPitch, dstPitch,
+	              width, height - row, x, y + row);
+
+	for (uint i = 0; i < numBands - 1; ++i)
+		wait(_done);
+}
+
+void ScalerJobPool::Job::run() const {
+	scaler->scale(srcPtr, srcPitch, dstPtr, dstPitch, width, height, x, y);
+}
+
+int ScalerJobPool::workerProc(void *data) {
+	Worker *worker = (Worker *)data;
+	ScalerJobPool *pool = worker->pool;
+
+	for (;;) {
+		wait(worker->start);
+		if (pool->_quit)
+			break;
+
+		worker->job.run();
+		post(pool->_done);
+	}
+	return 0;
+}
+
+void ScalerJobPool::post(Semaphore *sem) {
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+	SDL_SignalSemaphore(sem);
+#else
+	SDL_SemPost(sem);
+#endif
+}
+
+void ScalerJobPool::wait(Semaphore *sem) {
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+	SDL_WaitSemaphore(sem);
+#else
+	SDL_SemWait(sem);
+#endif
+}
+
+#endif
@@ -0,0 +1,100 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef BACKENDS_GRAPHICS_SURFACESDL_SCALERJOBS_H
+#define BACKENDS_GRAPHICS_SURFACESDL_SCALERJOBS_H
+
+#include "backends/platform/sdl/sdl-sys.h"
+#include "common/array.h"
+#include "common/noncopyable.h"
+
+class Scaler;
+
+/**
+ * Runs a software scaler on several threads at once.
+ *
+ * A rect is cut into horizontal bands which are scaled in parallel, one
+ * per thread, the calling thread included. The bands share the padded
+ * source surface, so scalers which look at neighboring pixels read the
+ * rows around their band directly and the output is the same as when
+ * scaling the whole rect in one go. Only stateless scalers may be used
+ * this way; scalers keeping the previous source (see
+ * ScalerPluginObject::useOldSource) must be called directly.
+ */
+class ScalerJobPool : Common::NonCopyable {
+public:
+	/**
+	 * @param numThreads Number of threads scaling, including the caller.
+	 */
+	explicit ScalerJobPool(uint numThreads);
+	~ScalerJobPool();
+
+	/**
+	 * Scale a rect, with the same parameters as Scaler::scale. Returns
+	 * once all bands are done.
+	 */
+	void scale(Scaler *scaler, const uint8 *srcPtr, uint32 srcPitch, uint8 *dstPtr,
+	           uint32 dstPitch, int width, int height, int x, int y);
+
+	uint getNumThreads() const { return _workers.size() + 1; }
+
+	/**
+	 * Number of threads to use according to the "scaler_threads" setting:
+	 * 0 picks the number of CPU cores, 1 disables threading.
+	 */
+	static uint getConfiguredThreads();
+
+private:
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+	typedef SDL_Semaphore Semaphore;
+#else
+	typedef SDL_sem Semaphore;
+#endif
+
+	struct Job {
+		Scaler *scaler;
+		const uint8 *srcPtr;
+		uint32 srcPitch;
+		uint8 *dstPtr;
+		uint32 dstPitch;
+		int width, height, x, y;
+
+		void run() const;
+	};
+
+	struct Worker {
+		ScalerJobPool *pool;
+		SDL_Thread *thread;
+		Semaphore *start;
+		Job job;
+	};
+
+	static int workerProc(void *data);
+
+	static void post(Semaphore *sem);
+	static void wait(Semaphore *sem);
+
+	Common::Array<Worker *> _workers;
+	Semaphore *_done;
+	bool _quit;
+};
+
+#endif
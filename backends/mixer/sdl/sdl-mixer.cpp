@@ -28,6 +28,7 @@
 #include "common/system.h"
 #include "common/config-manager.h"
 #include "common/textconsole.h"
+#include "common/timer.h"
 
 #if defined(PLAYSTATION3) || defined(PSP2) || defined(NINTENDO_SWITCH)
 #define SAMPLES_PER_SEC 48000
@@ -37,13 +38,46 @@
 #define SAMPLES_PER_SEC 44100
 #endif
 
+#if !SDL_VERSION_ATLEAST(3, 0, 0)
+enum {
+	// The adaptive buffer starts at about 12 ms at 44.1 kHz...
+	kAdaptiveMinSamples = 512,
+	// ...and grows up to about 190 ms
+	kAdaptiveMaxSamples = 8192,
+	kAdaptiveCheckInterval = 1000 * 1000,
+	// Late buffers per check which make the buffer grow
+	kAdaptiveUnderrunLimit = 2
+};
+#endif
+
+#if !SDL_VERSION_ATLEAST(3, 0, 0)
+static bool isAdaptiveBufferEnabled() {
+	return ConfMan.hasKey("audio_buffer_adaptive", Common::ConfigManager::kApplicationDomain) &&
+		ConfMan.getBool("audio_buffer_adaptive", Common::ConfigManager::kApplicationDomain);
+}
+#endif
+
 SdlMixerManager::SdlMixerManager() : _isSubsystemInitialized(false), _isAudioOpen(false) {
+#if !SDL_VERSION_ATLEAST(3, 0, 0)
+	_adaptiveBuffer = false;
+	_lastUnderrunCount = 0;
+	_maxSamples = kAdaptiveMaxSamples;
+#endif
 }
 
 SdlMixerManager::~SdlMixerManager() {
-	if (_mixer)
+#if !SDL_VERSION_ATLEAST(3, 0, 0)
+	if (_adaptiveBuffer)
+		g_system->getTimerManager()->removeTimerProc(adaptiveBufferTimer);
+#endif
+
+	if (_mixer) {
 		_mixer->setReady(false);
 
+		if (_mixer->getUnderrunCount())
+			debug(1, "SdlMixerManager: %u audio buffers were late", _mixer->getUnderrunCount());
+	}
+
 #if SDL_VERSION_ATLEAST(3, 0, 0)
 	SDL_CloseAudioDevice(SDL_GetAudioStreamDevice(_stream));
 	SDL_DestroyAudioStream(_stream);
@@ -144,9 +178,20 @@ void SdlMixerManager::init() {
 
 	_mixer = new Audio::MixerImpl(_obtained.freq, _obtained.channels >= 2, desiredSamples);
 	assert(_mixer);
+	// Sum the channels in 32 bits and clamp once per buffer
+	_mixer->setWideMixBus(true);
 	_mixer->setReady(true);
 
 	startAudio();
+
+#if !SDL_VERSION_ATLEAST(3, 0, 0)
+	// Mixer managers are set up before the timer manager on some ports
+	Common::TimerManager *timer = g_system->getTimerManager();
+	if (isAdaptiveBufferEnabled() && timer) {
+		_lastUnderrunCount = _mixer->getUnderrunCount();
+		_adaptiveBuffer = timer->installTimerProc(adaptiveBufferTimer, kAdaptiveCheckInterval, this, "SdlMixerManager's adaptive buffer");
+	}
+#endif
 }
 
 #if !SDL_VERSION_ATLEAST(3, 0, 0)
@@ -199,6 +244,15 @@ SDL_AudioSpec SdlMixerManager::getAudioSpec(uint32 outputRate) {
 
 	// 256 is an arbitrary minimum; 32768 is the largest power-of-two value
 	// representable with uint16
+#if !SDL_VERSION_ATLEAST(3, 0, 0)
+	// Start small, adaptBufferSize() grows it when the host can't keep up.
+	// A configured buffer size is the largest it may grow to.
+	if (isAdaptiveBufferEnabled()) {
+		if (samples >= kAdaptiveMinSamples && samples <= kAdaptiveMaxSamples)
+			_maxSamples = roundDownPowerOfTwo(samples);
+		samples = kAdaptiveMinSamples;
+	} else
+#endif
 	if (samples < 256 || samples > 32768)
 		// By default, hold no more than 45ms worth of samples to avoid
 		// perceptable audio lag (ATSC IS-191). For reference, DOSBox (as of Sep
@@ -259,7 +313,51 @@ void SdlMixerManager::sdl3Callback(void *userdata, SDL_AudioStream *stream, int
 }
 #endif
 
+#if !SDL_VERSION_ATLEAST(3, 0, 0)
+void SdlMixerManager::adaptiveBufferTimer(void *this_) {
+	((SdlMixerManager *)this_)->adaptBufferSize();
+}
+
+void SdlMixerManager::adaptBufferSize() {
+	Common::StackLock lock(_deviceMutex);
+
+	const uint32 underruns = _mixer->getUnderrunCount();
+	const uint32 late = underruns - _lastUnderrunCount;
+	_lastUnderrunCount = underruns;
+
+	if (_audioSuspended || !_isAudioOpen || late < kAdaptiveUnderrunLimit || _obtained.samples >= _maxSamples)
+		return;
+
+	const uint16 samples = _obtained.samples * 2;
+	debug(1, "SdlMixerManager: %u late audio buffers, growing the output buffer to %u samples", late, samples);
+
+	if (!reopenAudio(samples) && !reopenAudio(_obtained.samples)) {
+		warning("Could not reopen audio device: %s", SDL_GetError());
+		_isAudioOpen = false;
+	}
+
+	// Reopening the device is late too
+	_lastUnderrunCount = _mixer->getUnderrunCount();
+}
+
+bool SdlMixerManager::reopenAudio(uint16 samples) {
+	SDL_CloseAudio();
+
+	// As in resumeAudio(), let SDL convert to the format the mixer was created for
+	SDL_AudioSpec fmt = _obtained;
+	fmt.samples = samples;
+	if (SDL_OpenAudio(&fmt, nullptr) != 0)
+		return false;
+
+	_obtained.samples = samples;
+	_mixer->setOutputBufSize(samples);
+	SDL_PauseAudio(0);
+	return true;
+}
+#endif
+
 void SdlMixerManager::suspendAudio() {
+	Common::StackLock lock(_deviceMutex);
 #if SDL_VERSION_ATLEAST(3, 0, 0)
 	SDL_CloseAudioDevice(SDL_GetAudioStreamDevice(_stream));
 	SDL_DestroyAudioStream(_stream);
@@ -270,6 +368,7 @@ void SdlMixerManager::suspendAudio() {
 }
 
 int SdlMixerManager::resumeAudio() {
+	Common::StackLock lock(_deviceMutex);
 	if (!_audioSuspended)
 		return -2;
 #if SDL_VERSION_ATLEAST(3, 0, 0)
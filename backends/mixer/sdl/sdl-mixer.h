@@ -24,6 +24,7 @@
 
 #include "backends/platform/sdl/sdl-sys.h"
 #include "backends/mixer/mixer.h"
+#include "common/mutex.h"
 
 /**
  * SDL mixer manager. It wraps the actual implementation
@@ -84,6 +85,28 @@ protected:
 	static void sdl3Callback(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount);
 #endif
 
+#if !SDL_VERSION_ATLEAST(3, 0, 0)
+	/**
+	 * Grows the output buffer when the mixer counted too many late
+	 * buffers since the last check. Used with "audio_buffer_adaptive".
+	 */
+	void adaptBufferSize();
+
+	static void adaptiveBufferTimer(void *this_);
+
+	/**
+	 * Reopens the audio device with the given buffer size in samples
+	 */
+	bool reopenAudio(uint16 samples);
+
+	bool _adaptiveBuffer;
+	uint32 _lastUnderrunCount;
+	uint16 _maxSamples;
+#endif
+
+	/** Serializes the timer thread reopening the device with suspendAudio()/resumeAudio() */
+	Common::Mutex _deviceMutex;
+
 	bool _isSubsystemInitialized;
 	bool _isAudioOpen;
 
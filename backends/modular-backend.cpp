@@ -27,6 +27,7 @@
 #include "gui/EventRecorder.h"
 
 #include "common/timer.h"
+#include "common/profiler.h"
 #include "graphics/pixelformat.h"
 
 ModularGraphicsBackend::ModularGraphicsBackend()
@@ -173,6 +174,10 @@ void ModularGraphicsBackend::copyRectToScreen(const void *buf, int pitch, int x,
 	_graphicsManager->copyRectToScreen(buf, pitch, x, y, w, h);
 }
 
+bool ModularGraphicsBackend::copyYUVRectToScreen(const Graphics::YUVSurface &src, int x, int y) {
+	return _graphicsManager->copyYUVRectToScreen(src, x, y);
+}
+
 Graphics::Surface *ModularGraphicsBackend::lockScreen() {
 	return _graphicsManager->lockScreen();
 }
@@ -190,6 +195,8 @@ void ModularGraphicsBackend::fillScreen(const Common::Rect &r, uint32 col) {
 }
 
 void ModularGraphicsBackend::updateScreen() {
+	PROFILE_ZONE("OSystem::updateScreen");
+
 #ifdef ENABLE_EVENTRECORDER
 	g_system->getMillis();		// force event recorder to update the tick count
 	g_eventRec.processScreenUpdate();
@@ -98,6 +98,7 @@ public:
 	int16 getWidth() override final;
 	PaletteManager *getPaletteManager() override final;
 	void copyRectToScreen(const void *buf, int pitch, int x, int y, int w, int h) override final;
+	bool copyYUVRectToScreen(const Graphics::YUVSurface &src, int x, int y) override final;
 	Graphics::Surface *lockScreen() override final;
 	void unlockScreen() override final;
 	void fillScreen(uint32 col) override final;
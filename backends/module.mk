@@ -177,6 +177,7 @@ MODULE_OBJS += \
 	graphics/opengl/pipelines/pipeline.o \
 	graphics/opengl/pipelines/libretro.o \
 	graphics/opengl/pipelines/libretro/parser.o \
+	graphics/opengl/pipelines/scaler.o \
 	graphics/opengl/pipelines/shader.o
 endif
 
@@ -187,10 +188,13 @@ ifdef SDL_BACKEND
 MODULE_OBJS += \
 	events/sdl/sdl-common-events.o \
 	graphics/sdl/sdl-graphics.o \
+	graphics/sdl/sdl-screenshot.o \
 	graphics/surfacesdl/surfacesdl-graphics.o \
+	graphics/surfacesdl/surfacesdl-scalerjobs.o \
 	mixer/sdl/sdl-mixer.o \
 	mixer/null/null-mixer.o \
 	mutex/sdl/sdl-mutex.o \
+	threadpool/sdl/sdl-threadpool.o \
 	timer/sdl/sdl-timer.o
 
 ifndef USE_SDL3
@@ -55,10 +55,10 @@ void SessionRequest::openLocalFile(const Common::Path &localFile) {
 	_localFile = new Common::DumpFile();
 	if (!_localFile->open(localFile, true)) {
 		warning("SessionRequestFile: unable to open file to download into");
-		ErrorResponse error(this, false, true, "SessionRequestFile: unable to open file to download into", -1);
-		finishError(error);
 		delete _localFile;
 		_localFile = nullptr;
+		ErrorResponse error(this, false, true, "SessionRequestFile: unable to open file to download into", -1);
+		finishError(error);
 		return;
 	}
 
@@ -99,6 +99,14 @@ char *SessionRequest::getPreparedContents() {
 void SessionRequest::finishError(const ErrorResponse &error, RequestState state) {
 	_complete = true;
 	_success = false;
+
+	// keep what was received, so that a download could be resumed
+	if (_localFile) {
+		_localFile->close();
+		delete _localFile;
+		_localFile = nullptr;
+	}
+
 	CurlRequest::finishError(error, PAUSED);
 }
 
@@ -158,7 +166,8 @@ void SessionRequest::handle() {
 	if (!_stream) _stream = makeStream();
 
 	if (_stream) {
-		if (_stream->httpResponseCode() != 200 && _stream->httpResponseCode() != 0) {
+		// 206 Partial Content is the answer to a Range header
+		if (_stream->httpResponseCode() != 200 && _stream->httpResponseCode() != 206 && _stream->httpResponseCode() != 0) {
 			warning("SessionRequest: HTTP response code is not 200 OK (it's %ld)", _stream->httpResponseCode());
 			ErrorResponse error(this, false, true, "HTTP response code is not 200 OK", _stream->httpResponseCode());
 			finishError(error);
@@ -243,6 +252,10 @@ bool SessionRequest::success() {
 	return _success;
 }
 
+long SessionRequest::httpResponseCode() const {
+	return _stream ? _stream->httpResponseCode() : 0;
+}
+
 char *SessionRequest::text() {
 	if (_binary || _localFile)
 		return nullptr;
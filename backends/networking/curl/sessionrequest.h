@@ -90,6 +90,9 @@ public:
 	bool complete();
 	bool success();
 
+	/** Returns the HTTP response code once the response headers are received, 0 before that. */
+	long httpResponseCode() const;
+
 	char *text();
 	Common::JSONValue *json();
 
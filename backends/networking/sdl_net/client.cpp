@@ -24,17 +24,20 @@
 #include "backends/networking/sdl_net/client.h"
 #include "backends/networking/sdl_net/localwebserver.h"
 #include "common/memstream.h"
+#include "common/system.h"
 #include <SDL_net.h>
 
 namespace Networking {
 
 Client::Client():
 	_state(INVALID), _set(nullptr), _socket(nullptr), _handler(nullptr),
-	_previousHandler(nullptr), _stream(nullptr), _buffer(new byte[CLIENT_BUFFER_SIZE]) {}
+	_previousHandler(nullptr), _stream(nullptr), _buffer(new byte[CLIENT_BUFFER_SIZE]),
+	_sliceStart(0), _sliceLength(0) {}
 
 Client::Client(SDLNet_SocketSet set, TCPsocket socket):
 	_state(INVALID), _set(nullptr), _socket(nullptr), _handler(nullptr),
-	_previousHandler(nullptr), _stream(nullptr), _buffer(new byte[CLIENT_BUFFER_SIZE]) {
+	_previousHandler(nullptr), _stream(nullptr), _buffer(new byte[CLIENT_BUFFER_SIZE]),
+	_sliceStart(0), _sliceLength(0) {
 	open(set, socket);
 }
 
@@ -73,8 +76,8 @@ bool Client::readMoreIfNeeded() {
 		return true; //not needed, some data left in the stream
 	if (!_socket)
 		return false;
-	if (!SDLNet_SocketReady(_socket))
-		return false;
+	if (!SDLNet_SocketReady(_socket) && !pollSocket())
+		return _reader.hasBufferedBytes(); //nothing new, but Reader might still have something to parse
 
 	int bytes = SDLNet_TCP_Recv(_socket, _buffer, CLIENT_BUFFER_SIZE);
 	if (bytes <= 0) {
@@ -140,7 +143,9 @@ void Client::setHandler(ClientHandler *handler) {
 	_handler = handler;
 }
 
-void Client::handle() {
+void Client::handle(uint32 timeSlice) {
+	_sliceStart = g_system->getMillis();
+	_sliceLength = timeSlice;
 	if (_state != BEING_HANDLED)
 		warning("handle() called in a wrong Client's state");
 	if (!_handler)
@@ -189,8 +194,20 @@ Common::String Client::anchor() const { return _reader.anchor(); }
 
 bool Client::noMoreContent() const { return _reader.noMoreContent(); }
 
+bool Client::hasTimeLeft() const {
+	return _state == BEING_HANDLED && g_system->getMillis() - _sliceStart < _sliceLength;
+}
+
 bool Client::socketIsReady() { return SDLNet_SocketReady(_socket); }
 
+bool Client::pollSocket() {
+	if (!_set || !_socket)
+		return false;
+	if (SDLNet_CheckSockets(_set, 0) <= 0)
+		return false;
+	return SDLNet_SocketReady(_socket);
+}
+
 int Client::recv(void *data, int maxlen) { return SDLNet_TCP_Recv(_socket, data, maxlen); }
 
 int Client::send(void *data, int len) { return SDLNet_TCP_Send(_socket, data, len); }
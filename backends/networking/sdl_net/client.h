@@ -80,6 +80,7 @@ class Client {
 	ClientHandler *_handler, *_previousHandler;
 	Common::MemoryReadWriteStream *_stream;
 	byte *_buffer;
+	uint32 _sliceStart, _sliceLength;
 
 	bool readMoreIfNeeded();
 
@@ -95,9 +96,20 @@ public:
 	bool readBlockHeaders(Common::WriteStream *stream);
 	bool readBlockContent(Common::WriteStream *stream);
 	void setHandler(ClientHandler *handler);
-	void handle();
+	void handle(uint32 timeSlice = 0);
 	void close();
 
+	/**
+	 * Return whether handler could go on working with
+	 * this client during current server tick.
+	 *
+	 * Client gets a time slice from LocalWebserver
+	 * every tick, so handlers which transfer a lot of
+	 * data could do several sends or receives at once,
+	 * while other clients still get their share.
+	 */
+	bool hasTimeLeft() const;
+
 	ClientState state() const;
 	Common::String headers() const;
 	Common::String method() const;
@@ -116,6 +128,14 @@ public:
 	 * when this is false.
 	 */
 	bool socketIsReady();
+
+	/**
+	 * Check the sockets again and return whether there is
+	 * something new to read. Unlike socketIsReady(), this
+	 * notices data which came after the server's last check.
+	 */
+	bool pollSocket();
+
 	int recv(void *data, int maxlen);
 	int send(void *data, int len);
 };
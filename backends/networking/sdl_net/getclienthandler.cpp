@@ -20,13 +20,15 @@
  */
 
 #include "backends/networking/sdl_net/getclienthandler.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 
 namespace Networking {
 
 GetClientHandler::GetClientHandler(Common::SeekableReadStream *stream):
 	_responseCode(200), _headersPrepared(false),
-	_stream(stream), _buffer(new byte[CLIENT_HANDLER_BUFFER_SIZE]) {}
+	_stream(stream), _buffer(new byte[CLIENT_HANDLER_BUFFER_SIZE]),
+	_sendWindow(CLIENT_HANDLER_INITIAL_WINDOW_SIZE) {}
 
 GetClientHandler::~GetClientHandler() {
 	delete _stream;
@@ -109,7 +111,7 @@ void GetClientHandler::prepareHeaders() {
 		setHeader("Content-Type", "text/html; charset=UTF-8");
 
 	if (!_specialHeaders.contains("Content-Length") && _stream)
-		setHeader("Content-Length", Common::String::format("%u", unsigned(_stream->size())));
+		setHeader("Content-Length", Common::String::format("%llu", (unsigned long long)_stream->size()));
 
 	_headers = Common::String::format("HTTP/1.1 %ld %s\r\n", _responseCode, responseMessage(_responseCode));
 	for (Common::HashMap<Common::String, Common::String>::iterator i = _specialHeaders.begin(); i != _specialHeaders.end(); ++i)
@@ -125,34 +127,52 @@ void GetClientHandler::handle(Client *client) {
 	if (!_headersPrepared)
 		prepareHeaders();
 
-	uint32 readBytes;
+	// keep sending while the client's time slice lasts
+	while (sendNextPart(client) && client->hasTimeLeft());
+}
 
-	// send headers first
+bool GetClientHandler::sendNextPart(Client *client) {
+	// send headers first, straight from the string
 	if (_headers.size() > 0) {
-		readBytes = _headers.size();
-		if (readBytes > CLIENT_HANDLER_BUFFER_SIZE)
-			readBytes = CLIENT_HANDLER_BUFFER_SIZE;
-		memcpy(_buffer, _headers.c_str(), readBytes);
-		_headers.erase(0, readBytes);
-	} else {
-		if (!_stream) {
+		if (client->send((void *)_headers.c_str(), _headers.size()) != (int)_headers.size()) {
+			warning("GetClientHandler: unable to send all bytes to the client");
 			client->close();
-			return;
+			return false;
 		}
+		_headers.clear();
+		return true;
+	}
 
-		readBytes = _stream->read(_buffer, CLIENT_HANDLER_BUFFER_SIZE);
+	if (!_stream) {
+		client->close();
+		return false;
 	}
 
-	if (readBytes != 0)
+	uint32 readBytes = _stream->read(_buffer, _sendWindow);
+	if (readBytes != 0) {
+		// send() blocks until everything is sent, so adapt the window to the client's speed:
+		// a slow one shouldn't hold the server for long, a fast one needs big sends
+		uint32 sendStart = g_system->getMillis();
 		if (client->send(_buffer, readBytes) != (int)readBytes) {
 			warning("GetClientHandler: unable to send all bytes to the client");
 			client->close();
-			return;
+			return false;
 		}
 
+		uint32 sendTime = g_system->getMillis() - sendStart;
+		if (sendTime <= 2 && _sendWindow < CLIENT_HANDLER_BUFFER_SIZE)
+			_sendWindow *= 2;
+		else if (sendTime > 20 && _sendWindow > CLIENT_HANDLER_MIN_WINDOW_SIZE)
+			_sendWindow /= 2;
+	}
+
 	// we're done here!
-	if (_stream->eos())
+	if (_stream->eos() || readBytes == 0) {
 		client->close();
+		return false;
+	}
+
+	return true;
 }
 
 void GetClientHandler::setHeader(const Common::String &name, const Common::String &value) { _specialHeaders[name] = value; }
@@ -30,6 +30,8 @@
 namespace Networking {
 
 #define CLIENT_HANDLER_BUFFER_SIZE 1 * 1024 * 1024
+#define CLIENT_HANDLER_MIN_WINDOW_SIZE 16 * 1024
+#define CLIENT_HANDLER_INITIAL_WINDOW_SIZE 64 * 1024
 
 class GetClientHandler: public ClientHandler {
 	Common::HashMap<Common::String, Common::String> _specialHeaders;
@@ -38,9 +40,11 @@ class GetClientHandler: public ClientHandler {
 	Common::String _headers;
 	Common::SeekableReadStream *_stream;
 	byte *_buffer;
+	uint32 _sendWindow;
 
 	static const char *responseMessage(long responseCode);
 	void prepareHeaders();
+	bool sendNextPart(Client *client);
 
 public:
 	GetClientHandler(Common::SeekableReadStream *stream);
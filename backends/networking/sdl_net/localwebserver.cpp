@@ -211,8 +211,10 @@ void LocalWebserver::handle() {
 		acceptClient();
 	}
 
+	// active clients share the tick, so one big transfer doesn't stall the others
+	uint32 timeSlice = HANDLE_TIME_BUDGET / MAX<uint32>(_clients, 1);
 	for (uint32 i = 0; i < MAX_CONNECTIONS; ++i)
-		handleClient(i);
+		handleClient(i, timeSlice);
 
 	_clients = 0;
 	for (uint32 i = 0; i < MAX_CONNECTIONS; ++i)
@@ -233,7 +235,7 @@ void LocalWebserver::handle() {
 	_handleMutex.unlock();
 }
 
-void LocalWebserver::handleClient(uint32 i) {
+void LocalWebserver::handleClient(uint32 i, uint32 timeSlice) {
 	switch (_client[i].state()) {
 	case INVALID:
 		return;
@@ -266,7 +268,7 @@ void LocalWebserver::handleClient(uint32 i) {
 		setClientGetHandler(_client[i], "<html><head><title>ScummVM - Bad Request</title></head><body>BAD REQUEST</body></html>", 400);
 		break;
 	case BEING_HANDLED:
-		_client[i].handle();
+		_client[i].handle(timeSlice);
 		break;
 	}
 }
@@ -275,21 +277,25 @@ void LocalWebserver::acceptClient() {
 	if (!SDLNet_SocketReady(_serverSocket))
 		return;
 
-	TCPsocket client = SDLNet_TCP_Accept(_serverSocket);
-	if (!client)
-		return;
+	// browsers open several connections at once, so accept all of them
+	// (server socket is non-blocking, Accept() returns nullptr when there are no more)
+	while (true) {
+		TCPsocket client = SDLNet_TCP_Accept(_serverSocket);
+		if (!client)
+			return;
 
-	if (_clients == MAX_CONNECTIONS) { //drop the connection
-		SDLNet_TCP_Close(client);
-		return;
-	}
-
-	++_clients;
-	for (uint32 i = 0; i < MAX_CONNECTIONS; ++i)
-		if (_client[i].state() == INVALID) {
-			_client[i].open(_set, client);
-			break;
+		if (_clients == MAX_CONNECTIONS) { //drop the connection
+			SDLNet_TCP_Close(client);
+			continue;
 		}
+
+		++_clients;
+		for (uint32 i = 0; i < MAX_CONNECTIONS; ++i)
+			if (_client[i].state() == INVALID) {
+				_client[i].open(_set, client);
+				break;
+			}
+	}
 }
 
 void LocalWebserver::resolveAddress(void *ipAddress) {
@@ -58,6 +58,7 @@ class LocalWebserver : public Common::Singleton<LocalWebserver> {
 	static const uint32 FRAMES_PER_SECOND = 20;
 	static const uint32 TIMER_INTERVAL = 1000000 / FRAMES_PER_SECOND;
 	static const uint32 MAX_CONNECTIONS = 10;
+	static const uint32 HANDLE_TIME_BUDGET = TIMER_INTERVAL / 1000 / 2; //ms of every tick shared by all clients
 
 	friend void localWebserverTimer(void *); //calls handle()
 
@@ -89,7 +90,7 @@ class LocalWebserver : public Common::Singleton<LocalWebserver> {
 	void startTimer(int interval = TIMER_INTERVAL);
 	void stopTimer();
 	void handle();
-	void handleClient(uint32 i);
+	void handleClient(uint32 i, uint32 timeSlice);
 	void acceptClient();
 	void resolveAddress(void *ipAddress);
 	void addPathHandler(const Common::String &path, BaseHandler *handler);
@@ -33,15 +33,17 @@ Reader::Reader() {
 	_content = nullptr;
 	_bytesLeft = 0;
 
+	_buffer = nullptr;
+	_bufferPos = 0;
+	_bufferEnd = 0;
+
 	_window = nullptr;
 	_windowUsed = 0;
 	_windowSize = 0;
-	_windowReadPosition = 0;
-	_windowWritePosition = 0;
-	_windowHash = 0;
 
 	_headersStream = nullptr;
 	_firstBlock = true;
+	_blockEndPending = false;
 
 	_contentLength = 0;
 	_availableBytes = 0;
@@ -63,12 +65,15 @@ Reader &Reader::operator=(Reader &r) {
 	_bytesLeft = r._bytesLeft;
 	r._state = RS_NONE;
 
+	_buffer = r._buffer;
+	_bufferPos = r._bufferPos;
+	_bufferEnd = r._bufferEnd;
+	r._buffer = nullptr;
+	r._bufferPos = r._bufferEnd = 0;
+
 	_window = r._window;
 	_windowUsed = r._windowUsed;
 	_windowSize = r._windowSize;
-	_windowReadPosition = r._windowReadPosition;
-	_windowWritePosition = r._windowWritePosition;
-	_windowHash = r._windowHash;
 	r._window = nullptr;
 
 	_headersStream = r._headersStream;
@@ -84,6 +89,7 @@ Reader &Reader::operator=(Reader &r) {
 	_boundary = r._boundary;
 	_availableBytes = r._availableBytes;
 	_firstBlock = r._firstBlock;
+	_blockEndPending = r._blockEndPending;
 	_isBadRequest = r._isBadRequest;
 	_allContentRead = r._allContentRead;
 
@@ -96,22 +102,14 @@ void Reader::cleanup() {
 	if (_headersStream != nullptr)
 		delete _headersStream;
 
+	delete[] _buffer;
+
 	if (_window != nullptr)
 		freeWindow();
 }
 
-namespace {
-uint32 calculateHash(const Common::String& boundary) {
-	uint32 result = 0;
-	for (uint32 i = 0; i < boundary.size(); ++i)
-		result ^= boundary[i];
-	return result;
-}
-}
-
 bool Reader::readAndHandleFirstHeaders() {
 	Common::String boundary = "\r\n\r\n";
-	uint32 boundaryHash = calculateHash(boundary);
 	if (_window == nullptr) {
 		makeWindow(boundary.size());
 	}
@@ -119,14 +117,13 @@ bool Reader::readAndHandleFirstHeaders() {
 		_headersStream = new Common::MemoryReadWriteStream(DisposeAfterUse::YES);
 	}
 
-	while (readOneByteInStream(_headersStream, boundary, boundaryHash)) {
-		if (_headersStream->size() > SUSPICIOUS_HEADERS_SIZE) {
-			_isBadRequest = true;
-			return true;
-		}
-		if (!bytesLeft())
-			return false;
+	bool found = readUntilBoundary(_headersStream, boundary);
+	if (_headersStream->size() > SUSPICIOUS_HEADERS_SIZE) {
+		_isBadRequest = true;
+		return true;
 	}
+	if (!found)
+		return false;
 	handleFirstHeaders(_headersStream);
 
 	freeWindow();
@@ -136,13 +133,10 @@ bool Reader::readAndHandleFirstHeaders() {
 
 bool Reader::readBlockHeadersIntoStream(Common::WriteStream *stream) {
 	Common::String boundary = "\r\n\r\n";
-	uint32 boundaryHash = calculateHash(boundary);
 	if (_window == nullptr) makeWindow(boundary.size());
 
-	while (readOneByteInStream(stream, boundary, boundaryHash)) {
-		if (!bytesLeft())
-			return false;
-	}
+	if (!readUntilBoundary(stream, boundary))
+		return false;
 	if (stream) stream->flush();
 
 	freeWindow();
@@ -305,11 +299,8 @@ bool Reader::readContentIntoStream(Common::WriteStream *stream) {
 	if (_window == nullptr)
 		makeWindow(boundary.size());
 
-	uint32 boundaryHash = calculateHash(boundary);
-	while (readOneByteInStream(stream, boundary, boundaryHash)) {
-		if (!bytesLeft())
-			return false;
-	}
+	if (!readUntilBoundary(stream, boundary))
+		return false;
 
 	_firstBlock = false;
 	if (stream)
@@ -326,60 +317,121 @@ void Reader::makeWindow(uint32 size) {
 	_window = new byte[size];
 	_windowUsed = 0;
 	_windowSize = size;
-	_windowReadPosition = 0;
-	_windowWritePosition = 0;
-	_windowHash = 0;
 }
 
 void Reader::freeWindow() {
 	delete[] _window;
 	_window = nullptr;
 	_windowUsed = _windowSize = 0;
-	_windowReadPosition = _windowWritePosition = 0;
-	_windowHash = 0;
 }
 
-namespace {
-bool windowEqualsString(const byte *window, uint32 windowStart, uint32 windowSize, const Common::String &boundary) {
-	if (boundary.size() != windowSize)
-		return false;
+bool Reader::readUntilBoundary(Common::WriteStream *stream, const Common::String &boundary) {
+	const byte *pattern = (const byte *)boundary.c_str();
+	const uint32 patternSize = boundary.size();
 
-	for (uint32 i = 0; i < windowSize; ++i) {
-		if (window[(windowStart + i) % windowSize] != boundary[i])
-			return false;
+	while (fillBuffer()) {
+		// the window holds the end of the previous chunk, which could be the beginning of boundary
+		if (_windowUsed != 0) {
+			if (resolveWindow(stream, boundary))
+				return true;
+			continue;
+		}
+
+		const byte *data = _buffer + _bufferPos;
+		uint32 size = _bufferEnd - _bufferPos;
+		uint32 contentSize = size, keptSize = 0;
+		for (uint32 start = 0; start < size; ) {
+			const byte *candidate = (const byte *)memchr(data + start, pattern[0], size - start);
+			if (candidate == nullptr)
+				break;
+
+			uint32 offset = candidate - data;
+			uint32 tail = size - offset;
+			if (tail >= patternSize) {
+				if (memcmp(candidate, pattern, patternSize) == 0) {
+					if (stream && offset)
+						stream->write(data, offset);
+					consume(offset + patternSize);
+					return true;
+				}
+			} else if (memcmp(candidate, pattern, tail) == 0) {
+				// chunk ends with a part of boundary, keep it until more bytes come
+				contentSize = offset;
+				keptSize = tail;
+				break;
+			}
+			start = offset + 1;
+		}
+
+		if (stream && contentSize)
+			stream->write(data, contentSize);
+		memcpy(_window, data + contentSize, keptSize);
+		_windowUsed = keptSize;
+		consume(size);
 	}
 
-	return true;
+	return false;
 }
+
+bool Reader::resolveWindow(Common::WriteStream *stream, const Common::String &boundary) {
+	const byte *pattern = (const byte *)boundary.c_str();
+	const uint32 patternSize = boundary.size();
+	const byte *data = _buffer + _bufferPos;
+	uint32 size = _bufferEnd - _bufferPos;
+
+	while (_windowUsed != 0) {
+		uint32 needed = patternSize - _windowUsed;
+		uint32 available = MIN(needed, size);
+		if (memcmp(data, pattern + _windowUsed, available) == 0) {
+			if (available == needed) {
+				consume(needed);
+				_windowUsed = 0;
+				return true;
+			}
+
+			// still could be boundary, wait for more bytes
+			memcpy(_window + _windowUsed, data, available);
+			_windowUsed += available;
+			consume(available);
+			return false;
+		}
+
+		// first byte of the window is content, the rest might still begin boundary
+		do {
+			if (stream)
+				stream->writeByte(_window[0]);
+			--_windowUsed;
+			memmove(_window, _window + 1, _windowUsed);
+		} while (_windowUsed != 0 && memcmp(_window, pattern, _windowUsed) != 0);
+	}
+
+	return false;
 }
 
-bool Reader::readOneByteInStream(Common::WriteStream *stream, const Common::String &boundary, const uint32 boundaryHash) {
-	byte b = readOne();
-	++_windowUsed;
-	_window[_windowWritePosition] = b;
-	_windowWritePosition = (_windowWritePosition + 1) % _windowSize;
-	_windowHash ^= b;
-	if (_windowUsed < _windowSize)
+bool Reader::fillBuffer() {
+	if (_bufferPos < _bufferEnd)
 		return true;
-
-	//when window is filled, check whether that's the boundary
-	if (_windowHash == boundaryHash && windowEqualsString(_window, _windowReadPosition, _windowSize, boundary))
+	if (_content == nullptr)
 		return false;
 
-	//if not, add the first byte of the window to the string
-	if (stream)
-		stream->writeByte(_window[_windowReadPosition]);
-	_windowHash ^= _window[_windowReadPosition];
-	_windowReadPosition = (_windowReadPosition + 1) % _windowSize;
-	--_windowUsed;
-	return true;
+	if (_buffer == nullptr)
+		_buffer = new byte[BUFFER_SIZE];
+	_bufferPos = 0;
+	_bufferEnd = _content->read(_buffer, BUFFER_SIZE);
+	return _bufferEnd != 0;
+}
+
+void Reader::consume(uint32 size) {
+	_bufferPos += size;
+	_availableBytes -= size;
+	_bytesLeft -= size;
 }
 
 byte Reader::readOne() {
-	byte b = 0;
-	_content->read(&b, 1);
-	--_availableBytes;
-	--_bytesLeft;
+	if (!fillBuffer())
+		return 0;
+	byte b = _buffer[_bufferPos];
+	consume(1);
 	return b;
 }
 
@@ -413,23 +465,20 @@ bool Reader::readContent(Common::WriteStream* stream) {
 	if (!bytesLeft())
 		return false;
 
-	byte buffer[1024];
-	while (_availableBytes > 0) {
-		uint32 bytesRead = _content->read(&buffer, 1024);
-		_availableBytes -= bytesRead;
-		_bytesLeft -= bytesRead;
+	while (_availableBytes > 0 && fillBuffer()) {
+		uint32 bytesRead = _bufferEnd - _bufferPos;
+		if (bytesRead > _availableBytes)
+			bytesRead = _availableBytes;
 
 		if (stream)
-			if (stream->write(buffer, bytesRead) != bytesRead) {
+			if (stream->write(_buffer + _bufferPos, bytesRead) != bytesRead) {
 				warning("Reader::readContent(): failed to write buffer to stream");
 				return false;
 			}
+		consume(bytesRead);
 
 		if (_availableBytes == 0)
 			_allContentRead = true;
-
-		if (!bytesLeft())
-			break;
 	}
 
 	if (stream)
@@ -476,7 +525,7 @@ bool Reader::readBlockContent(Common::WriteStream *stream) {
 		return false;
 	}
 
-	if (_state != RS_READING_CONTENT) {
+	if (_state != RS_READING_CONTENT && !_blockEndPending) {
 		warning("Reader::readBlockContent(): bad state");
 		return false;
 	}
@@ -484,8 +533,16 @@ bool Reader::readBlockContent(Common::WriteStream *stream) {
 	if (!bytesLeft())
 		return false;
 
-	if (!readContentIntoStream(stream))
+	if (!_blockEndPending) {
+		if (!readContentIntoStream(stream))
+			return false;
+		_blockEndPending = true;
+	}
+
+	// the two bytes after boundary could come with the next chunk
+	if (_availableBytes >= 2 && bytesLeft() < 2)
 		return false;
+	_blockEndPending = false;
 
 	if (_availableBytes >= 2) {
 		Common::String bts;
@@ -509,9 +566,11 @@ void Reader::setMode(ReaderMode mode) { _mode = mode; }
 
 void Reader::setContent(Common::MemoryReadWriteStream *stream) {
 	_content = stream;
-	_bytesLeft = stream->size() - stream->pos();
+	_bytesLeft = (_bufferEnd - _bufferPos) + stream->size() - stream->pos();
 }
 
+bool Reader::hasBufferedBytes() const { return _bufferPos < _bufferEnd; }
+
 bool Reader::badRequest() const { return _isBadRequest; }
 
 bool Reader::noMoreContent() const { return _allContentRead; }
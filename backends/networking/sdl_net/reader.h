@@ -64,8 +64,9 @@ enum ReaderMode {
  *
  * To use the object, call setContent() and then one of those
  * reading methods. It would return whether reading is over
- * or not. If reading is over, content stream still could
- * contain bytes to read with other methods.
+ * or not. If reading is over, content stream (or Reader's own
+ * buffer, see hasBufferedBytes()) still could contain bytes to
+ * read with other methods.
  *
  * If reading is not over, Reader awaits you to call the
  * same reading method when you'd get more content.
@@ -82,19 +83,22 @@ class Reader {
 	Common::MemoryReadWriteStream *_content;
 	uint32 _bytesLeft;
 
+	byte *_buffer;
+	uint32 _bufferPos, _bufferEnd;
+
 	byte *_window;
-	uint32 _windowUsed, _windowSize, _windowReadPosition, _windowWritePosition;
-	uint32 _windowHash;
+	uint32 _windowUsed, _windowSize;
 
 	Common::MemoryReadWriteStream *_headersStream;
 
 	Common::String _headers;
 	Common::String _method, _path, _query, _anchor;
 	Common::HashMap<Common::String, Common::String> _queryParameters;
-	uint32 _contentLength;
+	uint64 _contentLength;
 	Common::String _boundary;
-	uint32 _availableBytes;
+	uint64 _availableBytes;
 	bool _firstBlock;
+	bool _blockEndPending;
 	bool _isBadRequest;
 	bool _allContentRead;
 
@@ -111,13 +115,17 @@ class Reader {
 
 	void makeWindow(uint32 size);
 	void freeWindow();
-	bool readOneByteInStream(Common::WriteStream *stream, const Common::String &boundary, const uint32 boundaryHash);
+	bool readUntilBoundary(Common::WriteStream *stream, const Common::String &boundary); //true when boundary was found
+	bool resolveWindow(Common::WriteStream *stream, const Common::String &boundary); //true when boundary was found
 
+	bool fillBuffer();
+	void consume(uint32 size);
 	byte readOne();
 	uint32 bytesLeft() const;
 
 public:
 	static const int32 SUSPICIOUS_HEADERS_SIZE = 1024 * 1024; // 1 MB is really a lot
+	static const uint32 BUFFER_SIZE = 256 * 1024;
 
 	Reader();
 	~Reader();
@@ -133,6 +141,7 @@ public:
 	void setMode(ReaderMode mode);
 	void setContent(Common::MemoryReadWriteStream *stream);
 
+	bool hasBufferedBytes() const;
 	bool badRequest() const;
 	bool noMoreContent() const;
 
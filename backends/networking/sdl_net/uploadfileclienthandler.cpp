@@ -44,6 +44,13 @@ void UploadFileClientHandler::handle(Client *client) {
 		return;
 	}
 
+	// parse everything received so far, then go on while more is coming and the time slice lasts
+	do {
+		handleReceivedContent(client);
+	} while (_state != UFH_ERROR && _state != UFH_STOP && client->hasTimeLeft() && client->pollSocket());
+}
+
+void UploadFileClientHandler::handleReceivedContent(Client *client) {
 	while (true) {
 		switch (_state) {
 		case UFH_READING_CONTENT:
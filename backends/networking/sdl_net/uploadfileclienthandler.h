@@ -53,6 +53,7 @@ class UploadFileClientHandler: public ClientHandler {
 	Common::Path _parentDirectoryPath;
 	uint32 _uploadedFiles;
 
+	void handleReceivedContent(Client *client);
 	void handleBlockHeaders(Client *client);
 	void handleBlockContent(Client *client);
 	void setErrorMessageHandler(Client &client, const Common::String &message);
@@ -46,6 +46,7 @@
 #include "backends/events/default/default-events.h"
 #include "backends/keymapper/hardware-input.h"
 #include "backends/mutex/sdl/sdl-mutex.h"
+#include "backends/threadpool/sdl/sdl-threadpool.h"
 #include "backends/timer/sdl/sdl-timer.h"
 #include "backends/graphics/surfacesdl/surfacesdl-graphics.h"
 #ifdef USE_OPENGL
@@ -352,6 +353,14 @@ void OSystem_SDL::initBackend() {
 	if (_savefileManager == nullptr)
 		_savefileManager = new DefaultSaveFileManager();
 
+	// Before the mixer, which may install a timer proc
+#ifdef ENABLE_EVENTRECORDER
+	g_eventRec.registerTimerManager(new SdlTimerManager());
+#else
+	if (_timerManager == nullptr)
+		_timerManager = new SdlTimerManager();
+#endif
+
 	if (_mixerManager == nullptr) {
 		_mixerManager = new SdlMixerManager();
 		// Setup and start mixer
@@ -367,11 +376,6 @@ void OSystem_SDL::initBackend() {
 
 #ifdef ENABLE_EVENTRECORDER
 	g_eventRec.registerMixerManager(_mixerManager);
-
-	g_eventRec.registerTimerManager(new SdlTimerManager());
-#else
-	if (_timerManager == nullptr)
-		_timerManager = new SdlTimerManager();
 #endif
 
 	_audiocdManager = createAudioCDManager();
@@ -843,6 +847,10 @@ Common::MutexInternal *OSystem_SDL::createMutex() {
 	return createSdlMutexInternal();
 }
 
+Common::ThreadPoolInternal *OSystem_SDL::createThreadPool() {
+	return createSdlThreadPoolInternal();
+}
+
 uint32 OSystem_SDL::getMillis(bool skipRecord) {
 	uint32 millis = SDL_GetTicks();
 
@@ -860,6 +868,16 @@ void OSystem_SDL::delayMillis(uint msecs) {
 		SDL_Delay(msecs);
 }
 
+bool OSystem_SDL::waitForEventOrDeadline(uint32 deadline) {
+#ifdef ENABLE_EVENTRECORDER
+	if (g_eventRec.processDelayMillis())
+		return false;
+#endif
+
+	const int32 remaining = (int32)(deadline - getMillis(true));
+	return _eventSource->waitForEvent(MAX<int32>(remaining, 0));
+}
+
 void OSystem_SDL::getTimeAndDate(TimeDate &td, bool skipRecord) const {
 	time_t curTime = time(nullptr);
 	struct tm t = *localtime(&curTime);
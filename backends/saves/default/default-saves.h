@@ -43,6 +43,7 @@ public:
 	Common::OutSaveFile *openForSaving(const Common::String &filename, bool compress = true) override;
 	bool removeSavefile(const Common::String &filename) override;
 	bool exists(const Common::String &filename) override;
+	bool getSavefileStamp(const Common::String &filename, int64 &size, int64 &modified) override;
 
 #ifdef USE_LIBCURL
 
@@ -99,6 +100,11 @@ protected:
 	 */
 	Common::StringArray _lockedFiles;
 
+	/**
+	 * The files opened for saving during this run, which have no stamp.
+	 */
+	Common::HashMap<Common::String, bool, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> _writtenFiles;
+
 private:
 	/**
 	 * The currently cached directory.
@@ -0,0 +1,197 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "common/scummsys.h"
+
+#if defined(SDL_BACKEND)
+
+#include "backends/threadpool/sdl/sdl-threadpool.h"
+#include "backends/platform/sdl/sdl-sys.h"
+#include "common/textconsole.h"
+
+/**
+ * SDL worker threads
+ *
+ * Every worker waits on its own semaphore. A run wakes as many workers as
+ * there are jobs beyond the first, and all of them, the caller included,
+ * take the next job from the list until it is exhausted.
+ */
+class SdlThreadPoolInternal final : public Common::ThreadPoolInternal {
+public:
+	explicit SdlThreadPoolInternal(uint numThreads);
+	~SdlThreadPoolInternal() override;
+
+	uint getNumThreads() const override { return _workers.size() + 1; }
+	void run(Common::Job *const *jobs, uint count) override;
+
+private:
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+	typedef SDL_Semaphore Semaphore;
+	typedef SDL_Mutex Mutex;
+#else
+	typedef SDL_sem Semaphore;
+	typedef SDL_mutex Mutex;
+#endif
+
+	struct Worker {
+		SdlThreadPoolInternal *pool;
+		SDL_Thread *thread;
+		Semaphore *start;
+	};
+
+	static int workerProc(void *data);
+
+	/** Run jobs from the list until there are none left. */
+	void runJobs();
+
+	static void post(Semaphore *sem);
+	static void wait(Semaphore *sem);
+
+	Common::Array<Worker *> _workers;
+	Semaphore *_done;
+	Mutex *_mutex;
+	bool _quit;
+
+	Common::Job *const *_jobs;
+	uint _count;
+	uint _next;
+};
+
+SdlThreadPoolInternal::SdlThreadPoolInternal(uint numThreads) : _quit(false), _jobs(nullptr), _count(0), _next(0) {
+	_done = SDL_CreateSemaphore(0);
+	_mutex = SDL_CreateMutex();
+	if (!_done || !_mutex)
+		error("Could not create the thread pool: %s", SDL_GetError());
+
+	for (uint i = 1; i < numThreads; ++i) {
+		Worker *worker = new Worker();
+		worker->pool = this;
+		worker->start = SDL_CreateSemaphore(0);
+		if (!worker->start)
+			error("SDL_CreateSemaphore failed: %s", SDL_GetError());
+
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+		worker->thread = SDL_CreateThread(workerProc, "ScummVM Worker", worker);
+#else
+		worker->thread = SDL_CreateThread(workerProc, worker);
+#endif
+		if (!worker->thread) {
+			warning("Could not create worker thread: %s", SDL_GetError());
+			SDL_DestroySemaphore(worker->start);
+			delete worker;
+			break;
+		}
+		_workers.push_back(worker);
+	}
+}
+
+SdlThreadPoolInternal::~SdlThreadPoolInternal() {
+	_quit = true;
+	for (uint i = 0; i < _workers.size(); ++i) {
+		post(_workers[i]->start);
+		SDL_WaitThread(_workers[i]->thread, nullptr);
+		SDL_DestroySemaphore(_workers[i]->start);
+		delete _workers[i];
+	}
+	SDL_DestroyMutex(_mutex);
+	SDL_DestroySemaphore(_done);
+}
+
+void SdlThreadPoolInternal::run(Common::Job *const *jobs, uint count) {
+	_jobs = jobs;
+	_count = count;
+	_next = 0;
+
+	// The caller takes one job itself
+	uint numWorkers = MIN<uint>(_workers.size(), count - 1);
+	for (uint i = 0; i < numWorkers; ++i)
+		post(_workers[i]->start);
+
+	runJobs();
+
+	for (uint i = 0; i < numWorkers; ++i)
+		wait(_done);
+
+	_jobs = nullptr;
+	_count = 0;
+}
+
+void SdlThreadPoolInternal::runJobs() {
+	for (;;) {
+		SDL_LockMutex(_mutex);
+		uint index = _next++;
+		SDL_UnlockMutex(_mutex);
+
+		if (index >= _count)
+			break;
+
+		_jobs[index]->run();
+	}
+}
+
+int SdlThreadPoolInternal::workerProc(void *data) {
+	Worker *worker = (Worker *)data;
+	SdlThreadPoolInternal *pool = worker->pool;
+
+	for (;;) {
+		wait(worker->start);
+		if (pool->_quit)
+			break;
+
+		pool->runJobs();
+		post(pool->_done);
+	}
+	return 0;
+}
+
+void SdlThreadPoolInternal::post(Semaphore *sem) {
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+	SDL_SignalSemaphore(sem);
+#else
+	SDL_SemPost(sem);
+#endif
+}
+
+void SdlThreadPoolInternal::wait(Semaphore *sem) {
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+	SDL_WaitSemaphore(sem);
+#else
+	SDL_SemWait(sem);
+#endif
+}
+
+Common::ThreadPoolInternal *createSdlThreadPoolInternal() {
+#if SDL_VERSION_ATLEAST(3, 0, 0)
+	int threads = SDL_GetNumLogicalCPUCores();
+#elif SDL_VERSION_ATLEAST(2, 0, 0)
+	int threads = SDL_GetCPUCount();
+#else
+	// No way to know, stay on the safe side
+	int threads = 1;
+#endif
+	if (threads <= 1)
+		return nullptr;
+
+	return new SdlThreadPoolInternal(MIN(threads, 16));
+}
+
+#endif
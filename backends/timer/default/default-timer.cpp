@@ -19,10 +19,12 @@
  *
  */
 
+
 #include "common/scummsys.h"
 #include "backends/timer/default/default-timer.h"
 #include "common/util.h"
 #include "common/system.h"
+#include "common/profiler.h"
 
 struct TimerSlot {
 	Common::TimerManager::TimerProc callback;
@@ -30,87 +32,136 @@ struct TimerSlot {
 	Common::String id;
 	uint32 interval;	// in microseconds
 
-	uint32 nextFireTime;	// in milliseconds
-	uint32 nextFireTimeMicro;	// microseconds part of nextFire
+	uint64 nextFireTime;	// in microseconds
+	uint32 sequence;	// keeps slots due at the same time in the order they were queued
 
-	TimerSlot *next;
+	uint32 calls;
+	uint32 overruns;
+	uint64 totalTime;
+	uint32 maxTime;
 
-	TimerSlot() : callback(nullptr), refCon(nullptr), interval(0), nextFireTime(0), nextFireTimeMicro(0), next(nullptr) {}
+	TimerSlot() : callback(nullptr), refCon(nullptr), interval(0), nextFireTime(0), sequence(0),
+		calls(0), overruns(0), totalTime(0), maxTime(0) {}
 };
 
-void insertPrioQueue(TimerSlot *head, TimerSlot *newSlot) {
-	// The head points to a fake anchor TimerSlot; this common
-	// trick allows us to get rid of many special cases.
-
-	const uint32 nextFireTime = newSlot->nextFireTime;
-	TimerSlot *slot = head;
-	newSlot->next = nullptr;
+static bool firesBefore(const TimerSlot *a, const TimerSlot *b) {
+	if (a->nextFireTime != b->nextFireTime)
+		return a->nextFireTime < b->nextFireTime;
+	// The sequence numbers may wrap around
+	return (int32)(a->sequence - b->sequence) < 0;
+}
 
-	// Insert the new slot into the sorted list of already scheduled
-	// timers in such a way that the list stays sorted...
+static void siftDown(Common::Array<TimerSlot *> &queue, uint i) {
+	const uint size = queue.size();
 	while (true) {
-		assert(slot);
-		if (slot->next == nullptr || nextFireTime < slot->next->nextFireTime) {
-			newSlot->next = slot->next;
-			slot->next = newSlot;
+		uint first = i;
+		const uint left = 2 * i + 1, right = 2 * i + 2;
+		if (left < size && firesBefore(queue[left], queue[first]))
+			first = left;
+		if (right < size && firesBefore(queue[right], queue[first]))
+			first = right;
+		if (first == i)
 			return;
-		}
-		slot = slot->next;
+		SWAP(queue[i], queue[first]);
+		i = first;
+	}
+}
+
+void DefaultTimerManager::pushSlot(TimerSlot *slot) {
+	slot->sequence = _nextSequence++;
+	_queue.push_back(slot);
+
+	uint i = _queue.size() - 1;
+	while (i > 0) {
+		const uint parent = (i - 1) / 2;
+		if (!firesBefore(_queue[i], _queue[parent]))
+			break;
+		SWAP(_queue[i], _queue[parent]);
+		i = parent;
 	}
 }
 
+TimerSlot *DefaultTimerManager::popSlot() {
+	TimerSlot *slot = _queue[0];
+	_queue[0] = _queue.back();
+	_queue.pop_back();
+	if (!_queue.empty())
+		siftDown(_queue, 0);
+	return slot;
+}
 
-DefaultTimerManager::DefaultTimerManager() :
-	_timerCallbackNext(0),
-	_head(nullptr) {
 
-	_head = new TimerSlot();
+DefaultTimerManager::DefaultTimerManager() :
+	_runningSlot(nullptr),
+	_nextSequence(0),
+	_timerCallbackNext(0) {
 }
 
 DefaultTimerManager::~DefaultTimerManager() {
+	Common::StackLock callbackLock(_callbackMutex);
 	Common::StackLock lock(_mutex);
 
-	TimerSlot *slot = _head;
-	while (slot) {
-		TimerSlot *next = slot->next;
-		delete slot;
-		slot = next;
-	}
-	_head = nullptr;
+	for (uint i = 0; i < _queue.size(); ++i)
+		delete _queue[i];
+	_queue.clear();
+	_runningSlot = nullptr;
 }
 
-void DefaultTimerManager::handler() {
-	Common::StackLock lock(_mutex);
-
-	uint32 curTime = g_system->getMillis(true);
+uint64 DefaultTimerManager::getMicros() {
+	return (uint64)g_system->getMillis(true) * 1000;
+}
 
-	// On slow systems this could still be run after destructor
-	if (!_head)
-		return;
+uint32 DefaultTimerManager::handler() {
+	PROFILE_ZONE("DefaultTimerManager::handler");
 
 	// Repeat as long as there is a TimerSlot that is scheduled to fire.
-	TimerSlot *slot = _head->next;
-	while (slot && slot->nextFireTime < curTime) {
-		// Remove the slot from the priority queue
-		_head->next = slot->next;
-
-		// Update the fire time and reinsert the TimerSlot into the priority
-		// queue.
-		assert(slot->interval > 0);
-		slot->nextFireTime += (slot->interval / 1000);
-		slot->nextFireTimeMicro += (slot->interval % 1000);
-		if (slot->nextFireTimeMicro > 1000) {
-			slot->nextFireTime += slot->nextFireTimeMicro / 1000;
-			slot->nextFireTimeMicro %= 1000;
+	while (true) {
+		// The callbacks run without _mutex, so installing timers doesn't
+		// have to wait for them.
+		Common::StackLock callbackLock(_callbackMutex);
+
+		TimerProc callback;
+		void *refCon;
+		uint64 startTime;
+		{
+			Common::StackLock lock(_mutex);
+
+			// On slow systems this could still be run after destructor
+			if (_queue.empty())
+				return 0xFFFFFFFF;
+
+			startTime = getMicros();
+			TimerSlot *slot = _queue[0];
+			if (slot->nextFireTime > startTime)
+				return (uint32)MIN<uint64>((slot->nextFireTime - startTime + 999) / 1000, 0xFFFFFFFE);
+
+			// Update the fire time and requeue the TimerSlot. Late timers
+			// are invoked until they have caught up.
+			popSlot();
+			assert(slot->interval > 0);
+			if (startTime - slot->nextFireTime >= slot->interval)
+				slot->overruns++;
+			slot->nextFireTime += slot->interval;
+			pushSlot(slot);
+
+			assert(slot->callback);
+			callback = slot->callback;
+			refCon = slot->refCon;
+			_runningSlot = slot;
 		}
-		insertPrioQueue(_head, slot);
 
 		// Invoke the timer callback
-		assert(slot->callback);
-		slot->callback(slot->refCon);
-
-		// Look at the next scheduled timer
-		slot = _head->next;
+		callback(refCon);
+
+		Common::StackLock lock(_mutex);
+		if (_runningSlot) {
+			const uint64 endTime = getMicros();
+			const uint64 time = endTime > startTime ? endTime - startTime : 0;
+			_runningSlot->calls++;
+			_runningSlot->totalTime += time;
+			_runningSlot->maxTime = MAX<uint32>(_runningSlot->maxTime, (uint32)MIN<uint64>(time, 0xFFFFFFFF));
+			_runningSlot = nullptr;
+		}
 	}
 }
 
@@ -119,8 +170,8 @@ void DefaultTimerManager::checkTimers(uint32 interval) {
 
 	// Timer checking & firing
 	if (curTime >= _timerCallbackNext) {
-		handler();
-		_timerCallbackNext = curTime + interval;
+		const uint32 next = handler();
+		_timerCallbackNext = curTime + MIN(interval, next);
 	}
 }
 
@@ -147,44 +198,68 @@ bool DefaultTimerManager::installTimerProc(TimerProc callback, int32 interval, v
 	slot->refCon = refCon;
 	slot->id = id;
 	slot->interval = interval;
-	slot->nextFireTime = g_system->getMillis() + interval / 1000;
-	slot->nextFireTimeMicro = interval % 1000;
-	slot->next = nullptr;
+	slot->nextFireTime = getMicros() + interval;
 
-	insertPrioQueue(_head, slot);
+	pushSlot(slot);
 
 	return true;
 }
 
 void DefaultTimerManager::removeTimerProc(TimerProc callback) {
-	Common::StackLock lock(_mutex);
+	{
+		Common::StackLock lock(_mutex);
+
+		uint j = 0;
+		for (uint i = 0; i < _queue.size(); ++i) {
+			if (_queue[i]->callback == callback) {
+				if (_queue[i] == _runningSlot)
+					_runningSlot = nullptr;
+				delete _queue[i];
+			} else {
+				_queue[j++] = _queue[i];
+			}
+		}
 
-	TimerSlot *slot = _head;
+		if (j != _queue.size()) {
+			_queue.resize(j);
+			for (uint i = j / 2; i-- > 0; )
+				siftDown(_queue, i);
+		}
 
-	while (slot->next) {
-		if (slot->next->callback == callback) {
-			TimerSlot *next = slot->next->next;
-			delete slot->next;
-			slot->next = next;
-		} else {
-			slot = slot->next;
+		// We need to remove all names referencing the timer proc here.
+		//
+		// Else we run into troubles, when the client code removes and readds timer
+		// callbacks.
+		//
+		// Another issues occurs when one plays a game with ALSA as music driver,
+		// returns to launcher and starts a different engine game with ALSA as music driver.
+		// In this case the MPU401 code will add different timer procs with the
+		// same name, resulting in two different callbacks added with the same
+		// name and causing installTimerProc to error out.
+		// A good test case is running a SCUMM with ALSA output and then a KYRA
+		// game for example.
+		for (TimerSlotMap::iterator i = _callbacks.begin(), end = _callbacks.end(); i != end; ++i) {
+			if (i->_value == callback)
+				_callbacks.erase(i);
 		}
 	}
 
-	// We need to remove all names referencing the timer proc here.
-	//
-	// Else we run into troubles, when the client code removes and readds timer
-	// callbacks.
-	//
-	// Another issues occurs when one plays a game with ALSA as music driver,
-	// returns to launcher and starts a different engine game with ALSA as music driver.
-	// In this case the MPU401 code will add different timer procs with the
-	// same name, resulting in two different callbacks added with the same
-	// name and causing installTimerProc to error out.
-	// A good test case is running a SCUMM with ALSA output and then a KYRA
-	// game for example.
-	for (TimerSlotMap::iterator i = _callbacks.begin(), end = _callbacks.end(); i != end; ++i) {
-		if (i->_value == callback)
-			_callbacks.erase(i);
+	// Wait for the callback to return if the handler is running it on
+	// another thread. A callback removing itself holds the mutex already.
+	Common::StackLock callbackLock(_callbackMutex);
+}
+
+void DefaultTimerManager::getTimerStats(Common::Array<TimerStats> &stats) {
+	Common::StackLock lock(_mutex);
+
+	stats.resize(_queue.size());
+	for (uint i = 0; i < _queue.size(); ++i) {
+		const TimerSlot *slot = _queue[i];
+		stats[i].id = slot->id;
+		stats[i].interval = slot->interval;
+		stats[i].calls = slot->calls;
+		stats[i].overruns = slot->overruns;
+		stats[i].totalTime = slot->totalTime;
+		stats[i].maxTime = slot->maxTime;
 	}
 }
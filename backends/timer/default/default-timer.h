@@ -22,6 +22,7 @@
 #ifndef BACKENDS_TIMER_DEFAULT_H
 #define BACKENDS_TIMER_DEFAULT_H
 
+#include "common/array.h"
 #include "common/str.h"
 #include "common/hash-str.h"
 #include "common/timer.h"
@@ -33,22 +34,47 @@ class DefaultTimerManager : public Common::TimerManager {
 private:
 	typedef Common::HashMap<Common::String, TimerProc, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> TimerSlotMap;
 
+	/** Guards the queue and the slots. It is not held while callbacks run. */
 	Common::Mutex _mutex;
-	TimerSlot *_head;
+	/**
+	 * Held while a callback runs, so that removeTimerProc() can wait for it.
+	 * It is taken before _mutex.
+	 */
+	Common::Mutex _callbackMutex;
+	/** The installed timers, a binary min-heap ordered by their next fire time. */
+	Common::Array<TimerSlot *> _queue;
+	/** The slot whose callback is running, reset if it gets removed meanwhile. */
+	TimerSlot *_runningSlot;
+	uint32 _nextSequence;
 	TimerSlotMap _callbacks;
 
 	uint32 _timerCallbackNext;
 
+	void pushSlot(TimerSlot *slot);
+	TimerSlot *popSlot();
+
+protected:
+	/**
+	 * The time the timers are scheduled with, in microseconds. Backends
+	 * with a finer monotonic clock than getMillis() can override it.
+	 */
+	virtual uint64 getMicros();
+
 public:
 	DefaultTimerManager();
 	virtual ~DefaultTimerManager();
 	virtual bool installTimerProc(TimerProc proc, int32 interval, void *refCon, const Common::String &id);
 	virtual void removeTimerProc(TimerProc proc);
+	virtual void getTimerStats(Common::Array<TimerStats> &stats);
 
 	/**
 	 * Timer callback, to be invoked at regular time intervals by the backend.
+	 *
+	 * @return The time in milliseconds until the next callback is due,
+	 *         0xFFFFFFFF if there are no callbacks. Backends can use it to
+	 *         invoke the handler again as soon as needed.
 	 */
-	void handler();
+	uint32 handler();
 
 	/*
 	 * Ensure that the callback is called at regular time intervals.
@@ -27,20 +27,29 @@
 #include "backends/timer/sdl/sdl-timer.h"
 
 #include "common/textconsole.h"
+#include "common/util.h"
+
+// The timer thread wakes up when the next callback is due, but at least
+// every 10 ms to pick up newly installed callbacks.
+static Uint32 nextTimerInterval(uint32 next) {
+	return CLIP<uint32>(next, 1, 10);
+}
 
 #if SDL_VERSION_ATLEAST(3, 0, 0)
 static Uint32 timer_handler(void *userdata, SDL_TimerID timerID, Uint32 interval) {
-	((DefaultTimerManager *)userdata)->handler();
-	return interval;
+	return nextTimerInterval(((DefaultTimerManager *)userdata)->handler());
 }
 #else
 static Uint32 timer_handler(Uint32 interval, void *param) {
-	((DefaultTimerManager *)param)->handler();
-	return interval;
+	return nextTimerInterval(((DefaultTimerManager *)param)->handler());
 }
 #endif
 
 SdlTimerManager::SdlTimerManager() {
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	_counterFrequency = SDL_GetPerformanceFrequency();
+#endif
+
 #if !SDL_VERSION_ATLEAST(3, 0, 0)
 	// Initializes the SDL timer subsystem
 	if (SDL_InitSubSystem(SDL_INIT_TIMER) == -1) {
@@ -61,4 +70,12 @@ SdlTimerManager::~SdlTimerManager() {
 #endif
 }
 
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+uint64 SdlTimerManager::getMicros() {
+	// Split the conversion so that it does not overflow
+	const uint64 counter = SDL_GetPerformanceCounter();
+	return (counter / _counterFrequency) * 1000000 + (counter % _counterFrequency) * 1000000 / _counterFrequency;
+}
+#endif
+
 #endif
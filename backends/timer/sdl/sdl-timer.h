@@ -28,7 +28,8 @@
 
 /**
  * SDL timer manager. Setups the timer callback for
- * DefaultTimerManager.
+ * DefaultTimerManager, and schedules the timers with the
+ * performance counter of SDL.
  */
 class SdlTimerManager : public DefaultTimerManager {
 public:
@@ -37,6 +38,12 @@ public:
 
 protected:
 	SDL_TimerID _timerID;
+
+#if SDL_VERSION_ATLEAST(2, 0, 0)
+	uint64 getMicros() override;
+
+	uint64 _counterFrequency;
+#endif
 };
 
 
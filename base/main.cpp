@@ -52,6 +52,9 @@
 #include "common/translation.h"
 #include "common/text-to-speech.h"
 #include "common/osd_message_queue.h"
+#include "common/memtag.h"
+#include "common/profiler.h"
+#include "common/threadpool.h"
 
 #include "gui/gui-manager.h"
 #include "gui/error.h"
@@ -214,6 +217,7 @@ static Common::Error runGame(const Plugin *enginePlugin, OSystem &system, const
 		// Apparently some engines query them in their constructor, thus we
 		// need to set this up before instance creation.
 		metaEngine.registerDefaultSettings(target);
+		MEMORY_TAG(metaEngine.getName());
 		err = metaEngine.createInstance(&system, &engine, game, meDescriptor);
 	}
 
@@ -308,7 +312,12 @@ static Common::Error runGame(const Plugin *enginePlugin, OSystem &system, const
 	system.getEventManager()->purgeMouseEvents();
 
 	// Run the engine
-	Common::Error result = engine->run();
+	Common::Error result;
+	{
+		PROFILE_ZONE("Engine::run");
+		MEMORY_TAG(metaEngine.getName());
+		result = engine->run();
+	}
 
 	// Make sure we do not return to the launcher if this is not possible.
 	if (!engine->hasFeature(Engine::kSupportsReturnToLauncher))
@@ -323,6 +332,9 @@ static Common::Error runGame(const Plugin *enginePlugin, OSystem &system, const
 	// Free up memory
 	metaEngine.deleteInstance(engine, game, meDescriptor);
 
+	// The deferred debug messages may point into the engine plugin
+	flushDeferredDebug();
+
 	// Reset the file/directory mappings
 	SearchMan.clear();
 
@@ -484,6 +496,9 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 	if (settings.contains("debug-channels-only"))
 		gDebugChannelsOnly = true;
 
+	if (ConfMan.getBool("debug_deferred"))
+		enableDeferredDebug(true);
+
 
 	// Now we want to enable global flags if any
 	Common::StringTokenizer tokenizer(specialDebug, " ,");
@@ -608,6 +623,11 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 
 	Common::OSDMessageQueue::instance().registerEventSource();
 
+#ifdef USE_ZONE_PROFILER
+	if (ConfMan.hasKey("profiler_trace"))
+		Common::startProfiler();
+#endif
+
 	// Now as the event manager is created, setup the keymapper
 	setupKeymapper(system);
 
@@ -779,6 +799,9 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 				g_eventRec.init(recordFileName, GUI::EventRecorder::kRecorderUpdate);
 			} else if (recordMode == "playback") {
 				g_eventRec.init(recordFileName, GUI::EventRecorder::kRecorderPlayback);
+			} else if (recordMode == "benchmark") {
+				g_eventRec.init(recordFileName, GUI::EventRecorder::kRecorderPlayback);
+				g_eventRec.startBenchmark();
 			} else if ((recordMode == "info") && (!recordFileName.empty())) {
 				Common::PlaybackFile record;
 				record.openRead(recordFileName);
@@ -890,11 +913,19 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 	Cloud::CloudManager::destroy();
 #endif
 #endif
+#ifdef USE_ZONE_PROFILER
+	if (ConfMan.hasKey("profiler_trace") && !Common::stopProfiler(Common::Path::fromConfig(ConfMan.get("profiler_trace"))))
+		warning("Could not write the profiler trace to '%s'", ConfMan.get("profiler_trace").c_str());
+#endif
+
+	enableDeferredDebug(false);
+
 	PluginManager::destroy();
 	GUI::GuiManager::destroy();
 	Common::ConfigManager::destroy();
 	Common::DebugManager::destroy();
 	Common::OSDMessageQueue::destroy();
+	Common::ThreadPool::destroy();
 #ifdef ENABLE_EVENTRECORDER
 	GUI::EventRecorder::destroy();
 #endif
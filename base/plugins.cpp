@@ -417,8 +417,41 @@ void PluginManagerUncached::updateConfigWithFileName(const Common::String &engin
 		assert(domain);
 		(*domain).setVal(engineId, (*_currentPlugin)->getFileName().toConfig());
 
-		ConfMan.flushToDisk();
+		_pluginFilesChanged = true;
 	}
+
+	flushPluginFileNames();
+}
+
+/**
+ * Record the file name of every engine plugin loaded while scanning, so that
+ * a single scan is enough to find all engines directly afterwards.
+ **/
+void PluginManagerUncached::rememberPluginFileName(const Plugin *plugin) {
+	const Common::Path &filename = plugin->getFileName();
+	if (filename.empty())
+		return;
+
+	const Common::String engineId = plugin->get<MetaEngine>().getName();
+	const Common::String value = filename.toConfig();
+
+	if (!ConfMan.hasMiscDomain("engine_plugin_files"))
+		ConfMan.addMiscDomain("engine_plugin_files");
+
+	Common::ConfigManager::Domain *domain = ConfMan.getDomain("engine_plugin_files");
+	assert(domain);
+	if (domain->getValOrDefault(engineId) != value) {
+		domain->setVal(engineId, value);
+		_pluginFilesChanged = true;
+	}
+}
+
+void PluginManagerUncached::flushPluginFileNames() {
+	if (!_pluginFilesChanged)
+		return;
+
+	_pluginFilesChanged = false;
+	ConfMan.flushToDisk();
 }
 
 #ifndef DETECTION_STATIC
@@ -470,6 +503,7 @@ void PluginManagerUncached::loadFirstPlugin() {
 	for (_currentPlugin = _allEnginePlugins.begin(); _currentPlugin != _allEnginePlugins.end(); ++_currentPlugin) {
 		if ((*_currentPlugin)->loadPlugin()) {
 			addToPluginsInMemList(*_currentPlugin);
+			rememberPluginFileName(*_currentPlugin);
 			break;
 		}
 	}
@@ -484,9 +518,13 @@ bool PluginManagerUncached::loadNextPlugin() {
 	for (++_currentPlugin; _currentPlugin != _allEnginePlugins.end(); ++_currentPlugin) {
 		if ((*_currentPlugin)->loadPlugin()) {
 			addToPluginsInMemList(*_currentPlugin);
+			rememberPluginFileName(*_currentPlugin);
 			return true;
 		}
 	}
+
+	// The scan is over, keep what it found for the next runs
+	flushPluginFileNames();
 	return false; // no more in list
 }
 
@@ -692,6 +730,7 @@ DetectionResults EngineManager::detectGames(const Common::FSList &fslist, uint32
 
 	// Close all archives that were opened during detection
 	ADCacheMan.clearArchives();
+	ADCacheMan.saveStoredProperties();
 
 	return DetectionResults(candidates);
 }
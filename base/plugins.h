@@ -345,9 +345,12 @@ protected:
 	PluginList::iterator _currentPlugin;
 
 	bool _isDetectionLoaded;
+	bool _pluginFilesChanged;
 
-	PluginManagerUncached() : _detectionPlugin(nullptr), _currentPlugin(nullptr), _isDetectionLoaded(false) {}
+	PluginManagerUncached() : _detectionPlugin(nullptr), _currentPlugin(nullptr), _isDetectionLoaded(false), _pluginFilesChanged(false) {}
 	bool loadPluginByFileName(const Common::Path &filename);
+	void rememberPluginFileName(const Plugin *plugin);
+	void flushPluginFileNames();
 
 public:
 	virtual ~PluginManagerUncached();
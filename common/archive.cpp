@@ -25,6 +25,9 @@
 #include "common/system.h"
 #include "common/textconsole.h"
 #include "common/memstream.h"
+#include "common/mutex.h"
+#include "common/profiler.h"
+#include "common/timer.h"
 #include "common/punycode.h"
 #include "common/debug.h"
 
@@ -48,6 +51,158 @@ bool ArchiveMember::isDirectory() const {
 void ArchiveMember::listChildren(ArchiveMemberList &childList, const char *pattern) const {
 }
 
+namespace {
+
+enum {
+	// Big enough to keep the overhead low, small enough not to hold up the
+	// other timer callbacks for long
+	kPrefetchChunkSize = 64 * 1024,
+	kPrefetchTimerInterval = 5 * 1000
+};
+
+// The queue is only ever touched with the mutex held, which also keeps the
+// main thread and the timer from working on the same request at once.
+Mutex *g_prefetchMutex = nullptr;
+List<PrefetchRequest *> *g_prefetchQueue = nullptr;
+bool g_prefetchTimerInstalled = false;
+
+void prefetchTimerProc(void *refCon) {
+	PrefetchRequest::processQueue(1);
+}
+
+} // End of anonymous namespace
+
+PrefetchRequest::PrefetchRequest() : _state(kStateCancelled), _stream(nullptr), _data(nullptr), _size(0), _pos(0) {
+}
+
+PrefetchRequest::~PrefetchRequest() {
+	cancel();
+}
+
+void PrefetchRequest::queue() {
+	// The first request is queued from the main thread, before the timer
+	// runs, so creating the shared state lazily is safe
+	if (!g_prefetchMutex) {
+		g_prefetchMutex = new Mutex();
+		g_prefetchQueue = new List<PrefetchRequest *>();
+	}
+
+	{
+		StackLock lock(*g_prefetchMutex);
+		if (_state == kStateQueued)
+			return;
+
+		dropData();
+		_state = kStateQueued;
+		g_prefetchQueue->push_back(this);
+	}
+
+	if (!g_prefetchTimerInstalled) {
+		TimerManager *timer = g_system->getTimerManager();
+		g_prefetchTimerInstalled = timer && timer->installTimerProc(&prefetchTimerProc, kPrefetchTimerInterval, nullptr, "prefetch");
+	}
+}
+
+PrefetchRequest::State PrefetchRequest::getState() const {
+	if (!g_prefetchMutex)
+		return _state;
+
+	StackLock lock(*g_prefetchMutex);
+	return _state;
+}
+
+void PrefetchRequest::cancel() {
+	if (!g_prefetchMutex)
+		return;
+
+	StackLock lock(*g_prefetchMutex);
+	if (_state == kStateQueued)
+		g_prefetchQueue->remove(this);
+	dropData();
+	_state = kStateCancelled;
+}
+
+SeekableReadStream *PrefetchRequest::takeStream() {
+	if (!g_prefetchMutex)
+		return nullptr;
+
+	StackLock lock(*g_prefetchMutex);
+	if (_state == kStateCancelled)
+		return nullptr;
+
+	if (_state == kStateQueued) {
+		g_prefetchQueue->remove(this);
+		while (!step()) {
+		}
+	}
+
+	SeekableReadStream *stream = nullptr;
+	if (_data) {
+		stream = new MemoryReadStream(_data, _size, DisposeAfterUse::YES);
+		_data = nullptr;
+	}
+	dropData();
+	_state = kStateCancelled;
+	return stream;
+}
+
+bool PrefetchRequest::processQueue(uint maxSteps) {
+	if (!g_prefetchMutex)
+		return false;
+
+	StackLock lock(*g_prefetchMutex);
+	while (maxSteps-- && !g_prefetchQueue->empty()) {
+		PrefetchRequest *request = g_prefetchQueue->front();
+		if (request->step())
+			g_prefetchQueue->pop_front();
+	}
+
+	return !g_prefetchQueue->empty();
+}
+
+bool PrefetchRequest::step() {
+	if (!_stream) {
+		_stream = open();
+		int64 size = _stream ? _stream->size() : -1;
+		if (size > 0 && size < 0x7FFFFFFF)
+			_data = (byte *)malloc(size);
+
+		if (!_data) {
+			// Missing members and empty ones are left to the normal code path
+			dropData();
+			_state = kStateDone;
+			return true;
+		}
+		_size = (uint32)size;
+		_pos = 0;
+	}
+
+	uint32 len = MIN<uint32>(kPrefetchChunkSize, _size - _pos);
+	if (_stream->read(_data + _pos, len) != len) {
+		warning("PrefetchRequest: Reading failed after %u of %u bytes", _pos, _size);
+		dropData();
+		_state = kStateDone;
+		return true;
+	}
+
+	_pos += len;
+	if (_pos < _size)
+		return false;
+
+	delete _stream;
+	_stream = nullptr;
+	_state = kStateDone;
+	return true;
+}
+
+void PrefetchRequest::dropData() {
+	delete _stream;
+	_stream = nullptr;
+	free(_data);
+	_data = nullptr;
+	_size = _pos = 0;
+}
+
 GenericArchiveMember::GenericArchiveMember(const String &pathStr, const Archive &parent)
 	: _parent(parent), _path(pathStr, parent.getPathSeparator()) {
 }
@@ -249,50 +404,107 @@ SeekableReadStream *MemcachingCaseInsensitiveArchive::createReadStreamForMemberI
 	cacheKey.path = translatePath(path);
 	cacheKey.altStreamType = isAltStream ? altStreamType : AltStreamType::Invalid;
 
-	bool isNew = false;
-	if (!_cache.contains(cacheKey)) {
-		SharedArchiveContents readResult = isAltStream ? readContentsForPathAltStream(cacheKey.path, altStreamType) : readContentsForPath(cacheKey.path);
-		if (readResult._bypass)
-			return readResult._bypass;
-		_cache[cacheKey] = readResult;
-		isNew = true;
-	}
+	SharedArchiveContents *entry = nullptr;
+	bool wasStrong = false;
 
-	SharedArchiveContents* entry = &_cache[cacheKey];
+	CacheMap::iterator it = _cache.find(cacheKey);
+	if (it != _cache.end()) {
+		entry = &it->_value;
+		wasStrong = entry->isStrong();
 
-	// Errors and missing files. Just return nullptr,
-	// no need to create stream.
-	if (entry->isFileMissing())
-		return nullptr;
+		// Check whether the entry is still valid as WeakPtr might have expired.
+		if (!entry->makeStrong())
+			entry = nullptr;
+	}
+
+	if (entry) {
+		_cacheStats.hits++;
+	} else {
+		_cacheStats.misses++;
 
-	// Check whether the entry is still valid as WeakPtr might have expired.
-	if (!entry->makeStrong()) {
-		// If it's expired, recreate the entry.
 		SharedArchiveContents readResult = isAltStream ? readContentsForPathAltStream(cacheKey.path, altStreamType) : readContentsForPath(cacheKey.path);
 		if (readResult._bypass)
 			return readResult._bypass;
 		_cache[cacheKey] = readResult;
 		entry = &_cache[cacheKey];
-		isNew = true;
 	}
 
-	// It's possible that recreation failed in case of e.g. network
-	// share going offline.
+	// Errors and missing files. Just return nullptr,
+	// no need to create stream. It's also possible that
+	// recreation failed in case of e.g. network share
+	// going offline.
 	if (entry->isFileMissing())
 		return nullptr;
 
+	entry->_lastUse = ++_useCounter;
+
 	// Now we have a valid contents reference. Make stream for it.
 	Common::MemoryReadStream *memStream = new Common::MemoryReadStream(entry->getContents(), entry->getSize());
 
-	// If the entry was just created and it's too big for strong caching,
-	// mark the copy in cache as weak
-	if (isNew && entry->getSize() > _maxStronglyCachedSize) {
+	// If the entry is too big for strong caching, mark the copy in cache
+	// as weak, otherwise account for it in the budget
+	if (entry->getSize() > _maxStronglyCachedSize) {
 		entry->makeWeak();
+	} else if (!wasStrong) {
+		_cacheStats.strongBytes += entry->getSize();
+		trimCache(cacheKey);
 	}
 
 	return memStream;
 }
 
+void MemcachingCaseInsensitiveArchive::trimCache(const CacheKey &keep) const {
+	CacheKey_EqualTo equal;
+
+	while (_strongCacheBudget != 0 && _cacheStats.strongBytes > _strongCacheBudget) {
+		SharedArchiveContents *oldest = nullptr;
+		Array<CacheKey> expired;
+
+		for (CacheMap::iterator it = _cache.begin(); it != _cache.end(); ++it) {
+			SharedArchiveContents &entry = it->_value;
+
+			// Forget entries nobody holds on to anymore, or the cache would
+			// keep growing by one key per member ever opened
+			if (entry.isExpired()) {
+				expired.push_back(it->_key);
+				continue;
+			}
+
+			if (!entry.isStrong() || entry.getSize() == 0 || equal(it->_key, keep))
+				continue;
+
+			if (!oldest || entry._lastUse < oldest->_lastUse)
+				oldest = &entry;
+		}
+
+		for (const CacheKey &key : expired)
+			_cache.erase(key);
+
+		// Only the entry being returned is left
+		if (!oldest)
+			break;
+
+		_cacheStats.strongBytes -= oldest->getSize();
+		_cacheStats.evictions++;
+		oldest->makeWeak();
+	}
+}
+
+void MemcachingCaseInsensitiveArchive::setCachePolicy(uint32 maxStronglyCachedSize, uint32 strongCacheBudget) {
+	_maxStronglyCachedSize = maxStronglyCachedSize;
+	_strongCacheBudget = strongCacheBudget;
+
+	for (CacheMap::iterator it = _cache.begin(); it != _cache.end(); ++it) {
+		SharedArchiveContents &entry = it->_value;
+		if (entry.isStrong() && entry.getSize() > _maxStronglyCachedSize) {
+			_cacheStats.strongBytes -= entry.getSize();
+			entry.makeWeak();
+		}
+	}
+
+	trimCache(CacheKey());
+}
+
 SharedArchiveContents MemcachingCaseInsensitiveArchive::readContentsForPathAltStream(const Path &translatedPath, AltStreamType altStreamType) const {
 	return SharedArchiveContents();
 }
@@ -444,6 +656,11 @@ Archive *SearchSet::getArchive(const String &name) const {
 	return arch->_arc;
 }
 
+void SearchSet::listArchiveNames(List<String> &list) const {
+	for (const auto &archive : _list)
+		list.push_back(archive._name);
+}
+
 void SearchSet::clear() {
 	for (auto &archive : _list) {
 		if (archive._autoFree)
@@ -573,6 +790,8 @@ SeekableReadStream *SearchSet::createReadStreamForMember(const Path &path) const
 	if (path.empty())
 		return nullptr;
 
+	PROFILE_ZONE("SearchSet::createReadStreamForMember");
+
 	for (const auto &archive : _list) {
 		SeekableReadStream *stream = archive._arc->createReadStreamForMember(path);
 		if (stream)
@@ -582,6 +801,18 @@ SeekableReadStream *SearchSet::createReadStreamForMember(const Path &path) const
 	return nullptr;
 }
 
+PrefetchHandle SearchSet::prefetch(const Path &path) const {
+	if (path.empty())
+		return PrefetchHandle();
+
+	for (const auto &archive : _list) {
+		if (archive._arc->hasFile(path))
+			return archive._arc->prefetch(path);
+	}
+
+	return PrefetchHandle();
+}
+
 SeekableReadStream *SearchSet::createReadStreamForMemberAltStream(const Path &path, AltStreamType altStreamType) const {
 	if (path.empty())
 		return nullptr;
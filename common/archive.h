@@ -26,6 +26,7 @@
 #include "common/hashmap.h"
 #include "common/hash-str.h"
 #include "common/list.h"
+#include "common/noncopyable.h"
 #include "common/path.h"
 #include "common/ptr.h"
 #include "common/singleton.h"
@@ -105,6 +106,95 @@ struct ArchiveMemberListComparator {
 
 class Archive;
 
+/**
+ * A member of an archive being read into memory in the background, see
+ * Archive::prefetch().
+ *
+ * Queued requests are read a chunk at a time from a timer callback, which
+ * most backends run on a thread of their own. Archives implementing
+ * prefetch() subclass this with the means to open the member without
+ * touching the archive itself, so the read never races with the archive
+ * being used from the main thread.
+ */
+class PrefetchRequest : NonCopyable {
+public:
+	enum State {
+		kStateQueued,    ///< Waiting for, or in the middle of, being read.
+		kStateDone,      ///< All data is in memory, or the member could not be read.
+		kStateCancelled  ///< The data was dropped or handed over to a stream.
+	};
+
+	PrefetchRequest();
+	virtual ~PrefetchRequest();
+
+	/** Add the request to the queue of members to read in the background. */
+	void queue();
+
+	State getState() const;
+
+	/** Drop the request, and the data read so far. */
+	void cancel();
+
+	/**
+	 * Return a stream over the prefetched data, taking ownership of it.
+	 * A read which is still in progress is finished on the calling thread.
+	 *
+	 * @return The stream, or nullptr if the request was cancelled or the
+	 *         member could not be read.
+	 */
+	SeekableReadStream *takeStream();
+
+	/**
+	 * Do up to @p maxSteps steps of the queued reads on the calling thread.
+	 * This is what the prefetch timer does, one step per tick.
+	 *
+	 * @return Whether requests are left in the queue.
+	 */
+	static bool processQueue(uint maxSteps);
+
+protected:
+	/** Open the member to read. Called from the prefetch thread. */
+	virtual SeekableReadStream *open() = 0;
+
+private:
+	/** Read the next chunk of the member. Returns true when done. */
+	bool step();
+	void dropData();
+
+	State _state;
+	SeekableReadStream *_stream;
+	byte *_data;
+	uint32 _size;
+	uint32 _pos;
+};
+
+/**
+ * Handle on a member being prefetched, see Archive::prefetch().
+ *
+ * An invalid handle means the archive had nothing to prefetch, either
+ * because the member does not exist or because the archive cannot read
+ * members in the background.
+ */
+class PrefetchHandle {
+public:
+	PrefetchHandle() {}
+	explicit PrefetchHandle(const SharedPtr<PrefetchRequest> &request) : _request(request) {}
+
+	bool isValid() const { return _request.get() != nullptr; }
+
+	/** Check whether the data is already in memory. */
+	bool isDone() const { return _request && _request->getState() == PrefetchRequest::kStateDone; }
+
+	/** Give up on the prefetch, freeing the data if it was already read. */
+	void cancel() {
+		if (_request)
+			_request->cancel();
+	}
+
+private:
+	SharedPtr<PrefetchRequest> _request;
+};
+
 /**
  * Simple ArchiveMember implementation which allows
  * creation of ArchiveMember compatible objects via
@@ -196,6 +286,18 @@ public:
 	 */
 	virtual SeekableReadStream *createReadStreamForMemberAltStream(const Path &path, AltStreamType altStreamType) const;
 
+	/**
+	 * Hint that the member with the specified name will be opened soon, so
+	 * that it can be read into memory in the background. The next
+	 * createReadStreamForMember() call for it then returns a stream over the
+	 * data read so far without going to the disk again.
+	 *
+	 * The default implementation does nothing and returns an invalid handle.
+	 */
+	virtual PrefetchHandle prefetch(const Path &path) const {
+		return PrefetchHandle();
+	}
+
 	/**
 	 * For most archives: same as previous. For SearchSet see SearchSet
 	 * documentation.
@@ -243,16 +345,18 @@ class SharedArchiveContents {
 public:
 	SharedArchiveContents(byte *contents, uint32 contentSize) :
 		_strongRef(contents, ArrayDeleter<byte>()), _weakRef(_strongRef),
-		_contentSize(contentSize), _missingFile(false), _bypass(nullptr) {}
-	SharedArchiveContents() : _strongRef(nullptr), _weakRef(nullptr), _contentSize(0), _missingFile(true), _bypass(nullptr) {}
+		_contentSize(contentSize), _missingFile(false), _bypass(nullptr), _lastUse(0) {}
+	SharedArchiveContents() : _strongRef(nullptr), _weakRef(nullptr), _contentSize(0), _missingFile(true), _bypass(nullptr), _lastUse(0) {}
 	static SharedArchiveContents bypass(SeekableReadStream *stream) {
 		return SharedArchiveContents(stream);
 	}
 
 private:
-	SharedArchiveContents(SeekableReadStream *stream) : _strongRef(nullptr), _weakRef(nullptr), _contentSize(0), _missingFile(false), _bypass(stream) {}
+	SharedArchiveContents(SeekableReadStream *stream) : _strongRef(nullptr), _weakRef(nullptr), _contentSize(0), _missingFile(false), _bypass(stream), _lastUse(0) {}
 
 	bool isFileMissing() const { return _missingFile; }
+	bool isStrong() const { return _strongRef; }
+	bool isExpired() const { return !_strongRef && _contentSize != 0 && _weakRef.expired(); }
 	SharedPtr<byte> getContents() const { return _strongRef; }
 	uint32 getSize() const { return _contentSize; }
 
@@ -277,16 +381,47 @@ private:
 	uint32 _contentSize;
 	bool _missingFile;
 	SeekableReadStream *_bypass;
+	uint32 _lastUse;
 
 	friend class MemcachingCaseInsensitiveArchive;
 };
 
 /**
  * An archive that caches the resulting contents.
+ *
+ * Members up to maxStronglyCachedSize bytes stay in memory after their last
+ * stream is gone, as long as all of them together fit in strongCacheBudget
+ * bytes; the least recently used ones are dropped first when they don't.
+ * Bigger members are only kept for as long as a stream to them is alive.
  */
 class MemcachingCaseInsensitiveArchive : public Archive {
 public:
-	MemcachingCaseInsensitiveArchive(uint32 maxStronglyCachedSize = 512) : _maxStronglyCachedSize(maxStronglyCachedSize) {}
+	/** Cache usage counters, since the archive was created. */
+	struct CacheStats {
+		CacheStats() : hits(0), misses(0), evictions(0), strongBytes(0) {}
+
+		uint32 hits;        ///< Streams created from cached contents.
+		uint32 misses;      ///< Streams whose contents had to be read from the archive.
+		uint32 evictions;   ///< Members dropped from the cache to stay within budget.
+		uint32 strongBytes; ///< Size of the members currently kept in memory.
+	};
+
+	static const uint32 kDefaultStrongCacheBudget = 256 * 1024;
+
+	MemcachingCaseInsensitiveArchive(uint32 maxStronglyCachedSize = 512, uint32 strongCacheBudget = kDefaultStrongCacheBudget) :
+		_useCounter(0), _maxStronglyCachedSize(maxStronglyCachedSize), _strongCacheBudget(strongCacheBudget) {}
+
+	/**
+	 * Change the caching policy of this archive.
+	 *
+	 * @param maxStronglyCachedSize  Biggest member size which is kept in memory after use.
+	 * @param strongCacheBudget      Total size of the members kept in memory, 0 for unlimited.
+	 */
+	void setCachePolicy(uint32 maxStronglyCachedSize, uint32 strongCacheBudget);
+
+	const CacheStats &getCacheStats() const { return _cacheStats; }
+	uint32 getStrongCacheBudget() const { return _strongCacheBudget; }
+
 	SeekableReadStream *createReadStreamForMember(const Path &path) const;
 	SeekableReadStream *createReadStreamForMemberAltStream(const Path &path, Common::AltStreamType altStreamType) const;
 
@@ -313,10 +448,16 @@ private:
 		uint operator()(const CacheKey &x) const;
 	};
 
+	typedef HashMap<CacheKey, SharedArchiveContents, CacheKey_Hash, CacheKey_EqualTo> CacheMap;
+
 	SeekableReadStream *createReadStreamForMemberImpl(const Path &path, bool isAltStream, Common::AltStreamType altStreamType) const;
+	void trimCache(const CacheKey &keep) const;
 
-	mutable HashMap<CacheKey, SharedArchiveContents, CacheKey_Hash, CacheKey_EqualTo> _cache;
+	mutable CacheMap _cache;
+	mutable CacheStats _cacheStats;
+	mutable uint32 _useCounter;
 	uint32 _maxStronglyCachedSize;
+	uint32 _strongCacheBudget;
 	char _separator = '\0';
 };
 
@@ -434,6 +575,12 @@ public:
 	 */
 	Archive *getArchive(const String &name) const;
 
+	/**
+	 * Add the names of all archives in the searchable set to the given list,
+	 * in search order.
+	 */
+	void listArchiveNames(List<String> &list) const;
+
 	/**
 	 * Empty the searchable set.
 	 */
@@ -466,6 +613,12 @@ public:
 	 */
 	SeekableReadStream *createReadStreamForMemberAltStream(const Path &path, AltStreamType altStreamType) const override;
 
+	/**
+	 * Implement prefetch from the Archive base class. The member is
+	 * prefetched from the archive createReadStreamForMember() would pick.
+	 */
+	PrefetchHandle prefetch(const Path &path) const override;
+
 	/**
 	 * Similar to above but exclude matches from archives before starting and starting itself.
 	 */
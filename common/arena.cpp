@@ -0,0 +1,119 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/arena.h"
+#include "common/textconsole.h"
+
+namespace Common {
+
+enum {
+	// Pattern written over released memory in non-release builds
+	ARENA_POISON = 0xDD
+};
+
+Arena::Arena(size_t blockSize)
+	: _blockSize(blockSize), _current(nullptr), _destructors(nullptr), _bytesUsed(0), _bytesReserved(0) {
+	assert(blockSize > 0);
+}
+
+Arena::~Arena() {
+	reset();
+	freeBlocks(_current);
+}
+
+Arena::Block *Arena::allocBlock(size_t size) {
+	Block *block = (Block *)::malloc(sizeof(Block) + size);
+	if (!block)
+		error("Arena::allocBlock: Out of memory allocating %u bytes", (uint)size);
+
+	block->_next = nullptr;
+	block->_size = size;
+	block->_used = 0;
+	_bytesReserved += size;
+	return block;
+}
+
+void Arena::freeBlocks(Block *block) {
+	while (block) {
+		Block *next = block->_next;
+		_bytesReserved -= block->_size;
+		::free(block);
+		block = next;
+	}
+}
+
+void *Arena::allocate(size_t size, size_t alignment) {
+	assert(alignment > 0 && (alignment & (alignment - 1)) == 0);
+
+	if (_current) {
+		uintptr addr = (uintptr)(_current->data() + _current->_used);
+		size_t padding = (size_t)(-addr & (alignment - 1));
+		if (_current->_used + padding + size <= _current->_size) {
+			_current->_used += padding + size;
+			_bytesUsed += size;
+			return (void *)(addr + padding);
+		}
+	}
+
+	// Start a new block, big enough for the request even in the worst case of alignment
+	Block *block = allocBlock(MAX(_blockSize, size + alignment - 1));
+	block->_next = _current;
+	_current = block;
+
+	uintptr addr = (uintptr)block->data();
+	size_t padding = (size_t)(-addr & (alignment - 1));
+	block->_used = padding + size;
+	_bytesUsed += size;
+	return (void *)(addr + padding);
+}
+
+const char *Arena::copyString(const char *str, size_t len) {
+	char *copy = (char *)allocate(len + 1, 1);
+	memcpy(copy, str, len);
+	copy[len] = '\0';
+	return copy;
+}
+
+void Arena::reset() {
+	// Destructors are chained most recent first, giving the reverse order of creation
+	while (_destructors) {
+		Destructor *dtor = _destructors;
+		_destructors = dtor->_next;
+		dtor->_destroy(dtor->_object);
+	}
+
+	if (_current && _current->_next) {
+		// The last frame did not fit in one block; replace all of them with
+		// a single block the size of all of them, so the next one will.
+		size_t total = _bytesReserved;
+		freeBlocks(_current);
+		_current = allocBlock(total);
+	} else if (_current) {
+#ifndef RELEASE_BUILD
+		memset(_current->data(), ARENA_POISON, _current->_used);
+#endif
+		_current->_used = 0;
+	}
+
+	_bytesUsed = 0;
+}
+
+} // End of namespace Common
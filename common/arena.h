@@ -0,0 +1,265 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef COMMON_ARENA_H
+#define COMMON_ARENA_H
+
+#include "common/scummsys.h"
+#include "common/noncopyable.h"
+#include "common/str.h"
+#include "common/util.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_arena Arena allocator
+ * @ingroup common_memory
+ *
+ * @brief API for bump allocation of short-lived memory.
+ * @{
+ */
+
+/**
+ * An arena hands out memory by bumping a pointer through big blocks, and
+ * releases all of it at once with reset().
+ *
+ * This is meant for data which lives for a well defined period, typically
+ * one frame: allocating from an arena costs a few instructions, and nothing
+ * has to be freed individually. Objects created with create() get their
+ * destructors called on reset(); memory from allocate() is just dropped.
+ *
+ * After the first few frames the arena has grown to fit the biggest frame
+ * and no more calls to malloc() are made at all.
+ *
+ * In non-release builds, released memory is overwritten with a poison
+ * pattern to catch dangling pointers into the arena.
+ */
+class Arena : NonCopyable {
+public:
+	/**
+	 * @param blockSize  Size of the blocks the arena allocates memory from.
+	 *                   Bigger requests get a block of their own.
+	 */
+	explicit Arena(size_t blockSize = 64 * 1024);
+	~Arena();
+
+	/**
+	 * Allocate size bytes, aligned to the given power of two.
+	 * The memory is uninitialized.
+	 */
+	void *allocate(size_t size, size_t alignment = sizeof(void *));
+
+	/** Allocate uninitialized storage for count objects of type T. */
+	template<class T>
+	T *allocateArray(size_t count) {
+		return (T *)allocate(count * sizeof(T), alignof(T));
+	}
+
+	/**
+	 * Construct an object in the arena. Its destructor is called when the
+	 * arena is reset.
+	 */
+	template<class T, class... TArgs>
+	T *create(TArgs &&...args) {
+		Destructor *dtor = (Destructor *)allocate(sizeof(Destructor), alignof(Destructor));
+		T *obj = new (allocate(sizeof(T), alignof(T))) T(Common::forward<TArgs>(args)...);
+		dtor->_object = obj;
+		dtor->_destroy = &destroy<T>;
+		dtor->_next = _destructors;
+		_destructors = dtor;
+		return obj;
+	}
+
+	/** Copy a string into the arena, nul-terminated. */
+	const char *copyString(const char *str, size_t len);
+	const char *copyString(const char *str) { return copyString(str, strlen(str)); }
+	const char *copyString(const String &str) { return copyString(str.c_str(), str.size()); }
+
+	/**
+	 * Release everything allocated since the last reset, and call the
+	 * destructors of objects created with create() in reverse order.
+	 *
+	 * The memory blocks are kept for reuse; if the arena had to spill into
+	 * more than one block, they are merged into a single big one.
+	 */
+	void reset();
+
+	/** Total number of bytes handed out since the last reset. */
+	size_t getBytesUsed() const { return _bytesUsed; }
+
+	/** Total number of bytes allocated from the system. */
+	size_t getBytesReserved() const { return _bytesReserved; }
+
+private:
+	struct Block {
+		Block *_next;
+		size_t _size;
+		size_t _used;
+
+		byte *data() { return (byte *)(this + 1); }
+	};
+
+	struct Destructor {
+		void *_object;
+		void (*_destroy)(void *object);
+		Destructor *_next;
+	};
+
+	template<class T>
+	static void destroy(void *object) {
+		((T *)object)->~T();
+	}
+
+	Block *allocBlock(size_t size);
+	void freeBlocks(Block *block);
+
+	const size_t _blockSize;
+	Block *_current;    ///< Block being allocated from, head of the list of used blocks.
+	Destructor *_destructors;
+	size_t _bytesUsed;
+	size_t _bytesReserved;
+};
+
+/**
+ * A pair of arenas for data which has to live for one frame after the one
+ * it was built in, e.g. draw lists which are built in one frame and
+ * consumed while the next one is prepared.
+ *
+ * Call nextFrame() at the start of each frame: it resets the arena of the
+ * frame before the previous one and makes it current.
+ */
+class FrameAllocator : NonCopyable {
+public:
+	explicit FrameAllocator(size_t blockSize = 64 * 1024) : _first(blockSize), _second(blockSize), _current(&_first), _previous(&_second) {}
+
+	/** Arena for allocations of the current frame. */
+	Arena &current() { return *_current; }
+	/** Arena of the previous frame, still valid until the next nextFrame(). */
+	Arena &previous() { return *_previous; }
+
+	void nextFrame() {
+		SWAP(_current, _previous);
+		_current->reset();
+	}
+
+	void *allocate(size_t size, size_t alignment = sizeof(void *)) { return _current->allocate(size, alignment); }
+
+	template<class T, class... TArgs>
+	T *create(TArgs &&...args) { return _current->create<T>(Common::forward<TArgs>(args)...); }
+
+private:
+	Arena _first;
+	Arena _second;
+	Arena *_current;
+	Arena *_previous;
+};
+
+/**
+ * A growable array whose storage lives in an Arena.
+ *
+ * It has the usual Array interface for building temporary lists, but
+ * neither it nor its elements ever free memory: growing abandons the old
+ * storage, which is reclaimed with the rest of the arena. Elements are
+ * destroyed when the array is cleared or destroyed, so the array itself
+ * must not outlive the arena.
+ */
+template<class T>
+class ArenaArray : NonCopyable {
+public:
+	typedef T *iterator;
+	typedef const T *const_iterator;
+	typedef T value_type;
+	typedef uint size_type;
+
+	explicit ArenaArray(Arena &arena, size_type capacity = 0) : _arena(arena), _storage(nullptr), _size(0), _capacity(0) {
+		if (capacity)
+			reserve(capacity);
+	}
+
+	~ArenaArray() { clear(); }
+
+	void push_back(const T &element) {
+		if (_size == _capacity)
+			reserve(_capacity ? _capacity * 2 : 8);
+		new ((void *)&_storage[_size++]) T(element);
+	}
+
+	template<class... TArgs>
+	void emplace_back(TArgs &&...args) {
+		if (_size == _capacity)
+			reserve(_capacity ? _capacity * 2 : 8);
+		new ((void *)&_storage[_size++]) T(Common::forward<TArgs>(args)...);
+	}
+
+	void pop_back() {
+		assert(_size > 0);
+		_storage[--_size].~T();
+	}
+
+	void reserve(size_type newCapacity) {
+		if (newCapacity <= _capacity)
+			return;
+
+		T *newStorage = _arena.allocateArray<T>(newCapacity);
+		for (size_type i = 0; i < _size; ++i) {
+			new ((void *)&newStorage[i]) T(Common::move(_storage[i]));
+			_storage[i].~T();
+		}
+		_storage = newStorage;
+		_capacity = newCapacity;
+	}
+
+	void clear() {
+		for (size_type i = 0; i < _size; ++i)
+			_storage[i].~T();
+		_size = 0;
+	}
+
+	T &operator[](size_type idx) {
+		assert(idx < _size);
+		return _storage[idx];
+	}
+
+	const T &operator[](size_type idx) const {
+		assert(idx < _size);
+		return _storage[idx];
+	}
+
+	size_type size() const { return _size; }
+	bool empty() const { return _size == 0; }
+
+	iterator begin() { return _storage; }
+	iterator end() { return _storage + _size; }
+	const_iterator begin() const { return _storage; }
+	const_iterator end() const { return _storage + _size; }
+
+private:
+	Arena &_arena;
+	T *_storage;
+	size_type _size;
+	size_type _capacity;
+};
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
@@ -26,6 +26,7 @@
 #include "common/algorithm.h"
 #include "common/textconsole.h" // For error()
 #include "common/memory.h"
+#include "common/memtag.h"
 
 namespace Common {
 
@@ -148,10 +149,21 @@ public:
 		if (_size != _capacity && index == _size) {
 			// Added at the end in the existing storage
 			new (_storage + index) T(Common::forward<TArgs>(args)...);
+		} else if (_size != _capacity) {
+			// Added in the middle of the existing storage. The new element is
+			// built first, as the parameters may refer to an element about to
+			// be shifted.
+			// Elements are shifted by move construction only, so this works
+			// for types which cannot be assigned to.
+			T tmp(Common::forward<TArgs>(args)...);
+
+			for (size_type i = _size; i > index; --i) {
+				new (_storage + i) T(Common::move(_storage[i - 1]));
+				_storage[i - 1].~T();
+			}
+			new (_storage + index) T(Common::move(tmp));
 		} else {
-			// Either added in the middle, or ran out of space
-			// In the added-in-the-middle case, the copy is required because the parameters
-			// may contain a const ref to the original storage.
+			// Ran out of space
 			T *oldStorage = _storage;
 
 			allocCapacity(roundUpCapacity(_size + 1));
@@ -240,7 +252,7 @@ public:
 	/** Insert an element into the array at the given position. */
 	void insert_at(size_type idx, const T &element) {
 		assert(idx <= _size);
-		insert_aux(_storage + idx, &element, &element + 1);
+		emplace(_storage + idx, element);
 	}
 
 	/** Insert copies of all the elements from the given array into this array at the given position. */
@@ -249,11 +261,24 @@ public:
 		insert_aux(_storage + idx, array.begin(), array.end());
 	}
 
+	/** Move an element into the array at the given position. */
+	void insert_at(size_type idx, T &&element) {
+		assert(idx <= _size);
+		emplace(_storage + idx, Common::move(element));
+	}
+
 	/**
 	 * Insert an element before @p pos.
 	 */
 	void insert(iterator pos, const T &element) {
-		insert_aux(pos, &element, &element + 1);
+		emplace(pos, element);
+	}
+
+	/**
+	 * Move an element into the array before @p pos.
+	 */
+	void insert(iterator pos, T &&element) {
+		emplace(pos, Common::move(element));
 	}
 
 	/** Remove an element at the given position from the array and return the value of that element. */
@@ -467,7 +492,7 @@ protected:
 	void allocCapacity(size_type capacity) {
 		_capacity = capacity;
 		if (capacity) {
-			_storage = (T *)malloc(sizeof(T) * capacity);
+			_storage = (T *)taggedMalloc(sizeof(T) * capacity);
 			if (!_storage)
 				::error("Common::Array: failure to allocate %u bytes", capacity * (size_type)sizeof(T));
 		} else {
@@ -479,7 +504,7 @@ protected:
 	void freeStorage(T *storage, const size_type elements) {
 		for (size_type i = 0; i < elements; ++i)
 			storage[i].~T();
-		free(storage);
+		taggedFree(storage);
 	}
 
 	/**
@@ -618,6 +643,262 @@ private:
 	Comparator _comparator;
 };
 
+/**
+ * Array which keeps up to @p N elements in storage inside the object
+ * itself, and only allocates memory from the heap when it grows beyond
+ * that.
+ *
+ * This is meant for short temporary lists, e.g. a few rects or tokens
+ * built on the stack, which would otherwise cost a malloc() and free()
+ * each time. Its interface is a subset of the one of Array.
+ */
+template<class T, uint N>
+class SmallArray {
+	static_assert(N > 0, "SmallArray needs room for at least one element");
+
+public:
+	typedef T *iterator; /*!< Array iterator. */
+	typedef const T *const_iterator; /*!< Const-qualified array iterator. */
+
+	typedef T value_type; /*!< Value type of the array. */
+
+	typedef uint size_type; /*!< Size type of the array. */
+
+	SmallArray() : _capacity(N), _size(0), _storage(inlineStorage()) {}
+
+	SmallArray(std::initializer_list<T> list) : _capacity(N), _size(0), _storage(inlineStorage()) {
+		reserve(list.size());
+		uninitialized_copy(list.begin(), list.end(), _storage);
+		_size = list.size();
+	}
+
+	SmallArray(const SmallArray &array) : _capacity(N), _size(0), _storage(inlineStorage()) {
+		reserve(array._size);
+		uninitialized_copy(array.begin(), array.end(), _storage);
+		_size = array._size;
+	}
+
+	SmallArray(SmallArray &&old) : _capacity(N), _size(0), _storage(inlineStorage()) {
+		takeFrom(old);
+	}
+
+	~SmallArray() {
+		clear();
+		if (!isInline())
+			taggedFree(_storage);
+	}
+
+	SmallArray &operator=(const SmallArray &array) {
+		if (this == &array)
+			return *this;
+
+		clear();
+		reserve(array._size);
+		uninitialized_copy(array.begin(), array.end(), _storage);
+		_size = array._size;
+		return *this;
+	}
+
+	SmallArray &operator=(SmallArray &&old) {
+		if (this == &old)
+			return *this;
+
+		clear();
+		if (!isInline()) {
+			taggedFree(_storage);
+			_storage = inlineStorage();
+			_capacity = N;
+		}
+		takeFrom(old);
+		return *this;
+	}
+
+	/** Construct an element to the end of the array. */
+	template<class... TArgs>
+	void emplace_back(TArgs &&...args) {
+		if (_size == _capacity) {
+			// Build the element first, since the parameters may refer to
+			// the storage which is about to be reallocated
+			T tmp(Common::forward<TArgs>(args)...);
+			reserve(_capacity * 2);
+			new ((void *)(_storage + _size)) T(Common::move(tmp));
+		} else {
+			new ((void *)(_storage + _size)) T(Common::forward<TArgs>(args)...);
+		}
+		_size++;
+	}
+
+	/** Append an element to the end of the array. */
+	void push_back(const T &element) {
+		emplace_back(element);
+	}
+
+	/** Append an element to the end of the array. */
+	void push_back(T &&element) {
+		emplace_back(Common::move(element));
+	}
+
+	/** Remove the last element of the array. */
+	void pop_back() {
+		assert(_size > 0);
+		_size--;
+		_storage[_size].~T();
+	}
+
+	/** Insert an element into the array at the given position. */
+	void insert_at(size_type idx, const T &element) {
+		assert(idx <= _size);
+		T tmp(element);
+		if (_size == _capacity)
+			reserve(_capacity * 2);
+
+		for (size_type i = _size; i > idx; --i) {
+			new ((void *)(_storage + i)) T(Common::move(_storage[i - 1]));
+			_storage[i - 1].~T();
+		}
+		new ((void *)(_storage + idx)) T(Common::move(tmp));
+		_size++;
+	}
+
+	/** Remove an element at the given position from the array and return the value of that element. */
+	T remove_at(size_type idx) {
+		assert(idx < _size);
+		T tmp = Common::move(_storage[idx]);
+		erase(_storage + idx);
+		return tmp;
+	}
+
+	/** Erase the element at @p pos position and return an iterator pointing to the next element in the array. */
+	iterator erase(iterator pos) {
+		Common::move(pos + 1, _storage + _size, pos);
+		pop_back();
+		return pos;
+	}
+
+	/** Return a reference to the element at the given position in the array. */
+	T &operator[](size_type idx) {
+		assert(idx < _size);
+		return _storage[idx];
+	}
+
+	/** Return a const reference to the element at the given position in the array. */
+	const T &operator[](size_type idx) const {
+		assert(idx < _size);
+		return _storage[idx];
+	}
+
+	/** Return a reference to the first element of the array. */
+	T &front() {
+		assert(_size > 0);
+		return _storage[0];
+	}
+
+	/** Return a reference to the first element of the array. */
+	const T &front() const {
+		assert(_size > 0);
+		return _storage[0];
+	}
+
+	/** Return a reference to the last element of the array. */
+	T &back() {
+		assert(_size > 0);
+		return _storage[_size - 1];
+	}
+
+	/** Return a reference to the last element of the array. */
+	const T &back() const {
+		assert(_size > 0);
+		return _storage[_size - 1];
+	}
+
+	/** Return a pointer to the underlying memory serving as element storage. */
+	T *data() { return _storage; }
+	/** Return a pointer to the underlying memory serving as element storage. */
+	const T *data() const { return _storage; }
+
+	/** Return the size of the array. */
+	size_type size() const { return _size; }
+
+	/** Check whether the array is empty. */
+	bool empty() const { return _size == 0; }
+
+	/** Check whether the elements are still stored inside the object. */
+	bool isInline() const { return _storage == inlineStorage(); }
+
+	/** Remove all elements. Heap storage, if any, is kept for reuse. */
+	void clear() {
+		for (size_type i = 0; i < _size; ++i)
+			_storage[i].~T();
+		_size = 0;
+	}
+
+	/** Reserve enough memory in the array so that it can store at least the given number of elements. */
+	void reserve(size_type newCapacity) {
+		if (newCapacity <= _capacity)
+			return;
+
+		T *newStorage = (T *)taggedMalloc(sizeof(T) * newCapacity);
+		if (!newStorage)
+			::error("Common::SmallArray: failure to allocate %u bytes", newCapacity * (size_type)sizeof(T));
+
+		uninitialized_move(_storage, _storage + _size, newStorage);
+		for (size_type i = 0; i < _size; ++i)
+			_storage[i].~T();
+		if (!isInline())
+			taggedFree(_storage);
+
+		_storage = newStorage;
+		_capacity = newCapacity;
+	}
+
+	/** Change the size of the array. */
+	void resize(size_type newSize) {
+		reserve(newSize);
+
+		for (size_type i = newSize; i < _size; ++i)
+			_storage[i].~T();
+		for (size_type i = _size; i < newSize; ++i)
+			new ((void *)&_storage[i]) T();
+
+		_size = newSize;
+	}
+
+	/** Return an iterator pointing to the first element in the array. */
+	iterator begin() { return _storage; }
+	/** Return an iterator pointing past the last element in the array. */
+	iterator end() { return _storage + _size; }
+	/** Return a const iterator pointing to the first element in the array. */
+	const_iterator begin() const { return _storage; }
+	/** Return a const iterator pointing past the last element in the array. */
+	const_iterator end() const { return _storage + _size; }
+
+private:
+	T *inlineStorage() { return (T *)_inline; }
+	const T *inlineStorage() const { return (const T *)_inline; }
+
+	/** Move the contents of @p old into this empty, inline array. */
+	void takeFrom(SmallArray &old) {
+		if (old.isInline()) {
+			uninitialized_move(old.begin(), old.end(), _storage);
+			_size = old._size;
+			old.clear();
+		} else {
+			_storage = old._storage;
+			_capacity = old._capacity;
+			_size = old._size;
+
+			old._storage = old.inlineStorage();
+			old._capacity = N;
+			old._size = 0;
+		}
+	}
+
+	size_type _capacity;
+	size_type _size;
+	T *_storage;
+	alignas(T) byte _inline[N * sizeof(T)];
+};
+
 /** @} */
 
 } // End of namespace Common
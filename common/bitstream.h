@@ -41,6 +41,21 @@ namespace Common {
  * @{
  */
 
+class BitStreamMemoryStream;
+
+/**
+ * Return the data not yet read from @p stream, if it can be accessed
+ * directly, and the number of bytes of it in @p size.
+ *
+ * Generic streams can not, and are read one data value at a time.
+ */
+template<class STREAM>
+inline const byte *getBitStreamDirectData(STREAM *stream, uint32 &size) {
+	return nullptr;
+}
+
+inline const byte *getBitStreamDirectData(BitStreamMemoryStream *stream, uint32 &size);
+
 /**
  * A template implementing a bit stream for different data memory layouts.
  *
@@ -84,8 +99,61 @@ private:
 		return 0;
 	}
 
+	/** Read a data value from memory. */
+	FORCEINLINE static uint32 loadData(const byte *data) {
+		if (valueBits == 8)
+			return *data;
+		if (valueBits == 16)
+			return isLE ? READ_LE_UINT16(data) : READ_BE_UINT16(data);
+		return isLE ? READ_LE_UINT32(data) : READ_BE_UINT32(data);
+	}
+
+	/**
+	 * Fill the container with as many whole data values as fit, straight
+	 * from memory, when the stream allows it and has enough data left.
+	 */
+	FORCEINLINE bool refillContainer() {
+		if (sizeof(CONTAINER) != 8)
+			return false;
+
+		uint32 available;
+		const byte *data = getBitStreamDirectData(_stream, available);
+		if (!data || available < 8 || _pos + _bitsLeft + 64 > _size)
+			return false;
+
+		const uint count = (64 - _bitsLeft) / valueBits;
+		const uint bits = count * valueBits;
+
+		// When the values are in the order the bits are handed out, a single
+		// 64-bit load gets all of them
+		if (MSB2LSB && (valueBits == 8 || !isLE)) {
+			uint64 value = READ_BE_UINT64(data);
+			_bitContainer |= (value >> (64 - bits)) << (64 - bits - _bitsLeft);
+		} else if (!MSB2LSB && (valueBits == 8 || isLE)) {
+			uint64 value = READ_LE_UINT64(data);
+			if (bits < 64)
+				value &= ((uint64)1 << bits) - 1;
+			_bitContainer |= value << _bitsLeft;
+		} else {
+			for (uint i = 0; i < count; ++i) {
+				CONTAINER value = loadData(data + i * (valueBits / 8));
+				if (MSB2LSB)
+					_bitContainer |= value << (64 - valueBits - _bitsLeft - i * valueBits);
+				else
+					_bitContainer |= value << (_bitsLeft + i * valueBits);
+			}
+		}
+
+		_stream->skip(bits / 8);
+		_bitsLeft += bits;
+		return true;
+	}
+
 	/** Fill the container with at least @p min bits. */
 	FORCEINLINE void fillContainer(size_t min) {
+		if (_bitsLeft < min && refillContainer())
+			return;
+
 		while (_bitsLeft < min) {
 
 			CONTAINER data;
@@ -382,6 +450,14 @@ public:
 		return true;
 	}
 
+	/** Skip @p n bytes, which must be available. */
+	void skip(uint32 n) {
+		assert(_pos + n <= _size);
+
+		_pos += n;
+		_ptr += n;
+	}
+
 	byte readByte() {
 		if (_pos >= _size) {
 			_eos = true;
@@ -422,7 +498,7 @@ public:
 			}
 		}
 
-		uint16 val = READ_LE_UINT16(_ptr);
+		uint16 val = READ_BE_UINT16(_ptr);
 
 		_pos += 2;
 		_ptr += 2;
@@ -466,8 +542,14 @@ public:
 		return val;
 	}
 
+	friend const byte *getBitStreamDirectData(BitStreamMemoryStream *stream, uint32 &size);
 };
 
+inline const byte *getBitStreamDirectData(BitStreamMemoryStream *stream, uint32 &size) {
+	size = stream->_size - stream->_pos;
+	return stream->_ptr;
+}
+
 /**
  * @name Typedefs for various memory layouts
  * @{
@@ -315,16 +315,81 @@ static const int ascii_tree[] = {
 	LN(509, 128)      LN(510, 26)
 };
 
+/**
+ * The first eight bits of a code in one of the trees above, indexed with
+ * the bits in the order getBitsLSB() returns them. Codes of up to eight
+ * bits resolve to their leaf directly, longer ones to the node the tree
+ * walk continues from.
+ */
+struct HuffmanPrefixTable {
+	static const int kBits = 8;
+
+	uint16 node[1 << kBits];	///< leaf value, or node position if length is 0
+	byte length[1 << kBits];	///< number of bits of the code, 0 if longer than kBits
+
+	void build(const int *tree) {
+		for (int index = 0; index < (1 << kBits); index++) {
+			int pos = 0;
+			int depth = 0;
+			while (!(tree[pos] & HUFFMAN_LEAF) && depth < kBits) {
+				pos = ((index >> depth) & 1) ? tree[pos] & 0xFFF : tree[pos] >> 12;
+				depth++;
+			}
+
+			if (tree[pos] & HUFFMAN_LEAF) {
+				node[index] = tree[pos] & 0xFFFF;
+				length[index] = depth;
+			} else {
+				node[index] = pos;
+				length[index] = 0;
+			}
+		}
+	}
+};
+
+static const HuffmanPrefixTable &getPrefixTable(const int *tree) {
+	static HuffmanPrefixTable tables[3];
+	static bool built = false;
+
+	if (!built) {
+		tables[0].build(length_tree);
+		tables[1].build(distance_tree);
+		tables[2].build(ascii_tree);
+		built = true;
+	}
+
+	if (tree == length_tree)
+		return tables[0];
+	if (tree == distance_tree)
+		return tables[1];
+	return tables[2];
+}
+
 int DecompressorDCL::huffman_lookup(const int *tree) {
 	int pos = 0;
 
+	// The table is only used when the bits are already buffered, so the
+	// source stream is read at exactly the same points as by the tree walk
+	if (_nBits >= HuffmanPrefixTable::kBits) {
+		const HuffmanPrefixTable &table = getPrefixTable(tree);
+		const uint index = _dwBits & ((1 << HuffmanPrefixTable::kBits) - 1);
+
+		if (table.length[index]) {
+			_dwBits >>= table.length[index];
+			_nBits -= table.length[index];
+			return table.node[index];
+		}
+
+		_dwBits >>= HuffmanPrefixTable::kBits;
+		_nBits -= HuffmanPrefixTable::kBits;
+		pos = table.node[index];
+	}
+
 	while (!(tree[pos] & HUFFMAN_LEAF)) {
 		int bit = getBitsLSB(1);
-		debug(8, "[%d]:%d->", pos, bit);
 		pos = bit ? tree[pos] & 0xFFF : tree[pos] >> 12;
 	}
 
-	debug(8, "=%02x\n", tree[pos] & 0xffff);
 	return tree[pos] & 0xFFFF;
 }
 
@@ -370,6 +435,8 @@ bool DecompressorDCL::unpack(SeekableReadStream *sourceStream, WriteStream *targ
 		return false;
 	}
 	dictionaryMask = dictionarySize - 1;
+	// Checked once, as the per byte trace is in the innermost loops
+	const bool traceBytes = debugLevelSet(9);
 
 	while ((!targetFixedSize) || (_bytesWritten < _targetSize)) {
 		if (getBitsLSB(1)) { // (length,distance) pair
@@ -416,7 +483,8 @@ bool DecompressorDCL::unpack(SeekableReadStream *sourceStream, WriteStream *targ
 			while (tokenLength) {
 				// Write byte from dictionary
 				putByte(dictionary[dictionaryIndex]);
-				debug(9, "\33[32;31m%02x\33[37;37m ", dictionary[dictionaryIndex]);
+				if (traceBytes)
+					debug(9, "\33[32;31m%02x\33[37;37m ", dictionary[dictionaryIndex]);
 
 				dictionary[dictionaryNextIndex] = dictionary[dictionaryIndex];
 
@@ -443,7 +511,8 @@ bool DecompressorDCL::unpack(SeekableReadStream *sourceStream, WriteStream *targ
 			if (dictionaryPos >= dictionarySize)
 				dictionaryPos = 0;
 
-			debug(9, "\33[32;31m%02x \33[37;37m", value);
+			if (traceBytes)
+				debug(9, "\33[32;31m%02x \33[37;37m", value);
 		}
 	}
 
@@ -83,6 +83,277 @@ bool inflateZlibInstallShield(byte *dst, uint dstLen, const byte *src, uint srcL
 	return true;
 }
 
+/**
+ * The parts of a member split across volumes, read as one stream.
+ */
+class InstallShieldSplitStream : public SeekableReadStream {
+public:
+	InstallShieldSplitStream() : _size(0), _pos(0), _err(false), _eos(false) {}
+
+	void addPart(SeekableReadStream *part);
+
+	bool err() const override { return _err; }
+	void clearErr() override { _err = false; _eos = false; }
+	bool eos() const override { return _eos; }
+
+	int64 pos() const override { return _pos; }
+	int64 size() const override { return _size; }
+	bool seek(int64 offset, int whence = SEEK_SET) override;
+
+	uint32 read(void *dataPtr, uint32 dataSize) override;
+
+private:
+	Array<SharedPtr<SeekableReadStream> > _parts;
+	Array<uint32> _partStarts;
+	uint32 _size;
+	uint32 _pos;
+	bool _err;
+	bool _eos;
+};
+
+void InstallShieldSplitStream::addPart(SeekableReadStream *part) {
+	_parts.push_back(SharedPtr<SeekableReadStream>(part));
+	_partStarts.push_back(_size);
+	_size += part->size();
+}
+
+bool InstallShieldSplitStream::seek(int64 offset, int whence) {
+	int64 newPos;
+	switch (whence) {
+	case SEEK_SET:
+		newPos = offset;
+		break;
+	case SEEK_CUR:
+		newPos = _pos + offset;
+		break;
+	case SEEK_END:
+		newPos = _size + offset;
+		break;
+	default:
+		return false;
+	}
+
+	if (newPos < 0 || newPos > _size)
+		return false;
+
+	_pos = newPos;
+	_eos = false;
+	return true;
+}
+
+uint32 InstallShieldSplitStream::read(void *dataPtr, uint32 dataSize) {
+	byte *dst = (byte *)dataPtr;
+	uint32 total = 0;
+
+	// There are only ever a few parts
+	uint part = 0;
+	while (part + 1 < _parts.size() && _partStarts[part + 1] <= _pos)
+		part++;
+
+	while (total < dataSize) {
+		if (_pos >= _size) {
+			_eos = true;
+			break;
+		}
+
+		while (_pos >= _partStarts[part] + _parts[part]->size())
+			part++;
+
+		SeekableReadStream *stream = _parts[part].get();
+		uint32 partPos = _pos - _partStarts[part];
+		uint32 count = MIN<uint32>(dataSize - total, stream->size() - partPos);
+
+		stream->seek(partPos);
+		uint32 actual = stream->read(dst + total, count);
+		total += actual;
+		_pos += actual;
+
+		if (actual != count) {
+			_err = true;
+			break;
+		}
+	}
+
+	return total;
+}
+
+/**
+ * On-the-fly decompression of an InstallShield member made of independently
+ * deflated chunks, each preceded by its compressed size.
+ *
+ * Only the chunk holding the current position is kept in memory. The start
+ * of every chunk decoded so far is remembered, so seeking backward resumes
+ * from the right chunk instead of restarting from the beginning.
+ */
+class InstallShieldDeflateStream : public SeekableReadStream {
+public:
+	InstallShieldDeflateStream(SeekableReadStream *compressed, uint32 uncompressedSize);
+
+	bool err() const override { return _err; }
+	void clearErr() override { _err = false; _eos = false; }
+	bool eos() const override { return _eos; }
+
+	int64 pos() const override { return _pos; }
+	int64 size() const override { return _size; }
+	bool seek(int64 offset, int whence = SEEK_SET) override;
+
+	uint32 read(void *dataPtr, uint32 dataSize) override;
+
+private:
+	/** The start of a chunk, in the compressed and the uncompressed data. */
+	struct Checkpoint {
+		uint32 compressedPos;
+		uint32 pos;
+	};
+
+	ScopedPtr<SeekableReadStream> _compressed;
+	uint32 _size;
+	uint32 _pos;
+	bool _err;
+	bool _eos;
+
+	Array<Checkpoint> _checkpoints;
+	Array<byte> _compressedChunk;
+
+	Array<byte> _chunk;
+	uint32 _chunkIndex; // in _checkpoints
+	uint32 _chunkPos;
+	uint32 _chunkSize;
+
+	bool decodeChunk(uint32 index);
+	bool loadChunkAt(uint32 pos);
+};
+
+InstallShieldDeflateStream::InstallShieldDeflateStream(SeekableReadStream *compressed, uint32 uncompressedSize) :
+		_compressed(compressed), _size(uncompressedSize), _pos(0), _err(false), _eos(false),
+		_chunkIndex(0), _chunkPos(0), _chunkSize(0) {
+	Checkpoint start = { 0, 0 };
+	_checkpoints.push_back(start);
+
+	// InstallShield compresses in blocks of 32K or 64K
+	_chunk.resize(MIN<uint32>(uncompressedSize, 0x10000));
+}
+
+bool InstallShieldDeflateStream::seek(int64 offset, int whence) {
+	int64 newPos;
+	switch (whence) {
+	case SEEK_SET:
+		newPos = offset;
+		break;
+	case SEEK_CUR:
+		newPos = _pos + offset;
+		break;
+	case SEEK_END:
+		newPos = _size + offset;
+		break;
+	default:
+		return false;
+	}
+
+	if (newPos < 0 || newPos > _size)
+		return false;
+
+	_pos = newPos;
+	_eos = false;
+	return true;
+}
+
+uint32 InstallShieldDeflateStream::read(void *dataPtr, uint32 dataSize) {
+	byte *dst = (byte *)dataPtr;
+	uint32 total = 0;
+
+	while (total < dataSize) {
+		if (_pos >= _size) {
+			_eos = true;
+			break;
+		}
+
+		if (_pos < _chunkPos || _pos >= _chunkPos + _chunkSize) {
+			if (!loadChunkAt(_pos)) {
+				_err = true;
+				break;
+			}
+		}
+
+		uint32 count = MIN(dataSize - total, _chunkPos + _chunkSize - _pos);
+		memcpy(dst + total, _chunk.data() + (_pos - _chunkPos), count);
+		total += count;
+		_pos += count;
+	}
+
+	return total;
+}
+
+bool InstallShieldDeflateStream::loadChunkAt(uint32 pos) {
+	// Start from the last known chunk beginning at or before the position
+	uint32 low = 0;
+	uint32 high = _checkpoints.size();
+	while (high - low > 1) {
+		uint32 mid = low + (high - low) / 2;
+		if (_checkpoints[mid].pos <= pos)
+			low = mid;
+		else
+			high = mid;
+	}
+
+	if (!decodeChunk(low))
+		return false;
+
+	while (pos >= _chunkPos + _chunkSize) {
+		if (!decodeChunk(_chunkIndex + 1))
+			return false;
+	}
+
+	return true;
+}
+
+bool InstallShieldDeflateStream::decodeChunk(uint32 index) {
+	// A chunk past the known ones can only be the next one, whose start
+	// is recorded when the previous one is decoded
+	if (index >= _checkpoints.size())
+		return false;
+
+	const Checkpoint checkpoint = _checkpoints[index];
+	if (checkpoint.pos >= _size)
+		return false;
+
+	if (!_compressed->seek(checkpoint.compressedPos))
+		return false;
+
+	uint16 compressedSize = _compressed->readUint16LE();
+	if (_compressed->eos() || _compressed->err())
+		return false;
+
+	_compressedChunk.resize(compressedSize);
+	if (_compressed->read(_compressedChunk.data(), compressedSize) != compressedSize)
+		return false;
+
+	uint32 remaining = _size - checkpoint.pos;
+	uint chunkSize;
+	for (;;) {
+		chunkSize = MIN<uint32>(remaining, _chunk.size());
+		if (!inflateZlibHeaderless(_chunk.data(), &chunkSize, _compressedChunk.data(), compressedSize))
+			return false;
+
+		// Grow the buffer in case this chunk did not fit
+		if (chunkSize < _chunk.size() || chunkSize == remaining)
+			break;
+
+		_chunk.resize(_chunk.size() * 2);
+	}
+
+	_chunkIndex = index;
+	_chunkPos = checkpoint.pos;
+	_chunkSize = chunkSize;
+
+	if (index + 1 == _checkpoints.size()) {
+		Checkpoint next = { checkpoint.compressedPos + 2 + compressedSize, checkpoint.pos + chunkSize };
+		_checkpoints.push_back(next);
+	}
+
+	return chunkSize != 0 || decodeChunk(index + 1);
+}
+
 class InstallShieldCabinet : public Archive {
 public:
 	InstallShieldCabinet();
@@ -129,10 +400,14 @@ private:
 	Common::Array<VolumeHeader> _volumeHeaders;
 	Common::Archive *_archive;
 
+	// Compressed members up to this size are inflated as a whole
+	static const uint32 kMaxBufferedSize = 256 * 1024;
+
 	static bool readVolumeHeader(SeekableReadStream *volumeStream, VolumeHeader &inVolumeHeader);
 
 	Path getHeaderName() const;
 	Path getVolumeName(uint volume) const;
+	SeekableReadStream *openVolume(uint volume) const;
 };
 
 InstallShieldCabinet::InstallShieldCabinet() : _version(0), _archive(nullptr) {
@@ -347,6 +622,19 @@ const ArchiveMemberPtr InstallShieldCabinet::getMember(const Path &path) const {
 	return ArchiveMemberPtr(new GenericArchiveMember(path, *this));
 }
 
+SeekableReadStream *InstallShieldCabinet::openVolume(uint volume) const {
+	if (_archive)
+		return _archive->createReadStreamForMember(getVolumeName(volume));
+
+	Common::File *file = new Common::File();
+	if (!file->open(Common::FSNode(getVolumeName(volume)))) {
+		delete file;
+		return nullptr;
+	}
+
+	return file;
+}
+
 SeekableReadStream *InstallShieldCabinet::createReadStreamForMember(const Path &path) const {
 	if (!_map.contains(path))
 		return nullptr;
@@ -358,81 +646,79 @@ SeekableReadStream *InstallShieldCabinet::createReadStreamForMember(const Path &
 		return nullptr;
 	}
 
-	ScopedPtr<SeekableReadStream> stream;
-	if (_archive) {
-		stream.reset(_archive->createReadStreamForMember(getVolumeName((entry.volume))));
-	} else {
-		stream.reset(new Common::File());
-		if (!((Common::File *)stream.get())->open(Common::FSNode(getVolumeName((entry.volume))))) {
-			stream.reset(nullptr);
-		}
-	}
-
+	ScopedPtr<SeekableReadStream> stream(openVolume(entry.volume));
 	if (!stream) {
 		warning("Failed to open volume for file '%s'", path.toString().c_str());
 		return nullptr;
 	}
 
-	byte *src = nullptr;
 	if (entry.flags & kSplit) {
-		// File is split across volumes
-		src = (byte *)malloc(entry.compressedSize);
-		uint bytesRead = 0;
+		// File is split across volumes: the first part is at the end of its
+		// volume, the next ones at the start of the following volumes
+		InstallShieldSplitStream *parts = new InstallShieldSplitStream();
+		uint32 partSize = MIN(_volumeHeaders[entry.volume - 1].lastFileSizeCompressed, entry.compressedSize);
+		parts->addPart(new SeekableSubReadStream(stream.release(), entry.offset, entry.offset + partSize, DisposeAfterUse::YES));
+		stream.reset(parts);
+
+		uint32 bytesRead = partSize;
 		uint volume = entry.volume;
 
-		// Read the first part of the split file
-		stream->seek(entry.offset);
-		stream->read(src, _volumeHeaders[volume - 1].lastFileSizeCompressed);
-		bytesRead += _volumeHeaders[volume - 1].lastFileSizeCompressed;
-
-		// Then, iterate through the next volumes until we've read all the data for the file
 		while (bytesRead < entry.compressedSize) {
-			if (_archive) {
-				stream.reset(_archive->createReadStreamForMember(getVolumeName((++volume))));
-			} else {
-				if (!((Common::File *)stream.get())->open(Common::FSNode(getVolumeName((++volume))))) {
-					stream.reset(nullptr);
-				}
+			if (++volume > _volumeHeaders.size() || _volumeHeaders[volume - 1].firstFileSizeCompressed == 0) {
+				warning("Failed to read split file %s", path.toString().c_str());
+				return nullptr;
 			}
-			
-			if (!stream.get()) {
+
+			SeekableReadStream *volumeStream = openVolume(volume);
+			if (!volumeStream) {
 				warning("Failed to read split file %s", path.toString().c_str());
-				free(src);
 				return nullptr;
 			}
-			stream->seek(_volumeHeaders[volume - 1].firstFileOffset);
-			stream->read(src + bytesRead, _volumeHeaders[volume - 1].firstFileSizeCompressed);
-			bytesRead += _volumeHeaders[volume - 1].firstFileSizeCompressed;
+
+			const VolumeHeader &volumeHeader = _volumeHeaders[volume - 1];
+			partSize = MIN(volumeHeader.firstFileSizeCompressed, entry.compressedSize - bytesRead);
+			parts->addPart(new SeekableSubReadStream(volumeStream, volumeHeader.firstFileOffset, volumeHeader.firstFileOffset + partSize, DisposeAfterUse::YES));
+			bytesRead += partSize;
 		}
+	} else if (!(entry.flags & kCompressed)) {
+		// File not split, return a substream
+		return new SeekableSubReadStream(stream.release(), entry.offset, entry.offset + entry.uncompressedSize, DisposeAfterUse::YES);
+	} else {
+		stream.reset(new SeekableSubReadStream(stream.release(), entry.offset, entry.offset + entry.compressedSize, DisposeAfterUse::YES));
 	}
 
-	// Uncompressed file
+	// Uncompressed split file, return the assembled parts
 	if (!(entry.flags & kCompressed)) {
-		if (src == nullptr) {
-			// File not split, return a substream
-			return new SeekableSubReadStream(stream.release(), entry.offset, entry.offset + entry.uncompressedSize, DisposeAfterUse::YES);
-		} else {
-			// File split, return the assembled data
-			return new MemoryReadStream(src, entry.uncompressedSize, DisposeAfterUse::YES);
-		}		
+		uint32 size = MIN(entry.uncompressedSize, (uint32)stream->size());
+		return new SeekableSubReadStream(stream.release(), 0, size, DisposeAfterUse::YES);
 	}
 
-	byte *dst = (byte *)malloc(entry.uncompressedSize);
-
-	if (!src) {
-		src = (byte *)malloc(entry.compressedSize);
-		stream->seek(entry.offset);
-		stream->read(src, entry.compressedSize);
+	// Entries with size 0 are valid, and do not need to be inflated
+	if (entry.compressedSize == 0 || entry.uncompressedSize == 0)
+		return new MemoryReadStream(nullptr, 0);
+
+	// Large members made of deflated chunks are decompressed on demand, so
+	// that movies and sound banks are not held in memory as a whole. The
+	// last bytes tell a single deflate stream ending with a sync flush.
+	bool syncFlush = false;
+	if (entry.compressedSize >= 4) {
+		stream->seek(entry.compressedSize - 4);
+		syncFlush = stream->readUint32BE() == 0xFFFF;
 	}
 
-	// Entries with size 0 are valid, and do not need to be inflated
-	if (entry.compressedSize != 0) {
-		if (!inflateZlibInstallShield(dst, entry.uncompressedSize, src, entry.compressedSize)) {
-			warning("failed to inflate CAB file '%s'", path.toString().c_str());
-			free(dst);
-			free(src);
-			return nullptr;
-		}
+	if (entry.uncompressedSize > kMaxBufferedSize && !syncFlush)
+		return new InstallShieldDeflateStream(stream.release(), entry.uncompressedSize);
+
+	byte *src = (byte *)malloc(entry.compressedSize);
+	stream->seek(0);
+	stream->read(src, entry.compressedSize);
+
+	byte *dst = (byte *)malloc(entry.uncompressedSize);
+	if (!inflateZlibInstallShield(dst, entry.uncompressedSize, src, entry.compressedSize)) {
+		warning("failed to inflate CAB file '%s'", path.toString().c_str());
+		free(dst);
+		free(src);
+		return nullptr;
 	}
 
 	free(src);
@@ -101,7 +101,8 @@ private:
 	Common::SharedArchiveContents readContentsForPathFork(const Common::Path &translatedPath, bool isResFork) const;
 };
 
-StuffItArchive::StuffItArchive() : Common::MemcachingCaseInsensitiveArchive(), _flattenTree(false) {
+// Members are expensive to decompress, so keep more of them around than the default
+StuffItArchive::StuffItArchive() : Common::MemcachingCaseInsensitiveArchive(16 * 1024, 512 * 1024), _flattenTree(false) {
 	_stream = nullptr;
 }
 
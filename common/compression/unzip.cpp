@@ -95,6 +95,9 @@ typedef Byte Bytef;
 #include "common/compression/deflate.h"
 #include "common/compression/unzip.h"
 #include "common/memstream.h"
+#include "common/mutex.h"
+#include "common/ptr.h"
+#include "common/substream.h"
 
 #include "common/hashmap.h"
 #include "common/hash-str.h"
@@ -237,6 +240,17 @@ Common::SharedArchiveContents unzOpenCurrentFile(unzFile file
   If there is no error, the return value is UNZ_OK.
 */
 
+Common::SeekableReadStream *unzOpenCurrentFileStream(unzFile file, uint32 minDeflatedSize);
+/*
+  Open the current file in the zipfile as a stream reading straight from the
+  zipfile, without buffering it. Stored files are returned as a window onto
+  the zipfile, deflated files are inflated on the fly.
+  Deflated files smaller than minDeflatedSize are not streamed, as they are
+  cheaper to inflate at once and cache.
+  Return nullptr if the file is not streamed or on error; the CRC is not
+  checked for streamed files.
+*/
+
 int unzCloseCurrentFile(unzFile file);
 /*
   Close the file in zip opened with unzOpenCurrentFile
@@ -321,10 +335,20 @@ typedef struct {
 typedef Common::HashMap<Common::Path, cached_file_in_zip, Common::Path::IgnoreCase_Hash,
 	Common::Path::IgnoreCase_EqualTo> ZipHash;
 
+/* zipfile stream shared between the archive and the members streamed out of it */
+struct ZipSharedStream {
+	ZipSharedStream(Common::SeekableReadStream *stream) : _stream(stream) {}
+	~ZipSharedStream() { delete _stream; }
+
+	Common::SeekableReadStream *_stream;
+	Common::Mutex _mutex;
+};
+
 /* unz_s contain internal information about the zipfile
 */
 typedef struct {
 	Common::SeekableReadStream *_stream;				/* io structore of the zipfile */
+	Common::SharedPtr<ZipSharedStream> _shared;		/* owner of _stream */
 	unz_global_info gi;				/* public global information */
 	uLong byte_before_the_zipfile;	/* byte before the zipfile, (>0 for sfx)*/
 	uLong num_file;					/* number of the current file in the zipfile*/
@@ -458,6 +482,7 @@ unzFile unzOpen(Common::SeekableReadStream *stream, bool flattenTree) {
 
 	int err = UNZ_OK;
 
+	us->_shared = Common::SharedPtr<ZipSharedStream>(new ZipSharedStream(stream));
 	us->_stream = stream;
 
 	central_pos = unzlocal_SearchCentralDir(*us->_stream);
@@ -489,7 +514,6 @@ unzFile unzOpen(Common::SeekableReadStream *stream, bool flattenTree) {
 		err = UNZ_ERRNO;
 
 	if (err != UNZ_OK) {
-		delete us->_stream;
 		delete us;
 		return nullptr;
 	}
@@ -516,7 +540,6 @@ unzFile unzOpen(Common::SeekableReadStream *stream, bool flattenTree) {
 		err = UNZ_BADZIPFILE;
 
 	if (err != UNZ_OK) {
-		delete us->_stream;
 		delete us;
 		return nullptr;
 	}
@@ -606,7 +629,6 @@ int unzClose(unzFile file) {
 		return UNZ_PARAMERROR;
 	s = (unz_s *)file;
 
-	delete s->_stream;
 	delete s;
 	return UNZ_OK;
 }
@@ -1024,11 +1046,67 @@ Common::SharedArchiveContents unzOpenCurrentFile (unzFile file
 	return Common::SharedArchiveContents(uncompressedBuffer, s->cur_file_info.uncompressed_size);
 }
 
+namespace {
+
+/*
+  Window onto a zipfile which keeps the zipfile open for as long as it lives,
+  and which can be read from another thread than the archive it came from.
+*/
+class ZipMemberReadStream : public Common::SafeMutexedSeekableSubReadStream {
+public:
+	ZipMemberReadStream(const Common::SharedPtr<ZipSharedStream> &shared, uint32 begin, uint32 end) :
+		Common::SafeMutexedSeekableSubReadStream(shared->_stream, begin, end, DisposeAfterUse::NO, shared->_mutex),
+		_shared(shared) {}
+
+private:
+	Common::SharedPtr<ZipSharedStream> _shared;
+};
+
+} // End of anonymous namespace
+
+Common::SeekableReadStream *unzOpenCurrentFileStream(unzFile file, uint32 minDeflatedSize) {
+	uInt iSizeVar;
+	unz_s *s;
+	uLong offset_local_extrafield;  /* offset of the local extra field */
+	uInt  size_local_extrafield;    /* size of the local extra field */
+
+	if (file == nullptr)
+		return nullptr;
+	s = (unz_s *)file;
+	if (!s->current_file_ok)
+		return nullptr;
+
+	if (s->cur_file_info.compression_method == Z_DEFLATED && s->cur_file_info.uncompressed_size < minDeflatedSize)
+		return nullptr;
+
+	if (s->cur_file_info.compression_method != 0 && s->cur_file_info.compression_method != Z_DEFLATED)
+		return nullptr;
+
+	{
+		Common::StackLock lock(s->_shared->_mutex);
+		if (unzlocal_CheckCurrentFileCoherencyHeader(s, &iSizeVar,
+					&offset_local_extrafield, &size_local_extrafield) != UNZ_OK)
+			return nullptr;
+	}
+
+	uint32 begin = s->cur_file_info_internal.offset_curfile + SIZEZIPLOCALHEADER + iSizeVar;
+	Common::SeekableReadStream *stream = new ZipMemberReadStream(s->_shared, begin, begin + s->cur_file_info.compressed_size);
+
+	if (s->cur_file_info.compression_method == 0)
+		return stream;
+
+	return Common::wrapDeflateReadStream(stream, DisposeAfterUse::YES, s->cur_file_info.uncompressed_size);
+}
+
 
 namespace Common {
 
 
 class ZipArchive : public MemcachingCaseInsensitiveArchive {
+	// Deflated members at least this big are inflated on the fly instead of
+	// being buffered as a whole
+	static const uint32 kMinStreamedDeflatedSize = 256 * 1024;
+
 	unzFile _zipFile;
 #ifndef USE_ZLIB
 	Common::CRC32 _crc;
@@ -1114,6 +1192,13 @@ const ArchiveMemberPtr ZipArchive::getMember(const Path &path) const {
 Common::SharedArchiveContents ZipArchive::readContentsForPath(const Common::Path &path) const {
 	if (unzLocateFile(_zipFile, path, 2) != UNZ_OK)
 		return Common::SharedArchiveContents();
+
+	SeekableReadStream *stream = unzOpenCurrentFileStream(_zipFile, kMinStreamedDeflatedSize);
+	if (stream)
+		return Common::SharedArchiveContents::bypass(stream);
+
+	// Members streamed out of the archive may be read from another thread
+	Common::StackLock lock(((unz_s *)_zipFile)->_shared->_mutex);
 #ifndef USE_ZLIB
 	return unzOpenCurrentFile(_zipFile, _crc);
 #else
@@ -50,6 +50,8 @@ char const *const ConfigManager::kCloudDomain = "cloud";
 #pragma mark -
 
 
+uint32 ConfigManager::_changeGeneration = 1;
+
 ConfigManager::ConfigManager() : _activeDomain(nullptr) {
 }
 
@@ -75,6 +77,7 @@ void ConfigManager::copyFrom(ConfigManager &source) {
 	_activeDomainName = source._activeDomainName;
 	_activeDomain = &_gameDomains[_activeDomainName];
 	_filename = source._filename;
+	notifyChange();
 }
 
 
@@ -138,6 +141,7 @@ bool ConfigManager::loadFallbackConfigFile(const Path &filename) {
 void ConfigManager::addDomain(const String &domainName, const ConfigManager::Domain &domain) {
 	if (domainName.empty())
 		return;
+	notifyChange();
 	if (domainName == kApplicationDomain) {
 		_appDomain = domain;
 	} else if (domainName == kKeymapperDomain) {
@@ -716,6 +720,7 @@ void ConfigManager::setActiveDomain(const String &domName) {
 		_activeDomain = &_gameDomains[domName];
 	}
 	_activeDomainName = domName;
+	notifyChange();
 }
 
 void ConfigManager::addGameDomain(const String &domName) {
@@ -747,12 +752,14 @@ void ConfigManager::removeGameDomain(const String &domName) {
 		_activeDomain = nullptr;
 	}
 	_gameDomains.erase(domName);
+	notifyChange();
 }
 
 void ConfigManager::removeMiscDomain(const String &domName) {
 	assert(!domName.empty());
 	assert(isValidDomainName(domName));
 	_miscDomains.erase(domName);
+	notifyChange();
 }
 
 
@@ -787,6 +794,7 @@ void ConfigManager::renameDomain(const String &oldName, const String &newName, D
 		newDom.setVal(dom._key, dom._value);
 
 	map.erase(oldName);
+	notifyChange();
 }
 
 bool ConfigManager::hasGameDomain(const String &domName) const {
@@ -805,6 +813,20 @@ bool ConfigManager::isKeyTemporary(const String &key) const {
 
 #pragma mark -
 
+template<>
+void ConfigManager::Binding<int>::refresh() const {
+	_value = ConfMan.getInt(_key);
+	_generation = _changeGeneration;
+}
+
+template<>
+void ConfigManager::Binding<bool>::refresh() const {
+	_value = ConfMan.getBool(_key);
+	_generation = _changeGeneration;
+}
+
+#pragma mark -
+
 void ConfigManager::Domain::setDomainComment(const String &comment) {
 	_domainComment = comment;
 }
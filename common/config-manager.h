@@ -79,10 +79,10 @@ public:
 		 */
 		const String &operator[](const String &key) const { return _entries[key]; }
 
-		void           setVal(const String &key, const String &value) { _entries.setVal(key, value); } /*!< Assign a @p value to a @p key. */
+		void           setVal(const String &key, const String &value) { notifyChange(); _entries.setVal(key, value); } /*!< Assign a @p value to a @p key. */
 
-		String &getOrCreateVal(const String &key) { return _entries.getOrCreateVal(key); }
-		String        &getVal(const String &key) { return _entries.getVal(key); } /*!< Retrieve the value of a @p key. */
+		String &getOrCreateVal(const String &key) { notifyChange(); return _entries.getOrCreateVal(key); }
+		String        &getVal(const String &key) { notifyChange(); return _entries.getVal(key); } /*!< Retrieve the value of a @p key. */
 		const String  &getVal(const String &key) const { return _entries.getVal(key); } /*!< @overload */
 		 /**
 		  * Retrieve the value of @p key if it exists and leave the referenced variable unchanged if the key does not exist.
@@ -92,9 +92,9 @@ public:
 		const String &getValOrDefault(const String &key) const { return _entries.getValOrDefault(key); }
 		bool tryGetVal(const String &key, String &out) const { return _entries.tryGetVal(key, out); }
 
-		void           clear() { _entries.clear(); } /*!< Clear all configuration entries in the domain. */
+		void           clear() { notifyChange(); _entries.clear(); } /*!< Clear all configuration entries in the domain. */
 
-		void           erase(const String &key) { _entries.erase(key); } /*!< Remove a key from the domain. */
+		void           erase(const String &key) { notifyChange(); _entries.erase(key); } /*!< Remove a key from the domain. */
 
 		void           setDomainComment(const String &comment); /*!< Add a @p comment for this configuration domain. */
 		const String  &getDomainComment() const; /*!< Retrieve the comment of this configuration domain. */
@@ -200,6 +200,47 @@ public:
 	void                     registerDefault(const String &key, bool value); /*!< @overload */
 	void                     registerDefault(const String &key, const Path &value); /*!< @overload */
 
+	/**
+	 * A handle to a setting that caches its parsed value.
+	 *
+	 * The value is looked up like get() does and only parsed again after
+	 * any configuration domain changed, which makes it cheap enough to read
+	 * every frame. Obtain one with bindInt() or bindBool().
+	 */
+	template<typename T>
+	class Binding {
+	public:
+		Binding() : _generation(0), _value() {}
+
+		/** Return the current value of the setting. */
+		const T &get() const {
+			if (_generation != _changeGeneration)
+				refresh();
+			return _value;
+		}
+
+		operator T() const { return get(); }
+
+		const String &getKey() const { return _key; } /*!< Return the key of the setting. */
+
+	private:
+		friend class ConfigManager;
+
+		explicit Binding(const String &key) : _key(key), _generation(0), _value() {}
+
+		void refresh() const;
+
+		String _key;
+		mutable uint32 _generation;
+		mutable T _value;
+	};
+
+	typedef Binding<int> IntBinding;
+	typedef Binding<bool> BoolBinding;
+
+	IntBinding               bindInt(const String &key) const { return IntBinding(key); } /*!< Bind to an integer setting. */
+	BoolBinding              bindBool(const String &key) const { return BoolBinding(key); } /*!< Bind to a Boolean setting. */
+
 	void                     flushToDisk(); /*!< Flush configuration to disk. */
 
 	void                     setActiveDomain(const String &domName); /*!< Set the given domain as active. */
@@ -233,6 +274,11 @@ private:
 	friend class Singleton<SingletonBaseType>;
 	ConfigManager();
 
+	/** Invalidate the values cached by all bindings. */
+	static void     notifyChange() { _changeGeneration++; }
+
+	static uint32   _changeGeneration;
+
 	bool			loadFallbackConfigFile(const Path &filename);
 	bool			loadFromStream(SeekableReadStream &stream);
 	void			addDomain(const String &domainName, const Domain &domain);
@@ -261,6 +307,11 @@ private:
 	Path			_filename;
 };
 
+template<>
+void ConfigManager::Binding<int>::refresh() const;
+template<>
+void ConfigManager::Binding<bool>::refresh() const;
+
 /** @} */
 
 } // End of namespace Common
@@ -70,6 +70,54 @@ static void displayCoroStats() {
 } // End of anonymous namespace
 #endif
 
+namespace {
+/** Contexts up to kCoroPoolMaxSize bytes are pooled in steps of kCoroPoolStep bytes */
+enum {
+	kCoroPoolStep = 16,
+	kCoroPoolMaxSize = 512
+};
+
+/** Freed contexts of each size, linked through their first bytes */
+static void *s_coroPool[kCoroPoolMaxSize / kCoroPoolStep];
+} // End of anonymous namespace
+
+void *CoroBaseContext::operator new(size_t size) {
+	if (size > kCoroPoolMaxSize)
+		return ::operator new(size);
+
+	const size_t bucket = (size - 1) / kCoroPoolStep;
+	void *ptr = s_coroPool[bucket];
+	if (!ptr)
+		return ::operator new((bucket + 1) * kCoroPoolStep);
+
+	s_coroPool[bucket] = *(void **)ptr;
+	return ptr;
+}
+
+void CoroBaseContext::operator delete(void *ptr, size_t size) {
+	if (!ptr)
+		return;
+
+	if (size > kCoroPoolMaxSize) {
+		::operator delete(ptr);
+		return;
+	}
+
+	const size_t bucket = (size - 1) / kCoroPoolStep;
+	*(void **)ptr = s_coroPool[bucket];
+	s_coroPool[bucket] = ptr;
+}
+
+void CoroBaseContext::freePool() {
+	for (int i = 0; i < ARRAYSIZE(s_coroPool); i++) {
+		while (s_coroPool[i]) {
+			void *next = *(void **)s_coroPool[i];
+			::operator delete(s_coroPool[i]);
+			s_coroPool[i] = next;
+		}
+	}
+}
+
 CoroBaseContext::CoroBaseContext(const char *func)
 	: _line(0), _sleep(0), _subctx(nullptr) {
 #ifdef COROUTINE_DEBUG
@@ -131,6 +179,8 @@ CoroutineScheduler::~CoroutineScheduler() {
 	// Clear the event list
 	for (auto *event : _events)
 		delete event;
+
+	CoroBaseContext::freePool();
 }
 
 void CoroutineScheduler::reset() {
@@ -67,6 +67,18 @@ struct CoroBaseContext {
 	 * Destructor for coroutine context.
 	 */
 	virtual ~CoroBaseContext();
+
+	/**
+	 * Contexts are created and deleted on most coroutine calls, so freed
+	 * ones are kept in per-size pools and reused.
+	 */
+	static void *operator new(size_t size);
+	static void operator delete(void *ptr, size_t size);
+
+	/**
+	 * Free the contexts kept in the pools.
+	 */
+	static void freePool();
 };
 
 typedef CoroBaseContext *CoroContext;
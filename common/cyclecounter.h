@@ -0,0 +1,72 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef COMMON_CYCLECOUNTER_H
+#define COMMON_CYCLECOUNTER_H
+
+#include "common/scummsys.h"
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#elif !((defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__) || defined(__aarch64__)))
+#include "common/system.h"
+#endif
+
+namespace Common {
+
+/**
+ * @defgroup common_cyclecounter Cycle counter
+ * @ingroup common
+ *
+ * @brief Cheap timing of short pieces of code.
+ * @{
+ */
+
+/**
+ * Read a fast, monotonic counter to measure how long short pieces of code
+ * take, e.g. in profiling statistics which are always collected.
+ *
+ * On x86 this is the time stamp counter of the CPU and on ARM64 the virtual
+ * timer, which take a few cycles to read. Elsewhere it falls back to
+ * OSystem::getMillis().
+ *
+ * The frequency of the counter depends on the machine. To convert it to
+ * time, compare the counts with OSystem::getMillis() over a longer period.
+ */
+inline uint64 getCycleCount() {
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+	return __rdtsc();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+	return __builtin_ia32_rdtsc();
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+	uint64 value;
+	__asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(value));
+	return value;
+#else
+	return g_system->getMillis(true);
+#endif
+}
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
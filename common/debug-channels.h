@@ -24,6 +24,7 @@
 
 #include "common/scummsys.h"
 
+#include "common/flathashmap.h"
 #include "common/hashmap.h"
 #include "common/hash-str.h"
 #include "common/list.h"
@@ -166,7 +167,7 @@ public:
 
 private:
 	typedef HashMap<String, DebugChannel, IgnoreCase_Hash, IgnoreCase_EqualTo> DebugChannelMap;
-	typedef HashMap<uint32, bool> EnabledChannelsMap;
+	typedef FlatHashMap<uint32, bool> EnabledChannelsMap;
 
 	DebugChannelMap _debugChannels;
 	EnabledChannelsMap _debugChannelsEnabled;
@@ -180,6 +181,9 @@ private:
 	 * Internal method for adding an array of debug channels.
 	 */
 	void addDebugChannels(const DebugChannelDef *channels);
+
+	/** Rebuild gDebugChannelFilter from the enabled channels. */
+	void updateChannelFilter();
 };
 
 /** Shortcut for accessing the Debug Manager. */
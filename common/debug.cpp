@@ -24,12 +24,15 @@
 #include "common/system.h"
 #include "common/textconsole.h"
 #include "common/algorithm.h"
+#include "common/util.h"
 
+#include <atomic>
 #include <stdarg.h>	// For va_list etc.
 
 // TODO: Move gDebugLevel into namespace Common.
 int gDebugLevel = -1;
 bool gDebugChannelsOnly = false;
+uint64 gDebugChannelFilter = 0;
 
 const DebugChannelDef gDebugChannels[] = {
 	{ kDebugLevelEventRec,   "eventrec",  "Event recorder debug level" },
@@ -100,6 +103,8 @@ void DebugManager::removeAllDebugChannels() {
 	for (auto &debugChannel : _debugChannels)
 		if (oldMap.contains(debugChannel._value.channel))
 			_debugChannelsEnabled[debugChannel._value.channel] = oldMap[debugChannel._value.channel];
+
+	updateChannelFilter();
 }
 
 bool DebugManager::enableDebugChannel(const String &name) {
@@ -107,6 +112,7 @@ bool DebugManager::enableDebugChannel(const String &name) {
 
 	if (i != _debugChannels.end()) {
 		_debugChannelsEnabled[i->_value.channel] = true;
+		updateChannelFilter();
 
 		return true;
 	} else {
@@ -116,6 +122,7 @@ bool DebugManager::enableDebugChannel(const String &name) {
 
 bool DebugManager::enableDebugChannel(uint32 channel) {
 	_debugChannelsEnabled[channel] = true;
+	updateChannelFilter();
 	return true;
 }
 
@@ -124,6 +131,7 @@ bool DebugManager::disableDebugChannel(const String &name) {
 
 	if (i != _debugChannels.end()) {
 		_debugChannelsEnabled[i->_value.channel] = false;
+		updateChannelFilter();
 
 		return true;
 	} else {
@@ -133,6 +141,7 @@ bool DebugManager::disableDebugChannel(const String &name) {
 
 bool DebugManager::disableDebugChannel(uint32 channel) {
 	_debugChannelsEnabled[channel] = false;
+	updateChannelFilter();
 	return true;
 }
 
@@ -159,8 +168,19 @@ bool DebugManager::isDebugChannelEnabled(uint32 channel, bool enforce) {
 	// Debug level 11 turns on all special debug level messages
 	if (gDebugLevel == 11 && enforce == false)
 		return true;
+	else if (!((gDebugChannelFilter >> (channel & 63)) & 1))
+		return false;
 	else
-		return (_debugChannelsEnabled.contains(channel) && _debugChannelsEnabled[channel] == true);
+		return _debugChannelsEnabled.getValOrDefault(channel, false);
+}
+
+void DebugManager::updateChannelFilter() {
+	uint64 filter = 0;
+	for (const auto &enabled : _debugChannelsEnabled) {
+		if (enabled._value)
+			filter |= (uint64)1 << (enabled._key & 63);
+	}
+	gDebugChannelFilter = filter;
 }
 
 void DebugManager::addDebugChannels(const DebugChannelDef *channels) {
@@ -191,22 +211,357 @@ bool debugChannelSet(int level, uint32 debugChannel) {
 
 #ifndef DISABLE_TEXT_CONSOLE
 
-static void debugHelper(const char *s, va_list va, int level, uint32 debugChannel, bool caret = true) {
-	Common::String buf = Common::String::vformat(s, va);
-
-	if (caret)
-		buf += '\n';
-
+static void outputDebugMessage(const Common::String &message, int level, uint32 debugChannel) {
 	Common::LogWatcher logWatcher = Common::getLogWatcher();
 	if (logWatcher)
-		(*logWatcher)(LogMessageType::kDebug, level, debugChannel, buf.c_str());
+		(*logWatcher)(LogMessageType::kDebug, level, debugChannel, message.c_str());
 
 	if (g_system)
-		g_system->logMessage(LogMessageType::kDebug, buf.c_str());
+		g_system->logMessage(LogMessageType::kDebug, message.c_str());
 	// TODO: Think of a good fallback in case we do not have
 	// any OSystem yet.
 }
 
+namespace {
+
+enum {
+	kDeferredDebugMessages = 4096,
+	kDeferredDebugArgs = 12,
+	kDeferredDebugStrings = 128
+};
+
+union DeferredDebugArg {
+	int64 i;
+	uint64 u;
+	double d;
+	const void *p;
+	uint16 string; ///< Offset in DeferredDebugMessage::strings
+};
+
+/** A debug message as it was passed, formatted when flushed. */
+struct DeferredDebugMessage {
+	const char *format; ///< nullptr if strings holds the formatted message
+	uint32 debugChannel;
+	int level;
+	bool caret;
+	DeferredDebugArg args[kDeferredDebugArgs];
+	char strings[kDeferredDebugStrings];
+};
+
+/** One conversion of a format string. */
+struct FormatSpec {
+	const char *start;  ///< The '%'
+	const char *end;    ///< Just after the conversion character
+	const char *length; ///< Start of the length modifier
+	char conversion;
+	bool longLength;    ///< One of the l, ll, j, z or t modifiers
+	int stars;          ///< Number of '*' for the width and precision
+};
+
+/** Parse the conversion starting at the '%' p points to, false for %% and unknown ones. */
+bool parseFormatSpec(const char *p, FormatSpec &spec) {
+	spec.start = p++;
+	spec.stars = 0;
+
+	while (*p && strchr("-+ #0", *p))
+		p++;
+	if (*p == '*') {
+		spec.stars++;
+		p++;
+	}
+	while (Common::isDigit(*p))
+		p++;
+	if (*p == '.') {
+		p++;
+		if (*p == '*') {
+			spec.stars++;
+			p++;
+		}
+		while (Common::isDigit(*p))
+			p++;
+	}
+
+	spec.length = p;
+	while (*p && strchr("hljztL", *p))
+		p++;
+	spec.longLength = p != spec.length && *spec.length != 'h' && *spec.length != 'L';
+
+	spec.conversion = *p;
+	spec.end = *p ? p + 1 : p;
+	return *p && strchr("diuoxXcsfFeEgGaAp", *p);
+}
+
+/** The size of the signed or unsigned integer argument of a conversion. */
+int formatSpecIntSize(const FormatSpec &spec) {
+	if (!spec.longLength)
+		return sizeof(int);
+	switch (*spec.length) {
+	case 'j':
+		return sizeof(intmax_t);
+	case 'z':
+		return sizeof(size_t);
+	case 't':
+		return sizeof(ptrdiff_t);
+	default:
+		return spec.length[1] == 'l' ? sizeof(long long) : sizeof(long);
+	}
+}
+
+/** Store the arguments of a message without formatting them, false if some can't be. */
+bool recordDeferredArgs(DeferredDebugMessage &message, const char *s, va_list va) {
+	uint numArgs = 0;
+	uint stringSize = 0;
+
+	for (const char *p = strchr(s, '%'); p; p = strchr(p, '%')) {
+		if (p[1] == '%') {
+			p += 2;
+			continue;
+		}
+
+		FormatSpec spec;
+		if (!parseFormatSpec(p, spec) || numArgs + spec.stars >= kDeferredDebugArgs)
+			return false;
+		p = spec.end;
+
+		for (int i = 0; i < spec.stars; i++)
+			message.args[numArgs++].i = va_arg(va, int);
+
+		DeferredDebugArg &arg = message.args[numArgs++];
+		switch (spec.conversion) {
+		case 'd':
+		case 'i':
+			if (formatSpecIntSize(spec) == sizeof(int64))
+				arg.i = va_arg(va, int64);
+			else
+				arg.i = va_arg(va, int);
+			break;
+		case 'u':
+		case 'o':
+		case 'x':
+		case 'X':
+			if (formatSpecIntSize(spec) == sizeof(uint64))
+				arg.u = va_arg(va, uint64);
+			else
+				arg.u = va_arg(va, uint);
+			break;
+		case 'c':
+			if (spec.longLength)
+				return false;
+			arg.i = va_arg(va, int);
+			break;
+		case 's': {
+			if (spec.longLength)
+				return false;
+			const char *string = va_arg(va, const char *);
+			if (!string)
+				string = "(null)";
+			// Strings are copied, truncated if the message has no more room
+			if (stringSize == kDeferredDebugStrings) {
+				arg.string = kDeferredDebugStrings - 1;
+				break;
+			}
+			uint size = MIN<uint>(strlen(string), kDeferredDebugStrings - 1 - stringSize);
+			arg.string = stringSize;
+			memcpy(message.strings + stringSize, string, size);
+			stringSize += size;
+			message.strings[stringSize++] = '\0';
+			break;
+		}
+		case 'p':
+			arg.p = va_arg(va, const void *);
+			break;
+		default:
+			if (*spec.length == 'L')
+				arg.d = (double)va_arg(va, long double);
+			else
+				arg.d = va_arg(va, double);
+			break;
+		}
+	}
+
+	return true;
+}
+
+Common::String formatDeferredMessage(const DeferredDebugMessage &message) {
+	if (!message.format)
+		return message.strings;
+
+	Common::String output;
+	uint numArgs = 0;
+
+	const char *p = message.format;
+	for (const char *next = strchr(p, '%'); next; next = strchr(p, '%')) {
+		output += Common::String(p, next);
+
+		if (next[1] == '%') {
+			output += '%';
+			p = next + 2;
+			continue;
+		}
+
+		FormatSpec spec;
+		parseFormatSpec(next, spec);
+		p = spec.end;
+
+		// Rebuild the conversion with the width and precision filled in, and
+		// integers widened to long long
+		Common::String conversion;
+		for (const char *c = spec.start; c < spec.length; c++) {
+			if (*c == '*')
+				conversion += Common::String::format("%d", (int)message.args[numArgs++].i);
+			else
+				conversion += *c;
+		}
+
+		const DeferredDebugArg &arg = message.args[numArgs++];
+		switch (spec.conversion) {
+		case 'd':
+		case 'i':
+			conversion += "ll";
+			conversion += spec.conversion;
+			output += Common::String::format(conversion.c_str(), (long long)arg.i);
+			break;
+		case 'u':
+		case 'o':
+		case 'x':
+		case 'X':
+			conversion += "ll";
+			conversion += spec.conversion;
+			output += Common::String::format(conversion.c_str(), (unsigned long long)arg.u);
+			break;
+		case 'c':
+			conversion += 'c';
+			output += Common::String::format(conversion.c_str(), (int)arg.i);
+			break;
+		case 's':
+			conversion += 's';
+			output += Common::String::format(conversion.c_str(), message.strings + arg.string);
+			break;
+		case 'p':
+			conversion += 'p';
+			output += Common::String::format(conversion.c_str(), arg.p);
+			break;
+		default:
+			conversion += spec.conversion;
+			output += Common::String::format(conversion.c_str(), arg.d);
+			break;
+		}
+	}
+
+	output += p;
+	if (message.caret)
+		output += '\n';
+	return output;
+}
+
+/** A spin lock, since debug messages come from any thread, even while a mutex is locked. */
+std::atomic_flag s_deferredDebugLock = ATOMIC_FLAG_INIT;
+DeferredDebugMessage *s_deferredDebugMessages = nullptr;
+uint32 s_deferredDebugCount = 0; ///< Messages recorded since the last flush
+
+class DeferredDebugLock {
+public:
+	DeferredDebugLock() {
+		while (s_deferredDebugLock.test_and_set(std::memory_order_acquire)) {
+		}
+	}
+	~DeferredDebugLock() {
+		s_deferredDebugLock.clear(std::memory_order_release);
+	}
+};
+
+} // End of anonymous namespace
+
+void enableDeferredDebug(bool enable) {
+	flushDeferredDebug();
+
+	DeferredDebugMessage *messages = enable ? new DeferredDebugMessage[kDeferredDebugMessages] : nullptr;
+	{
+		DeferredDebugLock lock;
+		SWAP(messages, s_deferredDebugMessages);
+		s_deferredDebugCount = 0;
+	}
+	delete[] messages;
+}
+
+void flushDeferredDebug() {
+	DeferredDebugMessage *messages;
+	uint32 count;
+	{
+		DeferredDebugLock lock;
+		if (!s_deferredDebugMessages || !s_deferredDebugCount)
+			return;
+		count = s_deferredDebugCount;
+		s_deferredDebugCount = 0;
+
+		// Take the recorded messages, so that none are recorded while
+		// printing them
+		messages = s_deferredDebugMessages;
+		s_deferredDebugMessages = nullptr;
+	}
+
+	if (count > kDeferredDebugMessages) {
+		outputDebugMessage(Common::String::format("(%u older debug messages dropped)\n", count - kDeferredDebugMessages), 0, 0);
+	}
+
+	for (uint32 i = count > kDeferredDebugMessages ? count - kDeferredDebugMessages : 0; i < count; i++) {
+		const DeferredDebugMessage &message = messages[i % kDeferredDebugMessages];
+		outputDebugMessage(formatDeferredMessage(message), message.level, message.debugChannel);
+	}
+
+	{
+		DeferredDebugLock lock;
+		if (!s_deferredDebugMessages) {
+			s_deferredDebugMessages = messages;
+			messages = nullptr;
+		}
+	}
+	delete[] messages;
+}
+
+static bool deferDebugMessage(const char *s, va_list va, int level, uint32 debugChannel, bool caret) {
+	if (!s_deferredDebugMessages)
+		return false;
+
+	DeferredDebugMessage message;
+	message.format = s;
+	message.debugChannel = debugChannel;
+	message.level = level;
+	message.caret = caret;
+
+	va_list args;
+	scumm_va_copy(args, va);
+	bool recorded = recordDeferredArgs(message, s, args);
+	va_end(args);
+
+	if (!recorded) {
+		// Unusual conversions are formatted now, truncated to fit
+		message.format = nullptr;
+		Common::String text = Common::String::vformat(s, va);
+		if (caret)
+			text += '\n';
+		Common::strlcpy(message.strings, text.c_str(), kDeferredDebugStrings);
+	}
+
+	DeferredDebugLock lock;
+	if (!s_deferredDebugMessages)
+		return false;
+	s_deferredDebugMessages[s_deferredDebugCount++ % kDeferredDebugMessages] = message;
+	return true;
+}
+
+static void debugHelper(const char *s, va_list va, int level, uint32 debugChannel, bool caret = true) {
+	if (deferDebugMessage(s, va, level, debugChannel, caret))
+		return;
+
+	Common::String buf = Common::String::vformat(s, va);
+
+	if (caret)
+		buf += '\n';
+
+	outputDebugMessage(buf, level, debugChannel);
+}
+
 void debug(const char *s, ...) {
 	va_list va;
 
@@ -252,7 +607,7 @@ void debugN(int level, const char *s, ...) {
 	va_end(va);
 }
 
-void debugC(int level, uint32 debugChannel, const char *s, ...) {
+void (debugC)(int level, uint32 debugChannel, const char *s, ...) {
 	va_list va;
 
 	// Debug level 11 turns on all special debug level messages
@@ -265,7 +620,7 @@ void debugC(int level, uint32 debugChannel, const char *s, ...) {
 	va_end(va);
 }
 
-void debugCN(int level, uint32 debugChannel, const char *s, ...) {
+void (debugCN)(int level, uint32 debugChannel, const char *s, ...) {
 	va_list va;
 
 	// Debug level 11 turns on all special debug level messages
@@ -278,7 +633,7 @@ void debugCN(int level, uint32 debugChannel, const char *s, ...) {
 	va_end(va);
 }
 
-void debugC(uint32 debugChannel, const char *s, ...) {
+void (debugC)(uint32 debugChannel, const char *s, ...) {
 	va_list va;
 
 	// Debug level 11 turns on all special debug level messages
@@ -291,7 +646,7 @@ void debugC(uint32 debugChannel, const char *s, ...) {
 	va_end(va);
 }
 
-void debugCN(uint32 debugChannel, const char *s, ...) {
+void (debugCN)(uint32 debugChannel, const char *s, ...) {
 	va_list va;
 
 	// Debug level 11 turns on all special debug level messages
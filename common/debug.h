@@ -85,7 +85,7 @@ void debugN(int level, MSVC_PRINTF const char *s, ...) GCC_PRINTF(2, 3);
  * @param debugChannel  Channel to check against.
  * @param s             Message to print.
  */
-void debugC(int level, uint32 debugChannel, MSVC_PRINTF const char *s, ...) GCC_PRINTF(3, 4);
+void (debugC)(int level, uint32 debugChannel, MSVC_PRINTF const char *s, ...) GCC_PRINTF(3, 4);
 
 /**
  * Print a debug message to the text console (stdout), but only if
@@ -100,7 +100,7 @@ void debugC(int level, uint32 debugChannel, MSVC_PRINTF const char *s, ...) GCC_
  * @param s             Message to print.
  *
  */
-void debugCN(int level, uint32 debugChannel, MSVC_PRINTF const char *s, ...) GCC_PRINTF(3, 4);
+void (debugCN)(int level, uint32 debugChannel, MSVC_PRINTF const char *s, ...) GCC_PRINTF(3, 4);
 
 /**
  * Print a debug message to the text console (stdout), but only if
@@ -111,7 +111,7 @@ void debugCN(int level, uint32 debugChannel, MSVC_PRINTF const char *s, ...) GCC
  * @param debugChannel  Channel to check against.
  * @param s             Message to print.
  */
-void debugC(uint32 debugChannel, MSVC_PRINTF const char *s, ...) GCC_PRINTF(2, 3);
+void (debugC)(uint32 debugChannel, MSVC_PRINTF const char *s, ...) GCC_PRINTF(2, 3);
 
 /**
  * Print a debug message to the text console (stdout), but only if
@@ -122,7 +122,7 @@ void debugC(uint32 debugChannel, MSVC_PRINTF const char *s, ...) GCC_PRINTF(2, 3
  * @param debugChannel  Channel to check against.
  * @param s             Message to print.
  */
-void debugCN(uint32 debugChannel, MSVC_PRINTF const char *s, ...) GCC_PRINTF(2, 3);
+void (debugCN)(uint32 debugChannel, MSVC_PRINTF const char *s, ...) GCC_PRINTF(2, 3);
 
 #endif
 
@@ -157,6 +157,60 @@ extern int gDebugLevel;
  */
 extern bool gDebugChannelsOnly;
 
+#ifndef DISABLE_TEXT_CONSOLE
+
+/**
+ * Filter of the enabled debug channels, in which bit (channel % 64) is set
+ * when any channel with that remainder is enabled. A clear bit means that
+ * the channel is disabled, which debugC() tests before anything else.
+ */
+extern uint64 gDebugChannelFilter;
+
+/**
+ * Quick test whether debugC() or debugCN() with the given level and
+ * channel may print, without looking the channel up. It can be true for a
+ * disabled channel, but never false for an enabled one.
+ */
+inline bool debugCEnabled(int level, uint32 debugChannel) {
+	// Debug level 11 turns on all special debug level messages
+	return gDebugLevel == 11 || (level <= gDebugLevel && ((gDebugChannelFilter >> (debugChannel & 63)) & 1));
+}
+
+/** @overload For debugC(uint32 debugChannel, const char *s, ...). */
+inline bool debugCEnabled(uint32 debugChannel, const char *) {
+	return gDebugLevel == 11 || ((gDebugChannelFilter >> (debugChannel & 63)) & 1);
+}
+
+#define DEBUG_EXPAND(x) x
+#define DEBUG_FIRST_TWO_ARGS(a, b, ...) a, b
+
+// Check the level and the channel inline, so that the other arguments are
+// not even evaluated when the message will not be printed. The level and
+// channel may be evaluated twice.
+#define debugC(...) (debugCEnabled(DEBUG_EXPAND(DEBUG_FIRST_TWO_ARGS(__VA_ARGS__, 0, 0))) ? (debugC)(__VA_ARGS__) : (void)0)
+#define debugCN(...) (debugCEnabled(DEBUG_EXPAND(DEBUG_FIRST_TWO_ARGS(__VA_ARGS__, 0, 0))) ? (debugCN)(__VA_ARGS__) : (void)0)
+
+/**
+ * Record the debug messages in a ring buffer from now on, instead of
+ * printing them. Only the format string and the arguments are stored, and
+ * the messages are formatted when flushDeferredDebug() prints them. Once
+ * the buffer is full the oldest messages are dropped.
+ *
+ * The format strings must stay valid until the flush, so the engine flushes
+ * before its plugin is unloaded.
+ */
+void enableDeferredDebug(bool enable);
+
+/** Print the recorded debug messages and empty the buffer. */
+void flushDeferredDebug();
+
+#else
+
+inline void enableDeferredDebug(bool enable) {}
+inline void flushDeferredDebug() {}
+
+#endif
+
 /** Global constant for EventRecorder debug channel. */
 enum GlobalDebugLevels {
 	kDebugGlobalDetection = 100000,
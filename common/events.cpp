@@ -48,6 +48,10 @@ EventMapper::~EventMapper() {}
 
 EventManager::~EventManager() {}
 
+bool EventManager::waitForEventOrDeadline(uint32 deadline) {
+	return g_system->waitForEventOrDeadline(deadline);
+}
+
 EventDispatcher::EventDispatcher() {
 }
 
@@ -294,6 +294,11 @@ public:
 		_artificialEventQueue.push(ev);
 	}
 
+	/** Whether there are events in the queue. */
+	bool hasEvents() const {
+		return !_artificialEventQueue.empty();
+	}
+
 	bool pollEvent(Event &ev) {
 		if (!_artificialEventQueue.empty()) {
 			ev = _artificialEventQueue.pop();
@@ -497,6 +502,18 @@ public:
 	 */
 	virtual void pushEvent(const Event &event) = 0;
 
+	/**
+	 * Sleep until an event is available or the deadline passes, whichever
+	 * comes first, instead of polling with delays.
+	 *
+	 * @param deadline  Time to wake up at the latest, in OSystem::getMillis() time.
+	 *
+	 * @return True if woken up early because an event may be available.
+	 *
+	 * @see OSystem::waitForEventOrDeadline
+	 */
+	virtual bool waitForEventOrDeadline(uint32 deadline);
+
 	/**
 	 * Purge all unprocessed mouse events already in the event queue.
 	 */
@@ -0,0 +1,522 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+// The hash map implementation in this file uses open addressing with
+// Robin Hood hashing and backward shift deletion.
+
+#ifndef COMMON_FLATHASHMAP_H
+#define COMMON_FLATHASHMAP_H
+
+#include "common/func.h"
+#include "common/hashmap.h"
+#include "common/util.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_flathashmap Flat hash table (FlatHashMap)
+ * @ingroup common
+ *
+ * @brief API for operations on an open addressing hash table.
+ *
+ * @{
+ */
+
+/**
+ * FlatHashMap<Key,Val> maps objects of type Key to objects of type Val, like
+ * HashMap does, and takes the same hash and equality functors.
+ *
+ * Keys and values are stored inline in a single array instead of in
+ * separately allocated nodes, so a lookup usually touches one or two cache
+ * lines and no pointer has to be followed. Collisions are resolved with
+ * Robin Hood hashing, which keeps probe sequences short even at a high load
+ * factor.
+ *
+ * The price for this is that entries move around: any insertion or erasure
+ * invalidates all iterators and all references to keys and values. Use
+ * HashMap if you need stable references.
+ */
+template<class Key, class Val, class HashFunc = Hash<Key>, class EqualFunc = EqualTo<Key> >
+class FlatHashMap {
+public:
+	typedef uint size_type;
+
+	struct Node {
+		Val _value;
+		Key _key;
+		explicit Node(const Key &key) : _value(), _key(key) {}
+		Node(Node &&node) : _value(Common::move(node._value)), _key(Common::move(node._key)) {}
+		Node &operator=(Node &&node) {
+			_value = Common::move(node._value);
+			_key = Common::move(node._key);
+			return *this;
+		}
+	};
+
+private:
+	typedef FlatHashMap<Key, Val, HashFunc, EqualFunc> FHM_t;
+
+	enum {
+		FLATHASHMAP_MIN_CAPACITY = 16,
+
+		// Robin Hood hashing copes well with a high load factor
+		FLATHASHMAP_LOADFACTOR_NUMERATOR = 7,
+		FLATHASHMAP_LOADFACTOR_DENOMINATOR = 8
+	};
+
+	/** Default value, returned by the const getVal. */
+	Val _defaultVal;
+
+	Node *_storage;       ///< Uninitialized memory for _mask + 1 nodes.
+	size_type *_distance; ///< Distance of each node to its home slot plus one, 0 for empty slots.
+	size_type _mask;      ///< Capacity of the FlatHashMap minus one; capacity is a power of two.
+	size_type _size;
+
+	HashFunc _hash;
+	EqualFunc _equal;
+
+	void allocStorage(size_type capacity);
+	void freeStorage();
+	void assign(const FHM_t &map);
+	size_type lookup(const Key &key) const;
+	size_type lookupAndCreateIfMissing(const Key &key);
+	void insertNode(Node &&node, size_type idx, size_type distance);
+	void eraseAt(size_type idx);
+	void expandStorage(size_type newCapacity);
+
+	template<class NodeType>
+	class IteratorImpl {
+		friend class FlatHashMap;
+		template<class T> friend class IteratorImpl;
+
+	protected:
+		typedef const FlatHashMap hashmap_t;
+
+		size_type _idx;
+		hashmap_t *_hashmap;
+
+		IteratorImpl(size_type idx, hashmap_t *hashmap) : _idx(idx), _hashmap(hashmap) {}
+
+		NodeType *deref() const {
+			assert(_hashmap != nullptr);
+			assert(_idx <= _hashmap->_mask);
+			assert(_hashmap->_distance[_idx] != 0);
+			return &_hashmap->_storage[_idx];
+		}
+
+	public:
+		IteratorImpl() : _idx(0), _hashmap(nullptr) {}
+		template<class T>
+		IteratorImpl(const IteratorImpl<T> &c) : _idx(c._idx), _hashmap(c._hashmap) {}
+
+		NodeType &operator*() const { return *deref(); }
+		NodeType *operator->() const { return deref(); }
+
+		bool operator==(const IteratorImpl &iter) const { return _idx == iter._idx && _hashmap == iter._hashmap; }
+		bool operator!=(const IteratorImpl &iter) const { return !(*this == iter); }
+
+		IteratorImpl &operator++() {
+			assert(_hashmap);
+			do {
+				_idx++;
+			} while (_idx <= _hashmap->_mask && _hashmap->_distance[_idx] == 0);
+			if (_idx > _hashmap->_mask)
+				_idx = (size_type)-1;
+
+			return *this;
+		}
+
+		IteratorImpl operator++(int) {
+			IteratorImpl old = *this;
+			operator ++();
+			return old;
+		}
+	};
+
+public:
+	typedef IteratorImpl<Node> iterator;
+	typedef IteratorImpl<const Node> const_iterator;
+
+	FlatHashMap();
+	FlatHashMap(const FHM_t &map);
+	~FlatHashMap();
+
+	FHM_t &operator=(const FHM_t &map) {
+		if (this == &map)
+			return *this;
+
+		clear();
+		freeStorage();
+		assign(map);
+		return *this;
+	}
+
+	bool contains(const Key &key) const { return lookup(key) <= _mask; }
+
+	Val &operator[](const Key &key) { return getOrCreateVal(key); }
+	const Val &operator[](const Key &key) const { return getVal(key); }
+
+	Val &getOrCreateVal(const Key &key);
+	Val &getVal(const Key &key);
+	const Val &getVal(const Key &key) const;
+	const Val &getValOrDefault(const Key &key) const;
+	const Val &getValOrDefault(const Key &key, const Val &defaultVal) const;
+	bool tryGetVal(const Key &key, Val &out) const;
+	void setVal(const Key &key, const Val &val);
+
+	void clear(bool shrinkArray = false);
+
+	void erase(iterator entry);
+	void erase(const Key &key);
+
+	size_type size() const { return _size; }
+
+	iterator begin() {
+		for (size_type ctr = 0; ctr <= _mask; ++ctr) {
+			if (_distance[ctr])
+				return iterator(ctr, this);
+		}
+		return end();
+	}
+	iterator end() {
+		return iterator((size_type)-1, this);
+	}
+
+	const_iterator begin() const {
+		for (size_type ctr = 0; ctr <= _mask; ++ctr) {
+			if (_distance[ctr])
+				return const_iterator(ctr, this);
+		}
+		return end();
+	}
+	const_iterator end() const {
+		return const_iterator((size_type)-1, this);
+	}
+
+	iterator find(const Key &key) {
+		size_type ctr = lookup(key);
+		if (ctr <= _mask)
+			return iterator(ctr, this);
+		return end();
+	}
+
+	const_iterator find(const Key &key) const {
+		size_type ctr = lookup(key);
+		if (ctr <= _mask)
+			return const_iterator(ctr, this);
+		return end();
+	}
+
+	/** Return true if hashmap is empty. */
+	bool empty() const {
+		return (_size == 0);
+	}
+};
+
+//-------------------------------------------------------
+// FlatHashMap functions
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+FlatHashMap<Key, Val, HashFunc, EqualFunc>::FlatHashMap() : _defaultVal(), _storage(nullptr), _distance(nullptr), _size(0) {
+	allocStorage(FLATHASHMAP_MIN_CAPACITY);
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+FlatHashMap<Key, Val, HashFunc, EqualFunc>::FlatHashMap(const FHM_t &map) :
+	_defaultVal(), _storage(nullptr), _distance(nullptr), _size(0), _hash(map._hash), _equal(map._equal) {
+	assign(map);
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+FlatHashMap<Key, Val, HashFunc, EqualFunc>::~FlatHashMap() {
+	clear();
+	freeStorage();
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::allocStorage(size_type capacity) {
+	_storage = (Node *)malloc(capacity * sizeof(Node));
+	assert(_storage != nullptr);
+	_distance = (size_type *)calloc(capacity, sizeof(size_type));
+	assert(_distance != nullptr);
+	_mask = capacity - 1;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::freeStorage() {
+	free(_storage);
+	free(_distance);
+	_storage = nullptr;
+	_distance = nullptr;
+}
+
+/**
+ * Copy the contents of the given map. The previous storage must have been
+ * freed already.
+ */
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::assign(const FHM_t &map) {
+	allocStorage(map._mask + 1);
+
+	// Copying the slots as-is keeps the probe distances valid
+	for (size_type ctr = 0; ctr <= _mask; ++ctr) {
+		if (map._distance[ctr]) {
+			new (&_storage[ctr]) Node(map._storage[ctr]._key);
+			_storage[ctr]._value = map._storage[ctr]._value;
+			_distance[ctr] = map._distance[ctr];
+		}
+	}
+	_size = map._size;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::clear(bool shrinkArray) {
+	for (size_type ctr = 0; ctr <= _mask; ++ctr) {
+		if (_distance[ctr]) {
+			_storage[ctr].~Node();
+			_distance[ctr] = 0;
+		}
+	}
+	_size = 0;
+
+	if (shrinkArray && _mask >= FLATHASHMAP_MIN_CAPACITY) {
+		freeStorage();
+		allocStorage(FLATHASHMAP_MIN_CAPACITY);
+	}
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::expandStorage(size_type newCapacity) {
+	assert(newCapacity > _mask + 1);
+
+	Node *oldStorage = _storage;
+	size_type *oldDistance = _distance;
+	const size_type oldMask = _mask;
+
+	allocStorage(newCapacity);
+
+	for (size_type ctr = 0; ctr <= oldMask; ++ctr) {
+		if (oldDistance[ctr]) {
+			insertNode(Common::move(oldStorage[ctr]), _hash(oldStorage[ctr]._key) & _mask, 1);
+			oldStorage[ctr].~Node();
+		}
+	}
+
+	free(oldStorage);
+	free(oldDistance);
+}
+
+/**
+ * Put the given node into the table, starting at slot idx with the given
+ * probe distance, and displace richer nodes on the way. The node's key must
+ * not be in the table yet.
+ */
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::insertNode(Node &&node, size_type idx, size_type distance) {
+	Node carry(Common::move(node));
+
+	while (_distance[idx]) {
+		if (_distance[idx] < distance) {
+			Node displaced(Common::move(_storage[idx]));
+			_storage[idx] = Common::move(carry);
+			carry = Common::move(displaced);
+
+			size_type tmp = _distance[idx];
+			_distance[idx] = distance;
+			distance = tmp;
+		}
+		idx = (idx + 1) & _mask;
+		distance++;
+	}
+
+	new (&_storage[idx]) Node(Common::move(carry));
+	_distance[idx] = distance;
+}
+
+/**
+ * Return the slot holding the given key, or a value above _mask if the key
+ * is not in the table.
+ */
+template<class Key, class Val, class HashFunc, class EqualFunc>
+typename FlatHashMap<Key, Val, HashFunc, EqualFunc>::size_type FlatHashMap<Key, Val, HashFunc, EqualFunc>::lookup(const Key &key) const {
+	size_type idx = _hash(key) & _mask;
+	size_type distance = 1;
+
+	// A node further from its home slot than we are from ours would have
+	// been displaced by the key on insertion, so we can stop there
+	while (_distance[idx] >= distance) {
+		// Only a node with the same distance can share our home slot
+		if (_distance[idx] == distance && _equal(_storage[idx]._key, key))
+			return idx;
+		idx = (idx + 1) & _mask;
+		distance++;
+	}
+
+	return (size_type)-1;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+typename FlatHashMap<Key, Val, HashFunc, EqualFunc>::size_type FlatHashMap<Key, Val, HashFunc, EqualFunc>::lookupAndCreateIfMissing(const Key &key) {
+	size_type idx = lookup(key);
+	if (idx <= _mask)
+		return idx;
+
+	// Grow before inserting, so the new node stays where we put it
+	const size_type capacity = _mask + 1;
+	if ((_size + 1) * FLATHASHMAP_LOADFACTOR_DENOMINATOR > capacity * FLATHASHMAP_LOADFACTOR_NUMERATOR)
+		expandStorage(capacity < 500 ? capacity * 4 : capacity * 2);
+
+	idx = _hash(key) & _mask;
+	size_type distance = 1;
+	while (_distance[idx] >= distance) {
+		idx = (idx + 1) & _mask;
+		distance++;
+	}
+
+	// idx is the first slot which is either empty or holds a node closer to
+	// its home slot than the new one would be. In the latter case the new
+	// node takes over the slot and the old one moves further down.
+	if (_distance[idx]) {
+		Node displaced(Common::move(_storage[idx]));
+		const size_type displacedDistance = _distance[idx];
+
+		_storage[idx] = Node(key);
+		_distance[idx] = distance;
+		insertNode(Common::move(displaced), (idx + 1) & _mask, displacedDistance + 1);
+	} else {
+		new (&_storage[idx]) Node(key);
+		_distance[idx] = distance;
+	}
+	_size++;
+
+	return idx;
+}
+
+/**
+ * Remove the node in the given slot and shift the nodes of its probe
+ * sequence back by one.
+ */
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::eraseAt(size_type idx) {
+	size_type next = (idx + 1) & _mask;
+	while (_distance[next] > 1) {
+		_storage[idx] = Common::move(_storage[next]);
+		_distance[idx] = _distance[next] - 1;
+		idx = next;
+		next = (next + 1) & _mask;
+	}
+
+	_storage[idx].~Node();
+	_distance[idx] = 0;
+	_size--;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+Val &FlatHashMap<Key, Val, HashFunc, EqualFunc>::getOrCreateVal(const Key &key) {
+	size_type ctr = lookupAndCreateIfMissing(key);
+	return _storage[ctr]._value;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+Val &FlatHashMap<Key, Val, HashFunc, EqualFunc>::getVal(const Key &key) {
+	size_type ctr = lookup(key);
+	if (ctr <= _mask)
+		return _storage[ctr]._value;
+	else
+		// In the past getVal() and operator[] used to return the default value for this case.
+		// Clarifying the intent by using getValOrDefault() when we query a key that may not be
+		// present is a good idea, but we have a lot of legacy code that may need to be updated.
+		// So for now only returns an error in non-release builds. Once we are confident all the
+		// code has been updated to use the correct function we can remove the RELEASE_BUILD
+		// special case.
+#ifdef RELEASE_BUILD
+		return _defaultVal;
+#else
+		unknownKeyError(key);
+#endif
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+const Val &FlatHashMap<Key, Val, HashFunc, EqualFunc>::getVal(const Key &key) const {
+	size_type ctr = lookup(key);
+	if (ctr <= _mask)
+		return _storage[ctr]._value;
+	else
+		// See getVal() above
+#ifdef RELEASE_BUILD
+		return _defaultVal;
+#else
+		unknownKeyError(key);
+#endif
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+const Val &FlatHashMap<Key, Val, HashFunc, EqualFunc>::getValOrDefault(const Key &key) const {
+	return getValOrDefault(key, _defaultVal);
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+const Val &FlatHashMap<Key, Val, HashFunc, EqualFunc>::getValOrDefault(const Key &key, const Val &defaultVal) const {
+	size_type ctr = lookup(key);
+	if (ctr <= _mask)
+		return _storage[ctr]._value;
+	else
+		return defaultVal;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+bool FlatHashMap<Key, Val, HashFunc, EqualFunc>::tryGetVal(const Key &key, Val &out) const {
+	size_type ctr = lookup(key);
+	if (ctr <= _mask) {
+		out = _storage[ctr]._value;
+		return true;
+	} else {
+		return false;
+	}
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::setVal(const Key &key, const Val &val) {
+	size_type ctr = lookupAndCreateIfMissing(key);
+	_storage[ctr]._value = val;
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::erase(iterator entry) {
+	// Check whether we have a valid iterator
+	assert(entry._hashmap == this);
+	assert(entry._idx <= _mask && _distance[entry._idx]);
+
+	eraseAt(entry._idx);
+}
+
+template<class Key, class Val, class HashFunc, class EqualFunc>
+void FlatHashMap<Key, Val, HashFunc, EqualFunc>::erase(const Key &key) {
+	size_type ctr = lookup(key);
+	if (ctr <= _mask)
+		eraseAt(ctr);
+}
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
@@ -49,10 +49,6 @@
 #define wcsncasecmp wcsnicmp
 #endif
 
-// Macros to free an array/object
-#define FREE_ARRAY(x) { for (auto *i : x) { delete i; } }
-#define FREE_OBJECT(x) { for (auto &i : x) { delete i._value; } }
-
 namespace Common {
 
 /**
@@ -160,6 +156,17 @@ bool JSON::extractString(const char **data, String &str) {
 	str = "";
 
 	while (**data != 0) {
+		// Add the characters up to the next one needing a closer look at once
+		const char *run = *data;
+		while (*run != '"' && *run != '\\' && (*run >= ' ' || *run == '\t'))
+			run++;
+
+		if (run != *data) {
+			str.append(*data, run);
+			*data = run;
+			continue;
+		}
+
 		// Save the char so we can change it if need be
 		char next_char = **data;
 		uint32 next_uchar = 0;
@@ -352,11 +359,13 @@ double JSON::parseDecimal(const char **data) {
 JSONValue *JSONValue::parse(const char **data) {
 	// Is it a string?
 	if (**data == '"') {
-		String str;
-		if (!JSON::extractString(&(++(*data)), str))
+		// Extract it in place rather than copying it into the value
+		JSONValue *value = new JSONValue(String());
+		if (!JSON::extractString(&(++(*data)), *value->_stringValue)) {
+			delete value;
 			return nullptr;
-		else
-			return new JSONValue(str);
+		}
+		return value;
 	}
 
 	// Is it a boolean?
@@ -441,75 +450,82 @@ JSONValue *JSONValue::parse(const char **data) {
 
 	// An object?
 	else if (**data == '{') {
-		JSONObject object;
+		// Build the children straight into the value, copying a map of
+		// them into it at the end would copy all of their names.
+		JSONValue *result = new JSONValue(JSONObject());
+		JSONObject &object = *result->_objectValue;
 
 		(*data)++;
 
 		while (**data != 0) {
 			// Whitespace at the start?
 			if (!JSON::skipWhitespace(data)) {
-				FREE_OBJECT(object);
+				delete result;
 				return nullptr;
 			}
 
 			// Special case - empty object
 			if (object.size() == 0 && **data == '}') {
 				(*data)++;
-				return new JSONValue(object);
+				return result;
 			}
 
 			// We want a string now...
 			String name;
 			if (!JSON::extractString(&(++(*data)), name)) {
-				FREE_OBJECT(object);
+				delete result;
 				return nullptr;
 			}
 
 			// More whitespace?
 			if (!JSON::skipWhitespace(data)) {
-				FREE_OBJECT(object);
+				delete result;
 				return nullptr;
 			}
 
 			// Need a : now
 			if (*((*data)++) != ':') {
-				FREE_OBJECT(object);
+				delete result;
 				return nullptr;
 			}
 
 			// More whitespace?
 			if (!JSON::skipWhitespace(data)) {
-				FREE_OBJECT(object);
+				delete result;
 				return nullptr;
 			}
 
 			// The value is here
 			JSONValue *value = parse(data);
 			if (value == nullptr) {
-				FREE_OBJECT(object);
+				delete result;
 				return nullptr;
 			}
 
 			// Add the name:value
-			if (object.find(name) != object.end())
-				delete object[name];
-			object[name] = value;
+			JSONObject::iterator existing = object.find(name);
+			if (existing != object.end()) {
+				delete existing->_value;
+				existing->_value = value;
+			} else {
+				object[name] = value;
+			}
 
 			// More whitespace?
 			if (!JSON::skipWhitespace(data)) {
-				FREE_OBJECT(object);
+				delete result;
 				return nullptr;
 			}
 
 			// End of object?
 			if (**data == '}') {
 				(*data)++;
-				return new JSONValue(object);
+				return result;
 			}
 
 			// Want a , now
 			if (**data != ',') {
-				FREE_OBJECT(object);
+				delete result;
 				return nullptr;
 			}
 
@@ -517,33 +533,34 @@ JSONValue *JSONValue::parse(const char **data) {
 		}
 
 		// Only here if we ran out of data
-		FREE_OBJECT(object);
+		delete result;
 		return nullptr;
 	}
 
 	// An array?
 	else if (**data == '[') {
-		JSONArray array;
+		JSONValue *result = new JSONValue(JSONArray());
+		JSONArray &array = *result->_arrayValue;
 
 		(*data)++;
 
 		while (**data != 0) {
 			// Whitespace at the start?
 			if (!JSON::skipWhitespace(data)) {
-				FREE_ARRAY(array);
+				delete result;
 				return nullptr;
 			}
 
 			// Special case - empty array
 			if (array.empty() && **data == ']') {
 				(*data)++;
-				return new JSONValue(array);
+				return result;
 			}
 
 			// Get the value
 			JSONValue *value = parse(data);
 			if (value == nullptr) {
-				FREE_ARRAY(array);
+				delete result;
 				return nullptr;
 			}
 
@@ -552,19 +569,19 @@ JSONValue *JSONValue::parse(const char **data) {
 
 			// More whitespace?
 			if (!JSON::skipWhitespace(data)) {
-				FREE_ARRAY(array);
+				delete result;
 				return nullptr;
 			}
 
 			// End of array?
 			if (**data == ']') {
 				(*data)++;
-				return new JSONValue(array);
+				return result;
 			}
 
 			// Want a , now
 			if (**data != ',') {
-				FREE_ARRAY(array);
+				delete result;
 				return nullptr;
 			}
 
@@ -572,7 +589,7 @@ JSONValue *JSONValue::parse(const char **data) {
 		}
 
 		// Only here if we ran out of data
-		FREE_ARRAY(array);
+		delete result;
 		return nullptr;
 	}
 
@@ -1015,101 +1032,114 @@ Array<String> JSONValue::objectKeys() const {
 */
 String JSONValue::stringify(bool const prettyprint) const {
 	size_t const indentDepth = prettyprint ? 1 : 0;
-	return stringifyImpl(indentDepth);
+	String ret_string;
+	stringifyImpl(ret_string, indentDepth);
+	return ret_string;
 }
 
 
 /**
-* Creates a JSON encoded string for the value with all necessary characters escaped
+* Appends the JSON encoded string for the value with all necessary characters escaped.
+* The whole document is written into the one string rather than putting it together
+* from the strings of the children.
 *
 * @access private
 *
+* @param String& out The string to append the JSON to
 * @param size_t indentDepth The prettyprint indentation depth (0 : no prettyprint)
-*
-* @return String Returns the JSON string
 */
-String JSONValue::stringifyImpl(size_t const indentDepth) const {
-	String ret_string;
+void JSONValue::stringifyImpl(String &out, size_t const indentDepth) const {
 	size_t const indentDepth1 = indentDepth ? indentDepth + 1 : 0;
-	String const indentStr = indent(indentDepth);
-	String const indentStr1 = indent(indentDepth1);
 
 	switch (_type) {
 	default:
 		// fallthrough intended
 	case JSONType_Null:
-		ret_string = "null";
+		out += "null";
 		break;
 
 	case JSONType_String:
-		ret_string = stringifyString(*_stringValue);
+		stringifyString(out, *_stringValue);
 		break;
 
 	case JSONType_Bool:
-		ret_string = _boolValue ? "true" : "false";
+		out += _boolValue ? "true" : "false";
 		break;
 
 	case JSONType_Number: {
 		if (isinf(_numberValue) || isnan(_numberValue))
-			ret_string = "null";
+			out += "null";
 		else {
-			ret_string = String::format("%g", _numberValue);
+			out += String::format("%g", _numberValue);
 		}
 		break;
 	}
 
 	case JSONType_IntegerNumber: {
-		ret_string = String::format("%lld", _integerValue);
+		out += String::format("%lld", _integerValue);
 		break;
 	}
 
 	case JSONType_Array: {
-		ret_string = indentDepth ? "[\n" + indentStr1 : "[";
+		out += "[";
+		if (indentDepth) {
+			out += "\n";
+			indent(out, indentDepth1);
+		}
 		JSONArray::const_iterator iter = _arrayValue->begin();
 		while (iter != _arrayValue->end()) {
-			ret_string += (*iter)->stringifyImpl(indentDepth1);
+			(*iter)->stringifyImpl(out, indentDepth1);
 
 			// Not at the end - add a separator
 			if (++iter != _arrayValue->end())
-				ret_string += ",";
+				out += ",";
+		}
+		if (indentDepth) {
+			out += "\n";
+			indent(out, indentDepth);
 		}
-		ret_string += indentDepth ? "\n" + indentStr + "]" : "]";
+		out += "]";
 		break;
 	}
 
 	case JSONType_Object: {
-		ret_string = indentDepth ? "{\n" + indentStr1 : "{";
+		out += "{";
+		if (indentDepth) {
+			out += "\n";
+			indent(out, indentDepth1);
+		}
 		JSONObject::const_iterator iter = _objectValue->begin();
 		while (iter != _objectValue->end()) {
-			ret_string += stringifyString((*iter)._key);
-			ret_string += ":";
-			ret_string += (*iter)._value->stringifyImpl(indentDepth1);
+			stringifyString(out, (*iter)._key);
+			out += ":";
+			(*iter)._value->stringifyImpl(out, indentDepth1);
 
 			// Not at the end - add a separator
 			if (++iter != _objectValue->end())
-				ret_string += ",";
+				out += ",";
+		}
+		if (indentDepth) {
+			out += "\n";
+			indent(out, indentDepth);
 		}
-		ret_string += indentDepth ? "\n" + indentStr + "}" : "}";
+		out += "}";
 		break;
 	}
 	}
-
-	return ret_string;
 }
 
 /**
-* Creates a JSON encoded string with all required fields escaped
+* Appends a JSON encoded string with all required fields escaped
 * Works from https://www.ecma-international.org/wp-content/uploads/ECMA-262_5.1_edition_june_2011.pdf
 * Section 15.12.3.
 *
 * @access private
 *
+* @param String& str_out The string to append the JSON string to
 * @param String str The string that needs to have the characters escaped
-*
-* @return String Returns the JSON string
 */
-String JSONValue::stringifyString(const String &str) {
-	String str_out = "\"";
+void JSONValue::stringifyString(String &str_out, const String &str) {
+	str_out += "\"";
 
 	String::const_iterator iter = str.begin();
 	while (iter != str.end()) {
@@ -1143,7 +1173,6 @@ String JSONValue::stringifyString(const String &str) {
 	}
 
 	str_out += "\"";
-	return str_out;
 }
 
 /**
@@ -1227,20 +1256,17 @@ uint8 JSONValue::decodeUtf8Byte(uint8 state, uint32 &codepoint, uint8 byte) {
 }
 
 /**
-* Creates the indentation string for the depth given
+* Appends the indentation for the depth given
 *
 * @access private
 *
+* @param String& out The string to append the indentation to
 * @param size_t indent The prettyprint indentation depth (0 : no indentation)
-*
-* @return String Returns the string
 */
-String JSONValue::indent(size_t depth) {
+void JSONValue::indent(String &out, size_t depth) {
 	const size_t indent_step = 2;
 	depth ? --depth : 0;
-	String indentStr;
-	for (size_t i = 0; i < depth * indent_step; ++i) indentStr += ' ';
-	return indentStr;
+	for (size_t i = 0; i < depth * indent_step; ++i) out += ' ';
 }
 
 } // End of namespace Common
@@ -129,11 +129,11 @@ protected:
 	static JSONValue *parse(const char **data);
 
 private:
-	static String stringifyString(const String &str);
+	static void stringifyString(String &out, const String &str);
 	static uint32 decodeUtf8Char(String::const_iterator &begin, const String::const_iterator &end);
 	static uint8 decodeUtf8Byte(uint8 state, uint32 &codepoint, uint8 byte);
-	String stringifyImpl(size_t const indentDepth) const;
-	static String indent(size_t depth);
+	void stringifyImpl(String &out, size_t const indentDepth) const;
+	static void indent(String &out, size_t depth);
 
 	JSONType _type;
 
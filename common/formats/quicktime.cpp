@@ -181,6 +181,9 @@ void QuickTimeParser::init() {
 				_tracks[i]->editList[0].mediaTime = 0;
 				_tracks[i]->editList[0].mediaRate = 1;
 			}
+
+			if (_tracks[i]->codecType == CODEC_TYPE_VIDEO)
+				_tracks[i]->buildSampleIndex();
 		}
 	}
 }
@@ -1288,6 +1291,108 @@ String QuickTimeParser::PanoStringTable::getString(int32 offset) const {
 	return strings.substr(str_start, str_length);
 }
 
+void QuickTimeParser::Track::buildSampleIndex() {
+	sampleIndex.clear();
+
+	uint32 sttsSampleCount = 0;
+	for (int i = 0; i < timeToSampleCount; i++)
+		sttsSampleCount += timeToSample[i].count;
+
+	uint32 chunkSampleCount = 0;
+	uint32 sampleToChunkIndex = 0;
+	for (uint32 i = 0; i < chunkCount; i++) {
+		if (sampleToChunkIndex < sampleToChunkCount && i >= sampleToChunk[sampleToChunkIndex].first)
+			sampleToChunkIndex++;
+
+		if (sampleToChunkIndex == 0)
+			return;
+
+		chunkSampleCount += sampleToChunk[sampleToChunkIndex - 1].count;
+	}
+
+	// Leave broken tables to the table walks, which know how to cope with them
+	if (sampleCount == 0 || sttsSampleCount != sampleCount || chunkSampleCount < sampleCount)
+		return;
+	if (sampleSize == 0 && !sampleSizes)
+		return;
+
+	sampleIndex.resize(sampleCount);
+	SampleIndexEntry *entries = sampleIndex.data();
+
+	// Offsets and sample descriptions, from the chunks
+	uint32 sample = 0;
+	sampleToChunkIndex = 0;
+	for (uint32 i = 0; i < chunkCount && sample < sampleCount; i++) {
+		if (sampleToChunkIndex < sampleToChunkCount && i >= sampleToChunk[sampleToChunkIndex].first)
+			sampleToChunkIndex++;
+
+		const SampleToChunkEntry &stsc = sampleToChunk[sampleToChunkIndex - 1];
+		uint32 offset = chunkOffsets[i];
+
+		for (uint32 j = 0; j < stsc.count && sample < sampleCount; j++, sample++) {
+			entries[sample].offset = offset;
+			entries[sample].size = (sampleSize != 0) ? sampleSize : sampleSizes[sample];
+			entries[sample].descId = stsc.id;
+			offset += entries[sample].size;
+		}
+	}
+
+	// Times, from the time-to-sample table
+	sample = 0;
+	uint32 time = 0;
+	for (int i = 0; i < timeToSampleCount; i++) {
+		for (int j = 0; j < timeToSample[i].count; j++, sample++) {
+			entries[sample].time = time;
+			entries[sample].duration = timeToSample[i].duration;
+			time += timeToSample[i].duration;
+		}
+	}
+
+	// Keyframes, from the sync sample table. Without one, every sample is
+	// a keyframe.
+	if (keyframeCount == 0) {
+		for (sample = 0; sample < sampleCount; sample++)
+			entries[sample].keyframe = sample;
+	} else {
+		for (sample = 0; sample < sampleCount; sample++)
+			entries[sample].keyframe = 0xFFFFFFFF;
+		for (uint32 i = 0; i < keyframeCount; i++)
+			if (keyframes[i] < sampleCount)
+				entries[keyframes[i]].keyframe = keyframes[i];
+
+		// Samples before the first keyframe are assumed to be keyframes
+		uint32 lastKeyframe = 0xFFFFFFFF;
+		for (sample = 0; sample < sampleCount; sample++) {
+			if (entries[sample].keyframe == sample)
+				lastKeyframe = sample;
+
+			entries[sample].keyframe = (lastKeyframe == 0xFFFFFFFF) ? sample : lastKeyframe;
+		}
+	}
+}
+
+uint32 QuickTimeParser::Track::findSampleAtTime(uint32 mediaTime) const {
+	if (sampleIndex.empty())
+		return 0;
+
+	const SampleIndexEntry &last = sampleIndex.back();
+	if (mediaTime >= last.time + last.duration)
+		return sampleIndex.size();
+
+	// Last sample with a start time at or before the media time
+	uint32 low = 0;
+	uint32 high = sampleIndex.size();
+	while (high - low > 1) {
+		uint32 mid = low + (high - low) / 2;
+		if (sampleIndex[mid].time <= mediaTime)
+			low = mid;
+		else
+			high = mid;
+	}
+
+	return low;
+}
+
 QuickTimeParser::Track::~Track() {
 	delete[] chunkOffsets;
 	delete[] timeToSample;
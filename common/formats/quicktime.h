@@ -342,6 +342,36 @@ public:
 		uint16 soundBalance; // Controls the sound mix between the computer's two speakers, usually set to 0.
 
 		uint targetTrack;
+
+		/**
+		 * One sample of the track, flattened from the stco/stsc/stsz/stts/stss
+		 * tables so that it can be found without walking them.
+		 */
+		struct SampleIndexEntry {
+			uint32 offset;   // in the file
+			uint32 size;
+			uint32 time;     // media time
+			uint32 duration; // media time
+			uint32 descId;   // sample description, 1-based
+			uint32 keyframe; // closest keyframe at or before this sample
+		};
+
+		/**
+		 * The flattened sample index, built at load time for video tracks.
+		 * It stays empty when the sample tables disagree on the number of
+		 * samples, in which case the raw tables have to be walked.
+		 */
+		Common::Array<SampleIndexEntry> sampleIndex;
+
+		void buildSampleIndex();
+
+		/**
+		 * Find the sample at the given media time in the sample index.
+		 *
+		 * @return The index of the last sample starting at or before the
+		 *         media time, or sampleIndex.size() if it lies past the end.
+		 */
+		uint32 findSampleAtTime(uint32 mediaTime) const;
 	};
 
 	enum class MovieType {
@@ -73,58 +73,46 @@ bool XMLParser::loadStream(SeekableReadStream *stream, const String &name) {
 void XMLParser::close() {
 	delete _stream;
 	_stream = nullptr;
+	_data.clear();
+	_pos = 0;
 }
 
 bool XMLParser::parserError(const String &errStr) {
 	_state = kParserError;
 
-	const int startPosition = _stream->pos();
-	int currentPosition = startPosition;
+	const int startPosition = MIN<uint32>(_pos, _data.size());
 	int lineCount = 1;
-	char c = 0;
 
-	_stream->seek(0, SEEK_SET);
-
-	while (currentPosition--) {
-		c = _stream->readByte();
-
-		if (c == '\n' || c == '\r')
+	for (int i = 0; i < startPosition; ++i) {
+		if (_data[i] == '\n' || _data[i] == '\r')
 			lineCount++;
 	}
 
-	assert(_stream->pos() == startPosition);
-	currentPosition = startPosition;
-
 	Common::String errorMessage = Common::String::format("\n  File <%s>, line %d:\n", _fileName.toString().c_str(), lineCount);
 
 	if (startPosition > 1) {
 		int keyOpening = 0;
 		int keyClosing = 0;
+		char c = 0;
 
-		while (currentPosition-- && keyOpening == 0) {
-			_stream->seek(-2, SEEK_CUR);
-			c = _stream->readByte();
+		for (int i = startPosition - 2; i >= 0 && keyOpening == 0; --i) {
+			c = _data[i];
 
 			if (c == '<')
-				keyOpening = currentPosition - 1;
+				keyOpening = i;
 			else if (c == '>')
-				keyClosing = currentPosition;
+				keyClosing = i + 1;
 		}
 
-		_stream->seek(startPosition, SEEK_SET);
-		currentPosition = startPosition;
-		while (keyClosing == 0 && c && currentPosition++) {
-			c = _stream->readByte();
+		for (int i = startPosition; keyClosing == 0 && c && i < (int)_data.size(); ++i) {
+			c = _data[i];
 
 			if (c == '>')
-				keyClosing = currentPosition;
+				keyClosing = i + 1;
 		}
 
-		currentPosition = (keyClosing - keyOpening);
-		_stream->seek(keyOpening, SEEK_SET);
-
-		while (currentPosition--)
-			errorMessage += (char)_stream->readByte();
+		for (int i = keyOpening; i < keyClosing; ++i)
+			errorMessage += _data[i];
 	}
 
 	errorMessage += "\n\nParser error: ";
@@ -164,26 +152,36 @@ bool XMLParser::parseActiveKey(bool closed) {
 
 	XMLKeyLayout *layout = (_activeKey.size() == 1) ? _XMLkeys : getParentNode(key)->layout;
 
-	if (layout->children.contains(key->name)) {
-		key->layout = layout->children[key->name];
+	ChildMap::const_iterator child = layout->children.find(key->name);
+	if (child != layout->children.end()) {
+		key->layout = child->_value;
 
-		StringMap localMap = key->values;
-		int keyCount = localMap.size();
+		// Count the known properties instead of going through a copy of
+		// the values, this is done for every key of the file.
+		int keyCount = key->values.size();
 
 		for (const auto &prop : key->layout->properties) {
-			if (prop.required && !localMap.contains(prop.name))
-				return parserError("Missing required property '" + prop.name + "' inside key '" + key->name + "'");
-			else if (localMap.contains(prop.name)) {
+			if (key->values.contains(prop.name))
 				keyCount--;
-				localMap.erase(prop.name);
-			}
+			else if (prop.required)
+				return parserError("Missing required property '" + prop.name + "' inside key '" + key->name + "'");
 		}
 
 		if (keyCount > 0) {
 			Common::String missingKeys;
 
-			for (auto i = localMap.begin(); i != localMap.end(); ++i)
-				missingKeys += i->_key + ' ';
+			for (const auto &value : key->values) {
+				bool known = false;
+				for (const auto &prop : key->layout->properties) {
+					if (prop.name.equalsIgnoreCase(value._key)) {
+						known = true;
+						break;
+					}
+				}
+
+				if (!known)
+					missingKeys += value._key + ' ';
+			}
 
 			return parserError(Common::String::format("Unhandled property inside key '%s' (%s, %d items).", key->name.c_str(), missingKeys.c_str(), keyCount));
 		}
@@ -228,17 +226,17 @@ bool XMLParser::parseKeyValue(String keyName) {
 
 	if (_char == '"' || _char == '\'') {
 		stringStart = _char;
-		_char = _stream->readByte();
+		_char = nextChar();
 
-		while (_char && _char != stringStart) {
-			_token += _char;
-			_char = _stream->readByte();
-		}
+		const uint32 valueStart = _pos - 1;
+		while (_char && _char != stringStart)
+			_char = nextChar();
 
 		if (_char == 0)
 			return false;
 
-		_char = _stream->readByte();
+		_token = tokenSince(valueStart);
+		_char = nextChar();
 
 	} else if (!parseToken()) {
 		return false;
@@ -310,8 +308,11 @@ bool XMLParser::parse() {
 	if (_stream == nullptr)
 		return false;
 
-	// Make sure we are at the start of the stream.
+	// Read the whole stream, the tokens are then taken from memory.
 	_stream->seek(0, SEEK_SET);
+	_data.resize(_stream->size());
+	_data.resize(_stream->read(_data.data(), _data.size()));
+	_pos = 0;
 
 	if (_XMLkeys == nullptr)
 		buildLayout();
@@ -328,7 +329,7 @@ bool XMLParser::parse() {
 	_state = kParserNeedHeader;
 	_activeKey.clear();
 
-	_char = _stream->readByte();
+	_char = nextChar();
 
 	while (_char && _state != kParserError) {
 		if (skipSpaces())
@@ -342,16 +343,15 @@ bool XMLParser::parse() {
 		case kParserNeedKey:
 			if (_char != '<') {
 				if (_allowText) {
-					Common::String text;
+					const uint32 textStart = _pos - 1;
 					do {
-						text += _char;
-						_char = _stream->readByte();
+						_char = nextChar();
 					} while (_char != '<' && _char);
 					if (!_char) {
 						parserError("Unexpected end of file.");
 						break;
 					}
-					if (!textCallback(text)) {
+					if (!textCallback(tokenSince(textStart))) {
 						parserError("Failed to process text segment.");
 						break;
 					}
@@ -361,7 +361,7 @@ bool XMLParser::parse() {
 				}
 			}
 
-			if ((_char = _stream->readByte()) == 0) {
+			if ((_char = nextChar()) == 0) {
 				parserError("Unexpected end of file.");
 				break;
 			}
@@ -372,10 +372,10 @@ bool XMLParser::parse() {
 					break;
 				}
 
-				_char = _stream->readByte();
+				_char = nextChar();
 				activeHeader = true;
 			} else if (_char == '/') {
-				_char = _stream->readByte();
+				_char = nextChar();
 				activeClosure = true;
 			} else if (_char == '?') {
 				parserError("Unexpected header. There may only be one XML header per file.");
@@ -423,7 +423,7 @@ bool XMLParser::parse() {
 				else
 					_state = kParserNeedKey;
 
-				_char = _stream->readByte();
+				_char = nextChar();
 				break;
 			}
 
@@ -431,14 +431,14 @@ bool XMLParser::parse() {
 
 			if (_char == '/' || (_char == '?' && activeHeader)) {
 				selfClosure = true;
-				_char = _stream->readByte();
+				_char = nextChar();
 			}
 
 			if (_char == '>') {
 				if (activeHeader && !selfClosure) {
 					parserError("XML Header must be self-closed.");
 				} else if (parseActiveKey(selfClosure)) {
-					_char = _stream->readByte();
+					_char = nextChar();
 					_state = kParserNeedKey;
 				}
 
@@ -461,7 +461,7 @@ bool XMLParser::parse() {
 			else
 				_state = kParserNeedPropertyValue;
 
-			_char = _stream->readByte();
+			_char = nextChar();
 			break;
 
 		case kParserNeedPropertyValue:
@@ -491,39 +491,39 @@ bool XMLParser::skipSpaces() {
 		return false;
 
 	while (_char && isSpace(_char))
-		_char = _stream->readByte();
+		_char = nextChar();
 
 	return true;
 }
 
 bool XMLParser::skipComments() {
 	if (_char == '<') {
-		_char = _stream->readByte();
+		_char = nextChar();
 
 		if (_char != '!') {
-			_stream->seek(-1, SEEK_CUR);
+			_pos--;
 			_char = '<';
 			return false;
 		}
 
-		if (_stream->readByte() != '-' || _stream->readByte() != '-')
+		if (nextChar() != '-' || nextChar() != '-')
 			return parserError("Malformed comment syntax.");
 
-		_char = _stream->readByte();
+		_char = nextChar();
 
 		while (_char) {
 			if (_char == '-') {
-				if (_stream->readByte() == '-') {
+				if (nextChar() == '-') {
 
-					if (_stream->readByte() != '>')
+					if (nextChar() != '>')
 						return parserError("Malformed comment (double-hyphen inside comment body).");
 
-					_char = _stream->readByte();
+					_char = nextChar();
 					return true;
 				}
 			}
 
-			_char = _stream->readByte();
+			_char = nextChar();
 		}
 
 		return parserError("Comment has no closure.");
@@ -533,12 +533,12 @@ bool XMLParser::skipComments() {
 }
 
 bool XMLParser::parseToken() {
-	_token.clear();
+	const uint32 tokenStart = _pos - 1;
 
-	while (isValidNameChar(_char)) {
-		_token += _char;
-		_char = _stream->readByte();
-	}
+	while (isValidNameChar(_char))
+		_char = nextChar();
+
+	_token = tokenSince(tokenStart);
 
 	return isSpace(_char) != 0 || _char == '>' || _char == '=' || _char == '/';
 }
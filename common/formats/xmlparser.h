@@ -100,7 +100,7 @@ public:
 	/**
 	 * Parser constructor.
 	 */
-	XMLParser() : _XMLkeys(nullptr), _stream(nullptr), _allowText(false), _char(0) {}
+	XMLParser() : _XMLkeys(nullptr), _stream(nullptr), _allowText(false), _char(0), _pos(0) {}
 
 	virtual ~XMLParser();
 
@@ -379,6 +379,24 @@ private:
 	SeekableReadStream *_stream;
 	Path _fileName;
 
+	/**
+	 * The contents of the stream, read in one go when parsing starts so
+	 * that the tokens are taken straight from memory.
+	 */
+	Array<char> _data;
+	uint32 _pos; /** Position of the next character in _data */
+
+	/** Returns the next character, or 0 at the end of the data. */
+	inline char nextChar() {
+		return (_pos++ < _data.size()) ? _data[_pos - 1] : 0;
+	}
+
+	/** Returns the characters read since start, up to the current one. */
+	String tokenSince(uint32 start) const {
+		const uint32 end = MIN<uint32>(_pos - 1, _data.size());
+		return (start < end) ? String(_data.data() + start, end - start) : String();
+	}
+
 	ParserState _state; /** Internal state of the parser */
 
 	String _error; /** Current error message */
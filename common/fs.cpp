@@ -233,6 +233,10 @@ bool FSNode::isWritable() const {
 	return _realNode && _realNode->isWritable();
 }
 
+bool FSNode::getFileStamp(int64 &size, int64 &modified) const {
+	return _realNode && _realNode->getFileStamp(size, modified);
+}
+
 SeekableReadStream *FSNode::createReadStream() const {
 	if (_realNode == nullptr)
 		return nullptr;
@@ -373,6 +377,43 @@ const ArchiveMemberPtr FSDirectory::getMember(const Path &path) const {
 	return ArchiveMemberPtr(new FSDirectoryFile(path, *node));
 }
 
+namespace {
+
+// Opens its own stream on the file, so the read does not depend on the
+// FSDirectory which requested it
+class FSNodePrefetchRequest : public PrefetchRequest {
+public:
+	FSNodePrefetchRequest(const FSNode &node) : _node(node) {}
+
+protected:
+	SeekableReadStream *open() override {
+		return _node.createReadStream();
+	}
+
+private:
+	const FSNode _node;
+};
+
+} // End of anonymous namespace
+
+PrefetchHandle FSDirectory::prefetch(const Path &path) const {
+	if (path.empty() || !_node.isDirectory())
+		return PrefetchHandle();
+
+	FSNode *node = lookupCache(_fileCache, path);
+	if (!node || node->isDirectory())
+		return PrefetchHandle();
+
+	SharedPtr<PrefetchRequest> &request = _prefetches.getOrCreateVal(node->getPath());
+	if (!request)
+		request.reset(new FSNodePrefetchRequest(*node));
+
+	if (request->getState() == PrefetchRequest::kStateCancelled)
+		request->queue();
+
+	return PrefetchHandle(request);
+}
+
 SeekableReadStream *FSDirectory::createReadStreamForMember(const Path &path) const {
 	if (path.empty() || !_node.isDirectory())
 		return nullptr;
@@ -381,6 +422,18 @@ SeekableReadStream *FSDirectory::createReadStreamForMember(const Path &path) con
 	if (!node)
 		return nullptr;
 
+	if (!_prefetches.empty()) {
+		PrefetchMap::iterator it = _prefetches.find(node->getPath());
+		if (it != _prefetches.end()) {
+			SharedPtr<PrefetchRequest> request = it->_value;
+			_prefetches.erase(it);
+
+			SeekableReadStream *stream = request->takeStream();
+			if (stream)
+				return stream;
+		}
+	}
+
 	debug(5, "FSDirectory::createReadStreamForMember('%s') -> '%s'", path.toString(Common::Path::kNativeSeparator).c_str(), node->getPath().toString(Common::Path::kNativeSeparator).c_str());
 
 	SeekableReadStream *stream = node->createReadStream();
@@ -252,6 +252,19 @@ public:
 	 */
 	bool isWritable() const;
 
+	/**
+	 * Get the size and the time of the last modification of the file this
+	 * node refers to, without opening it.
+	 *
+	 * @param size      The size of the file in bytes.
+	 * @param modified  The modification time, in a unit and from an epoch
+	 *                  that depend on the backend. Only good for comparing
+	 *                  with other times of the same backend.
+	 *
+	 * @return True if the backend knows them, false otherwise.
+	 */
+	bool getFileStamp(int64 &size, int64 &modified) const;
+
 	/**
 	 * Create a SeekableReadStream instance corresponding to the file
 	 * referred by this node. This assumes that the node actually refers
@@ -356,6 +369,10 @@ class FSDirectory : public Archive {
 	mutable NodeMapCache	_fileMapCache, _dirMapCache;
 	mutable bool _cached;
 
+	// Members being prefetched, keyed by the path of their node
+	typedef HashMap<Path, SharedPtr<PrefetchRequest>, Path::IgnoreCase_Hash, Path::IgnoreCase_EqualTo> PrefetchMap;
+	mutable PrefetchMap _prefetches;
+
 	// look for a match
 	FSNode *lookupCache(NodeCache &cache, const Path &name) const;
 
@@ -445,6 +462,12 @@ public:
 	 */
 	SeekableReadStream *createReadStreamForMember(const Path &path) const override;
 
+	/**
+	 * Start reading the specified file into memory in the background. The
+	 * data is kept until the file is opened or the handle is cancelled.
+	 */
+	PrefetchHandle prefetch(const Path &path) const override;
+
 	bool getChildren(const Common::Path &path, Common::Array<Common::String> &list, ListMode mode = kListDirectoriesOnly, bool hidden = true) const override;
 
 	/**
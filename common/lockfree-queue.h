@@ -0,0 +1,137 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef COMMON_LOCKFREE_QUEUE_H
+#define COMMON_LOCKFREE_QUEUE_H
+
+#include "common/scummsys.h"
+#include "common/noncopyable.h"
+
+#include <atomic>
+
+namespace Common {
+
+/**
+ * @defgroup common_lockfree_queue Lock-free queue
+ * @ingroup common
+ *
+ * @brief Bounded queue to pass messages between threads without locking.
+ *
+ * @{
+ */
+
+/**
+ * Fixed size queue which any number of threads can push to at the same
+ * time, and one thread pops from, without taking any lock.
+ *
+ * This is the bounded ring buffer described by Dmitry Vyukov: every slot
+ * has a sequence number telling whether it is free for the producer of a
+ * given position, or holds the element for the consumer of that position.
+ *
+ * Popping is not thread safe: only one thread may pop at a time, e.g. by
+ * only popping while holding some mutex.
+ */
+template<class T, uint SIZE = 256>
+class LockFreeQueue : NonCopyable {
+	static_assert(SIZE >= 2 && (SIZE & (SIZE - 1)) == 0, "LockFreeQueue size must be a power of two");
+
+public:
+	LockFreeQueue() : _head(0), _tail(0) {
+		for (uint32 i = 0; i < SIZE; ++i)
+			_slots[i].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	/**
+	 * Add an element at the end of the queue.
+	 *
+	 * @return false if the queue is full.
+	 */
+	bool push(const T &value) {
+		uint32 pos = _tail.load(std::memory_order_relaxed);
+		Slot *slot;
+
+		for (;;) {
+			slot = &_slots[pos & (SIZE - 1)];
+			const int32 diff = (int32)(slot->sequence.load(std::memory_order_acquire) - pos);
+
+			if (diff == 0) {
+				// The slot is free: claim the position
+				if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			} else if (diff < 0) {
+				// The slot still holds the element from one lap ago
+				return false;
+			} else {
+				// Another producer claimed the position first
+				pos = _tail.load(std::memory_order_relaxed);
+			}
+		}
+
+		slot->value = value;
+		slot->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * Remove the element at the front of the queue.
+	 *
+	 * @return false if the queue is empty.
+	 */
+	bool pop(T &value) {
+		const uint32 pos = _head.load(std::memory_order_relaxed);
+		Slot &slot = _slots[pos & (SIZE - 1)];
+
+		if ((int32)(slot.sequence.load(std::memory_order_acquire) - (pos + 1)) < 0)
+			return false;
+
+		value = slot.value;
+		// Free the slot for the producer one lap ahead
+		slot.sequence.store(pos + SIZE, std::memory_order_release);
+		_head.store(pos + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	/**
+	 * Check whether the queue is empty. Elements being pushed concurrently
+	 * may or may not be seen.
+	 */
+	bool empty() const {
+		const uint32 pos = _head.load(std::memory_order_relaxed);
+		return (int32)(_slots[pos & (SIZE - 1)].sequence.load(std::memory_order_acquire) - (pos + 1)) < 0;
+	}
+
+private:
+	struct Slot {
+		std::atomic<uint32> sequence;
+		T value;
+	};
+
+	Slot _slots[SIZE];
+	std::atomic<uint32> _head;
+	std::atomic<uint32> _tail;
+};
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
@@ -12,8 +12,10 @@
 #include <string.h>
 
 
-/* This file uses only the official API of Lua.
-** Any function declared here could be written as an application function.
+/* This file uses only the official API of Lua, except for
+** luaL_gcstepbudget, which peeks at the collector state to pace itself.
+** Any other function declared here could be written as an application
+** function.
 */
 
 #define lauxlib_c
@@ -22,7 +24,11 @@
 #include "lua.h"
 
 #include "lauxlib.h"
+#include "lgc.h"
+#include "lstate.h"
 #include "scummvm_file.h"
+#include "common/memorypool.h"
+#include "common/system.h"
 #include "common/textconsole.h"
 
 #define FREELIST_REF	0	/* free list of references */
@@ -655,3 +661,182 @@ LUALIB_API lua_State *luaL_newstate (void) {
   if (L) lua_atpanic(L, &panic);
   return L;
 }
+
+
+/*
+** {======================================================
+** Pooled allocator and collector pacing
+** =======================================================
+*/
+
+/* Most Lua objects (strings, tables, closures, upvalues) are small and
+** short-lived; blocks up to the largest size class are carved out of
+** per-class memory pools, anything bigger goes to realloc.
+*/
+static const size_t poolsizes[] = { 16, 32, 48, 64, 96, 128, 192, 256 };
+
+#define NUMPOOLS	(sizeof(poolsizes) / sizeof(poolsizes[0]))
+#define MAXPOOLED	256
+
+/* size class of a block, indexed by its size in 16 byte units */
+static const signed char poolclass[] = {
+  0, 0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7
+};
+
+typedef struct LuaHeap {
+  Common::MemoryPool *pools[NUMPOOLS];
+  luaL_HeapStats stats;
+} LuaHeap;
+
+
+static int sizeclass (size_t size) {
+  return (size > MAXPOOLED) ? -1 : poolclass[(size + 15) >> 4];
+}
+
+
+static void *heapget (LuaHeap *h, int cls, size_t size) {
+  if (cls < 0)
+    return malloc(size);
+  h->stats.pooled += size;
+  h->stats.pooledAllocations++;
+  return h->pools[cls]->allocChunk();
+}
+
+
+static void heapput (LuaHeap *h, int cls, void *ptr, size_t size) {
+  if (cls < 0) {
+    free(ptr);
+    return;
+  }
+  h->stats.pooled -= size;
+  h->pools[cls]->freeChunk(ptr);
+}
+
+
+static void *l_pooledalloc (void *ud, void *ptr, size_t osize, size_t nsize) {
+  LuaHeap *h = (LuaHeap *)ud;
+  int ocls = ptr ? sizeclass(osize) : -1;
+  int ncls = sizeclass(nsize);
+  void *nptr;
+  if (ptr == NULL)
+    osize = 0;
+  if (nsize == 0) {
+    if (ptr) heapput(h, ocls, ptr, osize);
+    h->stats.inUse -= osize;
+    return NULL;
+  }
+  if (ptr && ocls == ncls) {  /* block stays in its class? */
+    if (ncls < 0) {
+      nptr = realloc(ptr, nsize);
+      if (nptr == NULL) return NULL;
+    }
+    else {
+      nptr = ptr;
+      h->stats.pooled += nsize - osize;
+    }
+  }
+  else {
+    nptr = heapget(h, ncls, nsize);
+    if (nptr == NULL) return NULL;
+    if (ptr) {
+      memcpy(nptr, ptr, (osize < nsize) ? osize : nsize);
+      heapput(h, ocls, ptr, osize);
+    }
+  }
+  h->stats.inUse += nsize - osize;
+  if (h->stats.inUse > h->stats.peak)
+    h->stats.peak = h->stats.inUse;
+  h->stats.allocations++;
+  return nptr;
+}
+
+
+static LuaHeap *getheap (lua_State *L) {
+  void *ud;
+  return (lua_getallocf(L, &ud) == l_pooledalloc) ? (LuaHeap *)ud : NULL;
+}
+
+
+LUALIB_API lua_State *luaL_newpooledstate (void) {
+  LuaHeap *h = new LuaHeap;
+  for (size_t i = 0; i < NUMPOOLS; i++)
+    h->pools[i] = new Common::MemoryPool(poolsizes[i]);
+  memset(&h->stats, 0, sizeof(h->stats));
+  lua_State *L = lua_newstate(l_pooledalloc, h);
+  if (L == NULL) {
+    for (size_t i = 0; i < NUMPOOLS; i++)
+      delete h->pools[i];
+    delete h;
+    return NULL;
+  }
+  lua_atpanic(L, &panic);
+  return L;
+}
+
+
+LUALIB_API void luaL_closestate (lua_State *L) {
+  LuaHeap *h = getheap(L);
+  lua_close(L);
+  if (h) {
+    for (size_t i = 0; i < NUMPOOLS; i++)
+      delete h->pools[i];
+    delete h;
+  }
+}
+
+
+LUALIB_API int luaL_getheapstats (lua_State *L, luaL_HeapStats *stats) {
+  LuaHeap *h = getheap(L);
+  if (h == NULL) {
+    memset(stats, 0, sizeof(*stats));
+    stats->inUse = stats->peak = G(L)->totalbytes;
+    return 0;
+  }
+  *stats = h->stats;
+  return 1;
+}
+
+
+LUALIB_API void luaL_trimheap (lua_State *L) {
+  LuaHeap *h = getheap(L);
+  if (h) {
+    for (size_t i = 0; i < NUMPOOLS; i++)
+      h->pools[i]->freeUnusedPages();
+  }
+}
+
+
+/* A new cycle is started ahead of the automatic one once the heap is half
+** way from the live estimate to the collection threshold, so the work is
+** spread over frames instead of landing in a single allocation.
+*/
+static int gcdue (global_State *g) {
+  if (g->gcstate != GCSpause)
+    return 1;
+  if (g->GCthreshold <= g->estimate)
+    return g->totalbytes >= g->GCthreshold;
+  return g->totalbytes >= g->estimate + (g->GCthreshold - g->estimate) / 2;
+}
+
+
+LUALIB_API int luaL_gcstepbudget (lua_State *L, unsigned int budget) {
+  LuaHeap *h = getheap(L);
+  int steps = 0;
+  uint32 start;
+  if (!gcdue(G(L)))
+    return 0;
+  /* the system clock only has millisecond resolution */
+  start = g_system->getMillis();
+  do {
+    int finished = lua_gc(L, LUA_GCSTEP, 0);
+    steps++;
+    if (h) h->stats.gcSteps++;
+    if (finished) {
+      if (h) h->stats.gcCycles++;
+      break;
+    }
+  } while ((g_system->getMillis() - start) * 1000 < budget);
+  return steps;
+}
+
+/* }====================================================== */
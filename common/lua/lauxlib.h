@@ -81,6 +81,23 @@ LUALIB_API int (luaL_loadstring) (lua_State *L, const char *s);
 
 LUALIB_API lua_State *(luaL_newstate) (void);
 
+/* heap statistics of a state created by luaL_newpooledstate */
+typedef struct luaL_HeapStats {
+  size_t inUse;  /* bytes currently allocated */
+  size_t peak;  /* highest value of inUse so far */
+  size_t pooled;  /* part of inUse served by the size-class pools */
+  unsigned long allocations;  /* blocks allocated or resized */
+  unsigned long pooledAllocations;  /* of which taken from a pool */
+  unsigned long gcSteps;  /* steps run by luaL_gcstepbudget */
+  unsigned long gcCycles;  /* cycles finished by luaL_gcstepbudget */
+} luaL_HeapStats;
+
+LUALIB_API lua_State *(luaL_newpooledstate) (void);
+LUALIB_API void (luaL_closestate) (lua_State *L);
+LUALIB_API int (luaL_getheapstats) (lua_State *L, luaL_HeapStats *stats);
+LUALIB_API void (luaL_trimheap) (lua_State *L);
+LUALIB_API int (luaL_gcstepbudget) (lua_State *L, unsigned int budget);
+
 
 LUALIB_API const char *(luaL_gsub) (lua_State *L, const char *s, const char *p,
                                                   const char *r);
@@ -0,0 +1,77 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "common/endian.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Common {
+
+void swapBytes16NEON(uint16 *data, size_t count) {
+	size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		uint8x16_t v = vld1q_u8((const uint8 *)(data + i));
+		vst1q_u8((uint8 *)(data + i), vrev16q_u8(v));
+	}
+
+	for (; i < count; ++i)
+		data[i] = SWAP_BYTES_16(data[i]);
+}
+
+void swapBytes32NEON(uint32 *data, size_t count) {
+	size_t i = 0;
+	for (; i + 4 <= count; i += 4) {
+		uint8x16_t v = vld1q_u8((const uint8 *)(data + i));
+		vst1q_u8((uint8 *)(data + i), vrev32q_u8(v));
+	}
+
+	for (; i < count; ++i)
+		data[i] = SWAP_BYTES_32(data[i]);
+}
+
+} // End of namespace Common
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
@@ -20,10 +20,59 @@
  */
 
 #include "common/memory.h"
+#include "common/endian.h"
+#include "common/system.h"
 #include "common/util.h"
 
 namespace Common {
 
+#ifdef SCUMMVM_SSE2
+// Defined in memory-sse2.cpp
+void swapBytes16SSE2(uint16 *data, size_t count);
+void swapBytes32SSE2(uint32 *data, size_t count);
+#endif
+
+#ifdef SCUMMVM_NEON
+// Defined in memory-neon.cpp
+void swapBytes16NEON(uint16 *data, size_t count);
+void swapBytes32NEON(uint32 *data, size_t count);
+#endif
+
+namespace {
+
+// Vectorizing only pays off for buffers of a few vectors
+enum {
+	kMinSIMDSwapBytes = 64
+};
+
+#ifdef SCUMMVM_SSE2
+bool hasSSE2() {
+#if defined(__x86_64__) || defined(_M_X64)
+	return true;
+#else
+	static int result = -1;
+	if (result < 0)
+		result = g_system && g_system->hasFeature(OSystem::kFeatureCpuSSE2);
+	return result;
+#endif
+}
+#endif
+
+#ifdef SCUMMVM_NEON
+bool hasNEON() {
+#if defined(__aarch64__)
+	return true;
+#else
+	static int result = -1;
+	if (result < 0)
+		result = g_system && g_system->hasFeature(OSystem::kFeatureCpuNEON);
+	return result;
+#endif
+}
+#endif
+
+} // End of anonymous namespace
+
 void memset64(uint64 *dst, uint64 val, size_t count) {
 	if (!count)
 		return;
@@ -70,4 +119,44 @@ void memset16(uint16 *dst, uint16 val, size_t count) {
 	}
 }
 
+void swapBytes16(uint16 *data, size_t count) {
+	if (count * 2 >= kMinSIMDSwapBytes) {
+#ifdef SCUMMVM_SSE2
+		if (hasSSE2()) {
+			swapBytes16SSE2(data, count);
+			return;
+		}
+#endif
+#ifdef SCUMMVM_NEON
+		if (hasNEON()) {
+			swapBytes16NEON(data, count);
+			return;
+		}
+#endif
+	}
+
+	for (size_t i = 0; i < count; ++i)
+		data[i] = SWAP_BYTES_16(data[i]);
+}
+
+void swapBytes32(uint32 *data, size_t count) {
+	if (count * 4 >= kMinSIMDSwapBytes) {
+#ifdef SCUMMVM_SSE2
+		if (hasSSE2()) {
+			swapBytes32SSE2(data, count);
+			return;
+		}
+#endif
+#ifdef SCUMMVM_NEON
+		if (hasNEON()) {
+			swapBytes32NEON(data, count);
+			return;
+		}
+#endif
+	}
+
+	for (size_t i = 0; i < count; ++i)
+		data[i] = SWAP_BYTES_32(data[i]);
+}
+
 } // End of namespace Common
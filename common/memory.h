@@ -50,6 +50,55 @@ void memset16(uint16 *dst, uint16 val, size_t count);
 void memset32(uint32 *dst, uint32 val, size_t count);
 void memset64(uint64 *dst, uint64 val, size_t count);
 
+/**
+ * Swap the byte order of @p count 16-bit values at @p data, in place.
+ *
+ * This uses SIMD instructions where the CPU has them, so converting whole
+ * buffers this way is much faster than calling SWAP_BYTES_16 in a loop.
+ */
+void swapBytes16(uint16 *data, size_t count);
+
+/**
+ * Swap the byte order of @p count 32-bit values at @p data, in place.
+ *
+ * @see swapBytes16
+ */
+void swapBytes32(uint32 *data, size_t count);
+
+/**
+ * Convert @p count 16-bit values at @p data between little endian and the
+ * native byte order, in place. This is a no-op on little endian systems.
+ */
+inline void convertLE16(uint16 *data, size_t count) {
+#ifdef SCUMM_BIG_ENDIAN
+	swapBytes16(data, count);
+#endif
+}
+
+/** @copydoc convertLE16 */
+inline void convertLE32(uint32 *data, size_t count) {
+#ifdef SCUMM_BIG_ENDIAN
+	swapBytes32(data, count);
+#endif
+}
+
+/**
+ * Convert @p count 16-bit values at @p data between big endian and the
+ * native byte order, in place. This is a no-op on big endian systems.
+ */
+inline void convertBE16(uint16 *data, size_t count) {
+#ifdef SCUMM_LITTLE_ENDIAN
+	swapBytes16(data, count);
+#endif
+}
+
+/** @copydoc convertBE16 */
+inline void convertBE32(uint32 *data, size_t count) {
+#ifdef SCUMM_LITTLE_ENDIAN
+	swapBytes32(data, count);
+#endif
+}
+
 /**
  * Copies data from the range [first, last) to [dst, dst + (last - first)).
  * It requires the range [dst, dst + (last - first)) to be valid and
@@ -20,6 +20,7 @@
  */
 
 #include "common/memorypool.h"
+#include "common/memtag.h"
 #include "common/util.h"
 
 namespace Common {
@@ -55,7 +56,7 @@ MemoryPool::~MemoryPool() {
 #endif
 
 	for (size_t i = 0; i < _pages.size(); ++i)
-		::free(_pages[i].start);
+		freePage(_pages[i]);
 }
 
 void MemoryPool::allocPage() {
@@ -67,6 +68,10 @@ void MemoryPool::allocPage() {
 
 	page.start = ::malloc(page.numChunks * _chunkSize);
 	assert(page.start);
+#ifdef USE_MEMORY_TAGS
+	page.tag = getCurrentMemoryTag();
+	addTaggedMemory(page.tag, page.numChunks * _chunkSize);
+#endif
 	_pages.push_back(page);
 
 
@@ -77,6 +82,13 @@ void MemoryPool::allocPage() {
 	addPageToPool(page);
 }
 
+void MemoryPool::freePage(const Page &page) {
+#ifdef USE_MEMORY_TAGS
+	removeTaggedMemory(page.tag, page.numChunks * _chunkSize);
+#endif
+	::free(page.start);
+}
+
 void MemoryPool::addPageToPool(const Page &page) {
 	// Add all chunks of the new page to the linked list (pool) of free chunks
 	void *current = page.start;
@@ -150,7 +162,7 @@ void MemoryPool::freeUnusedPages() {
 					iter2 = *(void ***)iter2;
 			}
 
-			::free(_pages[i].start);
+			freePage(_pages[i]);
 			_pages[i].start = nullptr;
 		}
 	}
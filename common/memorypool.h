@@ -54,6 +54,9 @@ protected:
 	struct Page {
 		void *start;
 		size_t numChunks;
+#ifdef USE_MEMORY_TAGS
+		uint tag; ///< Memory tag the page is accounted to
+#endif
 	};
 
 	const size_t	_chunkSize;
@@ -62,6 +65,7 @@ protected:
 	size_t			_chunksPerPage;
 
 	void	allocPage();
+	void	freePage(const Page &page);
 	void	addPageToPool(const Page &page);
 	bool	isPointerInPage(void *ptr, const Page &page);
 
@@ -120,7 +124,9 @@ public:
 	FixedSizeMemoryPool() : MemoryPool(CHUNK_SIZE) {
 		assert(REAL_CHUNK_SIZE == _chunkSize);
 		// Insert some static storage
-		Page internalPage = { _storage, NUM_INTERNAL_CHUNKS };
+		Page internalPage;
+		internalPage.start = _storage;
+		internalPage.numChunks = NUM_INTERNAL_CHUNKS;
 		addPageToPool(internalPage);
 	}
 };
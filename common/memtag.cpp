@@ -0,0 +1,261 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+// The replacements of the global operator new need the system allocator
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+#include "common/memtag.h"
+
+#ifdef USE_MEMORY_TAGS
+
+#include "common/array.h"
+
+#include <atomic>
+#include <new>
+
+namespace Common {
+
+enum {
+	kMaxMemoryTags = 64,
+	kMaxMemoryTagName = 32,
+	kMemoryBlockMagic = 0x4D544147 // 'MTAG'
+};
+
+struct MemoryTagCounters {
+	char name[kMaxMemoryTagName]; // A copy, the name may live in a plugin unloaded later
+	uint64 currentBytes;
+	uint64 peakBytes;
+	uint64 allocations;
+};
+
+/** Put in front of every block from operator new, linking all live blocks. */
+struct MemoryBlock {
+	MemoryBlock *prev, *next;
+	size_t size;
+	uint32 tag;
+	uint32 magic;
+};
+
+// Keeps the memory after the header aligned like malloc() does
+static const size_t kMemoryBlockHeaderSize = (sizeof(MemoryBlock) + 15) & ~(size_t)15;
+
+// Everything here is used by operator new, even before and after the static
+// constructors run. It is all constant initialized and never allocates.
+static std::atomic_flag s_memoryTagLock = ATOMIC_FLAG_INIT;
+static MemoryTagCounters s_memoryTags[kMaxMemoryTags];
+static uint s_numMemoryTags = 1;
+static MemoryBlock *s_memoryBlocks = nullptr;
+
+static thread_local uint t_memoryTag = 0;
+
+/** A spin lock, since a mutex could allocate. */
+class MemoryTagLock {
+public:
+	MemoryTagLock() {
+		while (s_memoryTagLock.test_and_set(std::memory_order_acquire)) {
+		}
+	}
+	~MemoryTagLock() {
+		s_memoryTagLock.clear(std::memory_order_release);
+	}
+};
+
+static void accountAllocation(MemoryTagCounters &tag, size_t size) {
+	tag.currentBytes += size;
+	tag.allocations++;
+	if (tag.currentBytes > tag.peakBytes)
+		tag.peakBytes = tag.currentBytes;
+}
+
+static uint findMemoryTag(const char *name) {
+	MemoryTagLock lock;
+
+	for (uint i = 1; i < s_numMemoryTags; i++) {
+		if (!strncmp(s_memoryTags[i].name, name, kMaxMemoryTagName - 1))
+			return i;
+	}
+
+	// Once the table is full the memory stays untagged
+	if (s_numMemoryTags == kMaxMemoryTags)
+		return 0;
+
+	strncpy(s_memoryTags[s_numMemoryTags].name, name, kMaxMemoryTagName - 1);
+	return s_numMemoryTags++;
+}
+
+MemoryTag::MemoryTag(const char *name) : _previous(t_memoryTag) {
+	t_memoryTag = findMemoryTag(name);
+}
+
+MemoryTag::~MemoryTag() {
+	t_memoryTag = _previous;
+}
+
+uint getCurrentMemoryTag() {
+	return t_memoryTag;
+}
+
+void addTaggedMemory(uint tag, size_t size) {
+	MemoryTagLock lock;
+	accountAllocation(s_memoryTags[tag], size);
+}
+
+void removeTaggedMemory(uint tag, size_t size) {
+	MemoryTagLock lock;
+	s_memoryTags[tag].currentBytes -= size;
+}
+
+Array<MemoryTagInfo> getMemoryTagInfo() {
+	MemoryTagCounters tags[kMaxMemoryTags];
+	uint numTags;
+	{
+		MemoryTagLock lock;
+		numTags = s_numMemoryTags;
+		memcpy(tags, s_memoryTags, numTags * sizeof(MemoryTagCounters));
+	}
+
+	Array<MemoryTagInfo> info;
+	info.reserve(numTags);
+	for (uint i = 0; i < numTags; i++) {
+		// Tags are never removed, so their names stay in place
+		MemoryTagInfo tag = { i ? s_memoryTags[i].name : "untagged", tags[i].currentBytes, tags[i].peakBytes, tags[i].allocations };
+		info.push_back(tag);
+	}
+	return info;
+}
+
+Array<MemoryAllocationInfo> getLargestAllocations(uint count) {
+	Array<MemoryAllocationInfo> largest;
+	if (!count)
+		return largest;
+
+	// Nothing may be allocated while the blocks are walked
+	MemoryAllocationInfo *top = new MemoryAllocationInfo[count];
+	uint numTop = 0;
+	{
+		MemoryTagLock lock;
+		for (const MemoryBlock *block = s_memoryBlocks; block; block = block->next) {
+			if (numTop == count && block->size <= top[numTop - 1].size)
+				continue;
+
+			uint i = (numTop < count) ? numTop++ : numTop - 1;
+			for (; i > 0 && top[i - 1].size < block->size; i--)
+				top[i] = top[i - 1];
+			top[i].tag = block->tag ? s_memoryTags[block->tag].name : "untagged";
+			top[i].size = block->size;
+		}
+	}
+
+	largest.reserve(numTop);
+	for (uint i = 0; i < numTop; i++)
+		largest.push_back(top[i]);
+	delete[] top;
+	return largest;
+}
+
+void *taggedMalloc(size_t size) {
+	MemoryBlock *block = (MemoryBlock *)::malloc(kMemoryBlockHeaderSize + size);
+	if (!block)
+		return nullptr;
+
+	block->size = size;
+	block->tag = t_memoryTag;
+	block->magic = kMemoryBlockMagic;
+	block->prev = nullptr;
+	{
+		MemoryTagLock lock;
+		block->next = s_memoryBlocks;
+		if (s_memoryBlocks)
+			s_memoryBlocks->prev = block;
+		s_memoryBlocks = block;
+		accountAllocation(s_memoryTags[block->tag], size);
+	}
+
+	return (byte *)block + kMemoryBlockHeaderSize;
+}
+
+void taggedFree(void *ptr) {
+	if (!ptr)
+		return;
+
+	MemoryBlock *block = (MemoryBlock *)((byte *)ptr - kMemoryBlockHeaderSize);
+	assert(block->magic == kMemoryBlockMagic);
+	block->magic = 0;
+	{
+		MemoryTagLock lock;
+		if (block->prev)
+			block->prev->next = block->next;
+		else
+			s_memoryBlocks = block->next;
+		if (block->next)
+			block->next->prev = block->prev;
+		s_memoryTags[block->tag].currentBytes -= block->size;
+	}
+
+	::free(block);
+}
+
+} // End of namespace Common
+
+// With exceptions disabled a failed allocation returns nullptr, which most
+// callers already check for
+void *operator new(size_t size) {
+	return Common::taggedMalloc(size);
+}
+
+void *operator new[](size_t size) {
+	return Common::taggedMalloc(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+	return Common::taggedMalloc(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+	return Common::taggedMalloc(size);
+}
+
+void operator delete(void *ptr) noexcept {
+	Common::taggedFree(ptr);
+}
+
+void operator delete[](void *ptr) noexcept {
+	Common::taggedFree(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept {
+	Common::taggedFree(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept {
+	Common::taggedFree(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+	Common::taggedFree(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+	Common::taggedFree(ptr);
+}
+
+#endif
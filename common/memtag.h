@@ -0,0 +1,128 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef COMMON_MEMTAG_H
+#define COMMON_MEMTAG_H
+
+#include "common/scummsys.h"
+
+namespace Common {
+
+template<class T> class Array;
+
+/**
+ * @defgroup common_memtag Memory tags
+ * @ingroup common_memory
+ *
+ * @brief Accounting of the memory allocated by named pieces of code.
+ *
+ * Code names what it allocates with MEMORY_TAG("name"), which tags what
+ * the current thread allocates with operator new, MemoryPool and
+ * ObjectPool in the enclosing scope, as well as the storage of Array.
+ * Tags nest and the innermost one wins. Memory allocated outside of any
+ * tag is accounted as untagged. Other blocks from malloc() are not
+ * accounted, see taggedMalloc().
+ *
+ * Without memory tags, enabled by configure with --enable-memory-tags, the
+ * macro compiles to nothing and operator new is left alone.
+ *
+ * @{
+ */
+
+#ifdef USE_MEMORY_TAGS
+
+/** Accounting of one tag, see getMemoryTagInfo(). */
+struct MemoryTagInfo {
+	const char *name;
+	uint64 currentBytes; ///< Allocated with the tag and not freed yet
+	uint64 peakBytes;    ///< Highest currentBytes so far
+	uint64 allocations;  ///< Allocations made with the tag so far
+};
+
+/** A live block from operator new, see getLargestAllocations(). */
+struct MemoryAllocationInfo {
+	const char *tag;
+	size_t size;
+};
+
+/**
+ * Tags the memory allocated by the current thread in the scope it lives
+ * in, see MEMORY_TAG().
+ */
+class MemoryTag {
+public:
+	/** @param name Name of the tag, of which the first 31 characters count. */
+	explicit MemoryTag(const char *name);
+	~MemoryTag();
+
+private:
+	uint _previous;
+};
+
+/**
+ * The tag of the current thread, for allocators which account the memory
+ * they get from malloc() themselves with addTaggedMemory().
+ */
+uint getCurrentMemoryTag();
+
+/** Account memory to a tag returned by getCurrentMemoryTag(). */
+void addTaggedMemory(uint tag, size_t size);
+
+/** Give back memory accounted before with addTaggedMemory(). */
+void removeTaggedMemory(uint tag, size_t size);
+
+/**
+ * malloc() whose blocks are accounted and listed like those of operator
+ * new. They must be freed with taggedFree(), so this only suits memory
+ * which never leaves its owner, like the storage of Array.
+ */
+void *taggedMalloc(size_t size);
+
+/** Free a block from taggedMalloc(). */
+void taggedFree(void *ptr);
+
+/** The accounting of every tag used so far, starting with the untagged memory. */
+Array<MemoryTagInfo> getMemoryTagInfo();
+
+/** The @p count largest live blocks from operator new and taggedMalloc(), largest first. */
+Array<MemoryAllocationInfo> getLargestAllocations(uint count);
+
+#define MEMORY_TAG_VARIABLE2(line) memoryTag##line
+#define MEMORY_TAG_VARIABLE(line) MEMORY_TAG_VARIABLE2(line)
+
+/** Tag the memory allocated in the enclosing scope with the given name. */
+#define MEMORY_TAG(name) Common::MemoryTag MEMORY_TAG_VARIABLE(__LINE__)(name)
+
+#else
+
+#define MEMORY_TAG(name) do {} while (false)
+
+inline void *taggedMalloc(size_t size) { return malloc(size); }
+inline void taggedFree(void *ptr) { free(ptr); }
+
+#endif
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
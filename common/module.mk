@@ -2,6 +2,7 @@ MODULE := common
 
 MODULE_OBJS := \
 	archive.o \
+	arena.o \
 	base64.o \
 	btea.o \
 	concatstream.o \
@@ -21,11 +22,13 @@ MODULE_OBJS := \
 	macresman.o \
 	memory.o \
 	memorypool.o \
+	memtag.o \
 	md5.o \
 	mutex.o \
 	osd_message_queue.o \
 	path.o \
 	platform.o \
+	profiler.o \
 	punycode.o \
 	random.o \
 	rational.o \
@@ -40,6 +43,7 @@ MODULE_OBJS := \
 	system.o \
 	textconsole.o \
 	text-to-speech.o \
+	threadpool.o \
 	tokenizer.o \
 	translation.o \
 	unicode-bidi.o \
@@ -59,5 +63,14 @@ MODULE_OBJS += \
 	updates.o
 endif
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	memory-neon.o
+endif
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	memory-sse2.o
+endif
+
 # Include common rules
 include $(srcdir)/rules.mk
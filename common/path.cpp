@@ -430,6 +430,7 @@ Path &Path::appendInPlace(const Path &x) {
 	if (x._str.empty()) {
 		return *this;
 	}
+	_hashIgnoreCase = 0;
 
 	if (_str.empty()) {
 		_str = x._str;
@@ -480,6 +481,7 @@ Path &Path::appendInPlace(const char *str, char separator) {
 	if (!*str) {
 		return *this;
 	}
+	_hashIgnoreCase = 0;
 	if (_str.empty()) {
 		set(str, separator);
 		return *this;
@@ -536,6 +538,7 @@ Path Path::appendComponent(const char *str) const {
 	if (isEscaped()) {
 		// We are escaped, escape str as well
 		Path ret(*this);
+		ret._hashIgnoreCase = 0;
 		if (addSeparator) {
 			ret._str += SEPARATOR;
 		}
@@ -556,6 +559,7 @@ Path Path::appendComponent(const char *str) const {
 	} else {
 		// No need to escape anything
 		Path ret(*this);
+		ret._hashIgnoreCase = 0;
 		if (addSeparator) {
 			ret._str += SEPARATOR;
 		}
@@ -568,6 +572,7 @@ Path &Path::joinInPlace(const Path &x) {
 	if (x.empty()) {
 		return *this;
 	}
+	_hashIgnoreCase = 0;
 	if (_str.empty()) {
 		_str = x._str;
 		return *this;
@@ -591,6 +596,7 @@ Path &Path::joinInPlace(const char *str, char separator) {
 	if (*str == '\0') {
 		return *this;
 	}
+	_hashIgnoreCase = 0;
 	if (_str.empty()) {
 		set(str, separator);
 		return *this;
@@ -604,6 +610,7 @@ Path &Path::joinInPlace(const char *str, char separator) {
 }
 
 Path &Path::removeTrailingSeparators() {
+	_hashIgnoreCase = 0;
 	while (_str.size() > 1 && _str.lastChar() == SEPARATOR) {
 		_str.deleteLastChar();
 	}
@@ -1058,7 +1065,10 @@ uint Path::hash() const {
 }
 
 uint Path::hashIgnoreCase() const {
-	return hashit_lower(_str);
+	if (!_hashIgnoreCase) {
+		_hashIgnoreCase = hashit_lower(_str);
+	}
+	return _hashIgnoreCase;
 }
 
 // This hash algorithm is inspired by a Python proposal to hash for tuples
@@ -1182,6 +1192,7 @@ String Path::toConfig() const {
 		// If we are escaped, we have forbidden characters which must be encoded
 		// Try to replace all : by SEPARATOR and check if we need puny encoding: if we don't, we are safe
 		Path tmp(*this);
+		tmp._hashIgnoreCase = 0;
 		tmp._str.replace(':', SEPARATOR);
 #if defined(RISCOS)
 		// RiscOS uses these characters everywhere
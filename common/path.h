@@ -70,6 +70,12 @@ private:
 
 	String _str;
 
+	/**
+	 * Cached result of hashIgnoreCase(), or 0 if it has not been computed yet.
+	 * Anything modifying _str in place must reset it.
+	 */
+	mutable uint _hashIgnoreCase;
+
 	/**
 	 * Escapes a path:
 	 * - all ESCAPE are encoded to ESCAPE ESCAPED_ESCAPE
@@ -234,10 +240,10 @@ public:
 	};
 
 	/** Construct a new empty path. */
-	Path() {}
+	Path() : _hashIgnoreCase(0) {}
 
 	/** Construct a copy of the given path. */
-	Path(const Path &path) : _str(path._str) { }
+	Path(const Path &path) : _str(path._str), _hashIgnoreCase(path._hashIgnoreCase) { }
 
 	/**
 	 * Construct a new path from the given NULL-terminated C string.
@@ -249,7 +255,7 @@ public:
 	 *                  Defaults to '/'.
 	 */
 	Path(const char *str, char separator = '/') :
-		_str(needsEncoding(str, separator) ? encode(str, separator) : str) { }
+		_str(needsEncoding(str, separator) ? encode(str, separator) : str), _hashIgnoreCase(0) { }
 
 	/**
 	 * Construct a new path from the given String.
@@ -261,7 +267,7 @@ public:
 	 *                  Defaults to '/'.
 	 */
 	explicit Path(const String &str, char separator = '/') :
-		_str(needsEncoding(str.c_str(), separator) ? encode(str.c_str(), separator) : str) { }
+		_str(needsEncoding(str.c_str(), separator) ? encode(str.c_str(), separator) : str), _hashIgnoreCase(0) { }
 
 	/**
 	 * Converts a path to a string using the given directory separator.
@@ -276,7 +282,10 @@ public:
 	/**
 	 * Clears the path object
 	 */
-	void clear() { _str.clear(); }
+	void clear() {
+		_str.clear();
+		_hashIgnoreCase = 0;
+	}
 
 	/**
 	 * Returns the Path for the parent directory of this path.
@@ -338,7 +347,8 @@ public:
 	 */
 	uint hash() const;
 	/**
-	 * Calculate a case insensitive hash of path
+	 * Calculate a case insensitive hash of path.
+	 * The result is cached, so repeated lookups with the same path are cheap.
 	 */
 	uint hashIgnoreCase() const;
 	/**
@@ -357,6 +367,7 @@ public:
 	/** Assign a given path to this path. */
 	Path &operator=(const Path &path) {
 		_str = path._str;
+		_hashIgnoreCase = path._hashIgnoreCase;
 		return *this;
 	}
 
@@ -373,6 +384,7 @@ public:
 	}
 
 	void set(const char *str, char separator = '/') {
+		_hashIgnoreCase = 0;
 		if (needsEncoding(str, separator)) {
 			_str = encode(str, separator);
 		} else {
@@ -509,6 +521,7 @@ public:
 	void toLowercase() {
 		// Escapism is not changed by changing case
 		_str.toLowercase();
+		_hashIgnoreCase = 0;
 	}
 
 	/**
@@ -520,6 +533,7 @@ public:
 	void toUppercase() {
 		// Escapism is not changed by changing case
 		_str.toUppercase();
+		_hashIgnoreCase = 0;
 	}
 
 	/**
@@ -0,0 +1,168 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "common/profiler.h"
+
+#ifdef USE_ZONE_PROFILER
+
+#include "common/file.h"
+#include "common/str.h"
+#include "common/system.h"
+
+#include <atomic>
+
+namespace Common {
+
+enum {
+	kProfileBufferSize = 1 << 14, ///< Zones kept per thread, a power of two
+	kMaxProfileThreads = 32
+};
+
+struct ProfileEvent {
+	const char *name;
+	uint64 start, end;
+};
+
+/** The zones of one thread, written by that thread only. */
+struct ProfileBuffer {
+	std::atomic<uint32> count; ///< Zones recorded so far, published after writing them
+	uint thread;
+	ProfileEvent events[kProfileBufferSize];
+};
+
+static std::atomic<bool> s_profilerEnabled(false);
+static std::atomic<ProfileBuffer *> s_profileBuffers[kMaxProfileThreads];
+static std::atomic<uint> s_numProfileBuffers(0);
+static uint64 s_profilerStartCycles;
+static uint32 s_profilerStartMillis;
+
+static thread_local ProfileBuffer *t_profileBuffer = nullptr;
+static thread_local bool t_profileBufferFailed = false;
+
+static ProfileBuffer *getProfileBuffer() {
+	if (t_profileBuffer || t_profileBufferFailed)
+		return t_profileBuffer;
+
+	uint index = s_numProfileBuffers.fetch_add(1);
+	if (index >= kMaxProfileThreads) {
+		t_profileBufferFailed = true;
+		return nullptr;
+	}
+
+	// Buffers are never freed, as threads may still be recording when
+	// the profiler stops
+	ProfileBuffer *buffer = new ProfileBuffer();
+	buffer->count.store(0, std::memory_order_relaxed);
+	buffer->thread = index;
+	s_profileBuffers[index].store(buffer, std::memory_order_release);
+
+	t_profileBuffer = buffer;
+	return buffer;
+}
+
+void recordProfileZone(const char *name, uint64 start, uint64 end) {
+	if (!s_profilerEnabled.load(std::memory_order_relaxed))
+		return;
+
+	ProfileBuffer *buffer = getProfileBuffer();
+	if (!buffer)
+		return;
+
+	uint32 count = buffer->count.load(std::memory_order_relaxed);
+	ProfileEvent &event = buffer->events[count & (kProfileBufferSize - 1)];
+	event.name = name;
+	event.start = start;
+	event.end = end;
+	buffer->count.store(count + 1, std::memory_order_release);
+}
+
+void startProfiler() {
+	s_profilerEnabled.store(false);
+
+	for (uint i = 0; i < kMaxProfileThreads; i++) {
+		ProfileBuffer *buffer = s_profileBuffers[i].load(std::memory_order_acquire);
+		if (buffer)
+			buffer->count.store(0, std::memory_order_relaxed);
+	}
+
+	s_profilerStartMillis = g_system->getMillis(true);
+	s_profilerStartCycles = getCycleCount();
+	s_profilerEnabled.store(true);
+}
+
+static String escapeJSON(const char *text) {
+	String result;
+	for (; *text; text++) {
+		if (*text == '"' || *text == '\\')
+			result += '\\';
+		result += *text;
+	}
+	return result;
+}
+
+bool stopProfiler(const Path &traceFile) {
+	s_profilerEnabled.store(false);
+
+	// The counter frequency is only known by comparing it with the clock
+	const uint64 cycles = getCycleCount() - s_profilerStartCycles;
+	const uint32 millis = MAX<uint32>(g_system->getMillis(true) - s_profilerStartMillis, 1);
+	double cyclesPerMicro = (double)cycles / (millis * 1000.0);
+	if (cyclesPerMicro <= 0.0)
+		cyclesPerMicro = 1.0;
+
+	DumpFile file;
+	if (!file.open(traceFile, true))
+		return false;
+
+	file.writeString("{\"traceEvents\":[\n");
+	bool first = true;
+
+	for (uint i = 0; i < kMaxProfileThreads; i++) {
+		ProfileBuffer *buffer = s_profileBuffers[i].load(std::memory_order_acquire);
+		if (!buffer)
+			continue;
+
+		const uint32 count = buffer->count.load(std::memory_order_acquire);
+		// A thread still running may be overwriting its oldest zones
+		const uint32 start = (count > kProfileBufferSize) ? count - kProfileBufferSize + kProfileBufferSize / 16 : 0;
+
+		for (uint32 j = start; j < count; j++) {
+			const ProfileEvent &event = buffer->events[j & (kProfileBufferSize - 1)];
+			if (event.start < s_profilerStartCycles || event.end < event.start)
+				continue;
+
+			const double ts = (event.start - s_profilerStartCycles) / cyclesPerMicro;
+			const double dur = (event.end - event.start) / cyclesPerMicro;
+			file.writeString(String::format("%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+			                                first ? "" : ",\n", escapeJSON(event.name).c_str(), buffer->thread, ts, dur));
+			first = false;
+		}
+	}
+
+	file.writeString("\n]}\n");
+	file.finalize();
+	return !file.err();
+}
+
+} // End of namespace Common
+
+#endif
@@ -0,0 +1,99 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef COMMON_PROFILER_H
+#define COMMON_PROFILER_H
+
+#include "common/scummsys.h"
+
+#ifdef USE_ZONE_PROFILER
+#include "common/cyclecounter.h"
+#endif
+
+namespace Common {
+
+/**
+ * @defgroup common_profiler Zone profiler
+ * @ingroup common
+ *
+ * @brief Timeline of named code zones, written as a Chrome trace.
+ *
+ * Code marks the zones to measure with PROFILE_ZONE("name"), which times
+ * its enclosing scope. Without the zone profiler, enabled by configure
+ * with --enable-zone-profiler, the macro compiles to nothing.
+ *
+ * Recording starts with startProfiler() and stopProfiler() writes what
+ * was recorded in the Chrome trace_event format, which chrome://tracing
+ * and Perfetto open. Every thread records into its own ring buffer, which
+ * keeps the latest zones of that thread.
+ *
+ * @{
+ */
+
+#ifdef USE_ZONE_PROFILER
+
+class Path;
+
+/** Record a zone of the current thread which ran between two values of getCycleCount(). */
+void recordProfileZone(const char *name, uint64 start, uint64 end);
+
+/**
+ * Times the scope it lives in, see PROFILE_ZONE().
+ */
+class ProfileScope {
+public:
+	/** @param name Name of the zone, which must stay valid, e.g. a string literal. */
+	explicit ProfileScope(const char *name) : _name(name), _start(getCycleCount()) {}
+	~ProfileScope() { recordProfileZone(_name, _start, getCycleCount()); }
+
+private:
+	const char *_name;
+	uint64 _start;
+};
+
+/** Start recording zones, dropping any recorded before. */
+void startProfiler();
+
+/**
+ * Stop recording zones and write them to a file.
+ *
+ * @return false if the file could not be written.
+ */
+bool stopProfiler(const Path &traceFile);
+
+#define PROFILE_ZONE_VARIABLE2(line) profileZone##line
+#define PROFILE_ZONE_VARIABLE(line) PROFILE_ZONE_VARIABLE2(line)
+
+/** Time the enclosing scope as a zone with the given name. */
+#define PROFILE_ZONE(name) Common::ProfileScope PROFILE_ZONE_VARIABLE(__LINE__)(name)
+
+#else
+
+#define PROFILE_ZONE(name) do {} while (false)
+
+#endif
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
@@ -276,6 +276,20 @@ public:
 	 * @return true if the file exists. false otherwise.
 	 */
 	virtual bool exists(const String &name) = 0;
+
+	/**
+	 * Get the size and modification time of a savefile, for telling
+	 * whether it changed since information about it was remembered.
+	 * Savefiles written during this run have no stamp, since the
+	 * modification time may be too coarse to tell the writes apart.
+	 *
+	 * @param name      Name of the save file.
+	 * @param size      The size of the file.
+	 * @param modified  The modification time, see FSNode::getFileStamp().
+	 *
+	 * @return true if the stamp is known, false otherwise.
+	 */
+	virtual bool getSavefileStamp(const String &name, int64 &size, int64 &modified) { return false; }
 };
 
 /** @} */
@@ -22,8 +22,10 @@
 #ifndef COMMON_SERIALIZER_H
 #define COMMON_SERIALIZER_H
 
+#include "common/endian.h"
 #include "common/stream.h"
 #include "common/str.h"
+#include "common/util.h"
 
 namespace Common {
 
@@ -52,6 +54,36 @@ namespace Common {
 		_bytesSynced += SIZE; \
 	}
 
+#define SYNC_ARRAY_AS(SUFFIX,TYPE,SIZE,NATIVE,READ,WRITE) \
+	template<typename T> \
+	void syncArrayAs ## SUFFIX(T *arr, size_t entries, Version minVersion = 0, Version maxVersion = kLastVersion) { \
+		if (_version < minVersion || _version > maxVersion) \
+			return; \
+		_bytesSynced += entries * SIZE; \
+		if (NATIVE && sizeof(T) == SIZE) { \
+			if (_loadStream) \
+				_loadStream->read(arr, entries * SIZE); \
+			else \
+				_saveStream->write(arr, entries * SIZE); \
+			return; \
+		} \
+		byte buf[kArrayChunkSize * SIZE]; \
+		while (entries) { \
+			const size_t count = MIN<size_t>(entries, kArrayChunkSize); \
+			if (_loadStream) { \
+				_loadStream->read(buf, count * SIZE); \
+				for (size_t i = 0; i < count; ++i) \
+					arr[i] = static_cast<T>(READ(buf + i * SIZE)); \
+			} else { \
+				for (size_t i = 0; i < count; ++i) \
+					WRITE(buf + i * SIZE, static_cast<TYPE>(arr[i])); \
+				_saveStream->write(buf, count * SIZE); \
+			} \
+			arr += count; \
+			entries -= count; \
+		} \
+	}
+
 #define SYNC_PRIMITIVE(suffix) \
 	template <typename T> \
 	static inline void suffix(Serializer &s, T &value) { \
@@ -69,10 +101,7 @@ namespace Common {
  *
  * @todo Maybe rename this to Synchronizer?
  *
- * @todo One feature the SCUMM code has but that is missing here: Support for
- *       syncing arrays of a given type and *fixed* size; and also support
- *       for when the array size changed between versions. Also, support for
- *       2D-arrays.
+ * @todo Support for 2D-arrays.
  *
  * @todo Proper error handling!
  */
@@ -97,6 +126,18 @@ public:
 	SYNC_PRIMITIVE(SByte)
 
 protected:
+	/** Number of elements converted at once by the syncArrayAs methods. */
+	static const size_t kArrayChunkSize = 256;
+
+#ifdef SCUMM_LITTLE_ENDIAN
+	static const bool kNativeLE = true;
+#else
+	static const bool kNativeLE = false;
+#endif
+
+	static inline byte loadByte(const byte *ptr) { return *ptr; }
+	static inline void storeByte(byte *ptr, byte value) { *ptr = value; }
+
 	SeekableReadStream *_loadStream;
 	WriteStream *_saveStream;
 
@@ -132,6 +173,30 @@ public:
 	SYNC_AS(DoubleLE, double, 8)
 	SYNC_AS(DoubleBE, double, 8)
 
+	/**
+	 * @name Array sync methods
+	 * @brief Sync an array of integers, producing the same data as calling
+	 *        the matching syncAs method on every element.
+	 *
+	 * Arrays whose element type has the size and byte order of the stored
+	 * data are read or written in one go. Other arrays are converted in
+	 * chunks. Only use them on integer or enum types.
+	 * @{
+	 */
+	SYNC_ARRAY_AS(Byte, byte, 1, true, loadByte, storeByte)
+	SYNC_ARRAY_AS(SByte, int8, 1, true, (int8)loadByte, storeByte)
+
+	SYNC_ARRAY_AS(Uint16LE, uint16, 2, kNativeLE, READ_LE_UINT16, WRITE_LE_UINT16)
+	SYNC_ARRAY_AS(Uint16BE, uint16, 2, !kNativeLE, READ_BE_UINT16, WRITE_BE_UINT16)
+	SYNC_ARRAY_AS(Sint16LE, int16, 2, kNativeLE, READ_LE_INT16, WRITE_LE_INT16)
+	SYNC_ARRAY_AS(Sint16BE, int16, 2, !kNativeLE, READ_BE_INT16, WRITE_BE_INT16)
+
+	SYNC_ARRAY_AS(Uint32LE, uint32, 4, kNativeLE, READ_LE_UINT32, WRITE_LE_UINT32)
+	SYNC_ARRAY_AS(Uint32BE, uint32, 4, !kNativeLE, READ_BE_UINT32, WRITE_BE_UINT32)
+	SYNC_ARRAY_AS(Sint32LE, int32, 4, kNativeLE, READ_LE_INT32, WRITE_LE_INT32)
+	SYNC_ARRAY_AS(Sint32BE, int32, 4, !kNativeLE, READ_BE_INT32, WRITE_BE_INT32)
+	/** @} */
+
 	/**
 	 * Returns true if an I/O failure occurred.
 	 * This flag is never cleared automatically. In order to clear it,
@@ -300,6 +365,7 @@ public:
 };
 
 #undef SYNC_PRIMITIVE
+#undef SYNC_ARRAY_AS
 #undef SYNC_AS
 
 
@@ -291,6 +291,14 @@ public:
 	/** Appends a string containing the characters between beginP (including) and endP (excluding). */
 	void append(const value_type *begin, const value_type *end);
 
+	/**
+	 * Make room for at least @p size characters, so that appending up to
+	 * that length does not reallocate. This also unshares the storage.
+	 */
+	void reserve(uint32 size) {
+		ensureCapacity(size, true);
+	}
+
 	/**
 	 * Wraps the text in the string to the given line maximum. Lines will be
 	 * broken at any whitespace character. New lines are assumed to be
@@ -0,0 +1,115 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef COMMON_STR_BUILDER_H
+#define COMMON_STR_BUILDER_H
+
+#include "common/str.h"
+#include "common/ustr.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_str_builder String builder
+ * @ingroup common_str
+ *
+ * @brief Helper to build long strings piece by piece.
+ * @{
+ */
+
+/**
+ * Builds a string out of many small pieces.
+ *
+ * Appending grows the buffer geometrically and never shares it, so it is
+ * not copied again once it is big enough. Reserving the expected length
+ * upfront avoids even that. finish() hands the buffer over to the
+ * resulting string without copying it.
+ *
+ * @code
+ * Common::StringBuilder builder(256);
+ * for (uint i = 0; i < lines.size(); ++i)
+ *     builder.append(lines[i]).append('\n');
+ * Common::String text = builder.finish();
+ * @endcode
+ */
+template<class StringType>
+class BaseStringBuilder {
+public:
+	typedef typename StringType::value_type value_type;
+
+	explicit BaseStringBuilder(uint32 capacity = 0) {
+		if (capacity)
+			_str.reserve(capacity);
+	}
+
+	BaseStringBuilder &append(const StringType &str) {
+		_str += str;
+		return *this;
+	}
+
+	BaseStringBuilder &append(const value_type *str) {
+		_str += str;
+		return *this;
+	}
+
+	BaseStringBuilder &append(const value_type *str, uint32 len) {
+		_str.append(str, str + len);
+		return *this;
+	}
+
+	BaseStringBuilder &append(value_type c) {
+		_str += c;
+		return *this;
+	}
+
+	template<class T>
+	BaseStringBuilder &operator+=(const T &x) {
+		return append(x);
+	}
+
+	/** Make room for at least @p capacity characters in total. */
+	void reserve(uint32 capacity) { _str.reserve(capacity); }
+
+	uint32 size() const { return _str.size(); }
+	bool empty() const { return _str.empty(); }
+	void clear() { _str.clear(); }
+
+	/** Access the string built so far. */
+	const value_type *c_str() const { return _str.c_str(); }
+
+	/**
+	 * Return the finished string. The builder is left empty and can be
+	 * reused.
+	 */
+	StringType finish() { return Common::move(_str); }
+
+private:
+	StringType _str;
+};
+
+typedef BaseStringBuilder<String> StringBuilder;
+typedef BaseStringBuilder<U32String> U32StringBuilder;
+
+/** @} */
+
+} // End of namespace Common
+
+#endif
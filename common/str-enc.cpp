@@ -30,6 +30,75 @@
 
 namespace Common {
 
+/**
+ * Count the leading bytes below 0x80, a machine word at a time.
+ */
+static inline uint32 countASCIIRun(const char *src, uint32 len) {
+	uint32 i = 0;
+	for (; i + 8 <= len; i += 8) {
+		uint32 lo = READ_UINT32(src + i);
+		uint32 hi = READ_UINT32(src + i + 4);
+		if ((lo | hi) & 0x80808080)
+			break;
+	}
+
+	while (i < len && (src[i] & 0x80) == 0)
+		i++;
+
+	return i;
+}
+
+/**
+ * Count the leading code points below 0x80. When nonZero is set, the run
+ * also stops at the first null code point.
+ */
+static inline uint32 countASCIIRun(const U32String::value_type *src, uint32 len, bool nonZero) {
+	uint32 i = 0;
+	for (; i + 4 <= len; i += 4) {
+		if ((src[i] | src[i + 1] | src[i + 2] | src[i + 3]) >= 0x80)
+			break;
+		if (nonZero && (!src[i] || !src[i + 1] || !src[i + 2] || !src[i + 3]))
+			break;
+	}
+
+	while (i < len && src[i] < 0x80 && (!nonZero || src[i]))
+		i++;
+
+	return i;
+}
+
+uint32 U32String::decodeASCIIRun(const char *src, uint32 len) {
+	uint32 count = countASCIIRun(src, len);
+	if (count == 0)
+		return 0;
+
+	ensureCapacity(_size + count, true);
+
+	value_type *dst = _str + _size;
+	for (uint32 i = 0; i < count; i++)
+		dst[i] = (uint8)src[i];
+
+	_size += count;
+	_str[_size] = 0;
+	return count;
+}
+
+uint32 String::encodeASCIIRun(const U32String::value_type *src, uint32 len) {
+	uint32 count = countASCIIRun(src, len, false);
+	if (count == 0)
+		return 0;
+
+	ensureCapacity(_size + count, true);
+
+	char *dst = _str + _size;
+	for (uint32 i = 0; i < count; i++)
+		dst[i] = (char)src[i];
+
+	_size += count;
+	_str[_size] = 0;
+	return count;
+}
+
 // //TODO: This is a quick and dirty converter. Refactoring needed:
 // 1. Original version has an option for performing strict / nonstrict
 //    conversion for the 0xD800...0xDFFF interval
@@ -38,14 +107,28 @@ namespace Common {
 //
 // More comprehensive one lives in wintermute/utils/convert_utf.cpp
 void U32String::decodeUTF8(const char *src, uint32 len) {
-	ensureCapacity(len, false);
-
 	// The String class, and therefore the Font class as well, assume one
 	// character is one byte, but in this case it's actually an UTF-8
 	// string with up to 4 bytes per character. To work around this,
 	// convert it to an U32String before drawing it, because our Font class
 	// can handle that.
+
+	// There are never more characters than bytes, so the characters are
+	// written straight into the storage.
+	ensureCapacity(_size + len, true);
+	value_type *dst = _str + _size;
+
 	for (uint i = 0; i < len;) {
+		// Widen runs of plain ASCII in bulk
+		uint32 run = countASCIIRun(src + i, len - i);
+		for (uint32 j = 0; j < run; j++)
+			dst[j] = (uint8)src[i + j];
+		dst += run;
+		i += run;
+
+		if (i >= len)
+			break;
+
 		uint32 chr = 0;
 		uint num = 1;
 
@@ -85,8 +168,11 @@ void U32String::decodeUTF8(const char *src, uint32 len) {
 			break;
 		}
 
-		operator+=(chr);
+		*dst++ = chr;
 	}
+
+	_size = dst - _str;
+	_str[_size] = 0;
 }
 
 const uint16 invalidCode = 0xFFFD;
@@ -208,6 +294,11 @@ void U32String::decodeWindows932(const char *src, uint32 len) {
 		loadCJKTables();
 
 	for (uint i = 0; i < len;) {
+		// Copy runs of plain ASCII in bulk
+		i += decodeASCIIRun(src + i, len - i);
+		if (i >= len)
+			break;
+
 		uint8 high = src[i++];
 
 		if ((high & 0x80) == 0x00) {
@@ -265,6 +356,11 @@ void U32String::decodeWindows936(const char *src, uint32 len) {
 		loadCJKTables();
 
 	for (uint i = 0; i < len;) {
+		// Copy runs of plain ASCII in bulk
+		i += decodeASCIIRun(src + i, len - i);
+		if (i >= len)
+			break;
+
 		uint8 high = src[i++];
 
 		if ((high & 0x80) == 0x00) {
@@ -332,6 +428,11 @@ void U32String::decodeWindows949(const char *src, uint32 len) {
 		loadCJKTables();
 
 	for (uint i = 0; i < len;) {
+		// Copy runs of plain ASCII in bulk
+		i += decodeASCIIRun(src + i, len - i);
+		if (i >= len)
+			break;
+
 		uint8 high = src[i++];
 
 		if ((high & 0x80) == 0x00) {
@@ -363,6 +464,11 @@ void U32String::decodeWindows950(const char *src, uint32 len) {
 		loadCJKTables();
 
 	for (uint i = 0; i < len;) {
+		// Copy runs of plain ASCII in bulk
+		i += decodeASCIIRun(src + i, len - i);
+		if (i >= len)
+			break;
+
 		uint8 high = src[i++];
 
 		if ((high & 0x80) == 0x00) {
@@ -440,6 +546,11 @@ void U32String::decodeJohab(const char *src, uint32 len) {
 		loadCJKTables();
 
 	for (uint i = 0; i < len;) {
+		// Copy runs of plain ASCII in bulk
+		i += decodeASCIIRun(src + i, len - i);
+		if (i >= len)
+			break;
+
 		uint8 high = src[i++];
 
 		if ((high & 0x80) == 0x00) {
@@ -497,6 +608,11 @@ StringEncodingResult String::encodeWindows932(const U32String &src, char errorCh
 	}
 
 	for (uint i = 0; i < src.size();) {
+		// Copy runs of plain ASCII in bulk
+		i += encodeASCIIRun(src.c_str() + i, src.size() - i);
+		if (i >= src.size())
+			break;
+
 		uint32 point = src[i++];
 
 		if (point < 0x80) {
@@ -564,6 +680,11 @@ StringEncodingResult String::encodeWindows936(const U32String &src, char errorCh
 	}
 
 	for (uint i = 0; i < src.size();) {
+		// Copy runs of plain ASCII in bulk
+		i += encodeASCIIRun(src.c_str() + i, src.size() - i);
+		if (i >= src.size())
+			break;
+
 		uint32 point = src[i++];
 
 		if (point < 0x80) {
@@ -632,6 +753,11 @@ StringEncodingResult String::encodeWindows949(const U32String &src, char errorCh
 	}
 
 	for (uint i = 0; i < src.size();) {
+		// Copy runs of plain ASCII in bulk
+		i += encodeASCIIRun(src.c_str() + i, src.size() - i);
+		if (i >= src.size())
+			break;
+
 		uint32 point = src[i++];
 
 		if (point < 0x80) {
@@ -724,6 +850,11 @@ StringEncodingResult String::encodeWindows950(const U32String &src, bool transli
 	}
 
 	for (uint i = 0; i < src.size();) {
+		// Copy runs of plain ASCII in bulk
+		i += encodeASCIIRun(src.c_str() + i, src.size() - i);
+		if (i >= src.size())
+			break;
+
 		uint32 point = src[i++];
 
 		if (point < 0x80) {
@@ -826,6 +957,11 @@ StringEncodingResult String::encodeJohab(const U32String &src, char errorChar) {
 	}
 
 	for (uint i = 0; i < src.size();) {
+		// Copy runs of plain ASCII in bulk
+		i += encodeASCIIRun(src.c_str() + i, src.size() - i);
+		if (i >= src.size())
+			break;
+
 		uint32 point = src[i++];
 
 		if (point < 0x80) {
@@ -861,18 +997,50 @@ StringEncodingResult String::encodeJohab(const U32String &src, char errorChar) {
 //
 // More comprehensive one lives in wintermute/utils/convert_utf.cpp
 StringEncodingResult String::encodeUTF8(const U32String &src, char errorChar) {
-	ensureCapacity(src.size(), false);
 	static const uint8 firstByteMark[5] = { 0x00, 0x00, 0xC0, 0xE0, 0xF0 };
-	char writingBytes[5] = {0x00, 0x00, 0x00, 0x00, 0x00};
+	const U32String::value_type *chars = src.c_str();
+	const uint32 count = src.size();
+
+	// Size the output first, so that it can be written straight into the
+	// storage. Null characters produce no output.
+	uint32 outSize = 0;
+	for (uint32 i = 0; i < count; i++) {
+		uint32 ch = chars[i];
+		if (ch == 0)
+			continue;
+		else if (ch < 0x80)
+			outSize += 1;
+		else if (ch < 0x800)
+			outSize += 2;
+		else if (ch < 0x10000 || ch > 0x0010FFFF)
+			outSize += 3;
+		else
+			outSize += 4;
+	}
+
+	ensureCapacity(_size + outSize, true);
+	char *dst = _str + _size;
+
+	uint32 i = 0;
+	while (i < count) {
+		// Narrow runs of plain ASCII in bulk
+		uint32 run = countASCIIRun(chars + i, count - i, true);
+		for (uint32 j = 0; j < run; j++)
+			dst[j] = (char)chars[i + j];
+		dst += run;
+		i += run;
+
+		if (i >= count)
+			break;
 
-	uint i = 0;
-	while (i < src.size()) {
 		unsigned short bytesToWrite = 0;
 		const uint32 byteMask = 0xBF;
 		const uint32 byteMark = 0x80;
 
-		uint32 ch = src[i++];
-		if (ch < (uint32)0x80) {
+		uint32 ch = chars[i++];
+		if (ch == 0) {
+			continue;
+		} else if (ch < (uint32)0x80) {
 			bytesToWrite = 1;
 		} else if (ch < (uint32)0x800) {
 			bytesToWrite = 2;
@@ -885,31 +1053,32 @@ StringEncodingResult String::encodeUTF8(const U32String &src, char errorChar) {
 			ch = invalidCode;
 		}
 
-		char *pBytes = writingBytes + (4 - bytesToWrite);
-
 		switch (bytesToWrite) {
 		case 4:
-			pBytes[3] = (char)((ch | byteMark) & byteMask);
+			dst[3] = (char)((ch | byteMark) & byteMask);
 			ch >>= 6;
 			// fallthrough
 		case 3:
-			pBytes[2] = (char)((ch | byteMark) & byteMask);
+			dst[2] = (char)((ch | byteMark) & byteMask);
 			ch >>= 6;
 			// fallthrough
 		case 2:
-			pBytes[1] = (char)((ch | byteMark) & byteMask);
+			dst[1] = (char)((ch | byteMark) & byteMask);
 			ch >>= 6;
 			// fallthrough
 		case 1:
-			pBytes[0] = (char)(ch | firstByteMark[bytesToWrite]);
+			dst[0] = (char)(ch | firstByteMark[bytesToWrite]);
 			break;
 		default:
 			break;
 		}
 
-		operator+=(pBytes);
+		dst += bytesToWrite;
 	}
 
+	_size = dst - _str;
+	_str[_size] = 0;
+
 	return kStringEncodingResultSucceeded;
 }
 
@@ -1073,17 +1242,28 @@ void U32String::decodeOneByte(const char *src, uint32 len, CodePage page) {
 		conversionTable = kASCIIConversionTable;
 	}
 
-	ensureCapacity(len, false);
+	// Every byte is one character, so the characters are written straight
+	// into the storage
+	ensureCapacity(_size + len, true);
+	value_type *dst = _str + _size;
 
-	for (uint i = 0; i < len; ++i) {
-		if ((src[i] & 0x80) == 0) {
-			operator+=(src[i]);
-			continue;
+	for (uint i = 0; i < len;) {
+		// Widen runs of plain ASCII in bulk
+		uint32 run = countASCIIRun(src + i, len - i);
+		for (uint32 j = 0; j < run; j++)
+			dst[j] = (uint8)src[i + j];
+		dst += run;
+		i += run;
+
+		// Then look up the high half of the codepage
+		for (; i < len && (src[i] & 0x80); i++) {
+			uint16 val = conversionTable[src[i] & 0x7f];
+			*dst++ = val ? val : invalidCode;
 		}
-
-		uint16 val = conversionTable[src[i] & 0x7f];
-		operator+=(val ? val : invalidCode);
 	}
+
+	_size = dst - _str;
+	_str[_size] = 0;
 }
 
 StringEncodingResult String::encodeOneByte(const U32String &src, CodePage page, bool transliterate, char errorChar) {
@@ -1096,11 +1276,11 @@ StringEncodingResult String::encodeOneByte(const U32String &src, CodePage page,
 
 	if (conversionTable == nullptr) {
 		for (uint i = 0; i < src.size(); ++i) {
+			i += encodeASCIIRun(src.c_str() + i, src.size() - i);
+			if (i >= src.size())
+				break;
+
 			uint32 c = src[i];
-			if (c <= 0x7F) {
-				operator+=((char)c);
-				continue;
-			}
 
 			if (transliterate) {
 				StringEncodingResult translitResult = translitChar(c, errorChar);
@@ -1115,12 +1295,11 @@ StringEncodingResult String::encodeOneByte(const U32String &src, CodePage page,
 	}
 
 	for (uint i = 0; i < src.size(); ++i) {
-		uint32 c = src[i];
-		if (c <= 0x7F) {
-			operator+=((char)c);
-			continue;
-		}
+		i += encodeASCIIRun(src.c_str() + i, src.size() - i);
+		if (i >= src.size())
+			break;
 
+		uint32 c = src[i];
 		if (c >= kMaxCharSingleByte)
 			continue;
 		ReverseTablePrefixTreeLevel2 *l2 = conversionTable->next[c>>8];
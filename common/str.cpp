@@ -331,6 +331,21 @@ String operator+(const String &x, char y) {
 	return temp;
 }
 
+String operator+(String &&x, const String &y) {
+	x += y;
+	return Common::move(x);
+}
+
+String operator+(String &&x, const char *y) {
+	x += y;
+	return Common::move(x);
+}
+
+String operator+(String &&x, char y) {
+	x += y;
+	return Common::move(x);
+}
+
 #ifndef SCUMMVM_UTIL
 
 char *ltrim(char *t) {
@@ -180,6 +180,7 @@ protected:
 	StringEncodingResult encodeOneByte(const U32String &src, CodePage page, bool translit, char errorChar);
 	StringEncodingResult encodeInternal(const U32String &src, CodePage page, char errorChar);
 	StringEncodingResult translitChar(U32String::value_type point, char errorChar);
+	uint32 encodeASCIIRun(const U32String::value_type *src, uint32 len);
 
 	friend class U32String;
 };
@@ -193,6 +194,12 @@ String operator+(const String &x, const char *y);
 String operator+(const String &x, char y);
 String operator+(char x, const String &y);
 
+// Appending to a temporary reuses its storage, so chains like a + b + c
+// only grow one buffer
+String operator+(String &&x, const String &y);
+String operator+(String &&x, const char *y);
+String operator+(String &&x, char y);
+
 // Some useful additional comparison operators for Strings
 bool operator==(const char *x, const String &y);
 bool operator!=(const char *x, const String &y);
@@ -23,6 +23,7 @@
 #define COMMON_STREAM_H
 
 #include "common/endian.h"
+#include "common/memory.h"
 #include "common/ptr.h"
 #include "common/scummsys.h"
 #include "common/str.h"
@@ -661,6 +662,60 @@ public:
 		return READ_BE_FLOAT64(val);
 	}
 
+	/**
+	 * @name Bulk read functions
+	 *
+	 * Read @p count values of the given type and byte order into @p dst.
+	 *
+	 * This reads all the data at once and converts it in place, which is
+	 * much faster than calling e.g. readUint16LE() for each value.
+	 *
+	 * @return The number of values actually read. It is smaller than
+	 *         @p count in case of a read error or the end of the stream,
+	 *         which can be checked by calling err() and eos().
+	 * @{
+	 */
+	uint32 readUint16LEArray(uint16 *dst, uint32 count) {
+		count = read(dst, count * 2) / 2;
+		convertLE16(dst, count);
+		return count;
+	}
+
+	uint32 readUint16BEArray(uint16 *dst, uint32 count) {
+		count = read(dst, count * 2) / 2;
+		convertBE16(dst, count);
+		return count;
+	}
+
+	uint32 readUint32LEArray(uint32 *dst, uint32 count) {
+		count = read(dst, count * 4) / 4;
+		convertLE32(dst, count);
+		return count;
+	}
+
+	uint32 readUint32BEArray(uint32 *dst, uint32 count) {
+		count = read(dst, count * 4) / 4;
+		convertBE32(dst, count);
+		return count;
+	}
+
+	FORCEINLINE uint32 readSint16LEArray(int16 *dst, uint32 count) {
+		return readUint16LEArray((uint16 *)dst, count);
+	}
+
+	FORCEINLINE uint32 readSint16BEArray(int16 *dst, uint32 count) {
+		return readUint16BEArray((uint16 *)dst, count);
+	}
+
+	FORCEINLINE uint32 readSint32LEArray(int32 *dst, uint32 count) {
+		return readUint32LEArray((uint32 *)dst, count);
+	}
+
+	FORCEINLINE uint32 readSint32BEArray(int32 *dst, uint32 count) {
+		return readUint32BEArray((uint32 *)dst, count);
+	}
+	/** @} */
+
 	/**
 	 * Read multiple values from the stream using a specified data format,
 	 * return true on success and false on failure.
@@ -250,6 +250,13 @@ Common::String OSystem::getSystemLanguage() const {
 	return "en_US";
 }
 
+bool OSystem::waitForEventOrDeadline(uint32 deadline) {
+	const int32 remaining = (int32)(deadline - getMillis());
+	if (remaining > 0)
+		delayMillis(remaining);
+	return false;
+}
+
 bool OSystem::isConnectionLimited() {
 	warning("OSystem::isConnectionLimited(): not limited by default");
 	return false;
@@ -41,6 +41,7 @@ class Mixer;
 
 namespace Graphics {
 struct Surface;
+struct YUVSurface;
 }
 
 namespace GUI {
@@ -55,6 +56,7 @@ class Store;
 namespace Common {
 class EventManager;
 class MutexInternal;
+class ThreadPoolInternal;
 struct Rect;
 class SaveFileManager;
 class SearchSet;
@@ -1235,6 +1237,24 @@ public:
 	 */
 	virtual void copyRectToScreen(const void *buf, int pitch, int x, int y, int w, int h) = 0;
 
+	/**
+	 * Convert a planar YUV image and blit it to the virtual screen, like
+	 * copyRectToScreen() does with an image in the screen format.
+	 *
+	 * This lets backends that draw the screen on the GPU do the conversion
+	 * there. The others return false, and the caller has to convert the
+	 * image itself. Graphics::copyYUVToScreen() does either.
+	 *
+	 * @param src  The planes of the image.
+	 * @param x    x coordinate of the destination rectangle.
+	 * @param y    y coordinate of the destination rectangle.
+	 *
+	 * @return True if the backend did the blit.
+	 *
+	 * @see copyRectToScreen
+	 */
+	virtual bool copyYUVRectToScreen(const Graphics::YUVSurface &src, int x, int y) { return false; }
+
 	/**
 	 * Lock the active screen framebuffer and return a Graphics::Surface
 	 * representing it.
@@ -1534,6 +1554,23 @@ public:
 	/** Delay/sleep for the specified amount of milliseconds. */
 	virtual void delayMillis(uint msecs) = 0;
 
+	/**
+	 * Sleep until an input event is available or the deadline passes,
+	 * whichever comes first.
+	 *
+	 * The event is not removed, pollEvent() returns it. Client code
+	 * should use EventManager::waitForEventOrDeadline(), which also
+	 * knows about the events queued by the event manager.
+	 *
+	 * The default implementation sleeps until the deadline with
+	 * delayMillis().
+	 *
+	 * @param deadline  Time to wake up at the latest, in getMillis() time.
+	 *
+	 * @return True if woken up early because an event may be available.
+	 */
+	virtual bool waitForEventOrDeadline(uint32 deadline);
+
 	/**
 	 * Get the current time and date, in the local timezone.
 	 *
@@ -1616,6 +1653,17 @@ public:
 	 */
 	virtual Common::MutexInternal *createMutex() = 0;
 
+	/**
+	 * Create the worker threads backing Common::ThreadPool.
+	 *
+	 * The default implementation returns 0, in which case all jobs are
+	 * run on the calling thread.
+	 *
+	 * @return The newly created thread pool, or 0 if the backend does not
+	 *         offer worker threads.
+	 */
+	virtual Common::ThreadPoolInternal *createThreadPool() { return nullptr; }
+
 	/** @} */
 
 
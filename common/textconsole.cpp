@@ -22,6 +22,7 @@
 #define FORBIDDEN_SYMBOL_EXCEPTION_exit
 
 #include "common/textconsole.h"
+#include "common/debug.h"
 #include "common/system.h"
 #include "common/str.h"
 
@@ -84,6 +85,9 @@ void NORETURN_PRE error(const char *s, ...) {
 	char buf_output[STRINGBUFLEN];
 	va_list va;
 
+	// Print what led to the error first
+	flushDeferredDebug();
+
 	// Generate the full error message
 	va_start(va, s);
 	vsnprintf(buf_input, STRINGBUFLEN, s, va);
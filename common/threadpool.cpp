@@ -0,0 +1,58 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "common/threadpool.h"
+#include "common/system.h"
+
+namespace Common {
+
+DECLARE_SINGLETON(ThreadPool);
+
+ThreadPool::ThreadPool() : _busy(false) {
+	assert(g_system);
+	_internal = g_system->createThreadPool();
+}
+
+ThreadPool::ThreadPool(ThreadPoolInternal *internal) : _internal(internal), _busy(false) {
+}
+
+ThreadPool::~ThreadPool() {
+	delete _internal;
+}
+
+uint ThreadPool::getNumThreads() const {
+	return _internal ? _internal->getNumThreads() : 1;
+}
+
+void ThreadPool::run(Job *const *jobs, uint count) {
+	if (!_internal || _busy || count <= 1) {
+		for (uint i = 0; i < count; i++)
+			jobs[i]->run();
+		return;
+	}
+
+	_busy = true;
+	_internal->run(jobs, count);
+	_busy = false;
+}
+
+} // End of namespace Common
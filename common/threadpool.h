@@ -0,0 +1,150 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#ifndef COMMON_THREADPOOL_H
+#define COMMON_THREADPOOL_H
+
+#include "common/array.h"
+#include "common/singleton.h"
+#include "common/util.h"
+
+namespace Common {
+
+/**
+ * @defgroup common_threadpool Thread pool
+ * @ingroup common
+ *
+ * @brief API for running work on the worker threads of the backend.
+ * @{
+ */
+
+/**
+ * A piece of work handed to a ThreadPool.
+ */
+class Job {
+public:
+	virtual ~Job() {}
+
+	virtual void run() = 0;
+};
+
+/**
+ * The backend side of a ThreadPool, see OSystem::createThreadPool().
+ */
+class ThreadPoolInternal {
+public:
+	virtual ~ThreadPoolInternal() {}
+
+	/** Number of threads running jobs, including the calling thread. */
+	virtual uint getNumThreads() const = 0;
+
+	/**
+	 * Run all jobs, spread over the threads in any order. Returns once
+	 * every job is done.
+	 */
+	virtual void run(Job *const *jobs, uint count) = 0;
+};
+
+/**
+ * Shared pool of worker threads, so that engines and the libraries use the
+ * CPU cores without each starting their own threads.
+ *
+ * The work is always split and joined within one call: the calling thread
+ * helps running the jobs and the call returns when all of them are done.
+ * On backends without threads everything simply runs on the calling thread.
+ *
+ * The pool may only be used from the main thread. Jobs using the pool
+ * themselves run their work inline.
+ */
+class ThreadPool : public Singleton<ThreadPool> {
+public:
+	/** Use the worker threads of the backend. */
+	ThreadPool();
+	/** Use the given worker threads, taking ownership of them; null runs everything inline. */
+	explicit ThreadPool(ThreadPoolInternal *internal);
+	~ThreadPool();
+
+	/** Number of threads running jobs, including the calling thread. */
+	uint getNumThreads() const;
+
+	/** Run all jobs and return once every one of them is done. */
+	void run(Job *const *jobs, uint count);
+
+	/**
+	 * Call func(first, last) on consecutive ranges covering [begin, end),
+	 * in parallel where possible. Ranges hold at least minChunk indices
+	 * unless the whole range is smaller.
+	 */
+	template<class F>
+	void parallelFor(uint begin, uint end, F func, uint minChunk = 1) {
+		if (begin >= end)
+			return;
+
+		const uint size = end - begin;
+		const uint chunks = MIN<uint>(getNumThreads(), size / MAX<uint>(minChunk, 1));
+		if (chunks <= 1 || _busy) {
+			func(begin, end);
+			return;
+		}
+
+		Array<RangeJob<F> > jobs;
+		Array<Job *> jobPtrs;
+		jobs.reserve(chunks);
+		jobPtrs.reserve(chunks);
+
+		uint first = begin;
+		for (uint i = 0; i < chunks; i++) {
+			uint last = begin + (uint)((uint64)size * (i + 1) / chunks);
+			jobs.push_back(RangeJob<F>(func, first, last));
+			first = last;
+		}
+		for (uint i = 0; i < chunks; i++)
+			jobPtrs.push_back(&jobs[i]);
+
+		run(jobPtrs.data(), chunks);
+	}
+
+private:
+	template<class F>
+	class RangeJob : public Job {
+	public:
+		RangeJob(const F &func, uint first, uint last) : _func(func), _first(first), _last(last) {}
+
+		void run() override { _func(_first, _last); }
+
+	private:
+		F _func;
+		uint _first, _last;
+	};
+
+	ThreadPoolInternal *_internal;
+	bool _busy;
+};
+
+/** @} */
+
+} // End of namespace Common
+
+/** Shortcut for accessing the shared thread pool. */
+#define ThreadPoolMan Common::ThreadPool::instance()
+
+#endif
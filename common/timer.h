@@ -23,6 +23,7 @@
 #define COMMON_TIMER_H
 
 #include "common/scummsys.h"
+#include "common/array.h"
 #include "common/str.h"
 #include "common/noncopyable.h"
 
@@ -69,6 +70,23 @@ public:
 	 * of this callback will be running anymore.
 	 */
 	virtual void removeTimerProc(TimerProc proc) = 0;
+
+	/** How an installed timer callback has been running. The times are in microseconds. */
+	struct TimerStats {
+		String id;          /*!< ID the timer was installed with. */
+		uint32 interval;    /*!< Interval of the timer. */
+		uint32 calls;       /*!< Number of times the callback was invoked. */
+		uint32 overruns;    /*!< Number of invocations that were late by at least one interval. */
+		uint64 totalTime;   /*!< Time spent in the callback. */
+		uint32 maxTime;     /*!< Longest time a single invocation took. */
+	};
+
+	/**
+	 * Get the statistics of all installed timer callbacks.
+	 *
+	 * Timer managers that do not keep statistics return no entries.
+	 */
+	virtual void getTimerStats(Array<TimerStats> &stats) { stats.clear(); }
 };
 
 /** @} */
@@ -123,6 +123,16 @@ U32String operator+(const U32String &x, const U32String::value_type y) {
 	return temp;
 }
 
+U32String operator+(U32String &&x, const U32String &y) {
+	x += y;
+	return Common::move(x);
+}
+
+U32String operator+(U32String &&x, const U32String::value_type y) {
+	x += y;
+	return Common::move(x);
+}
+
 U32String U32String::substr(size_t pos, size_t len) const {
 	if (pos >= _size)
 		return U32String();
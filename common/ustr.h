@@ -217,6 +217,7 @@ private:
 	void decodeWindows950(const char *src, uint32 len);
 	void decodeJohab(const char *src, uint32 len);
 	void decodeUTF8(const char *str, uint32 len);
+	uint32 decodeASCIIRun(const char *src, uint32 len);
 
 	friend class String;
 };
@@ -232,6 +233,12 @@ U32String operator+(const U32String &x, const U32String &y);
 /** Append the given @p y character to the given @p x string. */
 U32String operator+(const U32String &x, U32String::value_type y);
 
+/** Append @p y to the temporary @p x, reusing its storage. */
+U32String operator+(U32String &&x, const U32String &y);
+
+/** Append the given @p y character to the temporary @p x, reusing its storage. */
+U32String operator+(U32String &&x, U32String::value_type y);
+
 /**
  * Converts string with all non-printable characters properly escaped
  * with use of C++ escape sequences.
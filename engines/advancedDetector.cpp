@@ -28,6 +28,7 @@
 #include "common/md5.h"
 #include "common/config-manager.h"
 #include "common/punycode.h"
+#include "common/savefile.h"
 #include "common/system.h"
 #include "common/textconsole.h"
 #include "common/tokenizer.h"
@@ -407,6 +408,7 @@ Common::Error AdvancedMetaEngineDetectionBase::identifyGame(DetectedGame &game,
 
 	// Detection is done, no need to keep archives in memory anymore
 	ADCacheMan.clearArchives();
+	ADCacheMan.saveStoredProperties();
 
 	if (!agdDesc.desc)
 		return Common::kNoGameDataFoundError;
@@ -545,16 +547,143 @@ bool AdvancedMetaEngineDetectionBase::getFileProperties(const FileMap &allFiles,
 		return true;
 	}
 
+	// Only plain files are kept on disk, the resource forks and archive
+	// members would need the stamps of more than one file
+	const bool storable = !(md5prop & (kMD5MacMask | kMD5Archive)) && allFiles.contains(fname);
+	if (storable && ADCacheMan.getStoredProperties(allFiles[fname], _md5Bytes, md5prop, fileProps)) {
+		ADCacheMan.setMD5(hashname, fileProps.md5);
+		ADCacheMan.setSize(hashname, fileProps.size);
+		return true;
+	}
+
 	bool res = getFilePropertiesIntern(_md5Bytes, allFiles, md5prop, fname, fileProps);
 
 	if (res) {
 		ADCacheMan.setMD5(hashname, fileProps.md5);
 		ADCacheMan.setSize(hashname, fileProps.size);
+		if (storable)
+			ADCacheMan.storeProperties(allFiles[fname], _md5Bytes, md5prop, fileProps);
 	}
 
 	return res;
 }
 
+static const char *const kDetectionStoreName = "detection-cache";
+static const uint32 kDetectionStoreTag = MKTAG('A', 'D', 'C', '1');
+// Each entry takes around a hundred bytes
+static const uint kMaxStoredProperties = 200000;
+
+bool AdvancedDetectorCacheManager::isStoreEnabled() {
+	return ConfMan.getBool("detection_cache");
+}
+
+Common::String AdvancedDetectorCacheManager::getStoreKey(const Common::FSNode &node, uint md5Bytes, MD5Properties md5prop) {
+	return Common::String::format("%u:%d:", md5Bytes, (int)md5prop) + node.getPath().toString(Common::Path::kNativeSeparator);
+}
+
+bool AdvancedDetectorCacheManager::getStoredProperties(const Common::FSNode &node, uint md5Bytes, MD5Properties md5prop, FileProperties &fileProps) {
+	if (!isStoreEnabled())
+		return false;
+
+	loadStoredProperties();
+
+	const StoredHashMap::const_iterator i = storedHashMap.find(getStoreKey(node, md5Bytes, md5prop));
+	if (i == storedHashMap.end())
+		return false;
+
+	int64 size, modified;
+	if (!node.getFileStamp(size, modified) || size != i->_value.size || modified != i->_value.modified)
+		return false;
+
+	fileProps = i->_value.fileProps;
+	return true;
+}
+
+void AdvancedDetectorCacheManager::storeProperties(const Common::FSNode &node, uint md5Bytes, MD5Properties md5prop, const FileProperties &fileProps) {
+	if (!isStoreEnabled())
+		return;
+
+	StoredProperties entry;
+	if (!node.getFileStamp(entry.size, entry.modified))
+		return;
+	entry.fileProps = fileProps;
+
+	loadStoredProperties();
+	if (storedHashMap.size() >= kMaxStoredProperties)
+		storedHashMap.clear();
+
+	storedHashMap.setVal(getStoreKey(node, md5Bytes, md5prop), entry);
+	storeChanged = true;
+}
+
+void AdvancedDetectorCacheManager::loadStoredProperties() {
+	if (storeLoaded)
+		return;
+	storeLoaded = true;
+
+	Common::SaveFileManager *saveMan = g_system ? g_system->getSavefileManager() : nullptr;
+	Common::InSaveFile *file = saveMan ? saveMan->openForLoading(kDetectionStoreName) : nullptr;
+	if (!file)
+		return;
+
+	const uint32 tag = file->readUint32BE();
+	const uint32 count = file->readUint32LE();
+	if (file->err() || file->eos() || tag != kDetectionStoreTag || count > kMaxStoredProperties) {
+		debug(3, "AdvancedDetector: Ignoring unusable detection cache");
+		delete file;
+		return;
+	}
+
+	for (uint32 n = 0; n < count; ++n) {
+		const Common::String key = file->readString();
+		StoredProperties entry;
+		entry.size = file->readSint64LE();
+		entry.modified = file->readSint64LE();
+		entry.fileProps.size = entry.size;
+		entry.fileProps.md5 = file->readString();
+		entry.fileProps.md5prop = (MD5Properties)file->readUint32LE();
+		if (file->err() || file->eos()) {
+			debug(3, "AdvancedDetector: Ignoring truncated detection cache");
+			storedHashMap.clear();
+			break;
+		}
+		storedHashMap.setVal(key, entry);
+	}
+
+	delete file;
+}
+
+void AdvancedDetectorCacheManager::saveStoredProperties() {
+	if (!storeChanged)
+		return;
+	storeChanged = false;
+
+	Common::SaveFileManager *saveMan = g_system ? g_system->getSavefileManager() : nullptr;
+	Common::OutSaveFile *file = saveMan ? saveMan->openForSaving(kDetectionStoreName) : nullptr;
+	if (!file)
+		return;
+
+	file->writeUint32BE(kDetectionStoreTag);
+	file->writeUint32LE(storedHashMap.size());
+	for (const auto &entry : storedHashMap) {
+		file->writeString(entry._key);
+		file->writeByte(0);
+		file->writeSint64LE(entry._value.size);
+		file->writeSint64LE(entry._value.modified);
+		file->writeString(entry._value.fileProps.md5);
+		file->writeByte(0);
+		file->writeUint32LE(entry._value.fileProps.md5prop);
+	}
+	file->finalize();
+
+	const bool failed = file->err();
+	delete file;
+	if (failed) {
+		warning("AdvancedDetector: Could not write the detection cache");
+		saveMan->removeSavefile(kDetectionStoreName);
+	}
+}
+
 bool AdvancedMetaEngineBase::getFilePropertiesExtern(uint md5Bytes, const FileMap &allFiles, MD5Properties md5prop, const Common::Path &fname, FileProperties &fileProps) const {
 	return getFilePropertiesIntern(md5Bytes, allFiles, md5prop, fname, fileProps);
 }
@@ -732,6 +861,13 @@ ADDetectedGames AdvancedMetaEngineDetectionBase::detectGame(const Common::FSNode
 
 	preprocessDescriptions();
 
+	// None of the entries can match if none of their files is there, which
+	// is the case for most engines in most directories
+	if (!hasAnyKeyFile(allFiles)) {
+		debugC(3, kDebugGlobalDetection, "No files of engine '%s' present", getName());
+		return matched;
+	}
+
 	// Check which files are included in some ADGameDescription *and* whether
 	// they are present. Compute MD5s and file sizes for the available files.
 	for (descPtr = _gameDescriptors; ((const ADGameDescription *)descPtr)->gameId != nullptr; descPtr += _descItemSize) {
@@ -979,6 +1115,7 @@ AdvancedMetaEngineDetectionBase::AdvancedMetaEngineDetectionBase(const void *des
 	_maxAutogenLength = 15;
 	_fullPathGlobsDepth = 5;
 
+	_keyFilesComplete = false;
 	_hashMapsInited = false;
 
 	for (auto f = grayList; *f; f++)
@@ -997,12 +1134,27 @@ void AdvancedMetaEngineDetectionBase::preprocessDescriptions() {
 			_globsMap.setVal(*glob, true);
 	}
 
+	_keyFilesComplete = true;
+
 	// Now scan all detection entries
 	for (const byte *descPtr = _gameDescriptors; ((const ADGameDescription *)descPtr)->gameId != nullptr; descPtr += _descItemSize) {
 		const ADGameDescription *g = (const ADGameDescription *)descPtr;
 
 		// Scan for potential directory globs
 		for (const ADGameFileDescription *fileDesc = g->filesDescriptions; fileDesc->fileName; fileDesc++) {
+			// Record the name the file has to be present under, for an
+			// archive member that is the name of the archive
+			const MD5Properties md5prop = gameFileToMD5Props(fileDesc, g->flags);
+			if (md5prop & kMD5MacMask) {
+				_keyFilesComplete = false;
+			} else if (md5prop & kMD5Archive) {
+				Common::StringTokenizer tok(fileDesc->fileName, ":");
+				tok.nextToken();
+				_keyFilesMap.setVal(Common::Path(tok.nextToken()), true);
+			} else {
+				_keyFilesMap.setVal(Common::Path(fileDesc->fileName), true);
+			}
+
 			if (strchr(fileDesc->fileName, '/')) {
 				if (!(_flags & kADFlagMatchFullPaths))
 					warning("Path component detected in entry for '%s:%s' but no kADFlagMatchFullPaths is set",
@@ -1044,6 +1196,17 @@ void AdvancedMetaEngineDetectionBase::preprocessDescriptions() {
 #endif
 }
 
+bool AdvancedMetaEngineDetectionBase::hasAnyKeyFile(const FileMap &allFiles) const {
+	if (!_keyFilesComplete)
+		return true;
+
+	for (const auto &file : allFiles) {
+		if (_keyFilesMap.contains(file._key))
+			return true;
+	}
+	return false;
+}
+
 Common::StringArray AdvancedMetaEngineDetectionBase::getPathsFromEntry(const ADGameDescription *g) {
 	Common::StringArray result;
 	Common::HashMap<Common::String, bool, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> unique;
@@ -547,8 +547,18 @@ private:
 private:
 	Common::HashMap<Common::String, bool, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> _grayListMap;
 	Common::HashMap<Common::String, bool, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> _globsMap;
+	/**
+	 * The names at least one of which has to be in the file map for any
+	 * entry of the detection tables to match. This is only complete if
+	 * there are no entries with resource forks, which can be found under
+	 * many names.
+	 */
+	Common::HashMap<Common::Path, bool, Common::Path::IgnoreCase_Hash, Common::Path::IgnoreCase_EqualTo> _keyFilesMap;
+	bool _keyFilesComplete;
 	bool _hashMapsInited;
 
+	bool hasAnyKeyFile(const FileMap &allFiles) const;
+
 protected:
 	/**
 	 * Detect games in the specified directory.
@@ -771,7 +781,22 @@ public:
 		return archiveHashMap.getValOrDefault(node.getPath(), nullptr);
 	}
 
-	AdvancedDetectorCacheManager() {
+	/**
+	 * Look up the properties of a plain file in the store kept on disk
+	 * across runs. They are only returned if the size and modification
+	 * time of the file are still the ones they were computed for.
+	 *
+	 * Does nothing unless the "detection_cache" option is enabled.
+	 */
+	bool getStoredProperties(const Common::FSNode &node, uint md5Bytes, MD5Properties md5prop, FileProperties &fileProps);
+
+	/** Remember the properties of a plain file in the store kept on disk. */
+	void storeProperties(const Common::FSNode &node, uint md5Bytes, MD5Properties md5prop, const FileProperties &fileProps);
+
+	/** Write the store to disk if anything was added to it. */
+	void saveStoredProperties();
+
+	AdvancedDetectorCacheManager() : storeLoaded(false), storeChanged(false) {
 		clear();
 	}
 
@@ -797,6 +822,21 @@ private:
 	FileHashMap md5HashMap;
 	SizeHashMap sizeHashMap;
 	ArchiveHashMap archiveHashMap;
+
+	struct StoredProperties {
+		int64 size;
+		int64 modified;
+		FileProperties fileProps;
+	};
+
+	typedef Common::HashMap<Common::String, StoredProperties> StoredHashMap;
+	StoredHashMap storedHashMap;
+	bool storeLoaded;
+	bool storeChanged;
+
+	static bool isStoreEnabled();
+	static Common::String getStoreKey(const Common::FSNode &node, uint md5Bytes, MD5Properties md5prop);
+	void loadStoredProperties();
 };
 
 /** Convenience shortcut for accessing the MD5CacheManager. */
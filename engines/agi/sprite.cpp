@@ -29,11 +29,48 @@ namespace Agi {
 SpritesMgr::SpritesMgr(AgiEngine *agi, GfxMgr *gfx) {
 	_vm = agi;
 	_gfx = gfx;
+	_bufferPoolBytes = 0;
 }
 
 SpritesMgr::~SpritesMgr() {
-	_spriteRegularList.clear();
-	_spriteStaticList.clear();
+	freeAllSprites();
+	freeBufferPool();
+}
+
+// Upper limit for the size of the background buffers kept for reuse
+static const uint32 kSpriteBufferPoolMaxBytes = 128 * 1024;
+
+byte *SpritesMgr::allocBackgroundBuffer(uint32 size) {
+	BufferPool::iterator it = _bufferPool.find(size);
+	if (it != _bufferPool.end() && !it->_value.empty()) {
+		byte *buffer = it->_value.back();
+		it->_value.pop_back();
+		_bufferPoolBytes -= size;
+		return buffer;
+	}
+
+	byte *buffer = (byte *)malloc(size);
+	assert(buffer);
+	return buffer;
+}
+
+void SpritesMgr::freeBackgroundBuffer(byte *buffer, uint32 size) {
+	if (_bufferPoolBytes + size > kSpriteBufferPoolMaxBytes) {
+		free(buffer);
+		return;
+	}
+
+	_bufferPool[size].push_back(buffer);
+	_bufferPoolBytes += size;
+}
+
+void SpritesMgr::freeBufferPool() {
+	for (BufferPool::iterator it = _bufferPool.begin(); it != _bufferPool.end(); ++it) {
+		for (uint i = 0; i < it->_value.size(); i++)
+			free(it->_value[i]);
+	}
+	_bufferPool.clear();
+	_bufferPoolBytes = 0;
 }
 
 static bool sortSpriteHelper(const Sprite &entry1, const Sprite &entry2) {
@@ -128,8 +165,7 @@ void SpritesMgr::buildSpriteListAdd(uint16 givenOrderNr, ScreenObjEntry *screenO
 	}
 
 //	warning("list-add: %d, %d, original yPos: %d, ySize: %d", spriteEntry.xPos, spriteEntry.yPos, screenObj->yPos, screenObj->ySize);
-	spriteEntry.backgroundBuffer = (uint8 *)malloc(spriteEntry.xSize * spriteEntry.ySize * 2); // for visual + priority data
-	assert(spriteEntry.backgroundBuffer);
+	spriteEntry.backgroundBuffer = allocBackgroundBuffer(spriteEntry.xSize * spriteEntry.ySize * 2); // for visual + priority data
 	spriteList.push_back(spriteEntry);
 }
 
@@ -138,7 +174,7 @@ void SpritesMgr::freeList(SpriteList &spriteList) {
 	for (iter = spriteList.reverse_begin(); iter != spriteList.end(); iter--) {
 		Sprite &sprite = *iter;
 
-		free(sprite.backgroundBuffer);
+		freeBackgroundBuffer(sprite.backgroundBuffer, sprite.xSize * sprite.ySize * 2);
 	}
 	spriteList.clear();
 }
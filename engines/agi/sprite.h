@@ -60,6 +60,16 @@ private:
 	SpriteList _spriteRegularList;
 	SpriteList _spriteStaticList;
 
+	// The sprite lists are rebuilt every cycle, mostly with the same sizes,
+	// so freed background buffers are kept by size for the next build
+	typedef Common::HashMap<uint32, Common::Array<byte *> > BufferPool;
+	BufferPool _bufferPool;
+	uint32 _bufferPoolBytes;
+
+	byte *allocBackgroundBuffer(uint32 size);
+	void freeBackgroundBuffer(byte *buffer, uint32 size);
+	void freeBufferPool();
+
 public:
 	void buildRegularSpriteList();
 	void buildStaticSpriteList();
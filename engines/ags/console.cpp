@@ -23,8 +23,10 @@
 #include "ags/ags.h"
 #include "ags/globals.h"
 #include "ags/shared/ac/sprite_cache.h"
+#include "ags/engine/ac/route_finder_impl.h"
 #include "ags/shared/gfx/allegro_bitmap.h"
 #include "ags/shared/script/cc_common.h"
+#include "ags/engine/script/cc_instance.h"
 #include "image/png.h"
 
 namespace AGS {
@@ -33,8 +35,11 @@ AGSConsole::AGSConsole(AGSEngine *vm) : GUI::Debugger(), _vm(vm), _logOutputTarg
 	registerCmd("ags_debug_groups_list",   WRAP_METHOD(AGSConsole, Cmd_listDebugGroups));
 	registerCmd("ags_debug_groups_set",  WRAP_METHOD(AGSConsole, Cmd_setDebugGroupLevel));
 	registerCmd("ags_set_script_dump", WRAP_METHOD(AGSConsole, Cmd_SetScriptDump));
+	registerCmd("ags_script_profile", WRAP_METHOD(AGSConsole, Cmd_scriptProfile));
 	registerCmd("ags_sprite_info",   WRAP_METHOD(AGSConsole, Cmd_getSpriteInfo));
 	registerCmd("ags_sprite_dump",  WRAP_METHOD(AGSConsole, Cmd_dumpSprite));
+	registerCmd("ags_sprite_cache", WRAP_METHOD(AGSConsole, Cmd_spriteCacheStats));
+	registerCmd("ags_route_stats", WRAP_METHOD(AGSConsole, Cmd_routeFinderStats));
 
 	_logOutputTarget = new LogOutputTarget();
 	_agsDebuggerOutput = _GP(DbgMgr).RegisterOutput("ScummVMLog", _logOutputTarget, AGS3::AGS::Shared::kDbgMsg_None);
@@ -184,6 +189,36 @@ bool AGSConsole::Cmd_SetScriptDump(int argc, const char **argv) {
 	return true;
 }
 
+bool AGSConsole::Cmd_scriptProfile(int argc, const char **argv) {
+	if (argc < 2 || argc > 3) {
+		debugPrintf("Usage: %s [on|off|reset|show [lines]]\n", argv[0]);
+		debugPrintf("Counts the calls and instructions of the script functions while on\n");
+		return true;
+	}
+
+	if (strcmp(argv[1], "on") == 0 || strcmp(argv[1], "true") == 0) {
+		AGS3::ccSetOption(SCOPT_PROFILE, 1);
+	} else if (strcmp(argv[1], "off") == 0 || strcmp(argv[1], "false") == 0) {
+		AGS3::ccSetOption(SCOPT_PROFILE, 0);
+	} else if (strcmp(argv[1], "reset") == 0) {
+		for (int i = 0; i < MAX_LOADED_INSTANCES; ++i) {
+			if (_G(loadedInstances)[i])
+				_G(loadedInstances)[i]->ResetProfile();
+		}
+	} else if (strcmp(argv[1], "show") == 0) {
+		const size_t lines = (argc == 3) ? (size_t)atoi(argv[2]) : 10;
+		for (int i = 0; i < MAX_LOADED_INSTANCES; ++i) {
+			const AGS3::ccInstance *inst = _G(loadedInstances)[i];
+			// Forks share the profile with the instance they were forked from
+			if (inst && (inst->flags & INSTF_SHAREDATA) == 0)
+				debugPrintf("%s", inst->GetProfile(lines).GetCStr());
+		}
+	} else {
+		debugPrintf("Unknown mode '%s'\n", argv[1]);
+	}
+	return true;
+}
+
 bool AGSConsole::Cmd_getSpriteInfo(int argc, const char **argv) {
 	if (argc != 2) {
 		debugPrintf("Usage: %s SpriteNumber\n", argv[0]);
@@ -207,6 +242,50 @@ bool AGSConsole::Cmd_getSpriteInfo(int argc, const char **argv) {
 	return true;
 }
 
+bool AGSConsole::Cmd_spriteCacheStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset") != 0)) {
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		return true;
+	}
+
+	AGS3::AGS::Shared::SpriteCache &spriteset = _GP(spriteset);
+	if (argc == 2) {
+		spriteset.ResetStats();
+		return true;
+	}
+
+	const AGS3::AGS::Shared::SpriteCache::Stats &stats = spriteset.GetStats();
+	debugPrintf("Decoded: %u KB of %u KB, %u KB locked\n", (uint)(spriteset.GetCacheSize() / 1024),
+		(uint)(spriteset.GetMaxCacheSize() / 1024), (uint)(spriteset.GetLockedSize() / 1024));
+	debugPrintf("Compressed: %u KB of %u KB\n", (uint)(spriteset.GetWarmCacheSize() / 1024),
+		(uint)(spriteset.GetMaxWarmCacheSize() / 1024));
+	debugPrintf("Hits: %u, compressed hits: %u, misses: %u\n", stats.Hits, stats.WarmHits, stats.Misses);
+	debugPrintf("Evictions: %u decoded, %u compressed\n", stats.Evictions, stats.WarmEvictions);
+	debugPrintf("Prefetched: %u, queued: %u\n", stats.Prefetched, (uint)spriteset.GetPrefetchQueueSize());
+	return true;
+}
+
+bool AGSConsole::Cmd_routeFinderStats(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset") != 0)) {
+		debugPrintf("Usage: %s [reset]\n", argv[0]);
+		debugPrintf("Shows the time spent by the route finder in each room\n");
+		return true;
+	}
+
+	AGS3::AGS::Engine::RouteFinder::RouteCache &cache = _GP(route_cache);
+	if (argc == 2) {
+		cache.Rooms.clear();
+		return true;
+	}
+
+	debugPrintf("%-6s %-8s %-8s %-10s %-8s\n", "Room", "Searches", "Cached", "Total ms", "Max ms");
+	for (const auto &room : cache.Rooms) {
+		debugPrintf("%-6d %-8u %-8u %-10u %-8u\n", room._key, room._value.Calls,
+			room._value.CacheHits, room._value.TotalMs, room._value.MaxMs);
+	}
+	return true;
+}
+
 bool AGSConsole::Cmd_dumpSprite(int argc, const char **argv) {
 	if (argc != 2) {
 		debugPrintf("Usage: %s SpriteNumber\n", argv[0]);
@@ -415,6 +415,39 @@ static void reset_temp_room() {
 }
 
 // forchar = playerchar on NewRoom, or NULL if restore saved game
+// Appends all the frames of the view to the sprite list
+static void add_view_sprites(int view, std::vector<sprkey_t> &sprites) {
+	if (view < 0 || view >= _GP(game).numviews)
+		return;
+	const ViewStruct &vs = _GP(views)[view];
+	for (int i = 0; i < vs.numLoops; ++i) {
+		for (int j = 0; j < vs.loops[i].numFrames; ++j)
+			sprites.push_back(vs.loops[i].frames[j].pic);
+	}
+}
+
+// Queues the sprites of the room objects and present characters for
+// loading in the idle time of the next game frames
+static void prefetch_room_sprites(int newnum) {
+	std::vector<sprkey_t> sprites;
+	for (size_t cc = 0; cc < _G(croom)->numobj; cc++) {
+		if (!_G(objs)[cc].on)
+			continue;
+		sprites.push_back(_G(objs)[cc].num);
+		if (_G(objs)[cc].view != RoomObject::NoView)
+			add_view_sprites(_G(objs)[cc].view, sprites);
+	}
+	for (int cc = 0; cc < _GP(game).numcharacters; cc++) {
+		const CharacterInfo &chin = _GP(game).chars[cc];
+		if (chin.room != newnum)
+			continue;
+		add_view_sprites(chin.view, sprites);
+		if (chin.defview != chin.view)
+			add_view_sprites(chin.defview, sprites);
+	}
+	_GP(spriteset).PrefetchSprites(sprites);
+}
+
 void load_new_room(int newnum, CharacterInfo *forchar) {
 
 	debug_script_log("Loading room %d", newnum);
@@ -845,6 +878,7 @@ void load_new_room(int newnum, CharacterInfo *forchar) {
 		_GP(play).UpdateRoomCameras(); // update auto tracking
 	}
 	init_room_drawdata();
+	prefetch_room_sprites(newnum);
 
 	set_our_eip(212);
 	invalidate_screen();
@@ -25,6 +25,7 @@
 //
 //=============================================================================
 
+#include "common/system.h"
 #include "ags/engine/ac/route_finder_impl.h"
 #include "ags/shared/ac/common.h"   // quit()
 #include "ags/engine/ac/move_list.h"     // MoveList
@@ -55,13 +56,53 @@ void set_wallscreen(Bitmap *wallscreen_) {
 }
 
 static void sync_nav_wallscreen() {
-	// FIXME: this is dumb, but...
+	// The navigation grid references the rows of the mask, so it only has to
+	// be set up again if a different bitmap is passed; changes of the mask
+	// contents are seen by the grid right away
+	const unsigned char *data = _G(wallscreen)->GetScanLine(0);
+	if (_G(nav_wallscreen) == _G(wallscreen) && _G(nav_wallscreen_data) == data &&
+		_G(nav_wallscreen_w) == _G(wallscreen)->GetWidth() && _G(nav_wallscreen_h) == _G(wallscreen)->GetHeight())
+		return;
+	_G(nav_wallscreen) = _G(wallscreen);
+	_G(nav_wallscreen_data) = data;
+	_G(nav_wallscreen_w) = _G(wallscreen)->GetWidth();
+	_G(nav_wallscreen_h) = _G(wallscreen)->GetHeight();
+
 	_GP(nav).Resize(_G(wallscreen)->GetWidth(), _G(wallscreen)->GetHeight());
 
 	for (int y = 0; y < _G(wallscreen)->GetHeight(); y++)
 		_GP(nav).SetMapRow(y, _G(wallscreen)->GetScanLine(y));
 }
 
+// FNV-1a hash of the walkable mask, telling whether the cached routes still apply
+static uint32_t hash_nav_wallscreen() {
+	uint32_t hash = 2166136261u;
+	const int width = _G(wallscreen)->GetWidth();
+	for (int y = 0; y < _G(wallscreen)->GetHeight(); y++) {
+		const unsigned char *row = _G(wallscreen)->GetScanLine(y);
+		for (int x = 0; x < width; x++)
+			hash = (hash ^ row[x]) * 16777619u;
+	}
+	return hash;
+}
+
+const RouteCache::Entry *RouteCache::Find(uint32_t grid_hash, int fromx, int fromy, int destx, int desty) {
+	for (auto it = Entries.begin(); it != Entries.end(); ++it) {
+		if (it->GridHash == grid_hash && it->FromX == fromx && it->FromY == fromy &&
+			it->DestX == destx && it->DestY == desty) {
+			Entries.splice(Entries.begin(), Entries, it);
+			return &Entries.front();
+		}
+	}
+	return nullptr;
+}
+
+void RouteCache::Add(Entry &&entry) {
+	if (Entries.size() >= MAX_ENTRIES)
+		Entries.pop_back();
+	Entries.push_front(std::move(entry));
+}
+
 int can_see_from(int x1, int y1, int x2, int y2) {
 	_G(lastcx) = x1;
 	_G(lastcy) = y1;
@@ -83,13 +124,36 @@ void get_lastcpos(int &lastcx_, int &lastcy_) {
 static int find_route_jps(int fromx, int fromy, int destx, int desty) {
 	sync_nav_wallscreen();
 
-	std::vector<int> path, cpath;
-	path.clear();
-	cpath.clear();
+	RouteCache &cache = _GP(route_cache);
+	RouteCache::RoomStats &stats = cache.Rooms[_G(displayed_room)];
+	const uint32_t grid_hash = hash_nav_wallscreen();
+	const RouteCache::Entry *route = cache.Find(grid_hash, fromx, fromy, destx, desty);
+	if (route) {
+		stats.CacheHits++;
+	} else {
+		RouteCache::Entry entry;
+		entry.GridHash = grid_hash;
+		entry.FromX = fromx;
+		entry.FromY = fromy;
+		entry.DestX = destx;
+		entry.DestY = desty;
+
+		const uint32_t start = g_system->getMillis();
+		std::vector<int> path;
+		entry.Found = _GP(nav).NavigateRefined(fromx, fromy, destx, desty, path, entry.Path) != Navigation::NAV_UNREACHABLE;
+		const uint32_t elapsed = g_system->getMillis() - start;
+		stats.Calls++;
+		stats.TotalMs += elapsed;
+		stats.MaxMs = MAX(stats.MaxMs, elapsed);
+
+		cache.Add(std::move(entry));
+		route = &cache.Entries.front();
+	}
 
-	if (_GP(nav).NavigateRefined(fromx, fromy, destx, desty, path, cpath) == Navigation::NAV_UNREACHABLE)
+	if (!route->Found)
 		return 0;
 
+	const std::vector<int> &cpath = route->Path;
 	_G(num_navpoints) = 0;
 
 	// new behavior: cut path if too complex rather than abort with error message
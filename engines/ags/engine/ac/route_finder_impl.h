@@ -22,7 +22,11 @@
 #ifndef AGS_ENGINE_AC_ROUTE_FINDER_IMPL
 #define AGS_ENGINE_AC_ROUTE_FINDER_IMPL
 
+#include "common/std/list.h"
+#include "common/std/map.h"
+#include "common/std/vector.h"
 #include "ags/shared/ac/game_version.h"
+#include "ags/shared/core/types.h"
 
 namespace AGS3 {
 
@@ -39,6 +43,35 @@ namespace AGS {
 namespace Engine {
 namespace RouteFinder {
 
+// Keeps the results of the recent route searches, as characters often
+// repeat the same walks, and counts the route finding time in each room
+struct RouteCache {
+	static const size_t MAX_ENTRIES = 16;
+
+	struct Entry {
+		uint32_t GridHash = 0; // hash of the walkable mask used for the search
+		int FromX = 0, FromY = 0, DestX = 0, DestY = 0;
+		bool Found = false;
+		std::vector<int> Path; // navpoint-compressed path
+	};
+
+	struct RoomStats {
+		uint32_t Calls = 0;     // route requests which needed a search
+		uint32_t CacheHits = 0; // requests answered from the cache
+		uint32_t TotalMs = 0;   // time spent searching
+		uint32_t MaxMs = 0;     // longest search
+	};
+
+	// Finds the result of a previous search, moving it to the front
+	const Entry *Find(uint32_t grid_hash, int fromx, int fromy, int destx, int desty);
+	// Adds a new search result, forgetting the least recently used one
+	void Add(Entry &&entry);
+	void Clear() { Entries.clear(); }
+
+	std::list<Entry> Entries; // most recently used first
+	std::map<int, RoomStats> Rooms;
+};
+
 void init_pathfinder();
 void shutdown_pathfinder();
 
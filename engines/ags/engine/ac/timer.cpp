@@ -24,6 +24,7 @@
 #include "ags/shared/core/platform.h"
 #include "ags/engine/ac/sys_events.h"
 #include "ags/engine/platform/base/ags_platform_driver.h"
+#include "ags/shared/ac/sprite_cache.h"
 #include "ags/ags.h"
 #include "ags/globals.h"
 
@@ -31,6 +32,7 @@ namespace AGS3 {
 
 namespace {
 const auto MAXIMUM_FALL_BEHIND = 3; // number of full frames
+const auto PREFETCH_SPARE_MS = 2; // time left for the frame wait after prefetching sprites
 }
 
 std::chrono::microseconds GetFrameDuration() {
@@ -59,7 +61,7 @@ bool isTimerFpsMaxed() {
 }
 
 void WaitForNextFrame() {
-	const auto now = AGS_Clock::now();
+	auto now = AGS_Clock::now();
 	const auto frameDuration = GetFrameDuration();
 
 	// early exit if we're trying to maximise framerate
@@ -79,6 +81,15 @@ void WaitForNextFrame() {
 		_G(next_frame_timestamp) = now;
 	}
 
+	// use the spare time of the frame to load the sprites expected to be drawn soon
+	if (_GP(spriteset).GetPrefetchQueueSize() > 0 && _G(next_frame_timestamp) > now) {
+		const int64_t spare_ms = ToMilliseconds(_G(next_frame_timestamp) - now);
+		if (spare_ms > PREFETCH_SPARE_MS) {
+			_GP(spriteset).ProcessPrefetch(spare_ms - PREFETCH_SPARE_MS);
+			now = AGS_Clock::now();
+		}
+	}
+
 	if (_G(next_frame_timestamp) > now) {
 		auto frame_time_remaining = _G(next_frame_timestamp) - now;
 		std::this_thread::sleep_for(frame_time_remaining);
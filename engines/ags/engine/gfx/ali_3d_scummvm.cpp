@@ -55,6 +55,7 @@ ScummVMRendererGraphicsDriver::ScummVMRendererGraphicsDriver() {
 
 ScummVMRendererGraphicsDriver::~ScummVMRendererGraphicsDriver() {
 	delete _screen;
+	_lastFrame.free();
 	ScummVMRendererGraphicsDriver::UnInit();
 }
 
@@ -155,6 +156,8 @@ void ScummVMRendererGraphicsDriver::CreateVirtualScreen() {
 	_origVirtualScreen.reset(new Bitmap(vscreen_w, vscreen_h, _srcColorDepth));
 	virtualScreen = _origVirtualScreen.get();
 	_stageVirtualScreen = virtualScreen;
+	// The screen contents are unknown after the mode change
+	_lastFrame.free();
 
 
 	_lastTexPixels = nullptr;
@@ -533,6 +536,42 @@ void ScummVMRendererGraphicsDriver::copySurface(const Graphics::Surface &src, bo
 		_screen->addDirtyRect(Common::Rect(x1, y1, x2 + 1, y2 + 1));
 }
 
+bool ScummVMRendererGraphicsDriver::updateLastFrame(const Graphics::Surface &src, Common::Rect &dirty) {
+	if (_lastFrame.w != src.w || _lastFrame.h != src.h || _lastFrame.format != src.format) {
+		_lastFrame.copyFrom(src);
+		dirty = Common::Rect(src.w, src.h);
+		return true;
+	}
+
+	const int bpp = src.format.bytesPerPixel;
+	const int row_size = src.w * bpp;
+	int top = -1, bottom = -1, left = row_size, right = 0;
+	for (int y = 0; y < src.h; ++y) {
+		const byte *srcP = (const byte *)src.getBasePtr(0, y);
+		byte *lastP = (byte *)_lastFrame.getBasePtr(0, y);
+		if (memcmp(srcP, lastP, row_size) == 0)
+			continue;
+
+		int l = 0, r = row_size;
+		while (srcP[l] == lastP[l])
+			++l;
+		while (srcP[r - 1] == lastP[r - 1])
+			--r;
+		memcpy(lastP + l, srcP + l, r - l);
+
+		left = MIN(left, l);
+		right = MAX(right, r);
+		if (top < 0)
+			top = y;
+		bottom = y + 1;
+	}
+
+	if (top < 0)
+		return false;
+	dirty = Common::Rect(left / bpp, top, (right + bpp - 1) / bpp, bottom);
+	return true;
+}
+
 void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicFlip flip) {
 	Graphics::Surface *srcTransformed = nullptr;
 	if (xoff != 0 || yoff != 0 || flip != Shared::kFlip_None) {
@@ -603,20 +642,25 @@ void ScummVMRendererGraphicsDriver::Present(int xoff, int yoff, Shared::GraphicF
 		Graphics::Surface srcCopy = src;
 		srcCopy.format.aLoss = 8;
 
-		_screen->blitFrom(srcCopy);
+		Common::Rect dirty;
+		if (updateLastFrame(src, dirty))
+			_screen->blitFrom(srcCopy, dirty, Common::Point(dirty.left, dirty.top));
 		break;
 	}
 
-	case kRenderDirect:
-		// Blit the virtual surface directly to the screen
-		g_system->copyRectToScreen(src.getPixels(), src.pitch,
-			0, 0, src.w, src.h);
+	case kRenderDirect: {
+		// Blit the changed area of the virtual surface directly to the screen
+		Common::Rect dirty;
+		if (updateLastFrame(src, dirty))
+			g_system->copyRectToScreen(src.getBasePtr(dirty.left, dirty.top), src.pitch,
+				dirty.left, dirty.top, dirty.width(), dirty.height());
 		g_system->updateScreen();
 		if (srcTransformed) {
 			srcTransformed->free();
 			delete srcTransformed;
 		}
 		return;
+	}
 
 	default:
 		break;
@@ -249,6 +249,8 @@ protected:
 
 private:
 	Graphics::Screen *_screen = nullptr;
+	// Copy of the last presented frame, used to find the changed area
+	Graphics::Surface _lastFrame;
 	PSDLRenderFilter _filter;
 
 	bool _hasGamma = false;
@@ -300,6 +302,9 @@ private:
 	void __fade_out_range(int speed, int from, int to, int targetColourRed, int targetColourGreen, int targetColourBlue);
 	// Copy raw screen bitmap pixels to the screen
 	void copySurface(const Graphics::Surface &src, bool mode);
+	// Finds the area of the frame which differs from the last presented one,
+	// and updates the copy; returns false if the frame did not change
+	bool updateLastFrame(const Graphics::Surface &src, Common::Rect &dirty);
 	// Render bitmap on screen
 	void Present(int xoff = 0, int yoff = 0, Shared::GraphicFlip flip = Shared::kFlip_None);
 };
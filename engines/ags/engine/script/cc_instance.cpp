@@ -253,6 +253,7 @@ ccInstance::ccInstance() {
 	numimports = 0;
 	resolved_imports = nullptr;
 	code_fixups         = nullptr;
+	code_ops            = nullptr;
 
 	memset(callStackLineNumber, 0, sizeof(callStackLineNumber));
 	memset(callStackAddr, 0, sizeof(callStackAddr));
@@ -499,6 +500,18 @@ inline RuntimeScriptValue GetStackPtrOffsetFw(RuntimeScriptValue *stack, int32_t
 	return stack_ptr;
 }
 
+// Decodes the instruction code, instance and argument count of a code value
+static ScriptDecodedInstruction DecodeInstruction(const intptr_t value) {
+	ScriptDecodedInstruction op;
+	const int32_t instruction = static_cast<int32_t>(value & INSTANCE_ID_REMOVEMASK);
+	if (instruction >= 0 && instruction < CC_NUM_SCCMDS) {
+		op.Code = static_cast<int16_t>(instruction);
+		op.InstanceId = static_cast<uint8_t>((value >> INSTANCE_ID_SHIFT) & INSTANCE_ID_MASK);
+		op.ArgCount = static_cast<uint8_t>((*g_commands)[instruction].ArgCount);
+	}
+	return op;
+}
+
 // Applies a runtime fixup to the given arg;
 // Fixup of type `fixup` is applied to the `code` value,
 // the result is assigned to the `arg`.
@@ -561,6 +574,13 @@ int ccInstance::Run(int32_t curpc) {
 	funcstart[0] = pc;
 	ccInstance *codeInst = runningInst;
 	ScriptOperation codeOp;
+	// The profile of the function at each nesting level, if profiling
+	ScriptFunctionProfile *funcprofile[MAXNEST];
+	const bool profiling = ccGetOption(SCOPT_PROFILE) != 0;
+	if (profiling) {
+		funcprofile[0] = &(*codeInst->profile)[pc];
+		funcprofile[0]->Calls++;
+	}
 	FunctionCallStack func_callstack;
 #if DEBUG_CC_EXEC
 	const bool dump_opcodes = (ccGetOption(SCOPT_DEBUGRUN) != 0) ||
@@ -583,14 +603,16 @@ int ccInstance::Run(int32_t curpc) {
 		//
 		/* Read operation */
 		//=====================================================================
-		codeOp.Instruction.Code         = codeInst->code[pc];
-		codeOp.Instruction.InstanceId   = (codeOp.Instruction.Code >> INSTANCE_ID_SHIFT) & INSTANCE_ID_MASK;
-		codeOp.Instruction.Code        &= INSTANCE_ID_REMOVEMASK; // now this is pure instruction code
+		// The instruction code, instance and argument count were decoded
+		// when the script was loaded, see DecodeCode()
+		const ScriptDecodedInstruction &decodedOp = codeInst->code_ops[pc];
+		codeOp.Instruction.Code         = decodedOp.Code;
+		codeOp.Instruction.InstanceId   = decodedOp.InstanceId;
 
-		CC_ERROR_IF_RETCODE((codeOp.Instruction.Code < 0 || codeOp.Instruction.Code >= CC_NUM_SCCMDS),
-							"invalid instruction %d found in code stream", codeOp.Instruction.Code);
+		CC_ERROR_IF_RETCODE(codeOp.Instruction.Code < 0,
+							"invalid instruction %d found in code stream", static_cast<int32_t>(codeInst->code[pc] & INSTANCE_ID_REMOVEMASK));
 
-		codeOp.ArgCount = (*g_commands)[codeOp.Instruction.Code].ArgCount;
+		codeOp.ArgCount = decodedOp.ArgCount;
 
 		CC_ERROR_IF_RETCODE(pc + codeOp.ArgCount >= codeInst->codesize,
 							"unexpected end of code data (%d; %d)", pc + codeOp.ArgCount, codeInst->codesize);
@@ -621,6 +643,9 @@ int ccInstance::Run(int32_t curpc) {
 		}
 #endif
 
+		if (profiling)
+			funcprofile[curnest]->Instructions++;
+
 		/* Perform operation */
 		//=====================================================================
 		switch (codeOp.Instruction.Code) {
@@ -893,6 +918,10 @@ int ccInstance::Run(int32_t curpc) {
 			curnest++;
 			thisbase[curnest] = 0;
 			funcstart[curnest] = pc;
+			if (profiling) {
+				funcprofile[curnest] = &(*codeInst->profile)[pc];
+				funcprofile[curnest]->Calls++;
+			}
 			continue; // continue so that the PC doesn't get overwritten
 		}
 		case SCMD_MEMREADB: {
@@ -1651,6 +1680,8 @@ bool ccInstance::_Create(PScript scri, const ccInstance *joined) {
 	if (joined) {
 		resolved_imports = joined->resolved_imports;
 		code_fixups = joined->code_fixups;
+		code_ops = joined->code_ops;
+		profile = joined->profile;
 	} else {
 		if (!CreateGlobalVars(scri.get())) {
 			return false;
@@ -1658,6 +1689,8 @@ bool ccInstance::_Create(PScript scri, const ccInstance *joined) {
 		if (!CreateRuntimeCodeFixups(scri.get())) {
 			return false;
 		}
+		DecodeCode();
+		profile.reset(new ProfileMap());
 	}
 
 	exports = new RuntimeScriptValue[scri->numexports];
@@ -1737,9 +1770,12 @@ void ccInstance::Free() {
 	if ((flags & INSTF_SHAREDATA) == 0) {
 		delete[] resolved_imports;
 		delete[] code_fixups;
+		delete[] code_ops;
 	}
 	resolved_imports = nullptr;
 	code_fixups = nullptr;
+	code_ops = nullptr;
+	profile.reset();
 }
 
 bool ccInstance::ResolveScriptImports(const ccScript *scri) {
@@ -1947,12 +1983,63 @@ bool ccInstance::ResolveImportFixups(const ccScript *scri) {
 		code[fixup] = import_index;
 		// If the call is to another script function next CALLEXT
 		// must be replaced with CALLAS
-		if (import->InstancePtr != nullptr && (code[fixup + 1] & INSTANCE_ID_REMOVEMASK) == SCMD_CALLEXT)
+		if (import->InstancePtr != nullptr && (code[fixup + 1] & INSTANCE_ID_REMOVEMASK) == SCMD_CALLEXT) {
 			code[fixup + 1] = SCMD_CALLAS | (import->InstancePtr->loadedInstanceId << INSTANCE_ID_SHIFT);
+			code_ops[fixup + 1] = DecodeInstruction(code[fixup + 1]);
+		}
 	}
 	return true;
 }
 
+void ccInstance::DecodeCode() {
+	code_ops = new ScriptDecodedInstruction[codesize];
+	for (int32_t i = 0; i < codesize; ++i)
+		code_ops[i] = DecodeInstruction(code[i]);
+}
+
+struct FunctionProfileEntry {
+	int32_t Start;
+	ScriptFunctionProfile Profile;
+
+	FunctionProfileEntry(int32_t start, const ScriptFunctionProfile &profile) : Start(start), Profile(profile) {}
+
+	static bool MoreInstructions(const FunctionProfileEntry &a, const FunctionProfileEntry &b) {
+		return a.Profile.Instructions > b.Profile.Instructions;
+	}
+};
+
+String ccInstance::GetProfile(size_t max_lines) const {
+	if (!profile || !instanceof)
+		return String();
+
+	std::vector<FunctionProfileEntry> functions;
+	for (const auto &entry : *profile)
+		functions.push_back(FunctionProfileEntry(entry._key, entry._value));
+	std::sort(functions.begin(), functions.end(), FunctionProfileEntry::MoreInstructions);
+
+	String buffer;
+	for (size_t i = 0; i < functions.size() && i < max_lines; ++i) {
+		const int32_t func_pc = functions[i].Start;
+		String name = String::FromFormat("function at %d", func_pc);
+		for (int e = 0; e < instanceof->numexports; ++e) {
+			const int32_t etype = (instanceof->export_addr[e] >> 24L) & 0x000ff;
+			const int32_t eaddr = (instanceof->export_addr[e] & 0x00ffffff);
+			if (etype == EXPORT_FUNCTION && eaddr == func_pc) {
+				name = instanceof->exports[e];
+				break;
+			}
+		}
+		buffer.AppendFmt("%s: %s, %u calls, %llu instructions\n", instanceof->GetSectionName(func_pc), name.GetCStr(),
+						 functions[i].Profile.Calls, (unsigned long long)functions[i].Profile.Instructions);
+	}
+	return buffer;
+}
+
+void ccInstance::ResetProfile() {
+	if (profile)
+		profile->clear();
+}
+
 void ccInstance::PushValueToStack(const RuntimeScriptValue &rval) {
 	// Write value to the stack tail and advance stack ptr
 	registers[SREG_SP].WriteValue(rval);
@@ -67,6 +67,21 @@ struct ScriptInstruction {
 	int32_t InstanceId = 0;
 };
 
+// An instruction of the byte-code, decoded once when the script is loaded;
+// there is one for every position of the code, as the arguments are decoded
+// too in case the program counter ever lands on them
+struct ScriptDecodedInstruction {
+	int16_t Code = -1;      // pure instruction code, or -1 if not a valid one
+	uint8_t InstanceId = 0;
+	uint8_t ArgCount = 0;
+};
+
+// Execution counts of a script function, collected with SCOPT_PROFILE
+struct ScriptFunctionProfile {
+	uint32_t Calls = 0;
+	uint64_t Instructions = 0;
+};
+
 struct ScriptOperation {
 	ScriptInstruction   Instruction;
 	RuntimeScriptValue  Args[MAX_SCMD_ARGS];
@@ -115,6 +130,9 @@ struct ccInstance {
 public:
 	typedef std::unordered_map<int32_t, ScriptVariable> ScVarMap;
 	typedef std::shared_ptr<ScVarMap>                   PScVarMap;
+	// Function profiles, keyed by the function's start in the code
+	typedef std::unordered_map<int32_t, ScriptFunctionProfile> ProfileMap;
+	typedef std::shared_ptr<ProfileMap>                 PProfileMap;
 public:
 	int32_t flags;
 	PScVarMap globalvars;
@@ -154,6 +172,10 @@ public:
 	int  numimports;
 
 	char *code_fixups;
+	// The instruction at each position of code, see ScriptDecodedInstruction
+	ScriptDecodedInstruction *code_ops;
+	// Execution counts of the functions, shared with the forks
+	PProfileMap profile;
 
 	// returns the currently executing instance, or NULL if none
 	static ccInstance *GetCurrentInstance(void);
@@ -186,6 +208,9 @@ public:
 	// Get the address of an exported symbol (function or variable) in the script
 	RuntimeScriptValue GetSymbolAddress(const char *symname) const;
 	void    DumpInstruction(const ScriptOperation &op) const;
+	// Get the execution counts of the most run functions as human-readable text
+	Shared::String GetProfile(size_t max_lines = SIZE_MAX) const;
+	void    ResetProfile();
 	// Tells whether this instance is in the process of executing the byte-code
 	bool    IsBeingRun() const;
 	// Notifies that the game was being updated (script not hanging)
@@ -208,6 +233,8 @@ private:
 	bool    AddGlobalVar(const ScriptVariable &glvar);
 	ScriptVariable *FindGlobalVar(int32_t var_addr);
 	bool    CreateRuntimeCodeFixups(const ccScript *scri);
+	// Decode the instructions of the code into code_ops
+	void    DecodeCode();
 
 	// Begin executing script starting from the given bytecode index
 	int     Run(int32_t curpc);
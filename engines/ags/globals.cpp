@@ -49,6 +49,7 @@
 #include "ags/engine/ac/mouse.h"
 #include "ags/engine/ac/move_list.h"
 #include "ags/engine/ac/room_status.h"
+#include "ags/engine/ac/route_finder_impl.h"
 #include "ags/engine/ac/route_finder_jps.h"
 #include "ags/engine/ac/screen_overlay.h"
 #include "ags/engine/ac/sprite.h"
@@ -356,6 +357,7 @@ Globals::Globals() {
 	// route_finder_impl.cpp globals
 	_navpoints = new Point[MAXNEEDSTAGES];
 	_nav = new Navigation();
+	_route_cache = new AGS::Engine::RouteFinder::RouteCache();
 	_route_finder_impl = new std::unique_ptr<IRouteFinder>();
 
 	// screen.cpp globals
@@ -613,6 +615,7 @@ Globals::~Globals() {
 	// route_finder_impl.cpp globals
 	delete[] _navpoints;
 	delete _nav;
+	delete _route_cache;
 
 	// screen.cpp globals
 	delete[] _old_palette;
@@ -97,6 +97,10 @@ class IGraphicsDriver;
 class LogFile;
 class MessageBuffer;
 
+namespace RouteFinder {
+struct RouteCache;
+} // namespace RouteFinder
+
 } // namespace Engine
 } // namespace AGS
 
@@ -1237,6 +1241,11 @@ public:
 	Navigation *_nav;
 	int _num_navpoints = 0;
 	AGS::Shared::Bitmap *_wallscreen = nullptr;
+	// the mask the navigation grid was last set up for
+	const AGS::Shared::Bitmap *_nav_wallscreen = nullptr;
+	const unsigned char *_nav_wallscreen_data = nullptr;
+	int _nav_wallscreen_w = 0, _nav_wallscreen_h = 0;
+	AGS::Engine::RouteFinder::RouteCache *_route_cache;
 	fixed _move_speed_x, _move_speed_y;
 	int _lastcx = 0, _lastcy = 0;
 	std::unique_ptr<IRouteFinder> *_route_finder_impl;
@@ -117,7 +117,7 @@ void AGSController::ControllerCount(ScriptMethodParams &params) {
 		params._result = 0;
 		return;
 	}
-	int joystickNum = ConfMan.getInt("joystick_num");
+	int joystickNum = _joystickNum.get();
 	params._result = (joystickNum == -1) ? 0 : 1;
 }
 
@@ -132,7 +132,7 @@ void AGSController::Controller_Close(ScriptMethodParams &params) {
 }
 
 void AGSController::Controller_Plugged(ScriptMethodParams &params) {
-	int joystickNum = ConfMan.getInt("joystick_num");
+	int joystickNum = _joystickNum.get();
 	params._result = joystickNum != -1;
 }
 
@@ -159,7 +159,7 @@ void AGSController::Controller_IsButtonDown(ScriptMethodParams &params) {
 }
 
 void AGSController::Controller_GetName(ScriptMethodParams &params) {
-	int joystickNum = ConfMan.getInt("joystick_num");
+	int joystickNum = _joystickNum.get();
 	params._result = (joystickNum != -1) ? _engine->CreateScriptString("Joystick")
 										 : _engine->CreateScriptString("");
 }
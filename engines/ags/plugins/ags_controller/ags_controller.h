@@ -23,6 +23,7 @@
 #define AGS_PLUGINS_AGSCONTROLLER_AGSCONTROLLER_H
 
 #include "ags/plugins/ags_plugin.h"
+#include "common/config-manager.h"
 
 namespace AGS3 {
 namespace Plugins {
@@ -51,8 +52,11 @@ protected:
 	void Controller_PressAnyKey(ScriptMethodParams &params);
 	void Controller_BatteryStatus(ScriptMethodParams &params);
 	void ClickMouse(ScriptMethodParams &params);
+
+	// Games poll the controller state every frame
+	Common::ConfigManager::IntBinding _joystickNum;
 public:
-	AGSController() : PluginBase() {}
+	AGSController() : PluginBase(), _joystickNum(ConfMan.bindInt("joystick_num")) {}
 	virtual ~AGSController();
 
 	const char *AGS_GetPluginName() override;
@@ -25,6 +25,7 @@
 //
 //=============================================================================
 
+#include "common/memtag.h"
 #include "common/system.h"
 #include "ags/shared/core/platform.h"
 #include "ags/shared/util/stream.h"
@@ -60,7 +61,8 @@ namespace Shared {
 
 SpriteCache::SpriteCache(std::vector<SpriteInfo> &sprInfos, const Callbacks &callbacks)
 	: _sprInfos(sprInfos), _maxCacheSize(DEFAULTCACHESIZE_KB * 1024u),
-	  _cacheSize(0u), _lockedSize(0u) {
+	  _cacheSize(0u), _lockedSize(0u),
+	  _maxWarmSize(DEFAULTWARMCACHESIZE_KB * 1024u), _warmSize(0u), _prefetchPos(0u) {
 	_callbacks.AdjustSize = (callbacks.AdjustSize) ? callbacks.AdjustSize : DummyAdjustSize;
 	_callbacks.InitSprite = (callbacks.InitSprite) ? callbacks.InitSprite : DummyInitSprite;
 	_callbacks.PostInitSprite = (callbacks.PostInitSprite) ? callbacks.PostInitSprite : DummyPostInitSprite;
@@ -91,6 +93,24 @@ void SpriteCache::SetMaxCacheSize(size_t size) {
 	_maxCacheSize = size;
 }
 
+size_t SpriteCache::GetWarmCacheSize() const {
+	return _warmSize;
+}
+
+size_t SpriteCache::GetMaxWarmCacheSize() const {
+	return _maxWarmSize;
+}
+
+void SpriteCache::SetMaxWarmCacheSize(size_t size) {
+	_maxWarmSize = size;
+	while ((_warmMru.size() > 0) && (_warmSize > _maxWarmSize))
+		DisposeOldestWarm();
+}
+
+void SpriteCache::ResetStats() {
+	_stats = Stats();
+}
+
 bool SpriteCache::HasFreeSlots() const {
 	return !((_spriteData.size() == SIZE_MAX) || (_spriteData.size() > MAX_SPRITE_INDEX));
 }
@@ -106,6 +126,9 @@ void SpriteCache::Reset() {
 	_mru.clear();
 	_cacheSize = 0;
 	_lockedSize = 0;
+	DisposeAllWarm();
+	_prefetch.clear();
+	_prefetchPos = 0;
 }
 
 bool SpriteCache::SetSprite(sprkey_t index, std::unique_ptr<Bitmap> image, int flags) {
@@ -229,6 +252,7 @@ Bitmap *SpriteCache::operator[](sprkey_t index) {
 	if (_spriteData[index].Image) {
 		// Move to the beginning of the MRU list
 		_mru.splice(_mru.begin(), _mru, _spriteData[index].MruIt);
+		_stats.Hits++;
 		return _spriteData[index].Image.get();
 	} else {
 		// Sprite exists in file but is not in mem, load it and add to MRU list
@@ -276,6 +300,7 @@ void SpriteCache::DisposeOldest() {
 	if (!_spriteData[sprnum].IsLocked()) {
 		_cacheSize -= _spriteData[sprnum].Size;
 		_spriteData[sprnum].Image.reset();
+		_stats.Evictions++;
 		SprCacheLog("DisposeOldest: disposed %d, size now %d KB", sprnum, _cacheSize / 1024);
 	}
 	// Remove from the mru list
@@ -351,13 +376,14 @@ void SpriteCache::UnlockSprite(sprkey_t index) {
 }
 
 size_t SpriteCache::LoadSprite(sprkey_t index, bool lock) {
+	MEMORY_TAG("ags sprites");
 	assert((index >= 0) && ((size_t)index < _spriteData.size()));
 	if (index < 0 || (size_t)index >= _spriteData.size())
 		return 0;
 	assert((_spriteData[index].Flags & SPRCACHEFLAG_ISASSET) != 0);
 
 	Bitmap *image;
-	HError err = _file.LoadSprite(index, image);
+	HError err = LoadSpriteImage(index, image);
 	if (!image) {
 		Debug::Printf(kDbgGroup_SprCache, kDbgMsg_Warn,
 			"LoadSprite: failed to load sprite %d:\n%s\n - remapping to placeholder", index,
@@ -396,6 +422,121 @@ size_t SpriteCache::LoadSprite(sprkey_t index, bool lock) {
 	return size;
 }
 
+HError SpriteCache::LoadSpriteImage(sprkey_t index, Bitmap *&image) {
+	image = nullptr;
+	auto it = _warmData.find(index);
+	if (it != _warmData.end()) {
+		_warmMru.splice(_warmMru.begin(), _warmMru, it->_value.MruIt);
+		_stats.WarmHits++;
+		return _file.LoadSpriteFromRawData(index, it->_value.Hdr, it->_value.Data, image);
+	}
+
+	_stats.Misses++;
+	// Uncompressed sprites are read straight into the bitmap, there's no
+	// gain in keeping their data around
+	if (_maxWarmSize == 0 || _file.GetSpriteCompression() == kSprCompress_None)
+		return _file.LoadSprite(index, image);
+
+	SpriteDatHeader hdr;
+	std::vector<uint8_t> data;
+	HError err = _file.LoadRawData(index, hdr, data);
+	if (!err)
+		return err;
+	err = _file.LoadSpriteFromRawData(index, hdr, data, image);
+	if (err && image)
+		StoreWarmSprite(index, hdr, data, true);
+	return err;
+}
+
+bool SpriteCache::LoadWarmSprite(sprkey_t index) {
+	SpriteDatHeader hdr;
+	std::vector<uint8_t> data;
+	HError err = _file.LoadRawData(index, hdr, data);
+	if (!err || hdr.BPP == 0)
+		return false;
+	return StoreWarmSprite(index, hdr, data, false);
+}
+
+bool SpriteCache::StoreWarmSprite(sprkey_t index, const SpriteDatHeader &hdr, std::vector<uint8_t> &data, bool evict) {
+	const size_t size = data.size();
+	if (hdr.Compress == kSprCompress_None || size == 0 || size > _maxWarmSize)
+		return false;
+	if (!evict && (_warmSize + size > _maxWarmSize))
+		return false;
+	while ((_warmMru.size() > 0) && (_warmSize + size > _maxWarmSize))
+		DisposeOldestWarm();
+
+	WarmSprite &warm = _warmData[index];
+	warm.Hdr = hdr;
+	warm.Data.swap(data);
+	warm.MruIt = _warmMru.insert(_warmMru.begin(), index);
+	_warmSize += size;
+	SprCacheLog("Kept compressed %d, size now %zu KB", index, _warmSize / 1024);
+	return true;
+}
+
+void SpriteCache::DisposeOldestWarm() {
+	assert(_warmMru.size() > 0);
+	if (_warmMru.size() == 0)
+		return;
+	DisposeWarm(_warmMru.back());
+	_stats.WarmEvictions++;
+}
+
+void SpriteCache::DisposeWarm(sprkey_t index) {
+	auto it = _warmData.find(index);
+	if (it == _warmData.end())
+		return;
+	_warmSize -= it->_value.Data.size();
+	_warmMru.erase(it->_value.MruIt);
+	_warmData.erase(it);
+}
+
+void SpriteCache::DisposeAllWarm() {
+	_warmData.clear();
+	_warmMru.clear();
+	_warmSize = 0;
+}
+
+void SpriteCache::PrefetchSprites(const std::vector<sprkey_t> &sprites) {
+	_prefetch = sprites;
+	_prefetchPos = 0;
+}
+
+size_t SpriteCache::ProcessPrefetch(uint32_t max_time_ms) {
+	const uint32_t start = g_system->getMillis();
+	while (_prefetchPos < _prefetch.size()) {
+		const sprkey_t index = _prefetch[_prefetchPos++];
+		if (index < 0 || (size_t)index >= _spriteData.size() ||
+			!_spriteData[index].IsAssetSprite() || _spriteData[index].IsError() ||
+			_spriteData[index].Image)
+			continue;
+
+		// Decode if the sprite fits in the free space, assuming the largest
+		// color depth, as it's better not to push out the sprites in use
+		const Size res = _sprInfos[index].GetResolution();
+		const size_t size = res.Width * res.Height * 4;
+		if (_cacheSize + size < _maxCacheSize) {
+			if (LoadSprite(index))
+				_spriteData[index].MruIt = _mru.insert(_mru.end(), index);
+		} else if (!_warmData.contains(index)) {
+			if (_maxWarmSize == 0 || _file.GetSpriteCompression() == kSprCompress_None)
+				continue;
+			LoadWarmSprite(index);
+		}
+		_stats.Prefetched++;
+
+		if (g_system->getMillis() - start >= max_time_ms)
+			break;
+	}
+
+	if (_prefetchPos >= _prefetch.size()) {
+		_prefetch.clear();
+		_prefetchPos = 0;
+	}
+	return GetPrefetchQueueSize();
+}
+
 void SpriteCache::RemapSpriteToPlaceholder(sprkey_t index) {
 	assert((index > 0) && ((size_t)index < _spriteData.size()));
 	_sprInfos[index] = SpriteInfo(_placeholder->GetWidth(), _placeholder->GetHeight(), _placeholder->GetColorDepth());
@@ -407,6 +548,7 @@ void SpriteCache::InitNullSprite(sprkey_t index) {
 	assert(index >= 0);
 	_sprInfos[index] = SpriteInfo();
 	_spriteData[index] = SpriteData();
+	DisposeWarm(index);
 }
 
 int SpriteCache::SaveToFile(const String &filename, int store_flags, SpriteCompression compress, SpriteFileIndex &index) {
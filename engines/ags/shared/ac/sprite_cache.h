@@ -44,6 +44,7 @@
 #include "common/std/memory.h"
 #include "common/std/vector.h"
 #include "common/std/list.h"
+#include "common/std/map.h"
 #include "ags/shared/ac/sprite_file.h"
 #include "ags/shared/core/platform.h"
 #include "ags/shared/gfx/bitmap.h"
@@ -72,6 +73,13 @@ struct SpriteInfo;
 #define DEFAULTCACHESIZE_KB (128 * 1024)
 #endif
 
+// Max size of the compressed sprite data kept in memory, in bytes
+#if AGS_PLATFORM_OS_ANDROID || AGS_PLATFORM_OS_IOS
+#define DEFAULTWARMCACHESIZE_KB (8 * 1024)
+#else
+#define DEFAULTWARMCACHESIZE_KB (32 * 1024)
+#endif
+
 struct SpriteInfo;
 
 namespace AGS {
@@ -95,6 +103,16 @@ public:
 		PfnPrewriteSprite PrewriteSprite;
 	};
 
+	// Usage counters of the cache, for diagnostic purposes
+	struct Stats {
+		uint32_t Hits = 0;       // requested sprite was ready in memory
+		uint32_t WarmHits = 0;   // sprite was decoded from the compressed data in memory
+		uint32_t Misses = 0;     // sprite had to be read from the file
+		uint32_t Evictions = 0;  // ready images disposed to free space
+		uint32_t WarmEvictions = 0; // compressed data disposed to free space
+		uint32_t Prefetched = 0; // sprites loaded from the prefetch queue
+	};
+
 	SpriteCache(std::vector<SpriteInfo> &sprInfos, const Callbacks &callbacks);
 	~SpriteCache() = default;
 
@@ -169,6 +187,27 @@ public:
 	void        SetEmptySprite(sprkey_t index, bool as_asset);
 	// Sets max cache size in bytes
 	void        SetMaxCacheSize(size_t size);
+	// Returns current size of the compressed sprite data kept in memory, in bytes
+	size_t      GetWarmCacheSize() const;
+	// Returns maximal size limit of the compressed sprite data, in bytes
+	size_t      GetMaxWarmCacheSize() const;
+	// Sets max size of the compressed sprite data in bytes; 0 disables keeping it
+	void        SetMaxWarmCacheSize(size_t size);
+	// Returns the usage counters
+	const Stats &GetStats() const { return _stats; }
+	// Resets the usage counters
+	void        ResetStats();
+
+	// Queues the sprites which are likely to be drawn soon for loading
+	// in the idle time; replaces any previous queue.
+	void        PrefetchSprites(const std::vector<sprkey_t> &sprites);
+	// Loads the queued sprites for up to the given number of milliseconds;
+	// each sprite is decoded if it fits into the free cache space, otherwise
+	// only its compressed data is read into memory. Returns the number of
+	// sprites still waiting in queue.
+	size_t      ProcessPrefetch(uint32_t max_time_ms);
+	// Returns the number of sprites waiting in the prefetch queue
+	size_t      GetPrefetchQueueSize() const { return _prefetch.size() - _prefetchPos; }
 
 	// Loads (if it's not in cache yet) and returns bitmap by the sprite index
 	Bitmap *operator[](sprkey_t index);
@@ -176,6 +215,19 @@ public:
 private:
 	// Load sprite from game resource
 	size_t      LoadSprite(sprkey_t index, bool lock = false);
+	// Reads sprite image, either from the compressed data in memory or from file
+	HError      LoadSpriteImage(sprkey_t index, Bitmap *&image);
+	// Reads compressed sprite data into memory, if it fits the limit
+	bool        LoadWarmSprite(sprkey_t index);
+	// Keeps compressed sprite data in memory, taking the contents of the given
+	// buffer; optionally disposes older data to make space for it
+	bool        StoreWarmSprite(sprkey_t index, const SpriteDatHeader &hdr, std::vector<uint8_t> &data, bool evict);
+	// Delete the least recently used compressed data
+	void        DisposeOldestWarm();
+	// Delete the compressed data of the given sprite, if there's one
+	void        DisposeWarm(sprkey_t index);
+	// Delete all the compressed data
+	void        DisposeAllWarm();
 	// Remap the given index to the placeholder
 	void        RemapSpriteToPlaceholder(sprkey_t index);
 	// Delete the oldest (least recently used) image in cache
@@ -240,6 +292,24 @@ private:
 	// that were last time used long ago.
 	std::list<sprkey_t> _mru;
 
+	// Compressed sprite data kept in memory, to decode sprites again
+	// without reading the file; these have their own size limit and MRU list.
+	struct WarmSprite {
+		SpriteDatHeader Hdr;
+		std::vector<uint8_t> Data;
+		std::list<sprkey_t>::iterator MruIt;
+	};
+	std::unordered_map<sprkey_t, WarmSprite> _warmData;
+	std::list<sprkey_t> _warmMru;
+	size_t _maxWarmSize;   // compressed data size limit
+	size_t _warmSize;      // size in bytes of the compressed data
+
+	// Sprites queued for loading in the idle time
+	std::vector<sprkey_t> _prefetch;
+	size_t _prefetchPos;
+
+	Stats _stats;
+
 };
 
 } // namespace Shared
@@ -370,6 +370,23 @@ HError SpriteFile::LoadSprite(sprkey_t index, Shared::Bitmap *&sprite) {
 	SpriteDatHeader hdr;
 	ReadSprHeader(hdr, _stream.get(), _version, _compress);
 	if (hdr.BPP == 0) return HError::None(); // empty slot, this is normal
+	HError err = LoadSpriteData(index, hdr, _stream.get(), sprite);
+	if (!err)
+		return err;
+	_curPos = index + 1; // mark correct pos
+	return HError::None();
+}
+
+HError SpriteFile::LoadSpriteFromRawData(sprkey_t index, const SpriteDatHeader &hdr,
+		const std::vector<uint8_t> &data, Bitmap *&sprite) const {
+	sprite = nullptr;
+	if (hdr.BPP == 0 || data.empty())
+		return HError::None(); // empty slot, this is normal
+	MemoryStream in(&data[0], data.size());
+	return LoadSpriteData(index, hdr, &in, sprite);
+}
+
+HError SpriteFile::LoadSpriteData(sprkey_t index, const SpriteDatHeader &hdr, Stream *in, Bitmap *&sprite) const {
 	int bpp = hdr.BPP, w = hdr.Width, h = hdr.Height;
 	std::unique_ptr<Bitmap> image(BitmapHelper::CreateBitmap(w, h, bpp * 8));
 	if (image == nullptr) {
@@ -384,11 +401,11 @@ HError SpriteFile::LoadSprite(sprkey_t index, Shared::Bitmap *&sprite) {
 	if (pal_bpp > 0) { // read palette if format assumes one
 		switch (pal_bpp) {
 		case 2: for (uint32_t i = 0; i < hdr.PalCount; ++i) {
-			palette[i] = _stream->ReadInt16();
+			palette[i] = in->ReadInt16();
 		}
 			  break;
 		case 4: for (uint32_t i = 0; i < hdr.PalCount; ++i) {
-			palette[i] = _stream->ReadInt32();
+			palette[i] = in->ReadInt32();
 		}
 			  break;
 		default: assert(0); break;
@@ -399,7 +416,7 @@ HError SpriteFile::LoadSprite(sprkey_t index, Shared::Bitmap *&sprite) {
 	// (Optional) Decompress the image data into the temp buffer
 	size_t in_data_size =
 		((_version >= kSprfVersion_StorageFormats) || _compress != kSprCompress_None) ?
-		(uint32_t)_stream->ReadInt32() : (w * h * bpp);
+		(uint32_t)in->ReadInt32() : (w * h * bpp);
 	if (hdr.Compress != kSprCompress_None) {
 		// TODO: rewrite this to only make a choice once the SpriteFile is initialized
 		// and use either function ptr or a decompressing stream class object
@@ -408,11 +425,11 @@ HError SpriteFile::LoadSprite(sprkey_t index, Shared::Bitmap *&sprite) {
 		}
 		bool result;
 		switch (hdr.Compress) {
-		case kSprCompress_RLE: result = rle_decompress(im_data.Buf, im_data.Size, im_data.BPP, _stream.get());
+		case kSprCompress_RLE: result = rle_decompress(im_data.Buf, im_data.Size, im_data.BPP, in);
 			break;
-		case kSprCompress_LZW: result = lzw_decompress(im_data.Buf, im_data.Size, im_data.BPP, _stream.get(), in_data_size);
+		case kSprCompress_LZW: result = lzw_decompress(im_data.Buf, im_data.Size, im_data.BPP, in, in_data_size);
 			break;
-		case kSprCompress_Deflate: result = inflate_decompress(im_data.Buf, im_data.Size, im_data.BPP, _stream.get(), in_data_size);
+		case kSprCompress_Deflate: result = inflate_decompress(im_data.Buf, im_data.Size, im_data.BPP, in, in_data_size);
 			break;
 		default: assert(!"Unsupported compression type!"); result = false; break;
 		}
@@ -424,12 +441,12 @@ HError SpriteFile::LoadSprite(sprkey_t index, Shared::Bitmap *&sprite) {
 	// Otherwise (no compression) read directly
 	else {
 		switch (im_data.BPP) {
-		case 1: _stream->Read(im_data.Buf, im_data.Size);
+		case 1: in->Read(im_data.Buf, im_data.Size);
 			break;
-		case 2: _stream->ReadArrayOfInt16(
+		case 2: in->ReadArrayOfInt16(
 			reinterpret_cast<int16_t *>(im_data.Buf), im_data.Size / sizeof(int16_t));
 			break;
-		case 4: _stream->ReadArrayOfInt32(
+		case 4: in->ReadArrayOfInt32(
 			reinterpret_cast<int32_t *>(im_data.Buf), im_data.Size / sizeof(int32_t));
 			break;
 		default: assert(0); break;
@@ -441,7 +458,6 @@ HError SpriteFile::LoadSprite(sprkey_t index, Shared::Bitmap *&sprite) {
 	}
 
 	sprite = image.release(); // FIXME: pass unique_ptr in this function
-	_curPos = index + 1; // mark correct pos
 	return HError::None();
 }
 
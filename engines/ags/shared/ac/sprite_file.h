@@ -154,8 +154,13 @@ public:
 	HError      LoadSprite(sprkey_t index, Bitmap *&sprite);
 	// Loads a raw sprite element data into the buffer, stores header info separately
 	HError      LoadRawData(sprkey_t index, SpriteDatHeader &hdr, std::vector<uint8_t> &data);
+	// Creates a ready bitmap from the raw sprite data, previously read by LoadRawData
+	HError      LoadSpriteFromRawData(sprkey_t index, const SpriteDatHeader &hdr,
+		const std::vector<uint8_t> &data, Bitmap *&sprite) const;
 
 private:
+	// Reads the image data following the sprite header and creates a bitmap
+	HError      LoadSpriteData(sprkey_t index, const SpriteDatHeader &hdr, Stream *in, Bitmap *&sprite) const;
 	// Seek stream to sprite
 	void        SeekToSprite(sprkey_t index);
 
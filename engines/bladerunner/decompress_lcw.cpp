@@ -25,9 +25,22 @@
 
 namespace BladeRunner {
 
+/**
+ * Copies an earlier part of the output, byte by byte only when the source
+ * overlaps the destination, as the repeating of such runs relies on it.
+ */
+static inline void copyOutput(uint8 *dst, const uint8 *src, int count) {
+	if (src + count <= dst) {
+		memcpy(dst, src, count);
+	} else {
+		for (int i = 0; i < count; ++i)
+			dst[i] = src[i];
+	}
+}
+
 uint32 decompress_lcw(uint8 *inBuf, uint32 inLen, uint8 *outBuf, uint32 outLen) {
 	int version = 1;
-	int count, i, color, pos, relpos;
+	int count, color, pos, relpos;
 
 	uint8 *src = inBuf;
 	uint8 *dst = outBuf;
@@ -48,11 +61,9 @@ uint32 decompress_lcw(uint8 *inBuf, uint32 inLen, uint8 *outBuf, uint32 outLen)
 			count = MIN(count, out_remain);
 
 			if (version == 1) {
-				for (i = 0; i < count; ++i)
-					dst[i] = outBuf[i + pos];
+				copyOutput(dst, outBuf + pos, count);
 			} else {
-				for (i = 0; i < count; ++i)
-					dst[i] = *(dst + i - pos);
+				copyOutput(dst, dst - pos, count);
 			}
 		} else if (src[0] == 0xfe) { // 0b11111110
 			count = src[1] | (src[2] << 8);
@@ -68,11 +79,9 @@ uint32 decompress_lcw(uint8 *inBuf, uint32 inLen, uint8 *outBuf, uint32 outLen)
 			count = MIN(count, out_remain);
 
 			if (version == 1) {
-				for (i = 0; i < count; ++i)
-					dst[i] = outBuf[i + pos];
+				copyOutput(dst, outBuf + pos, count);
 			} else {
-				for (i = 0; i < count; ++i)
-					dst[i] = *(dst + i - pos);
+				copyOutput(dst, dst - pos, count);
 			}
 		} else if (src[0] >= 0x80) { // 0b10??????
 			count = src[0] & 0x3f;
@@ -87,9 +96,7 @@ uint32 decompress_lcw(uint8 *inBuf, uint32 inLen, uint8 *outBuf, uint32 outLen)
 			src += 2;
 			count = MIN(count, out_remain);
 
-			for (i = 0; i < count; ++i) {
-				dst[i] = *(dst + i - relpos);
-			}
+			copyOutput(dst, dst - relpos, count);
 		}
 
 		dst += count;
@@ -43,6 +43,13 @@ static inline void copy(uint8 **dst, const uint8 **src, int count) {
 	*dst += count;
 	*src += count;
 
+	// Literals and matches at least as far back as they are long don't
+	// overlap, only short distance matches have to repeat byte by byte
+	if (s + count <= d || d + count <= s) {
+		memcpy(d, s, count);
+		return;
+	}
+
 	do { *d++ = *s++; } while (--count);
 }
 
@@ -537,6 +537,28 @@ void SliceRenderer::drawOnScreen(int animationId, int animationFrame, int screen
 	}
 }
 
+/**
+ * Fills the pixels of a slice line span which pass the z-buffer test.
+ * The test is written without branches so that the compiler can vectorize
+ * it, pixels past the right edge of the surface go to its last column.
+ */
+template<typename T>
+static void drawSliceSpan(T *dstRow, uint16 *zbufferLine, int fromX, int toX, int width, uint16 z, T color) {
+	int x = fromX;
+	const int endX = MIN(toX, width);
+	for (; x < endX; ++x) {
+		const bool visible = z < zbufferLine[x];
+		zbufferLine[x] = visible ? z : zbufferLine[x];
+		dstRow[x] = visible ? color : dstRow[x];
+	}
+	for (; x < toX; ++x) {
+		if (z < zbufferLine[x]) {
+			zbufferLine[x] = z;
+			dstRow[width - 1] = color;
+		}
+	}
+}
+
 void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface &surface, uint16 *zbufferLine) {
 	if (slice < 0 || (uint32)slice >= _frameSliceCount) {
 		return;
@@ -553,6 +575,9 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 	uint32 polyCount = READ_LE_UINT32(p);
 	p += 4;
 
+	// All the spans of the slice are on the same line of the surface
+	void *dstRow = surface.getBasePtr(0, CLIP(y, 0, surface.h - 1));
+
 	while (polyCount--) {
 		uint32 vertexCount = READ_LE_UINT32(p);
 		p += 4;
@@ -585,13 +610,18 @@ void SliceRenderer::drawSlice(int slice, bool advanced, int y, Graphics::Surface
 						outColor = _pixelFormat.RGBToColor(Color::get8BitColorFrom5Bit(color.r), Color::get8BitColorFrom5Bit(color.g), Color::get8BitColorFrom5Bit(color.b));
 					}
 
-					for (int x = previousVertexX; x != vertexX; ++x) {
-						if (vertexZ < zbufferLine[x]) {
-							zbufferLine[x] = (uint16)vertexZ;
-
-							void *dstPtr = surface.getBasePtr(CLIP(x, 0, surface.w - 1), CLIP(y, 0, surface.h - 1));
-							drawPixel(surface, dstPtr, outColor);
-						}
+					switch (surface.format.bytesPerPixel) {
+					case 1:
+						drawSliceSpan<uint8>((uint8 *)dstRow, zbufferLine, previousVertexX, vertexX, surface.w, vertexZ, outColor);
+						break;
+					case 2:
+						drawSliceSpan<uint16>((uint16 *)dstRow, zbufferLine, previousVertexX, vertexX, surface.w, vertexZ, outColor);
+						break;
+					case 4:
+						drawSliceSpan<uint32>((uint32 *)dstRow, zbufferLine, previousVertexX, vertexX, surface.w, vertexZ, outColor);
+						break;
+					default:
+						break;
 					}
 				}
 			}
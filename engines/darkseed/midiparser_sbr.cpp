@@ -30,6 +30,8 @@ MidiParser_SBR::MidiParser_SBR(int8 source, bool sfx) : MidiParser_SMF(source),
 	Common::fill(_trackInstruments, _trackInstruments + ARRAYSIZE(_trackInstruments), 0xFF);
 	Common::fill(_trackNoteActive, _trackNoteActive + ARRAYSIZE(_trackNoteActive), 0xFF);
 	Common::fill(_trackLoopCounter, _trackLoopCounter + ARRAYSIZE(_trackLoopCounter), 0);
+	// The loop counters are outside of the tracker
+	_jumpCheckpointsEnabled = false;
 
 	// SBR uses a fixed tempo.
 	_ppqn = 96;
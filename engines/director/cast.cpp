@@ -23,6 +23,7 @@
 #include "common/file.h"
 #include "common/macresman.h"
 #include "common/memstream.h"
+#include "common/memtag.h"
 #include "common/substream.h"
 
 #include "director/types.h"
@@ -563,6 +564,7 @@ bool Cast::loadConfig() {
 }
 
 void Cast::loadCast() {
+	MEMORY_TAG("director cast");
 	Common::SeekableReadStreamEndian *r = nullptr;
 
 	// Font Directory
@@ -45,8 +45,6 @@ BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, Common::SeekableRe
 	_type = kCastBitmap;
 	_picture = new Picture();
 	_ditheredImg = nullptr;
-	_matte = nullptr;
-	_noMatte = false;
 	_bytes = 0;
 	_pitch = 0;
 	_flags2 = 0;
@@ -165,8 +163,6 @@ BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, Common::SeekableRe
 BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, Image::ImageDecoder *img, uint8 flags1)
 	: CastMember(cast, castId) {
 	_type = kCastBitmap;
-	_matte = nullptr;
-	_noMatte = false;
 	_bytes = 0;
 	if (img != nullptr) {
 		_picture = new Picture(*img);
@@ -198,7 +194,6 @@ BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, BitmapCastMember &
 
 	_picture = source._picture ? new Picture(*source._picture) : nullptr;
 	_ditheredImg = nullptr;
-	_matte = nullptr;
 
 	_pitch = source._pitch;
 	_regX = source._regX;
@@ -211,7 +206,6 @@ BitmapCastMember::BitmapCastMember(Cast *cast, uint16 castId, BitmapCastMember &
 	_bitsPerPixel = source._bitsPerPixel;
 
 	_tag = source._tag;
-	_noMatte = source._noMatte;
 	_external = source._external;
 
 	warning("BitmapCastMember(): Duplicating source %d to target %d! This is unlikely to work properly, as the resource loader is based on the cast ID", source._castId, castId);
@@ -225,10 +219,7 @@ BitmapCastMember::~BitmapCastMember() {
 		delete _ditheredImg;
 	}
 
-	if (_matte) {
-		_matte->free();
-		delete _matte;
-	}
+	clearMattes();
 }
 
 Graphics::MacWidget *BitmapCastMember::createWidget(Common::Rect &bbox, Channel *channel, SpriteType spriteType) {
@@ -258,6 +249,8 @@ Graphics::MacWidget *BitmapCastMember::createWidget(Common::Rect &bbox, Channel
 			_ditheredImg = nullptr;
 			_ditheredTargetClut = CastMemberID(0, 0);
 		}
+		// Mattes are made from the converted image
+		clearMattes();
 
 		if (dstBpp == 1) {
 			// ScummVM using 8-bit video
@@ -446,7 +439,7 @@ bool BitmapCastMember::isModified() {
 	return false;
 }
 
-void BitmapCastMember::createMatte(Common::Rect &bbox) {
+Graphics::Surface *BitmapCastMember::createMatte(Common::Rect &bbox) {
 	// Like background trans, but all white pixels NOT ENCLOSED by coloured pixels
 	// are transparent
 	Graphics::Surface tmp;
@@ -459,7 +452,7 @@ void BitmapCastMember::createMatte(Common::Rect &bbox) {
 		bbox
 	);
 
-	_noMatte = true;
+	Graphics::Surface *matte = nullptr;
 
 	// Searching white color in the corners
 	uint32 whiteColor = 0;
@@ -487,11 +480,6 @@ void BitmapCastMember::createMatte(Common::Rect &bbox) {
 	if (!colorFound) {
 		debugC(1, kDebugImages, "BitmapCastMember::createMatte(): No white color for matte image");
 	} else {
-		if (_matte) {
-			_matte->free();
-			delete _matte;
-		}
-
 		Graphics::FloodFill matteFill(&tmp, whiteColor, 0, true);
 
 		for (int yy = 0; yy < tmp.h; yy++) {
@@ -508,31 +496,63 @@ void BitmapCastMember::createMatte(Common::Rect &bbox) {
 		Graphics::Surface *matteSurf = matteFill.getMask();
 		// convert the mask to the same surface format used for 1bpp bitmaps.
 		// this uses the director palette scheme, so white is 0x00 and black is 0xff.
-		_matte = new Graphics::Surface();
-		_matte->create(matteSurf->w, matteSurf->h, Graphics::PixelFormat::createFormatCLUT8());
+		matte = new Graphics::Surface();
+		matte->create(matteSurf->w, matteSurf->h, Graphics::PixelFormat::createFormatCLUT8());
 		for (int y = 0; y < matteSurf->h; y++) {
+			const byte *src = (const byte *)matteSurf->getBasePtr(0, y);
+			byte *dst = (byte *)matte->getBasePtr(0, y);
 			for (int x = 0; x < matteSurf->w; x++) {
-				_matte->setPixel(x, y, matteSurf->getPixel(x, y) ? 0x00 : 0xff);
+				dst[x] = src[x] ? 0x00 : 0xff;
 			}
 		}
-		_noMatte = false;
 	}
 
 	tmp.free();
+
+	return matte;
 }
 
 Graphics::Surface *BitmapCastMember::getMatte(Common::Rect &bbox) {
-	// Lazy loading of mattes
-	if (!_matte && !_noMatte) {
-		createMatte(bbox);
+	// Lazy loading of mattes. Sprites of the same member are often drawn
+	// at several sizes, so keep a few of them around instead of flood
+	// filling the image again each time the size changes.
+	for (uint i = 0; i < _mattes.size(); i++) {
+		if (_mattes[i].width == bbox.width() && _mattes[i].height == bbox.height()) {
+			if (i != 0) {
+				Matte matte = _mattes[i];
+				_mattes.remove_at(i);
+				_mattes.insert_at(0, matte);
+			}
+			return _mattes[0].surface;
+		}
 	}
 
-	// check for the scale matte
-	if (_matte && (_matte->w != bbox.width() || _matte->h != bbox.height())) {
-		createMatte(bbox);
+	if (_mattes.size() >= kMaxMattes) {
+		Graphics::Surface *oldest = _mattes.back().surface;
+		if (oldest) {
+			oldest->free();
+			delete oldest;
+		}
+		_mattes.pop_back();
 	}
 
-	return _matte;
+	Matte matte;
+	matte.width = bbox.width();
+	matte.height = bbox.height();
+	matte.surface = createMatte(bbox);
+	_mattes.insert_at(0, matte);
+
+	return matte.surface;
+}
+
+void BitmapCastMember::clearMattes() {
+	for (auto &matte : _mattes) {
+		if (matte.surface) {
+			matte.surface->free();
+			delete matte.surface;
+		}
+	}
+	_mattes.clear();
 }
 
 Common::String BitmapCastMember::formatInfo() {
@@ -714,6 +734,8 @@ void BitmapCastMember::unload() {
 	delete _ditheredImg;
 	_ditheredImg = nullptr;
 
+	clearMattes();
+
 	_loaded = false;
 }
 
@@ -735,6 +757,7 @@ void BitmapCastMember::setPicture(PictureReference &picture) {
 	// Force redither
 	delete _ditheredImg;
 	_ditheredImg = nullptr;
+	clearMattes();
 
 	// Make sure we get redrawn
 	setModified(true);
@@ -744,6 +767,7 @@ void BitmapCastMember::setPicture(PictureReference &picture) {
 void BitmapCastMember::setPicture(Image::ImageDecoder &image, bool adjustSize) {
 	delete _picture;
 	_picture = new Picture(image);
+	clearMattes();
 	if (adjustSize) {
 		auto surf = image.getSurface();
 		_size = surf->pitch * surf->h + _picture->getPaletteSize();
@@ -40,8 +40,9 @@ public:
 	Graphics::MacWidget *createWidget(Common::Rect &bbox, Channel *channel, SpriteType spriteType) override;
 
 	bool isModified() override;
-	void createMatte(Common::Rect &bbox);
+	Graphics::Surface *createMatte(Common::Rect &bbox);
 	Graphics::Surface *getMatte(Common::Rect &bbox);
+	void clearMattes();
 	Graphics::Surface *getDitherImg();
 
 	bool hasField(int field) override;
@@ -62,7 +63,16 @@ public:
 
 	Picture *_picture = nullptr;
 	Graphics::Surface *_ditheredImg;
-	Graphics::Surface *_matte;
+
+	// Mattes for the last few sizes the member was drawn at, most recent first.
+	// A null surface means the image has no white to be matted out.
+	struct Matte {
+		int16 width;
+		int16 height;
+		Graphics::Surface *surface;
+	};
+	Common::Array<Matte> _mattes;
+	static const uint kMaxMattes = 4;
 
 	uint16 _pitch;
 	int16 _regX;
@@ -75,7 +85,6 @@ public:
 	uint8 _bitsPerPixel;
 
 	uint32 _tag;
-	bool _noMatte;
 	bool _external;
 };
 
@@ -341,7 +341,7 @@ bool Debugger::cmdChannels(int argc, const char **argv) {
 
 	if (frameId >= 1 && frameId <= maxSize) {
 		debugPrintf("Channel info for frame %d of %d\n", frameId, maxSize);
-		Frame *frame = score->_scoreCache[frameId - 1];
+		Frame *frame = score->getScoreCache()[frameId - 1];
 		if (frame) {
 			debugPrintf("%s\n", frame->formatChannelInfo().c_str());
 		} else {
@@ -471,15 +471,15 @@ bool Debugger::cmdFuncs(int argc, const char **argv) {
 	}
 	debugPrintf("\n");
 	debugPrintf("Frame script mappings:\n");
-	for (int i = 0; i < (int)score->_scoreCache.size(); i++) {
-		Frame *frame = score->_scoreCache[i];
+	for (int i = 0; i < (int)score->getScoreCache().size(); i++) {
+		Frame *frame = score->getScoreCache()[i];
 		if (frame && frame->_mainChannels.actionId.member) {
 			debugPrintf("  %d: %s\n", i + 1, frame->_mainChannels.actionId.asString().c_str());
 		}
 	}
 	debugPrintf("Sprite script mappings:\n");
-	for (int i = 0; i < (int)score->_scoreCache.size(); i++) {
-		Frame *frame = score->_scoreCache[i];
+	for (int i = 0; i < (int)score->getScoreCache().size(); i++) {
+		Frame *frame = score->getScoreCache()[i];
 		if (frame) {
 			for (int j = 0; j < (int)frame->_sprites.size(); j++) {
 				Sprite *sprite = frame->_sprites[j];
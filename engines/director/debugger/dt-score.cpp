@@ -47,7 +47,7 @@ const char *modes2[] = {
 
 static void displayScoreChannel(int ch, int mode, int modeSel) {
 	Score *score = g_director->getCurrentMovie()->getScore();
-	uint numFrames = score->_scoreCache.size();
+	uint numFrames = score->getScoreCache().size();
 
 	const uint currentFrameNum = score->getCurrentFrameNum();
 	const ImU32 cell_bg_color = ImGui::GetColorU32(ImVec4(0.7f, 0.7f, 0.0f, 0.65f));
@@ -97,7 +97,7 @@ static void displayScoreChannel(int ch, int mode, int modeSel) {
 	numFrames = MIN<uint>(numFrames, kMaxColumnsInTable - 2);
 
 	for (int f = 0; f < (int)numFrames; f++) {
-		Frame &frame = *score->_scoreCache[f + _state->_scoreFrameOffset - 1];
+		Frame &frame = *score->getScoreCache()[f + _state->_scoreFrameOffset - 1];
 		Sprite &sprite = *frame._sprites[ch];
 
 		ImGui::TableNextColumn();
@@ -194,7 +194,7 @@ void showScore() {
 
 	if (ImGui::Begin("Score", &_state->_w.score)) {
 		Score *score = g_director->getCurrentMovie()->getScore();
-		uint numFrames = score->_scoreCache.size();
+		uint numFrames = score->getScoreCache().size();
 		Cast *cast = g_director->getCurrentMovie()->getCast();
 
 		if (!numFrames) {
@@ -207,7 +207,7 @@ void showScore() {
 		if (_state->_selectedScoreCast.frame >= (int)numFrames)
 			_state->_selectedScoreCast.frame = 0;
 
-		if (!numFrames || _state->_selectedScoreCast.channel >= (int)score->_scoreCache[0]->_sprites.size())
+		if (!numFrames || _state->_selectedScoreCast.channel >= (int)score->getScoreCache()[0]->_sprites.size())
 			_state->_selectedScoreCast.channel = 0;
 
 		if (_state->_scoreFrameOffset >= (int) numFrames)
@@ -219,7 +219,7 @@ void showScore() {
 			bool shape = false;
 
 			if (_state->_selectedScoreCast.frame != -1)
-				sprite = score->_scoreCache[_state->_selectedScoreCast.frame]->_sprites[_state->_selectedScoreCast.channel];
+				sprite = score->getScoreCache()[_state->_selectedScoreCast.frame]->_sprites[_state->_selectedScoreCast.channel];
 
 			if (sprite) {
 				castMember = cast->getCastMember(sprite->_castId.member, true);
@@ -376,7 +376,7 @@ void showScore() {
 			ImGui::EndChild();
 		}
 
-		uint numChannels = score->_scoreCache[0]->_sprites.size();
+		uint numChannels = score->getScoreCache()[0]->_sprites.size();
 		uint tableColumns = MAX(numFrames + 5, 25U); // Set minimal table width to 25
 
 		{  // Render pagination
@@ -700,6 +700,39 @@ void DirectorPlotData::inkBlitShape(Common::Rect &srcRect) {
 	}
 }
 
+template <typename T>
+bool DirectorPlotData::inkBlitSourceOnly(Common::Rect &srcRect, const Graphics::Surface *mask, bool keyBackColor) {
+	// Copies the unmasked pixels, skipping backColor ones for background transparency
+	const int srcX = abs(srcRect.left - destRect.left);
+	const int srcY = abs(srcRect.top - destRect.top);
+	const T key = (T)backColor;
+	bool failedBoundsCheck = false;
+
+	int width = destRect.width();
+	if (srcX + width > srf->w) {
+		width = MAX(0, srf->w - srcX);
+		failedBoundsCheck = true;
+	}
+
+	for (int i = 0; i < destRect.height(); i++) {
+		if (srcY + i >= srf->h || (mask && (srcY + i >= mask->h || srcX + width > mask->w))) {
+			failedBoundsCheck = true;
+			break;
+		}
+
+		const T *src = (const T *)srf->getBasePtr(srcX, srcY + i);
+		T *out = (T *)dst->getBasePtr(destRect.left, destRect.top + i);
+
+		const byte *msk = mask ? (const byte *)mask->getBasePtr(srcX, srcY + i) : nullptr;
+		for (int j = 0; j < width; j++) {
+			if ((!msk || msk[j]) && (!keyBackColor || src[j] != key))
+				out[j] = src[j];
+		}
+	}
+
+	return failedBoundsCheck;
+}
+
 void DirectorPlotData::inkBlitSurface(Common::Rect &srcRect, const Graphics::Surface *mask) {
 	if (!srf)
 		return;
@@ -730,6 +763,27 @@ void DirectorPlotData::inkBlitSurface(Common::Rect &srcRect, const Graphics::Sur
 		}
 	}
 
+	// Matted copies and background transparency only look at the source
+	// pixel, so they can skip the per-pixel ink dispatch
+	if (!applyColor && !alpha && !ms && (sprite != kTextSprite || ink != kInkTypeMask)) {
+		bool copyInk = (ink == kInkTypeCopy || ink == kInkTypeMatte || ink == kInkTypeMask || ink == kInkTypeBlend);
+		bool backTransInk = (ink == kInkTypeBackgndTrans && !oneBitImage);
+		if ((copyInk && mask) || backTransInk) {
+			if (d->_wm->_pixelformat.bytesPerPixel == 1)
+				failedBoundsCheck = inkBlitSourceOnly<byte>(srcRect, mask, backTransInk);
+			else
+				failedBoundsCheck = inkBlitSourceOnly<uint32>(srcRect, mask, backTransInk);
+
+			if (failedBoundsCheck) {
+				warning("DirectorPlotData::inkBlitSurface: Out of bounds - srfClip: %d,%d,%d,%d, srcRect: %d,%d,%d,%d, dstRect: %d,%d,%d,%d",
+						srfClip.left, srfClip.top, srfClip.right, srfClip.bottom,
+						srcRect.left, srcRect.top, srcRect.right, srcRect.bottom,
+						destRect.left, destRect.top, destRect.right, destRect.bottom);
+			}
+			return;
+		}
+	}
+
 	// For blit efficiency, surfaces passed here need to be the same
 	// format as the window manager. Most of the time this is
 	// the job of BitmapCastMember::createWidget.
@@ -1644,7 +1644,7 @@ void LC::call(const Common::String &name, int nargs, bool allowRetVal) {
 	// Handler
 	funcSym = g_lingo->getHandler(name);
 
-	if (g_lingo->_builtinListHandlers.contains(name) && nargs >= 1) {
+	if (nargs >= 1 && g_lingo->_builtinListHandlers.contains(name)) {
 		// Lingo builtin functions in the "List" category have very strange override mechanics.
 		// If the first argument is an ARRAY or PARRAY, it will use the builtin.
 		// Otherwise, it will fall back to whatever handler is defined globally.
@@ -1657,23 +1657,21 @@ void LC::call(const Common::String &name, int nargs, bool allowRetVal) {
 
 	if (funcSym.type == VOIDSYM) { // The built-ins could be overridden
 		// Builtin
-		if (allowRetVal) {
-			if (g_lingo->_builtinFuncs.contains(name)) {
-				funcSym = g_lingo->_builtinFuncs[name];
-			}
-		} else {
-			if (g_lingo->_builtinCmds.contains(name)) {
-				funcSym = g_lingo->_builtinCmds[name];
-			}
-		}
+		const SymbolHash &builtins = allowRetVal ? g_lingo->_builtinFuncs : g_lingo->_builtinCmds;
+		SymbolHash::const_iterator it = builtins.find(name);
+		if (it != builtins.end())
+			funcSym = it->_value;
 	}
 
 	// use lingo-the as fallback. we can only use functions as fallback, not properties
-	if (funcSym.type == VOIDSYM && g_lingo->_theEntities.contains(name) && g_lingo->_theEntities[name]->isFunction) {
-		Datum id;
-		Datum res = g_lingo->getTheEntity(g_lingo->_theEntities[name]->entity, id, kTheNOField);
-		g_lingo->push(res);
-		return;
+	if (funcSym.type == VOIDSYM) {
+		TheEntityHash::const_iterator it = g_lingo->_theEntities.find(name);
+		if (it != g_lingo->_theEntities.end() && it->_value->isFunction) {
+			Datum id;
+			Datum res = g_lingo->getTheEntity(it->_value->entity, id, kTheNOField);
+			g_lingo->push(res);
+			return;
+		}
 	}
 
 	call(funcSym, nargs, allowRetVal);
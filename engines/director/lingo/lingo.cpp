@@ -44,6 +44,57 @@ namespace Director {
 
 Lingo *g_lingo;
 
+// The interpreter creates and drops Datums and Symbols all the time, each of
+// them with a heap allocated reference counter and often with a string. Keep
+// the released ones for reuse instead of going through the heap every time.
+// The pools are only used while a Lingo instance exists.
+static const uint kDatumPoolSize = 1024;
+static int *s_refCountPool[kDatumPoolSize];
+static uint s_refCountPoolUsed = 0;
+static Common::String *s_stringPool[kDatumPoolSize];
+static uint s_stringPoolUsed = 0;
+static bool s_datumPoolEnabled = false;
+
+static int *allocRefCount() {
+	int *refCount = s_refCountPoolUsed ? s_refCountPool[--s_refCountPoolUsed] : new int;
+	*refCount = 1;
+	return refCount;
+}
+
+static void freeRefCount(int *refCount) {
+	if (s_datumPoolEnabled && s_refCountPoolUsed < kDatumPoolSize)
+		s_refCountPool[s_refCountPoolUsed++] = refCount;
+	else
+		delete refCount;
+}
+
+static Common::String *allocString(const Common::String &val) {
+	if (!s_stringPoolUsed)
+		return new Common::String(val);
+	Common::String *s = s_stringPool[--s_stringPoolUsed];
+	*s = val;
+	return s;
+}
+
+static void freeString(Common::String *s) {
+	if (s_datumPoolEnabled && s_stringPoolUsed < kDatumPoolSize) {
+		s->clear();
+		s_stringPool[s_stringPoolUsed++] = s;
+	} else {
+		delete s;
+	}
+}
+
+static void setDatumPoolEnabled(bool enabled) {
+	s_datumPoolEnabled = enabled;
+	if (enabled)
+		return;
+	while (s_refCountPoolUsed)
+		delete s_refCountPool[--s_refCountPoolUsed];
+	while (s_stringPoolUsed)
+		delete s_stringPool[--s_stringPoolUsed];
+}
+
 int calcStringAlignment(const char *s) {
 	return calcCodeAlignment(strlen(s) + 1);
 }
@@ -57,8 +108,7 @@ Symbol::Symbol() {
 	name = nullptr;
 	type = VOIDSYM;
 	u.s = nullptr;
-	refCount = new int;
-	*refCount = 1;
+	refCount = allocRefCount();
 	nargs = 0;
 	maxArgs = 0;
 	targetType = kNoneObj;
@@ -128,7 +178,7 @@ void Symbol::reset() {
 			delete argNames;
 		if (varNames)
 			delete varNames;
-		delete refCount;
+		freeRefCount(refCount);
 	}
 #endif
 }
@@ -171,6 +221,7 @@ LingoState::~LingoState() {
 
 Lingo::Lingo(DirectorEngine *vm) : _vm(vm) {
 	g_lingo = this;
+	setDatumPoolEnabled(true);
 
 	_state = nullptr;
 	_currentChannelId = -1;
@@ -231,6 +282,7 @@ Lingo::~Lingo() {
 	for (auto &it : _openXLibsState) {
 		delete it._value;
 	}
+	setDatumPoolEnabled(false);
 }
 
 void Lingo::reloadBuiltIns() {
@@ -335,8 +387,11 @@ Symbol Lingo::getHandler(const Common::String &name) {
 	Symbol sym;
 
 	// local functions
-	if (_state->context && _state->context->_functionHandlers.contains(name))
-		return _state->context->_functionHandlers[name];
+	if (_state->context) {
+		SymbolHash::const_iterator it = _state->context->_functionHandlers.find(name);
+		if (it != _state->context->_functionHandlers.end())
+			return it->_value;
+	}
 
 	sym = g_director->getCurrentMovie()->getHandler(name, _state->context ? _state->context->_castLibHint : 0);
 	if (sym.type != VOIDSYM)
@@ -870,8 +925,7 @@ int Lingo::getAlignedType(const Datum &d1, const Datum &d2, bool equality) {
 Datum::Datum() {
 	u.s = nullptr;
 	type = VOID;
-	refCount = new int;
-	*refCount = 1;
+	refCount = allocRefCount();
 	ignoreGlobal = false;
 }
 
@@ -898,24 +952,21 @@ Datum& Datum::operator=(const Datum &d) {
 Datum::Datum(int val) {
 	u.i = val;
 	type = INT;
-	refCount = new int;
-	*refCount = 1;
+	refCount = allocRefCount();
 	ignoreGlobal = false;
 }
 
 Datum::Datum(double val) {
 	u.f = val;
 	type = FLOAT;
-	refCount = new int;
-	*refCount = 1;
+	refCount = allocRefCount();
 	ignoreGlobal = false;
 }
 
 Datum::Datum(const Common::String &val) {
-	u.s = new Common::String(val);
+	u.s = allocString(val);
 	type = STRING;
-	refCount = new int;
-	*refCount = 1;
+	refCount = allocRefCount();
 	ignoreGlobal = false;
 }
 
@@ -927,8 +978,7 @@ Datum::Datum(AbstractObject *val) {
 		*refCount += 1;
 	} else {
 		type = VOID;
-		refCount = new int;
-		*refCount = 1;
+		refCount = allocRefCount();
 	}
 	ignoreGlobal = false;
 }
@@ -936,8 +986,7 @@ Datum::Datum(AbstractObject *val) {
 Datum::Datum(const CastMemberID &val) {
 	u.cast = new CastMemberID(val);
 	type = CASTREF;
-	refCount = new int;
-	*refCount = 1;
+	refCount = allocRefCount();
 	ignoreGlobal = false;
 }
 
@@ -946,8 +995,7 @@ Datum::Datum(const Common::Point &point) {
 	u.farr = new FArray;
 	u.farr->arr.push_back(Datum(point.x));
 	u.farr->arr.push_back(Datum(point.y));
-	refCount = new int;
-	*refCount = 1;
+	refCount = allocRefCount();
 	ignoreGlobal = false;
 }
 
@@ -958,8 +1006,7 @@ Datum::Datum(const Common::Rect &rect) {
 	u.farr->arr.push_back(Datum(rect.top));
 	u.farr->arr.push_back(Datum(rect.right));
 	u.farr->arr.push_back(Datum(rect.bottom));
-	refCount = new int;
-	*refCount = 1;
+	refCount = allocRefCount();
 	ignoreGlobal = false;
 }
 
@@ -988,7 +1035,7 @@ void Datum::reset() {
 		case PROPREF:
 		case STRING:
 		case SYMBOL:
-			delete u.s;
+			freeString(u.s);
 			break;
 		case ARRAY:
 		case POINT:
@@ -1027,7 +1074,7 @@ void Datum::reset() {
 			break;
 		}
 		if (type != OBJECT) // object owns refCount
-			delete refCount;
+			freeRefCount(refCount);
 	}
 #endif
 }
@@ -1665,10 +1712,13 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 	case VARREF:
 		{
 			Common::String name = *var.u.s;
-			if (_state->localVars && _state->localVars->contains(name)) {
-				(*_state->localVars)[name] = value;
-				g_debugger->varWriteHook(name);
-				return;
+			if (_state->localVars) {
+				DatumHash::iterator it = _state->localVars->find(name);
+				if (it != _state->localVars->end()) {
+					it->_value = value;
+					g_debugger->varWriteHook(name);
+					return;
+				}
 			}
 			if (_state->me.type == OBJECT && _state->me.u.obj->hasProp(name)) {
 				_state->me.u.obj->setProp(name, value);
@@ -1689,8 +1739,9 @@ void Lingo::varAssign(const Datum &var, const Datum &value) {
 	case LOCALREF:
 		{
 			Common::String name = *var.u.s;
-			if (_state->localVars && _state->localVars->contains(name)) {
-				(*_state->localVars)[name] = value;
+			DatumHash::iterator it;
+			if (_state->localVars && (it = _state->localVars->find(name)) != _state->localVars->end()) {
+				it->_value = value;
 				g_debugger->varWriteHook(name);
 			} else {
 				warning("varAssign: local variable %s not defined", name.c_str());
@@ -1784,15 +1835,17 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 			Common::String name = *var.u.s;
 			g_debugger->varReadHook(name);
 
-			if (_state->localVars && _state->localVars->contains(name)) {
-				return (*_state->localVars)[name];
+			if (_state->localVars) {
+				DatumHash::const_iterator it = _state->localVars->find(name);
+				if (it != _state->localVars->end())
+					return it->_value;
 			}
 			if (_state->me.type == OBJECT && _state->me.u.obj->hasProp(name)) {
 				return _state->me.u.obj->getProp(name);
 			}
-			if (_globalvars.contains(name)) {
-				return _globalvars[name];
-			}
+			DatumHash::const_iterator it = _globalvars.find(name);
+			if (it != _globalvars.end())
+				return it->_value;
 
 			if (!silent)
 				debugC(1, kDebugLingoExec, "varFetch: variable %s not found", name.c_str());
@@ -1803,9 +1856,9 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		{
 			Common::String name = *var.u.s;
 			g_debugger->varReadHook(name);
-			if (_globalvars.contains(name)) {
-				return _globalvars[name];
-			}
+			DatumHash::const_iterator it = _globalvars.find(name);
+			if (it != _globalvars.end())
+				return it->_value;
 			debugC(1, kDebugLingoExec, "varFetch: global variable %s not defined", name.c_str());
 			return result;
 		}
@@ -1814,8 +1867,10 @@ Datum Lingo::varFetch(const Datum &var, bool silent) {
 		{
 			Common::String name = *var.u.s;
 			g_debugger->varReadHook(name);
-			if (_state->localVars && _state->localVars->contains(name)) {
-				return (*_state->localVars)[name];
+			if (_state->localVars) {
+				DatumHash::const_iterator it = _state->localVars->find(name);
+				if (it != _state->localVars->end())
+					return it->_value;
 			}
 			debugC(1, kDebugLingoExec, "varFetch: local variable %s not defined", name.c_str());
 			return result;
@@ -627,18 +627,27 @@ ScriptContext *Movie::getScriptContext(ScriptType type, CastMemberID id) {
 
 Symbol Movie::getHandler(const Common::String &name, uint16 castLibHint) {
 	// Always check the current cast library for a match first
-	if (castLibHint && _casts.contains(castLibHint)) {
-		Cast *cast = _casts.getVal(castLibHint);
-		if (cast->_lingoArchive->functionHandlers.contains(name))
-			return cast->_lingoArchive->functionHandlers[name];
+	if (castLibHint) {
+		Cast *cast = _casts.getValOrDefault(castLibHint, nullptr);
+		if (cast) {
+			SymbolHash::const_iterator it = cast->_lingoArchive->functionHandlers.find(name);
+			if (it != cast->_lingoArchive->functionHandlers.end())
+				return it->_value;
+		}
 	}
 	for (auto &it : _casts) {
-		if (it._value->_lingoArchive->functionHandlers.contains(name))
-			return it._value->_lingoArchive->functionHandlers[name];
+		const SymbolHash &handlers = it._value->_lingoArchive->functionHandlers;
+		SymbolHash::const_iterator jt = handlers.find(name);
+		if (jt != handlers.end())
+			return jt->_value;
 	}
 
-	if (_sharedCast && _sharedCast->_lingoArchive->functionHandlers.contains(name))
-		return _sharedCast->_lingoArchive->functionHandlers[name];
+	if (_sharedCast) {
+		const SymbolHash &handlers = _sharedCast->_lingoArchive->functionHandlers;
+		SymbolHash::const_iterator it = handlers.find(name);
+		if (it != handlers.end())
+			return it->_value;
+	}
 
 	return Symbol();
 }
@@ -106,6 +106,9 @@ Score::~Score() {
 	for (auto &it : _scoreCache)
 		delete it;
 
+	for (auto &it : _keyframes)
+		delete it.frame;
+
 	if (_framesStream)
 		delete _framesStream;
 
@@ -1676,7 +1679,8 @@ void Score::loadFrames(Common::SeekableReadStreamEndian &stream, uint16 version)
 	// Calculate number of frames and their positions
 	// numOfFrames in the header is often incorrect
 	for (_numFrames = 1; loadFrame(_numFrames, false); _numFrames++) {
-		_scoreCache.push_back(new Frame(*_currentFrame));
+		if (_numFrames % kKeyframeInterval == 0)
+			addKeyframe();
 	}
 
 	debugC(1, kDebugLoading, "Score::loadFrames(): Calculated, total number of frames %d!", _numFrames);
@@ -1694,18 +1698,29 @@ bool Score::loadFrame(int frameNum, bool loadCast) {
 	int sourceFrame = _curFrameNumber;
 	int targetFrame = frameNum;
 
-	if (frameNum <= (int)_curFrameNumber) {
-		debugC(7, kDebugLoading, "****** Resetting frame %d to start %" PRId64, sourceFrame, _framesStream->pos());
-		// If we are going back, we need to rebuild frames from start
-		_currentFrame->reset();
-		sourceFrame = 0;
+	// The closest keyframe we can start decoding the target frame from
+	const Keyframe *keyframe = nullptr;
+	for (uint i = 0; i < _keyframes.size() && (int)_keyframes[i].frameNum < targetFrame; i++)
+		keyframe = &_keyframes[i];
+
+	if (frameNum <= (int)_curFrameNumber || (keyframe && (int)keyframe->frameNum > sourceFrame)) {
+		if (keyframe) {
+			debugC(7, kDebugLoading, "****** Restoring keyframe %d at %d", keyframe->frameNum, keyframe->position);
+			restoreKeyframe(*keyframe);
+			sourceFrame = keyframe->frameNum;
+		} else {
+			debugC(7, kDebugLoading, "****** Resetting frame %d to start %" PRId64, sourceFrame, _framesStream->pos());
+			// If we are going back, we need to rebuild frames from start
+			_currentFrame->reset();
+			sourceFrame = 0;
 
-		// Reset position to start
-		_framesStream->seek(_firstFramePosition);
+			// Reset position to start
+			_framesStream->seek(_firstFramePosition);
 
-		// Reset sprite contents
-		for (auto &it : _currentFrame->_sprites)
-			it->reset();
+			// Reset sprite contents
+			for (auto &it : _currentFrame->_sprites)
+				it->reset();
+		}
 	}
 
 	debugC(7, kDebugLoading, "****** Source frame %d to Destination frame %d, current offset %" PRId64, sourceFrame, targetFrame, _framesStream->pos());
@@ -1730,6 +1745,29 @@ bool Score::loadFrame(int frameNum, bool loadCast) {
 	return true;
 }
 
+void Score::addKeyframe() {
+	Keyframe keyframe;
+	keyframe.frameNum = _curFrameNumber;
+	keyframe.position = _framesStream->pos();
+	keyframe.frame = new Frame(*_currentFrame);
+	// The copy constructor leaves out some of the main channels
+	keyframe.frame->_mainChannels = _currentFrame->_mainChannels;
+
+	_keyframes.push_back(keyframe);
+}
+
+void Score::restoreKeyframe(const Keyframe &keyframe) {
+	_currentFrame->reset();
+	_currentFrame->_mainChannels = keyframe.frame->_mainChannels;
+
+	for (uint i = 0; i < _currentFrame->_sprites.size() && i < keyframe.frame->_sprites.size(); i++) {
+		*_currentFrame->_sprites[i] = *keyframe.frame->_sprites[i];
+		_currentFrame->_sprites[i]->_frame = _currentFrame;
+	}
+
+	_framesStream->seek(keyframe.position);
+}
+
 bool Score::readOneFrame() {
 	uint16 channelSize;
 	uint16 channelOffset;
@@ -1801,6 +1839,28 @@ Frame *Score::getFrameData(int frameNum){
 	return nullptr;
 }
 
+const Common::Array<Frame *> &Score::getScoreCache() {
+	if (!_scoreCache.empty() || !_framesStream)
+		return _scoreCache;
+
+	// Decode the whole score into a scratch frame, leaving the playback state alone
+	Frame *tempFrame = _currentFrame;
+	uint32 tempFrameNumber = _curFrameNumber;
+	int64 tempPosition = _framesStream->pos();
+
+	_currentFrame = new Frame(this, _numChannelsDisplayed);
+	_framesStream->seek(_firstFramePosition);
+	for (_curFrameNumber = 1; readOneFrame(); _curFrameNumber++)
+		_scoreCache.push_back(new Frame(*_currentFrame));
+
+	delete _currentFrame;
+	_currentFrame = tempFrame;
+	_curFrameNumber = tempFrameNumber;
+	_framesStream->seek(tempPosition);
+
+	return _scoreCache;
+}
+
 void Score::setSpriteCasts() {
 	// Update sprite cache of cast pointers/info
 	for (uint16 j = 0; j < _currentFrame->_sprites.size(); j++) {
@@ -72,6 +72,7 @@ public:
 	bool readOneFrame();
 	void updateFrame(Frame *frame);
 	Frame *getFrameData(int frameNum);
+	const Common::Array<Frame *> &getScoreCache();
 
 	void loadLabels(Common::SeekableReadStreamEndian &stream);
 	void loadActions(Common::SeekableReadStreamEndian &stream);
@@ -154,8 +155,19 @@ public:
 	Common::HashMap<uint16, Common::String> _actions;
 	Common::HashMap<uint16, bool> _immediateActions;
 
+	// All decoded frames, only built on demand for the debugger
 	Common::Array<Frame *> _scoreCache;
 
+	// Decoder state after every kKeyframeInterval-th frame, so seeking to a
+	// frame does not have to replay the delta stream from the first frame
+	struct Keyframe {
+		uint32 frameNum;
+		uint position;
+		Frame *frame;
+	};
+	Common::Array<Keyframe> _keyframes;
+	static const uint32 kKeyframeInterval = 64;
+
 	// On demand frames loading
 	uint32 _version;
 	Frame *_currentFrame;
@@ -206,6 +218,9 @@ private:
 	DirectorSound *_soundManager;
 
 	int _previousBuildBotBuild = -1;
+
+	void addKeyframe();
+	void restoreKeyframe(const Keyframe &keyframe);
 };
 
 } // End of namespace Director
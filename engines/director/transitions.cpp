@@ -134,12 +134,17 @@ struct {
 
 void Window::exitTransition(TransParams &t, Graphics::ManagedSurface *nextFrame, Common::Rect clipRect) {
 	_composeSurface->blitFrom(*nextFrame, clipRect, Common::Point(clipRect.left, clipRect.top));
-	stepTransition(t, t.steps);
+	stepTransition(t, t.steps, clipRect);
 }
 
-void Window::stepTransition(TransParams &t, int step) {
+void Window::stepTransition(TransParams &t, int step, const Common::Rect &changed) {
 	_contentIsDirty = true;
 
+	// Let the window manager push only the area the step touched to the backend,
+	// unless the palette changes too
+	if (t.sourcePal == t.targetPal)
+		setDirtyContentRect(changed);
+
 	if (t.sourcePal != t.targetPal) {
 		for (int i = 0; i < 768; i++) {
 			t.tempPal[i] = lerpByte(
@@ -566,12 +571,12 @@ void Window::playTransition(uint frame, RenderMode mode, uint16 transDuration, u
 		}
 
 		if (fullredraw) {
-			stepTransition(t, i);
+			stepTransition(t, i, clipRect);
 		} else {
 			rto.clip(clipRect);
 
 			if (rto.height() > 0 && rto.width() > 0)
-				stepTransition(t, i);
+				stepTransition(t, i, rto);
 		}
 
 		uint32 endTime = g_system->getMillis();
@@ -713,6 +718,7 @@ void Window::dissolveTrans(TransParams &t, Common::Rect &clipRect, Graphics::Man
 	for (int i = 0; i < t.steps; i++) {
 		uint32 startTime = g_system->getMillis();
 		int bitEndIndex = (bitSteps - 1) * (i + 1) / t.steps;
+		Common::Rect changed;
 
 		while (bitIndex < bitEndIndex) {
 			bitIndex++;
@@ -736,8 +742,13 @@ void Window::dissolveTrans(TransParams &t, Common::Rect &clipRect, Graphics::Man
 							r.moveTo(x, y);
 							r.clip(clipRect);
 
-							if (!r.isEmpty())
+							if (!r.isEmpty()) {
 								_composeSurface->copyRectToSurface(*nextFrame, x, y, r);
+								if (changed.isEmpty())
+									changed = r;
+								else
+									changed.extend(r);
+							}
 						}
 					} else {
 						mask = pixmask[x % -t.xStepSize];
@@ -758,6 +769,12 @@ void Window::dissolveTrans(TransParams &t, Common::Rect &clipRect, Graphics::Man
 							*dst = ((*dst & ~mask) | (*src & mask)) & 0xff;
 
 						}
+
+						Common::Rect pixel(x, y, x + 1, y + 1);
+						if (changed.isEmpty())
+							changed = pixel;
+						else
+							changed.extend(pixel);
 					}
 				}
 
@@ -770,7 +787,7 @@ void Window::dissolveTrans(TransParams &t, Common::Rect &clipRect, Graphics::Man
 				}
 			} while (rnd != seed);
 		}
-		stepTransition(t, i);
+		stepTransition(t, i, changed.isEmpty() ? clipRect : changed);
 
 		g_lingo->executePerFrameHook(t.frame, i + 1);
 
@@ -853,6 +870,42 @@ static byte dissolvePatterns[][8] = {
 	{ 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff }
 };
 
+/**
+ * Copy the pixels of a row whose bit is set in the 8 pixel wide pattern,
+ * starting with the most significant bit.
+ */
+template <typename T>
+static void copyPatternRow(T *dst, const T *src, int width, byte pat) {
+	if (pat == 0)
+		return;
+
+	if (pat == 0xff) {
+		memcpy(dst, src, width * sizeof(T));
+		return;
+	}
+
+	T masks[8];
+	for (int b = 0; b < 8; b++)
+		masks[b] = (pat & (0x80 >> b)) ? (T)~0 : 0;
+
+	int x = 0;
+	if (sizeof(T) == 1) {
+		// 8 pixels at a time, the pattern fits a 64-bit word
+		uint64 mask;
+		memcpy(&mask, masks, sizeof(mask));
+		for (; x + 8 <= width; x += 8) {
+			uint64 d, s;
+			memcpy(&d, dst + x, sizeof(d));
+			memcpy(&s, src + x, sizeof(s));
+			d = (d & ~mask) | (s & mask);
+			memcpy(dst + x, &d, sizeof(d));
+		}
+	}
+
+	for (; x < width; x++)
+		dst[x] = (dst[x] & ~masks[x & 7]) | (src[x] & masks[x & 7]);
+}
+
 void Window::dissolvePatternsTrans(TransParams &t, Common::Rect &clipRect, Graphics::ManagedSurface *nextFrame) {
 	int patternSteps = 64;
 
@@ -862,40 +915,15 @@ void Window::dissolvePatternsTrans(TransParams &t, Common::Rect &clipRect, Graph
 		for (int y = clipRect.top; y < clipRect.bottom; y++) {
 			byte pat = dissolvePatterns[patternIndex][y % 8];
 			if (g_director->_pixelformat.bytesPerPixel == 1) {
-
-				byte *dst = (byte *)_composeSurface->getBasePtr(clipRect.left, y);
-				byte *src = (byte *)nextFrame->getBasePtr(clipRect.left, y);
-
-				for (int x = clipRect.left; x < clipRect.right;) {
-					byte mask = 0x80;
-					for (int b = 0; b < 8 && x < clipRect.right; b++, x++) {
-						if (pat & mask)
-							*dst = *src;
-
-						dst++;
-						src++;
-						mask >>= 1;
-					}
-				}
+				copyPatternRow<byte>((byte *)_composeSurface->getBasePtr(clipRect.left, y),
+					(const byte *)nextFrame->getBasePtr(clipRect.left, y), clipRect.width(), pat);
 			} else {
-				uint32 *dst = (uint32 *)_composeSurface->getBasePtr(clipRect.left, y);
-				uint32 *src = (uint32 *)nextFrame->getBasePtr(clipRect.left, y);
-
-				for (int x = clipRect.left; x < clipRect.right;) {
-					byte mask = 0x80;
-					for (int b = 0; b < 8 && x < clipRect.right; b++, x++) {
-						if (pat & mask)
-							*dst = *src;
-
-						dst++;
-						src++;
-						mask >>= 1;
-					}
-				}
+				copyPatternRow<uint32>((uint32 *)_composeSurface->getBasePtr(clipRect.left, y),
+					(const uint32 *)nextFrame->getBasePtr(clipRect.left, y), clipRect.width(), pat);
 			}
 		}
 
-		stepTransition(t, i);
+		stepTransition(t, i, clipRect);
 
 		g_lingo->executePerFrameHook(t.frame, i + 1);
 
@@ -1064,6 +1092,7 @@ void Window::transMultiPass(TransParams &t, Common::Rect &clipRect, Graphics::Ma
 		if (stop)
 			break;
 
+		Common::Rect changed;
 		for (uint r = 0; r < rects.size(); r++) {
 			rto = rects[r];
 			rto.translate(clipRect.left, clipRect.top);
@@ -1071,9 +1100,13 @@ void Window::transMultiPass(TransParams &t, Common::Rect &clipRect, Graphics::Ma
 
 			if (rto.height() > 0 && rto.width() > 0) {
 				_composeSurface->blitFrom(*nextFrame, rto, Common::Point(rto.left, rto.top));
+				if (changed.isEmpty())
+					changed = rto;
+				else
+					changed.extend(rto);
 			}
 		}
-		stepTransition(t, i);
+		stepTransition(t, i, changed);
 		rects.clear();
 
 		g_lingo->executePerFrameHook(t.frame, i);
@@ -1141,7 +1174,7 @@ void Window::transZoom(TransParams &t, Common::Rect &clipRect, Graphics::Managed
 			break;
 		}
 
-		stepTransition(t, i);
+		stepTransition(t, i, clipRect);
 
 		uint32 endTime = g_system->getMillis();
 		int diff = MAX(0, (int)t.stepDuration - (int)(endTime - startTime));
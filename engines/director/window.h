@@ -117,7 +117,7 @@ public:
 
 	// transitions.cpp
 	void exitTransition(TransParams &t, Graphics::ManagedSurface *nextFrame, Common::Rect clipRect);
-	void stepTransition(TransParams &t, int step);
+	void stepTransition(TransParams &t, int step, const Common::Rect &changed = Common::Rect());
 	void playTransition(uint frame, RenderMode mode, uint16 transDuration, uint8 transArea, uint8 transChunkSize, TransitionType transType, CastMemberID paletteId);
 	void initTransParams(TransParams &t, Common::Rect &clipRect);
 	void dissolveTrans(TransParams &t, Common::Rect &clipRect, Graphics::ManagedSurface *tmpSurface);
@@ -394,10 +394,40 @@ bool Area::hasActiveGroups() {
 	return false;
 }
 
+/**
+ * The box a moving box covers along all of its way. Objects which are clearly
+ * apart from it can't be hit by a sweep, and sweepAABB() can be skipped for them.
+ */
+static Math::AABB createSweptAABB(const Math::AABB &boundingBox, const Math::Vector3d &direction) {
+	Math::AABB swept = boundingBox;
+	swept.expand(boundingBox.getMin() + direction);
+	swept.expand(boundingBox.getMax() + direction);
+	return swept;
+}
+
+static bool isApartFromSweep(const Math::AABB &swept, const Math::AABB &boundingBox) {
+	// sweepAABB() counts touching boxes as collisions, the margin keeps those
+	static const float margin = 1.0f;
+
+	if (!swept.isValid() || !boundingBox.isValid())
+		return false;
+
+	const Math::Vector3d sweptMin = swept.getMin();
+	const Math::Vector3d sweptMax = swept.getMax();
+	const Math::Vector3d min = boundingBox.getMin();
+	const Math::Vector3d max = boundingBox.getMax();
+	for (int i = 0; i < 3; i++) {
+		if (max.getValue(i) < sweptMin.getValue(i) - margin || min.getValue(i) > sweptMax.getValue(i) + margin)
+			return true;
+	}
+	return false;
+}
+
 Object *Area::checkCollisionRay(const Math::Ray &ray, int raySize) {
 	float distance = 1.0;
 	float size = 16.0 * 8192.0; // TODO: check if this is the max size
 	Math::AABB boundingBox(ray.getOrigin(), ray.getOrigin());
+	Math::AABB swept = createSweptAABB(boundingBox, raySize * ray.getDirection());
 	Object *collided = nullptr;
 	for (auto &obj : _drawableObjects) {
 		if (obj->getType() == kLineType)
@@ -407,6 +437,9 @@ Object *Area::checkCollisionRay(const Math::Ray &ray, int raySize) {
 
 		if (!obj->isDestroyed() && !obj->isInvisible()) {
 			GeometricObject *gobj = (GeometricObject *)obj;
+			if (isApartFromSweep(swept, gobj->_boundingBox))
+				continue;
+
 			Math::Vector3d collidedNormal;
 			float collidedDistance = sweepAABB(boundingBox, gobj->_boundingBox, raySize * ray.getDirection(), collidedNormal);
 			debugC(1, kFreescapeDebugMove, "reached obj id: %d with distance %f", obj->getObjectID(), collidedDistance);
@@ -509,10 +542,14 @@ Math::Vector3d Area::resolveCollisions(const Math::Vector3d &lastPosition_, cons
 		float distance = 1.0;
 		Math::Vector3d normal;
 		Math::Vector3d direction = position - lastPosition;
+		Math::AABB swept = createSweptAABB(boundingBox, direction);
 
 		for (auto &obj : _drawableObjects) {
 			if (!obj->isDestroyed() && !obj->isInvisible()) {
 				GeometricObject *gobj = (GeometricObject *)obj;
+				if (isApartFromSweep(swept, gobj->_boundingBox))
+					continue;
+
 				Math::Vector3d collidedNormal;
 				float collidedDistance = sweepAABB(boundingBox, gobj->_boundingBox, direction, collidedNormal);
 				if (collidedDistance < distance) {
@@ -21,6 +21,7 @@
 
 #include "glk/debugger.h"
 #include "glk/glk.h"
+#include "glk/glk_api.h"
 #include "glk/raw_decoder.h"
 #include "common/file.h"
 #include "graphics/managed_surface.h"
@@ -30,6 +31,7 @@ namespace Glk {
 
 Debugger::Debugger() : GUI::Debugger() {
 	registerCmd("dumppic", WRAP_METHOD(Debugger, cmdDumpPic));
+	registerCmd("turntime", WRAP_METHOD(Debugger, cmdTurnTime));
 }
 
 int Debugger::strToInt(const char *s) {
@@ -99,6 +101,19 @@ bool Debugger::cmdDumpPic(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmdTurnTime(int argc, const char **argv) {
+	if (argc > 2 || (argc == 2 && strcmp(argv[1], "reset"))) {
+		debugPrintf("Format: turntime [reset]\n");
+		return true;
+	}
+
+	GlkAPI *api = static_cast<GlkAPI *>(g_vm);
+	debugPrintf("Last turn: %u ms, longest turn: %u ms\n", api->getLastTurnTime(), api->getMaxTurnTime());
+	if (argc == 2)
+		api->resetMaxTurnTime();
+	return true;
+}
+
 void Debugger::saveRawPicture(const RawDecoder &rd, Common::WriteStream &ws) {
 #ifdef USE_PNG
 	const Graphics::Surface *surface = rd.getSurface();
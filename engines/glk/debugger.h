@@ -42,6 +42,11 @@ private:
 	 * Dump a picture
 	 */
 	bool cmdDumpPic(int argc, const char **argv);
+
+	/**
+	 * Show the time the game took for its turns
+	 */
+	bool cmdTurnTime(int argc, const char **argv);
 protected:
 	/**
 	 * Convert a numeric string to an integer
@@ -35,7 +35,8 @@
 namespace Glk {
 
 GlkAPI::GlkAPI(OSystem *syst, const GlkGameDescription &gameDesc) :
-		GlkEngine(syst, gameDesc), _gliFirstEvent(false) {
+		GlkEngine(syst, gameDesc), _gliFirstEvent(false), _turnStart(0), _lastTurnTime(0),
+		_maxTurnTime(0) {
 	// Set uppercase/lowercase tables
 	int ix, res;
 	for (ix = 0; ix < 256; ix++) {
@@ -684,9 +685,14 @@ void GlkAPI::glk_select(event_t *event) {
 	if (!_gliFirstEvent) {
 		_windows->inputGuessFocus();
 		_gliFirstEvent = true;
+	} else {
+		// Track how long the game ran since the previous event
+		_lastTurnTime = g_system->getMillis() - _turnStart;
+		_maxTurnTime = MAX(_maxTurnTime, _lastTurnTime);
 	}
 
 	_events->getEvent(event, false);
+	_turnStart = g_system->getMillis();
 }
 
 void GlkAPI::glk_select_poll(event_t *event) {
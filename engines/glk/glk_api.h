@@ -51,6 +51,7 @@ private:
 	bool _gliFirstEvent;
 	unsigned char _charTolowerTable[256];
 	unsigned char _charToupperTable[256];
+	uint32 _turnStart, _lastTurnTime, _maxTurnTime;
 public:
 	/**
 	 * Constructor
@@ -58,6 +59,21 @@ public:
 	GlkAPI(OSystem *syst, const GlkGameDescription &gameDesc);
 	~GlkAPI() override {}
 
+	/**
+	 * Returns the time in ms the game ran between its last two waits for an event
+	 */
+	uint32 getLastTurnTime() const { return _lastTurnTime; }
+
+	/**
+	 * Returns the longest time in ms the game ran between two waits for an event
+	 */
+	uint32 getMaxTurnTime() const { return _maxTurnTime; }
+
+	/**
+	 * Resets the longest turn time
+	 */
+	void resetMaxTurnTime() { _maxTurnTime = 0; }
+
 	void glk_exit(void);
 	void glk_set_interrupt_handler(void(*func)(void));
 	void glk_tick(void);
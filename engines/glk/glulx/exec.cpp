@@ -38,7 +38,11 @@ void Glulx::execute_loop() {
 	gfloat32 valf, valf1, valf2;
 #endif /* FLOAT_SUPPORT */
 
-	while (!done_executing && !g_vm->shouldQuit()) {
+	uint quitCheckCount = 0;
+
+	// Checking for a quit queries the event manager, so only do it every
+	// so many instructions. Events are only polled during Glk calls anyway.
+	while (!done_executing && ((++quitCheckCount & 0x3FF) != 0 || !g_vm->shouldQuit())) {
 
 		profile_tick();
 		debugger_tick();
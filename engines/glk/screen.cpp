@@ -186,4 +186,18 @@ size_t Screen::stringWidthUni(int fontIdx, const Common::U32String &text, int sp
 	return font->getStringWidth(text) * GLI_SUBPIX;
 }
 
+size_t Screen::stringWidthUni(int fontIdx, const uint32 *text, int len, int spw) {
+	// The same sum as Graphics::Font::getStringWidth()
+	const Graphics::Font *font = _fonts[fontIdx];
+	uint32 last = 0;
+	int width = 0;
+
+	for (int i = 0; i < len; ++i) {
+		width += font->getCharWidth(text[i]) + font->getKerningOffset(last, text[i]);
+		last = text[i];
+	}
+
+	return width * GLI_SUBPIX;
+}
+
 } // End of namespace Glk
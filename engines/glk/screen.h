@@ -132,6 +132,16 @@ public:
 	 * @returns         Width of string multiplied by GLI_SUBPIX
 	 */
 	size_t stringWidthUni(int fontIdx, const Common::U32String &text, int spw = 0);
+
+	/**
+	 * Get the width in pixels of a unicode string, without copying it into a string
+	 * @param fontIdx   Which font to use
+	 * @param text      Characters to get the width of
+	 * @param len       Number of characters
+	 * @param spw       Delta X
+	 * @returns         Width of string multiplied by GLI_SUBPIX
+	 */
+	size_t stringWidthUni(int fontIdx, const uint32 *text, int len, int spw = 0);
 };
 
 } // End of namespace Glk
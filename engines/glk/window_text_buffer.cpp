@@ -856,12 +856,13 @@ void TextBufferWindow::redraw() {
 		if (selrow)
 			_lines[i]._dirty = true;
 
-		TextBufferRow ln(_lines[i]);
-
 		// skip if we can
-		if (!ln._dirty && !ln._repaint && !Windows::_forceRedraw && _scrollPos == 0)
+		if (!_lines[i]._dirty && !_lines[i]._repaint && !Windows::_forceRedraw && _scrollPos == 0)
 			continue;
 
+		// The selection reverses the attributes of the copy
+		TextBufferRow ln(_lines[i]);
+
 		// repaint previously selected lines if needed
 		if (ln._repaint && !Windows::_forceRedraw)
 			_windows->redrawRect(Rect(x0 / GLI_SUBPIX, y,
@@ -985,7 +986,7 @@ void TextBufferWindow::redraw() {
 				link = ln._attrs[a].hyper;
 				font = ln._attrs[a].attrFont(_styles);
 				color = ln._attrs[a].attrBg(_styles);
-				w = screen.stringWidthUni(font, Common::U32String(ln._chars + a, b - a), spw);
+				w = screen.stringWidthUni(font, ln._chars + a, b - a, spw);
 				screen.fillRect(Rect::fromXYWH(x / GLI_SUBPIX, y, w / GLI_SUBPIX, _font._leading),
 								color);
 				if (link) {
@@ -1002,7 +1003,7 @@ void TextBufferWindow::redraw() {
 		link = ln._attrs[a].hyper;
 		font = ln._attrs[a].attrFont(_styles);
 		color = ln._attrs[a].attrBg(_styles);
-		w = screen.stringWidthUni(font, Common::U32String(ln._chars + a, b - a), spw);
+		w = screen.stringWidthUni(font, ln._chars + a, b - a, spw);
 		screen.fillRect(Rect::fromXYWH(x / GLI_SUBPIX, y, w / GLI_SUBPIX, _font._leading), color);
 		if (link) {
 			screen.fillRect(Rect::fromXYWH(x / GLI_SUBPIX + 1, y + _font._baseLine + 1,
@@ -1087,7 +1088,7 @@ void TextBufferWindow::redraw() {
 	 * draw the images
 	 */
 	for (i = 0; i < _scrollBack; i++) {
-		TextBufferRow ln(_lines[i]);
+		const TextBufferRow &ln = _lines[i];
 
 		y = y0 + (_height - (i - _scrollPos) - 1) * _font._leading;
 
@@ -1549,11 +1550,11 @@ void TextBufferWindow::scrollOneLine(bool forced) {
 	_lines[0]._len = _numChars;
 	_lines[0]._newLine = forced;
 
-	for (int i = _scrollBack - 1; i > 0; i--) {
+	// The rows past _scrollMax are all empty, so only the used ones move
+	for (int i = MIN(_scrollMax, _scrollBack - 1); i > 0; i--)
 		memcpy(&_lines[i], &_lines[i - 1], sizeof(TextBufferRow));
-		if (i < _height)
-			touch(i);
-	}
+	for (int i = 1; i < _height && i < _scrollBack; i++)
+		touch(i);
 
 	if (_radjn)
 		_radjn--;
@@ -1620,13 +1621,12 @@ int TextBufferWindow::calcWidth(const uint32 *chars, const Attributes *attrs, in
 	a = startchar;
 	for (b = startchar; b < numChars; b++) {
 		if (attrs[a] != attrs[b]) {
-			w += screen.stringWidthUni(attrs[a].attrFont(_styles),
-									   Common::U32String(chars + a, b - a), spw);
+			w += screen.stringWidthUni(attrs[a].attrFont(_styles), chars + a, b - a, spw);
 			a = b;
 		}
 	}
 
-	w += screen.stringWidthUni(attrs[a].attrFont(_styles), Common::U32String(chars + a, b - a), spw);
+	w += screen.stringWidthUni(attrs[a].attrFont(_styles), chars + a, b - a, spw);
 
 	return w;
 }
@@ -243,6 +243,10 @@ void Processor::load_all_operands(zbyte specifier) {
 }
 
 void Processor::interpret() {
+	// Checking for a quit queries the event manager, so only do it every
+	// so many instructions. Events are only polled during Glk calls anyway.
+	uint quitCheckCount = 0;
+
 	do {
 		zbyte opcode;
 		CODE_BYTE(opcode);
@@ -288,7 +292,7 @@ void Processor::interpret() {
 		if (end_of_sound_flag)
 			end_of_sound();
 #endif
-	} while (!shouldQuit() && !_finished);
+	} while (((++quitCheckCount & 0x3FF) != 0 || !shouldQuit()) && !_finished);
 
 	_finished--;
 }
@@ -345,6 +345,59 @@ bool Surface::clipBlitRect(int16 &left, int16 &top, int16 &right, int16 &bottom,
 	return true;
 }
 
+/** Copy a rectangle of pixels of one type, optionally transparent and/or mirrored. */
+template<typename T>
+static void blitPixels(byte *dst, const byte *src, uint16 dstPitch, uint16 srcPitch,
+		uint16 width, uint16 height, int32 transp, bool yAxisReflection) {
+
+	const uint32 transpColor = (uint32) transp;
+
+	while (height-- > 0) {
+		      T *dstRow = (      T *) dst;
+		const T *srcRow = (const T *) src;
+
+		if (yAxisReflection) {
+			srcRow += width - 1;
+			for (uint16 i = 0; i < width; i++, dstRow++, srcRow--)
+				if (((uint32) *srcRow) != transpColor)
+					*dstRow = *srcRow;
+		} else if (transp == -1) {
+			memcpy(dstRow, srcRow, width * sizeof(T));
+		} else {
+			for (uint16 i = 0; i < width; i++, dstRow++, srcRow++)
+				if (((uint32) *srcRow) != transpColor)
+					*dstRow = *srcRow;
+		}
+
+		dst += dstPitch * sizeof(T);
+		src += srcPitch * sizeof(T);
+	}
+}
+
+/** Copy a rectangle of pixels of one type, stepping through the source with a fixed point step. */
+template<typename T>
+static void blitScaledPixels(byte *dst, const byte *src, uint16 dstPitch, uint16 srcPitch,
+		uint16 width, uint16 height, frac_t step) {
+
+	frac_t posH = 0;
+	while (height-- > 0) {
+		      T *dstRow = (      T *) dst;
+		const T *srcRow = (const T *) src;
+
+		frac_t posW = 0;
+		for (uint16 i = 0; i < width; i++) {
+			dstRow[i] = srcRow[posW >> FRAC_BITS];
+			posW += step;
+		}
+
+		posH += step;
+		src  += (posH >> FRAC_BITS) * srcPitch * sizeof(T);
+		posH &= FRAC_LO_MASK;
+
+		dst += dstPitch * sizeof(T);
+	}
+}
+
 void Surface::blit(const Surface &from, int16 left, int16 top, int16 right, int16 bottom,
 		int16 x, int16 y, int32 transp, bool yAxisReflection) {
 
@@ -394,28 +447,15 @@ void Surface::blit(const Surface &from, int16 left, int16 top, int16 right, int1
 	// Otherwise, we have to copy by pixel
 
 	// Pointers to the blit destination and source start points
-	     Pixel dst =      get(x   , y);
-	ConstPixel src = from.get(left, top);
-
-	while (height-- > 0) {
-		     Pixel dstRow = dst;
-		ConstPixel srcRow = src;
-
-		if (yAxisReflection) {
-			srcRow += width - 1;
-			for (uint16 i = 0; i < width; i++, ++dstRow, --srcRow)
-				if (srcRow.get() != ((uint32) transp))
-					dstRow.set(srcRow.get());
-		}
-		else {
-			for (uint16 i = 0; i < width; i++, ++dstRow, ++srcRow)
-				if (srcRow.get() != ((uint32) transp))
-					dstRow.set(srcRow.get());
-		}
+	      byte *dst =      getData(x   , y);
+	const byte *src = from.getData(left, top);
 
-		dst +=      _width;
-		src += from._width;
-	}
+	if (_bpp == 1)
+		blitPixels<uint8 >(dst, src, _width, from._width, width, height, transp, yAxisReflection);
+	else if (_bpp == 2)
+		blitPixels<uint16>(dst, src, _width, from._width, width, height, transp, yAxisReflection);
+	else if (_bpp == 4)
+		blitPixels<uint32>(dst, src, _width, from._width, width, height, transp, yAxisReflection);
 }
 
 void Surface::blit(const Surface &from, int16 x, int16 y, int32 transp) {
@@ -465,32 +505,12 @@ void Surface::blitScaled(const Surface &from, int16 left, int16 top, int16 right
 
 	frac_t step = scale.getInverse().toFrac();
 
-	frac_t posW = 0, posH = 0;
-	while (height-- > 0) {
-		      byte *dstRow = dst;
-		const byte *srcRow = src;
-
-		posW = 0;
-
-		for (uint16 i = 0; i < width; i++, dstRow += _bpp) {
-			memmove(dstRow, srcRow, _bpp);
-
-			posW += step;
-			while (posW >= ((frac_t) FRAC_ONE)) {
-				srcRow += from._bpp;
-				posW   -= FRAC_ONE;
-			}
-		}
-
-		posH += step;
-		while (posH >= ((frac_t) FRAC_ONE)) {
-			src  += from._width * from._bpp;
-			posH -= FRAC_ONE;
-		}
-
-		dst += _width * _bpp;
-	}
-
+	if (_bpp == 1)
+		blitScaledPixels<uint8 >(dst, src, _width, from._width, width, height, step);
+	else if (_bpp == 2)
+		blitScaledPixels<uint16>(dst, src, _width, from._width, width, height, step);
+	else if (_bpp == 4)
+		blitScaledPixels<uint32>(dst, src, _width, from._width, width, height, step);
 }
 
 void Surface::blitScaled(const Surface &from, int16 x, int16 y, Common::Rational scale, int32 transp) {
@@ -19,6 +19,10 @@
  *
  */
 
+#include "common/system.h"
+
+#include "audio/mixer.h"
+
 #include "math/line3d.h"
 #include "math/rect2d.h"
 
@@ -1645,6 +1649,8 @@ void Actor::update(uint frameTime) {
 		else
 			posSound = -1;
 		if (posSound != -1) {
+			// Show the mouth of what is heard, not of what was just mixed
+			posSound = MAX<int32>(0, posSound - g_system->getMixer()->getOutputLatency() / 16);
 			int anim = _lipSync->getAnim(posSound);
 			if (_talkAnim != anim) {
 				if (anim != -1) {
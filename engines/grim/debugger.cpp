@@ -39,6 +39,7 @@ Debugger::Debugger() :
 	registerCmd("renderer_get", WRAP_METHOD(Debugger, cmd_renderer_get));
 	registerCmd("save", WRAP_METHOD(Debugger, cmd_save));
 	registerCmd("load", WRAP_METHOD(Debugger, cmd_load));
+	registerCmd("lua_time", WRAP_METHOD(Debugger, cmd_lua_time));
 }
 
 Debugger::~Debugger() {
@@ -134,4 +135,11 @@ bool Debugger::cmd_load(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmd_lua_time(int argc, const char **argv) {
+	unsigned luaTime = g_grim->getLuaTime();
+	unsigned frameTime = g_grim->getFrameWorkTime();
+	debugPrintf("Last frame: %u ms in Lua, %u ms in total\n", luaTime, frameTime);
+	return true;
+}
+
 }
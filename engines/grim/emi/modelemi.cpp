@@ -303,8 +303,15 @@ void EMIModel::draw() {
 	}
 	// We will need to add a call to the skeleton, to get the modified vertices, but for now,
 	// I'll be happy with just static drawing
+	// With shaders, faces using the texture of the previous one don't have to
+	// select it again. The other renderers reset the blending after each face.
+	const bool reselectTextures = !g_driver->supportsShaders();
+	uint32 texID = 0;
 	for (uint32 i = 0; i < _numFaces; i++) {
-		setTex(_faces[i]._texID);
+		if (i == 0 || reselectTextures || _faces[i]._texID != texID) {
+			texID = _faces[i]._texID;
+			setTex(texID);
+		}
 		g_driver->drawEMIModelFace(this, &_faces[i]);
 	}
 
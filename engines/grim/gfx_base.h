@@ -105,6 +105,12 @@ public:
 	 */
 	virtual void flipBuffer(bool opportunistic = false) = 0;
 
+	/**
+	 * The number of draw calls the renderer issued for the last frame,
+	 * 0 with the renderers which don't count them.
+	 */
+	uint getLastFrameDrawCalls() const { return _lastFrameDrawCalls; }
+
 	/**
 	 * FIXME: The implementations of these functions (for Grim and EMI, respectively)
 	 * are very similar. Needs refactoring. See issue #789.
@@ -293,6 +299,7 @@ protected:
 	Math::Vector3d _currentPos;
 	Math::Matrix4 _currentRot;
 	float _dimLevel;
+	uint _drawCalls = 0, _lastFrameDrawCalls = 0;
 };
 
 // Factory-like functions:
@@ -526,6 +526,9 @@ void GfxOpenGLS::flipBuffer(bool opportunistic) {
 		}
 	}
 
+	_lastFrameDrawCalls = _drawCalls;
+	_drawCalls = 0;
+
 	g_system->updateScreen();
 }
 
@@ -979,6 +982,7 @@ void GfxOpenGLS::drawShadowPlanes() {
 	const uint32 attribPos = _shadowPlaneProgram->getAttribute("position")._idx;
 	glEnableVertexAttribArray(attribPos);
 	glVertexAttribPointer(attribPos, 3, GL_FLOAT, GL_TRUE, 3 * sizeof(float), nullptr);
+	++_drawCalls;
 	glDrawElements(GL_TRIANGLES, 3 * sud->_numTriangles, GL_UNSIGNED_SHORT, nullptr);
 
 	glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
@@ -1078,6 +1082,7 @@ void GfxOpenGLS::drawEMIModelFace(const EMIModel* model, const EMIMeshFace* face
 
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, face->_indicesEBO);
 
+	++_drawCalls;
 	glDrawElements(GL_TRIANGLES, 3 * face->_faceLength, GL_UNSIGNED_SHORT, nullptr);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
@@ -1113,6 +1118,7 @@ void GfxOpenGLS::drawMesh(const Mesh *mesh) {
 		actorShader->setUniform("textured", textured ? GL_TRUE : GL_FALSE);
 		actorShader->setUniform("texScale", Math::Vector2d(_selectedTexture->_width, _selectedTexture->_height));
 
+		++_drawCalls;
 		glDrawArrays(GL_TRIANGLES, *(int *)face->_userData, faces);
 	}
 }
@@ -1130,6 +1136,7 @@ void GfxOpenGLS::drawDimPlane() {
 	_dimPlaneProgram->setUniform1f("dim", _dimLevel);
 
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _quadEBO);
+	++_drawCalls;
 	glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
@@ -1189,6 +1196,7 @@ void GfxOpenGLS::drawSprite(const Sprite *sprite) {
 	_spriteProgram->setUniform("uniformColor", color);
 
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _quadEBO);
+	++_drawCalls;
 	glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 	glEnable(GL_DEPTH_TEST);
@@ -1449,6 +1457,7 @@ void GfxOpenGLS::drawBitmap(const Bitmap *bitmap, int dx, int dy, uint32 layer)
 
 			unsigned short startVertex = data->_verts[i]._pos / 4 * 6;
 			unsigned short numVertices = data->_verts[i]._verts / 4 * 6;
+			++_drawCalls;
 			glDrawElements(GL_TRIANGLES, numVertices, GL_UNSIGNED_SHORT, (void *)(startVertex * sizeof(unsigned short)));
 		}
 		return;
@@ -1481,6 +1490,7 @@ void GfxOpenGLS::drawBitmap(const Bitmap *bitmap, int dx, int dy, uint32 layer)
 		shader->setUniform("offsetXY", Math::Vector2d(float(dx) / _gameWidth, float(dy) / _gameHeight));
 		shader->setUniform("sizeWH", Math::Vector2d(width / _gameWidth, height / _gameHeight));
 		shader->setUniform("texcrop", Math::Vector2d(width / nextHigher2((int)width), height / nextHigher2((int)height)));
+		++_drawCalls;
 		glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
 
 		glDisable(GL_BLEND);
@@ -1729,6 +1739,7 @@ void GfxOpenGLS::drawTextObject(const TextObject *text) {
 	td->shader->setUniform("color", colors);
 	glBindTexture(GL_TEXTURE_2D, td->texture);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _quadEBO);
+	++_drawCalls;
 	glDrawElements(GL_TRIANGLES, td->characters * 6, GL_UNSIGNED_SHORT, nullptr);
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 	glEnable(GL_DEPTH_TEST);
@@ -1766,6 +1777,7 @@ void GfxOpenGLS::copyStoredToDisplay() {
 	glDisable(GL_DEPTH_TEST);
 	glDepthMask(GL_FALSE);
 
+	++_drawCalls;
 	glDrawArrays(GL_TRIANGLES, 0, 6);
 
 	glEnable(GL_DEPTH_TEST);
@@ -1816,6 +1828,7 @@ void GfxOpenGLS::dimRegion(int xin, int yReal, int w, int h, float level) {
 	glDisable(GL_DEPTH_TEST);
 	glDepthMask(GL_FALSE);
 
+	++_drawCalls;
 	glDrawArrays(GL_TRIANGLES, 0, 6);
 
 	glEnable(GL_DEPTH_TEST);
@@ -1854,6 +1867,7 @@ void GfxOpenGLS::irisAroundRegion(int x1, int y1, int x2, int y2) {
 	glDisable(GL_DEPTH_TEST);
 	glDepthMask(GL_FALSE);
 
+	++_drawCalls;
 	glDrawArrays(GL_TRIANGLE_STRIP, 0, 10);
 
 	glEnable(GL_DEPTH_TEST);
@@ -1880,6 +1894,7 @@ void GfxOpenGLS::drawEmergString(int x, int y, const char *text, const Color &fg
 		int blockrow = *text / 16;
 		_emergProgram->setUniform("offsetXY", Math::Vector2d(float(x) / _gameWidth, float(y) / _gameHeight));
 		_emergProgram->setUniform("texOffsetXY", Math::Vector2d(float(blockcol * 8) / 128, float(blockrow * 16) / 128));
+		++_drawCalls;
 		glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
 	}
 }
@@ -1934,12 +1949,15 @@ void GfxOpenGLS::drawGenericPrimitive(const float *vertices, uint32 numVertices,
 
 	switch (primitive->getType()) {
 		case PrimitiveObject::RectangleType:
+			++_drawCalls;
 			glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
 			break;
 		case PrimitiveObject::LineType:
+			++_drawCalls;
 			glDrawArrays(GL_LINES, 0, 2);
 			break;
 		case PrimitiveObject::PolygonType:
+			++_drawCalls;
 			glDrawArrays(GL_LINES, 0, 4);
 			break;
 		default:
@@ -2064,6 +2082,7 @@ void GfxOpenGLS::drawMovieFrame(int offsetX, int offsetY) {
 	_smushProgram->setUniform("offset", Math::Vector2d(float(offsetX) / float(_gameWidth), float(offsetY) / float(_gameHeight)));
 	glBindTexture(GL_TEXTURE_2D, _smushTexId);
 
+	++_drawCalls;
 	glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
 
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
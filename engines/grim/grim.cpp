@@ -814,6 +814,7 @@ void GrimEngine::luaUpdate() {
 	}
 
 	LuaBase::instance()->update(_frameTime, _movieTime);
+	_luaTime = g_system->getMillis() - newStart;
 
 	if (_currSet && (_mode == NormalMode || _mode == SmushMode)) {
 		// call updateTalk() before calling update(), since it may modify costumes state, and
@@ -976,9 +977,16 @@ void GrimEngine::doFlip() {
 		return;
 	}
 
-	if (_showFps && _mode != DrawMode)
+	if (_showFps && _mode != DrawMode) {
 		g_driver->drawEmergString(550, 25, _fps, Color(255, 255, 255));
 
+		uint drawCalls = g_driver->getLastFrameDrawCalls();
+		if (drawCalls) {
+			Common::String drawCallsText = Common::String::format("%5u dc", drawCalls);
+			g_driver->drawEmergString(550, 41, drawCallsText.c_str(), Color(255, 255, 255));
+		}
+	}
+
 	if (_flipEnable)
 		g_driver->flipBuffer();
 
@@ -1162,6 +1170,7 @@ void GrimEngine::mainLoop() {
 		if (startTime > endTime)
 			continue;
 		uint32 diffTime = endTime - startTime;
+		_frameWorkTime = diffTime;
 		if (diffTime < _speedLimitMs) {
 			uint32 delayTime = _speedLimitMs - diffTime;
 			g_system->delayMillis(delayTime);
@@ -111,6 +111,9 @@ public:
 	void mainLoop();
 	unsigned getFrameStart() const { return _frameStart; }
 	unsigned getFrameTime() const { return _frameTime; }
+	// The time the last frame spent in the Lua scripts and in total, without the speed limit delay
+	unsigned getLuaTime() const { return _luaTime; }
+	unsigned getFrameWorkTime() const { return _frameWorkTime; }
 
 	// perSecond should allow rates of zero, some actors will accelerate
 	// up to their normal speed (such as the bone wagon) so handling
@@ -249,6 +252,7 @@ protected:
 	Common::String _movieSetup;
 
 	unsigned _frameStart = 0, _frameTime = 0, _movieTime = 0;
+	unsigned _luaTime = 0, _frameWorkTime = 0;
 	int _prevSmushFrame = 0;
 	unsigned int _frameCounter = 0;
 	unsigned int _lastFrameTime = 0;
@@ -56,19 +56,30 @@ static intptr hashindex(TObject *ref) {
 	return (h >= 0 ? h : -(h + 1));
 }
 
+// Strings are interned, so most keys are told apart without a call to luaO_equalObj()
+static inline bool otherKey(TObject *key, TObject *rf) {
+	if (ttype(rf) == LUA_T_NIL)
+		return false;
+	if (ttype(rf) != ttype(key))
+		return true;
+	if (ttype(key) == LUA_T_STRING)
+		return tsvalue(key) != tsvalue(rf);
+	return !luaO_equalObj(key, rf);
+}
+
 int32 present(Hash *t, TObject *key) {
 	int32 tsize = nhash(t);
 	intptr h = hashindex(key);
 	int32 h1 = int32(h % tsize);
 	TObject *rf = ref(node(t, h1));
-	if (ttype(rf) != LUA_T_NIL && !luaO_equalObj(key, rf)) {
+	if (otherKey(key, rf)) {
 		int32 h2 = int32(h % (tsize - 2) + 1);
 		do {
 			h1 += h2;
 			if (h1 >= tsize)
 				h1 -= tsize;
 			rf = ref(node(t, h1));
-		} while (ttype(rf) != LUA_T_NIL && !luaO_equalObj(key, rf));
+		} while (otherKey(key, rf));
 	}
 	return h1;
 }
@@ -27,6 +27,7 @@
 
 #include "groovie/logic/cell.h"
 #include "common/config-manager.h"
+#include "common/threadpool.h"
 
 namespace Groovie {
 
@@ -694,6 +695,10 @@ void CellGame::doGame(int8 color, int depth) {
 		if (_board[55] == 1)
 			_coeff3 = 1;
 		clearMoves();
+		if (depth >= 2 && ThreadPoolMan.getNumThreads() > 1) {
+			doGameParallel(color, depth, type);
+			return;
+		}
 		if (depth) {
 			makeMove(color);
 			_flag4 = false;
@@ -750,6 +755,88 @@ void CellGame::doGame(int8 color, int depth) {
 	}
 }
 
+// Searches the root moves of doGame() on the thread pool, with the same result.
+//
+// The moves are listed first, the way doGame() walks them: searching a move
+// leaves _board and _shadowBoard as they were. Each move is then searched by
+// its own copy of the game, against the loosest bound instead of the best
+// weight so far. calcBestWeight() only cuts off below the bound it is given,
+// so a move it rates at least that best weight gets its exact weight either
+// way, and any other move is rated below it either way. Replaying doGame()'s
+// comparisons on the exact weights thus keeps the same moves.
+void CellGame::doGameParallel(int8 color, int depth, bool type) {
+	Common::Array<RootMove> moves;
+	RootMove move;
+
+	move.startXY = _board[53];
+	move.endXY = _board[54];
+	move.pass = _board[55];
+	move.moveIndex = _board[56];
+	move.coeff3 = _coeff3;
+	moves.push_back(move);
+
+	int8 currBoardWeight = 2 * (2 * _board[color + 48] - _board[49] - _board[50] - _board[51] - _board[52]);
+	while (1) {
+		bool canMove;
+		if (type)
+			canMove = canMoveFunc2(color);
+		else
+			canMove = canMoveFunc1(color);
+
+		if (!canMove)
+			break;
+		if (_flag1)
+			break;
+		_coeff3 = 0;
+		if (_board[55] == 2) {
+			if (getBoardWeight(color, color) == currBoardWeight)
+				continue;
+		}
+		if (_board[55] == 1)
+			_coeff3 = 1;
+
+		move.startXY = _board[53];
+		move.endXY = _board[54];
+		move.pass = _board[55];
+		move.moveIndex = _board[56];
+		move.coeff3 = _coeff3;
+		moves.push_back(move);
+	}
+
+	Common::Array<int8> weights;
+	weights.resize(moves.size());
+
+	ThreadPoolMan.parallelFor(0, moves.size(), [&](uint first, uint last) {
+		CellGame *worker = new CellGame(*this);
+		for (uint i = first; i < last; ++i) {
+			worker->_board[53] = moves[i].startXY;
+			worker->_board[54] = moves[i].endXY;
+			worker->_board[55] = moves[i].pass;
+			worker->_board[56] = moves[i].moveIndex;
+			worker->_coeff3 = moves[i].coeff3;
+			worker->makeMove(color);
+			worker->_flag4 = false;
+			weights[i] = worker->calcBestWeight(color, color, depth, -127);
+		}
+		delete worker;
+	});
+
+	int8 w2 = weights[0];
+	for (uint i = 1; i < moves.size(); ++i) {
+		_board[53] = moves[i].startXY;
+		_board[54] = moves[i].endXY;
+		_board[55] = moves[i].pass;
+		if (weights[i] == w2)
+			pushMove();
+
+		if (weights[i] > w2) {
+			clearMoves();
+			w2 = weights[i];
+		}
+	}
+	chooseBestMove(color);
+}
+
 const int8 depths[] = { 1, 1, 1, 2, 1, 1, 2, 2, 1, 2, 2, 2, 3, 2, 2, 3, 3, 2, 3, 3, 3 };
 
 void CellGame::calcMove(int8 color, uint16 depth) {
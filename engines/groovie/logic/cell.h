@@ -70,6 +70,7 @@ private:
 	void chooseBestMove(int8 color);
 	int8 calcBestWeight(int8 color1, int8 color2, uint16 depth, int bestWeight);
 	void doGame(int8 color, int depth);
+	void doGameParallel(int8 color, int depth, bool type);
 	void calcMove(int8 color, uint16 depth);
 
 	byte _startX;
@@ -90,6 +91,15 @@ private:
 	int8 _stack_pass[128];
 	int _stack_index;
 
+	/** The _board[53] to _board[56] move state and _coeff3 of a root move */
+	struct RootMove {
+		int8 startXY;
+		int8 endXY;
+		int8 pass;
+		int8 moveIndex;
+		int coeff3;
+	};
+
 	int _coeff3;
 	bool _flag1, _flag2, _flag4;
 	int _moveCount;
@@ -109,12 +109,14 @@ typedef cSTLIterator<iRenderable *, tTransperantObjectSet, tTransperantObjectSet
 
 class cOcclusionQueryObject {
 public:
-	cOcclusionQueryObject() : mpQuery(NULL), mpVtxBuffer(NULL), mpMatrix(NULL) {}
+	cOcclusionQueryObject() : mpQuery(NULL), mpVtxBuffer(NULL), mpMatrix(NULL), mlMissedFetches(0) {}
 
 	iOcclusionQuery *mpQuery;
 	iVertexBuffer *mpVtxBuffer;
 	cMatrixf *mpMatrix;
 	bool mbDepthTest;
+	// Number of frames in a row the result of the query wasn't ready in
+	int mlMissedFetches;
 };
 
 class cOcclusionQueryObject_Compare {
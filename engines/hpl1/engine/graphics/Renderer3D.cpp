@@ -494,14 +494,24 @@ void cRenderer3D::FetchOcclusionQueries() {
 	if (mbLog)
 		Log("Fetching Occlusion Queries Result:\n");
 
+	// Results which aren't ready are not waited for, the objects keep the
+	// sample count of an earlier frame. Only when a query has missed too
+	// many frames in a row, the renderer waits for it.
+	const int kMaxMissedFetches = 2;
+
 	// With depth test
 	cOcclusionQueryObjectIterator it = mpRenderList->GetQueryIterator();
 	while (it.HasNext()) {
 		cOcclusionQueryObject *pObject = it.Next();
 		// LogUpdate("Query: %d!\n",pObject->mpQuery);
 
-		while (pObject->mpQuery->FetchResults() == false)
-			;
+		if (pObject->mpQuery->FetchResults()) {
+			pObject->mlMissedFetches = 0;
+		} else if (++pObject->mlMissedFetches > kMaxMissedFetches) {
+			while (pObject->mpQuery->FetchResults() == false)
+				;
+			pObject->mlMissedFetches = 0;
+		}
 
 		if (mbLog)
 			Log(" Query: %d SampleCount: %d\n", pObject->mpQuery,
@@ -112,11 +112,13 @@ void cPhysicsWorldNewton::Simulate(float afTimeStep) {
 
 	// if(lUpdate % 30==0)
 	{
-		while (afTimeStep > mfMaxTimeStep) {
-			NewtonUpdate(mpNewtonWorld, mfMaxTimeStep);
-			afTimeStep -= mfMaxTimeStep;
-		}
-		NewtonUpdate(mpNewtonWorld, afTimeStep);
+		// Split the step into equal parts. Stepping by the max time step and
+		// then the remainder ends with a tiny step that Newton clamps to its
+		// minimum step, costing a full solver pass for next to no time.
+		int lSteps = MAX(1, (int)ceilf(afTimeStep / mfMaxTimeStep - 0.001f));
+		float fStep = afTimeStep / (float)lSteps;
+		for (int i = 0; i < lSteps; ++i)
+			NewtonUpdate(mpNewtonWorld, fStep);
 	}
 	// lUpdate++;
 	// cPhysicsBodyNewton::SetUseCallback(true);
@@ -27,6 +27,7 @@
 
 #include "hpl1/engine/impl/SqScript.h"
 #include "common/file.h"
+#include "common/util.h"
 #include "hpl1/debug.h"
 #include "hpl1/engine/libraries/angelscript/add-ons/scripthelper.h"
 #include "hpl1/engine/libraries/angelscript/angelscript.h"
@@ -75,6 +76,7 @@ bool cSqScript::CreateFromFile(const tString &asFileName) {
 		return false;
 	}
 
+	m_mapCallFunctions.clear();
 	_module = mpScriptEngine->GetModule(msModuleName.c_str(), asGM_ALWAYS_CREATE);
 	if (_module->AddScriptSection(msModuleName.c_str(), pCharBuffer, lLength) < 0) {
 		Error("Couldn't add script '%s'!\n", asFileName.c_str());
@@ -106,7 +108,27 @@ void cSqScript::AddArg(const tString &asArg) {
 //-----------------------------------------------------------------------
 
 bool cSqScript::Run(const tString &asFuncLine) {
-	ExecuteString(mpScriptEngine, asFuncLine.c_str(), _module);
+	unsigned long lStartTime = GetApplicationTime();
+
+	// Calls like "OnUpdate()" run each frame, so run them directly instead of
+	// compiling the line again every time
+	asIScriptFunction *pFunc = GetCallFunction(asFuncLine);
+	if (pFunc) {
+		// A script function can run another line of its own script
+		bool bNested = mpContext->GetState() == asEXECUTION_ACTIVE;
+		asIScriptContext *pContext = bNested ? mpScriptEngine->RequestContext() : mpContext;
+		if (pContext->Prepare(pFunc) >= 0)
+			pContext->Execute();
+		if (bNested)
+			mpScriptEngine->ReturnContext(pContext);
+		else
+			pContext->Unprepare();
+	} else {
+		ExecuteString(mpScriptEngine, asFuncLine.c_str(), _module);
+	}
+
+	Hpl1::logInfo(Hpl1::kDebugScripts, "script '%s' ran '%s' in %lu ms\n", GetName().c_str(),
+				  asFuncLine.c_str(), GetApplicationTime() - lStartTime);
 	return true;
 }
 
@@ -124,6 +146,33 @@ bool cSqScript::Run(int alHandle) {
 
 //-----------------------------------------------------------------------
 
+asIScriptFunction *cSqScript::GetCallFunction(const tString &asFuncLine) {
+	Common::HashMap<tString, asIScriptFunction *>::const_iterator it = m_mapCallFunctions.find(asFuncLine);
+	if (it != m_mapCallFunctions.end())
+		return it->_value;
+
+	asIScriptFunction *pFunc = nullptr;
+	if (asFuncLine.size() > 2 && asFuncLine.hasSuffix("()")) {
+		size_t lNameEnd = asFuncLine.size() - 2;
+		bool bPlainName = true;
+		for (size_t i = 0; i < lNameEnd; ++i) {
+			char c = asFuncLine[i];
+			if (!Common::isAlnum(c) && c != '_')
+				bPlainName = false;
+		}
+		if (bPlainName) {
+			pFunc = _module->GetFunctionByName(asFuncLine.substr(0, lNameEnd).c_str());
+			if (pFunc && pFunc->GetParamCount() != 0)
+				pFunc = nullptr;
+		}
+	}
+
+	m_mapCallFunctions.setVal(asFuncLine, pFunc);
+	return pFunc;
+}
+
+//-----------------------------------------------------------------------
+
 char *cSqScript::LoadCharBuffer(const tString &asFileName, int &alLength) {
 	Common::File file;
 	file.open(Common::Path(asFileName));
@@ -28,6 +28,8 @@
 #ifndef HPL_SQ_SCRIPT_H
 #define HPL_SQ_SCRIPT_H
 
+#include "common/hash-str.h"
+#include "common/hashmap.h"
 #include "hpl1/engine/libraries/angelscript/angelscript.h"
 #include "hpl1/engine/system/Script.h"
 
@@ -55,7 +57,12 @@ private:
 	int mlHandle;
 	tString msModuleName;
 
+	// Functions of the "Name()" lines run so far, nullptr when the name has no
+	// plain function and the line needs to be compiled
+	Common::HashMap<tString, asIScriptFunction *> m_mapCallFunctions;
+
 	char *LoadCharBuffer(const tString &asFileName, int &alLength);
+	asIScriptFunction *GetCallFunction(const tString &asFuncLine);
 };
 
 } // namespace hpl
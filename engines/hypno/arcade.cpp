@@ -263,6 +263,10 @@ void HypnoEngine::runArcade(ArcadeShooting *arc) {
 		segments[_segmentIdx].start = 1;
 	}
 
+	// The background plays on under the shooting, decode a few of its
+	// frames in advance so that drawing the level does not wait for them
+	_background->decoder->setDecodeAhead(4);
+
 	bool shootingPrimary = false;
 	bool shootingSecondary = false;
 	bool needsUpdate = true;
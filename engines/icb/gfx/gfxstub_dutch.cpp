@@ -29,6 +29,7 @@
 #include "engines/icb/gfx/gfxstub_rev_dutch.h"
 
 #include "common/endian.h"
+#include "common/util.h"
 
 namespace ICB {
 
@@ -175,6 +176,31 @@ TextureHandle *RegisterTexture(const RevTexture *revInput) {
 
 void ClearProcessorState() { return; }
 
+// Fetch the clamped texel at (pu, pv) as 0xAARRGGBB, from the palette if the texture has one
+static inline uint32 sampleTexel(const uint8 *texels, int32 pu, int32 pv, int32 mipw, int32 miph, const uint32 *palette) {
+	if (pu < 0)
+		pu = 0;
+	if (pu >= mipw)
+		pu = mipw - 1;
+
+	if (pv < 0)
+		pv = 0;
+	if (pv >= miph)
+		pv = miph - 1;
+
+	uint32 toff = pu + (pv * mipw);
+	if (palette)
+		return palette[texels[toff]];
+
+	// RGB data
+	return READ_LE_UINT32(texels + toff * 4);
+}
+
+// Scale a texture channel by a colour where 128 means a scale of 1.0
+static inline int32 modulateChannel(int32 colour, int32 texel) {
+	return CLIP<int32>((colour * texel) >> 7, 0, 255);
+}
+
 int32 DrawGouraudTexturedPolygon(const vertex2D *verts, int32 nVerts, uint16 z) {
 	int32 i, j, topvert, bottomvert, leftvert, rightvert, nextvert;
 	int32 itopy, ibottomy, spantopy, spanbottomy, count;
@@ -355,6 +381,9 @@ int32 DrawGouraudTexturedPolygon(const vertex2D *verts, int32 nVerts, uint16 z)
 
 	int32 mipw = myTexHan.w >> mip_map_level;
 	int32 miph = myTexHan.h >> mip_map_level;
+	int32 texShift = 8 + mip_map_level;
+	const uint8 *texels = myTexHan.pRGBA[mip_map_level];
+	const uint32 *palette = (myTexHan.bpp > 3) ? nullptr : myTexHan.palette;
 
 	for (i = itopy; i < ibottomy; i++) {
 		count = pspan->x1 - pspan->x0;
@@ -377,67 +406,17 @@ int32 DrawGouraudTexturedPolygon(const vertex2D *verts, int32 nVerts, uint16 z)
 			char *left = myRenDev.pRGB + (myRenDev.RGBPitch * i) + myRenDev.RGBBytesPerPixel * x;
 			char *zleft = myRenDev.pZ + (myRenDev.ZPitch * i) + myRenDev.ZBytesPerPixel * pspan->x0;
 			do {
-				int32 pu = (u >> (8 + mip_map_level));
-				int32 pv = (v >> (8 + mip_map_level));
-
-				if (pu < 0)
-					pu = 0;
-				if (pu >= mipw)
-					pu = mipw - 1;
-
-				if (pv < 0)
-					pv = 0;
-				if (pv >= miph)
-					pv = miph - 1;
-
-				uint32 toff = (pu + (pv * mipw)) * myTexHan.bpp;
-				uint8 *texel = ((uint8 *)(myTexHan.pRGBA[mip_map_level])) + toff;
-
-				// RGB data
-				int32 ta, tr, tg, tb;
-				if (myTexHan.bpp > 3) {
-					ta = *(texel + 3);
-					tr = *(texel + 2);
-					tg = *(texel + 1);
-					tb = *(texel + 0);
-				} else {
-					// Palette data
-					uint8 index = *texel;
-					uint32 colour = myTexHan.palette[index];
-					ta = ((colour >> 24) & 0xFF);
-					tr = ((colour >> 16) & 0xFF);
-					tg = ((colour >> 8) & 0xFF);
-					tb = ((colour >> 0) & 0xFF);
-				}
+				uint32 colour = sampleTexel(texels, u >> texShift, v >> texShift, mipw, miph, palette);
+				int32 ta = ((colour >> 24) & 0xFF);
 
 				// BGR : 128 = scale of 1.0
-				int32 pr = ((r >> 8) * tr);
-				int32 pg = ((g >> 8) * tg);
-				int32 pb = ((b >> 8) * tb);
-
-				if (pr < 0)
-					pr = 0;
-				if (pg < 0)
-					pg = 0;
-				if (pb < 0)
-					pb = 0;
-
-				pr = pr >> 7;
-				pg = pg >> 7;
-				pb = pb >> 7;
-
-				if (pr > 255)
-					pr = 255;
-				if (pg > 255)
-					pg = 255;
-				if (pb > 255)
-					pb = 255;
-
-				*(left + 0) = (char)pb;
-				*(left + 1) = (char)pg;
-				*(left + 2) = (char)pr;
-				*(left + 3) = (char)ta; // use the texture alpha value
-				*(uint16 *)(zleft + 0) = z;
+				int32 pr = modulateChannel(r >> 8, (colour >> 16) & 0xFF);
+				int32 pg = modulateChannel(g >> 8, (colour >> 8) & 0xFF);
+				int32 pb = modulateChannel(b >> 8, (colour >> 0) & 0xFF);
+
+				// use the texture alpha value
+				WRITE_LE_UINT32(left, (ta << 24) | (pr << 16) | (pg << 8) | pb);
+				WRITE_UINT16(zleft, z);
 
 				left += myRenDev.RGBBytesPerPixel;
 				zleft += myRenDev.ZBytesPerPixel;
@@ -928,6 +907,9 @@ int32 DrawFlatTexturedPolygon(const vertex2D *verts, int32 nVerts, uint16 z) {
 
 	int32 mipw = myTexHan.w >> mip_map_level;
 	int32 miph = myTexHan.h >> mip_map_level;
+	int32 texShift = 8 + mip_map_level;
+	const uint8 *texels = myTexHan.pRGBA[mip_map_level];
+	const uint32 *palette = (myTexHan.bpp > 3) ? nullptr : myTexHan.palette;
 
 	for (i = itopy; i < ibottomy; i++) {
 		count = pspan->x1 - pspan->x0;
@@ -942,72 +924,17 @@ int32 DrawFlatTexturedPolygon(const vertex2D *verts, int32 nVerts, uint16 z) {
 			char *left = myRenDev.pRGB + (myRenDev.RGBPitch * i) + myRenDev.RGBBytesPerPixel * x;
 			char *zleft = myRenDev.pZ + (myRenDev.ZPitch * i) + myRenDev.ZBytesPerPixel * pspan->x0;
 			do {
-				int32 pu = (u >> (8 + mip_map_level));
-				int32 pv = (v >> (8 + mip_map_level));
-
-				if (pu < 0)
-					pu = 0;
-				if (pu >= mipw)
-					pu = mipw - 1;
-
-				if (pv < 0)
-					pv = 0;
-				if (pv >= miph)
-					pv = miph - 1;
-
-				uint32 toff = (pu + (pv * mipw)) * myTexHan.bpp;
-				uint8 *texel = ((uint8 *)(myTexHan.pRGBA[mip_map_level])) + toff;
-
-				// RGB data
-				int32 ta, tr, tg, tb;
-				if (myTexHan.bpp > 3) {
-					ta = *(texel + 3);
-					tr = *(texel + 2);
-					tg = *(texel + 1);
-					tb = *(texel + 0);
-				} else {
-					// Palette data
-					uint8 index = *texel;
-					uint32 colour = myTexHan.palette[index];
-					ta = (uint8)((colour >> 24) & 0xFF);
-					tr = (uint8)((colour >> 16) & 0xFF);
-					tg = (uint8)((colour >> 8) & 0xFF);
-					tb = (uint8)((colour >> 0) & 0xFF);
-				}
+				uint32 colour = sampleTexel(texels, u >> texShift, v >> texShift, mipw, miph, palette);
+				int32 ta = ((colour >> 24) & 0xFF);
+
 				// BGR : 128 = scale of 1.0
-				// int32 a = a0;
-				int32 r = r0;
-				int32 g = g0;
-				int32 b = b0;
-
-				r = (r * tr);
-				g = (g * tg);
-				b = (b * tb);
-
-				if (r < 0)
-					r = 0;
-				if (g < 0)
-					g = 0;
-				if (b < 0)
-					b = 0;
-
-				r = r >> 7;
-				g = g >> 7;
-				b = b >> 7;
-
-				if (r > 255)
-					r = 255;
-				if (g > 255)
-					g = 255;
-				if (b > 255)
-					b = 255;
-
-				*(left + 0) = (char)b;
-				*(left + 1) = (char)g;
-				*(left + 2) = (char)r;
-				*(left + 3) = (char)ta; // use the texture alpha value
+				int32 r = modulateChannel(r0, (colour >> 16) & 0xFF);
+				int32 g = modulateChannel(g0, (colour >> 8) & 0xFF);
+				int32 b = modulateChannel(b0, (colour >> 0) & 0xFF);
 
-				*(uint16 *)(zleft + 0) = z;
+				// use the texture alpha value
+				WRITE_LE_UINT32(left, (ta << 24) | (r << 16) | (g << 8) | b);
+				WRITE_UINT16(zleft, z);
 				left += myRenDev.RGBBytesPerPixel;
 				zleft += myRenDev.ZBytesPerPixel;
 				x++;
@@ -3494,11 +3494,13 @@ void Screen::loadPalette(const byte *data, Palette &pal, int bytes) {
 
 // dirty rect handling
 
+static inline int rectArea(const Common::Rect &r) {
+	return r.width() * r.height();
+}
+
 void Screen::addDirtyRect(int x, int y, int w, int h) {
-	if (_dirtyRects.size() >= kMaxDirtyRects || _forceFullUpdate) {
-		_forceFullUpdate = true;
+	if (_forceFullUpdate)
 		return;
-	}
 
 	Common::Rect r(x, y, x + w, y + h);
 
@@ -3509,20 +3511,34 @@ void Screen::addDirtyRect(int x, int y, int w, int h) {
 	if (r.isEmpty())
 		return;
 
-	// Check if the new rectangle is contained within another in the list
+	// Merge the new rectangle with every rectangle in the list whose bounding box
+	// doesn't cover more pixels than the two of them separately. This also drops
+	// rectangles contained in the new one. Since the merged rectangle grows, the
+	// list is scanned again until nothing else can be merged.
 	Common::List<Common::Rect>::iterator it;
-	for (it = _dirtyRects.begin(); it != _dirtyRects.end(); ) {
-		// If we find a rectangle which fully contains the new one,
-		// we can abort the search.
-		if (it->contains(r))
-			return;
+	bool merged;
+	do {
+		merged = false;
+		for (it = _dirtyRects.begin(); it != _dirtyRects.end(); ++it) {
+			// If we find a rectangle which fully contains the new one,
+			// we are done.
+			if (it->contains(r))
+				return;
 
-		// Conversely, if we find rectangles which are contained in
-		// the new one, we can remove them
-		if (r.contains(*it))
-			it = _dirtyRects.erase(it);
-		else
-			++it;
+			Common::Rect bounds = r;
+			bounds.extend(*it);
+			if (rectArea(bounds) <= rectArea(r) + rectArea(*it)) {
+				r = bounds;
+				_dirtyRects.erase(it);
+				merged = true;
+				break;
+			}
+		}
+	} while (merged);
+
+	if (_dirtyRects.size() >= kMaxDirtyRects) {
+		_forceFullUpdate = true;
+		return;
 	}
 
 	// If we got here, we can safely add r to the list of dirty rects.
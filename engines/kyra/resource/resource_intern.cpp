@@ -35,7 +35,7 @@ namespace Kyra {
 // -> PlainArchive implementation
 
 PlainArchive::PlainArchive(Common::ArchiveMemberPtr file)
-	: _file(file), _files() {
+	: Common::MemcachingCaseInsensitiveArchive(kMaxCachedMemberSize, kCacheBudget), _file(file), _files() {
 }
 
 bool PlainArchive::hasFile(const Common::Path &path) const {
@@ -60,16 +60,30 @@ const Common::ArchiveMemberPtr PlainArchive::getMember(const Common::Path &path)
 	return Common::ArchiveMemberPtr(new Common::GenericArchiveMember(path, *this));
 }
 
-Common::SeekableReadStream *PlainArchive::createReadStreamForMember(const Common::Path &path) const {
-	FileMap::const_iterator fDesc = _files.find(path);
+Common::SharedArchiveContents PlainArchive::readContentsForPath(const Common::Path &translatedPath) const {
+	FileMap::const_iterator fDesc = _files.find(translatedPath);
 	if (fDesc == _files.end())
-		return nullptr;
+		return Common::SharedArchiveContents();
 
 	Common::SeekableReadStream *parent = _file->createReadStream();
 	if (!parent)
-		return nullptr;
+		return Common::SharedArchiveContents();
+
+	const Entry &entry = fDesc->_value;
+	if (entry.size > kMaxCachedMemberSize)
+		return Common::SharedArchiveContents::bypass(new Common::SeekableSubReadStream(parent, entry.offset, entry.offset + entry.size, DisposeAfterUse::YES));
+
+	byte *data = new byte[entry.size];
+	parent->seek(entry.offset, SEEK_SET);
+	uint32 bytesRead = parent->read(data, entry.size);
+	delete parent;
+
+	if (bytesRead != entry.size) {
+		delete[] data;
+		return Common::SharedArchiveContents();
+	}
 
-	return new Common::SeekableSubReadStream(parent, fDesc->_value.offset, fDesc->_value.offset + fDesc->_value.size, DisposeAfterUse::YES);
+	return Common::SharedArchiveContents(data, entry.size);
 }
 
 void PlainArchive::addFileEntry(const Common::Path &name, const Entry entry) {
@@ -34,8 +34,14 @@ namespace Kyra {
 
 class Resource;
 
-class PlainArchive : public Common::Archive {
+class PlainArchive : public Common::MemcachingCaseInsensitiveArchive {
 public:
+	// Members up to this size are read into memory and kept around after use,
+	// since scenes keep reloading the same small shapes, scripts and palettes.
+	// Bigger members are streamed straight from the archive file.
+	static const uint32 kMaxCachedMemberSize = 64 * 1024;
+	static const uint32 kCacheBudget = 512 * 1024;
+
 	struct Entry {
 		Entry() : offset(0), size(0) {}
 		Entry(uint32 o, uint32 s) : offset(o), size(s) {}
@@ -53,7 +59,7 @@ public:
 	bool hasFile(const Common::Path &path) const override;
 	int listMembers(Common::ArchiveMemberList &list) const override;
 	const Common::ArchiveMemberPtr getMember(const Common::Path &path) const override;
-	Common::SeekableReadStream *createReadStreamForMember(const Common::Path &path) const override;
+	Common::SharedArchiveContents readContentsForPath(const Common::Path &translatedPath) const override;
 private:
 	typedef Common::HashMap<Common::Path, Entry, Common::Path::IgnoreCase_Hash, Common::Path::IgnoreCase_EqualTo> FileMap;
 
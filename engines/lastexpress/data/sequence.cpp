@@ -75,10 +75,16 @@ void FrameInfo::read(Common::SeekableReadStream *in, bool isSequence) {
 
 // AnimFrame
 
-AnimFrame::AnimFrame(Common::SeekableReadStream *in, const FrameInfo &f, bool /* ignoreSubtype */) : _palette(nullptr) {
+// Longest run any of the decoders writes past the end offset
+static const uint32 kMaxRunLength = 256;
+static const uint32 kScreenSize = 640 * 480;
+
+AnimFrame::AnimFrame(Common::SeekableReadStream *in, const FrameInfo &f, bool /* ignoreSubtype */) : _image(nullptr), _palette(nullptr) {
 	_palSize = 1;
-	// TODO: use just the needed rectangle
-	_image.create(640, 480, Graphics::PixelFormat::createFormatCLUT8());
+	_offset = MIN<uint32>(f.initialSkip / 2, kScreenSize);
+	_size = MIN<uint32>(MAX<uint32>(f.decompressedEndOffset / 2, _offset) + kMaxRunLength, kScreenSize) - _offset;
+	_image = (byte *)calloc(MAX<uint32>(_size, 1), 1);
+	assert(_image);
 
 	//debugC(6, kLastExpressDebugGraphics, "    Offsets: data=%d, unknown=%d, palette=%d", f.dataOffset, f.unknown, f.paletteOffset);
 	//debugC(6, kLastExpressDebugGraphics, "    Position: (%d, %d) - (%d, %d)", f.xPos1, f.yPos1, f.xPos2, f.yPos2);
@@ -122,14 +128,14 @@ AnimFrame::AnimFrame(Common::SeekableReadStream *in, const FrameInfo &f, bool /*
 }
 
 AnimFrame::~AnimFrame() {
-	_image.free();
+	free(_image);
 	delete[] _palette;
 }
 
 Common::Rect AnimFrame::draw(Graphics::Surface *s) {
-	byte *inp = (byte *)_image.getPixels();
-	uint16 *outp = (uint16 *)s->getPixels();
-	for (int i = 0; i < 640 * 480; i++, inp++, outp++) {
+	const byte *inp = _image;
+	uint16 *outp = (uint16 *)s->getPixels() + _offset;
+	for (uint32 i = 0; i < _size; i++, inp++, outp++) {
 		if (*inp)
 			*outp = _palette[*inp];
 	}
@@ -154,9 +160,9 @@ void AnimFrame::decomp4(Common::SeekableReadStream *in, const FrameInfo &f) {
 }
 
 void AnimFrame::decomp34(Common::SeekableReadStream *in, const FrameInfo &f, byte mask, byte shift) {
-	byte *p = (byte *)_image.getPixels();
+	byte *p = _image;
 
-	uint32 skip = f.initialSkip / 2;
+	uint32 skip = _offset;
 	uint32 size = f.decompressedEndOffset / 2;
 	//warning("skip: %d, %d", skip % 640, skip / 640);
 	//warning("size: %d, %d", size % 640, size / 640);
@@ -192,16 +198,16 @@ void AnimFrame::decomp34(Common::SeekableReadStream *in, const FrameInfo &f, byt
 			if (!opcode)
 				opcode = in->readByte();
 			for (int i = 0; i < opcode; i++, out++) {
-				p[out] = value;
+				p[out - skip] = value;
 			}
 		}
 	}
 }
 
 void AnimFrame::decomp5(Common::SeekableReadStream *in, const FrameInfo &f) {
-	byte *p = (byte *)_image.getPixels();
+	byte *p = _image;
 
-	uint32 skip = f.initialSkip / 2;
+	uint32 skip = _offset;
 	uint32 size = f.decompressedEndOffset / 2;
 	//warning("skip: %d, %d", skip % 640, skip / 640);
 	//warning("size: %d, %d", size % 640, size / 640);
@@ -227,16 +233,16 @@ void AnimFrame::decomp5(Common::SeekableReadStream *in, const FrameInfo &f) {
 			if (!opcode)
 				opcode = in->readByte();
 			for (int i = 0; i < opcode; i++, out++) {
-				p[out] = value;
+				p[out - skip] = value;
 			}
 		}
 	}
 }
 
 void AnimFrame::decomp7(Common::SeekableReadStream *in, const FrameInfo &f) {
-	byte *p = (byte *)_image.getPixels();
+	byte *p = _image;
 
-	uint32 skip = f.initialSkip / 2;
+	uint32 skip = _offset;
 	uint32 size = f.decompressedEndOffset / 2;
 	//warning("skip: %d, %d", skip % 640, skip / 640);
 	//warning("size: %d, %d", size % 640, size / 640);
@@ -273,23 +279,23 @@ void AnimFrame::decomp7(Common::SeekableReadStream *in, const FrameInfo &f) {
 				if (_palSize <= value)
 					_palSize = value + 1;
 				for (int i = 0; i < opcode; i++, out++) {
-					p[out] = value;
+					p[out - skip] = value;
 				}
 			}
 		} else {
 			if (_palSize <= opcode)
 				_palSize = opcode + 1;
 			// set the given value
-			p[out] = (byte)opcode;
+			p[out - skip] = (byte)opcode;
 			out++;
 		}
 	}
 }
 
 void AnimFrame::decompFF(Common::SeekableReadStream *in, const FrameInfo &f) {
-	byte *p = (byte *)_image.getPixels();
+	byte *p = _image;
 
-	uint32 skip = f.initialSkip / 2;
+	uint32 skip = _offset;
 	uint32 size = f.decompressedEndOffset / 2;
 
 	in->seek((int)f.dataOffset);
@@ -300,16 +306,17 @@ void AnimFrame::decompFF(Common::SeekableReadStream *in, const FrameInfo &f) {
 			if (_palSize <= opcode)
 				_palSize = opcode + 1;
 			// set the given value
-			p[out] = (byte)opcode;
+			p[out - skip] = (byte)opcode;
 			out++;
 		} else {
 			if (opcode < 0xf0) {
 				if (opcode < 0xe0) {
 					// copy old part
-					uint32 old = out + ((opcode & 0x7) << 8) + in->readByte() - 2048;
+					int32 old = (int32)out + ((opcode & 0x7) << 8) + in->readByte() - 2048;
 					opcode = ((opcode >> 3) & 0xf) + 3;
 					for (int i = 0; i < opcode; i++, out++, old++) {
-						p[out] = p[old];
+						// Anything before the initial skip is empty
+						p[out - skip] = (old >= (int32)skip) ? p[old - skip] : 0;
 					}
 				} else {
 					opcode = (opcode & 0xf) + 1;
@@ -317,7 +324,7 @@ void AnimFrame::decompFF(Common::SeekableReadStream *in, const FrameInfo &f) {
 					if (_palSize <= value)
 						_palSize = value + 1;
 					for (int i = 0; i < opcode; i++, out++) {
-						p[out] = value;
+						p[out - skip] = value;
 					}
 				}
 			} else {
@@ -337,6 +344,7 @@ Sequence::~Sequence() {
 }
 
 void Sequence::reset() {
+	clearFrameCache();
 	_frames.clear();
 	delete _stream;
 	_stream = nullptr;
@@ -419,6 +427,44 @@ AnimFrame *Sequence::getFrame(uint16 index) {
 	return new AnimFrame(_stream, *frame);
 }
 
+AnimFrame *Sequence::getCachedFrame(uint16 index) {
+	for (uint i = 0; i < _frameCache.size(); i++) {
+		if (_frameCache[i].index != index)
+			continue;
+
+		// Move the frame to the front
+		CachedFrame cached = _frameCache[i];
+		for (uint j = i; j > 0; j--)
+			_frameCache[j] = _frameCache[j - 1];
+		_frameCache[0] = cached;
+
+		return cached.frame;
+	}
+
+	AnimFrame *frame = getFrame(index);
+	if (!frame)
+		return nullptr;
+
+	if (_frameCache.size() == _frameCacheSize) {
+		delete _frameCache.back().frame;
+		_frameCache.pop_back();
+	}
+
+	CachedFrame cached;
+	cached.index = index;
+	cached.frame = frame;
+	_frameCache.insert_at(0, cached);
+
+	return frame;
+}
+
+void Sequence::clearFrameCache() {
+	for (uint i = 0; i < _frameCache.size(); i++)
+		delete _frameCache[i].frame;
+
+	_frameCache.clear();
+}
+
 //////////////////////////////////////////////////////////////////////////
 // SequenceFrame
 SequenceFrame::~SequenceFrame() {
@@ -433,15 +479,11 @@ Common::Rect SequenceFrame::draw(Graphics::Surface *surface) {
 	if (!_sequence || _frame >= _sequence->count())
 		return Common::Rect();
 
-	AnimFrame *f = _sequence->getFrame(_frame);
+	AnimFrame *f = _sequence->getCachedFrame(_frame);
 	if (!f)
 		return Common::Rect();
 
-	Common::Rect rect = f->draw(surface);
-
-	delete f;
-
-	return rect;
+	return f->draw(surface);
 }
 
 bool SequenceFrame::setFrame(uint16 frame) {
@@ -142,7 +142,11 @@ private:
 	void decompFF(Common::SeekableReadStream *in, const FrameInfo &f);
 	void readPalette(Common::SeekableReadStream *in, const FrameInfo &f);
 
-	Graphics::Surface _image;
+	// Only the part of the screen between the initial skip and the end
+	// offset of the frame is stored, starting at screen offset _offset
+	byte *_image;
+	uint32 _offset;
+	uint32 _size;
 	uint16 _palSize;
 	uint16 *_palette;
 	Common::Rect _rect;
@@ -159,6 +163,7 @@ public:
 
 	uint16 count() const { return (uint16)_frames.size(); }
 	AnimFrame *getFrame(uint16 index = 0);
+	AnimFrame *getCachedFrame(uint16 index = 0);
 	FrameInfo *getFrameInfo(uint16 index = 0);
 
 	Common::String getName() { return _name; }
@@ -169,10 +174,18 @@ public:
 private:
 	static const uint32 _sequenceHeaderSize = 8;
 	static const uint32 _sequenceFrameSize = 68;
+	static const uint32 _frameCacheSize = 4;
+
+	struct CachedFrame {
+		uint16 index;
+		AnimFrame *frame;
+	};
 
 	void reset();
+	void clearFrameCache();
 
 	Common::Array<FrameInfo> _frames;
+	Common::Array<CachedFrame> _frameCache; ///< Decoded frames, most recently used first
 	Common::SeekableReadStream *_stream;
 	bool _isLoaded;
 
@@ -26,6 +26,7 @@
 #include "backends/keymapper/keymap.h"
 #include "backends/keymapper/standard-actions.h"
 
+#include "common/config-manager.h"
 #include "common/savefile.h"
 #include "common/system.h"
 #include "common/translation.h"
@@ -362,6 +363,78 @@ int MetaEngine::findEmptySaveSlot(const char *target) {
 	return -1;
 }
 
+namespace {
+
+/**
+ * The descriptors of the saves of a target, with the stamps of the files
+ * they were read from. Listing the saves reads them from here instead of
+ * opening every save, which means decompressing all of it to get to the
+ * header at its end.
+ */
+struct SaveIndexEntry {
+	int64 size;
+	int64 modified;
+	SaveStateDescriptor desc;
+};
+
+typedef Common::HashMap<Common::String, SaveIndexEntry, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> SaveIndex;
+
+const uint32 kSaveIndexTag = MKTAG('S', 'V', 'I', '1');
+
+Common::String getSaveIndexName(const char *target) {
+	// Not starting with the target, so that no savefile pattern matches it
+	return Common::String::format("saveindex-%s", target);
+}
+
+void loadSaveIndex(Common::SaveFileManager *saveFileMan, const Common::String &name, SaveIndex &index) {
+	Common::ScopedPtr<Common::InSaveFile> in(saveFileMan->openForLoading(name));
+	if (!in)
+		return;
+
+	const uint32 tag = in->readUint32BE();
+	const uint32 count = in->readUint32LE();
+	if (in->err() || in->eos() || tag != kSaveIndexTag)
+		return;
+
+	for (uint32 i = 0; i < count; ++i) {
+		const Common::String file = in->readString();
+		SaveIndexEntry entry;
+		entry.size = in->readSint64LE();
+		entry.modified = in->readSint64LE();
+		if (!entry.desc.loadFromStream(*in)) {
+			index.clear();
+			return;
+		}
+		index.setVal(file, entry);
+	}
+}
+
+void saveSaveIndex(Common::SaveFileManager *saveFileMan, const Common::String &name, const SaveIndex &index) {
+	Common::OutSaveFile *out = saveFileMan->openForSaving(name);
+	if (!out)
+		return;
+
+	out->writeUint32BE(kSaveIndexTag);
+	out->writeUint32LE(index.size());
+	for (const auto &entry : index) {
+		out->writeString(entry._key);
+		out->writeByte(0);
+		out->writeSint64LE(entry._value.size);
+		out->writeSint64LE(entry._value.modified);
+		entry._value.desc.saveToStream(*out);
+	}
+	out->finalize();
+
+	const bool failed = out->err();
+	delete out;
+	if (failed) {
+		warning("Could not write '%s'", name.c_str());
+		saveFileMan->removeSavefile(name);
+	}
+}
+
+} // End of anonymous namespace
+
 SaveStateList MetaEngine::listSaves(const char *target) const {
 	if (!hasFeature(kSavesUseExtendedFormat))
 		return SaveStateList();
@@ -372,6 +445,13 @@ SaveStateList MetaEngine::listSaves(const char *target) const {
 
 	filenames = saveFileMan->listSavefiles(pattern);
 
+	const bool useIndex = ConfMan.getBool("save_index");
+	const Common::String indexName = getSaveIndexName(target);
+	SaveIndex index, newIndex;
+	bool indexChanged = false;
+	if (useIndex)
+		loadSaveIndex(saveFileMan, indexName, index);
+
 	SaveStateList saveList;
 	for (const auto &file : filenames) {
 		// Obtain the last 2/3 digits of the filename, since they correspond to the save slot
@@ -382,13 +462,32 @@ SaveStateList MetaEngine::listSaves(const char *target) const {
 		int slotNum = atoi(slotStr);
 
 		if (slotNum >= 0 && slotNum <= getMaximumSaveSlot()) {
-			SaveStateDescriptor desc = querySaveMetaInfos(target, slotNum);
-			if (desc.getSaveSlot() != -1) {
-				saveList.push_back(desc);
+			SaveIndexEntry entry;
+			const bool stamped = useIndex && saveFileMan->getSavefileStamp(file, entry.size, entry.modified);
+			const SaveIndex::const_iterator indexed = stamped ? index.find(file) : index.end();
+
+			if (indexed != index.end() && indexed->_value.size == entry.size && indexed->_value.modified == entry.modified) {
+				entry.desc = indexed->_value.desc;
+			} else {
+				// Invalid descriptors are kept as well, so that broken
+				// files are not read again
+				entry.desc = querySaveMetaInfos(target, slotNum);
+				indexChanged |= stamped;
+			}
+
+			if (stamped)
+				newIndex.setVal(file, entry);
+
+			if (entry.desc.getSaveSlot() != -1) {
+				saveList.push_back(entry.desc);
 			}
 		}
 	}
 
+	// Also drop the entries of deleted saves
+	if (useIndex && (indexChanged || newIndex.size() != index.size()))
+		saveSaveIndex(saveFileMan, indexName, newIndex);
+
 	// Sort saves based on slot number.
 	Common::sort(saveList.begin(), saveList.end(), SaveStateDescriptorSlotComparator());
 	return saveList;
@@ -87,14 +87,26 @@ void GraphicsManager::clearCache() {
 	_subImageCache.clear();
 }
 
+uint32 GraphicsManager::getCacheSize() const {
+	uint32 size = 0;
+	for (Common::HashMap<uint16, MohawkSurface *>::const_iterator it = _cache.begin(); it != _cache.end(); it++) {
+		const Graphics::Surface *surface = it->_value->getSurface();
+		size += surface->h * surface->pitch;
+	}
+	for (Common::HashMap<uint16, Common::Array<MohawkSurface *> >::const_iterator it = _subImageCache.begin(); it != _subImageCache.end(); it++) {
+		const Common::Array<MohawkSurface *> &array = it->_value;
+		for (uint i = 0; i < array.size(); i++)
+			size += array[i]->getSurface()->h * array[i]->getSurface()->pitch;
+	}
+	return size;
+}
+
 MohawkSurface *GraphicsManager::findImage(uint16 id) {
 	if (!_cache.contains(id))
 		_cache[id] = decodeImage(id);
 
-	// TODO: Probably would be nice to limit the size of the cache
-	// Currently, this can't get large because it is freed on every
-	// card/stack change in Myst/Riven so I'm not worried about it.
-	// Doesn't mean this shouldn't be done in the future.
+	// The cache is freed on every card change in Myst, and in Riven on
+	// stack changes and when it exceeds its budget on card changes.
 
 	return _cache[id];
 }
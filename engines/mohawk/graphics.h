@@ -73,6 +73,9 @@ public:
 	// Free all surfaces in the cache
 	void clearCache();
 
+	// The memory used by the surfaces in the cache, in bytes
+	uint32 getCacheSize() const;
+
 	// findImage will search the cache to find the image.
 	// If not found, it will call decodeImage to get a new one.
 	MohawkSurface *findImage(uint16 id);
@@ -610,12 +610,17 @@ static const RivenSpecialChange rivenSpecialChange[] = {
 	{ kStackTspit, 0x21b69, kStackOspit,  0x2e76 }  // Dome Linking Book
 };
 
+// The memory the decoded images of the visited cards of a stack can use
+static const uint32 kImageCacheBudget = 32 * 1024 * 1024;
+
 void MohawkEngine_Riven::changeToCard(uint16 dest) {
 	debug (1, "Changing to card %d", dest);
 
-	// Clear the graphics cache (images typically aren't used
-	// on different cards).
-	_gfx->clearCache();
+	// Keep the images of the recently visited cards of this stack, as
+	// looking around goes back and forth between the same cards. The
+	// cache is only cleared once it exceeds its budget.
+	if (_gfx->getCacheSize() > kImageCacheBudget)
+		_gfx->clearCache();
 
 	if (!isGameVariant(GF_DEMO)) {
 		for (byte i = 0; i < ARRAYSIZE(rivenSpecialChange); i++)
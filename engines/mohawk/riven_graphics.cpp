@@ -370,11 +370,13 @@ void RivenGraphics::copyImageToScreen(uint16 image, uint32 left, uint32 top, uin
 	beginScreenUpdate();
 
 	// Clip the width to fit on the screen. Fixes some images.
-	if (left + surface->w > 608)
-		surface->w = 608 - left;
+	// The cached surface is left untouched, as it can be drawn again elsewhere.
+	uint16 width = surface->w;
+	if (left + width > 608)
+		width = 608 - left;
 
 	for (uint16 i = 0; i < surface->h; i++)
-		memcpy(_mainScreen->getBasePtr(left, i + top), surface->getBasePtr(0, i), surface->w * surface->format.bytesPerPixel);
+		memcpy(_mainScreen->getBasePtr(left, i + top), surface->getBasePtr(0, i), width * surface->format.bytesPerPixel);
 
 	_dirtyScreen = true;
 	applyScreenUpdate();
@@ -435,11 +437,27 @@ WaterEffect::WaterEffect(MohawkEngine_Riven *vm, uint16 sfxeID) :
 	for (uint16 i = 0; i < frameCount; i++)
 		frameOffsets[i] = sfxeStream->readUint32BE();
 
-	// Read in the scripts
-	sfxeStream->seek(frameOffsets[0]);
+	// Decode the scripts
+	_frames.resize(frameCount);
 	for (uint16 i = 0; i < frameCount; i++) {
-		uint scriptLength = (i == frameCount - 1) ? sfxeStream->size() - frameOffsets[i] : frameOffsets[i + 1] - frameOffsets[i];
-		_frameScripts.push_back(sfxeStream->readStream(scriptLength));
+		sfxeStream->seek(frameOffsets[i]);
+
+		uint16 curRow = 0;
+		for (uint16 op = sfxeStream->readUint16BE(); op != 4; op = sfxeStream->readUint16BE()) {
+			if (op == 1) {        // Increment Row
+				curRow++;
+			} else if (op == 3) { // Copy Pixels
+				CopyOp copy;
+				copy.row = curRow;
+				copy.dstLeft = sfxeStream->readUint16BE();
+				copy.srcLeft = sfxeStream->readUint16BE();
+				copy.srcTop = sfxeStream->readUint16BE();
+				copy.width = sfxeStream->readUint16BE();
+				_frames[i].push_back(copy);
+			} else {
+				error ("Unknown SFXE opcode %d", op);
+			}
+		}
 	}
 
 	// Set it to the first frame
@@ -454,39 +472,25 @@ void WaterEffect::update() {
 		return; // Nothing to do yet
 	}
 
-	// Make sure the script is at the starting point
-	Common::SeekableReadStream *script = _frameScripts[_curFrame];
-	script->seek(0);
-
 	Graphics::Surface *screen = _vm->_system->lockScreen();
 	Graphics::Surface *mainScreen = _vm->_gfx->getBackScreen();
 	assert(screen->format == mainScreen->format);
 
 	// Run script
-	uint16 curRow = 0;
-	for (uint16 op = script->readUint16BE(); op != 4; op = script->readUint16BE()) {
-		if (op == 1) {        // Increment Row
-			curRow++;
-		} else if (op == 3) { // Copy Pixels
-			uint16 dstLeft = script->readUint16BE();
-			uint16 srcLeft = script->readUint16BE();
-			uint16 srcTop = script->readUint16BE();
-			uint16 rowWidth = script->readUint16BE();
-
-			byte *src = (byte *)mainScreen->getBasePtr(srcLeft, srcTop);
-			byte *dst = (byte *)screen->getBasePtr(dstLeft, curRow + _rect.top);
-
-			memcpy(dst, src, rowWidth * screen->format.bytesPerPixel);
-		} else if (op != 4) { // End of Script
-			error ("Unknown SFXE opcode %d", op);
-		}
+	const Common::Array<CopyOp> &frame = _frames[_curFrame];
+	for (uint i = 0; i < frame.size(); i++) {
+		const CopyOp &copy = frame[i];
+		byte *src = (byte *)mainScreen->getBasePtr(copy.srcLeft, copy.srcTop);
+		byte *dst = (byte *)screen->getBasePtr(copy.dstLeft, copy.row + _rect.top);
+
+		memcpy(dst, src, copy.width * screen->format.bytesPerPixel);
 	}
 
 	_vm->_system->unlockScreen();
 
 	// Increment frame
 	_curFrame++;
-	if (_curFrame == _frameScripts.size())
+	if (_curFrame == _frames.size())
 		_curFrame = 0;
 
 	// Set the new time
@@ -494,9 +498,6 @@ void WaterEffect::update() {
 }
 
 WaterEffect::~WaterEffect() {
-	for (uint i = 0; i < _frameScripts.size(); i++) {
-		delete _frameScripts[i];
-	}
 }
 
 void RivenGraphics::setTransitionMode(RivenTransitionMode mode) {
@@ -160,10 +160,20 @@ public:
 private:
 	MohawkEngine_Riven *_vm;
 
+	// A row copy of a frame script
+	struct CopyOp {
+		uint16 row;
+		uint16 dstLeft;
+		uint16 srcLeft;
+		uint16 srcTop;
+		uint16 width;
+	};
+
 	// Record values
 	Common::Rect _rect;
 	uint16 _speed;
-	Common::Array<Common::SeekableReadStream *> _frameScripts;
+	// The frame scripts, decoded when the effect is loaded
+	Common::Array<Common::Array<CopyOp> > _frames;
 
 	// Cur frame
 	uint16 _curFrame;
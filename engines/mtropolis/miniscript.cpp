@@ -145,8 +145,13 @@ Common::WeakPtr<RuntimeObject> MiniscriptReferences::getGlobalRefByIndex(uint in
 	
 }
 
+MiniscriptProgram::Attribute::Attribute() : builtin(kBuiltinAttributeNone) {
+}
+
 MiniscriptProgram::MiniscriptProgram(const Common::SharedPtr<Common::Array<uint8> > &programData, const Common::Array<MiniscriptInstruction *> &instructions, const Common::Array<Attribute> &attributes)
-	: _programData(programData), _instructions(instructions), _attributes(attributes) {
+	: _programData(programData), _instructions(instructions), _attributes(attributes), _stackDepthHint(0) {
+	for (Attribute &attrib : _attributes)
+		attrib.builtin = resolveBuiltinAttribute(attrib.name);
 }
 
 MiniscriptProgram::~MiniscriptProgram() {
@@ -163,6 +168,36 @@ const Common::Array<MiniscriptProgram::Attribute> &MiniscriptProgram::getAttribu
 	return _attributes;
 }
 
+size_t MiniscriptProgram::getStackDepthHint() const {
+	return _stackDepthHint;
+}
+
+void MiniscriptProgram::updateStackDepthHint(size_t depth) {
+	if (depth > _stackDepthHint)
+		_stackDepthHint = depth;
+}
+
+MiniscriptProgram::BuiltinAttribute MiniscriptProgram::resolveBuiltinAttribute(const Common::String &name) {
+	if (name == "x")
+		return kBuiltinAttributeX;
+	if (name == "y")
+		return kBuiltinAttributeY;
+	if (name == "start")
+		return kBuiltinAttributeStart;
+	if (name == "end")
+		return kBuiltinAttributeEnd;
+	if (name == "angle")
+		return kBuiltinAttributeAngle;
+	if (name == "magnitude")
+		return kBuiltinAttributeMagnitude;
+	if (name == "count")
+		return kBuiltinAttributeCount;
+	if (name == "value")
+		return kBuiltinAttributeValue;
+
+	return kBuiltinAttributeNone;
+}
+
 template<class T>
 struct MiniscriptInstructionLoader {
 	static bool loadInstruction(void *dest, uint32 instrFlags, Data::DataReader &instrDataReader, IMiniscriptInstructionParserFeedback &feedback);
@@ -1443,7 +1478,8 @@ MiniscriptInstructionOutcome GetChild::execute(MiniscriptThread *thread) const {
 		return kMiniscriptInstructionOutcomeFailed;
 	}
 
-	const Common::String &attrib = attribs[_attribute].name;
+	const MiniscriptProgram::Attribute &attribDef = attribs[_attribute];
+	const Common::String &attrib = attribDef.name;
 
 	MiniscriptInstructionOutcome outcome = kMiniscriptInstructionOutcomeFailed;
 
@@ -1492,7 +1528,7 @@ MiniscriptInstructionOutcome GetChild::execute(MiniscriptThread *thread) const {
 				return kMiniscriptInstructionOutcomeFailed;
 			}
 		} else {
-			outcome = readRValueAttribIndexed(thread, indexableValueSlot.value, attrib, indexSlot.value);
+			outcome = readRValueAttribIndexed(thread, indexableValueSlot.value, attribDef, indexSlot.value);
 			if (outcome != kMiniscriptInstructionOutcomeContinue)
 				return outcome;
 		}
@@ -1535,19 +1571,21 @@ MiniscriptInstructionOutcome GetChild::execute(MiniscriptThread *thread) const {
 				return kMiniscriptInstructionOutcomeFailed;
 			}
 		} else {
-			outcome = readRValueAttrib(thread, indexableValueSlot.value, attrib);
+			outcome = readRValueAttrib(thread, indexableValueSlot.value, attribDef);
 		}
 	}
 
 	return outcome;
 }
 
-MiniscriptInstructionOutcome GetChild::readRValueAttrib(MiniscriptThread *thread, DynamicValue &valueSrcDest, const Common::String &attrib) const {
+MiniscriptInstructionOutcome GetChild::readRValueAttrib(MiniscriptThread *thread, DynamicValue &valueSrcDest, const MiniscriptProgram::Attribute &attribDef) const {
+	const Common::String &attrib = attribDef.name;
+
 	switch (valueSrcDest.getType()) {
 	case DynamicValueTypes::kPoint:
-		if (attrib == "x")
+		if (attribDef.builtin == MiniscriptProgram::kBuiltinAttributeX)
 			valueSrcDest.setInt(valueSrcDest.getPoint().x);
-		else if (attrib == "y")
+		else if (attribDef.builtin == MiniscriptProgram::kBuiltinAttributeY)
 			valueSrcDest.setInt(valueSrcDest.getPoint().y);
 		else {
 			thread->error("Point has no attribute '" + attrib + "'");
@@ -1555,9 +1593,9 @@ MiniscriptInstructionOutcome GetChild::readRValueAttrib(MiniscriptThread *thread
 		}
 		break;
 	case DynamicValueTypes::kIntegerRange:
-		if (attrib == "start")
+		if (attribDef.builtin == MiniscriptProgram::kBuiltinAttributeStart)
 			valueSrcDest.setInt(valueSrcDest.getIntRange().min);
-		else if (attrib == "end")
+		else if (attribDef.builtin == MiniscriptProgram::kBuiltinAttributeEnd)
 			valueSrcDest.setInt(valueSrcDest.getIntRange().max);
 		else {
 			thread->error("Integer range has no attribute '" + attrib + "'");
@@ -1566,9 +1604,9 @@ MiniscriptInstructionOutcome GetChild::readRValueAttrib(MiniscriptThread *thread
 		break;
 
 	case DynamicValueTypes::kVector:
-		if (attrib == "angle")
+		if (attribDef.builtin == MiniscriptProgram::kBuiltinAttributeAngle)
 			valueSrcDest.setFloat(valueSrcDest.getVector().angleDegrees);
-		else if (attrib == "magnitude")
+		else if (attribDef.builtin == MiniscriptProgram::kBuiltinAttributeMagnitude)
 			valueSrcDest.setFloat(valueSrcDest.getVector().magnitude);
 		else {
 			thread->error("Vector has no attribute '" + attrib + "'");
@@ -1587,7 +1625,7 @@ MiniscriptInstructionOutcome GetChild::readRValueAttrib(MiniscriptThread *thread
 		} break;
 	case DynamicValueTypes::kList: {
 			Common::SharedPtr<DynamicList> list = valueSrcDest.getList();
-			if (attrib == "count") {
+			if (attribDef.builtin == MiniscriptProgram::kBuiltinAttributeCount) {
 				valueSrcDest.setInt(list->getSize());
 			} else {
 				thread->error("Unable to read list attribute '" + attrib + "'");
@@ -1602,10 +1640,12 @@ MiniscriptInstructionOutcome GetChild::readRValueAttrib(MiniscriptThread *thread
 	return kMiniscriptInstructionOutcomeContinue;
 }
 
-MiniscriptInstructionOutcome GetChild::readRValueAttribIndexed(MiniscriptThread *thread, DynamicValue &valueSrcDest, const Common::String &attrib, const DynamicValue &index) const {
+MiniscriptInstructionOutcome GetChild::readRValueAttribIndexed(MiniscriptThread *thread, DynamicValue &valueSrcDest, const MiniscriptProgram::Attribute &attribDef, const DynamicValue &index) const {
+	const Common::String &attrib = attribDef.name;
+
 	switch (valueSrcDest.getType()) {
 	case DynamicValueTypes::kList:
-		if (attrib == "value") {
+		if (attribDef.builtin == MiniscriptProgram::kBuiltinAttributeValue) {
 			// Hold list ref since it may get released by the read operation
 			Common::SharedPtr<DynamicList> list = valueSrcDest.getList();
 			size_t realIndex = 0;
@@ -1908,7 +1948,14 @@ MiniscriptInstructionOutcome Jump::execute(MiniscriptThread *thread) const {
 } // End of namespace MiniscriptInstructions
 
 MiniscriptThread::MiniscriptThread(Runtime *runtime, const Common::SharedPtr<MessageProperties> &msgProps, const Common::SharedPtr<MiniscriptProgram> &program, const Common::SharedPtr<MiniscriptReferences> &refs, Modifier *modifier)
-	: _runtime(runtime), _msgProps(msgProps), _program(program), _refs(refs), _modifier(modifier), _currentInstruction(0), _failed(false) {
+	: _runtime(runtime), _msgProps(msgProps), _program(program), _refs(refs), _modifier(modifier), _maxStackDepth(0), _currentInstruction(0), _failed(false) {
+	if (program)
+		_stack.reserve(program->getStackDepthHint());
+}
+
+MiniscriptThread::~MiniscriptThread() {
+	if (_program)
+		_program->updateStackDepthHint(_maxStackDepth);
 }
 
 void MiniscriptThread::error(const Common::String &message) {
@@ -1947,11 +1994,14 @@ void MiniscriptThread::pushValue(const DynamicValue &value) {
 
 	MiniscriptStackValue &stackValue = _stack.back();
 	stackValue.value = value;
+
+	if (_stack.size() > _maxStackDepth)
+		_maxStackDepth = _stack.size();
 }
 
 void MiniscriptThread::popValues(size_t count) {
-	while (count--)
-		_stack.pop_back();
+	assert(count <= _stack.size());
+	_stack.resize(_stack.size() - count);
 }
 
 size_t MiniscriptThread::getStackSize() const {
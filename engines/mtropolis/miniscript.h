@@ -81,8 +81,25 @@ private:
 class MiniscriptProgram {
 public:
 
+	// Attributes of value types that GetChild resolves without string comparisons
+	enum BuiltinAttribute {
+		kBuiltinAttributeNone,
+
+		kBuiltinAttributeX,
+		kBuiltinAttributeY,
+		kBuiltinAttributeStart,
+		kBuiltinAttributeEnd,
+		kBuiltinAttributeAngle,
+		kBuiltinAttributeMagnitude,
+		kBuiltinAttributeCount,
+		kBuiltinAttributeValue,
+	};
+
 	struct Attribute {
+		Attribute();
+
 		Common::String name;
+		BuiltinAttribute builtin;
 	};
 
 	MiniscriptProgram(const Common::SharedPtr<Common::Array<uint8> > &programData, const Common::Array<MiniscriptInstruction *> &instructions, const Common::Array<Attribute> &attributes);
@@ -91,10 +108,17 @@ public:
 	const Common::Array<MiniscriptInstruction *> &getInstructions() const;
 	const Common::Array<Attribute> &getAttributes() const;
 
+	// Deepest stack seen by a thread running the program, used to size the stack of the next one
+	size_t getStackDepthHint() const;
+	void updateStackDepthHint(size_t depth);
+
 private:
+	static BuiltinAttribute resolveBuiltinAttribute(const Common::String &name);
+
 	Common::SharedPtr<Common::Array<uint8> > _programData;
 	Common::Array<MiniscriptInstruction *> _instructions;
 	Common::Array<Attribute> _attributes;
+	size_t _stackDepthHint;
 };
 
 class MiniscriptParser {
@@ -310,8 +334,8 @@ namespace MiniscriptInstructions {
 
 	private:
 		MiniscriptInstructionOutcome execute(MiniscriptThread *thread) const override;
-		MiniscriptInstructionOutcome readRValueAttrib(MiniscriptThread *thread, DynamicValue &valueSrcDest, const Common::String &attrib) const;
-		MiniscriptInstructionOutcome readRValueAttribIndexed(MiniscriptThread *thread, DynamicValue &valueSrcDest, const Common::String &attrib, const DynamicValue &index) const;
+		MiniscriptInstructionOutcome readRValueAttrib(MiniscriptThread *thread, DynamicValue &valueSrcDest, const MiniscriptProgram::Attribute &attrib) const;
+		MiniscriptInstructionOutcome readRValueAttribIndexed(MiniscriptThread *thread, DynamicValue &valueSrcDest, const MiniscriptProgram::Attribute &attrib, const DynamicValue &index) const;
 
 		uint32 _attribute;
 		bool _isLValue;
@@ -421,6 +445,7 @@ struct MiniscriptStackValue {
 class MiniscriptThread {
 public:
 	MiniscriptThread(Runtime *runtime, const Common::SharedPtr<MessageProperties> &msgProps, const Common::SharedPtr<MiniscriptProgram> &program, const Common::SharedPtr<MiniscriptReferences> &refs, Modifier *modifier);
+	~MiniscriptThread();
 
 	void error(const Common::String &message);
 
@@ -469,6 +494,7 @@ private:
 	Modifier *_modifier;
 	Runtime *_runtime;
 	Common::Array<MiniscriptStackValue> _stack;
+	size_t _maxStackDepth;
 
 	size_t _currentInstruction;
 	bool _failed;
@@ -19,6 +19,8 @@
  *
  */
 
+#include "common/system.h"
+
 #include "graphics/surface.h"
 #include "graphics/managed_surface.h"
 
@@ -262,8 +264,14 @@ static bool renderItemLess(const RenderItem &a, const RenderItem &b) {
 }
 
 static void renderNormalElement(const RenderItem &item, Window *mainWindow) {
+#ifdef MTROPOLIS_DEBUG_ENABLE
+	const uint32 startTime = g_system->getMillis();
+#endif
 	item.element->render(mainWindow);
 	item.element->finalizeRender();
+#ifdef MTROPOLIS_DEBUG_ENABLE
+	item.element->debugRecordRender(g_system->getMillis() - startTime);
+#endif
 }
 
 static void renderDirectElement(const RenderItem &item, Window *mainWindow) {
@@ -291,6 +299,9 @@ void renderProject(Runtime *runtime, Window *mainWindow, bool *outSkipped) {
 	if (!sceneChanged) {
 		for (Common::Array<RenderItem>::const_iterator it = normalBucket.begin(), itEnd = normalBucket.end(); it != itEnd; ++it) {
 			if (it->element->needsRender()) {
+#ifdef MTROPOLIS_DEBUG_ENABLE
+				it->element->debugRecordRedrawCause();
+#endif
 				sceneChanged = true;
 				break;
 			}
@@ -300,6 +311,9 @@ void renderProject(Runtime *runtime, Window *mainWindow, bool *outSkipped) {
 	if (!sceneChanged) {
 		for (Common::Array<RenderItem>::const_iterator it = directBucket.begin(), itEnd = directBucket.end(); it != itEnd; ++it) {
 			if (it->element->needsRender()) {
+#ifdef MTROPOLIS_DEBUG_ENABLE
+				it->element->debugRecordRedrawCause();
+#endif
 				sceneChanged = true;
 				break;
 			}
@@ -8976,6 +8976,11 @@ VisualElementRenderProperties &VisualElementRenderProperties::operator=(const Vi
 VisualElement::VisualElement()
 	: _rect(0, 0, 0, 0), _cachedAbsoluteOrigin(Common::Point(0, 0)), _contentsDirty(true), _directToScreen(false), _visible(false), _visibleByDefault(true), _layer(0),
 	  _topLeftBevelShading(0), _bottomRightBevelShading(0), _interiorShading(0), _bevelSize(0) {
+#ifdef MTROPOLIS_DEBUG_ENABLE
+	_debugRenderCount = 0;
+	_debugRenderTime = 0;
+	_debugRedrawCauseCount = 0;
+#endif
 }
 
 VisualElement::VisualElement(const VisualElement &other)
@@ -8984,6 +8989,11 @@ VisualElement::VisualElement(const VisualElement &other)
 	, _bottomRightBevelShading(other._bottomRightBevelShading), _interiorShading(other._interiorShading), _bevelSize(other._bevelSize)
 	, _dragProps(nullptr), _renderProps(other._renderProps), _primaryGraphicModifier(nullptr), _transitionProps(other._transitionProps)
 	, _palette(other._palette), _prevRect(other._prevRect), _contentsDirty(true) {
+#ifdef MTROPOLIS_DEBUG_ENABLE
+	_debugRenderCount = 0;
+	_debugRenderTime = 0;
+	_debugRedrawCauseCount = 0;
+#endif
 }
 
 bool VisualElement::isVisual() const {
@@ -9461,9 +9471,21 @@ void VisualElement::debugInspect(IDebugInspectionReport *report) const {
 	report->declareDynamic("relRect", Common::String::format("(%i,%i)-(%i,%i)", static_cast<int>(_rect.left), static_cast<int>(_rect.top), static_cast<int>(_rect.right), static_cast<int>(_rect.bottom)));
 	report->declareDynamic("directToScreen", Common::String(_directToScreen ? "true" : "false"));
 	report->declareDynamic("visible", Common::String(_visible ? "true" : "false"));
+	report->declareDynamic("renderCount", Common::String::format("%u", _debugRenderCount));
+	report->declareDynamic("renderTime", Common::String::format("%u ms", _debugRenderTime));
+	report->declareDynamic("redrawsCaused", Common::String::format("%u", _debugRedrawCauseCount));
 
 	Element::debugInspect(report);
 }
+
+void VisualElement::debugRecordRender(uint32 msec) {
+	_debugRenderCount++;
+	_debugRenderTime += msec;
+}
+
+void VisualElement::debugRecordRedrawCause() {
+	_debugRedrawCauseCount++;
+}
 #endif
 
 MiniscriptInstructionOutcome VisualElement::scriptSetVisibility(MiniscriptThread *thread, const DynamicValue &result) {
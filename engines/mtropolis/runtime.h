@@ -2907,6 +2907,10 @@ public:
 
 #ifdef MTROPOLIS_DEBUG_ENABLE
 	void debugInspect(IDebugInspectionReport *report) const override;
+
+	// Render statistics shown in the inspector
+	void debugRecordRender(uint32 msec);
+	void debugRecordRedrawCause();
 #endif
 
 protected:
@@ -2989,6 +2993,12 @@ protected:
 
 	Common::Rect _prevRect;
 	bool _contentsDirty;
+
+#ifdef MTROPOLIS_DEBUG_ENABLE
+	uint32 _debugRenderCount;
+	uint32 _debugRenderTime;
+	uint32 _debugRedrawCauseCount;
+#endif
 };
 
 class NonVisualElement : public Element {
@@ -40,8 +40,8 @@ void Face::setTextureFromJPEG(const ResourceDescription *jpegDesc) {
 		_texture = _vm->_gfx->createTexture2D(_bitmap);
 	}
 
-	// Set the whole texture as dirty
-	addTextureDirtyRect(Common::Rect(_bitmap->w, _bitmap->h));
+	// Creating the texture uploads the bitmap already
+	_textureDirty = false;
 }
 
 Face::Face(Myst3Engine *vm, bool is3D) :
@@ -26,6 +26,7 @@
 #include "engines/myst3/state.h"
 
 #include "audio/audiostream.h"
+#include "audio/decodeahead.h"
 #include "audio/decoders/asf.h"
 #include "audio/decoders/mp3.h"
 #include "audio/decoders/wave.h"
@@ -444,6 +445,7 @@ void SoundChannel::play(uint32 id, uint32 volume, uint16 heading, uint16 attenua
 	}
 
 	_stream = Audio::makeLoopingAudioStream(plainStream, loop ? 0 : 1);
+	_stream = Audio::makeDecodeAheadStream(_stream);
 
 	// Play the sound
 	g_system->getMixer()->playStream(mixerSoundType(), &_handle, _stream);
@@ -99,57 +99,54 @@ void GraphicsManager::draw(bool updateScreen) {
 		current._previousScreenPosition = current._screenPosition;
 	}
 
-	// Filter out dirty rects that are completely inside others to reduce overdraw
-	for (auto outer = _dirtyRects.begin(); outer != _dirtyRects.end(); ++outer) {
-		for (auto inner = _dirtyRects.begin(); inner != _dirtyRects.end(); ++inner) {
-			if (inner != outer && (*outer).contains(*inner)) {
-				_dirtyRects.erase(inner);
-				break;
-			}
+	// Merge overlapping dirty rects so no part of the screen gets composited twice
+	mergeDirtyRects();
+
+	// Gather the objects that can be drawn, in z order, so the loops below don't need
+	// to recompute their screen positions for every dirty rect
+	_drawList.resize(0);
+	for (auto it : _objects) {
+		RenderObject &current = *it;
+
+		if (!current._isVisible) {
+			continue;
+		}
+
+		DrawListEntry entry;
+		entry.object = &current;
+		entry.screenPosition = current.getScreenPosition();
+		entry.isOpaque = !current._drawSurface.hasTransparentColor() && current._drawSurface.format != _transparentPixelFormat;
+
+		if (!entry.screenPosition.isEmpty()) {
+			_drawList.push_back(entry);
 		}
 	}
 
 	// Perform the actual drawing. This checks for cases where something would be fully obscured,
 	// and skips them (e.g. redrawing the Viewport won't also redraw the background)
-	for (Common::Rect rect : _dirtyRects) {
-		for (RenderObject **it = _objects.begin(); it < _objects.end(); ++it) {
-			RenderObject &current = **it;
+	for (const Common::Rect &rect : _dirtyRects) {
+		for (uint i = 0; i < _drawList.size(); ++i) {
+			const DrawListEntry &current = _drawList[i];
 
-			if (!current._isVisible || current.getScreenPosition().isEmpty()) {
+			Common::Rect intersection = rect.findIntersectingRect(current.screenPosition);
+			if (intersection.isEmpty()) {
 				continue;
 			}
 
+			// Found an intersecting RenderObject. Loop through the following
+			// RenderObjects, and see if a non-transparent one fully obscures the intersection
 			bool shouldSkip = false;
+			for (uint j = i + 1; j < _drawList.size(); ++j) {
+				const DrawListEntry &other = _drawList[j];
 
-			Common::Rect intersection = rect.findIntersectingRect(current.getScreenPosition());
-			if (!intersection.isEmpty()) {
-				// Found an intersecting RenderObject. Loop through the following
-				// RenderObjects, and see if we have another that fully obscures the intersection
-				for (auto it2 = it + 1; it2 < _objects.end(); ++it2) {
-					RenderObject &other = **it2;
-
-					if (!other._isVisible || other.getScreenPosition().isEmpty()) {
-						continue;
-					}
-
-					Common::Rect intersection2 = intersection.findIntersectingRect(other.getScreenPosition());
-					if (intersection == intersection2) {
-						// The entire area that would be drawn is obscured by another RenderObject.
-						// If the obscuring RenderObject is not transparent, we skip drawing current
-
-						if (!other._drawSurface.hasTransparentColor() && other._drawSurface.format != _transparentPixelFormat) {
-							// No transparency, skip current
-							shouldSkip = true;
-							break;
-						}
-					}
-				}
-
-				if (shouldSkip) {
-					continue;
+				if (other.isOpaque && other.screenPosition.contains(intersection)) {
+					shouldSkip = true;
+					break;
 				}
+			}
 
-				blitToScreen(current, rect.findIntersectingRect(current.getScreenPosition()));
+			if (!shouldSkip) {
+				blitToScreen(*current.object, intersection);
 			}
 		}
 	}
@@ -432,6 +429,27 @@ void GraphicsManager::blitToScreen(const RenderObject &src, Common::Rect screenR
 	_screen.blitFrom(src._drawSurface, src._drawSurface.getBounds().findIntersectingRect(src.convertToLocal(screenRect)), screenRect);
 }
 
+void GraphicsManager::mergeDirtyRects() {
+	for (auto outer = _dirtyRects.begin(); outer != _dirtyRects.end(); ) {
+		if ((*outer).isEmpty()) {
+			outer = _dirtyRects.erase(outer);
+			continue;
+		}
+
+		auto inner = outer;
+		while (++inner != _dirtyRects.end()) {
+			if ((*outer).intersects(*inner)) {
+				// Merge the two, then start over since the grown rect may now touch earlier ones
+				(*outer).extend(*inner);
+				_dirtyRects.erase(inner);
+				inner = outer;
+			}
+		}
+
+		++outer;
+	}
+}
+
 int GraphicsManager::objectComparator(const void *a, const void *b) {
 	if (((const RenderObject*)a)->getZOrder() < ((const RenderObject*)b)->getZOrder()) {
 		return -1;
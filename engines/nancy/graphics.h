@@ -79,7 +79,14 @@ public:
 
 
 private:
+	struct DrawListEntry {
+		RenderObject *object = nullptr;
+		Common::Rect screenPosition;
+		bool isOpaque = false;
+	};
+
 	void blitToScreen(const RenderObject &src, Common::Rect dest);
+	void mergeDirtyRects();
 
 	static int objectComparator(const void *a, const void *b);
 
@@ -94,6 +101,7 @@ private:
 	Common::Array<Font> _fonts;
 
 	Common::List<Common::Rect> _dirtyRects;
+	Common::Array<DrawListEntry> _drawList;
 
 	Common::HashMap<uint16, Graphics::ManagedSurface> _autotextSurfaces;
 	Common::HashMap<uint16, Common::Rect> _autotextSurfaceBounds;
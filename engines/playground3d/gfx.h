@@ -69,6 +69,13 @@ public:
 	virtual void drawInViewport() = 0;
 	virtual void drawRgbaTexture() = 0;
 
+	/**
+	 *  Set the draw state of the stress benchmark cubes: textured with the
+	 *  RGBA texture, alpha blended and depth tested
+	 */
+	virtual void setupStressState(bool textured, bool blend, bool depthTest) = 0;
+	virtual void drawStressCube(const Math::Vector3d &pos, const Math::Vector3d &roll) = 0;
+
 	virtual void enableFog(const Math::Vector4d &fogColor) = 0;
 
 protected:
@@ -162,6 +162,7 @@ void OpenGLRenderer::enableFog(const Math::Vector4d &fogColor) {
 void OpenGLRenderer::drawFace(uint face) {
 	glBegin(GL_TRIANGLE_STRIP);
 	for (uint i = 0; i < 4; i++) {
+		glTexCoord2f(cubeVertices[11 * (4 * face + i) + 0], cubeVertices[11 * (4 * face + i) + 1]);
 		glColor3f(cubeVertices[11 * (4 * face + i) + 8], cubeVertices[11 * (4 * face + i) + 9], cubeVertices[11 * (4 * face + i) + 10]);
 		glVertex3f(cubeVertices[11 * (4 * face + i) + 2], cubeVertices[11 * (4 * face + i) + 3], cubeVertices[11 * (4 * face + i) + 4]);
 		glNormal3f(cubeVertices[11 * (4 * face + i) + 5], cubeVertices[11 * (4 * face + i) + 6], cubeVertices[11 * (4 * face + i) + 7]);
@@ -359,6 +360,34 @@ void OpenGLRenderer::drawRgbaTexture() {
 	glPopMatrix();
 }
 
+void OpenGLRenderer::setupStressState(bool textured, bool blend, bool depthTest) {
+	if (textured) {
+		glEnable(GL_TEXTURE_2D);
+		glBindTexture(GL_TEXTURE_2D, _textureRgbaId[0]);
+	} else {
+		glDisable(GL_TEXTURE_2D);
+	}
+
+	if (blend) {
+		glEnable(GL_BLEND);
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	} else {
+		glDisable(GL_BLEND);
+	}
+
+	if (depthTest) {
+		glEnable(GL_DEPTH_TEST);
+		glDepthMask(GL_TRUE);
+	} else {
+		glDisable(GL_DEPTH_TEST);
+	}
+}
+
+void OpenGLRenderer::drawStressCube(const Math::Vector3d &pos, const Math::Vector3d &roll) {
+	// The vertex colors modulate the texture when the cube is textured
+	drawCube(pos, roll);
+}
+
 } // End of namespace Playground3d
 
 #endif
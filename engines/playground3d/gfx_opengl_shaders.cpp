@@ -66,7 +66,8 @@ ShaderRenderer::ShaderRenderer(OSystem *system) :
 		_bitmapShader(nullptr),
 		_cubeVBO(0),
 		_fadeVBO(0),
-		_bitmapVBO(0) {
+		_bitmapVBO(0),
+		_stressTextured(false) {
 }
 
 ShaderRenderer::~ShaderRenderer() {
@@ -249,6 +250,40 @@ void ShaderRenderer::drawRgbaTexture() {
 	_bitmapShader->unbind();
 }
 
+void ShaderRenderer::setupStressState(bool textured, bool blend, bool depthTest) {
+	_stressTextured = textured;
+
+	if (textured)
+		glBindTexture(GL_TEXTURE_2D, _textureRgbaId[0]);
+
+	if (blend) {
+		glEnable(GL_BLEND);
+		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	} else {
+		glDisable(GL_BLEND);
+	}
+
+	if (depthTest) {
+		glEnable(GL_DEPTH_TEST);
+		glDepthMask(GL_TRUE);
+	} else {
+		glDisable(GL_DEPTH_TEST);
+	}
+}
+
+void ShaderRenderer::drawStressCube(const Math::Vector3d &pos, const Math::Vector3d &roll) {
+	auto rotateMatrix = (Math::Quaternion::fromEuler(roll.x(), roll.y(), roll.z(), Math::EO_XYZ)).inverse().toMatrix();
+	_cubeShader->use();
+	_cubeShader->setUniform("textured", _stressTextured);
+	_cubeShader->setUniform("mvpMatrix", _mvpMatrix);
+	_cubeShader->setUniform("rotateMatrix", rotateMatrix);
+	_cubeShader->setUniform("modelPos", pos);
+
+	for (uint i = 0; i < 6; i++) {
+		glDrawArrays(GL_TRIANGLE_STRIP, 4 * i, 4);
+	}
+}
+
 } // End of namespace Playground3d
 
 #endif
@@ -54,6 +54,8 @@ public:
 	void dimRegionInOut(float fade) override;
 	void drawInViewport() override;
 	void drawRgbaTexture() override;
+	void setupStressState(bool textured, bool blend, bool depthTest) override;
+	void drawStressCube(const Math::Vector3d &pos, const Math::Vector3d &roll) override;
 
 	void enableFog(const Math::Vector4d &fogColor) override;
 
@@ -72,6 +74,8 @@ private:
 	GLuint _textureRgb565Id[2];
 	GLuint _textureRgba5551Id[2];
 	GLuint _textureRgba4444Id[2];
+
+	bool _stressTextured;
 };
 
 } // End of namespace Playground3d
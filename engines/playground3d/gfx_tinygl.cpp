@@ -192,6 +192,7 @@ void TinyGLRenderer::enableFog(const Math::Vector4d &fogColor) {
 void TinyGLRenderer::drawFace(uint face) {
 	tglBegin(TGL_TRIANGLE_STRIP);
 	for (uint i = 0; i < 4; i++) {
+		tglTexCoord2f(cubeVertices[11 * (4 * face + i) + 0], cubeVertices[11 * (4 * face + i) + 1]);
 		tglColor3f(cubeVertices[11 * (4 * face + i) + 8], cubeVertices[11 * (4 * face + i) + 9], cubeVertices[11 * (4 * face + i) + 10]);
 		tglVertex3f(cubeVertices[11 * (4 * face + i) + 2], cubeVertices[11 * (4 * face + i) + 3], cubeVertices[11 * (4 * face + i) + 4]);
 		tglNormal3f(cubeVertices[11 * (4 * face + i) + 5], cubeVertices[11 * (4 * face + i) + 6], cubeVertices[11 * (4 * face + i) + 7]);
@@ -430,4 +431,32 @@ void TinyGLRenderer::drawRgbaTexture() {
 	tglPopMatrix();
 }
 
+void TinyGLRenderer::setupStressState(bool textured, bool blend, bool depthTest) {
+	if (textured) {
+		tglEnable(TGL_TEXTURE_2D);
+		tglBindTexture(TGL_TEXTURE_2D, _textureRgbaId[0]);
+	} else {
+		tglDisable(TGL_TEXTURE_2D);
+	}
+
+	if (blend) {
+		tglEnable(TGL_BLEND);
+		tglBlendFunc(TGL_SRC_ALPHA, TGL_ONE_MINUS_SRC_ALPHA);
+	} else {
+		tglDisable(TGL_BLEND);
+	}
+
+	if (depthTest) {
+		tglEnable(TGL_DEPTH_TEST);
+		tglDepthMask(TGL_TRUE);
+	} else {
+		tglDisable(TGL_DEPTH_TEST);
+	}
+}
+
+void TinyGLRenderer::drawStressCube(const Math::Vector3d &pos, const Math::Vector3d &roll) {
+	// The vertex colors modulate the texture when the cube is textured
+	drawCube(pos, roll);
+}
+
 } // End of namespace Playground3d
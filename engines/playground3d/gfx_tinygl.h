@@ -54,6 +54,8 @@ public:
 	void dimRegionInOut(float fade) override;
 	void drawInViewport() override;
 	void drawRgbaTexture() override;
+	void setupStressState(bool textured, bool blend, bool depthTest) override;
+	void drawStressCube(const Math::Vector3d &pos, const Math::Vector3d &roll) override;
 
 	void enableFog(const Math::Vector4d &fogColor) override;
 
@@ -20,7 +20,10 @@
  */
 
 #include "common/scummsys.h"
+#include "common/algorithm.h"
 #include "common/config-manager.h"
+#include "common/cyclecounter.h"
+#include "common/debug.h"
 #include "common/error.h"
 #include "common/events.h"
 
@@ -32,11 +35,10 @@
 
 namespace Playground3d {
 
-bool Playground3dEngine::hasFeature(EngineFeature f) const {
-	// The TinyGL renderer does not support arbitrary resolutions for now
+static Graphics::RendererType getRendererType() {
 	Common::String rendererConfig = ConfMan.get("renderer");
 	Graphics::RendererType desiredRendererType = Graphics::Renderer::parseTypeCode(rendererConfig);
-	Graphics::RendererType matchingRendererType = Graphics::Renderer::getBestMatchingAvailableType(desiredRendererType,
+	return Graphics::Renderer::getBestMatchingAvailableType(desiredRendererType,
 #if defined(USE_OPENGL_GAME)
 			Graphics::kRendererTypeOpenGL |
 #endif
@@ -47,7 +49,11 @@ bool Playground3dEngine::hasFeature(EngineFeature f) const {
 			Graphics::kRendererTypeTinyGL |
 #endif
 			0);
-	bool softRenderer = matchingRendererType == Graphics::kRendererTypeTinyGL;
+}
+
+bool Playground3dEngine::hasFeature(EngineFeature f) const {
+	// The TinyGL renderer does not support arbitrary resolutions for now
+	bool softRenderer = getRendererType() == Graphics::kRendererTypeTinyGL;
 
 	return
 		(f == kSupportsReturnToLauncher) ||
@@ -76,6 +82,14 @@ Common::Error Playground3dEngine::run() {
 
 	_system->showMouse(true);
 
+	ConfMan.registerDefault("benchmark", false);
+	if (ConfMan.getBool("benchmark")) {
+		runStressBenchmark();
+		_gfx->deinit();
+		_system->showMouse(false);
+		return Common::kNoError;
+	}
+
 	// 1 - rotated colorfull cube
 	// 2 - rotated two triangles with depth offset
 	// 3 - fade in/out
@@ -265,4 +279,149 @@ void Playground3dEngine::drawFrame(int testId) {
 	_frameLimiter->startFrame();
 }
 
+// What moves between frames, which decides how much of the screen the
+// TinyGL dirty rects have to redraw
+enum StressMotion {
+	kStressMotionAll,
+	kStressMotionOne,
+	kStressMotionNone
+};
+
+struct StressScenario {
+	const char *name;
+	int cubes; // 12 triangles each
+	int textureSize; // 0 for flat shaded cubes
+	bool blend;
+	bool depthTest;
+	StressMotion motion;
+};
+
+static const StressScenario stressScenarios[] = {
+	{ "cubes-1",           1,    0,    false, true,  kStressMotionAll },
+	{ "cubes-16",          16,   0,    false, true,  kStressMotionAll },
+	{ "cubes-64",          64,   0,    false, true,  kStressMotionAll },
+	{ "cubes-256",         256,  0,    false, true,  kStressMotionAll },
+	{ "cubes-1024",        1024, 0,    false, true,  kStressMotionAll },
+	{ "texture-64",        64,   64,   false, true,  kStressMotionAll },
+	{ "texture-256",       64,   256,  false, true,  kStressMotionAll },
+	{ "texture-1024",      64,   1024, false, true,  kStressMotionAll },
+	{ "blend",             64,   0,    true,  true,  kStressMotionAll },
+	{ "blend-texture-256", 64,   256,  true,  true,  kStressMotionAll },
+	{ "no-depth",          64,   0,    false, false, kStressMotionAll },
+	{ "dirty-one",         64,   0,    false, true,  kStressMotionOne },
+	{ "dirty-none",        64,   0,    false, true,  kStressMotionNone }
+};
+
+static const uint32 kStressWarmupMillis = 500;
+static const uint32 kStressMeasureMillis = 3000;
+
+void Playground3dEngine::drawStressScene(int cubes, int movingCubes, float angle) {
+	int side = 1;
+	while (side * side < cubes)
+		side++;
+
+	// Back off until the whole grid fits in the 45 degrees field of view
+	const float spacing = 2.5f;
+	const float depth = 3.0f + 3.0f * side;
+	const float origin = (side - 1) * spacing / 2.0f;
+
+	for (int i = 0; i < cubes; i++) {
+		Math::Vector3d pos((i % side) * spacing - origin, (i / side) * spacing - origin, depth);
+		float cubeAngle = i < movingCubes ? angle : 0.0f;
+		_gfx->drawStressCube(pos, Math::Vector3d(45.0f + cubeAngle, 45.0f + cubeAngle * 2.0f, 10.0f));
+	}
+}
+
+void Playground3dEngine::runStressBenchmark() {
+	Common::String rendererName = Graphics::Renderer::getTypeCode(getRendererType());
+	_clearColor = Math::Vector4d(0.5f, 0.5f, 0.5f, 1.0f);
+
+	if (getRendererType() == Graphics::kRendererTypeTinyGL)
+		debug("Playground3d benchmark, renderer %s, dirty rects %s", rendererName.c_str(),
+			ConfMan.getBool("dirtyrects") ? "on" : "off");
+	else
+		debug("Playground3d benchmark, renderer %s", rendererName.c_str());
+	debug("scenario\ttriangles\tfps\tp50 ms\tp95 ms\tp99 ms");
+
+#if defined(SCUMM_LITTLE_ENDIAN)
+	Graphics::PixelFormat pixelFormatRGBA(4, 8, 8, 8, 8, 0, 8, 16, 24);
+#else
+	Graphics::PixelFormat pixelFormatRGBA(4, 8, 8, 8, 8, 24, 16, 8, 0);
+#endif
+	Common::Array<uint64> frameTicks;
+
+	for (uint s = 0; s < ARRAYSIZE(stressScenarios) && !shouldQuit(); s++) {
+		const StressScenario &scenario = stressScenarios[s];
+
+		if (scenario.textureSize) {
+			Graphics::Surface *texture = generateRgbaTexture(scenario.textureSize, scenario.textureSize, pixelFormatRGBA);
+			_gfx->loadTextureRGBA(texture);
+			texture->free();
+			delete texture;
+		}
+
+		int movingCubes = scenario.cubes;
+		if (scenario.motion == kStressMotionOne)
+			movingCubes = 1;
+		else if (scenario.motion == kStressMotionNone)
+			movingCubes = 0;
+
+		frameTicks.clear();
+		float angle = 0.0f;
+		uint32 startMillis = _system->getMillis(true);
+		uint32 measureMillis = 0;
+		uint64 measureTicks = 0;
+
+		while (!shouldQuit()) {
+			uint32 millis = _system->getMillis(true) - startMillis;
+			if (millis >= kStressWarmupMillis + kStressMeasureMillis)
+				break;
+
+			bool measuring = millis >= kStressWarmupMillis;
+			if (measuring && !measureTicks) {
+				measureMillis = _system->getMillis(true);
+				measureTicks = Common::getCycleCount();
+			}
+
+			uint64 frameStart = Common::getCycleCount();
+
+			processInput();
+
+			_gfx->clear(_clearColor);
+			_gfx->setupCameraPerspective(0.0f, 0.0f, 45.0f);
+			Common::Rect vp = _gfx->viewport();
+			_gfx->setupViewport(vp.left, _system->getHeight() - vp.top - vp.height(), vp.width(), vp.height());
+			_gfx->setupStressState(scenario.textureSize != 0, scenario.blend, scenario.depthTest);
+			drawStressScene(scenario.cubes, movingCubes, angle);
+			_gfx->flipBuffer();
+			_system->updateScreen();
+
+			if (measuring)
+				frameTicks.push_back(Common::getCycleCount() - frameStart);
+
+			angle += 1.0f;
+			if (angle >= 360.0f)
+				angle = 0.0f;
+		}
+
+		if (frameTicks.empty())
+			continue;
+
+		// The counter frequency is only known by comparing it with the clock
+		uint32 elapsedMillis = MAX<uint32>(_system->getMillis(true) - measureMillis, 1);
+		double ticksPerMilli = (double)(Common::getCycleCount() - measureTicks) / elapsedMillis;
+		if (ticksPerMilli <= 0.0)
+			ticksPerMilli = 1.0;
+
+		Common::sort(frameTicks.begin(), frameTicks.end());
+		uint last = frameTicks.size() - 1;
+
+		debug("%s\t%d\t%.1f\t%.2f\t%.2f\t%.2f", scenario.name, scenario.cubes * 12,
+			frameTicks.size() * 1000.0 / elapsedMillis,
+			frameTicks[last * 50 / 100] / ticksPerMilli,
+			frameTicks[last * 95 / 100] / ticksPerMilli,
+			frameTicks[last * 99 / 100] / ticksPerMilli);
+	}
+}
+
 } // End of namespace Playground3d
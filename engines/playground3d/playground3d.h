@@ -45,6 +45,13 @@ public:
 
 	void drawFrame(int testId);
 
+	/**
+	 * Run the renderer stress benchmark instead of the tests, enabled with
+	 * the "benchmark" setting. Every scenario renders as fast as it can and
+	 * the frame rate and frame time percentiles are printed for each.
+	 */
+	void runStressBenchmark();
+
 private:
 	OSystem *_system;
 	Renderer *_gfx;
@@ -68,6 +75,7 @@ private:
 	void dimRegionInOut();
 	void drawInViewport();
 	void drawRgbaTexture();
+	void drawStressScene(int cubes, int movingCubes, float angle);
 };
 
 } // End of namespace Playground3d
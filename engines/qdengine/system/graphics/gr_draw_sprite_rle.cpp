@@ -19,6 +19,7 @@
  *
  */
 
+#include "common/algorithm.h"
 #include "common/textconsole.h"
 #include "graphics/managed_surface.h"
 
@@ -30,6 +31,14 @@
 
 namespace QDEngine {
 
+// Fills n pixels going in the dx direction from scr_buf, used for the repeated runs of RLE sprites
+static inline void fillRun565(uint16 *scr_buf, int dx, int n, uint16 cl) {
+	if (dx > 0)
+		Common::fill(scr_buf, scr_buf + n, cl);
+	else
+		Common::fill(scr_buf - n + 1, scr_buf + 1, cl);
+}
+
 void grDispatcher::putSpr_rle(int x, int y, int sx, int sy, const class RLEBuffer *p, int mode, bool alpha_flag) {
 	debugC(4, kDebugGraphics, "grDispatcher::putSpr_rle([%d, %d], [%d, %d], mode: %d, alpha: %d", x, y, sx, sy, mode, alpha_flag);
 
@@ -92,16 +101,14 @@ void grDispatcher::putSpr_rle(int x, int y, int sx, int sy, const class RLEBuffe
 		if (!alpha_flag) {
 			while (j < psx) {
 				if (count > 0) {
-					while (count && j < psx) {
-						if (*rle_data) {
-							const byte *rle_buf = (const byte *)rle_data;
-							uint32 cl = make_rgb565u(rle_buf[2], rle_buf[1], rle_buf[0]);
-							*scr_buf = cl;
-						}
-						scr_buf += dx;
-						count--;
-						j++;
+					// The whole run is one pixel, convert it once
+					const int n = MIN<int>(count, psx - j);
+					if (*rle_data) {
+						const byte *rle_buf = (const byte *)rle_data;
+						fillRun565(scr_buf, dx, n, make_rgb565u(rle_buf[2], rle_buf[1], rle_buf[0]));
 					}
+					scr_buf += dx * n;
+					j += n;
 					rle_data++;
 				} else {
 					if (count < 0) {
@@ -124,14 +131,23 @@ void grDispatcher::putSpr_rle(int x, int y, int sx, int sy, const class RLEBuffe
 		} else {
 			while (j < psx) {
 				if (count > 0) {
-					while (count && j < psx) {
-						const byte *rle_buf = (const byte *)rle_data;
-						uint32 a = rle_buf[3];
-						*scr_buf = alpha_blend_565(make_rgb565u(rle_buf[2], rle_buf[1], rle_buf[0]), *scr_buf, a);
-						scr_buf += dx;
-						count--;
-						j++;
+					const int n = MIN<int>(count, psx - j);
+					const byte *rle_buf = (const byte *)rle_data;
+					const uint32 a = rle_buf[3];
+					const uint16 cl = make_rgb565u(rle_buf[2], rle_buf[1], rle_buf[0]);
+					if (!a) {
+						fillRun565(scr_buf, dx, n, cl);
+						scr_buf += dx * n;
+					} else if (a != 255) {
+						for (int k = 0; k < n; k++) {
+							*scr_buf = alpha_blend_565(cl, *scr_buf, a);
+							scr_buf += dx;
+						}
+					} else {
+						// Fully transparent runs leave the screen as it is
+						scr_buf += dx * n;
 					}
+					j += n;
 					rle_data++;
 				} else {
 					if (count < 0) {
@@ -24,6 +24,7 @@
  */
 
 #include "common/debug.h"
+#include "common/endian.h"
 #include "common/memstream.h"
 #include "graphics/surface.h"
 
@@ -300,6 +301,11 @@ void maskTile(gPixelMap *map, int32 x, int32 y, int32 height, uint8 *srcData) {
 	drawTile(map, x, y, height, srcData, true);
 }
 
+//  True if any of the four pixels packed in c is the transparent color 0
+static inline bool hasTransparentPixel(uint32 c) {
+	return ((c - 0x01010101) & ~c & 0x80808080) != 0;
+}
+
 void TBlit(gPixelMap *dstMap, gPixelMap *srcMap, int32 xpos, int32 ypos) {
 	int16 w = srcMap->_size.x;
 	int16 h = srcMap->_size.y;
@@ -331,7 +337,28 @@ void TBlit(gPixelMap *dstMap, gPixelMap *srcMap, int32 xpos, int32 ypos) {
 	byte *dstPtr = dstMap->_data + xpos + ypos * dstMap->_size.x;
 
 	for (int16 y = 0; y < h; y++) {
-		for (int16 x = 0; x < w; x++) {
+		int16 x = 0;
+
+		//  Four pixels at a time: skip fully transparent groups and copy
+		//  fully opaque ones without testing each pixel
+		for (; x + 4 <= w; x += 4) {
+			uint32 c = READ_UINT32(srcPtr);
+
+			if (c != 0) {
+				if (!hasTransparentPixel(c)) {
+					WRITE_UINT32(dstPtr, c);
+				} else {
+					for (int i = 0; i < 4; i++) {
+						if (srcPtr[i] != 0)
+							dstPtr[i] = srcPtr[i];
+					}
+				}
+			}
+			srcPtr += 4;
+			dstPtr += 4;
+		}
+
+		for (; x < w; x++) {
 			byte c = *srcPtr++;
 
 			if (c == 0)
@@ -354,7 +381,21 @@ void compositePixels(gPixelMap *compMap, gPixelMap *sprMap, int32 xpos, int32 yp
 	int16 rowMod = compMap->_size.x - sprMap->_size.x;
 
 	for (int16 y = 0; y < sprMap->_size.y; y++) {
-		for (int16 x = 0; x < sprMap->_size.x; x++) {
+		int16 x = 0;
+
+		//  Skip fully transparent groups of four pixels in one go
+		for (; x + 4 <= sprMap->_size.x; x += 4) {
+			if (READ_UINT32(srcPtr) != 0) {
+				for (int i = 0; i < 4; i++) {
+					if (srcPtr[i] != 0)
+						dstPtr[i] = lookup[srcPtr[i]];
+				}
+			}
+			srcPtr += 4;
+			dstPtr += 4;
+		}
+
+		for (; x < sprMap->_size.x; x++) {
 			byte c = *srcPtr++;
 
 			if (c == 0)
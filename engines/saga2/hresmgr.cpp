@@ -43,6 +43,7 @@ hResContext::hResContext() {
 	_handle = &_file;
 	_res = nullptr;
 	_bytecount = _bytepos = 0;
+	_entryMapBuilt = false;
 }
 
 hResContext::hResContext(hResContext *sire, hResID id, const char desc[]) {
@@ -57,6 +58,7 @@ hResContext::hResContext(hResContext *sire, hResID id, const char desc[]) {
 	_handle = &_file;
 	_base = nullptr;
 	_parent = nullptr;
+	_entryMapBuilt = false;
 
 	if (!_res->_valid)
 		return;
@@ -83,24 +85,32 @@ hResContext::~hResContext() {
 }
 
 hResEntry *hResContext::findEntry(hResID id) {
-	hResEntry       *entry;
-	int16           i;
-
 	_bytecount = 0;
 	_bytepos = 0;
 	if (!_valid) return nullptr;
 
-	debugC(3, kDebugResources, "findEntry: looking for %x (%s)", id, tag2str(id));
-	for (i = 0, entry = _base; i < _numEntries; i++, entry++) {
-		debugC(3, kDebugResources, "%d: Trying ID: %x (%s)", i, entry->id, tag2str(entry->id));
-		if (entry->id == id) {
-			debugC(3, kDebugResources, "findEntry: found %x (%s)", entry->id, tag2str(entry->id));
-			return entry;
+	//  The entries of a context don't change once it is loaded, so index
+	//  them instead of scanning the table on every lookup
+	if (!_entryMapBuilt) {
+		hResEntry       *entry;
+		int16           i;
+
+		for (i = 0, entry = _base; i < _numEntries; i++, entry++) {
+			//  Keep the first entry with a given ID, like the linear search did
+			if (!_entryMap.contains(entry->id))
+				_entryMap.setVal(entry->id, entry);
 		}
+		_entryMapBuilt = true;
 	}
-	debugC(3, kDebugResources, "findEntry: No entry found");
 
-	return nullptr;
+	debugC(3, kDebugResources, "findEntry: looking for %x (%s)", id, tag2str(id));
+	hResEntry *entry = _entryMap.getValOrDefault(id, nullptr);
+	if (entry)
+		debugC(3, kDebugResources, "findEntry: found %x (%s)", entry->id, tag2str(entry->id));
+	else
+		debugC(3, kDebugResources, "findEntry: No entry found");
+
+	return entry;
 }
 
 uint32 hResContext::size(hResID id) {
@@ -30,6 +30,7 @@
 
 namespace Saga2 {
 
+struct hResEntry;
 
 #define USE_MEMORY_MAPPED_FILES 0
 
@@ -39,11 +40,10 @@ namespace Saga2 {
 
 typedef uint32          hResID;
 typedef Common::HashMap<int16, byte*> DataMap;
+typedef Common::HashMap<hResID, hResEntry *> EntryMap;
 
 #define BAD_ID          ((hResID)0xFFFFFFFFL)
 #define NATURAL_SIZE    ((hResID)0xFFFFFFFFL)
-
-struct hResEntry;
 class hResContext;
 class hResource;
 
@@ -103,6 +103,8 @@ protected:
 	hResContext    *_parent;
 	hResEntry      *_base;
 	DataMap        _indexData; // allocated array of handles
+	EntryMap       _entryMap;  // entries by ID, built on the first lookup
+	bool           _entryMapBuilt;
 	Common::File    _file;
 	Common::File   *_handle;
 	uint32          _bytecount;
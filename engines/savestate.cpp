@@ -24,6 +24,7 @@
 #include "engines/metaengine.h"
 #include "graphics/surface.h"
 #include "common/config-manager.h"
+#include "common/stream.h"
 #include "common/textconsole.h"
 #include "common/translation.h"
 
@@ -111,3 +112,35 @@ bool SaveStateDescriptor::isValid() const
 {
 	return _slot >= 0 && !_description.empty();
 }
+
+void SaveStateDescriptor::saveToStream(Common::WriteStream &stream) const {
+	stream.writeSint32LE(_slot);
+	stream.writeString(_description.encode());
+	stream.writeByte(0);
+	stream.writeByte((_isDeletable ? 1 : 0) | (_isWriteProtected ? 2 : 0) | (_isLocked ? 4 : 0));
+	stream.writeString(_saveDate);
+	stream.writeByte(0);
+	stream.writeString(_saveTime);
+	stream.writeByte(0);
+	stream.writeString(_playTime);
+	stream.writeByte(0);
+	stream.writeUint32LE(_playTimeMSecs);
+	stream.writeByte(_saveType);
+}
+
+bool SaveStateDescriptor::loadFromStream(Common::ReadStream &stream) {
+	_slot = stream.readSint32LE();
+	_description = stream.readString().decode();
+	const byte flags = stream.readByte();
+	_isDeletable = (flags & 1) != 0;
+	_isWriteProtected = (flags & 2) != 0;
+	_isLocked = (flags & 4) != 0;
+	_saveDate = stream.readString();
+	_saveTime = stream.readString();
+	_playTime = stream.readString();
+	_playTimeMSecs = stream.readUint32LE();
+	const byte saveType = stream.readByte();
+	_saveType = (saveType <= kSaveTypeAutosave) ? (SaveType)saveType : kSaveTypeUndetermined;
+	_thumbnail.reset();
+	return !stream.err() && !stream.eos();
+}
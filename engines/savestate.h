@@ -29,6 +29,11 @@
 
 class MetaEngine;
 
+namespace Common {
+class ReadStream;
+class WriteStream;
+}
+
 namespace Graphics {
 struct Surface;
 }
@@ -225,6 +230,19 @@ public:
 	 * Returns true if this entry is valid
 	 */
 	bool isValid() const;
+
+	/**
+	 * Write everything but the thumbnail to a stream, for keeping the
+	 * descriptor in an index of the saves.
+	 */
+	void saveToStream(Common::WriteStream &stream) const;
+
+	/**
+	 * Read a descriptor written by saveToStream().
+	 *
+	 * @return false if the stream ended or failed.
+	 */
+	bool loadFromStream(Common::ReadStream &stream);
 private:
 	/**
 	 * The saveslot id, as it would be passed to the "-x" command line switch.
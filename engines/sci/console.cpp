@@ -159,6 +159,7 @@ Console::Console(SciEngine *engine) : GUI::Debugger(),
 	registerCmd("segkill",			WRAP_METHOD(Console, cmdKillSegment));			// alias
 	// Garbage collection
 	registerCmd("gc",					WRAP_METHOD(Console, cmdGCInvoke));
+	registerCmd("gc_stats",			WRAP_METHOD(Console, cmdGCStats));
 	registerCmd("gc_objects",			WRAP_METHOD(Console, cmdGCObjects));
 	registerCmd("gc_reachable",		WRAP_METHOD(Console, cmdGCShowReachable));
 	registerCmd("gc_freeable",		WRAP_METHOD(Console, cmdGCShowFreeable));
@@ -394,6 +395,7 @@ bool Console::cmdHelp(int argc, const char **argv) {
 	debugPrintf("\n");
 	debugPrintf("Garbage collection:\n");
 	debugPrintf(" gc - Invokes the garbage collector\n");
+	debugPrintf(" gc_stats - Shows how long the garbage collector takes and how much it frees\n");
 	debugPrintf(" gc_objects - Lists all reachable objects, normalized\n");
 	debugPrintf(" gc_reachable - Lists all addresses directly reachable from a given memory object\n");
 	debugPrintf(" gc_freeable - Lists all addresses freeable in a given segment\n");
@@ -2828,6 +2830,20 @@ bool Console::cmdGCInvoke(int argc, const char **argv) {
 	return true;
 }
 
+bool Console::cmdGCStats(int argc, const char **argv) {
+	const GCStats &stats = _engine->_gamestate->gcStats;
+
+	debugPrintf("Garbage collections: %u\n", stats.runs);
+	if (!stats.runs)
+		return true;
+
+	debugPrintf("Last: %u ms marking, %u ms sweeping, %u reachable, %u freed\n",
+		stats.lastMarkTime, stats.lastSweepTime, stats.lastReachable, stats.lastFreed);
+	debugPrintf("Total: %u ms (%u ms on average, %u ms at most), %u freed\n",
+		stats.totalTime, stats.totalTime / stats.runs, stats.maxTime, stats.totalFreed);
+	return true;
+}
+
 bool Console::cmdGCObjects(int argc, const char **argv) {
 	AddrSet *use_map = findAllActiveReferences(_engine->_gamestate);
 
@@ -21,6 +21,7 @@
 
 #include "sci/engine/gc.h"
 #include "common/array.h"
+#include "common/system.h"
 #include "sci/graphics/ports.h"
 
 #ifdef ENABLE_SCI32
@@ -55,10 +56,11 @@ void WorklistManager::push(reg_t reg) {
 
 	debugC(kDebugLevelGC, "[GC] Adding %04x:%04x", PRINT_REG(reg));
 
-	if (_map.contains(reg))
+	bool &known = _map.getOrCreateVal(reg);
+	if (known)
 		return; // already dealt with it
 
-	_map.setVal(reg, true);
+	known = true;
 	_worklist.push_back(reg);
 }
 
@@ -190,9 +192,14 @@ void run_gc(EngineState *s) {
 	memset(segcount, 0, sizeof(segcount));
 #endif
 
+	const uint32 startTime = g_system->getMillis();
+	uint32 freed = 0;
+
 	// Compute the set of all segments references currently in use.
 	AddrSet *activeRefs = findAllActiveReferences(s);
 
+	const uint32 markTime = g_system->getMillis() - startTime;
+
 	// Iterate over all segments, and check for each whether it
 	// contains stuff that can be collected.
 	const Common::Array<SegmentObj *> &heap = segMan->getSegments();
@@ -213,6 +220,7 @@ void run_gc(EngineState *s) {
 				if (!activeRefs->contains(addr)) {
 					// Not found -> we can free it
 					mobj->freeAtAddress(segMan, addr);
+					freed++;
 					debugC(kDebugLevelGC, "[GC] Deallocating %04x:%04x", PRINT_REG(addr));
 #ifdef GC_DEBUG_CODE
 					segcount[type]++;
@@ -223,6 +231,17 @@ void run_gc(EngineState *s) {
 		}
 	}
 
+	GCStats &stats = s->gcStats;
+	const uint32 totalTime = g_system->getMillis() - startTime;
+	stats.runs++;
+	stats.lastMarkTime = markTime;
+	stats.lastSweepTime = totalTime - markTime;
+	stats.maxTime = MAX(stats.maxTime, totalTime);
+	stats.totalTime += totalTime;
+	stats.lastReachable = activeRefs->size();
+	stats.lastFreed = freed;
+	stats.totalFreed += freed;
+
 	delete activeRefs;
 
 #ifdef GC_DEBUG_CODE
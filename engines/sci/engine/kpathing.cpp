@@ -116,10 +116,18 @@ struct Vertex {
 	// Previous vertex in shortest path
 	Vertex *path_prev;
 
+	// A* set membership, and the order of the insertion in the open set
+	bool inOpenSet;
+	bool inClosedSet;
+	uint32 openSetOrder;
+
 public:
 	Vertex(const Common::Point &p) : v(p) {
 		costG = HUGE_DISTANCE;
 		path_prev = nullptr;
+		inOpenSet = false;
+		inClosedSet = false;
+		openSetOrder = 0;
 	}
 };
 
@@ -698,6 +706,15 @@ static int inside(const Common::Point &p, Vertex *vertex) {
 	return 0;
 }
 
+/**
+ * Determines whether the line segment (c, d) lies entirely on one side of the
+ * bounding box of (a, b), in which case it neither touches nor intersects it.
+ */
+static bool outside_bounds(const Common::Point &a, const Common::Point &b, const Common::Point &c, const Common::Point &d) {
+	return (c.x < MIN(a.x, b.x) && d.x < MIN(a.x, b.x)) || (c.x > MAX(a.x, b.x) && d.x > MAX(a.x, b.x)) ||
+	       (c.y < MIN(a.y, b.y) && d.y < MIN(a.y, b.y)) || (c.y > MAX(a.y, b.y) && d.y > MAX(a.y, b.y));
+}
+
 /**
  * Returns a list of all vertices that are visible from a particular vertex.
  * @param s				the pathfinding state
@@ -714,11 +731,18 @@ static VertexList *visible_vertices(PathfindingState *s, Vertex *vertex_cur) {
 		if ((vertex == vertex_cur) || (inside(vertex->v, vertex_cur)) || (inside(vertex_cur->v, vertex)))
 			continue;
 
+		// Edges away from the line can be skipped, but between() treats a
+		// line of a single point differently
+		const bool cull = (vertex_cur->v != vertex->v);
+
 		// Check for intersecting edges
 		int j;
 		for (j = 0; j < s->vertices; j++) {
 			Vertex *edge = s->vertex_index[j];
 			if (VERTEX_HAS_EDGES(edge)) {
+				if (cull && outside_bounds(vertex_cur->v, vertex->v, edge->v, CLIST_NEXT(edge)->v))
+					continue;
+
 				if (between(vertex_cur->v, vertex->v, edge->v)) {
 					// If we hit a vertex, make sure we can pass through it without intersecting its polygon
 					if ((inside(vertex_cur->v, edge)) || (inside(vertex->v, edge)))
@@ -1352,6 +1376,79 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
 	return pf_s;
 }
 
+/**
+ * The open set of AStar(), a binary heap of the vertices by their F cost.
+ * Among vertices of equal cost, the one inserted last comes first. Vertices
+ * whose cost drops are pushed again, and their outdated entries are skipped.
+ */
+class OpenSet {
+public:
+	OpenSet() : _size(0), _order(0) {}
+
+	bool empty() const { return _size == 0; }
+
+	void push(Vertex *vertex) {
+		if (!vertex->inOpenSet) {
+			vertex->inOpenSet = true;
+			vertex->openSetOrder = _order++;
+			_size++;
+		}
+
+		Entry entry = { vertex->costF, vertex->openSetOrder, vertex };
+		uint i = _heap.size();
+		_heap.push_back(entry);
+		while (i > 0 && before(_heap[i], _heap[(i - 1) / 2])) {
+			SWAP(_heap[i], _heap[(i - 1) / 2]);
+			i = (i - 1) / 2;
+		}
+	}
+
+	Vertex *pop() {
+		while (!_heap.empty()) {
+			const Entry top = _heap[0];
+			_heap[0] = _heap.back();
+			_heap.pop_back();
+
+			uint i = 0;
+			while (true) {
+				uint best = i;
+				const uint l = 2 * i + 1, r = 2 * i + 2;
+				if (l < _heap.size() && before(_heap[l], _heap[best]))
+					best = l;
+				if (r < _heap.size() && before(_heap[r], _heap[best]))
+					best = r;
+				if (best == i)
+					break;
+				SWAP(_heap[i], _heap[best]);
+				i = best;
+			}
+
+			if (top.vertex->inOpenSet && top.costF == top.vertex->costF) {
+				top.vertex->inOpenSet = false;
+				_size--;
+				return top.vertex;
+			}
+		}
+
+		return nullptr;
+	}
+
+private:
+	struct Entry {
+		uint32 costF;
+		uint32 order;
+		Vertex *vertex;
+	};
+
+	static bool before(const Entry &a, const Entry &b) {
+		return a.costF < b.costF || (a.costF == b.costF && a.order > b.order);
+	}
+
+	Common::Array<Entry> _heap;
+	uint _size;
+	uint32 _order;
+};
+
 /**
  * Computes a shortest path from vertex_start to vertex_end. The caller can
  * construct the resulting path by following the path_prev links from
@@ -1360,40 +1457,29 @@ static PathfindingState *convert_polygon_set(EngineState *s, reg_t poly_list, Co
  * Parameters: (PathfindingState *) s: The pathfinding state
  */
 static void AStar(PathfindingState *s) {
-	// Vertices of which the shortest path is known
-	VertexList closedSet;
+	// The remaining vertices. The vertices of which the shortest path is
+	// known are marked as being in the closed set.
+	OpenSet openSet;
 
-	// The remaining vertices
-	VertexList openSet;
-
-	openSet.push_front(s->vertex_start);
 	s->vertex_start->costG = 0;
 	s->vertex_start->costF = (uint32)sqrt((float)s->vertex_start->v.sqrDist(s->vertex_end->v));
+	openSet.push(s->vertex_start);
 
+	bool reached = false;
 	while (!openSet.empty()) {
 		// Find vertex in open set with lowest F cost
-		VertexList::iterator vertex_min_it = openSet.end();
-		Vertex *vertex_min = nullptr;
-		uint32 min = HUGE_DISTANCE;
+		Vertex *vertex_min = openSet.pop();
 
-		for (VertexList::iterator it = openSet.begin(); it != openSet.end(); ++it) {
-			Vertex *vertex = *it;
-			if (vertex->costF < min) {
-				vertex_min_it = it;
-				vertex_min = *vertex_min_it;
-				min = vertex->costF;
-			}
-		}
-
-		assert(vertex_min != nullptr);	// the vertex cost should never be bigger than HUGE_DISTANCE
+		assert(vertex_min->costF < HUGE_DISTANCE);	// the vertex cost should never be bigger than HUGE_DISTANCE
 
 		// Check if we are done
-		if (vertex_min == s->vertex_end)
+		if (vertex_min == s->vertex_end) {
+			reached = true;
 			break;
+		}
 
 		// Move vertex from set open to set closed
-		closedSet.push_front(vertex_min);
-		openSet.erase(vertex_min_it);
+		vertex_min->inClosedSet = true;
 
 		VertexList *visVerts = visible_vertices(s, vertex_min);
 
@@ -1401,11 +1487,10 @@ static void AStar(PathfindingState *s) {
 			uint32 new_dist;
 			Vertex *vertex = *it;
 
-			if (closedSet.contains(vertex))
+			if (vertex->inClosedSet)
 				continue;
 
-			if (!openSet.contains(vertex))
-				openSet.push_front(vertex);
+			const bool inserted = !vertex->inOpenSet;
 
 			new_dist = vertex_min->costG + (uint32)sqrt((float)vertex_min->v.sqrDist(vertex->v));
 
@@ -1443,13 +1528,16 @@ static void AStar(PathfindingState *s) {
 				vertex->costG = new_dist;
 				vertex->costF = vertex->costG + (uint32)sqrt((float)vertex->v.sqrDist(s->vertex_end->v));
 				vertex->path_prev = vertex_min;
+				openSet.push(vertex);
+			} else if (inserted) {
+				openSet.push(vertex);
 			}
 		}
 
 		delete visVerts;
 	}
 
-	if (openSet.empty())
+	if (!reached)
 		debugC(kDebugLevelAvoidPath, "AvoidPath: End point (%i, %i) is unreachable", s->vertex_end->v.x, s->vertex_end->v.y);
 }
 
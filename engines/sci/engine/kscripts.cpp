@@ -45,6 +45,10 @@ reg_t kLoad(EngineState *s, int argc, reg_t *argv) {
 	if (restype == kResourceTypeMemory)
 		return s->_segMan->allocateHunkEntry("kLoad()", resnr);
 
+	// SSCI loaded the resource here. Do that for the resources we would
+	// otherwise have to read and decompress while drawing or playing them.
+	g_sci->getResMan()->preloadResource(ResourceId(restype, resnr));
+
 	return make_reg(0, ((restype << 11) | resnr)); // Return the resource identifier as handle
 }
 
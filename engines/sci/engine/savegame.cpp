@@ -183,6 +183,25 @@ void syncArray(Common::Serializer &s, Common::Array<T> &arr) {
 	sync(s, arr);
 }
 
+// A reg_t is stored as its segment followed by its offset, so an array of
+// them can be synced as twice as many 16-bit values
+STATIC_ASSERT(sizeof(reg_t) == 4, reg_t_must_be_two_uint16);
+
+void syncRegs(Common::Serializer &s, reg_t *regs, uint count) {
+	if (count)
+		s.syncArrayAsUint16LE(&regs->_segment, count * 2);
+}
+
+void syncArray(Common::Serializer &s, Common::Array<reg_t> &arr) {
+	uint len = arr.size();
+	s.syncAsUint32LE(len);
+
+	if (s.isLoading())
+		arr.resize(len);
+
+	syncRegs(s, arr.data(), len);
+}
+
 void SegManager::saveLoadWithSerializer(Common::Serializer &s) {
 	if (s.isLoading()) {
 		resetSegMan();
@@ -465,7 +484,7 @@ void Vocabulary::saveLoadWithSerializer(Common::Serializer &s) {
 
 void LocalVariables::saveLoadWithSerializer(Common::Serializer &s) {
 	s.syncAsSint32LE(script_id);
-	syncArray<reg_t>(s, _locals);
+	syncArray(s, _locals);
 }
 
 void Object::saveLoadWithSerializer(Common::Serializer &s) {
@@ -473,7 +492,7 @@ void Object::saveLoadWithSerializer(Common::Serializer &s) {
 	syncWithSerializer(s, _pos);
 	s.syncAsSint32LE(_methodCount);		// that's actually a uint16
 
-	syncArray<reg_t>(s, _variables);
+	syncArray(s, _variables);
 
 #ifdef ENABLE_SCI32
 	if (s.getVersion() >= 42 && getSciVersion() == SCI_VERSION_3) {
@@ -795,9 +814,7 @@ void SciArray::saveLoadWithSerializer(Common::Serializer &s) {
 	switch (_type) {
 	case kArrayTypeInt16:
 	case kArrayTypeID:
-		for (int i = 0; i < savedSize; ++i) {
-			syncWithSerializer(s, ((reg_t *)_data)[i]);
-		}
+		syncRegs(s, (reg_t *)_data, savedSize);
 		break;
 	case kArrayTypeByte:
 	case kArrayTypeString:
@@ -79,6 +79,8 @@ void SegManager::resetSegMan() {
 	// Reinitialize class table
 	_classTable.clear();
 	createClassTable();
+
+	flushSelectorLookupCaches();
 }
 
 void SegManager::initSysStrings() {
@@ -165,6 +167,7 @@ void SegManager::deallocate(SegmentId seg) {
 	if (mobj->getType() == SEG_TYPE_SCRIPT) {
 		Script *scr = (Script *)mobj;
 		_scriptSegMap.erase(scr->getScriptNumber());
+		flushSelectorLookupCaches();
 		if (scr->getLocalsSegment()) {
 			// Check if the locals segment has already been deallocated.
 			// If the locals block has been stored in a segment with an ID
@@ -182,6 +185,39 @@ void SegManager::deallocate(SegmentId seg) {
 	_heap[actualSegment] = nullptr;
 }
 
+bool SegManager::findCachedVarSelector(reg_t cls, Selector selector, int &index) const {
+	const SelectorLookupKey key = { cls, selector };
+	VarSelectorCache::const_iterator it = _varSelectorCache.find(key);
+	if (it == _varSelectorCache.end())
+		return false;
+	index = it->_value;
+	return true;
+}
+
+void SegManager::cacheVarSelector(reg_t cls, Selector selector, int index) {
+	const SelectorLookupKey key = { cls, selector };
+	_varSelectorCache[key] = index;
+}
+
+bool SegManager::findCachedMethodSelector(reg_t cls, Selector selector, reg_t &funcp) const {
+	const SelectorLookupKey key = { cls, selector };
+	MethodSelectorCache::const_iterator it = _methodSelectorCache.find(key);
+	if (it == _methodSelectorCache.end())
+		return false;
+	funcp = it->_value;
+	return true;
+}
+
+void SegManager::cacheMethodSelector(reg_t cls, Selector selector, reg_t funcp) {
+	const SelectorLookupKey key = { cls, selector };
+	_methodSelectorCache[key] = funcp;
+}
+
+void SegManager::flushSelectorLookupCaches() {
+	_varSelectorCache.clear();
+	_methodSelectorCache.clear();
+}
+
 bool SegManager::isHeapObject(reg_t pos) const {
 	const Object *obj = getObject(pos);
 	if (obj == nullptr || obj->isFreed())
@@ -1099,6 +1135,8 @@ int SegManager::instantiateScript(int scriptNum, bool applyScriptPatches) {
 		scr = allocateScript(scriptNum, segmentId);
 	}
 
+	flushSelectorLookupCaches();
+
 	scr->load(scriptNum, _resMan, _scriptPatcher, applyScriptPatches);
 	scr->initializeLocals(this);
 	scr->initializeObjects(this, segmentId, applyScriptPatches);
@@ -1136,6 +1174,7 @@ void SegManager::uninstantiateScript(int script_nr) {
 	if (!scr->getLockers()) {
 		// The actual script deletion seems to be done by SCI scripts themselves
 		scr->markDeleted();
+		flushSelectorLookupCaches();
 		debugC(kDebugLevelScripts, "Unloaded script 0x%x.", script_nr);
 	}
 }
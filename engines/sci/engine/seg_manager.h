@@ -23,6 +23,7 @@
 #define SCI_ENGINE_SEG_MANAGER_H
 
 #include "common/scummsys.h"
+#include "common/hashmap.h"
 #include "common/serializer.h"
 #include "sci/engine/script.h"
 #include "sci/engine/vm.h"
@@ -45,6 +46,24 @@ enum ScriptLoadType {
 
 class Script;
 
+/**
+ * Key of the selector lookup caches: a selector looked up from a class.
+ */
+struct SelectorLookupKey {
+	reg_t cls;
+	Selector selector;
+
+	bool operator==(const SelectorLookupKey &x) const {
+		return cls == x.cls && selector == x.selector;
+	}
+};
+
+struct SelectorLookupKeyHash {
+	uint operator()(const SelectorLookupKey &x) const {
+		return (x.cls.getSegment() * 31 + x.cls.getOffset()) * 31 + x.selector;
+	}
+};
+
 class SegManager : public Common::Serializable {
 	friend class Console;
 public:
@@ -460,7 +479,28 @@ public:
 
 	const Common::Array<SegmentObj *> &getSegments() const { return _heap; }
 
+	/**
+	 * Caches of lookupSelector(), for the classes of loaded scripts only.
+	 * They are flushed whenever a script is (un)instantiated, as another
+	 * script can then take over the addresses of its classes.
+	 */
+	bool findCachedVarSelector(reg_t cls, Selector selector, int &index) const;
+	void cacheVarSelector(reg_t cls, Selector selector, int index);
+	bool findCachedMethodSelector(reg_t cls, Selector selector, reg_t &funcp) const;
+	void cacheMethodSelector(reg_t cls, Selector selector, reg_t funcp);
+	bool isSelectorLookupCacheable(reg_t cls) const {
+		return getSegmentType(cls.getSegment()) == SEG_TYPE_SCRIPT;
+	}
+
 private:
+	typedef Common::HashMap<SelectorLookupKey, int, SelectorLookupKeyHash> VarSelectorCache;
+	typedef Common::HashMap<SelectorLookupKey, reg_t, SelectorLookupKeyHash> MethodSelectorCache;
+
+	VarSelectorCache _varSelectorCache;
+	MethodSelectorCache _methodSelectorCache;
+
+	void flushSelectorLookupCaches();
+
 	Common::Array<SegmentObj *> _heap;
 	Common::Array<Class> _classTable; /**< Table of all classes */
 	/** Map script ids to segment ids. */
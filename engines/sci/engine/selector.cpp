@@ -336,7 +336,18 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector sel
 		error("lookupSelector: Attempt to send to non-object or invalid script. Address %04x:%04x", PRINT_REG(obj_location));
 	}
 
-	int index = obj->locateVarSelector(segMan, selectorId);
+	// Before SCI3, the variables are laid out by the class, so the
+	// position of the selector can be cached for the class
+	int index;
+	const Object *cls = (getSciVersion() != SCI_VERSION_3) ? obj->getClass(segMan) : nullptr;
+	if (cls && segMan->isSelectorLookupCacheable(cls->getPos())) {
+		if (!segMan->findCachedVarSelector(cls->getPos(), selectorId, index)) {
+			index = obj->locateVarSelector(segMan, selectorId);
+			segMan->cacheVarSelector(cls->getPos(), selectorId, index);
+		}
+	} else {
+		index = obj->locateVarSelector(segMan, selectorId);
+	}
 
 	if (index >= 0) {
 		// Found it as a variable
@@ -345,22 +356,44 @@ SelectorType lookupSelector(SegManager *segMan, reg_t obj_location, Selector sel
 			varp->varindex = index;
 		}
 		return kSelectorVariable;
-	} else {
-		// Check if it's a method, with recursive lookup in superclasses
+	}
+
+	// Check if it's a method of the object itself, which can have its own
+	index = obj->funcSelectorPosition(selectorId);
+	if (index >= 0) {
+		if (fptr)
+			*fptr = obj->getFunction(index);
+
+		return kSelectorMethod;
+	}
+
+	// Otherwise, look it up recursively in the superclasses. The result
+	// only depends on the superclass, so it is cached for it.
+	const reg_t superClass = obj->getSuperClassSelector();
+	const bool cacheable = segMan->isSelectorLookupCacheable(superClass);
+	reg_t funcp = NULL_REG;
+	if (!cacheable || !segMan->findCachedMethodSelector(superClass, selectorId, funcp)) {
+		obj = segMan->getObject(superClass);
 		while (obj) {
 			index = obj->funcSelectorPosition(selectorId);
 			if (index >= 0) {
-				if (fptr)
-					*fptr = obj->getFunction(index);
-
-				return kSelectorMethod;
-			} else {
-				obj = segMan->getObject(obj->getSuperClassSelector());
+				funcp = obj->getFunction(index);
+				break;
 			}
+			obj = segMan->getObject(obj->getSuperClassSelector());
 		}
 
-		return kSelectorNone;
+		if (cacheable)
+			segMan->cacheMethodSelector(superClass, selectorId, funcp);
 	}
+
+	if (funcp.isNull())
+		return kSelectorNone;
+
+	if (fptr)
+		*fptr = funcp;
+
+	return kSelectorMethod;
 }
 
 } // End of namespace Sci
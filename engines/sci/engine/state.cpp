@@ -71,6 +71,8 @@ EngineState::EngineState(SegManager *segMan) :
 	_msgState(nullptr),
 	_dirseeker() {
 
+	memset(&gcStats, 0, sizeof(gcStats));
+
 	reset(false);
 }
 
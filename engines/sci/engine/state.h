@@ -63,6 +63,21 @@ enum {
 	SAVEGAMEID_OFFICIALRANGE_END = 199
 };
 
+/**
+ * Statistics of the garbage collector, shown by the gc_stats console command.
+ * The times are in milliseconds.
+ */
+struct GCStats {
+	uint32 runs;
+	uint32 lastMarkTime;
+	uint32 lastSweepTime;
+	uint32 maxTime;
+	uint32 totalTime;
+	uint32 lastReachable;
+	uint32 lastFreed;
+	uint32 totalFreed;
+};
+
 enum {
 	GAMEISRESTARTING_NONE = 0,
 	GAMEISRESTARTING_RESTART = 1,
@@ -188,6 +203,7 @@ struct EngineState : public Common::Serializable {
 	void shrinkStackToBase();
 
 	int gcCountDown; /**< Number of kernel calls until next gc */
+	GCStats gcStats;
 
 	MessageState *_msgState;
 	void initMessageState();
@@ -91,6 +91,9 @@ void CelObj::init() {
 	_nextCacheId = 1;
 	_scaler = new CelScaler();
 	_cache = new CelCache(100);
+	_decompressedCache = new DecompressedCelCache();
+	_decompressedCacheSize = 0;
+	_decompressedCacheUse = 0;
 }
 
 void CelObj::deinit() {
@@ -98,6 +101,8 @@ void CelObj::deinit() {
 	_scaler = nullptr;
 	delete _cache;
 	_cache = nullptr;
+	delete _decompressedCache;
+	_decompressedCache = nullptr;
 }
 
 #pragma mark -
@@ -372,13 +377,18 @@ private:
 	const uint8 _skipColor;
 	const int16 _maxWidth;
 
+	const byte *_pixels;
+	const int16 _sourceWidth;
+
 public:
-	READER_Compressed(const CelObj &celObj, const int16 maxWidth) :
+	READER_Compressed(const CelObj &celObj, const int16 maxWidth, const bool useCache = true) :
 	_resource(celObj.getResPointer()),
 	_y(-1),
 	_sourceHeight(celObj._height),
 	_skipColor(celObj._skipColor),
-	_maxWidth(maxWidth) {
+	_maxWidth(maxWidth),
+	_pixels(useCache ? celObj.getDecompressedPixels() : nullptr),
+	_sourceWidth(celObj._width) {
 		assert(maxWidth <= celObj._width);
 
 		const SciSpan<const byte> celHeader = _resource.subspan(celObj._celHeaderOffset);
@@ -389,6 +399,10 @@ public:
 
 	inline const byte *getRow(const int16 y) {
 		assert(y >= 0 && y < _sourceHeight);
+		if (_pixels) {
+			return _pixels + y * _sourceWidth;
+		}
+
 		if (y != _y) {
 			// compressed data segment for row
 			const uint32 rowOffset = _resource.getUint32SEAt(_controlOffset + y * sizeof(uint32));
@@ -700,6 +714,56 @@ void CelObj::submitPalette() const {
 
 int CelObj::_nextCacheId = 1;
 CelCache *CelObj::_cache = nullptr;
+CelObj::DecompressedCelCache *CelObj::_decompressedCache = nullptr;
+uint32 CelObj::_decompressedCacheSize = 0;
+uint32 CelObj::_decompressedCacheUse = 0;
+
+enum {
+	kDecompressedCelCacheSize = 4 * 1024 * 1024
+};
+
+const byte *CelObj::getDecompressedPixels() const {
+	if (!_decompressedCache || _compressionType != kCelCompressionRLE ||
+		(_info.type != kCelTypeView && _info.type != kCelTypePic)) {
+		return nullptr;
+	}
+
+	const uint32 size = _width * _height;
+	if (size == 0 || size > kDecompressedCelCacheSize / 4) {
+		return nullptr;
+	}
+
+	const DecompressedCelKey key = { _info.type, _info.resourceId, _info.loopNo, _info.celNo, _skipColor };
+	DecompressedCelCache::iterator it = _decompressedCache->find(key);
+	if (it != _decompressedCache->end()) {
+		it->_value.lastUse = ++_decompressedCacheUse;
+		return it->_value.pixels.begin();
+	}
+
+	// Make room by dropping the least recently used cels
+	while (_decompressedCacheSize + size > kDecompressedCelCacheSize) {
+		DecompressedCelCache::iterator oldest = _decompressedCache->begin();
+		for (it = _decompressedCache->begin(); it != _decompressedCache->end(); ++it) {
+			if (it->_value.lastUse < oldest->_value.lastUse) {
+				oldest = it;
+			}
+		}
+		_decompressedCacheSize -= oldest->_value.pixels.size();
+		_decompressedCache->erase(oldest);
+	}
+
+	DecompressedCel &cel = (*_decompressedCache)[key];
+	cel.pixels.resize(size);
+	cel.lastUse = ++_decompressedCacheUse;
+	_decompressedCacheSize += size;
+
+	READER_Compressed reader(*this, _width, false);
+	for (int16 y = 0; y < _height; ++y) {
+		memcpy(cel.pixels.begin() + y * _width, reader.getRow(y), _width);
+	}
+
+	return cel.pixels.begin();
+}
 
 int CelObj::searchCache(const CelInfo32 &celInfo, int *const nextInsertIndex) const {
 	*nextInsertIndex = -1;
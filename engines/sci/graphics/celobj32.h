@@ -22,6 +22,7 @@
 #ifndef SCI_GRAPHICS_CELOBJ32_H
 #define SCI_GRAPHICS_CELOBJ32_H
 
+#include "common/hashmap.h"
 #include "common/rational.h"
 #include "common/rect.h"
 #include "sci/resource/resource.h"
@@ -405,6 +406,14 @@ public:
 	 */
 	virtual uint8 readPixel(const uint16 x, const uint16 y, const bool mirrorX) const;
 
+	/**
+	 * Retrieves the decompressed pixels of this cel from the decompressed cel
+	 * cache, decompressing the cel into it first if needed. Returns nullptr
+	 * if the cel cannot be cached, in which case it must be decompressed
+	 * while it is read.
+	 */
+	const byte *getDecompressedPixels() const;
+
 	/**
 	 * Submits the palette from this cel to the palette manager for integration
 	 * into the master screen palette.
@@ -474,6 +483,42 @@ protected:
 	 * Puts a copy of this CelObj into the cache at the given cache index.
 	 */
 	void putCopyInCache(int index) const;
+
+	struct DecompressedCelKey {
+		CelType type;
+		GuiResourceId resourceId;
+		int16 loopNo;
+		int16 celNo;
+		uint8 skipColor;
+
+		bool operator==(const DecompressedCelKey &other) const {
+			return type == other.type && resourceId == other.resourceId && loopNo == other.loopNo &&
+				celNo == other.celNo && skipColor == other.skipColor;
+		}
+	};
+
+	struct DecompressedCelKey_Hash {
+		uint operator()(const DecompressedCelKey &key) const {
+			return ((((uint)key.type * 31 + key.resourceId) * 31 + key.loopNo) * 31 + key.celNo) * 31 + key.skipColor;
+		}
+	};
+
+	struct DecompressedCel {
+		Common::Array<byte> pixels;
+		uint32 lastUse;
+	};
+
+	typedef Common::HashMap<DecompressedCelKey, DecompressedCel, DecompressedCelKey_Hash> DecompressedCelCache;
+
+	/**
+	 * The pixels of the compressed view and pic cels drawn last, so that
+	 * cels drawn every frame are decompressed once. The least recently used
+	 * cels are dropped once the pixels take more than
+	 * kDecompressedCelCacheSize bytes.
+	 */
+	static DecompressedCelCache *_decompressedCache;
+	static uint32 _decompressedCacheSize;
+	static uint32 _decompressedCacheUse;
 };
 
 #pragma mark -
@@ -1018,6 +1018,17 @@ void GfxFrameout::drawScreenItemList(const DrawList &screenItemList) {
 }
 
 void GfxFrameout::mergeToShowList(const Common::Rect &drawRect, RectList &showList, const int overdrawThreshold) {
+	// Items drawn inside an area which is already going to be shown, like
+	// after a full plane redraw, do not change what is sent to the screen
+	if (drawRect.isEmpty()) {
+		return;
+	}
+	for (RectList::size_type i = 0; i < showList.size(); ++i) {
+		if (showList[i] && showList[i]->contains(drawRect)) {
+			return;
+		}
+	}
+
 	RectList mergeList;
 	Common::Rect merged;
 	mergeList.add(drawRect);
@@ -30,6 +30,7 @@
 #ifdef ENABLE_SCI32
 #include "common/compression/installshield_cab.h"
 #include "common/memstream.h"
+#include "common/memtag.h"
 #endif
 
 #include "sci/engine/workarounds.h"
@@ -421,6 +422,7 @@ void ResourceManager::disposeVolumeFileStream(Common::SeekableReadStream *fileSt
 }
 
 void ResourceManager::loadResource(Resource *res) {
+	MEMORY_TAG("sci resources");
 	res->_source->loadResource(this, res);
 	if (_patcher) {
 		_patcher->applyPatch(*res);
@@ -1081,6 +1083,14 @@ void ResourceManager::init() {
 		_maxMemoryLRU = 4096 * 1024; // 4MiB
 	}
 
+	// Platforms with plenty of memory and slow storage may want to keep
+	// more resources around
+	if (ConfMan.hasKey("sci_resource_cache_size")) {
+		const int size = ConfMan.getInt("sci_resource_cache_size");
+		if (size > 0)
+			_maxMemoryLRU = size * 1024;
+	}
+
 	switch (_viewType) {
 	case kViewEga:
 		debugC(1, kDebugLevelResMan, "resMan: Detected EGA graphic resources");
@@ -1183,6 +1193,22 @@ bool ResourceManager::hasResourceType(ResourceType type) {
 	return false;
 }
 
+void ResourceManager::preloadResource(ResourceId id) {
+	switch (id.getType()) {
+	case kResourceTypeView:
+	case kResourceTypePic:
+	case kResourceTypeSound:
+	case kResourceTypeAudio:
+	case kResourceTypeFont:
+	case kResourceTypeCursor:
+	case kResourceTypePalette:
+		findResource(id, false);
+		break;
+	default:
+		break;
+	}
+}
+
 Resource *ResourceManager::findResource(ResourceId id, bool lock) {
 	// remap known incorrect audio36 and sync36 resource ids
 	if (id.getType() == kResourceTypeAudio36) {
@@ -374,6 +374,14 @@ public:
 	 */
 	Resource *findResource(ResourceId id, bool lock);
 
+	/**
+	 * Loads a resource ahead of its use, as when scripts announce it through
+	 * kLoad, so that it is already decompressed in the LRU cache when it is
+	 * requested. Only graphics, sound and font resources are loaded.
+	 * @param id	The resource to load
+	 */
+	void preloadResource(ResourceId id);
+
 	/**
 	 * Unlocks a previously locked resource.
 	 * @param res	The resource to free
@@ -25,6 +25,7 @@
 #include "audio/decoders/mac_snd.h" // for makeMacSndStream
 #include "audio/decoders/raw.h"     // for makeRawStream, RawFlags::FLAG_16BITS
 #include "audio/decoders/wave.h"    // for makeWAVStream
+#include "audio/mixbus.h"           // for mixBusAccumulate, mixBusClamp
 #include "audio/rate.h"             // for RateConverter, makeRateConverter
 #include "audio/timestamp.h"        // for Timestamp
 #include "common/config-manager.h"  // for ConfMan
@@ -238,6 +239,12 @@ int Audio32::writeAudioInternal(Audio::AudioStream &sourceStream, Audio::RateCon
 	return samplePairsWritten << 1;
 }
 
+int Audio32::writeAudioInternal(Audio::AudioStream &sourceStream, Audio::RateConverter &converter, int32 *targetBuffer, const int numSamples, const Audio::st_volume_t leftVolume, const Audio::st_volume_t rightVolume) {
+	const int samplePairsToRead = numSamples >> 1;
+	const int samplePairsWritten = converter.convert(sourceStream, targetBuffer, samplePairsToRead, leftVolume, rightVolume);
+	return samplePairsWritten << 1;
+}
+
 int16 Audio32::getNumChannelsToMix() const {
 	Common::StackLock lock(_mutex);
 	int16 numChannels = 0;
@@ -304,10 +311,16 @@ int Audio32::readBuffer(Audio::st_sample_t *const buffer, const int numSamples)
 
 	const bool playOnlyMonitoredChannel = getSciVersion() != SCI_VERSION_3 && _monitoredChannelIndex != -1;
 
-	// The caller of `readBuffer` is a rate converter, which reuses (without
-	// clearing) an intermediate buffer, so we need to zero the intermediate
-	// buffer to prevent mixing into audio data from the last callback.
-	memset(buffer, 0, numSamples * sizeof(Audio::st_sample_t));
+	// Channels are mixed into a 32-bit bus, which is clamped into the output
+	// buffer once all of them have been mixed in. The caller of `readBuffer`
+	// is a rate converter, which reuses (without clearing) an intermediate
+	// buffer, so the whole of it gets written to prevent mixing into audio
+	// data from the last callback.
+	if (numSamples > (int)_mixBus.size()) {
+		_mixBus.resize(numSamples);
+	}
+	int32 *const mixBus = _mixBus.data();
+	memset(mixBus, 0, numSamples * sizeof(int32));
 
 	// This emulates the attenuated mixing mode of SSCI engine, which reduces
 	// the volume of the target buffer when each new channel is mixed in.
@@ -413,15 +426,11 @@ int Audio32::readBuffer(Audio::st_sample_t *const buffer, const int numSamples)
 			if (numSamples > (int)_monitoredBuffer.size()) {
 				_monitoredBuffer.resize(numSamples);
 			}
-			memset(_monitoredBuffer.data(), 0, _monitoredBuffer.size() * sizeof(Audio::st_sample_t));
+			memset(_monitoredBuffer.data(), 0, numSamples * sizeof(Audio::st_sample_t));
 			_numMonitoredSamples = writeAudioInternal(*channel.stream, *channel.converter, _monitoredBuffer.data(), numSamples, leftVolume, rightVolume);
 
-			Audio::st_sample_t *sourceBuffer = _monitoredBuffer.data();
-			Audio::st_sample_t *targetBuffer = buffer;
-			const Audio::st_sample_t *const end = _monitoredBuffer.data() + _numMonitoredSamples;
-			while (sourceBuffer != end) {
-				Audio::clampedAdd(*targetBuffer++, *sourceBuffer++);
-			}
+			// The volume has already been applied to the monitored samples
+			Audio::mixBusAccumulate(mixBus, _monitoredBuffer.data(), _numMonitoredSamples >> 1, true, Audio::Mixer::kMaxMixerVolume, Audio::Mixer::kMaxMixerVolume);
 
 			if (_numMonitoredSamples > maxSamplesWritten) {
 				maxSamplesWritten = _numMonitoredSamples;
@@ -437,13 +446,15 @@ int Audio32::readBuffer(Audio::st_sample_t *const buffer, const int numSamples)
 				leftVolume = rightVolume = 0;
 			}
 
-			const int channelSamplesWritten = writeAudioInternal(*channel.stream, *channel.converter, buffer, numSamples, leftVolume, rightVolume);
+			const int channelSamplesWritten = writeAudioInternal(*channel.stream, *channel.converter, mixBus, numSamples, leftVolume, rightVolume);
 			if (channelSamplesWritten > maxSamplesWritten) {
 				maxSamplesWritten = channelSamplesWritten;
 			}
 		}
 	}
 
+	Audio::mixBusClamp(buffer, mixBus, numSamples);
+
 	_inAudioThread = false;
 
 	return maxSamplesWritten;
@@ -694,8 +705,9 @@ bool Audio32::playRobotAudio(const RobotAudioStream::RobotAudioPacket &packet) {
 		channel.soundNode = NULL_REG;
 		channel.volume = kMaxVolume;
 		channel.pan = -1;
-		// TODO: Avoid unnecessary channel conversion
-		channel.converter.reset(Audio::makeRateConverter(RobotAudioStream::kRobotSampleRate, getRate(), false, true, false));
+		// Audio32 runs at the mixer output rate, so this is the only time
+		// the channel gets resampled
+		channel.converter.reset(Audio::makeRateConverter(RobotAudioStream::kRobotSampleRate, getRate(), false, true, false, Audio::getConfiguredResampler()));
 		// The RobotAudioStream buffer size is
 		// ((bytesPerSample * channels * sampleRate * 2000ms) / 1000ms) & ~3
 		// where bytesPerSample = 2, channels = 1, and sampleRate = 22050
@@ -861,8 +873,9 @@ uint16 Audio32::play(int16 channelIndex, const ResourceId resourceId, const bool
 	}
 
 	channel.stream.reset(new MutableLoopAudioStream(audioStream, loop));
-	// TODO: Avoid unnecessary channel conversion
-	channel.converter.reset(Audio::makeRateConverter(channel.stream->getRate(), getRate(), channel.stream->isStereo(), true, false));
+	// Audio32 runs at the mixer output rate, so this is the only time the
+	// channel gets resampled
+	channel.converter.reset(Audio::makeRateConverter(channel.stream->getRate(), getRate(), channel.stream->isStereo(), true, false, Audio::getConfiguredResampler()));
 
 	// SSCI sets up a decompression buffer here for the audio stream, plus
 	// writes information about the sample to the channel to convert to the
@@ -221,6 +221,12 @@ private:
 	 */
 	int writeAudioInternal(Audio::AudioStream &sourceStream, Audio::RateConverter &converter, Audio::st_sample_t *targetBuffer, const int numSamples, const Audio::st_volume_t leftVolume, const Audio::st_volume_t rightVolume);
 
+	/**
+	 * Mixes audio from the given source stream into the 32-bit mix bus using
+	 * the given rate converter, without clamping.
+	 */
+	int writeAudioInternal(Audio::AudioStream &sourceStream, Audio::RateConverter &converter, int32 *targetBuffer, const int numSamples, const Audio::st_volume_t leftVolume, const Audio::st_volume_t rightVolume);
+
 #pragma mark -
 #pragma mark Channel management
 public:
@@ -634,6 +640,12 @@ private:
 	 */
 	int _numMonitoredSamples;
 
+	/**
+	 * The 32-bit buffer all channels are mixed into before the result is
+	 * clamped once into the output buffer.
+	 */
+	Common::Array<int32> _mixBus;
+
 #pragma mark -
 #pragma mark Kernel
 public:
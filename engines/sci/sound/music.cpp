@@ -60,6 +60,9 @@ SciMusic::SciMusic(SciVersion soundVersion, bool useDigitalSFX) :
 	}
 
 	_queuedCommands.reserve(1000);
+
+	_muteSetting = ConfMan.bindBool("mute");
+	_musicVolumeSetting = ConfMan.bindInt("music_volume");
 }
 
 SciMusic::~SciMusic() {
@@ -906,12 +909,12 @@ void SciMusic::soundToggle(MusicEntry *pSnd, bool pause) {
 }
 
 uint16 SciMusic::soundGetMasterVolume() {
-	if (ConfMan.getBool("mute")) {
+	if (_muteSetting.get()) {
 		// When a game is muted, the master volume is set to zero so that
 		// mute applies to external MIDI devices, but this should not be
 		// communicated to the game as it will cause the UI to be drawn with
 		// the wrong (zero) volume for music
-		return (ConfMan.getInt("music_volume") + 1) * MUSIC_MASTERVOLUME_MAX / Audio::Mixer::kMaxMixerVolume;
+		return (_musicVolumeSetting.get() + 1) * MUSIC_MASTERVOLUME_MAX / Audio::Mixer::kMaxMixerVolume;
 	}
 
 	return _masterVolume;
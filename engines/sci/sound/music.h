@@ -22,6 +22,7 @@
 #ifndef SCI_SOUND_MUSIC_H
 #define SCI_SOUND_MUSIC_H
 
+#include "common/config-manager.h"
 #include "common/serializer.h"
 #include "common/mutex.h"
 
@@ -290,6 +291,9 @@ private:
 	MusicList _playList;
 	bool _soundOn;
 	byte _masterVolume;
+	// Scripts query the master volume every few frames
+	Common::ConfigManager::BoolBinding _muteSetting;
+	Common::ConfigManager::IntBinding _musicVolumeSetting;
 	MusicEntry *_usedChannel[16];
 	int8 _channelRemap[16];
 	int8 _globalReverb;
@@ -281,6 +281,8 @@ void AkosRenderer::setCostume(int costume, int shadow) {
 	const byte *akos = _vm->getResourceAddress(rtCostume, costume);
 	assert(akos);
 
+	_costumeId = costume;
+
 	_akhd = (const AkosHeader *)_vm->findResourceData(MKTAG('A','K','H','D'), akos);
 	_akof = (const AkosOffset *)_vm->findResourceData(MKTAG('A','K','O','F'), akos);
 	_akci = _vm->findResourceData(MKTAG('A','K','C','I'), akos);
@@ -1045,10 +1047,15 @@ void AkosRenderer::majMinCodecDecompress(byte *dest, int32 pitch, const byte *sr
 		tmpBuf += (width - 1);
 	}
 
-	majMin.setupBitReader(*src, src + 1);
+	const byte *cel = getDecodedMajMinCel(src);
+	if (cel) {
+		cel += numSkipBefore;
+	} else {
+		majMin.setupBitReader(*src, src + 1);
 
-	if (numSkipBefore != 0) {
-		majMin.skipData(numSkipBefore);
+		if (numSkipBefore != 0) {
+			majMin.skipData(numSkipBefore);
+		}
 	}
 
 	maskPitch = _numStrips;
@@ -1058,12 +1065,22 @@ void AkosRenderer::majMinCodecDecompress(byte *dest, int32 pitch, const byte *sr
 	assert(height > 0);
 	assert(width > 0);
 	while (height--) {
-		majMin.decodeLine(tmpBuf, width, dir);
+		if (cel) {
+			if (dir > 0) {
+				memcpy(tmpBuf, cel, width);
+			} else {
+				for (int32 i = 0; i < width; i++)
+					tmpBuf[-i] = cel[i];
+			}
+			cel += width + numSkipAfter;
+		} else {
+			majMin.decodeLine(tmpBuf, width, dir);
+		}
 		bompApplyMask(majMin._majMinData.buffer, maskPtr, maskBit, width, transparency);
 		bool HE7Check = (_vm->_game.heversion == 70);
 		bompApplyShadow(_shadowMode, _shadowTable, majMin._majMinData.buffer, dest, width, transparency, HE7Check);
 
-		if (numSkipAfter != 0)	{
+		if (numSkipAfter != 0 && !cel)	{
 			majMin.skipData(numSkipAfter);
 		}
 		dest += pitch;
@@ -1071,6 +1088,46 @@ void AkosRenderer::majMinCodecDecompress(byte *dest, int32 pitch, const byte *sr
 	}
 }
 
+#define AKOS_DECODED_CELS_BUDGET (2 * 1024 * 1024)
+
+const byte *AkosRenderer::getDecodedMajMinCel(const byte *src) {
+	const uint32 size = _width * _height;
+	if (size == 0 || size > AKOS_DECODED_CELS_BUDGET / 4)
+		return nullptr;
+
+	const DecodedCelKey key = { _costumeId, (uint32)(src - _akcd) };
+	DecodedCelCache::iterator it = _decodedCels.find(key);
+	if (it != _decodedCels.end()) {
+		if (it->_value.pixels.size() == size) {
+			it->_value.lastUse = ++_decodedCelsUseCounter;
+			return it->_value.pixels.data();
+		}
+		_decodedCelsSize -= it->_value.pixels.size();
+		_decodedCels.erase(it);
+	}
+
+	// Evict the least recently used cels
+	while (_decodedCelsSize + size > AKOS_DECODED_CELS_BUDGET) {
+		DecodedCelCache::iterator oldest = _decodedCels.begin();
+		for (DecodedCelCache::iterator i = _decodedCels.begin(); i != _decodedCels.end(); ++i) {
+			if (i->_value.lastUse < oldest->_value.lastUse)
+				oldest = i;
+		}
+		_decodedCelsSize -= oldest->_value.pixels.size();
+		_decodedCels.erase(oldest);
+	}
+
+	DecodedCel &decoded = _decodedCels[key];
+	decoded.pixels.resize(size);
+	decoded.lastUse = ++_decodedCelsUseCounter;
+	_decodedCelsSize += size;
+
+	MajMinCodec majMin;
+	majMin.setupBitReader(*src, src + 1);
+	majMin.decodeLine(decoded.pixels.data(), size, 1);
+	return decoded.pixels.data();
+}
+
 byte AkosRenderer::paintCelMajMin(int xMoveCur, int yMoveCur) {
 	assert(_vm->_bytesPerPixel == 1);
 
@@ -22,6 +22,8 @@
 #ifndef SCUMM_AKOS_H
 #define SCUMM_AKOS_H
 
+#include "common/hashmap.h"
+
 #include "scumm/base-costume.h"
 #include "scumm/he/wiz_he.h"
 
@@ -95,6 +97,42 @@ protected:
 	const byte *_rgbs;  // Raw costume RGB colors (HE specific)
 	const uint8 *_xmap; // shadow color table (HE specific)
 
+	int _costumeId = 0;
+
+	/**
+	 * A cel of the AKOS_RUN_MAJMIN_CODEC, decoded into one byte per pixel.
+	 * The codec data is a single bit stream over all rows, so without the
+	 * decoded cel every redraw decodes it up to the last visible pixel.
+	 * The decoded pixels don't depend on the palette, the mirroring or the
+	 * clipping of the draw; these are applied when the rows are painted.
+	 */
+	struct DecodedCelKey {
+		int costume;
+		uint32 offset; ///< of the cel data in the AKCD block
+
+		bool operator==(const DecodedCelKey &other) const {
+			return costume == other.costume && offset == other.offset;
+		}
+	};
+
+	struct DecodedCelKeyHash {
+		uint operator()(const DecodedCelKey &key) const {
+			return key.offset ^ (key.costume << 20) ^ (key.costume >> 12);
+		}
+	};
+
+	struct DecodedCel {
+		Common::Array<byte> pixels;
+		uint32 lastUse;
+	};
+
+	typedef Common::HashMap<DecodedCelKey, DecodedCel, DecodedCelKeyHash> DecodedCelCache;
+	DecodedCelCache _decodedCels;
+	uint32 _decodedCelsSize = 0;
+	uint32 _decodedCelsUseCounter = 0;
+
+	const byte *getDecodedMajMinCel(const byte *src);
+
 
 public:
 	AkosRenderer(ScummEngine *scumm) : BaseCostumeRenderer(scumm) {
@@ -82,6 +82,7 @@ struct Box {				/* Internal walkbox file format */
 #include "common/pack-end.h"	// END STRUCT PACKING
 
 #define BOX_MATRIX_SIZE 2000
+#define BOX_MATRIX_CACHE_ENTRIES 8
 #define BOX_DEBUG 0
 
 
@@ -1016,20 +1017,27 @@ void ScummEngine::calcItineraryMatrix(byte *itineraryMatrix, int num) {
 	// a) extremely obfuscated
 	// b) incorrect: it didn't always find the shortest paths
 	// c) not any faster in reality for our sparse & small adjacent matrices
+	//
+	// Rows which can't reach box k can't be improved through it, which
+	// skips most of the work for the sparse box graphs. The diagonal needs
+	// no special case, as a distance of 0 can't be improved either.
 	for (k = 0; k < num; k++) {
+		const byte *distK = adjacentMatrix + boxSize * k;
 		for (i = 0; i < num; i++) {
+			byte *distI = adjacentMatrix + boxSize * i;
+			byte *itineraryI = itineraryMatrix + boxSize * i;
+			const int distIK = distI[k];
+			if (distIK == 255)
+				continue;
+			const byte itineraryIK = itineraryI[k];
 			for (j = 0; j < num; j++) {
-				if (i == j)
-					continue;
-				byte distIK = adjacentMatrix[boxSize * i + k];
-				byte distKJ = adjacentMatrix[boxSize * k + j];
-				if (adjacentMatrix[boxSize * i + j] > distIK + distKJ) {
-					adjacentMatrix[boxSize * i + j] = distIK + distKJ;
-					itineraryMatrix[boxSize * i + j] = itineraryMatrix[boxSize * i + k];
+				const int dist = distIK + distK[j];
+				if (distI[j] > dist) {
+					distI[j] = dist;
+					itineraryI[j] = itineraryIK;
 				}
 			}
 		}
-
 	}
 
 	free(adjacentMatrix);
@@ -1041,6 +1049,12 @@ void ScummEngine::createBoxMatrix() {
 	// The total number of boxes
 	num = getNumBoxes();
 
+	// The neighbors of v0 boxes come from the box matrix itself, otherwise
+	// the matrix only depends on the box data
+	const bool useCache = (_game.version >= 3) && getResourceAddress(rtMatrix, 2);
+	if (useCache && restoreCachedBoxMatrix(getResourceAddress(rtMatrix, 2), getResourceSize(rtMatrix, 2)))
+		return;
+
 	const uint8 boxSize = (_game.version == 0) ? num : 64;
 
 	// calculate shortest paths
@@ -1059,7 +1073,8 @@ void ScummEngine::createBoxMatrix() {
 	// the boxes 7,8,9,10,11 the shortest way is to go via box 15.
 	// See also getNextBox.
 
-	byte *matrixStart = _res->createResource(rtMatrix, 1, BOX_MATRIX_SIZE);
+	byte *matrixBase = _res->createResource(rtMatrix, 1, BOX_MATRIX_SIZE);
+	byte *matrixStart = matrixBase;
 	const byte *matrixEnd = matrixStart + BOX_MATRIX_SIZE;
 
 	#define addToMatrix(b)	do { *matrixStart++ = (b); assert(matrixStart < matrixEnd); } while (0)
@@ -1079,6 +1094,8 @@ void ScummEngine::createBoxMatrix() {
 	}
 	addToMatrix(0xFF);
 
+	if (useCache)
+		cacheBoxMatrix(getResourceAddress(rtMatrix, 2), getResourceSize(rtMatrix, 2), matrixBase, matrixStart - matrixBase);
 
 #if BOX_DEBUG
 	debug("Itinerary matrix:\n");
@@ -1090,6 +1107,36 @@ void ScummEngine::createBoxMatrix() {
 	free(itineraryMatrix);
 }
 
+bool ScummEngine::restoreCachedBoxMatrix(const byte *boxes, uint32 boxesSize) {
+	for (uint i = 0; i < _boxMatrixCache.size(); i++) {
+		const BoxMatrixCacheEntry &entry = _boxMatrixCache[i];
+		if (entry.room != _roomResource || entry.boxes.size() != boxesSize || memcmp(entry.boxes.data(), boxes, boxesSize))
+			continue;
+
+		byte *matrix = _res->createResource(rtMatrix, 1, BOX_MATRIX_SIZE);
+		memcpy(matrix, entry.matrix.data(), entry.matrix.size());
+
+		if (i != 0) {
+			BoxMatrixCacheEntry hit = entry;
+			_boxMatrixCache.remove_at(i);
+			_boxMatrixCache.insert_at(0, hit);
+		}
+		return true;
+	}
+	return false;
+}
+
+void ScummEngine::cacheBoxMatrix(const byte *boxes, uint32 boxesSize, const byte *matrix, uint32 matrixSize) {
+	if (_boxMatrixCache.size() >= BOX_MATRIX_CACHE_ENTRIES)
+		_boxMatrixCache.pop_back();
+
+	BoxMatrixCacheEntry entry;
+	entry.room = _roomResource;
+	entry.boxes = Common::Array<byte>(boxes, boxesSize);
+	entry.matrix = Common::Array<byte>(matrix, matrixSize);
+	_boxMatrixCache.insert_at(0, entry);
+}
+
 /** Check if two boxes are neighbors. */
 bool ScummEngine::areBoxesNeighbors(int box1nr, int box2nr) {
 	Common::Point tmp;
@@ -39,22 +39,6 @@
 
 namespace Scumm {
 
-void debugC(int channel, const char *s, ...) {
-	char buf[STRINGBUFLEN];
-	va_list va;
-
-	// FIXME: Still spew all debug at -d9, for crashes in startup etc.
-	//	  Add setting from commandline ( / abstract channel interface)
-	if (!DebugMan.isDebugChannelEnabled(channel) && (gDebugLevel < 9))
-		return;
-
-	va_start(va, s);
-	vsnprintf(buf, STRINGBUFLEN, s, va);
-	va_end(va);
-
-	debug("%s", buf);
-}
-
 ScummDebugger::ScummDebugger(ScummEngine *s)
 	: GUI::Debugger() {
 	_vm = s;
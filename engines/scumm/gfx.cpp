@@ -597,15 +597,30 @@ void ScummEngine::updateDirtyScreen(VirtScreenNumber slot) {
 
 	for (i = 0; i < _gdi->_numStrips; i++) {
 		if (vs->bdirty[i]) {
-			const int top = vs->tdirty[i];
-			const int bottom = vs->bdirty[i];
+			int top = vs->tdirty[i];
+			int bottom = vs->bdirty[i];
+			int dirtyArea = 8 * (bottom - top);
 			vs->tdirty[i] = vs->h;
 			vs->bdirty[i] = 0;
-			if (i != (_gdi->_numStrips - 1) && vs->bdirty[i + 1] == bottom && vs->tdirty[i + 1] == top) {
-				// Simple optimizations: if two or more neighboring strips
-				// form one bigger rectangle, coalesce them.
+
+			// Coalesce the following dirty strips into one rectangle, as
+			// long as that only redraws a little more than the strips
+			// themselves. Each rectangle is a separate blit and dirty rect
+			// for the backend, which costs more than the few extra lines.
+			while (i != (_gdi->_numStrips - 1) && vs->bdirty[i + 1]) {
+				const int nextTop = MIN<int>(top, vs->tdirty[i + 1]);
+				const int nextBottom = MAX<int>(bottom, vs->bdirty[i + 1]);
+				const int nextDirtyArea = dirtyArea + 8 * (vs->bdirty[i + 1] - vs->tdirty[i + 1]);
+				if ((w + 8) * (nextBottom - nextTop) * 4 > nextDirtyArea * 5)
+					break;
+
+				i++;
 				w += 8;
-				continue;
+				top = nextTop;
+				bottom = nextBottom;
+				dirtyArea = nextDirtyArea;
+				vs->tdirty[i] = vs->h;
+				vs->bdirty[i] = 0;
 			}
 #ifndef DISABLE_TOWNS_DUAL_LAYER_MODE
 			if (_game.platform == Common::kPlatformFMTowns && vs->number == kBannerVirtScreen) {
@@ -620,6 +635,83 @@ void ScummEngine::updateDirtyScreen(VirtScreenNumber slot) {
 	}
 }
 
+/**
+ * Compose the text surface over the game graphics: every text pixel with
+ * the value CHARSET_MASK_TRANSPARENCY shows the game graphics below it.
+ * The width is a multiple of four and the rows are four byte aligned.
+ */
+static void compositeTextGeneric(byte *dst, int dstPitch, const byte *src, int srcPitch, const byte *text, int textPitch, int width, int height) {
+	// We blit four pixels at a time, for improved performance.
+	for (int h = height; h > 0; --h) {
+		const uint32 *src32 = (const uint32 *)src;
+		const uint32 *text32 = (const uint32 *)text;
+		uint32 *dst32 = (uint32 *)dst;
+
+		for (int w = width; w > 0; w -= 4) {
+			uint32 temp = *text32++;
+
+			// Generate a byte mask for those text pixels (bytes) with
+			// value CHARSET_MASK_TRANSPARENCY. In the end, each byte
+			// in mask will be either equal to 0x00 or 0xFF.
+			// Doing it this way avoids branches and bytewise operations,
+			// at the cost of readability ;).
+			uint32 mask = temp ^ CHARSET_MASK_TRANSPARENCY_32;
+			mask = (((mask & 0x7f7f7f7f) + 0x7f7f7f7f) | mask) & 0x80808080;
+			mask = ((mask >> 7) + 0x7f7f7f7f) ^ 0x80808080;
+
+			// The following line is equivalent to this code:
+			//   *dst32++ = (*src32++ & mask) | (temp & ~mask);
+			// However, some compilers can generate somewhat better
+			// machine code for this equivalent statement:
+			*dst32++ = ((temp ^ *src32++) & mask) ^ temp;
+		}
+
+		dst += dstPitch;
+		src += srcPitch;
+		text += textPitch;
+	}
+}
+
+typedef void (*CompositeTextFunc)(byte *dst, int dstPitch, const byte *src, int srcPitch, const byte *text, int textPitch, int width, int height);
+
+#ifdef SCUMMVM_SSE2
+// Defined in gfx_sse2.cpp
+void compositeTextSSE2(byte *dst, int dstPitch, const byte *src, int srcPitch, const byte *text, int textPitch, int width, int height);
+#endif
+
+#ifdef SCUMMVM_NEON
+// Defined in gfx_neon.cpp
+void compositeTextNEON(byte *dst, int dstPitch, const byte *src, int srcPitch, const byte *text, int textPitch, int width, int height);
+#endif
+
+/**
+ * Pick the text compositing kernel for the CPU. Without a vector unit, the
+ * ARM assembly is preferred where it is built, which is signalled by nullptr.
+ */
+static CompositeTextFunc getCompositeText() {
+	CompositeTextFunc func = compositeTextGeneric;
+#ifdef USE_ARM_GFX_ASM
+	func = nullptr;
+#endif
+#if defined(SCUMMVM_SSE2) && (defined(__x86_64__) || defined(_M_X64))
+	func = compositeTextSSE2;
+#elif defined(SCUMMVM_NEON) && defined(__aarch64__)
+	func = compositeTextNEON;
+#else
+	if (g_system) {
+#ifdef SCUMMVM_NEON
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON))
+			func = compositeTextNEON;
+#endif
+#ifdef SCUMMVM_SSE2
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+			func = compositeTextSSE2;
+#endif
+	}
+#endif
+	return func;
+}
+
 /**
  * Blit the specified rectangle from the given virtual screen to the display.
  * Note: t and b are in *virtual screen* coordinates, while x is relative to
@@ -721,40 +813,13 @@ void ScummEngine::drawStripToScreen(VirtScreen *vs, int x, int width, int top, i
 				textPtr += _textSurface.pitch - width * m;
 			}
 		} else {
+			static const CompositeTextFunc compositeText = getCompositeText();
 #ifdef USE_ARM_GFX_ASM
-			asmDrawStripToScreen(height, width, text, src, _compositeBuf, vs->pitch, width, _textSurface.pitch);
-#else
-			// We blit four pixels at a time, for improved performance.
-			const uint32 *src32 = (const uint32 *)src;
-			uint32 *dst32 = (uint32 *)_compositeBuf;
-
-			vsPitch >>= 2;
-
-			const uint32 *text32 = (const uint32 *)text;
-			const int textPitch = (_textSurface.pitch - width * m) >> 2;
-			for (int h = height * m; h > 0; --h) {
-				for (int w = width * m; w > 0; w -= 4) {
-					uint32 temp = *text32++;
-
-					// Generate a byte mask for those text pixels (bytes) with
-					// value CHARSET_MASK_TRANSPARENCY. In the end, each byte
-					// in mask will be either equal to 0x00 or 0xFF.
-					// Doing it this way avoids branches and bytewise operations,
-					// at the cost of readability ;).
-					uint32 mask = temp ^ CHARSET_MASK_TRANSPARENCY_32;
-					mask = (((mask & 0x7f7f7f7f) + 0x7f7f7f7f) | mask) & 0x80808080;
-					mask = ((mask >> 7) + 0x7f7f7f7f) ^ 0x80808080;
-
-					// The following line is equivalent to this code:
-					//   *dst32++ = (*src32++ & mask) | (temp & ~mask);
-					// However, some compilers can generate somewhat better
-					// machine code for this equivalent statement:
-					*dst32++ = ((temp ^ *src32++) & mask) ^ temp;
-				}
-				src32 += vsPitch;
-				text32 += textPitch;
-			}
+			if (!compositeText)
+				asmDrawStripToScreen(height, width, text, src, _compositeBuf, vs->pitch, width, _textSurface.pitch);
+			else
 #endif
+				compositeText(_compositeBuf, width * m, (const byte *)src, width * m + vsPitch, (const byte *)text, _textSurface.pitch, width * m, height * m);
 		}
 		src = _compositeBuf;
 		pitch = width * vs->format.bytesPerPixel;
@@ -0,0 +1,78 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "scumm/gfx.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Scumm {
+
+/**
+ * Compose the text surface over the game graphics, sixteen pixels at a
+ * time; see compositeTextGeneric() in gfx.cpp.
+ */
+void compositeTextNEON(byte *dst, int dstPitch, const byte *src, int srcPitch, const byte *text, int textPitch, int width, int height) {
+	const uint8x16_t transparent = vdupq_n_u8(CHARSET_MASK_TRANSPARENCY);
+
+	for (int h = 0; h < height; ++h) {
+		int w = 0;
+		for (; w + 16 <= width; w += 16) {
+			const uint8x16_t t = vld1q_u8(text + w);
+			const uint8x16_t s = vld1q_u8(src + w);
+			vst1q_u8(dst + w, vbslq_u8(vceqq_u8(t, transparent), s, t));
+		}
+		for (; w < width; ++w)
+			dst[w] = (text[w] == CHARSET_MASK_TRANSPARENCY) ? src[w] : text[w];
+
+		dst += dstPitch;
+		src += srcPitch;
+		text += textPitch;
+	}
+}
+
+} // End of namespace Scumm
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
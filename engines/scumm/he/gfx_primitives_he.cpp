@@ -1386,6 +1386,77 @@ void Wiz::pgBackwardsRemapPixelCopy(WizRawPixel *dstPtr, const WizRawPixel *srcP
 	}
 }
 
+// WIZRAWPIXEL_HI_BITS of the RGB555 pixels, for the 50/50 mixing kernels
+#define WIZRAWPIXEL16_HI_BITS 0xFBDE
+
+static void pgForward5050MixGeneric(uint16 *dst, const uint16 *src, int count) {
+	for (int i = 0; i < count; i++) {
+		WizRawPixel16 srcColor = FROM_LE_16(src[i]);
+		dst[i] = ((srcColor & WIZRAWPIXEL16_HI_BITS) >> 1) + ((dst[i] & WIZRAWPIXEL16_HI_BITS) >> 1);
+	}
+}
+
+static void pgTransparentForward5050MixGeneric(uint16 *dst, const uint16 *src, int count, uint16 transparentColor) {
+	for (int i = 0; i < count; i++) {
+		WizRawPixel16 srcColor = FROM_LE_16(src[i]);
+		if (srcColor != transparentColor)
+			dst[i] = ((srcColor & WIZRAWPIXEL16_HI_BITS) >> 1) + ((dst[i] & WIZRAWPIXEL16_HI_BITS) >> 1);
+	}
+}
+
+typedef void (*Forward5050MixFunc)(uint16 *dst, const uint16 *src, int count);
+typedef void (*TransparentForward5050MixFunc)(uint16 *dst, const uint16 *src, int count, uint16 transparentColor);
+
+#ifdef SCUMMVM_SSE2
+// Defined in gfx_primitives_he_sse2.cpp
+void pgForward5050MixSSE2(uint16 *dst, const uint16 *src, int count);
+void pgTransparentForward5050MixSSE2(uint16 *dst, const uint16 *src, int count, uint16 transparentColor);
+#endif
+
+#ifdef SCUMMVM_NEON
+// Defined in gfx_primitives_he_neon.cpp
+void pgForward5050MixNEON(uint16 *dst, const uint16 *src, int count);
+void pgTransparentForward5050MixNEON(uint16 *dst, const uint16 *src, int count, uint16 transparentColor);
+#endif
+
+struct Forward5050MixFuncs {
+	Forward5050MixFunc mix;
+	TransparentForward5050MixFunc transparentMix;
+};
+
+/**
+ * Pick the RGB555 50/50 mixing kernels for the CPU. The vector kernels
+ * read the little endian source pixels as they are.
+ */
+static Forward5050MixFuncs getForward5050MixFuncs() {
+	Forward5050MixFuncs funcs = { pgForward5050MixGeneric, pgTransparentForward5050MixGeneric };
+#ifdef SCUMM_LITTLE_ENDIAN
+#if defined(SCUMMVM_SSE2) && (defined(__x86_64__) || defined(_M_X64))
+	funcs.mix = pgForward5050MixSSE2;
+	funcs.transparentMix = pgTransparentForward5050MixSSE2;
+#elif defined(SCUMMVM_NEON) && defined(__aarch64__)
+	funcs.mix = pgForward5050MixNEON;
+	funcs.transparentMix = pgTransparentForward5050MixNEON;
+#else
+	if (g_system) {
+#ifdef SCUMMVM_NEON
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON)) {
+			funcs.mix = pgForward5050MixNEON;
+			funcs.transparentMix = pgTransparentForward5050MixNEON;
+		}
+#endif
+#ifdef SCUMMVM_SSE2
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2)) {
+			funcs.mix = pgForward5050MixSSE2;
+			funcs.transparentMix = pgTransparentForward5050MixSSE2;
+		}
+#endif
+	}
+#endif
+#endif // SCUMM_LITTLE_ENDIAN
+	return funcs;
+}
+
 void Wiz::pgForwardMixColorsPixelCopy(WizRawPixel *dstPtr, const WizRawPixel *srcPtr, int size, const byte *lookupTable) {
 	if (!_uses16BitColor) {
 		WizRawPixel8 *dst8 = (WizRawPixel8 *)dstPtr;
@@ -1399,15 +1470,11 @@ void Wiz::pgForwardMixColorsPixelCopy(WizRawPixel *dstPtr, const WizRawPixel *sr
 		WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
 		const WizRawPixel16 *src16 = (const WizRawPixel16 *)srcPtr;
 
-		while (size-- > 0) {
-			if (_vm->_game.heversion >= 99) {
-				WizRawPixel16 srcColor = FROM_LE_16(*src16++);
-				WizRawPixel16 dstColor = *dst16;
-
-				*dst16++ = WIZRAWPIXEL_50_50_MIX(
-					WIZRAWPIXEL_50_50_PREMIX_COLOR(srcColor),
-					WIZRAWPIXEL_50_50_PREMIX_COLOR(dstColor));
-			} else {
+		if (_vm->_game.heversion >= 99) {
+			static const Forward5050MixFuncs funcs = getForward5050MixFuncs();
+			funcs.mix(dst16, src16, size);
+		} else {
+			while (size-- > 0) {
 				*dst16++ = FROM_LE_16(*src16++);
 			}
 		}
@@ -1466,19 +1533,8 @@ void Wiz::pgTransparentForwardMixColorsPixelCopy(WizRawPixel *dstPtr, const WizR
 		WizRawPixel16 *dst16 = (WizRawPixel16 *)dstPtr;
 		const WizRawPixel16 *src16 = (const WizRawPixel16 *)srcPtr;
 
-		while (size-- > 0) {
-			WizRawPixel16 srcColor = FROM_LE_16(*src16++);
-
-			if (transparentColor != srcColor) {
-				WizRawPixel16 dstColor = *dst16;
-
-				*dst16++ = WIZRAWPIXEL_50_50_MIX(
-					WIZRAWPIXEL_50_50_PREMIX_COLOR(srcColor),
-					WIZRAWPIXEL_50_50_PREMIX_COLOR(dstColor));
-			} else {
-				++dst16;
-			}
-		}
+		static const Forward5050MixFuncs funcs = getForward5050MixFuncs();
+		funcs.transparentMix(dst16, src16, size, transparentColor);
 	}
 }
 
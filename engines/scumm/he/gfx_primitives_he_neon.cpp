@@ -0,0 +1,96 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Scumm {
+
+// WIZRAWPIXEL_HI_BITS of the RGB555 pixels
+#define WIZRAWPIXEL16_HI_BITS 0xFBDE
+
+/**
+ * Mix the pixels 50/50 into the destination, eight pixels at a time; see
+ * pgForwardMixColorsPixelCopy() in gfx_primitives_he.cpp.
+ */
+void pgForward5050MixNEON(uint16 *dst, const uint16 *src, int count) {
+	const uint16x8_t hiBits = vdupq_n_u16(WIZRAWPIXEL16_HI_BITS);
+
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const uint16x8_t s = vshrq_n_u16(vandq_u16(vld1q_u16(src + i), hiBits), 1);
+		const uint16x8_t d = vshrq_n_u16(vandq_u16(vld1q_u16(dst + i), hiBits), 1);
+		vst1q_u16(dst + i, vaddq_u16(s, d));
+	}
+	for (; i < count; ++i)
+		dst[i] = ((src[i] & WIZRAWPIXEL16_HI_BITS) >> 1) + ((dst[i] & WIZRAWPIXEL16_HI_BITS) >> 1);
+}
+
+/**
+ * Like pgForward5050MixNEON(), leaving the destination alone where the
+ * source is transparent.
+ */
+void pgTransparentForward5050MixNEON(uint16 *dst, const uint16 *src, int count, uint16 transparentColor) {
+	const uint16x8_t hiBits = vdupq_n_u16(WIZRAWPIXEL16_HI_BITS);
+	const uint16x8_t transparent = vdupq_n_u16(transparentColor);
+
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const uint16x8_t s = vld1q_u16(src + i);
+		const uint16x8_t d = vld1q_u16(dst + i);
+		const uint16x8_t mix = vaddq_u16(
+			vshrq_n_u16(vandq_u16(s, hiBits), 1),
+			vshrq_n_u16(vandq_u16(d, hiBits), 1));
+		vst1q_u16(dst + i, vbslq_u16(vceqq_u16(s, transparent), d, mix));
+	}
+	for (; i < count; ++i) {
+		if (src[i] != transparentColor)
+			dst[i] = ((src[i] & WIZRAWPIXEL16_HI_BITS) >> 1) + ((dst[i] & WIZRAWPIXEL16_HI_BITS) >> 1);
+	}
+}
+
+} // End of namespace Scumm
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
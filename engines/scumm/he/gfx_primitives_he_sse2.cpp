@@ -0,0 +1,93 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Scumm {
+
+// WIZRAWPIXEL_HI_BITS of the RGB555 pixels
+#define WIZRAWPIXEL16_HI_BITS 0xFBDE
+
+/**
+ * Mix the pixels 50/50 into the destination, eight pixels at a time; see
+ * pgForwardMixColorsPixelCopy() in gfx_primitives_he.cpp.
+ */
+void pgForward5050MixSSE2(uint16 *dst, const uint16 *src, int count) {
+	const __m128i hiBits = _mm_set1_epi16((short)WIZRAWPIXEL16_HI_BITS);
+
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m128i s = _mm_srli_epi16(_mm_and_si128(_mm_loadu_si128((const __m128i *)(src + i)), hiBits), 1);
+		const __m128i d = _mm_srli_epi16(_mm_and_si128(_mm_loadu_si128((const __m128i *)(dst + i)), hiBits), 1);
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_add_epi16(s, d));
+	}
+	for (; i < count; ++i)
+		dst[i] = ((src[i] & WIZRAWPIXEL16_HI_BITS) >> 1) + ((dst[i] & WIZRAWPIXEL16_HI_BITS) >> 1);
+}
+
+/**
+ * Like pgForward5050MixSSE2(), leaving the destination alone where the
+ * source is transparent.
+ */
+void pgTransparentForward5050MixSSE2(uint16 *dst, const uint16 *src, int count, uint16 transparentColor) {
+	const __m128i hiBits = _mm_set1_epi16((short)WIZRAWPIXEL16_HI_BITS);
+	const __m128i transparent = _mm_set1_epi16((short)transparentColor);
+
+	int i = 0;
+	for (; i + 8 <= count; i += 8) {
+		const __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+		const __m128i d = _mm_loadu_si128((const __m128i *)(dst + i));
+		const __m128i mix = _mm_add_epi16(
+			_mm_srli_epi16(_mm_and_si128(s, hiBits), 1),
+			_mm_srli_epi16(_mm_and_si128(d, hiBits), 1));
+		const __m128i mask = _mm_cmpeq_epi16(s, transparent);
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_or_si128(_mm_and_si128(mask, d), _mm_andnot_si128(mask, mix)));
+	}
+	for (; i < count; ++i) {
+		if (src[i] != transparentColor)
+			dst[i] = ((src[i] & WIZRAWPIXEL16_HI_BITS) >> 1) + ((dst[i] & WIZRAWPIXEL16_HI_BITS) >> 1);
+	}
+}
+
+} // End of namespace Scumm
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
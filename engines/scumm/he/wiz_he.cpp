@@ -52,6 +52,77 @@ void Wiz::clearWizBuffer() {
 	_wizBufferIndex = 0;
 }
 
+void Wiz::invalidateDecodedImages(int image) {
+	for (DecodedImageCache::iterator i = _decodedImages.begin(); i != _decodedImages.end(); ++i) {
+		if (!image || i->_key.image == image) {
+			_decodedImagesSize -= i->_value.size;
+			_decodedImages.erase(i);
+		}
+	}
+}
+
+#define WIZ_DECODED_IMAGES_BUDGET (4 * 1024 * 1024)
+
+WizPxShrdBuffer Wiz::getDecodedTRLEImage(int image, int state, int32 flags, const WizRawPixel *conversionTable) {
+	// Remapping and palette changes are tied to the current palette...
+	if (flags & (kWRFUsePalette | kWRFRemap | kWRFZPlaneOn | kWRFZPlaneOff))
+		return drawAWizPrim(image, state, 0, 0, 0, 0, 0, 0, kWRFAlloc | flags, 0, conversionTable);
+
+	// ...and so is the default conversion table, see drawAWizPrimEx()
+	if (_vm->_game.heversion > 98 && !conversionTable)
+		conversionTable = (WizRawPixel *)_vm->getHEPaletteSlot(1);
+
+	const byte *data = getWizStateDataPrim(image, state);
+	int32 width, height;
+	getWizImageDim(image, state, width, height);
+
+	const uint32 size = width * height * (_uses16BitColor ? sizeof(WizRawPixel16) : sizeof(WizRawPixel8));
+	const int fillColor = _vm->_game.heversion < 95 ? 0x05 : _vm->VAR(_vm->VAR_WIZ_TRANSPARENT_COLOR);
+	const uint32 tableSize = 256 * (_uses16BitColor ? sizeof(WizRawPixel16) : sizeof(WizRawPixel8));
+
+	const DecodedImageKey key = { image, state, flags };
+	DecodedImageCache::iterator it = _decodedImages.find(key);
+	if (it != _decodedImages.end()) {
+		const DecodedImage &decoded = it->_value;
+		if (decoded.data == data && decoded.size == size && decoded.fillColor == fillColor &&
+			decoded.hasConversionTable == (conversionTable != nullptr) &&
+			(!conversionTable || !memcmp(decoded.conversionTable, conversionTable, tableSize))) {
+			it->_value.lastUse = ++_decodedImagesUseCounter;
+			return decoded.buffer;
+		}
+		_decodedImagesSize -= decoded.size;
+		_decodedImages.erase(it);
+	}
+
+	WizPxShrdBuffer buffer = drawAWizPrim(image, state, 0, 0, 0, 0, 0, 0, kWRFAlloc | flags, 0, conversionTable);
+	if (!buffer() || size > WIZ_DECODED_IMAGES_BUDGET / 4)
+		return buffer;
+
+	// Evict the least recently used images
+	while (_decodedImagesSize + size > WIZ_DECODED_IMAGES_BUDGET) {
+		DecodedImageCache::iterator oldest = _decodedImages.begin();
+		for (DecodedImageCache::iterator i = _decodedImages.begin(); i != _decodedImages.end(); ++i) {
+			if (i->_value.lastUse < oldest->_value.lastUse)
+				oldest = i;
+		}
+		_decodedImagesSize -= oldest->_value.size;
+		_decodedImages.erase(oldest);
+	}
+
+	DecodedImage &decoded = _decodedImages[key];
+	decoded.buffer = buffer;
+	decoded.data = data;
+	decoded.fillColor = fillColor;
+	decoded.hasConversionTable = (conversionTable != nullptr);
+	if (conversionTable)
+		memcpy(decoded.conversionTable, conversionTable, tableSize);
+	decoded.size = size;
+	decoded.lastUse = ++_decodedImagesUseCounter;
+	_decodedImagesSize += size;
+
+	return buffer;
+}
+
 void Wiz::processWizImageCaptureCmd(const WizImageCommand *params) {
 	bool compressIt = (params->compressionType == kWCTTRLE);
 	bool background = (params->flags & kWRFBackground) != 0;
@@ -62,6 +133,8 @@ void Wiz::processWizImageCaptureCmd(const WizImageCommand *params) {
 }
 
 void Wiz::takeAWiz(int globnum, int x1, int y1, int x2, int y2, bool back, bool compress) {
+	invalidateDecodedImages(globnum);
+
 	int bufferWidth, bufferHeight;
 	Common::Rect rect, clipRect;
 	WizPxShrdBuffer srcPtr;
@@ -1360,6 +1433,8 @@ void Wiz::processWizImageDrawCmd(const WizImageCommand *params) {
 void Wiz::dwCreateRawWiz(int imageNum, int w, int h, int flags, int bitsPerPixel, int optionalSpotX, int optionalSpotY) {
 	int compressionType, wizdSize;
 
+	invalidateDecodedImages(imageNum);
+
 	int globSize = _vm->_resourceHeaderSize; // AWIZ header size
 	globSize += WIZBLOCK_WIZH_SIZE;
 
@@ -2217,6 +2292,7 @@ void Wiz::remapImagePrim(int image, int state, int tableCount, const uint8 *rema
 
 	// Set the modified bit...
 	_vm->_res->setModified(rtImage, image);
+	invalidateDecodedImages(image);
 	WRITE_BE_UINT32(basePtr + _vm->_resourceHeaderSize, WIZ_MAGIC_REMAP_NUMBER);
 	tablePtr = basePtr + _vm->_resourceHeaderSize + 4;
 
@@ -2628,6 +2704,10 @@ void Wiz::processWizImageCmd(const WizImageCommand *params) {
 		return;
 	}
 
+	// Every action but drawing and saving may replace the image data...
+	if (params->image && params->actionType != kWADraw && params->actionType != kWASave)
+		invalidateDecodedImages(params->image);
+
 	switch (params->actionType) {
 	case kWAUnknown:
 		// Do nothing...
@@ -2795,6 +2875,7 @@ void Wiz::setWizCompressionType(int image, int state, int newType) {
 	byte *data = getWizStateHeaderPrim(image, state);
 	assert(data);
 
+	invalidateDecodedImages(image);
 	WRITE_LE_UINT32(data + _vm->_resourceHeaderSize, newType);
 }
 
@@ -24,6 +24,7 @@
 
 //#define WIZ_DEBUG_BUFFERS
 
+#include "common/hashmap.h"
 #include "common/rect.h"
 
 namespace Scumm {
@@ -641,12 +642,15 @@ public:
 
 	Wiz(ScummEngine_v71he *vm);
 	~Wiz() {
+		_decodedImages.clear();
 #ifdef WIZ_DEBUG_BUFFERS
 		WizPxShrdBuffer::dbgLeakRpt();
 #endif
 	}
 
 	void clearWizBuffer();
+	/** Drop the decoded copies of this image, or of all images if 0. */
+	void invalidateDecodedImages(int image = 0);
 	Common::Rect _wizClipRect;
 	bool _useWizClipRect = false;
 	bool _uses16BitColor = false;
@@ -816,6 +820,47 @@ public:
 private:
 	ScummEngine_v71he *_vm;
 
+	/**
+	 * A TRLE image state decoded for warpDrawWizTo4Points(), which would
+	 * otherwise decompress the whole image again for every rotated or
+	 * scaled draw. TRLE data is only replaced, never drawn into, so the
+	 * entries are checked against the state data and the fill color and
+	 * conversion table they were decoded with, and are dropped whenever
+	 * the image is captured, loaded, created or remapped.
+	 */
+	struct DecodedImageKey {
+		int image;
+		int state;
+		int32 flags;
+
+		bool operator==(const DecodedImageKey &other) const {
+			return image == other.image && state == other.state && flags == other.flags;
+		}
+	};
+
+	struct DecodedImageKeyHash {
+		uint operator()(const DecodedImageKey &key) const {
+			return key.image ^ (key.state << 16) ^ ((uint)key.flags >> 8);
+		}
+	};
+
+	struct DecodedImage {
+		WizPxShrdBuffer buffer;
+		const byte *data;
+		int fillColor;
+		bool hasConversionTable;
+		WizRawPixel16 conversionTable[256];
+		uint32 size;
+		uint32 lastUse;
+	};
+
+	typedef Common::HashMap<DecodedImageKey, DecodedImage, DecodedImageKeyHash> DecodedImageCache;
+	DecodedImageCache _decodedImages;
+	uint32 _decodedImagesSize = 0;
+	uint32 _decodedImagesUseCounter = 0;
+
+	WizPxShrdBuffer getDecodedTRLEImage(int image, int state, int32 flags, const WizRawPixel *conversionTable);
+
 
 public:
 	/* Drawing Primitives
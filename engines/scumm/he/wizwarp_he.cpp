@@ -22,6 +22,7 @@
 #ifdef ENABLE_HE
 
 #include "common/system.h"
+#include "common/threadpool.h"
 #include "scumm/he/intern_he.h"
 #include "scumm/he/wiz_he.h"
 
@@ -33,6 +34,27 @@ namespace Scumm {
 #define WARP_TO_FRAC(_x_)     ((_x_) << (WARP_FRAC_SIZE))
 #define WARP_FROM_FRAC(_x_)   ((_x_) >> (WARP_FRAC_SIZE))
 
+// Each draw span covers a different destination row, so the spans of a big
+// warp are drawn in bands on the thread pool...
+#define WARP_BAND_MIN_SPANS   32
+#define WARP_BAND_MIN_PIXELS  (64 * 1024)
+
+template<class F>
+static void warpDrawSpansInBands(const WarpWizOneDrawSpan *drawSpans, int count, F drawSpansFunc) {
+	int pixels = 0;
+	for (int i = 0; i < count; i++)
+		pixels += drawSpans[i].dstWidth;
+
+	if (count < 2 * WARP_BAND_MIN_SPANS || pixels < WARP_BAND_MIN_PIXELS) {
+		drawSpansFunc(drawSpans, count);
+		return;
+	}
+
+	ThreadPoolMan.parallelFor(0, count, [&](uint first, uint last) {
+		drawSpansFunc(drawSpans + first, (int)(last - first));
+	}, WARP_BAND_MIN_SPANS);
+}
+
 bool Wiz::warpDrawWiz(int image, int state, int polygon, int32 flags, int transparentColor, WizSimpleBitmap *optionalDestBitmap, const WizRawPixel *optionalColorConversionTable, int shadowImage) {
 	const byte *xmapColorTable;
 	int polyIndex;
@@ -91,7 +113,11 @@ bool Wiz::warpDrawWizTo4Points(int image, int state, const WarpWizPoint *dstPoin
 	if ((getWizCompressionType(image, state) != kWCTNone) ||
 		(optionalColorConversionTable != nullptr) || (flags & (kWRFHFlip | kWRFVFlip | kWRFRemap))) {
 
-		srcBitmap.bufferPtr = drawAWizPrim(image, state, 0, 0, 0, 0, 0, 0, kWRFAlloc | flags, 0, optionalColorConversionTable);
+		if (getWizCompressionType(image, state) == kWCTTRLE) {
+			srcBitmap.bufferPtr = getDecodedTRLEImage(image, state, flags, optionalColorConversionTable);
+		} else {
+			srcBitmap.bufferPtr = drawAWizPrim(image, state, 0, 0, 0, 0, 0, 0, kWRFAlloc | flags, 0, optionalColorConversionTable);
+		}
 
 		if (!srcBitmap.bufferPtr()) {
 			return false;
@@ -1095,21 +1121,29 @@ bool Wiz::warpNPt2NPtWarpCORE(WizSimpleBitmap *dstBitmap, const WarpWizPoint *ds
 		if (st->drawSpanCount) {
 			if (transparentColor != -1) {
 				if (wizFlags & kWRFAreaSampleDuringWarp) {
-					warpProcessDrawSpansTransparentSampled(
-						dstBitmap, srcBitmap, st->drawSpans, st->drawSpanCount,
-						(WizRawPixel)transparentColor);
+					warpDrawSpansInBands(st->drawSpans, st->drawSpanCount, [&](const WarpWizOneDrawSpan *drawSpans, int count) {
+						warpProcessDrawSpansTransparentSampled(
+							dstBitmap, srcBitmap, drawSpans, count,
+							(WizRawPixel)transparentColor);
+					});
 				} else {
-					warpProcessDrawSpansTransparent(
-						dstBitmap, srcBitmap, st->drawSpans, st->drawSpanCount,
-						(WizRawPixel)transparentColor);
+					warpDrawSpansInBands(st->drawSpans, st->drawSpanCount, [&](const WarpWizOneDrawSpan *drawSpans, int count) {
+						warpProcessDrawSpansTransparent(
+							dstBitmap, srcBitmap, drawSpans, count,
+							(WizRawPixel)transparentColor);
+					});
 				}
 			} else {
 				if (wizFlags & kWRFAreaSampleDuringWarp) {
-					warpProcessDrawSpansSampled(
-						dstBitmap, srcBitmap, st->drawSpans, st->drawSpanCount);
+					warpDrawSpansInBands(st->drawSpans, st->drawSpanCount, [&](const WarpWizOneDrawSpan *drawSpans, int count) {
+						warpProcessDrawSpansSampled(
+							dstBitmap, srcBitmap, drawSpans, count);
+					});
 				} else {
-					warpProcessDrawSpansA(
-						dstBitmap, srcBitmap, st->drawSpans, st->drawSpanCount);
+					warpDrawSpansInBands(st->drawSpans, st->drawSpanCount, [&](const WarpWizOneDrawSpan *drawSpans, int count) {
+						warpProcessDrawSpansA(
+							dstBitmap, srcBitmap, drawSpans, count);
+					});
 				}
 			}
 		}
@@ -1141,11 +1175,15 @@ bool Wiz::warpNPt2NPtNonClippedWarp(WizSimpleBitmap *dstBitmap, const WarpWizPoi
 		if (st) {
 			if (st->drawSpanCount) {
 				if (transparentColor != -1) {
-					warpProcessDrawSpansTransparent(
-						dstBitmap, srcBitmap, st->drawSpans, st->drawSpanCount,
-						(WizRawPixel)transparentColor);
+					warpDrawSpansInBands(st->drawSpans, st->drawSpanCount, [&](const WarpWizOneDrawSpan *drawSpans, int count) {
+						warpProcessDrawSpansTransparent(
+							dstBitmap, srcBitmap, drawSpans, count,
+							(WizRawPixel)transparentColor);
+					});
 				} else {
-					warpProcessDrawSpansA(dstBitmap, srcBitmap, st->drawSpans, st->drawSpanCount);
+					warpDrawSpansInBands(st->drawSpans, st->drawSpanCount, [&](const WarpWizOneDrawSpan *drawSpans, int count) {
+						warpProcessDrawSpansA(dstBitmap, srcBitmap, drawSpans, count);
+					});
 				}
 			}
 
@@ -1178,11 +1216,15 @@ bool Wiz::warpNPt2NPtClippedWarp(WizSimpleBitmap *dstBitmap, const WarpWizPoint
 		if (st) {
 			if (st->drawSpanCount) {
 				if (transparentColor != -1) {
-					warpProcessDrawSpansTransparent(
-						dstBitmap, srcBitmap, st->drawSpans, st->drawSpanCount,
-						(WizRawPixel)transparentColor);
+					warpDrawSpansInBands(st->drawSpans, st->drawSpanCount, [&](const WarpWizOneDrawSpan *drawSpans, int count) {
+						warpProcessDrawSpansTransparent(
+							dstBitmap, srcBitmap, drawSpans, count,
+							(WizRawPixel)transparentColor);
+					});
 				} else {
-					warpProcessDrawSpansA(dstBitmap, srcBitmap, st->drawSpans, st->drawSpanCount);
+					warpDrawSpansInBands(st->drawSpans, st->drawSpanCount, [&](const WarpWizOneDrawSpan *drawSpans, int count) {
+						warpProcessDrawSpansA(dstBitmap, srcBitmap, drawSpans, count);
+					});
 				}
 			}
 
@@ -1209,9 +1251,11 @@ bool Wiz::warpNPt2NPtClippedWarpMixColors(WizSimpleBitmap *dstBitmap, const Warp
 
 	if (st) {
 		if (st->drawSpanCount) {
-			warpProcessDrawSpansMixColors(
-				dstBitmap, srcBitmap, st->drawSpans, st->drawSpanCount,
-				transparentColor, colorMixTable);
+			warpDrawSpansInBands(st->drawSpans, st->drawSpanCount, [&](const WarpWizOneDrawSpan *drawSpans, int count) {
+				warpProcessDrawSpansMixColors(
+					dstBitmap, srcBitmap, drawSpans, count,
+					transparentColor, colorMixTable);
+			});
 		}
 
 		warpDestroySpanTable(st);
@@ -44,6 +44,9 @@ BundleDirCache::~BundleDirCache() {
 		free(_bundleDirCache[fileId].bundleTable);
 		free(_bundleDirCache[fileId].indexTable);
 	}
+
+	for (DecodedBlockCache::iterator i = _decodedBlocks.begin(); i != _decodedBlocks.end(); ++i)
+		free(i->_value.data);
 }
 
 BundleDirCache::AudioTable *BundleDirCache::getTable(int slot) {
@@ -62,6 +65,58 @@ bool BundleDirCache::isSndDataExtComp(int slot) {
 	return _bundleDirCache[slot].isCompressed;
 }
 
+int32 BundleDirCache::getDecodedBlock(int slot, int32 offset, byte *dst) {
+	Common::StackLock lock(_decodedBlocksMutex, "BundleDirCache::getDecodedBlock()");
+
+	const DecodedBlockKey key = { slot, offset };
+	DecodedBlockCache::iterator it = _decodedBlocks.find(key);
+	if (it == _decodedBlocks.end())
+		return -1;
+
+	it->_value.lastUse = ++_decodedBlocksUseCounter;
+	memcpy(dst, it->_value.data, it->_value.size);
+	return it->_value.size;
+}
+
+bool BundleDirCache::hasDecodedBlock(int slot, int32 offset) {
+	Common::StackLock lock(_decodedBlocksMutex, "BundleDirCache::hasDecodedBlock()");
+
+	const DecodedBlockKey key = { slot, offset };
+	return _decodedBlocks.contains(key);
+}
+
+void BundleDirCache::addDecodedBlock(int slot, int32 offset, const byte *src, int32 size) {
+	if (size <= 0 || size > DIMUSE_BUN_CHUNK_SIZE)
+		return;
+
+	Common::StackLock lock(_decodedBlocksMutex, "BundleDirCache::addDecodedBlock()");
+
+	const DecodedBlockKey key = { slot, offset };
+	if (_decodedBlocks.contains(key))
+		return;
+
+	// Evict the least recently used blocks
+	while (!_decodedBlocks.empty() && _decodedBlocksSize + size > DIMUSE_BUN_BLOCK_CACHE_BUDGET) {
+		DecodedBlockCache::iterator oldest = _decodedBlocks.begin();
+		for (DecodedBlockCache::iterator i = _decodedBlocks.begin(); i != _decodedBlocks.end(); ++i) {
+			if (i->_value.lastUse < oldest->_value.lastUse)
+				oldest = i;
+		}
+		_decodedBlocksSize -= oldest->_value.size;
+		free(oldest->_value.data);
+		_decodedBlocks.erase(oldest);
+	}
+
+	DecodedBlock block;
+	block.data = (byte *)malloc(size);
+	assert(block.data);
+	memcpy(block.data, src, size);
+	block.size = size;
+	block.lastUse = ++_decodedBlocksUseCounter;
+	_decodedBlocks[key] = block;
+	_decodedBlocksSize += size;
+}
+
 int BundleDirCache::matchFile(const char *filename) {
 	int32 tag, offset;
 	bool found = false;
@@ -185,6 +240,7 @@ bool BundleMgr::open(const char *filename, bool &isCompressed, bool errorFlag) {
 
 	int slot = _cache->matchFile(filename);
 	assert(slot != -1);
+	_fileBundleId = slot;
 	isCompressed = _cache->isSndDataExtComp(slot);
 	_numFiles = _cache->getNumFiles(slot);
 	assert(_numFiles);
@@ -257,6 +313,42 @@ bool BundleMgr::loadCompTable(int32 index) {
 	return true;
 }
 
+int32 BundleMgr::decompressBlock(int block, byte *dst) {
+	// CMI hack: one more zero byte at the end of input buffer
+	_compInputBuff[_compTable[block].size] = 0;
+	_file->seek(_bundleTable[_curSampleId].offset + _compTable[block].offset, SEEK_SET);
+	_file->read(_compInputBuff, _compTable[block].size);
+	int32 outputSize = BundleCodecs::decompressCodec(_compTable[block].codec, _compInputBuff, dst, _compTable[block].size);
+
+	if (outputSize > DIMUSE_BUN_CHUNK_SIZE) {
+		error("_outputSize: %d", outputSize);
+	}
+
+	return outputSize;
+}
+
+int BundleMgr::prefetchBlocks(int32 offset, int maxBlocks) {
+	if (!_file->isOpen() || !_compTableLoaded || _isUncompressed || _curSampleId == -1)
+		return 0;
+
+	byte outputBuff[DIMUSE_BUN_CHUNK_SIZE];
+	int decoded = 0;
+	int firstBlock = MAX<int32>(offset, 0) / DIMUSE_BUN_CHUNK_SIZE;
+	int lastBlock = MIN(firstBlock + DIMUSE_BUN_PREFETCH_BLOCKS, _numCompItems);
+
+	for (int i = firstBlock; i < lastBlock && decoded < maxBlocks; i++) {
+		int32 blockOffset = _bundleTable[_curSampleId].offset + _compTable[i].offset;
+		if (i == _lastBlock || _cache->hasDecodedBlock(_fileBundleId, blockOffset))
+			continue;
+
+		int32 outputSize = decompressBlock(i, outputBuff);
+		_cache->addDecodedBlock(_fileBundleId, blockOffset, outputBuff, outputSize);
+		decoded++;
+	}
+
+	return decoded;
+}
+
 int32 BundleMgr::seekFile(int32 offset, int mode) {
 	// We don't actually seek the file, but instead try to find that the specified offset exists
 	// within the decompressed blocks, and save that offset in _curDecompressedFilePos
@@ -350,14 +442,12 @@ int32 BundleMgr::readFile(const char *name, int32 size, byte **comp_final, bool
 
 		for (i = firstBlock; i <= lastBlock; i++) {
 			if (_lastBlock != i) {
-				// CMI hack: one more zero byte at the end of input buffer
-				_compInputBuff[_compTable[i].size] = 0;
-				_file->seek(_bundleTable[found->index].offset + _compTable[i].offset, SEEK_SET);
-				_file->read(_compInputBuff, _compTable[i].size);
-				_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-
-				if (_outputSize > DIMUSE_BUN_CHUNK_SIZE) {
-					error("_outputSize: %d", _outputSize);
+				// Blocks the prefetcher got to first are already decompressed
+				int32 blockOffset = _bundleTable[found->index].offset + _compTable[i].offset;
+				_outputSize = _cache->getDecodedBlock(_fileBundleId, blockOffset, _compOutputBuff);
+				if (_outputSize < 0) {
+					_outputSize = decompressBlock(i, _compOutputBuff);
+					_cache->addDecodedBlock(_fileBundleId, blockOffset, _compOutputBuff, _outputSize);
 				}
 				_lastBlock = i;
 			}
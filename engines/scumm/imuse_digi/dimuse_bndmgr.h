@@ -24,6 +24,8 @@
 
 #include "common/scummsys.h"
 #include "common/file.h"
+#include "common/hashmap.h"
+#include "common/mutex.h"
 #include "scumm/imuse_digi/dimuse_defs.h"
 
 namespace Scumm {
@@ -53,6 +55,40 @@ private:
 		IndexNode *indexTable;
 	} _bundleDirCache[4];
 
+	/**
+	 * Decompressed bundle blocks, shared by every BundleMgr and keyed by the
+	 * bundle slot and the file offset of the compressed block. Blocks are
+	 * evicted least recently used first once DIMUSE_BUN_BLOCK_CACHE_BUDGET
+	 * bytes are cached; the streamer and the prefetcher both go through
+	 * _decodedBlocksMutex.
+	 */
+	struct DecodedBlockKey {
+		int slot;
+		int32 offset;
+
+		bool operator==(const DecodedBlockKey &other) const {
+			return slot == other.slot && offset == other.offset;
+		}
+	};
+
+	struct DecodedBlockKeyHash {
+		uint operator()(const DecodedBlockKey &key) const {
+			return (uint)key.offset ^ ((uint)key.slot << 28);
+		}
+	};
+
+	struct DecodedBlock {
+		byte *data;
+		int32 size;
+		uint32 lastUse;
+	};
+
+	typedef Common::HashMap<DecodedBlockKey, DecodedBlock, DecodedBlockKeyHash> DecodedBlockCache;
+	DecodedBlockCache _decodedBlocks;
+	int32 _decodedBlocksSize = 0;
+	uint32 _decodedBlocksUseCounter = 0;
+	Common::Mutex _decodedBlocksMutex;
+
 	const ScummEngine *_vm;
 public:
 	BundleDirCache(const ScummEngine *vm);
@@ -63,6 +99,11 @@ public:
 	IndexNode *getIndexTable(int slot);
 	int32 getNumFiles(int slot);
 	bool isSndDataExtComp(int slot);
+
+	/** Copies a cached block to dst and returns its size, or -1 if it isn't cached. */
+	int32 getDecodedBlock(int slot, int32 offset, byte *dst);
+	bool hasDecodedBlock(int slot, int32 offset);
+	void addDecodedBlock(int slot, int32 offset, const byte *src, int32 size);
 };
 
 class BundleMgr {
@@ -93,6 +134,7 @@ private:
 	int _outputSize = 0;
 	int _lastBlock = 0;
 	bool loadCompTable(int32 index);
+	int32 decompressBlock(int block, byte *dst);
 
 public:
 
@@ -105,6 +147,14 @@ public:
 	int32 seekFile(int32 offset, int size);
 	int32 readFile(const char *name, int32 size, byte **compFinal, bool headerOutside);
 	bool isExtCompBun(byte gameId);
+
+	/**
+	 * Decompresses up to maxBlocks of the blocks following the decompressed
+	 * position offset into the shared block cache, so that later reads of
+	 * the current sound don't have to touch the disk. Returns the number of
+	 * blocks decompressed.
+	 */
+	int prefetchBlocks(int32 offset, int maxBlocks);
 };
 
 } // End of namespace Scumm
@@ -184,7 +184,7 @@ void IMuseDigital::cmdsSaveLoad(Common::Serializer &ser) {
 	ser.syncAsSint32LE(_curMusicSeq, VER(103));
 	ser.syncAsSint32LE(_nextSeqToPlay, VER(103));
 	ser.syncAsByte(_radioChatterSFX, VER(103));
-	ser.syncArray(_attributes, 188, Common::Serializer::Sint32LE, VER(103));
+	ser.syncArrayAsSint32LE(_attributes, 188, VER(103));
 	ser.syncAsSint32LE(_curMusicCue, VER(103));
 }
 
@@ -45,6 +45,9 @@ namespace Scumm {
 #define DIMUSE_NUM_WAVE_BUFS   8
 #define DIMUSE_SMUSH_SOUNDID   12345678
 #define DIMUSE_BUN_CHUNK_SIZE  0x2000
+#define DIMUSE_BUN_BLOCK_CACHE_BUDGET   (1024 * 1024)
+#define DIMUSE_BUN_PREFETCH_BLOCKS      16 // Blocks kept decompressed ahead of each stream
+#define DIMUSE_BUN_PREFETCH_MAX_DECODES 2  // Blocks decompressed per stream and prefetch tick
 #define DIMUSE_GROUP_SFX       1
 #define DIMUSE_GROUP_SPEECH    2
 #define DIMUSE_GROUP_MUSIC     3
@@ -57,6 +60,7 @@ namespace Scumm {
 #define DIMUSE_TIMER_BASE_RATE_USEC     20000  // 1000000 / 50Hz
 #define DIMUSE_TIMER_GAIN_RED_RATE_USEC 100000 // 1000000 / 10Hz
 #define DIMUSE_TIMER_FADES_RATE_USEC    16667  // 1000000 / 60Hz
+#define DIMUSE_TIMER_PREFETCH_RATE_USEC 10000  // 1000000 / 100Hz
 
 // Parameters IDs
 #define DIMUSE_P_BOGUS_ID       0x0
@@ -93,7 +93,7 @@ void IMuseDigital::dispatchSaveLoad(Common::Serializer &ser) {
 		ser.syncAsSint32LE(_dispatches[l].channelCount, VER(103));
 		ser.syncAsSint32LE(_dispatches[l].currentOffset, VER(103));
 		ser.syncAsSint32LE(_dispatches[l].audioRemaining, VER(103));
-		ser.syncArray(_dispatches[l].map, 2048, Common::Serializer::Sint32LE, VER(103));
+		ser.syncArrayAsSint32LE(_dispatches[l].map, 2048, VER(103));
 
 		// This is only needed to signal if the sound originally had a stream associated with it
 		int hasStream = 0;
@@ -41,6 +41,11 @@ void IMuseDigital::timer_handler(void *refCon) {
 	diMUSE->callback();
 }
 
+void IMuseDigital::prefetch_handler(void *refCon) {
+	IMuseDigital *diMUSE = (IMuseDigital *)refCon;
+	diMUSE->streamerPrefetchStreams();
+}
+
 IMuseDigital::IMuseDigital(ScummEngine_v7 *scumm, int sampleRate, Audio::Mixer *mixer, Common::Mutex *mutex, bool lowLatencyMode)
 	: _vm(scumm), _mixer(mixer), _mutex(mutex) {
 	assert(_vm);
@@ -141,9 +146,16 @@ IMuseDigital::IMuseDigital(ScummEngine_v7 *scumm, int sampleRate, Audio::Mixer *
 	_underrunCooldown = _maxQueuedStreams;
 
 	_vm->getTimerManager()->installTimerProc(timer_handler, 1000000 / _callbackFps, this, "IMuseDigital");
+
+	// Decompress bundle blocks ahead of the streams between callbacks, so
+	// that the streamer finds them in the block cache instead of on disk
+	if (!_isEarlyDiMUSE)
+		_vm->getTimerManager()->installTimerProc(prefetch_handler, DIMUSE_TIMER_PREFETCH_RATE_USEC, this, "IMuseDigitalPrefetch");
 }
 
 IMuseDigital::~IMuseDigital() {
+	if (!_isEarlyDiMUSE)
+		_vm->getTimerManager()->removeTimerProc(prefetch_handler);
 	_vm->getTimerManager()->removeTimerProc(timer_handler);
 	_filesHandler->deallocSoundBuffer(DIMUSE_BUFFER_SPEECH);
 	_filesHandler->deallocSoundBuffer(DIMUSE_BUFFER_MUSIC);
@@ -328,7 +340,7 @@ void IMuseDigital::saveLoadEarly(Common::Serializer &s) {
 		s.syncAsSint32LE(_curMusicCue, VER(31));
 		s.syncAsSint32LE(_nextSeqToPlay, VER(31));
 		s.syncAsByte(_radioChatterSFX, VER(76));
-		s.syncArray(_attributes, 188, Common::Serializer::Sint32LE, VER(31));
+		s.syncArrayAsSint32LE(_attributes, 188, VER(31));
 
 		for (int j = 0; j < 16; ++j)
 			skipLegacyTrackEntry(s);
@@ -80,6 +80,7 @@ private:
 
 	int _callbackFps;
 	static void timer_handler(void *refConf);
+	static void prefetch_handler(void *refConf);
 	void callback();
 
 	bool _isEarlyDiMUSE;
@@ -187,6 +188,7 @@ private:
 	void streamerQueryStream(IMuseDigiStream *streamPtr, int32 &bufSize, int32 &criticalSize, int32 &freeSpace, int &paused);
 	int streamerFeedStream(IMuseDigiStream *streamPtr, uint8 *srcBuf, int32 sizeToFeed, int paused);
 	int streamerFetchData(IMuseDigiStream *streamPtr);
+	int streamerPrefetchStreams();
 	void streamerSetLoopFlag(IMuseDigiStream *streamPtr, int offset);
 	void streamerRemoveLoopFlag(IMuseDigiStream *streamPtr);
 
@@ -55,7 +55,7 @@ void IMuseDigiFilesHandler::saveLoad(Common::Serializer &ser) {
 	int curSound = 0;
 	ImuseDigiSndMgr::SoundDesc *sounds = _sound->getSounds();
 
-	ser.syncArray(_currentSpeechFilename, 60, Common::Serializer::SByte, VER(103));
+	ser.syncArrayAsSByte(_currentSpeechFilename, 60, VER(103));
 	if (ser.isSaving()) {
 		for (int l = 0; l < MAX_IMUSE_SOUNDS; l++) {
 			ser.syncAsSint32LE(sounds[l].soundId, VER(103));
@@ -64,7 +64,7 @@ void IMuseDigiFilesHandler::saveLoad(Common::Serializer &ser) {
 			ser.syncAsSint32LE(_ftSpeechFileCurPos, VER(103));
 			ser.syncAsSint32LE(_ftSpeechFileSize, VER(103));
 			ser.syncAsSint32LE(_ftSpeechSubFileOffset, VER(103));
-			ser.syncArray(_ftSpeechFilename, sizeof(_ftSpeechFilename), Common::Serializer::SByte, VER(103));
+			ser.syncArrayAsSByte(_ftSpeechFilename, sizeof(_ftSpeechFilename), VER(103));
 		}
 	}
 
@@ -87,7 +87,7 @@ void IMuseDigiFilesHandler::saveLoad(Common::Serializer &ser) {
 			ser.syncAsSint32LE(_ftSpeechFileCurPos, VER(103));
 			ser.syncAsSint32LE(_ftSpeechFileSize, VER(103));
 			ser.syncAsSint32LE(_ftSpeechSubFileOffset, VER(103));
-			ser.syncArray(_ftSpeechFilename, sizeof(_ftSpeechFilename), Common::Serializer::SByte, VER(103));
+			ser.syncArrayAsSByte(_ftSpeechFilename, sizeof(_ftSpeechFilename), VER(103));
 			if (strlen(_ftSpeechFilename))
 				_ftSpeechFile = _vm->_sound->restoreDiMUSESpeechFile(_ftSpeechFilename);
 		}
@@ -256,6 +256,22 @@ int IMuseDigiFilesHandler::read(int soundId, uint8 *buf, int32 size, int bufId)
 	return 0;
 }
 
+int IMuseDigiFilesHandler::prefetch(int soundId, int32 offset) {
+	// Only DIG & COMI stream their sounds from bundles
+	if (_engine->isEngineDisabled() || _engine->isFTSoundEngine() || soundId == 0)
+		return 0;
+
+	// A soundId > 10000 is a SAN cutscene
+	if ((_vm->_game.id == GID_DIG && !(_vm->_game.features & GF_DEMO)) && (soundId > kTalkSoundID))
+		return 0;
+
+	ImuseDigiSndMgr::SoundDesc *s = _sound->findSoundById(soundId);
+	if (!s || !s->bundle)
+		return 0;
+
+	return s->bundle->prefetchBlocks(offset, DIMUSE_BUN_PREFETCH_MAX_DECODES);
+}
+
 IMuseDigiSndBuffer *IMuseDigiFilesHandler::getBufInfo(int bufId) {
 	if (bufId > 0 && bufId <= 4) {
 		return &_soundBuffers[bufId];
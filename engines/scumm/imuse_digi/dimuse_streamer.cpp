@@ -374,6 +374,23 @@ int IMuseDigital::streamerFetchData(IMuseDigiStream *streamPtr) {
 	return 0;
 }
 
+int IMuseDigital::streamerPrefetchStreams() {
+	if (_cmdsPauseCount || _isEngineDisabled)
+		return 0;
+
+	// The streamer reads under the same lock, so the bundles are never
+	// seeked from under it
+	Common::StackLock lock(*_mutex, "IMuseDigital::streamerPrefetchStreams()");
+
+	int decoded = 0;
+	for (int l = 0; l < DIMUSE_MAX_STREAMS; l++) {
+		if (_streams[l].soundId && !_streams[l].paused)
+			decoded += _filesHandler->prefetch(_streams[l].soundId, _streams[l].curOffset);
+	}
+
+	return decoded;
+}
+
 void IMuseDigital::streamerSetLoopFlag(IMuseDigiStream *streamPtr, int offset) {
 	streamPtr->vocLoopFlag = 1;
 	streamPtr->vocLoopTriggerOffset = offset;
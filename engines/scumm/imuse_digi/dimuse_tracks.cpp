@@ -108,25 +108,25 @@ void IMuseDigital::tracksSaveLoad(Common::Serializer &ser) {
 			if (_tracks[l].syncSize_0) {
 				if (ser.isLoading())
 					_tracks[l].syncPtr_0 = (byte *)malloc(_tracks[l].syncSize_0);
-				ser.syncArray(_tracks[l].syncPtr_0, _tracks[l].syncSize_0, Common::Serializer::Byte, VER(103));
+				ser.syncArrayAsByte(_tracks[l].syncPtr_0, _tracks[l].syncSize_0, VER(103));
 			}
 
 			if (_tracks[l].syncSize_1) {
 				if (ser.isLoading())
 					_tracks[l].syncPtr_1 = (byte *)malloc(_tracks[l].syncSize_1);
-				ser.syncArray(_tracks[l].syncPtr_1, _tracks[l].syncSize_1, Common::Serializer::Byte, VER(103));
+				ser.syncArrayAsByte(_tracks[l].syncPtr_1, _tracks[l].syncSize_1, VER(103));
 			}
 
 			if (_tracks[l].syncSize_2) {
 				if (ser.isLoading())
 					_tracks[l].syncPtr_2 = (byte *)malloc(_tracks[l].syncSize_2);
-				ser.syncArray(_tracks[l].syncPtr_2, _tracks[l].syncSize_2, Common::Serializer::Byte, VER(103));
+				ser.syncArrayAsByte(_tracks[l].syncPtr_2, _tracks[l].syncSize_2, VER(103));
 			}
 
 			if (_tracks[l].syncSize_3) {
 				if (ser.isLoading())
 					_tracks[l].syncPtr_3 = (byte *)malloc(_tracks[l].syncSize_3);
-				ser.syncArray(_tracks[l].syncPtr_3, _tracks[l].syncSize_3, Common::Serializer::Byte, VER(103));
+				ser.syncArrayAsByte(_tracks[l].syncPtr_3, _tracks[l].syncSize_3, VER(103));
 			}
 		}
 	}
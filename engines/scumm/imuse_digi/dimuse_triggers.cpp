@@ -79,7 +79,7 @@ int IMuseDigiTriggersHandler::clearAllTriggers() {
 void IMuseDigiTriggersHandler::saveLoad(Common::Serializer &ser) {
 	for (int l = 0; l < DIMUSE_MAX_TRIGGERS; l++) {
 		ser.syncAsSint32LE(_trigs[l].sound, VER(103));
-		ser.syncArray(_trigs[l].text, 256, Common::Serializer::SByte, VER(103));
+		ser.syncArrayAsSByte(_trigs[l].text, 256, VER(103));
 		ser.syncAsSint32LE(_trigs[l].opcode, VER(103));
 		ser.syncAsSint32LE(_trigs[l].a, VER(103));
 		ser.syncAsSint32LE(_trigs[l].b, VER(103));
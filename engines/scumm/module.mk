@@ -145,6 +145,15 @@ MODULE_OBJS += \
 	gfxARM.o
 endif
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	gfx_neon.o
+endif
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	gfx_sse2.o
+endif
+
 ifdef ENABLE_HE
 MODULE_OBJS += \
 	he/animation_he.o \
@@ -210,6 +219,15 @@ MODULE_OBJS += \
 	he/moonbase/moonbase_fow.o \
 	he/moonbase/moonbase_gfx.o
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	he/gfx_primitives_he_neon.o
+endif
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	he/gfx_primitives_he_sse2.o
+endif
+
 ifdef USE_ENET
 MODULE_OBJS += \
 	dialog-createsession.o \
@@ -22,6 +22,7 @@
 #include "common/md5.h"
 #include "common/str.h"
 #include "common/memstream.h"
+#include "common/memtag.h"
 #include "common/macresman.h"
 #ifndef MACOSX
 #include "common/config-manager.h"
@@ -843,6 +844,7 @@ byte ResourceManager::Resource::getResourceCounter() const {
 
 byte *ResourceManager::createResource(ResType type, ResId idx, uint32 size) {
 	debugC(DEBUG_RESOURCE, "_res->createResource(%s,%d,%d)", nameOfResType(type), idx, size);
+	MEMORY_TAG("scumm resources");
 
 	_vm->_insideCreateResource++; // For the HE sound engine
 
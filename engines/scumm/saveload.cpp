@@ -493,8 +493,8 @@ bool ScummEngine_v8::fetchInternalSaveStateThumbnail(int slotId, bool isHeapSave
 	// Now do the actual loading
 	Common::Serializer ser(in, nullptr);
 	ser.setVersion(hdr.ver);
-	ser.syncArray(_savegameThumbnailV8, 19200, Common::Serializer::Byte, VER(106));
-	ser.syncArray(_savegameThumbnailV8Palette, 256, Common::Serializer::Uint32LE, VER(106));
+	ser.syncArrayAsByte(_savegameThumbnailV8, 19200, VER(106));
+	ser.syncArrayAsUint32LE(_savegameThumbnailV8Palette, 256, VER(106));
 
 	delete in;
 	return true;
@@ -1460,9 +1460,9 @@ void ScummEngine::saveLoadWithSerializer(Common::Serializer &s) {
 	s.syncAsByte(_sentenceNum, VER(8));
 
 	s.syncAsByte(vm.cutSceneStackPointer, VER(8));
-	s.syncArray(vm.cutScenePtr, 5, Common::Serializer::Uint32LE, VER(8));
+	s.syncArrayAsUint32LE(vm.cutScenePtr, 5, VER(8));
 	s.syncBytes(vm.cutSceneScript, 5, VER(8));
-	s.syncArray(vm.cutSceneData, 5, Common::Serializer::Sint16LE, VER(8));
+	s.syncArrayAsSint16LE(vm.cutSceneData, 5, VER(8));
 	s.syncAsSint16LE(vm.cutSceneScriptIndex, VER(8));
 
 	s.syncAsByte(vm.numNestedScripts, VER(8));
@@ -1474,9 +1474,7 @@ void ScummEngine::saveLoadWithSerializer(Common::Serializer &s) {
 
 	if (_outputPixelFormat.bytesPerPixel == 2) {
 		if (s.getVersion() >= VER(107)) {
-			uint16 *pos = (uint16*)_grabbedCursor;
-			for (i = 0; i < 4096; ++i)
-				s.syncAsUint16LE(*pos++, VER(20));
+			s.syncArrayAsUint16LE((uint16 *)_grabbedCursor, 4096, VER(20));
 		} else if (s.getVersion() >= VER(20)) {
 			s.syncBytes(_grabbedCursor, 8192, VER(20));
 			// Patch older savegames if they were saved on a system with a
@@ -1560,9 +1558,9 @@ void ScummEngine::saveLoadWithSerializer(Common::Serializer &s) {
 	s.syncAsUint16LE(_palManipCounter, VER(10));
 
 	// gfxUsageBits grew from 200 to 410 entries. Then 3 * 410 entries:
-	s.syncArray(gfxUsageBits, 200, Common::Serializer::Uint32LE, VER(8), VER(9));
-	s.syncArray(gfxUsageBits, 410, Common::Serializer::Uint32LE, VER(10), VER(13));
-	s.syncArray(gfxUsageBits, 3 * 410, Common::Serializer::Uint32LE, VER(14));
+	s.syncArrayAsUint32LE(gfxUsageBits, 200, VER(8), VER(9));
+	s.syncArrayAsUint32LE(gfxUsageBits, 410, VER(10), VER(13));
+	s.syncArrayAsUint32LE(gfxUsageBits, 3 * 410, VER(14));
 
 	s.skip(1, VER(8), VER(50)); // _gdi->_transparentColor
 	s.syncBytes(_currentPalette, 768, VER(8));
@@ -1808,7 +1806,7 @@ void ScummEngine::saveLoadWithSerializer(Common::Serializer &s) {
 	// Save/load palette data
 	// Don't save 16 bit palette in FM-Towns and PCE games, since it gets regenerated afterwards anyway.
 	if (_16BitPalette && !(_game.platform == Common::kPlatformFMTowns && s.getVersion() < VER(82)) && !((_game.platform == Common::kPlatformFMTowns || _game.platform == Common::kPlatformPCEngine) && s.getVersion() > VER(87))) {
-		s.syncArray(_16BitPalette, 512, Common::Serializer::Uint16LE);
+		s.syncArrayAsUint16LE(_16BitPalette, 512);
 	}
 
 
@@ -1924,7 +1922,7 @@ void ScummEngine::saveLoadWithSerializer(Common::Serializer &s) {
 	//
 	// Save/load more global object state
 	//
-	s.syncArray(_classData, _numGlobalObjects, Common::Serializer::Uint32LE);
+	s.syncArrayAsUint32LE(_classData, _numGlobalObjects);
 
 
 	//
@@ -1940,15 +1938,15 @@ void ScummEngine::saveLoadWithSerializer(Common::Serializer &s) {
 
 	var98Backup = _scummVars[98];
 
-	s.syncArray(_roomVars, _numRoomVariables, Common::Serializer::Sint32LE, VER(38));
+	s.syncArrayAsSint32LE(_roomVars, _numRoomVariables, VER(38));
 
 	int currentSoundCard = VAR_SOUNDCARD != 0xFF ? VAR(VAR_SOUNDCARD) : -1;
 
 	// The variables grew from 16 to 32 bit.
 	if (s.getVersion() < VER(15))
-		s.syncArray(_scummVars, _numVariables, Common::Serializer::Sint16LE);
+		s.syncArrayAsSint16LE(_scummVars, _numVariables);
 	else
-		s.syncArray(_scummVars, _numVariables, Common::Serializer::Sint32LE);
+		s.syncArrayAsSint32LE(_scummVars, _numVariables);
 
 	if (_game.platform == Common::kPlatformDOS && s.isLoading() && VAR_SOUNDCARD != 0xFF && (_game.heversion < 70 && _game.version <= 6)) {
 		if (currentSoundCard != VAR(VAR_SOUNDCARD)) {
@@ -2191,11 +2189,11 @@ void syncWithSerializer(Common::Serializer &s, ScummEngine_v7::SubtitleText &st)
 
 void ScummEngine_v8::saveLoadWithSerializer(Common::Serializer &s) {
 	// Save/load the savegame thumbnail for COMI
-	s.syncArray(_savegameThumbnailV8, 19200, Common::Serializer::Byte, VER(106));
-	s.syncArray(_savegameThumbnailV8Palette, 256, Common::Serializer::Uint32LE, VER(106));
+	s.syncArrayAsByte(_savegameThumbnailV8, 19200, VER(106));
+	s.syncArrayAsUint32LE(_savegameThumbnailV8Palette, 256, VER(106));
 
 	// Also save the banner colors for the GUI
-	s.syncArray(_bannerColors, 50, Common::Serializer::Uint32LE, VER(106));
+	s.syncArrayAsUint32LE(_bannerColors, 50, VER(106));
 
 	ScummEngine_v7::saveLoadWithSerializer(s);
 }
@@ -2270,6 +2268,9 @@ void ScummEngine_v71he::saveLoadWithSerializer(Common::Serializer &s) {
 	ScummEngine_v70he::saveLoadWithSerializer(s);
 
 	s.syncArray(_wiz->_polygons, ARRAYSIZE(_wiz->_polygons), syncWithSerializer);
+
+	if (s.isLoading())
+		_wiz->invalidateDecodedImages();
 }
 
 void syncWithSerializer(Common::Serializer &s, FloodFillCommand &ffc) {
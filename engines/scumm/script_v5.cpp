@@ -1589,7 +1589,7 @@ void ScummEngine_v5::o5_isEqual() {
 		a == b && (b == 7 || b == 13)) {
 		// No need to skip any line if playing in always-prefer-original-text
 		// mode (Bit[588]) where silent lines are expected, or if speech is muted.
-		if (readVar(0x8000 + 588) == 1 && !ConfMan.getBool("speech_mute")) {
+		if (readVar(0x8000 + 588) == 1 && !_speechMuteSetting.get()) {
 			// Only skip the line when we can detect one and it has no sound prologue.
 			if (memcmp(_scriptPointer + 2, "\x27\x01\x1D", 3) == 0 && memcmp(_scriptPointer + 5, "\xFF\x0A", 2) != 0) {
 				// Cheat and use the next recorded line, but do it in a way so that it
@@ -450,6 +450,9 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 				  _language == Common::JA_JPN;
 
 	_enableHECompetitiveOnlineMods = ConfMan.getBool("enable_competitive_mods");
+
+	_subtitlesSetting = ConfMan.bindBool("subtitles");
+	_speechMuteSetting = ConfMan.bindBool("speech_mute");
 }
 
 
@@ -24,6 +24,7 @@
 
 #include "engines/engine.h"
 
+#include "common/config-manager.h"
 #include "common/endian.h"
 #include "common/events.h"
 #include "common/file.h"
@@ -113,9 +114,6 @@ enum {
 	NUM_SHADOW_PALETTE = 8
 };
 
-/* SCUMM Debug Channels */
-void debugC(int level, MSVC_PRINTF const char *s, ...) GCC_PRINTF(2, 3);
-
 struct VerbSlot;
 struct ObjectData;
 
@@ -549,6 +547,10 @@ public:
 	bool _isHE995 = false;
 	bool _enableHECompetitiveOnlineMods = false;
 
+	// Read by the script and text code several times per frame
+	Common::ConfigManager::BoolBinding _subtitlesSetting;
+	Common::ConfigManager::BoolBinding _speechMuteSetting;
+
 	Common::Keymap *_insaneKeymap;
 
 protected:
@@ -1581,6 +1583,22 @@ protected:
 
 	void calcItineraryMatrix(byte *itineraryMatrix, int num);
 	void createBoxMatrix();
+
+	/**
+	 * A box matrix computed by createBoxMatrix(), with the box data of
+	 * the room it was computed from. The box data holds the box flags
+	 * and coordinates the itineraries depend on, so scripts which toggle
+	 * box flags back and forth reuse the matrices of earlier states.
+	 */
+	struct BoxMatrixCacheEntry {
+		int room;
+		Common::Array<byte> boxes;
+		Common::Array<byte> matrix;
+	};
+	/** The most recently used entry first. */
+	Common::Array<BoxMatrixCacheEntry> _boxMatrixCache;
+	bool restoreCachedBoxMatrix(const byte *boxes, uint32 boxesSize);
+	void cacheBoxMatrix(const byte *boxes, uint32 boxesSize, const byte *matrix, uint32 matrixSize);
 	virtual bool areBoxesNeighbors(int i, int j);
 
 	/* String class */
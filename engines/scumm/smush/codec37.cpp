@@ -493,7 +493,7 @@ void SmushDeltaBlocksDecoder::proc4WithoutFDFE(byte *dst, const byte *src, int32
 	} while (--bh);
 }
 
-void SmushDeltaBlocksDecoder::decode(byte *dst, const byte *src) {
+const byte *SmushDeltaBlocksDecoder::decodeFrame(const byte *src) {
 	int32 bw = (_width + 3) / 4, bh = (_height + 3) / 4;
 	int32 pitch = bw * 4;
 
@@ -566,7 +566,11 @@ void SmushDeltaBlocksDecoder::decode(byte *dst, const byte *src) {
 	}
 	_prevSeqNb = seqNb;
 
-	memcpy(dst, _deltaBufs[_curTable], _frameSize);
+	return _deltaBufs[_curTable];
+}
+
+void SmushDeltaBlocksDecoder::decode(byte *dst, const byte *src) {
+	memcpy(dst, decodeFrame(src), _frameSize);
 }
 
 } // End of namespace Scumm
@@ -51,7 +51,13 @@ protected:
 	void proc4WithFDFE(byte *dst, const byte *src, int32, int, int, int, int16 *);
 	void proc4WithoutFDFE(byte *dst, const byte *src, int32, int, int, int, int16 *);
 public:
+	/**
+	 * Decode a frame into the delta buffers and return it. The frame stays
+	 * valid until the next frame is decoded.
+	 */
+	const byte *decodeFrame(const byte *src);
 	void decode(byte *dst, const byte *src);
+	int32 getFrameSize() const { return _frameSize; }
 };
 
 } // End of namespace Scumm
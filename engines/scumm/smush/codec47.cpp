@@ -44,6 +44,11 @@ namespace Scumm {
 		(dst)[1] = (src)[1];    \
 	} while (0)
 
+#define COPY_8X1_LINE(dst, src)              \
+	do {                                     \
+		COPY_4X1_LINE(dst, src);             \
+		COPY_4X1_LINE((dst) + 4, (src) + 4); \
+	} while (0)
 
 #else /* SCUMM_NEED_ALIGNMENT */
 
@@ -53,6 +58,10 @@ namespace Scumm {
 #define COPY_2X1_LINE(dst, src)               \
 	*(uint16 *)(dst) = *(const uint16 *)(src)
 
+// A single 64-bit move on the targets that don't need alignment
+#define COPY_8X1_LINE(dst, src) \
+	memcpy((dst), (src), 8)
+
 #endif
 
 #define FILL_4X1_LINE(dst, val) \
@@ -69,6 +78,9 @@ namespace Scumm {
 		(dst)[1] = val;         \
 	} while (0)
 
+#define FILL_8X1_LINE(dst, val) \
+	memset((dst), (val), 8)
+
 #define MOTION_OFFSET_TABLE_SIZE 0xF8
 #define PROCESS_SUBBLOCKS        0xFF
 #define FILL_SINGLE_COLOR        0xFE
@@ -463,8 +475,7 @@ void SmushDeltaGlyphsDecoder::level1(byte *d_dst) {
 	if (code < MOTION_OFFSET_TABLE_SIZE) {
 		tmp = _table[code] + _offset1;
 		for (i = 0; i < 8; i++) {
-			COPY_4X1_LINE(d_dst + 0, d_dst + tmp);
-			COPY_4X1_LINE(d_dst + 4, d_dst + tmp + 4);
+			COPY_8X1_LINE(d_dst, d_dst + tmp);
 			d_dst += _dPitch;
 		}
 	} else if (code == PROCESS_SUBBLOCKS) {
@@ -478,8 +489,7 @@ void SmushDeltaGlyphsDecoder::level1(byte *d_dst) {
 	} else if (code == FILL_SINGLE_COLOR) {
 		byte t = *_dSrc++;
 		for (i = 0; i < 8; i++) {
-			FILL_4X1_LINE(d_dst, t);
-			FILL_4X1_LINE(d_dst + 4, t);
+			FILL_8X1_LINE(d_dst, t);
 			d_dst += _dPitch;
 		}
 	} else if (code == DRAW_GLYPH) {
@@ -502,15 +512,13 @@ void SmushDeltaGlyphsDecoder::level1(byte *d_dst) {
 	} else if (code == COPY_PREV_BUFFER) {
 		tmp = _offset2;
 		for (i = 0; i < 8; i++) {
-			COPY_4X1_LINE(d_dst + 0, d_dst + tmp);
-			COPY_4X1_LINE(d_dst + 4, d_dst + tmp + 4);
+			COPY_8X1_LINE(d_dst, d_dst + tmp);
 			d_dst += _dPitch;
 		}
 	} else {
 		byte t = _paramPtr[code];
 		for (i = 0; i < 8; i++) {
-			FILL_4X1_LINE(d_dst, t);
-			FILL_4X1_LINE(d_dst + 4, t);
+			FILL_8X1_LINE(d_dst, t);
 			d_dst += _dPitch;
 		}
 	}
@@ -573,9 +581,9 @@ SmushDeltaGlyphsDecoder::~SmushDeltaGlyphsDecoder() {
 	}
 }
 
-bool SmushDeltaGlyphsDecoder::decode(byte *dst, const byte *src) {
+const byte *SmushDeltaGlyphsDecoder::decodeFrame(const byte *src) {
 	if ((_tableBig == nullptr) || (_tableSmall == nullptr) || (_deltaBuf == nullptr))
-		return false;
+		return nullptr;
 
 	_offset1 = _deltaBufs[1] - _curBuf;
 	_offset2 = _deltaBufs[0] - _curBuf;
@@ -621,7 +629,8 @@ bool SmushDeltaGlyphsDecoder::decode(byte *dst, const byte *src) {
 		break;
 	}
 
-	memcpy(dst, _curBuf, _frameSize);
+	// The swaps below keep the frame in one of the delta buffers
+	const byte *frame = _curBuf;
 
 	if (seqNb == _prevSeqNb + 1) {
 		if (src[3] == 1) {
@@ -633,6 +642,15 @@ bool SmushDeltaGlyphsDecoder::decode(byte *dst, const byte *src) {
 	}
 	_prevSeqNb = seqNb;
 
+	return frame;
+}
+
+bool SmushDeltaGlyphsDecoder::decode(byte *dst, const byte *src) {
+	const byte *frame = decodeFrame(src);
+	if (!frame)
+		return false;
+
+	memcpy(dst, frame, _frameSize);
 	return true;
 }
 
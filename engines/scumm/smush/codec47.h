@@ -54,7 +54,14 @@ private:
 public:
 	SmushDeltaGlyphsDecoder(int width, int height);
 	~SmushDeltaGlyphsDecoder();
+	/**
+	 * Decode a frame into the delta buffers and return it, or nullptr if
+	 * the decoder could not allocate its tables. The frame stays valid
+	 * until the next frame is decoded.
+	 */
+	const byte *decodeFrame(const byte *src);
 	bool decode(byte *dst, const byte *src);
+	int32 getFrameSize() const { return _frameSize; }
 };
 
 } // End of namespace Scumm
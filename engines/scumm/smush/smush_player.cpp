@@ -22,6 +22,7 @@
 #include "common/config-manager.h"
 #include "common/file.h"
 #include "common/system.h"
+#include "common/timer.h"
 #include "common/util.h"
 #include "common/rect.h"
 
@@ -55,6 +56,7 @@
 namespace Scumm {
 
 static const int MAX_STRINGS = 200;
+static const int DECODE_AHEAD_INTERVAL = 5 * 1000;
 static const int ETRS_HEADER_LENGTH = 16;
 
 class StringResource {
@@ -271,6 +273,13 @@ SmushPlayer::SmushPlayer(ScummEngine_v7 *scumm, IMuseDigital *imuseDigital, Insa
 	_smushAudioInitialized = false;
 	_smushAudioCallbackEnabled = false;
 
+	_decodeAheadState = kDecodeAheadNone;
+	_decodeAheadTimerInstalled = false;
+	_decodeAheadOffset = -1;
+	_decodeAheadCodec = 0;
+	_decodeAheadData = nullptr;
+	_decodeAheadFrame = nullptr;
+
 	initAudio(_imuseDigital->getSampleRate(), 200000);
 }
 
@@ -312,6 +321,12 @@ void SmushPlayer::init(int32 speed) {
 void SmushPlayer::release() {
 	_vm->_smushVideoShouldFinish = true;
 
+	if (_decodeAheadTimerInstalled) {
+		_vm->getTimerManager()->removeTimerProc(&decodeAheadTimerProc);
+		_decodeAheadTimerInstalled = false;
+	}
+	cancelDecodeAhead();
+
 	for (int i = 0; i < 5; i++) {
 		delete _sf[i];
 		_sf[i] = nullptr;
@@ -579,7 +594,7 @@ void SmushPlayer::handleTextResource(uint32 subType, int32 subSize, Common::Seek
 	// Query ConfMan here. However it may be slower, but
 	// player may want to switch the subtitles on or off during the
 	// playback. This fixes bug #2812
-	if ((!ConfMan.getBool("subtitles")) && ((flags & 8) == 8))
+	if ((!_vm->_subtitlesSetting.get()) && ((flags & 8) == 8))
 		return;
 
 	bool isCJKComi = (_vm->_game.id == GID_CMI && _vm->_useCJKMode);
@@ -754,7 +769,7 @@ byte *SmushPlayer::getVideoPalette() {
 void smushDecodeRLE(byte *dst, const byte *src, int left, int top, int width, int height, int pitch);
 void smushDecodeUncompressed(byte *dst, const byte *src, int left, int top, int width, int height, int pitch);
 
-void SmushPlayer::decodeFrameObject(int codec, const uint8 *src, int left, int top, int width, int height) {
+void SmushPlayer::decodeFrameObject(int codec, const uint8 *src, int left, int top, int width, int height, const byte *decodedFrame) {
 	if ((height == 242) && (width == 384)) {
 		if (_specialBuffer == 0)
 			_specialBuffer = (byte *)malloc(242 * 384);
@@ -781,12 +796,20 @@ void SmushPlayer::decodeFrameObject(int codec, const uint8 *src, int left, int t
 		smushDecodeRLE(_dst, src, left, top, width, height, _vm->_screenWidth);
 		break;
 	case SMUSH_CODEC_DELTA_BLOCKS:
+		if (decodedFrame) {
+			memcpy(_dst, decodedFrame, _deltaBlocksCodec->getFrameSize());
+			break;
+		}
 		if (!_deltaBlocksCodec)
 			_deltaBlocksCodec = new SmushDeltaBlocksDecoder(width, height);
 		if (_deltaBlocksCodec)
 			_deltaBlocksCodec->decode(_dst, src);
 		break;
 	case SMUSH_CODEC_DELTA_GLYPHS:
+		if (decodedFrame) {
+			memcpy(_dst, decodedFrame, _deltaGlyphsCodec->getFrameSize());
+			break;
+		}
 		if (!_deltaGlyphsCodec)
 			_deltaGlyphsCodec = new SmushDeltaGlyphsDecoder(width, height);
 		if (_deltaGlyphsCodec)
@@ -845,6 +868,8 @@ void SmushPlayer::handleFrameObject(int32 subSize, Common::SeekableReadStream &b
 		return;
 	}
 
+	const int32 offset = b.pos();
+
 	int codec = b.readUint16LE();
 	int left = b.readUint16LE();
 	int top = b.readUint16LE();
@@ -854,6 +879,18 @@ void SmushPlayer::handleFrameObject(int32 subSize, Common::SeekableReadStream &b
 	b.readUint16LE();
 	b.readUint16LE();
 
+	if (_decodeAheadState != kDecodeAheadNone) {
+		if (offset == _decodeAheadOffset) {
+			const byte *decodedFrame = finishDecodeAhead();
+			if (decodedFrame) {
+				decodeFrameObject(codec, nullptr, left, top, width, height, decodedFrame);
+				return;
+			}
+		} else {
+			cancelDecodeAhead();
+		}
+	}
+
 	int32 chunk_size = subSize - 14;
 	byte *chunk_buffer = (byte *)malloc(chunk_size);
 	assert(chunk_buffer);
@@ -1025,6 +1062,8 @@ SmushFont *SmushPlayer::getFont(int font) {
 void SmushPlayer::parseNextFrame() {
 
 	if (_seekPos >= 0) {
+		cancelDecodeAhead();
+
 		if (_seekFile.size() > 0) {
 			delete _base;
 
@@ -1096,6 +1135,123 @@ void SmushPlayer::parseNextFrame() {
 		_vm->_sound->processSound();
 
 	_vm->_imuseDigital->flushTracks();
+
+	prepareDecodeAhead();
+}
+
+void SmushPlayer::decodeAheadTimerProc(void *refCon) {
+	SmushPlayer *player = (SmushPlayer *)refCon;
+
+	Common::StackLock lock(player->_decodeAheadMutex);
+	if (player->_decodeAheadState == kDecodeAheadPending)
+		player->runDecodeAhead();
+}
+
+void SmushPlayer::prepareDecodeAhead() {
+	if (!_decodeAheadTimerInstalled || _decodeAheadState != kDecodeAheadNone ||
+		_insanity || _endOfFile || _seekPos >= 0)
+		return;
+
+	const int32 pos = _base->pos();
+	if (pos + 8 >= (int32)_baseSize)
+		return;
+
+	// Find the frame object of the next frame...
+	int32 objectOffset = -1;
+	int32 objectSize = 0;
+	int objectCount = 0;
+
+	if (_base->readUint32BE() == MKTAG('F','R','M','E')) {
+		int32 frameSize = _base->readUint32BE();
+
+		while (frameSize > 0 && !_base->eos()) {
+			const uint32 subType = _base->readUint32BE();
+			const int32 subSize = _base->readUint32BE();
+			const int32 subOffset = _base->pos();
+
+			if (subType == MKTAG('F','O','B','J') || subType == MKTAG('Z','F','O','B')) {
+				if (subType == MKTAG('F','O','B','J') && subSize > 14) {
+					objectOffset = subOffset;
+					objectSize = subSize;
+				}
+				objectCount++;
+			}
+
+			frameSize -= subSize + 8 + (subSize & 1);
+			_base->seek(subOffset + subSize + (subSize & 1), SEEK_SET);
+		}
+	}
+
+	// ...and read it, if it is the only one and its decoder is set up
+	if (objectOffset >= 0 && objectCount == 1) {
+		_base->seek(objectOffset, SEEK_SET);
+
+		const int codec = _base->readUint16LE();
+		_base->skip(4);
+		const int width = _base->readUint16LE();
+		const int height = _base->readUint16LE();
+		_base->skip(4);
+
+		bool ready = (width == _vm->_screenWidth && height == _vm->_screenHeight);
+		if (codec == SMUSH_CODEC_DELTA_BLOCKS) {
+			ready = ready && _deltaBlocksCodec;
+		} else if (codec == SMUSH_CODEC_DELTA_GLYPHS) {
+			ready = ready && _deltaGlyphsCodec;
+		} else {
+			ready = false;
+		}
+
+		if (ready) {
+			byte *data = (byte *)malloc(objectSize - 14);
+			if (data && _base->read(data, objectSize - 14) == (uint32)(objectSize - 14)) {
+				Common::StackLock lock(_decodeAheadMutex);
+				_decodeAheadData = data;
+				_decodeAheadCodec = codec;
+				_decodeAheadOffset = objectOffset;
+				_decodeAheadState = kDecodeAheadPending;
+			} else {
+				free(data);
+			}
+		}
+	}
+
+	_base->seek(pos, SEEK_SET);
+}
+
+void SmushPlayer::runDecodeAhead() {
+	// Called with _decodeAheadMutex held
+	if (_decodeAheadCodec == SMUSH_CODEC_DELTA_BLOCKS) {
+		_decodeAheadFrame = _deltaBlocksCodec->decodeFrame(_decodeAheadData);
+	} else {
+		_decodeAheadFrame = _deltaGlyphsCodec->decodeFrame(_decodeAheadData);
+	}
+
+	_decodeAheadState = kDecodeAheadDone;
+}
+
+const byte *SmushPlayer::finishDecodeAhead() {
+	Common::StackLock lock(_decodeAheadMutex);
+
+	// The timer didn't get to it, so decode it now
+	if (_decodeAheadState == kDecodeAheadPending)
+		runDecodeAhead();
+
+	free(_decodeAheadData);
+	_decodeAheadData = nullptr;
+	_decodeAheadOffset = -1;
+	_decodeAheadState = kDecodeAheadNone;
+
+	return _decodeAheadFrame;
+}
+
+void SmushPlayer::cancelDecodeAhead() {
+	Common::StackLock lock(_decodeAheadMutex);
+
+	free(_decodeAheadData);
+	_decodeAheadData = nullptr;
+	_decodeAheadFrame = nullptr;
+	_decodeAheadOffset = -1;
+	_decodeAheadState = kDecodeAheadNone;
 }
 
 void SmushPlayer::setPalette(const byte *palette) {
@@ -1222,6 +1378,11 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 	setupAnim(filename);
 	init(speed);
 
+	// INSANE changes the frames as they are played, so those can't be
+	// decoded ahead
+	if (!_insanity)
+		_decodeAheadTimerInstalled = _vm->getTimerManager()->installTimerProc(&decodeAheadTimerProc, DECODE_AHEAD_INTERVAL, this, "smushDecodeAhead");
+
 	_startTime = _vm->_system->getMillis();
 	_startFrame = startFrame;
 	_frame = startFrame;
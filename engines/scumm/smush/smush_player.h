@@ -22,6 +22,7 @@
 #if !defined(SCUMM_SMUSH_PLAYER_H) && defined(ENABLE_SCUMM_7_8)
 #define SCUMM_SMUSH_PLAYER_H
 
+#include "common/mutex.h"
 #include "common/util.h"
 
 namespace Audio {
@@ -192,6 +193,35 @@ private:
 	bool _smushAudioInitialized;
 	bool _smushAudioCallbackEnabled;
 
+	/**
+	 * Decode-ahead of the next frame: once a frame is shown, the frame
+	 * object of the next one is read and decoded from a background timer
+	 * while the player waits for its time to come. Only codec 37 and 47
+	 * objects are decoded ahead, and only when they are the sole frame
+	 * object of their frame, as their decoders keep the frame in their
+	 * own buffers; everything else in the frame, audio included, is still
+	 * handled in order on time.
+	 */
+	enum DecodeAheadState {
+		kDecodeAheadNone,
+		kDecodeAheadPending,
+		kDecodeAheadDone
+	};
+
+	Common::Mutex _decodeAheadMutex;
+	DecodeAheadState _decodeAheadState;
+	bool _decodeAheadTimerInstalled;
+	int32 _decodeAheadOffset; ///< of the frame object data in _base
+	int _decodeAheadCodec;
+	byte *_decodeAheadData;
+	const byte *_decodeAheadFrame;
+
+	static void decodeAheadTimerProc(void *refCon);
+	void prepareDecodeAhead();
+	void runDecodeAhead();
+	const byte *finishDecodeAhead();
+	void cancelDecodeAhead();
+
 public:
 	SmushPlayer(ScummEngine_v7 *scumm, IMuseDigital *_imuseDigital, Insane *insane);
 	~SmushPlayer();
@@ -235,7 +265,7 @@ private:
 	void tryCmpFile(const char *filename);
 
 	bool readString(const char *file);
-	void decodeFrameObject(int codec, const uint8 *src, int left, int top, int width, int height);
+	void decodeFrameObject(int codec, const uint8 *src, int left, int top, int width, int height, const byte *decodedFrame = nullptr);
 	void handleAnimHeader(int32 subSize, Common::SeekableReadStream &);
 	void handleFrame(int32 frameSize, Common::SeekableReadStream &);
 	void handleNewPalette(int32 subSize, Common::SeekableReadStream &);
@@ -1190,11 +1190,11 @@ void ScummEngine::displayDialog() {
 		} else {
 			if (_game.features & GF_16BIT_COLOR) {
 				// HE games which use sprites for subtitles
-			} else if (_game.heversion >= 60 && !ConfMan.getBool("subtitles") && _sound->isSoundInUse(HSND_TALKIE_SLOT)) {
+			} else if (_game.heversion >= 60 && !_subtitlesSetting.get() && _sound->isSoundInUse(HSND_TALKIE_SLOT)) {
 				// Special case for HE games
-			} else if (_game.id == GID_LOOM && !ConfMan.getBool("subtitles") && (_sound->pollCD())) {
+			} else if (_game.id == GID_LOOM && !_subtitlesSetting.get() && (_sound->pollCD())) {
 				// Special case for Loom (CD), since it only uses CD audio.for sound
-			} else if (!ConfMan.getBool("subtitles") && (!_haveActorSpeechMsg || _mixer->isSoundHandleActive(*_sound->_talkChannelHandle))) {
+			} else if (!_subtitlesSetting.get() && (!_haveActorSpeechMsg || _mixer->isSoundHandleActive(*_sound->_talkChannelHandle))) {
 				// Subtitles are turned off, and there is a voice version
 				// of this message -> don't print it.
 			} else {
@@ -2031,7 +2031,7 @@ void ScummEngine_v7::loadLanguageBundle() {
 }
 
 void ScummEngine_v7::playSpeech(const byte *ptr) {
-	if (_game.id == GID_DIG && (ConfMan.getBool("speech_mute") || VAR(VAR_VOICE_MODE) == 2))
+	if (_game.id == GID_DIG && (_speechMuteSetting.get() || VAR(VAR_VOICE_MODE) == 2))
 		return;
 
 	if ((_game.id == GID_DIG || _game.id == GID_CMI) && ptr[0]) {
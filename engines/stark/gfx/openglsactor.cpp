@@ -78,6 +78,10 @@ void OpenGLSActorRenderer::render(const Math::Vector3d &position, float directio
 	Math::Matrix4 normalMatrix = modelViewMatrix;
 	normalMatrix.invertAffineOrthonormal();
 
+	// The vertices stay in the buffer objects, only the bone transforms
+	// are uploaded each frame and the shaders do the skinning
+	updateBoneArrays();
+
 	_shader->enableVertexAttribute("position1", _faceVBO, 3, GL_FLOAT, GL_FALSE, 14 * sizeof(float), 0);
 	_shader->enableVertexAttribute("position2", _faceVBO, 3, GL_FLOAT, GL_FALSE, 14 * sizeof(float), 12);
 	_shader->enableVertexAttribute("bone1", _faceVBO, 1, GL_FLOAT, GL_FALSE, 14 * sizeof(float), 24);
@@ -94,8 +98,8 @@ void OpenGLSActorRenderer::render(const Math::Vector3d &position, float directio
 	setBonePositionArrayUniform(_shader, "bonePosition");
 	setLightArrayUniform(lights);
 
-	Common::Array<Face *> faces = _model->getFaces();
-	Common::Array<Material *> mats = _model->getMaterials();
+	const Common::Array<Face *> &faces = _model->getFaces();
+	const Common::Array<Material *> &mats = _model->getMaterials();
 
 	for (Common::Array<Face *>::const_iterator face = faces.begin(); face != faces.end(); ++face) {
 		// For each face draw its vertices from the VBO, indexed by the EBO
@@ -168,7 +172,7 @@ void OpenGLSActorRenderer::clearVertices() {
 void OpenGLSActorRenderer::uploadVertices() {
 	_faceVBO = createModelVBO(_model);
 
-	Common::Array<Face *> faces = _model->getFaces();
+	const Common::Array<Face *> &faces = _model->getFaces();
 	for (Common::Array<Face *>::const_iterator face = faces.begin(); face != faces.end(); ++face) {
 		_faceEBO[*face] = createFaceEBO(*face);
 	}
@@ -213,47 +217,40 @@ GLuint OpenGLSActorRenderer::createFaceEBO(const Face *face) {
 	return OpenGL::Shader::createBuffer(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint32) * face->vertexIndices.size(), &face->vertexIndices[0]);
 }
 
-void OpenGLSActorRenderer::setBonePositionArrayUniform(OpenGL::Shader *shader, const char *uniform) {
+void OpenGLSActorRenderer::updateBoneArrays() {
 	const Common::Array<BoneNode *> &bones = _model->getBones();
 
+	_bonePositions.resize(3 * bones.size());
+	_boneRotations.resize(4 * bones.size());
+
+	for (uint i = 0; i < bones.size(); i++) {
+		_bonePositions[3 * i + 0] = bones[i]->_animPos.x();
+		_bonePositions[3 * i + 1] = bones[i]->_animPos.y();
+		_bonePositions[3 * i + 2] = bones[i]->_animPos.z();
+
+		_boneRotations[4 * i + 0] = bones[i]->_animRot.x();
+		_boneRotations[4 * i + 1] = bones[i]->_animRot.y();
+		_boneRotations[4 * i + 2] = bones[i]->_animRot.z();
+		_boneRotations[4 * i + 3] = bones[i]->_animRot.w();
+	}
+}
+
+void OpenGLSActorRenderer::setBonePositionArrayUniform(OpenGL::Shader *shader, const char *uniform) {
 	GLint pos = shader->getUniformLocation(uniform);
 	if (pos == -1) {
 		error("No uniform named '%s'", uniform);
 	}
 
-	float *positions = new float[3 * bones.size()];
-	float *positionsPtr = positions;
-
-	for (uint i = 0; i < bones.size(); i++) {
-		*positionsPtr++ = bones[i]->_animPos.x();
-		*positionsPtr++ = bones[i]->_animPos.y();
-		*positionsPtr++ = bones[i]->_animPos.z();
-	}
-
-	glUniform3fv(pos, bones.size(), positions);
-	delete[] positions;
+	glUniform3fv(pos, _bonePositions.size() / 3, _bonePositions.data());
 }
 
 void OpenGLSActorRenderer::setBoneRotationArrayUniform(OpenGL::Shader *shader, const char *uniform) {
-	const Common::Array<BoneNode *> &bones = _model->getBones();
-
 	GLint rot = shader->getUniformLocation(uniform);
 	if (rot == -1) {
 		error("No uniform named '%s'", uniform);
 	}
 
-	float *rotations = new float[4 * bones.size()];
-	float *rotationsPtr = rotations;
-
-	for (uint i = 0; i < bones.size(); i++) {
-		*rotationsPtr++ =  bones[i]->_animRot.x();
-		*rotationsPtr++ =  bones[i]->_animRot.y();
-		*rotationsPtr++ =  bones[i]->_animRot.z();
-		*rotationsPtr++ =  bones[i]->_animRot.w();
-	}
-
-	glUniform4fv(rot, bones.size(), rotations);
-	delete[] rotations;
+	glUniform4fv(rot, _boneRotations.size() / 4, _boneRotations.data());
 }
 
 void OpenGLSActorRenderer::setLightArrayUniform(const LightEntryArray &lights) {
@@ -56,11 +56,14 @@ protected:
 
 	GLuint _faceVBO;
 	FaceBufferMap _faceEBO;
+	Common::Array<float> _bonePositions;
+	Common::Array<float> _boneRotations;
 
 	void clearVertices();
 	void uploadVertices();
 	GLuint createModelVBO(const Model *model);
 	GLuint createFaceEBO(const Face *face);
+	void updateBoneArrays();
 	void setBonePositionArrayUniform(OpenGL::Shader *shader, const char *uniform);
 	void setBoneRotationArrayUniform(OpenGL::Shader *shader, const char *uniform);
 	void setLightArrayUniform(const LightEntryArray &lights);
@@ -63,9 +63,18 @@ struct _ActorVertex {
 	float r;
 	float g;
 	float b;
+	float lr;
+	float lg;
+	float lb;
 };
 typedef _ActorVertex ActorVertex;
 
+/** The animated transform of a bone, with the rotation as a column major matrix */
+struct ActorBoneTransform {
+	float rot[9];
+	float pos[3];
+};
+
 class TinyGLActorRenderer : public VisualActor {
 public:
 	TinyGLActorRenderer(TinyGLDriver *gfx);
@@ -80,11 +89,15 @@ protected:
 
 	ActorVertex *_faceVBO;
 	FaceBufferMap _faceEBO;
+	Common::Array<ActorBoneTransform> _boneTransforms;
 
 	void clearVertices();
 	void uploadVertices();
 	ActorVertex *createModelVBO(const Model *model);
 	uint32 *createFaceEBO(const Face *face);
+	void updateBoneTransforms();
+	void skinVertices(const Math::Matrix4 &modelViewMatrix, const Math::Matrix3 &normalMatrix,
+			const LightEntryArray &lights, bool drawShadow, const Math::Vector3d &lightDirection);
 	void setLightArrayUniform(const LightEntryArray &lights);
 
 	Math::Vector3d getShadowLightDirection(const LightEntryArray &lights, const Math::Vector3d &actorPosition, Math::Matrix3 worldToModelRot);
@@ -21,6 +21,7 @@
 
 #include "engines/stark/resources/sound.h"
 
+#include "audio/decodeahead.h"
 #include "audio/decoders/vorbis.h"
 
 #include "common/system.h"
@@ -132,6 +133,9 @@ void Sound::play() {
 		playStream = rewindableStream;
 	}
 
+	// Vorbis decoding is expensive enough to be kept out of the mixer callback
+	playStream = Audio::makeDecodeAheadStream(playStream);
+
 	g_system->getMixer()->playStream(getMixerSoundType(), &_handle, playStream, -1,
 	                                 _volume * Audio::Mixer::kMaxChannelVolume, _pan * 127);
 }
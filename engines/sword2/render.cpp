@@ -339,6 +339,58 @@ void Screen::renderParallax(byte *ptr, int16 l) {
 	_parallaxScrollY = _scrollY - y;
 }
 
+/**
+ * Copies the background layers composited by an earlier render cycle into
+ * the back buffer, if they were cached at the current scroll position.
+ * @param lastLayer the last background layer drawn before the first anim
+ * @return true if the layers up to lastLayer need not be drawn
+ */
+
+bool Screen::fetchBackgroundCache(int16 lastLayer) {
+	if (!_backgroundCacheValid || _backgroundCacheLayer != lastLayer ||
+		_backgroundCacheScrollX != _scrollX || _backgroundCacheScrollY != _scrollY)
+		return false;
+
+	memcpy(_buffer + MENUDEEP * _screenWide, _backgroundCache, _screenWide * (_screenDeep - MENUDEEP * 2));
+
+	_parallaxScrollX = _backgroundCacheParallaxX;
+	_parallaxScrollY = _backgroundCacheParallaxY;
+	return true;
+}
+
+/**
+ * Draws a background layer, unless it was copied from the background cache
+ * already. Once the last of the cached layers has been drawn, the result is
+ * kept if the screen has stopped scrolling.
+ */
+
+void Screen::renderBackgroundParallax(byte *ptr, int16 layer, int16 lastLayer, bool cached) {
+	if (cached && layer <= lastLayer)
+		return;
+
+	renderParallax(ptr, layer);
+
+	if (layer != lastLayer || _scrollX != _scrollXTarget || _scrollY != _scrollYTarget)
+		return;
+
+	uint32 size = _screenWide * (_screenDeep - MENUDEEP * 2);
+
+	if (!_backgroundCache) {
+		_backgroundCache = (byte *)malloc(size);
+		if (!_backgroundCache)
+			return;
+	}
+
+	memcpy(_backgroundCache, _buffer + MENUDEEP * _screenWide, size);
+
+	_backgroundCacheValid = true;
+	_backgroundCacheLayer = lastLayer;
+	_backgroundCacheScrollX = _scrollX;
+	_backgroundCacheScrollY = _scrollY;
+	_backgroundCacheParallaxX = _parallaxScrollX;
+	_backgroundCacheParallaxY = _parallaxScrollY;
+}
+
 // Uncomment this when benchmarking the drawing routines.
 #define LIMIT_FRAME_RATE
 
@@ -842,6 +894,8 @@ void Screen::closeBackgroundLayer() {
 	if (Sword2Engine::isPsx())
 		flushPsxScrCache();
 
+	_backgroundCacheValid = false;
+
 	for (int i = 0; i < MAXLAYERS; i++) {
 		if (_blockSurfaces[i]) {
 			for (int j = 0; j < _xBlocks[i] * _yBlocks[i]; j++)
@@ -105,6 +105,19 @@ Screen::Screen(Sword2Engine *vm, int16 width, int16 height) {
 	_psxCacheEnabled[0] = true;
 	_psxCacheEnabled[1] = true;
 	_psxCacheEnabled[2] = true;
+
+	_backgroundCache = nullptr;
+	_backgroundCacheValid = false;
+	_backgroundCacheLayer = 0;
+	_backgroundCacheScrollX = 0;
+	_backgroundCacheScrollY = 0;
+	_backgroundCacheParallaxX = 0;
+	_backgroundCacheParallaxY = 0;
+
+	for (int i = 0; i < SPRITE_CACHE_ENTRIES; i++)
+		_spriteCache[i].data = nullptr;
+	_spriteCacheSize = 0;
+	_spriteCacheClock = 0;
 }
 
 Screen::~Screen() {
@@ -113,6 +126,8 @@ Screen::~Screen() {
 	free(_dirtyGrid);
 	closeBackgroundLayer();
 	free(_lightMask);
+	free(_backgroundCache);
+	flushSpriteCache();
 }
 
 uint32 Screen::getTick() {
@@ -293,21 +308,36 @@ void Screen::buildDisplay() {
 	// there is time left, we will render extra frames to smooth out the
 	// scrolling.
 
+	bool hasBgp0 = Sword2Engine::isPsx() || screenLayerTable.bg_parallax[0]; // No need to check on PSX version
+	bool hasBgp1 = !Sword2Engine::isPsx() && screenLayerTable.bg_parallax[1]; // Nothing here in PSX version
+
 	do {
+		// The background layers up to the first one with anims on it
+		// only depend on the scroll position, so they are composited
+		// once and then copied from the background cache.
+		int16 lastStaticLayer = 2;
+
+		if (hasBgp1 && _curBgp1)
+			lastStaticLayer = 1;
+		if (hasBgp0 && _curBgp0)
+			lastStaticLayer = 0;
+
+		bool cached = fetchBackgroundCache(lastStaticLayer);
+
 		// first background parallax + related anims
-		if (Sword2Engine::isPsx() || screenLayerTable.bg_parallax[0]) { // No need to check on PSX version
-			renderParallax(_vm->fetchBackgroundParallaxLayer(file, 0), 0);
+		if (hasBgp0) {
+			renderBackgroundParallax(_vm->fetchBackgroundParallaxLayer(file, 0), 0, lastStaticLayer, cached);
 			drawBackPar0Frames();
 		}
 
 		// second background parallax + related anims
-		if (!Sword2Engine::isPsx() && screenLayerTable.bg_parallax[1]) { // Nothing here in PSX version
-			renderParallax(_vm->fetchBackgroundParallaxLayer(file, 1), 1);
+		if (hasBgp1) {
+			renderBackgroundParallax(_vm->fetchBackgroundParallaxLayer(file, 1), 1, lastStaticLayer, cached);
 			drawBackPar1Frames();
 		}
 
 		// normal backround layer (just the one!)
-		renderParallax(_vm->fetchBackgroundLayer(file), 2);
+		renderBackgroundParallax(_vm->fetchBackgroundLayer(file), 2, lastStaticLayer, cached);
 
 		// sprites & layers
 		drawBackFrames();	// background sprites
@@ -543,7 +573,7 @@ void Screen::processLayer(byte *file, uint32 layer_number) {
 			layer_number, layer_head.width, layer_head.height);
 	}
 
-	uint32 rv = drawSprite(&spriteInfo);
+	uint32 rv = drawSprite(&spriteInfo, makeLayerCacheKey(_thisScreen.background_layer_id, layer_number));
 	if (rv)
 		error("Driver Error %.8x in processLayer(%d)", rv, layer_number);
 }
@@ -672,7 +702,13 @@ void Screen::processImage(BuildUnit *build_unit) {
 		_vm->_debugger->_rectY2 = spriteInfo.y + spriteInfo.scaledHeight;
 	}
 
-	uint32 rv = drawSprite(&spriteInfo);
+	// Frames don't change, so they are decompressed only once. This is
+	// left out for PSX, whose sprites change their size on the way.
+	uint32 cacheKey = 0;
+	if (!Sword2Engine::isPsx())
+		cacheKey = makeSpriteCacheKey(build_unit->anim_resource, build_unit->anim_pc);
+
+	uint32 rv = drawSprite(&spriteInfo, cacheKey);
 	if (rv) {
 		error("Driver Error %.8x with sprite %s (%d, %d) in processImage",
 			rv,
@@ -49,6 +49,10 @@
 #define SCALE_MAXWIDTH   512
 #define SCALE_MAXHEIGHT  512
 
+// Decompressed sprites kept between render cycles
+#define SPRITE_CACHE_ENTRIES 32
+#define SPRITE_CACHE_BUDGET  (2 * 1024 * 1024)
+
 // Dirty grid cell size
 #define CELLWIDE         10
 #define CELLDEEP         20
@@ -172,6 +176,13 @@ struct SpriteInfo {
 	bool isText;		// It is a engine-generated sprite containing text
 };
 
+struct SpriteCacheEntry {
+	uint32 key;		// resource and frame, see makeSpriteCacheKey()
+	uint32 size;
+	uint32 lastUsed;
+	byte *data;
+};
+
 struct BlockSurface {
 	byte data[BLOCKWIDTH * BLOCKHEIGHT];
 	bool transparent;
@@ -342,6 +353,29 @@ private:
 
 	void blitBlockSurface(BlockSurface *s, Common::Rect *r, Common::Rect *clipRect);
 
+	// The layers drawn before the first background sprite, as they were
+	// composited at the scroll position they were cached for.
+	byte *_backgroundCache;
+	bool _backgroundCacheValid;
+	int16 _backgroundCacheLayer;
+	int16 _backgroundCacheScrollX;
+	int16 _backgroundCacheScrollY;
+	int16 _backgroundCacheParallaxX;
+	int16 _backgroundCacheParallaxY;
+
+	bool fetchBackgroundCache(int16 lastLayer);
+	void renderBackgroundParallax(byte *ptr, int16 layer, int16 lastLayer, bool cached);
+
+	// Sprites are decompressed only once, and kept until the budget
+	// is exhausted and they are the least recently drawn.
+	SpriteCacheEntry _spriteCache[SPRITE_CACHE_ENTRIES];
+	uint32 _spriteCacheSize;
+	uint32 _spriteCacheClock;
+
+	byte *fetchCachedSprite(uint32 key, uint32 size);
+	bool cacheSprite(uint32 key, byte *data, uint32 size);
+	void flushSpriteCache();
+
 	uint16 _layer;
 
 	bool _dimPalette;
@@ -422,7 +456,10 @@ public:
 	int32 createSurface(SpriteInfo *s, byte **surface);
 	void drawSurface(SpriteInfo *s, byte *surface, Common::Rect *clipRect = nullptr);
 	void deleteSurface(byte *surface);
-	int32 drawSprite(SpriteInfo *s);
+	int32 drawSprite(SpriteInfo *s, uint32 cacheKey = 0);
+
+	static uint32 makeSpriteCacheKey(uint32 res, uint16 frame);
+	static uint32 makeLayerCacheKey(uint32 res, uint16 layer);
 
 	void scaleImageFast(byte *dst, uint16 dstPitch, uint16 dstWidth,
 		uint16 dstHeight, byte *src, uint16 srcPitch, uint16 srcWidth,
@@ -460,6 +460,101 @@ void Screen::deleteSurface(byte *surface) {
 	free(surface);
 }
 
+/**
+ * Builds the sprite cache key of an animation frame.
+ * @return the key, or 0 if the frame can't be cached
+ */
+
+uint32 Screen::makeSpriteCacheKey(uint32 res, uint16 frame) {
+	if (res == 0 || res > 0xFFFF || frame >= 0x8000)
+		return 0;
+	return (res << 16) | frame;
+}
+
+/**
+ * Builds the sprite cache key of a layer of a screen resource.
+ * @return the key, or 0 if the layer can't be cached
+ */
+
+uint32 Screen::makeLayerCacheKey(uint32 res, uint16 layer) {
+	if (res == 0 || res > 0xFFFF || layer >= 0x8000)
+		return 0;
+	return (res << 16) | 0x8000 | layer;
+}
+
+/**
+ * Looks up a sprite decompressed by an earlier render cycle.
+ * @return the sprite, which is owned by the cache, or NULL
+ */
+
+byte *Screen::fetchCachedSprite(uint32 key, uint32 size) {
+	for (int i = 0; i < SPRITE_CACHE_ENTRIES; i++) {
+		if (_spriteCache[i].data && _spriteCache[i].key == key) {
+			if (_spriteCache[i].size != size)
+				return nullptr;
+			_spriteCache[i].lastUsed = ++_spriteCacheClock;
+			return _spriteCache[i].data;
+		}
+	}
+
+	return nullptr;
+}
+
+/**
+ * Hands a decompressed sprite over to the cache, making room for it by
+ * dropping the least recently drawn ones.
+ * @return true if the cache took ownership of the data
+ */
+
+bool Screen::cacheSprite(uint32 key, byte *data, uint32 size) {
+	if (size > SPRITE_CACHE_BUDGET)
+		return false;
+
+	int slot = -1;
+
+	while (true) {
+		int oldest = -1;
+
+		slot = -1;
+		for (int i = 0; i < SPRITE_CACHE_ENTRIES; i++) {
+			if (!_spriteCache[i].data) {
+				if (slot == -1)
+					slot = i;
+			} else if (oldest == -1 || _spriteCache[i].lastUsed < _spriteCache[oldest].lastUsed) {
+				oldest = i;
+			}
+		}
+
+		if (slot != -1 && _spriteCacheSize + size <= SPRITE_CACHE_BUDGET)
+			break;
+
+		assert(oldest != -1);
+		_spriteCacheSize -= _spriteCache[oldest].size;
+		free(_spriteCache[oldest].data);
+		_spriteCache[oldest].data = nullptr;
+	}
+
+	_spriteCache[slot].key = key;
+	_spriteCache[slot].size = size;
+	_spriteCache[slot].lastUsed = ++_spriteCacheClock;
+	_spriteCache[slot].data = data;
+	_spriteCacheSize += size;
+	return true;
+}
+
+/**
+ * Frees all the sprites in the sprite cache.
+ */
+
+void Screen::flushSpriteCache() {
+	for (int i = 0; i < SPRITE_CACHE_ENTRIES; i++) {
+		free(_spriteCache[i].data);
+		_spriteCache[i].data = nullptr;
+	}
+
+	_spriteCacheSize = 0;
+}
+
 /**
  * Draws a sprite onto the screen. The type of the sprite can be a combination
  * of the following flags, some of which are mutually exclusive:
@@ -474,6 +569,8 @@ void Screen::deleteSurface(byte *surface) {
  * RDSPR_RLE16		The sprite data is a 16-color compressed sprite
  * RDSPR_RLE256		The sprite data is a 256-color compressed sprite
  * @param s all the information needed to draw the sprite
+ * @param cacheKey if non-zero, the decompressed sprite is kept in the sprite
+ * cache under this key. Only PC compressed sprites are cached.
  * @warning Sprites will only be drawn onto the background, not over menubar
  * areas.
  */
@@ -481,7 +578,7 @@ void Screen::deleteSurface(byte *surface) {
 // FIXME: I'm sure this could be optimized. There's plenty of data copying and
 // mallocing here.
 
-int32 Screen::drawSprite(SpriteInfo *s) {
+int32 Screen::drawSprite(SpriteInfo *s, uint32 cacheKey) {
 	byte *src, *dst;
 	byte *sprite, *newSprite;
 	uint16 scale;
@@ -522,6 +619,10 @@ int32 Screen::drawSprite(SpriteInfo *s) {
 		} else { // PC Uncompressed sprites
 			sprite = s->data;
 		}
+	} else if (cacheKey && (sprite = fetchCachedSprite(cacheKey, s->w * s->h)) != nullptr) {
+		// Decompressed by an earlier render cycle. The cache owns it,
+		// so everything below works on copies.
+		freeSprite = false;
 	} else {
 		freeSprite = true;
 
@@ -610,6 +711,10 @@ int32 Screen::drawSprite(SpriteInfo *s) {
 				}
 			}
 		}
+
+		// PSX sprites change their dimensions while being decompressed
+		if (cacheKey && !Sword2Engine::isPsx() && cacheSprite(cacheKey, sprite, s->w * s->h))
+			freeSprite = false;
 	}
 
 	if (s->type & RDSPR_FLIP) {
@@ -21,14 +21,68 @@
 
 #include "sword25/console.h"
 #include "sword25/sword25.h"
+#include "sword25/kernel/kernel.h"
+#include "sword25/script/luascript.h"
+
+#include "common/lua/lua.h"
+#include "common/lua/lauxlib.h"
 
 namespace Sword25 {
 
 Sword25Console::Sword25Console(Sword25Engine *vm) : GUI::Debugger(), _vm(vm) {
 	assert(_vm);
+
+	registerCmd("lua_heap", WRAP_METHOD(Sword25Console, Cmd_LuaHeap));
+	registerCmd("lua_gc", WRAP_METHOD(Sword25Console, Cmd_LuaGC));
 }
 
 Sword25Console::~Sword25Console() {
 }
 
+bool Sword25Console::Cmd_LuaHeap(int argc, const char **argv) {
+	lua_State *L = static_cast<lua_State *>(Kernel::getInstance()->getScript()->getScriptObject());
+
+	if (argc > 1 && !strcmp(argv[1], "trim")) {
+		lua_gc(L, LUA_GCCOLLECT, 0);
+		luaL_trimheap(L);
+	}
+
+	luaL_HeapStats stats;
+	if (!luaL_getheapstats(L, &stats)) {
+		debugPrintf("Lua heap: %u bytes (not pooled)\n", (uint)stats.inUse);
+		return true;
+	}
+
+	debugPrintf("Lua heap: %u bytes in use, %u peak, %u in pools\n", (uint)stats.inUse, (uint)stats.peak, (uint)stats.pooled);
+	debugPrintf("Allocations: %lu, %lu from pools\n", stats.allocations, stats.pooledAllocations);
+	debugPrintf("Frame GC: %lu steps, %lu cycles finished\n", stats.gcSteps, stats.gcCycles);
+	return true;
+}
+
+bool Sword25Console::Cmd_LuaGC(int argc, const char **argv) {
+	if (argc > 4) {
+		debugPrintf("Usage: %s [<budget in microseconds> [<pause> [<stepmul>]]]\n", argv[0]);
+		return true;
+	}
+
+	LuaScriptEngine *script = static_cast<LuaScriptEngine *>(Kernel::getInstance()->getScript());
+	lua_State *L = static_cast<lua_State *>(script->getScriptObject());
+
+	if (argc > 1)
+		script->setGCStepBudget(atoi(argv[1]));
+	if (argc > 2)
+		lua_gc(L, LUA_GCSETPAUSE, atoi(argv[2]));
+	if (argc > 3)
+		lua_gc(L, LUA_GCSETSTEPMUL, atoi(argv[3]));
+
+	// Lua only reports these by setting them, so put the old value back
+	int pause = lua_gc(L, LUA_GCSETPAUSE, 0);
+	lua_gc(L, LUA_GCSETPAUSE, pause);
+	int stepMul = lua_gc(L, LUA_GCSETSTEPMUL, 0);
+	lua_gc(L, LUA_GCSETSTEPMUL, stepMul);
+
+	debugPrintf("Per-frame budget: %u us, pause: %d%%, step multiplier: %d%%\n", script->getGCStepBudget(), pause, stepMul);
+	return true;
+}
+
 } // End of namespace Sword25
@@ -34,6 +34,10 @@ public:
 	~Sword25Console(void) override;
 
 private:
+	bool Cmd_LuaHeap(int argc, const char **argv);
+	bool Cmd_LuaGC(int argc, const char **argv);
+
+
 	Sword25Engine *_vm;
 };
 
@@ -252,6 +252,9 @@ static int endFrame(lua_State *L) {
 
 	lua_pushbooleancpp(L, pGE->endFrame());
 
+	// The frame is done, spend the idle part of it collecting script garbage
+	Kernel::getInstance()->getScript()->stepGarbageCollector();
+
 	return 1;
 }
 
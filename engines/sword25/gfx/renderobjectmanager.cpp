@@ -46,15 +46,20 @@ namespace Sword25 {
 
 void RenderObjectQueue::add(RenderObject *renderObject) {
 	push_back(RenderObjectQueueItem(renderObject, renderObject->getBbox(), renderObject->getVersion()));
+	_items[renderObject] = &back();
 }
 
 bool RenderObjectQueue::exists(const RenderObjectQueueItem &renderObjectQueueItem) {
-	for (RenderObjectQueue::iterator it = begin(); it != end(); ++it)
-		if ((*it)._renderObject == renderObjectQueueItem._renderObject &&
-			(*it)._version == renderObjectQueueItem._version &&
-			(*it)._bbox == renderObjectQueueItem._bbox)
-			return true;
-	return false;
+	const RenderObjectQueueItem *item = _items.getValOrDefault(renderObjectQueueItem._renderObject);
+	return item &&
+		item->_version == renderObjectQueueItem._version &&
+		item->_bbox == renderObjectQueueItem._bbox;
+}
+
+void RenderObjectQueue::clear() {
+	Common::List<RenderObjectQueueItem>::clear();
+	// Keep the storage of the map for the next frame
+	_items.clear(false);
 }
 
 RenderObjectManager::RenderObjectManager(int width, int height, int framebufferCount) :
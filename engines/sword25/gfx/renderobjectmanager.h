@@ -42,6 +42,8 @@
 #define SWORD25_RENDEROBJECTMANAGER_H
 
 #include "common/rect.h"
+#include "common/hashmap.h"
+#include "common/hash-ptr.h"
 #include "sword25/kernel/common.h"
 #include "sword25/gfx/renderobjectptr.h"
 #include "sword25/kernel/persistable.h"
@@ -67,6 +69,11 @@ class RenderObjectQueue : public Common::List<RenderObjectQueueItem> {
 public:
 	void add(RenderObject *renderObject);
 	bool exists(const RenderObjectQueueItem &renderObjectQueueItem);
+	void clear();
+
+private:
+	// The queued item of each render object, so that exists() doesn't have to walk the queue
+	Common::HashMap<RenderObject *, const RenderObjectQueueItem *> _items;
 };
 
 /**
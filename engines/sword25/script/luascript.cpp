@@ -46,16 +46,20 @@
 
 namespace Sword25 {
 
+// Microseconds of incremental garbage collection granted per frame
+static const uint kDefaultGCStepBudget = 1000;
+
 LuaScriptEngine::LuaScriptEngine(Kernel *KernelPtr) :
 	ScriptEngine(KernelPtr),
 	_state(0),
-	_pcallErrorhandlerRegistryIndex(0) {
+	_pcallErrorhandlerRegistryIndex(0),
+	_gcStepBudget(kDefaultGCStepBudget) {
 }
 
 LuaScriptEngine::~LuaScriptEngine() {
 	// Lua de-initialisation
 	if (_state)
-		lua_close(_state);
+		luaL_closestate(_state);
 }
 
 namespace {
@@ -74,7 +78,7 @@ void debugHook(lua_State *L, lua_Debug *ar) {
 
 bool LuaScriptEngine::init() {
 	// Lua-State initialisation, as well as standard libaries initialisation
-	_state = luaL_newstate();
+	_state = luaL_newpooledstate();
 	if (!_state || ! registerStandardLibs() || !registerStandardLibExtensions()) {
 		error("Lua could not be initialized.");
 		return false;
@@ -239,6 +243,11 @@ void LuaScriptEngine::setCommandLine(const Common::StringArray &commandLineParam
 	lua_setglobal(_state, "CommandLine");
 }
 
+void LuaScriptEngine::stepGarbageCollector() {
+	if (_gcStepBudget)
+		luaL_gcstepbudget(_state, _gcStepBudget);
+}
+
 namespace {
 const char *PERMANENTS_TABLE_NAME = "Permanents";
 
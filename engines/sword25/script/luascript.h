@@ -83,6 +83,23 @@ public:
 	 */
 	void setCommandLine(const Common::StringArray &commandLineParameters) override;
 
+	/**
+	 * Runs incremental garbage collection steps for at most the per-frame budget
+	 */
+	void stepGarbageCollector() override;
+
+	/**
+	 * Sets the time the garbage collector may take per frame
+	 * @param budget        The budget in microseconds, 0 leaves collection to Lua alone
+	 */
+	void setGCStepBudget(uint budget) {
+		_gcStepBudget = budget;
+	}
+
+	uint getGCStepBudget() const {
+		return _gcStepBudget;
+	}
+
 	/**
 	 * @remark              The Lua stack is cleared by this method
 	 */
@@ -95,6 +112,7 @@ public:
 private:
 	lua_State *_state;
 	int _pcallErrorhandlerRegistryIndex;
+	uint _gcStepBudget;
 
 	bool registerStandardLibs();
 	bool registerStandardLibExtensions();
@@ -83,6 +83,12 @@ public:
 	*/
 	virtual void setCommandLine(const Common::Array<Common::String> &commandLineParameters) = 0;
 
+	/**
+	 * Gives the garbage collector of the scripting language its share of the frame time.
+	 * Called once at the end of every frame.
+	 */
+	virtual void stepGarbageCollector() = 0;
+
 	bool persist(OutputPersistenceBlock &writer) override = 0;
 	bool unpersist(InputPersistenceBlock &reader) override = 0;
 };
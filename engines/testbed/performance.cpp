@@ -0,0 +1,438 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "base/version.h"
+
+#include "audio/audiostream.h"
+#include "audio/mixer_intern.h"
+#include "audio/decoders/raw.h"
+
+#include "common/cyclecounter.h"
+#include "common/fs.h"
+#include "common/savefile.h"
+
+#include "engines/engine.h"
+
+#include "graphics/cursorman.h"
+#include "graphics/scalerplugin.h"
+
+#include "testbed/graphics.h"
+#include "testbed/performance.h"
+
+namespace Testbed {
+
+namespace {
+
+/** How long every measurement runs. */
+const uint32 kMeasureMillis = 1000;
+
+const char *const kDataFileName = "testbed-performance.dat";
+
+Common::WriteStream *s_report = nullptr;
+
+/**
+ * Converts counts of Common::getCycleCount() to milliseconds, with the
+ * time a whole measurement took.
+ */
+struct CycleClock {
+	CycleClock() : startMillis(g_system->getMillis()), startTicks(Common::getCycleCount()) {}
+
+	double ticksPerMillis() const {
+		const uint32 millis = g_system->getMillis() - startMillis;
+		const uint64 ticks = Common::getCycleCount() - startTicks;
+		return millis ? (double)ticks / millis : (double)MAX<uint64>(ticks, 1);
+	}
+
+	uint32 startMillis;
+	uint64 startTicks;
+};
+
+void fillPattern(byte *data, uint32 size, uint32 seed) {
+	for (uint32 i = 0; i < size; i++) {
+		seed = seed * 1103515245 + 12345;
+		data[i] = seed >> 24;
+	}
+}
+
+/**
+ * Draw frames for kMeasureMillis in the current mode, changing the whole
+ * screen every time, and return the frames per second.
+ */
+double measureScreenUpdates() {
+	const Graphics::PixelFormat format = g_system->getScreenFormat();
+	const int width = g_system->getWidth();
+	const int height = g_system->getHeight();
+	const int pitch = width * format.bytesPerPixel;
+	byte *buffer = new byte[pitch * height];
+	fillPattern(buffer, pitch * height, 1);
+
+	uint frames = 0;
+	const uint32 start = g_system->getMillis();
+	while (g_system->getMillis() - start < kMeasureMillis) {
+		// Roll the picture by a line, so every frame differs everywhere
+		const int offset = (frames % height) * pitch;
+		g_system->copyRectToScreen(buffer + offset, pitch, 0, 0, width, height - frames % height);
+		if (offset)
+			g_system->copyRectToScreen(buffer, pitch, 0, height - frames % height, width, frames % height);
+		g_system->updateScreen();
+		frames++;
+	}
+	const uint32 elapsed = MAX<uint32>(g_system->getMillis() - start, 1);
+
+	delete[] buffer;
+	return frames * 1000.0 / elapsed;
+}
+
+bool switchMode(int scaler, uint factor, const Graphics::PixelFormat &format) {
+	g_system->beginGFXTransaction();
+		if (scaler >= 0)
+			g_system->setScaler(scaler, factor);
+		g_system->initSize(320, 200, &format);
+	return g_system->endGFXTransaction() == OSystem::kTransactionSuccess;
+}
+
+/** Write a test file of the given size as a savefile. */
+bool writeDataFile(uint32 size) {
+	Common::OutSaveFile *saveFile = g_system->getSavefileManager()->openForSaving(kDataFileName, false);
+	if (!saveFile)
+		return false;
+
+	byte *chunk = new byte[64 * 1024];
+	for (uint32 done = 0; done < size && !saveFile->err(); done += 64 * 1024) {
+		fillPattern(chunk, 64 * 1024, done);
+		saveFile->write(chunk, MIN<uint32>(64 * 1024, size - done));
+	}
+	delete[] chunk;
+
+	saveFile->finalize();
+	const bool result = !saveFile->err();
+	delete saveFile;
+	return result;
+}
+
+} // End of anonymous namespace
+
+void PerformanceTests::report(const char *fmt, ...) {
+	char buffer[STRINGBUFLEN];
+	va_list vl;
+	va_start(vl, fmt);
+	vsnprintf(buffer, STRINGBUFLEN, fmt, vl);
+	va_end(vl);
+
+	Testsuite::logPrintf("%s", buffer);
+	if (s_report) {
+		s_report->writeString(buffer);
+		s_report->flush();
+	}
+}
+
+/**
+ * Measures the frames per second of copyRectToScreen() and updateScreen()
+ * of the whole screen at every scaler and scale factor, in CLUT8 and the
+ * other pixel formats the backend supports.
+ */
+TestExitStatus PerformanceTests::screenUpdateRate() {
+	Common::List<Graphics::PixelFormat> formats = g_system->getSupportedFormats();
+	const Graphics::PixelFormat clut8 = Graphics::PixelFormat::createFormatCLUT8();
+	if (Common::find(formats.begin(), formats.end(), clut8) == formats.end())
+		formats.push_front(clut8);
+
+	const bool hasScalers = g_system->hasFeature(OSystem::kFeatureScalers);
+	const uint oldScaler = g_system->getScaler();
+	const uint oldFactor = g_system->getScaleFactor();
+	const PluginList &scalerPlugins = ScalerMan.getPlugins();
+
+	int modesTested = 0;
+	for (uint scaler = 0; scaler < (hasScalers ? scalerPlugins.size() : 1); scaler++) {
+		Common::Array<uint> factors;
+		if (hasScalers)
+			factors = scalerPlugins[scaler]->get<ScalerPluginObject>().getFactors();
+		else
+			factors.push_back(g_system->getScaleFactor());
+
+		for (uint f = 0; f < factors.size(); f++) {
+			for (Common::List<Graphics::PixelFormat>::const_iterator format = formats.begin(); format != formats.end(); ++format) {
+				const char *scalerName = hasScalers ? scalerPlugins[scaler]->get<ScalerPluginObject>().getName() : "default";
+				if (!switchMode(hasScalers ? (int)scaler : -1, factors[f], *format)) {
+					report("screen %s %ux %s: mode not supported\n", scalerName, factors[f], format->toString().c_str());
+					continue;
+				}
+				if (format->isCLUT8())
+					GFXTestSuite::setCustomColor(255, 0, 0);
+
+				report("screen %s %ux %s: %.1f fps\n", scalerName, factors[f], format->toString().c_str(), measureScreenUpdates());
+				modesTested++;
+
+				if (Engine::shouldQuit())
+					break;
+			}
+		}
+	}
+
+	// Back to the mode of the other tests
+	switchMode(hasScalers ? (int)oldScaler : -1, oldFactor, clut8);
+	GFXTestSuite::setCustomColor(255, 0, 0);
+	Testsuite::clearScreen();
+
+	return modesTested ? kTestPassed : kTestFailed;
+}
+
+/**
+ * Measures how long moving the cursor and replacing its image take until
+ * the screen is updated, on average and at worst.
+ */
+TestExitStatus PerformanceTests::cursorUpdateLatency() {
+	Testsuite::clearScreen();
+
+	byte cursor[16 * 16];
+	memset(cursor, kColorWhite, sizeof(cursor));
+	CursorMan.pushCursor(cursor, 16, 16, 0, 0, kColorBlack);
+	CursorMan.showMouse(true);
+
+	for (int replace = 0; replace < 2; replace++) {
+		CycleClock clock;
+		uint64 totalTicks = 0, maxTicks = 0;
+		uint updates = 0;
+
+		while (g_system->getMillis() - clock.startMillis < kMeasureMillis) {
+			const uint64 start = Common::getCycleCount();
+			if (replace) {
+				cursor[updates % sizeof(cursor)] ^= kColorWhite;
+				CursorMan.replaceCursor(cursor, 16, 16, 0, 0, kColorBlack);
+			}
+			g_system->warpMouse(updates % 300, (updates / 2) % 180);
+			g_system->updateScreen();
+			const uint64 ticks = Common::getCycleCount() - start;
+
+			totalTicks += ticks;
+			maxTicks = MAX(maxTicks, ticks);
+			updates++;
+		}
+
+		const double ticksPerMillis = clock.ticksPerMillis();
+		report("cursor %s: %.3f ms average, %.3f ms worst over %u updates\n", replace ? "replace" : "move",
+			totalTicks / ticksPerMillis / updates, maxTicks / ticksPerMillis, updates);
+	}
+
+	CursorMan.popCursor();
+	CursorMan.showMouse(false);
+	return kTestPassed;
+}
+
+/**
+ * Plays increasing numbers of channels which need resampling and reports
+ * how much of the time a buffer lasts is left after the mixer callback.
+ */
+TestExitStatus PerformanceTests::mixerHeadroom() {
+	Audio::Mixer *mixer = g_system->getMixer();
+	Audio::MixerImpl *mixerImpl = dynamic_cast<Audio::MixerImpl *>(mixer);
+	if (!mixerImpl || !mixer->isReady()) {
+		Testsuite::logPrintf("Info! Skipping test : Mixer headroom, the mixer is not available\n");
+		return kTestSkipped;
+	}
+
+	// A second of 16-bit noise at a rate which differs from the output
+	const int rate = 22050;
+	byte *samples = (byte *)malloc(rate * 2);
+	fillPattern(samples, rate * 2, 2);
+
+	static const int channelCounts[] = { 1, 4, 8, 16, 32 };
+	Common::Array<Audio::SoundHandle> handles;
+	TestExitStatus result = kTestPassed;
+
+	for (int i = 0; i < ARRAYSIZE(channelCounts); i++) {
+		while ((int)handles.size() < channelCounts[i]) {
+			Audio::SeekableAudioStream *raw = Audio::makeRawStream(samples, rate * 2, rate, Audio::FLAG_16BITS | Audio::FLAG_LITTLE_ENDIAN, DisposeAfterUse::NO);
+			Audio::SoundHandle handle;
+			// Quiet, it's only noise
+			mixer->playStream(Audio::Mixer::kPlainSoundType, &handle, Audio::makeLoopingAudioStream(raw, 0), -1, 8);
+			handles.push_back(handle);
+		}
+
+		mixerImpl->enableStats(true);
+		g_system->delayMillis(kMeasureMillis);
+		Audio::MixerImpl::Stats stats;
+		mixerImpl->getStats(stats);
+		mixerImpl->enableStats(false);
+
+		if (!stats.callbacks || !stats.elapsedMillis) {
+			report("mixer %d channels: no callbacks\n", channelCounts[i]);
+			continue;
+		}
+
+		const double ticksPerMillis = (double)stats.elapsedTicks / stats.elapsedMillis;
+		const double bufferMillis = stats.samples * 1000.0 / mixer->getOutputRate() / stats.callbacks;
+		const double averageMillis = stats.callbackTicks / ticksPerMillis / stats.callbacks;
+		const double worstMillis = stats.maxCallbackTicks / ticksPerMillis;
+		report("mixer %d channels: %.1f%% headroom, callback %.3f ms average, %.3f ms worst, buffer %.1f ms, %u missed deadlines\n",
+			channelCounts[i], 100.0 * (1.0 - averageMillis / bufferMillis), averageMillis, worstMillis, bufferMillis, stats.missedDeadlines);
+		// Games play up to eight channels at once
+		if (stats.missedDeadlines && channelCounts[i] <= 8)
+			result = kTestFailed;
+	}
+
+	for (uint i = 0; i < handles.size(); i++)
+		mixer->stopHandle(handles[i]);
+	free(samples);
+
+	return result;
+}
+
+/**
+ * Measures reading a file through SeekableReadStream sequentially in large
+ * blocks, and at random positions in small ones. The file is a savefile,
+ * as that is the storage every port can write.
+ */
+TestExitStatus PerformanceTests::streamReadBandwidth() {
+	const uint32 fileSize = 4 * 1024 * 1024;
+	Common::SaveFileManager *saveFileMan = g_system->getSavefileManager();
+	if (!writeDataFile(fileSize)) {
+		Testsuite::logDetailedPrintf("Can't write the test file\n");
+		return kTestFailed;
+	}
+
+	Common::InSaveFile *stream = saveFileMan->openForLoading(kDataFileName);
+	if (!stream) {
+		Testsuite::logDetailedPrintf("Can't open the test file\n");
+		saveFileMan->removeSavefile(kDataFileName);
+		return kTestFailed;
+	}
+
+	TestExitStatus result = kTestPassed;
+	byte *buffer = new byte[64 * 1024];
+
+	// Sequential, as whole data files and videos are read
+	uint32 bytes = 0;
+	uint32 start = g_system->getMillis();
+	while (g_system->getMillis() - start < kMeasureMillis) {
+		if (stream->eos() || stream->pos() >= stream->size())
+			stream->seek(0);
+		const uint32 read = stream->read(buffer, 64 * 1024);
+		if (!read) {
+			result = kTestFailed;
+			break;
+		}
+		bytes += read;
+	}
+	uint32 elapsed = MAX<uint32>(g_system->getMillis() - start, 1);
+	report("stream sequential 64 KB reads: %.2f MB/s\n", bytes / 1024.0 / 1024.0 * 1000.0 / elapsed);
+
+	// Random, as resources are looked up in archives
+	uint32 seed = 3;
+	uint reads = 0;
+	start = g_system->getMillis();
+	while (g_system->getMillis() - start < kMeasureMillis) {
+		seed = seed * 1103515245 + 12345;
+		stream->seek((seed >> 8) % (fileSize - 512));
+		if (stream->read(buffer, 512) != 512) {
+			result = kTestFailed;
+			break;
+		}
+		reads++;
+	}
+	elapsed = MAX<uint32>(g_system->getMillis() - start, 1);
+	report("stream random 512 byte reads: %.0f reads/s, %.2f MB/s\n", reads * 1000.0 / elapsed,
+		reads * 512 / 1024.0 / 1024.0 * 1000.0 / elapsed);
+
+	delete[] buffer;
+	delete stream;
+	saveFileMan->removeSavefile(kDataFileName);
+	return result;
+}
+
+/**
+ * Measures writing savefiles of a typical size, from opening them until
+ * they are finalized.
+ */
+TestExitStatus PerformanceTests::savefileWriteLatency() {
+	Common::SaveFileManager *saveFileMan = g_system->getSavefileManager();
+	static const uint32 sizes[] = { 16 * 1024, 256 * 1024 };
+
+	for (int compress = 0; compress < 2; compress++) {
+		for (int i = 0; i < ARRAYSIZE(sizes); i++) {
+			byte *data = new byte[sizes[i]];
+			fillPattern(data, sizes[i], i);
+
+			CycleClock clock;
+			uint64 totalTicks = 0, maxTicks = 0;
+			uint saves = 0;
+			bool failed = false;
+
+			while (saves < 100 && g_system->getMillis() - clock.startMillis < kMeasureMillis) {
+				const uint64 start = Common::getCycleCount();
+				Common::OutSaveFile *saveFile = saveFileMan->openForSaving(kDataFileName, compress != 0);
+				if (!saveFile) {
+					failed = true;
+					break;
+				}
+				saveFile->write(data, sizes[i]);
+				saveFile->finalize();
+				failed = saveFile->err();
+				delete saveFile;
+				const uint64 ticks = Common::getCycleCount() - start;
+
+				if (failed)
+					break;
+				totalTicks += ticks;
+				maxTicks = MAX(maxTicks, ticks);
+				saves++;
+			}
+			delete[] data;
+
+			if (failed || !saves) {
+				Testsuite::logDetailedPrintf("Can't write the savefile %s\n", kDataFileName);
+				saveFileMan->removeSavefile(kDataFileName);
+				return kTestFailed;
+			}
+
+			const double ticksPerMillis = clock.ticksPerMillis();
+			report("savefile %u KB%s: %.2f ms average, %.2f ms worst over %u saves\n", sizes[i] / 1024,
+				compress ? " compressed" : "", totalTicks / ticksPerMillis / saves, maxTicks / ticksPerMillis, saves);
+		}
+	}
+
+	saveFileMan->removeSavefile(kDataFileName);
+	return kTestPassed;
+}
+
+PerformanceTestSuite::PerformanceTestSuite() {
+	addTest("ScreenUpdateRate", &PerformanceTests::screenUpdateRate, false);
+	addTest("CursorUpdateLatency", &PerformanceTests::cursorUpdateLatency, false);
+	addTest("MixerHeadroom", &PerformanceTests::mixerHeadroom, false);
+	addTest("StreamReadBandwidth", &PerformanceTests::streamReadBandwidth, false);
+	addTest("SavefileWriteLatency", &PerformanceTests::savefileWriteLatency, false);
+}
+
+PerformanceTestSuite::~PerformanceTestSuite() {
+	delete s_report;
+	s_report = nullptr;
+}
+
+void PerformanceTestSuite::prepare() {
+	delete s_report;
+	s_report = Common::FSNode(ConfParams.getLogDirectory()).getChild("performance.log").createWriteStream(false);
+	if (!s_report)
+		Testsuite::logPrintf("Info! Can't create performance.log, the results are only in the log\n");
+
+	PerformanceTests::report("Performance of %s\n", gScummVMFullVersion);
+}
+
+} // End of namespace Testbed
@@ -38,6 +38,7 @@
 #include "testbed/midi.h"
 #include "testbed/misc.h"
 #include "testbed/networking.h"
+#include "testbed/performance.h"
 #include "testbed/savegame.h"
 #include "testbed/sound.h"
 #include "testbed/testbed.h"
@@ -182,6 +183,9 @@ void TestbedEngine::pushTestsuites(Common::Array<Testsuite *> &testsuiteList) {
 	// Video decoder
 	ts = new VideoDecoderTestSuite();
 	testsuiteList.push_back(ts);
+	// Performance
+	ts = new PerformanceTestSuite();
+	testsuiteList.push_back(ts);
 }
 
 TestbedEngine::~TestbedEngine() {
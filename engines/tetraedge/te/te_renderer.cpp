@@ -234,11 +234,6 @@ void TeRenderer::multiplyMatrix(const TeMatrix4x4 &matrix) {
 }
 
 
-static bool compareTransparentMeshProperties(const TeRenderer::TransparentMeshProperties &p1,
-											const TeRenderer::TransparentMeshProperties &p2) {
-	return (p1._zOrder < p2._zOrder);
-}
-
 void TeRenderer::optimiseTransparentMeshProperties() {
 	if (_transparentMeshProps.size() <= 1)
 		return;
@@ -247,8 +242,26 @@ void TeRenderer::optimiseTransparentMeshProperties() {
 	// original game, but was moved here to split out OGL-specific code.
 	//dumpTransparentMeshProps();
 
-	Common::sort(_transparentMeshProps.begin(), _transparentMeshProps.end(),
-		 compareTransparentMeshProperties);
+	// Sort the indexes rather than the properties, which are expensive to
+	// swap, then copy each property once into its sorted place.
+	const uint numProps = _transparentMeshProps.size();
+	_transparentMeshOrder.resize(numProps);
+	for (uint i = 0; i < numProps; i++)
+		_transparentMeshOrder[i] = i;
+
+	const Common::Array<TransparentMeshProperties> &props = _transparentMeshProps;
+	Common::sort(_transparentMeshOrder.begin(), _transparentMeshOrder.end(),
+		[&props](uint i1, uint i2) {
+			if (props[i1]._zOrder != props[i2]._zOrder)
+				return props[i1]._zOrder < props[i2]._zOrder;
+			return i1 < i2;
+		});
+
+	_sortedTransparentMeshProps.reserve(numProps);
+	for (uint i = 0; i < numProps; i++)
+		_sortedTransparentMeshProps.push_back(_transparentMeshProps[_transparentMeshOrder[i]]);
+	_transparentMeshProps.swap(_sortedTransparentMeshProps);
+	_sortedTransparentMeshProps.resize(0);
 
 	int vertTotal = 0;
 	for (uint i = 0; i < _transparentMeshProps.size(); i++) {
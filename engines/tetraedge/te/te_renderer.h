@@ -165,6 +165,9 @@ protected:
 
 	int _pendingTransparentMeshProperties;
 	Common::Array<TransparentMeshProperties> _transparentMeshProps;
+	// Scratch storage of optimiseTransparentMeshProperties
+	Common::Array<uint> _transparentMeshOrder;
+	Common::Array<TransparentMeshProperties> _sortedTransparentMeshProps;
 
 	TeMatriciesStack _matriciesStacks[3];  // one per matrix mode.
 
@@ -241,7 +241,8 @@ void TeRendererOpenGL::renderTransparentMeshes() {
 	_numTransparentMeshes = 0;
 	_pendingTransparentMeshProperties = 0;
 	glDepthMask(GL_TRUE);
-	_transparentMeshProps.clear();
+	// Keep the storage for the next frame
+	_transparentMeshProps.resize(0);
 }
 
 void TeRendererOpenGL::reset() {
@@ -240,7 +240,8 @@ void TeRendererTinyGL::renderTransparentMeshes() {
 	_numTransparentMeshes = 0;
 	_pendingTransparentMeshProperties = 0;
 	tglDepthMask(TGL_TRUE);
-	_transparentMeshProps.clear();
+	// Keep the storage for the next frame
+	_transparentMeshProps.resize(0);
 }
 
 void TeRendererTinyGL::reset() {
@@ -30,25 +30,30 @@ TeResourceManager::TeResourceManager() {
 TeResourceManager::~TeResourceManager() {
 	// Remove resources one at a time as they may be inter-dependant,
 	// causing removals during iteration.
+	// The oldest ones go first, as they always have.
 	while (_resources.size()) {
-		_resources.erase(_resources.end() - 1);
+		_resources.remove_at(0);
 	}
 }
 
 void TeResourceManager::addResource(const TeIntrusivePtr<TeResource> &resource) {
-	_resources.insert_at(0, resource);
+	_resources.push_back(resource);
 }
 
 void TeResourceManager::addResource(TeResource *resource) {
-	_resources.insert_at(0, TeIntrusivePtr<TeResource>(resource));
+	_resources.push_back(TeIntrusivePtr<TeResource>(resource));
 }
 
 bool TeResourceManager::exists(const Common::Path &path) {
-	for (auto &resource : _resources) {
-		if (resource->getAccessName() == path)
-			return true;
+	return findResource(path) != nullptr;
+}
+
+TeResource *TeResourceManager::findResource(const Common::Path &path) {
+	for (uint i = _resources.size(); i > 0; i--) {
+		if (_resources[i - 1]->getAccessName() == path)
+			return _resources[i - 1].get();
 	}
-	return false;
+	return nullptr;
 }
 
 void TeResourceManager::removeResource(const TeIntrusivePtr<TeResource> &resource) {
@@ -50,23 +50,18 @@ public:
 	void removeResource(const TeResource *resource);
 
 	template<class T> TeIntrusivePtr<T> getResourceByName(const Common::Path &path) {
-		for (TeIntrusivePtr<TeResource> &resource : this->_resources) {
-			if (resource->getAccessName() == path) {
-				return TeIntrusivePtr<T>(dynamic_cast<T *>(resource.get()));
-			}
-		}
+		TeResource *resource = findResource(path);
+		if (resource)
+			return TeIntrusivePtr<T>(dynamic_cast<T *>(resource));
 		debug("getResourceByName: didn't find resource %s", path.toString(Common::Path::kNativeSeparator).c_str());
 		return TeIntrusivePtr<T>();
 	}
 
 	template<class T>
 	TeIntrusivePtr<T> getResource(const TetraedgeFSNode &node) {
-		Common::Path path = node.getPath();
-		for (TeIntrusivePtr<TeResource> &resource : this->_resources) {
-			if (resource->getAccessName() == path) {
-				return TeIntrusivePtr<T>(dynamic_cast<T *>(resource.get()));
-			}
-		}
+		TeResource *resource = findResource(node.getPath());
+		if (resource)
+			return TeIntrusivePtr<T>(dynamic_cast<T *>(resource));
 
 		TeIntrusivePtr<T> retval = new T();
 
@@ -80,6 +75,10 @@ public:
 	}
 
 private:
+	// The most recently added resource with this name, or nullptr
+	TeResource *findResource(const Common::Path &path);
+
+	// Resources are appended, so the most recently added ones are at the end
 	Common::Array<TeIntrusivePtr<TeResource>> _resources;
 
 };
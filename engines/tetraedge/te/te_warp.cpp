@@ -417,8 +417,11 @@ void TeWarp::update() {
 		return;
 	//Application *app = g_engine->getApplication();
 	_frustum.update(_camera);
+	// Only load the textures of the blocs in view, the rest of the cube
+	// is loaded when the camera turns to it.
 	for (auto &bloc : _warpBlocs) {
-		bloc.loadTexture(*_file, _texEncodingType);
+		if (bloc.isVisible(_frustum))
+			bloc.loadTexture(*_file, _texEncodingType);
 	}
 
 	for (auto &anim : _loadedAnimData) {
@@ -554,7 +557,8 @@ void TeWarp::render() {
 
 	if (_renderWarpBlocs) {
 		for (auto &bloc : _warpBlocs) {
-			bloc.render();
+			if (bloc.isVisible(_frustum))
+				bloc.render();
 		}
 	}
 
@@ -563,10 +567,8 @@ void TeWarp::render() {
 			continue;
 		for (FrameData &frameData : animData->_frameDatas) {
 			for (TeWarpBloc &b : frameData._warpBlocs) {
-				if (_frustum.isTriangleInside(b.vertex(0), b.vertex(1), b.vertex(3))
-						|| _frustum.isTriangleInside(b.vertex(1), b.vertex(2), b.vertex(3))) {
+				if (b.isVisible(_frustum))
 					b.render();
-				}
 			}
 		}
 	}
@@ -666,10 +668,8 @@ void TeWarp::updateCamera(const TeVector3f32 &screen) {
 
 void TeWarp::FrameData::loadTextures(const TeFrustum &frustum, Common::SeekableReadStream &file, const Common::String &fileType) {
 	for (auto &b : _warpBlocs) {
-		if (!b.isLoaded() && (frustum.isTriangleInside(b.vertex(0), b.vertex(1), b.vertex(3))
-				|| frustum.isTriangleInside(b.vertex(1), b.vertex(2), b.vertex(3)))) {
+		if (!b.isLoaded() && b.isVisible(frustum))
 			b.loadTexture(file, fileType);
-		}
 	}
 }
 
@@ -123,6 +123,11 @@ bool TeWarpBloc::isLoaded() const {
 	return _mesh->materials().size() > 0 && _mesh->material(0)->_texture;
 }
 
+bool TeWarpBloc::isVisible(const TeFrustum &frustum) const {
+	return frustum.isTriangleInside(vertex(0), vertex(1), vertex(3))
+		|| frustum.isTriangleInside(vertex(1), vertex(2), vertex(3));
+}
+
 void TeWarpBloc::loadTexture(Common::SeekableReadStream &file, const Common::String &type) {
 	if (isLoaded())
 		return;
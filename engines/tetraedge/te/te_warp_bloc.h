@@ -29,6 +29,7 @@
 #include "tetraedge/te/te_intrusive_ptr.h"
 #include "tetraedge/te/te_3d_texture.h"
 #include "tetraedge/te/te_mesh.h"
+#include "tetraedge/te/te_frustum.h"
 
 #include "common/file.h"
 
@@ -55,6 +56,7 @@ public:
 	void create();
 	void index(uint offset, uint val);
 	bool isLoaded() const;
+	bool isVisible(const TeFrustum &frustum) const;
 	void loadTexture(Common::SeekableReadStream &file, const Common::String &type);
 	//void operator=(const TeWarpBloc &other); // unused
 	//bool operator==(const TeWarpBloc &other); // unused
@@ -160,22 +160,18 @@ void CBaseStars::draw(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *
 	}
 }
 
-void CBaseStars::draw1(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup) {
-	FPose pose = camera->getPose();
+void CBaseStars::projectStars(CCamera *camera, const FPose &pose) {
 	camera->getRelativeXCenterPixels(&_value1, &_value2, &_value3, &_value4);
 
 	const double MAX_VAL = 1.0e9 * 1.0e9;
-	FPoint centroid = surfaceArea->_centroid + FPoint(0.5, 0.5);
 	double threshold = camera->getFrontClip();
 	double minVal = threshold - 9216.0;
-	int width1 = surfaceArea->_width - 1;
-	int height1 = surfaceArea->_height - 1;
-	double *v1Ptr = &_value1, *v2Ptr = &_value2;
 	double tempX, tempY, tempZ, total2;
 
+	_projected.resize(0);
+
 	for (uint idx = 0; idx < _data.size(); ++idx) {
-		CBaseStarEntry &entry = _data[idx];
-		const FVector &vector = entry._position;
+		const FVector &vector = _data[idx]._position;
 		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
 			+ vector._z * pose._row3._z + pose._vector._z;
 		if (tempZ <= minVal)
@@ -185,22 +181,53 @@ void CBaseStars::draw1(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
 		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
 
+		CProjectedStar star;
+		star._index = idx;
+		star._x = tempX;
+		star._y = tempY;
+		star._z = tempZ;
+		star._total2 = total2;
+
 		if (total2 < 1.0e12) {
-			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
-				surfaceArea, camera);
-			continue;
+			// We're in close proximity to the given star, so it gets drawn as a closeup
+			star._closeup = true;
+			star._brightness = 0.0;
+		} else {
+			if (tempZ <= threshold || total2 >= MAX_VAL)
+				continue;
+
+			double sVal = sqrt(total2);
+			star._closeup = false;
+			star._brightness = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
 		}
 
-		if (tempZ <= threshold || total2 >= MAX_VAL)
+		_projected.push_back(star);
+	}
+}
+
+void CBaseStars::draw1(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup) {
+	FPose pose = camera->getPose();
+	projectStars(camera, pose);
+
+	FPoint centroid = surfaceArea->_centroid + FPoint(0.5, 0.5);
+	int width1 = surfaceArea->_width - 1;
+	int height1 = surfaceArea->_height - 1;
+	int pitch2 = surfaceArea->_pitch / 2;
+
+	for (const CProjectedStar &star : _projected) {
+		const CBaseStarEntry &entry = _data[star._index];
+		if (star._closeup) {
+			closeup->draw(pose, entry._position, FVector(centroid._x, centroid._y, star._total2),
+				surfaceArea, camera);
 			continue;
+		}
 
-		int xStart = (int)(*v1Ptr * tempX / tempZ + centroid._x);
-		int yStart = (int)(*v2Ptr * tempY / tempZ + centroid._y);
+		int xStart = (int)(_value1 * star._x / star._z + centroid._x);
+		int yStart = (int)(_value2 * star._y / star._z + centroid._y);
 		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
 			continue;
 
-		double sVal = sqrt(total2);
-		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
+		double sVal = star._brightness;
 		double red = MIN((double)entry._red * sVal, (double)255.0);
 		double green = MIN((double)entry._green * sVal, (double)255.0);
 		double blue = MIN((double)entry._green * sVal, (double)255.0);
@@ -235,8 +262,8 @@ void CBaseStars::draw1(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 		case 1:
 			*pixelP = rgb;
 			*(pixelP + 1) = rgb;
-			*(pixelP + surfaceArea->_pitch / 2) = rgb;
-			*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
+			*(pixelP + pitch2) = rgb;
+			*(pixelP + pitch2 + 1) = rgb;
 			break;
 
 		default:
@@ -247,45 +274,27 @@ void CBaseStars::draw1(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 
 void CBaseStars::draw2(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup) {
 	FPose pose = camera->getPose();
-	camera->getRelativeXCenterPixels(&_value1, &_value2, &_value3, &_value4);
+	projectStars(camera, pose);
 
-	const double MAX_VAL = 1.0e9 * 1.0e9;
 	FPoint centroid = surfaceArea->_centroid + FPoint(0.5, 0.5);
-	double threshold = camera->getFrontClip();
-	double minVal = threshold - 9216.0;
 	int width1 = surfaceArea->_width - 1;
 	int height1 = surfaceArea->_height - 1;
-	double *v1Ptr = &_value1, *v2Ptr = &_value2;
-	double tempX, tempY, tempZ, total2;
-
-	for (uint idx = 0; idx < _data.size(); ++idx) {
-		CBaseStarEntry &entry = _data[idx];
-		const FVector &vector = entry._position;
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
-		if (tempZ <= minVal)
-			continue;
-
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
-		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
+	int pitch2 = surfaceArea->_pitch / 2;
 
-		if (total2 < 1.0e12) {
-			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
+	for (const CProjectedStar &star : _projected) {
+		const CBaseStarEntry &entry = _data[star._index];
+		if (star._closeup) {
+			closeup->draw(pose, entry._position, FVector(centroid._x, centroid._y, star._total2),
 				surfaceArea, camera);
 			continue;
 		}
 
-		if (tempZ <= threshold || total2 >= MAX_VAL)
-			continue;
-
-		int xStart = (int)(*v1Ptr * tempX / tempZ + centroid._x);
-		int yStart = (int)(*v2Ptr * tempY / tempZ + centroid._y);
+		int xStart = (int)(_value1 * star._x / star._z + centroid._x);
+		int yStart = (int)(_value2 * star._y / star._z + centroid._y);
 		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
 			continue;
 
-		double sVal = sqrt(total2);
-		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
+		double sVal = star._brightness;
 		double red = MIN((double)entry._red * sVal, (double)255.0);
 		double green = MIN((double)entry._green * sVal, (double)255.0);
 		double blue = MIN((double)entry._green * sVal, (double)255.0);
@@ -321,8 +330,8 @@ void CBaseStars::draw2(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 		case 1:
 			*pixelP = rgb;
 			*(pixelP + 1) = rgb;
-			*(pixelP + surfaceArea->_pitch / 2) = rgb;
-			*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
+			*(pixelP + pitch2) = rgb;
+			*(pixelP + pitch2 + 1) = rgb;
 			break;
 
 		default:
@@ -333,57 +342,38 @@ void CBaseStars::draw2(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 
 void CBaseStars::draw3(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup) {
 	FPose pose = camera->getPose();
-	camera->getRelativeXCenterPixels(&_value1, &_value2, &_value3, &_value4);
+	projectStars(camera, pose);
 
-	const double MAX_VAL = 1.0e9 * 1.0e9;
 	FPoint centroid = surfaceArea->_centroid + FPoint(0.5, 0.5);
-	double threshold = camera->getFrontClip();
-	double minVal = threshold - 9216.0;
 	int width1 = surfaceArea->_width - 1;
 	int height1 = surfaceArea->_height - 1;
-	double *v1Ptr = &_value1, *v2Ptr = &_value2;
-	double *v3Ptr = &_value3, *v4Ptr = &_value4;
-	double tempX, tempY, tempZ, total2, sVal;
-	int xStart, yStart, rgb;
-	uint16 *pixelP;
-
-	for (uint idx = 0; idx < _data.size(); ++idx) {
-		CBaseStarEntry &entry = _data[idx];
-		const FVector &vector = entry._position;
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
-		if (tempZ <= minVal)
-			continue;
-
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
-		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
+	int pitch2 = surfaceArea->_pitch / 2;
 
-		if (total2 < 1.0e12) {
-			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
+	for (const CProjectedStar &star : _projected) {
+		const CBaseStarEntry &entry = _data[star._index];
+		if (star._closeup) {
+			closeup->draw(pose, entry._position, FVector(centroid._x, centroid._y, star._total2),
 				surfaceArea, camera);
 			continue;
 		}
 
-		if (tempZ <= threshold || total2 >= MAX_VAL)
+		// Both pixels share the same brightness
+		double sVal = star._brightness * 255.0;
+		if (sVal > 255.0)
+			sVal = 255.0;
+
+		int yStart = (int)(star._y * _value2 / star._z + centroid._y);
+		if (yStart < 0 || yStart >= height1)
 			continue;
 
 		// First pixel
-		xStart = (int)((tempX + *v3Ptr) * *v1Ptr / tempZ + centroid._x);
-		yStart = (int)(tempY * *v2Ptr / tempZ + centroid._y);
-		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
+		int xStart = (int)((star._x + _value3) * _value1 / star._z + centroid._x);
+		if (xStart < 0 || xStart >= width1)
 			continue;
 
-		sVal = sqrt(total2);
-		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
-		sVal *= 255.0;
-
-		if (sVal > 255.0)
-			sVal = 255.0;
-
 		if (sVal > 2.0) {
-			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
-			rgb = ((int)(sVal - 0.5) & 0xf8) << 7;
+			uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
+			int rgb = ((int)(sVal - 0.5) & 0xf8) << 7;
 
 			switch (entry._thickness) {
 			case 0:
@@ -393,8 +383,8 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 			case 1:
 				*pixelP = rgb;
 				*(pixelP + 1) = rgb;
-				*(pixelP + surfaceArea->_pitch / 2) = rgb;
-				*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
+				*(pixelP + pitch2) = rgb;
+				*(pixelP + pitch2 + 1) = rgb;
 				break;
 
 			default:
@@ -403,21 +393,13 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 		}
 
 		// Second pixel
-		xStart = (int)((tempX + *v4Ptr) * *v1Ptr / tempZ + centroid._x);
-		yStart = (int)(tempY * *v2Ptr / tempZ + centroid._y);
-		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
+		xStart = (int)((star._x + _value4) * _value1 / star._z + centroid._x);
+		if (xStart < 0 || xStart >= width1)
 			continue;
 
-		sVal = sqrt(total2);
-		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
-		sVal *= 255.0;
-
-		if (sVal > 255.0)
-			sVal = 255.0;
-
 		if (sVal > 2.0) {
-			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
-			rgb = ((int)(sVal - 0.5) & 0xf8) << 7;
+			uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
+			int rgb = ((int)(sVal - 0.5) & 0xf8) << 7;
 
 			switch (entry._thickness) {
 			case 0:
@@ -427,8 +409,8 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 			case 1:
 				*pixelP |= rgb;
 				*(pixelP + 1) |= rgb;
-				*(pixelP + surfaceArea->_pitch / 2) |= rgb;
-				*(pixelP + surfaceArea->_pitch / 2 + 1) |= rgb;
+				*(pixelP + pitch2) |= rgb;
+				*(pixelP + pitch2 + 1) |= rgb;
 				break;
 
 			default:
@@ -440,58 +422,38 @@ void CBaseStars::draw3(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 
 void CBaseStars::draw4(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup) {
 	FPose pose = camera->getPose();
-	camera->getRelativeXCenterPixels(&_value1, &_value2, &_value3, &_value4);
+	projectStars(camera, pose);
 
-	const double MAX_VAL = 1.0e9 * 1.0e9;
 	FPoint centroid = surfaceArea->_centroid + FPoint(0.5, 0.5);
-	double threshold = camera->getFrontClip();
-	double minVal = threshold - 9216.0;
 	int width1 = surfaceArea->_width - 1;
 	int height1 = surfaceArea->_height - 1;
-	double *v1Ptr = &_value1, *v2Ptr = &_value2, *v3Ptr = &_value3, *v4Ptr = &_value4;
-	double tempX, tempY, tempZ, total2, sVal;
-	int xStart, yStart, rgb;
-	uint16 *pixelP;
-
-	for (uint idx = 0; idx < _data.size(); ++idx) {
-		const CBaseStarEntry &entry = _data[idx];
-		const FVector &vector = entry._position;
-
-		tempZ = vector._x * pose._row1._z + vector._y * pose._row2._z
-			+ vector._z * pose._row3._z + pose._vector._z;
-		if (tempZ <= minVal)
-			continue;
+	int pitch2 = surfaceArea->_pitch / 2;
 
-		tempY = vector._x * pose._row1._y + vector._y * pose._row2._y + vector._z * pose._row3._y + pose._vector._y;
-		tempX = vector._x * pose._row1._x + vector._y * pose._row2._x + vector._z * pose._row3._x + pose._vector._x;
-		total2 = tempY * tempY + tempX * tempX + tempZ * tempZ;
-
-		if (total2 < 1.0e12) {
-			// We're in close proximity to the given star, so draw a closeup of it
-			closeup->draw(pose, vector, FVector(centroid._x, centroid._y, total2),
+	for (const CProjectedStar &star : _projected) {
+		const CBaseStarEntry &entry = _data[star._index];
+		if (star._closeup) {
+			closeup->draw(pose, entry._position, FVector(centroid._x, centroid._y, star._total2),
 				surfaceArea, camera);
 			continue;
 		}
 
-		if (tempZ <= threshold || total2 >= MAX_VAL)
+		// Both pixels share the same brightness
+		double sVal = star._brightness * 255.0;
+		if (sVal > 255.0)
+			sVal = 255.0;
+
+		int yStart = (int)(star._y * _value2 / star._z + centroid._y);
+		if (yStart < 0 || yStart >= height1)
 			continue;
 
 		// First pixel
-		xStart = (int)((tempX + *v3Ptr) * *v1Ptr / tempZ + centroid._x);
-		yStart = (int)(tempY * *v2Ptr / tempZ + centroid._y);
-		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
+		int xStart = (int)((star._x + _value3) * _value1 / star._z + centroid._x);
+		if (xStart < 0 || xStart >= width1)
 			continue;
 
-		sVal = sqrt(total2);
-		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
-		sVal *= 255.0;
-
-		if (sVal > 255.0)
-			sVal = 255.0;
-
 		if (sVal > 2.0) {
-			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
-			rgb = ((int)(sVal - 0.5) & 0xf8) << 8;
+			uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
+			int rgb = ((int)(sVal - 0.5) & 0xf8) << 8;
 
 			switch (entry._thickness) {
 			case 0:
@@ -501,8 +463,8 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 			case 1:
 				*pixelP = rgb;
 				*(pixelP + 1) = rgb;
-				*(pixelP + surfaceArea->_pitch / 2) = rgb;
-				*(pixelP + surfaceArea->_pitch / 2 + 1) = rgb;
+				*(pixelP + pitch2) = rgb;
+				*(pixelP + pitch2 + 1) = rgb;
 				break;
 
 			default:
@@ -511,21 +473,13 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 		}
 
 		// Second pixel
-		xStart = (int)((tempX + *v4Ptr) * *v1Ptr / tempZ + centroid._x);
-		yStart = (int)((tempY * *v2Ptr) / tempZ + centroid._y);
-		if (xStart < 0 || xStart >= width1 || yStart < 0 || yStart >= height1)
+		xStart = (int)((star._x + _value4) * _value1 / star._z + centroid._x);
+		if (xStart < 0 || xStart >= width1)
 			continue;
 
-		sVal = sqrt(total2);
-		sVal = (sVal < 100000.0) ? 1.0 : 1.0 - ((sVal - 100000.0) / 1.0e9);
-		sVal *= 255.0;
-
-		if (sVal > 255.0)
-			sVal = 255.0;
-
 		if (sVal > 2.0) {
-			pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
-			rgb = ((int)(sVal - 0.5) >> 3) & 0xff;
+			uint16 *pixelP = (uint16 *)(surfaceArea->_pixelsPtr + surfaceArea->_pitch * yStart + xStart * 2);
+			int rgb = ((int)(sVal - 0.5) >> 3) & 0xff;
 
 			switch (entry._thickness) {
 			case 0:
@@ -535,8 +489,8 @@ void CBaseStars::draw4(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup
 			case 1:
 				*pixelP |= rgb;
 				*(pixelP + 1) |= rgb;
-				*(pixelP + surfaceArea->_pitch / 2) |= rgb;
-				*(pixelP + surfaceArea->_pitch / 2 + 1) |= rgb;
+				*(pixelP + pitch2) |= rgb;
+				*(pixelP + pitch2 + 1) |= rgb;
 				break;
 
 			default:
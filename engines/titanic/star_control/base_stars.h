@@ -38,6 +38,7 @@ class CStarCloseup;
 class CString;
 class CSurfaceArea;
 class SimpleFile;
+class FPose;
 
 struct CBaseStarEntry {
 	byte _red;
@@ -58,6 +59,17 @@ struct CBaseStarEntry {
 	bool operator==(const CBaseStarEntry &s) const;
 };
 
+/**
+ * A star that survived the depth culling of a draw, in camera space
+ */
+struct CProjectedStar {
+	uint _index;
+	bool _closeup;
+	double _x, _y, _z;
+	double _total2;
+	double _brightness;
+};
+
 struct CStarPosition : public Common::Point {
 	int _index1;
 	int _index2;
@@ -73,6 +85,14 @@ struct CStarPosition : public Common::Point {
  */
 class CBaseStars {
 private:
+	Common::Array<CProjectedStar> _projected;
+private:
+	/**
+	 * Transforms all the stars into camera space, and collects the ones in
+	 * front of the camera into _projected for the plotting loops of the draw methods
+	 */
+	void projectStars(CCamera *camera, const FPose &pose);
+
 	void draw1(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup);
 	void draw2(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup);
 	void draw3(CSurfaceArea *surfaceArea, CCamera *camera, CStarCloseup *closeup);
@@ -71,8 +71,8 @@ void PathFindingHeap::clear() {
 	memset(_data, 0, sizeof(HeapDataGrid) * _size);
 }
 
-void PathFindingHeap::push(int16 x, int16 y, uint16 weight) {
-	debugC(2, kDebugPath, "push(%d, %d, %d)", x, y, weight);
+void PathFindingHeap::push(int16 x, int16 y, uint16 weight, uint16 tie) {
+	debugC(2, kDebugPath, "push(%d, %d, %d, %d)", x, y, weight, tie);
 
 	if (_count == _size) {
 		// Increase size by 50%
@@ -93,6 +93,7 @@ void PathFindingHeap::push(int16 x, int16 y, uint16 weight) {
 	_data[_count]._x = x;
 	_data[_count]._y = y;
 	_data[_count]._weight = weight;
+	_data[_count]._tie = tie;
 	_count++;
 
 	uint32 lMax = _count - 1;
@@ -103,7 +104,7 @@ void PathFindingHeap::push(int16 x, int16 y, uint16 weight) {
 			break;
 		lT = (lMax - 1) / 2;
 
-		if (_data[lT]._weight > _data[lMax]._weight) {
+		if (_data[lT].getKey() > _data[lMax].getKey()) {
 			HeapDataGrid temp;
 			temp = _data[lT];
 			_data[lT] = _data[lMax];
@@ -138,10 +139,10 @@ void PathFindingHeap::pop(int16 *x, int16 *y, uint16 *weight) {
 		lT = (lMin * 2) + 1;
 		if (lT < _count) {
 			if (lT < _count - 1) {
-				if (_data[lT + 1]._weight < _data[lT]._weight)
+				if (_data[lT + 1].getKey() < _data[lT].getKey())
 					lT++;
 			}
-			if (_data[lT]._weight <= _data[lMin]._weight) {
+			if (_data[lT].getKey() <= _data[lMin].getKey()) {
 				HeapDataGrid temp;
 				temp = _data[lMin];
 				_data[lMin] = _data[lT];
@@ -162,8 +163,21 @@ PathFinding::PathFinding() : _blockingRects{{0}} {
 	_height = 0;
 	_heap = new PathFindingHeap();
 	_sq = nullptr;
+	_sqGeneration = nullptr;
+	_generation = 0;
 	_numBlockingRects = 0;
 
+	_areas = nullptr;
+	_areasValid = false;
+
+	_clusterWidth = 0;
+	_clusterHeight = 0;
+	_clusterArea = nullptr;
+	_clusterInCorridor = nullptr;
+	_clusterCost = nullptr;
+	_clusterHeap = new PathFindingHeap();
+	_maskRevision = 0;
+
 	_currentMask = nullptr;
 }
 
@@ -171,7 +185,15 @@ PathFinding::~PathFinding(void) {
 	if (_heap)
 		_heap->unload();
 	delete _heap;
+	if (_clusterHeap)
+		_clusterHeap->unload();
+	delete _clusterHeap;
 	delete[] _sq;
+	delete[] _sqGeneration;
+	delete[] _areas;
+	delete[] _clusterArea;
+	delete[] _clusterInCorridor;
+	delete[] _clusterCost;
 }
 
 void PathFinding::init(Picture *mask) {
@@ -184,6 +206,80 @@ void PathFinding::init(Picture *mask) {
 	_heap->init(500);
 	delete[] _sq;
 	_sq = new uint16[_width * _height];
+	delete[] _sqGeneration;
+	_sqGeneration = new uint16[_width * _height];
+	memset(_sqGeneration, 0, _width * _height * sizeof(uint16));
+	_generation = 0;
+
+	delete[] _areas;
+	_areas = new uint16[_width * _height];
+
+	_clusterWidth = (_width + kClusterSize - 1) / kClusterSize;
+	_clusterHeight = (_height + kClusterSize - 1) / kClusterSize;
+	delete[] _clusterArea;
+	_clusterArea = new uint16[_clusterWidth * _clusterHeight];
+	delete[] _clusterInCorridor;
+	_clusterInCorridor = new bool[_clusterWidth * _clusterHeight];
+	delete[] _clusterCost;
+	_clusterCost = new uint16[_clusterWidth * _clusterHeight];
+	_clusterHeap->unload();
+	_clusterHeap->init(500);
+
+	buildClusters();
+}
+
+void PathFinding::buildClusters() {
+	debugC(1, kDebugPath, "buildClusters()");
+
+	_maskRevision = _currentMask->getRevision();
+
+	// Label the walkable areas, with the same neighbours as the search
+	memset(_areas, 0, _width * _height * sizeof(uint16));
+	memset(_clusterArea, 0, _clusterWidth * _clusterHeight * sizeof(uint16));
+	_areasValid = true;
+
+	Common::Array<int32> stack;
+	uint16 numAreas = 0;
+	for (int32 node = 0; node < _width * _height; node++) {
+		const int16 nodeX = node % _width;
+		const int16 nodeY = node / _width;
+		if (_areas[node] || !isWalkable(nodeX, nodeY))
+			continue;
+
+		if (numAreas == kMixedCluster - 1) {
+			// The search still works without, it's just slower to give up
+			_areasValid = false;
+			break;
+		}
+		++numAreas;
+
+		_areas[node] = numAreas;
+		stack.push_back(node);
+		while (!stack.empty()) {
+			const int32 curNode = stack.back();
+			stack.pop_back();
+
+			const int16 curX = curNode % _width;
+			const int16 curY = curNode / _width;
+			uint16 &clusterArea = _clusterArea[(curX / kClusterSize) + (curY / kClusterSize) * _clusterWidth];
+			if (!clusterArea)
+				clusterArea = numAreas;
+			else if (clusterArea != numAreas)
+				clusterArea = kMixedCluster;
+
+			const int16 endX = MIN<int16>(curX + 1, _width - 1);
+			const int16 endY = MIN<int16>(curY + 1, _height - 1);
+			for (int16 px = MAX<int16>(curX - 1, 0); px <= endX; px++) {
+				for (int16 py = MAX<int16>(curY - 1, 0); py <= endY; py++) {
+					const int32 pNode = px + py * _width;
+					if (!_areas[pNode] && isWalkable(px, py)) {
+						_areas[pNode] = numAreas;
+						stack.push_back(pNode);
+					}
+				}
+			}
+		}
+	}
 }
 
 bool PathFinding::isLikelyWalkable(int16 x, int16 y) {
@@ -316,69 +412,42 @@ bool PathFinding::findPath(int16 x, int16 y, int16 destx, int16 desty) {
 		return true;
 	}
 
-	// no direct line, we use the standard A* algorithm
-	memset(_sq , 0, _width * _height * sizeof(uint16));
-	_heap->clear();
-	int16 curX = x;
-	int16 curY = y;
-	uint16 curWeight = 0;
-
-	_sq[curX + curY *_width] = 1;
-	_heap->push(curX, curY, abs(destx - x) + abs(desty - y));
-
-	while (_heap->getCount()) {
-		_heap->pop(&curX, &curY, &curWeight);
-		int32 curNode = curX + curY * _width;
+	if (_maskRevision != _currentMask->getRevision())
+		buildClusters();
 
-		int16 endX = MIN<int16>(curX + 1, _width - 1);
-		int16 endY = MIN<int16>(curY + 1, _height - 1);
-		int16 startX = MAX<int16>(curX - 1, 0);
-		int16 startY = MAX<int16>(curY - 1, 0);
-		bool next = false;
-
-		for (int16 px = startX; px <= endX && !next; px++) {
-			for (int16 py = startY; py <= endY && !next; py++) {
-				if (px != curX || py != curY) {
-					uint16 wei = abs(px - curX) + abs(py - curY);
+	const bool inMask = x < _width && y < _height && destx < _width && desty < _height;
 
-					if (isWalkable(px, py)) { // walkable ?
-						int32 curPNode = px + py * _width;
-						uint32 sum = _sq[curNode] + wei * (1 + (isLikelyWalkable(px, py) ? 5 : 0));
-						if (sum > (uint32)0xFFFF) {
-							warning("PathFinding::findPath sum exceeds maximum representable!");
-							sum = (uint32)0xFFFF;
-						}
-						if (_sq[curPNode] > sum || !_sq[curPNode]) {
-							_sq[curPNode] = sum;
-							uint32 newWeight = _sq[curPNode] + abs(destx - px) + abs(desty - py);
-							if (newWeight > (uint32)0xFFFF) {
-								warning("PathFinding::findPath newWeight exceeds maximum representable!");
-								newWeight = (uint16)0xFFFF;
-							}
-							_heap->push(px, py, newWeight);
-							if (!newWeight)
-								next = true; // we found it !
-						}
-					}
-				}
-			}
-		}
+	// A path can't leave the walkable area it starts in
+	if (inMask && _areasValid && isWalkable(x, y) && _areas[x + y * _width] != _areas[destx + desty * _width]) {
+		_tempPath.clear();
+		return false;
 	}
 
+	// Search along the clusters leading to the destination first, and only
+	// fall back to searching the whole mask if the way is narrower than
+	// the clusters made it look
+	bool found = false;
+	if (inMask && findCorridor(x, y, destx, desty, 1))
+		found = searchPath(x, y, destx, desty, true);
+	if (!found && inMask && findCorridor(x, y, destx, desty, 3))
+		found = searchPath(x, y, destx, desty, true);
+	if (!found)
+		found = searchPath(x, y, destx, desty, false);
+
 	// let's see if we found a result !
-	if (!_sq[destx + desty * _width]) {
+	if (!found) {
 		// didn't find anything
 		_tempPath.clear();
 		return false;
 	}
 
-	curX = destx;
-	curY = desty;
+	int16 curX = destx;
+	int16 curY = desty;
 
 	Common::Array<Common::Point> retPath;
 	retPath.push_back(Common::Point(curX, curY));
 
-	uint16 bestscore = _sq[destx + desty * _width];
+	uint16 bestscore = getCost(destx + desty * _width);
 
 	bool retVal = false;
 	while (true) {
@@ -394,9 +463,10 @@ bool PathFinding::findPath(int16 x, int16 y, int16 destx, int16 desty) {
 			for (int16 py = startY; py <= endY; py++) {
 				if (px != curX || py != curY) {
 					int32 PNode = px + py * _width;
-					if (_sq[PNode] && (isWalkable(px, py))) {
-						if (_sq[PNode] < bestscore) {
-							bestscore = _sq[PNode];
+					uint16 cost = getCost(PNode);
+					if (cost && (isWalkable(px, py))) {
+						if (cost < bestscore) {
+							bestscore = cost;
 							bestX = px;
 							bestY = py;
 						}
@@ -411,9 +481,8 @@ bool PathFinding::findPath(int16 x, int16 y, int16 destx, int16 desty) {
 		retPath.push_back(Common::Point(bestX, bestY));
 
 		if ((bestX == x && bestY == y)) {
-			_tempPath.clear();
-			for (uint32 i = 0; i < retPath.size(); i++)
-				_tempPath.push_back(retPath[i]);
+			smoothPath(retPath);
+			_tempPath = retPath;
 
 			retVal = true;
 			break;
@@ -426,6 +495,240 @@ bool PathFinding::findPath(int16 x, int16 y, int16 destx, int16 desty) {
 	return retVal;
 }
 
+bool PathFinding::findCorridor(int16 x, int16 y, int16 destx, int16 desty, int16 margin) {
+	debugC(2, kDebugPath, "findCorridor(%d, %d, %d, %d, %d)", x, y, destx, desty, margin);
+
+	const int16 startCX = x / kClusterSize;
+	const int16 startCY = y / kClusterSize;
+	const int16 destCX = destx / kClusterSize;
+	const int16 destCY = desty / kClusterSize;
+
+	// Walking across a couple of clusters, there is nothing to save
+	if (ABS(destCX - startCX) <= 2 && ABS(destCY - startCY) <= 2)
+		return false;
+
+	// Only go through clusters where the destination can be reached
+	const uint16 destArea = (_areasValid && _areas[destx + desty * _width]) ? _areas[destx + desty * _width] : kMixedCluster;
+
+	memset(_clusterCost, 0, _clusterWidth * _clusterHeight * sizeof(uint16));
+	_clusterHeap->clear();
+
+	int16 curX = startCX;
+	int16 curY = startCY;
+	uint16 curWeight = 0;
+
+	_clusterCost[curX + curY * _clusterWidth] = 1;
+	_clusterHeap->push(curX, curY, ABS(destCX - curX) + ABS(destCY - curY));
+
+	while (_clusterHeap->getCount()) {
+		_clusterHeap->pop(&curX, &curY, &curWeight);
+		if (curX == destCX && curY == destCY)
+			break;
+
+		const int32 curNode = curX + curY * _clusterWidth;
+		const int16 endX = MIN<int16>(curX + 1, _clusterWidth - 1);
+		const int16 endY = MIN<int16>(curY + 1, _clusterHeight - 1);
+		for (int16 px = MAX<int16>(curX - 1, 0); px <= endX; px++) {
+			for (int16 py = MAX<int16>(curY - 1, 0); py <= endY; py++) {
+				const int32 pNode = px + py * _clusterWidth;
+				const uint16 area = _clusterArea[pNode];
+				if ((px == curX && py == curY) || !area || (area != destArea && area != kMixedCluster && destArea != kMixedCluster))
+					continue;
+
+				// Go around the characters, like the pixel search does
+				const int16 centerX = MIN<int16>(px * kClusterSize + kClusterSize / 2, _width - 1);
+				const int16 centerY = MIN<int16>(py * kClusterSize + kClusterSize / 2, _height - 1);
+				const uint16 wei = ABS(px - curX) + ABS(py - curY);
+				const uint16 sum = _clusterCost[curNode] + wei * (isLikelyWalkable(centerX, centerY) ? 1 : 6);
+				if (!_clusterCost[pNode] || _clusterCost[pNode] > sum) {
+					_clusterCost[pNode] = sum;
+					_clusterHeap->push(px, py, sum + ABS(destCX - px) + ABS(destCY - py), ABS(destCX - px) + ABS(destCY - py));
+				}
+			}
+		}
+	}
+
+	if (!_clusterCost[destCX + destCY * _clusterWidth])
+		return false;
+
+	// Walk back to the start, taking the clusters around the way as well
+	memset(_clusterInCorridor, 0, _clusterWidth * _clusterHeight * sizeof(bool));
+	curX = destCX;
+	curY = destCY;
+	while (true) {
+		for (int16 px = MAX<int16>(curX - margin, 0); px <= MIN<int16>(curX + margin, _clusterWidth - 1); px++) {
+			for (int16 py = MAX<int16>(curY - margin, 0); py <= MIN<int16>(curY + margin, _clusterHeight - 1); py++)
+				_clusterInCorridor[px + py * _clusterWidth] = true;
+		}
+
+		if (curX == startCX && curY == startCY)
+			return true;
+
+		uint16 bestScore = _clusterCost[curX + curY * _clusterWidth];
+		int16 bestX = -1;
+		int16 bestY = -1;
+		const int16 endX = MIN<int16>(curX + 1, _clusterWidth - 1);
+		const int16 endY = MIN<int16>(curY + 1, _clusterHeight - 1);
+		for (int16 px = MAX<int16>(curX - 1, 0); px <= endX; px++) {
+			for (int16 py = MAX<int16>(curY - 1, 0); py <= endY; py++) {
+				const uint16 cost = _clusterCost[px + py * _clusterWidth];
+				if (cost && cost < bestScore) {
+					bestScore = cost;
+					bestX = px;
+					bestY = py;
+				}
+			}
+		}
+
+		if (bestX < 0)
+			return false;
+
+		curX = bestX;
+		curY = bestY;
+	}
+}
+
+bool PathFinding::searchPath(int16 x, int16 y, int16 destx, int16 desty, bool inCorridor) {
+	debugC(2, kDebugPath, "searchPath(%d, %d, %d, %d, %d)", x, y, destx, desty, inCorridor ? 1 : 0);
+
+	// Costs left from the last search are dropped by moving on to the next
+	// generation, instead of clearing the whole buffer
+	if (++_generation == 0) {
+		memset(_sqGeneration, 0, _width * _height * sizeof(uint16));
+		_generation = 1;
+	}
+
+	_heap->clear();
+	int16 curX = x;
+	int16 curY = y;
+	uint16 curWeight = 0;
+
+	setCost(curX + curY * _width, 1);
+	_heap->push(curX, curY, abs(destx - x) + abs(desty - y));
+
+	while (_heap->getCount()) {
+		_heap->pop(&curX, &curY, &curWeight);
+
+		// The distance is a consistent estimate, so the destination has its
+		// lowest cost once it comes out of the heap
+		if (curX == destx && curY == desty)
+			break;
+
+		int32 curNode = curX + curY * _width;
+
+		// Skip nodes which have been reached more cheaply since
+		if (curWeight > getCost(curNode) + abs(destx - curX) + abs(desty - curY))
+			continue;
+
+		int16 endX = MIN<int16>(curX + 1, _width - 1);
+		int16 endY = MIN<int16>(curY + 1, _height - 1);
+		int16 startX = MAX<int16>(curX - 1, 0);
+		int16 startY = MAX<int16>(curY - 1, 0);
+
+		for (int16 px = startX; px <= endX; px++) {
+			for (int16 py = startY; py <= endY; py++) {
+				if (px != curX || py != curY) {
+					uint16 wei = abs(px - curX) + abs(py - curY);
+
+					if (inCorridor && !_clusterInCorridor[(px / kClusterSize) + (py / kClusterSize) * _clusterWidth])
+						continue;
+
+					if (isWalkable(px, py)) { // walkable ?
+						int32 curPNode = px + py * _width;
+						uint32 sum = getCost(curNode) + wei * (1 + (isLikelyWalkable(px, py) ? 5 : 0));
+						if (sum > (uint32)0xFFFF) {
+							warning("PathFinding::findPath sum exceeds maximum representable!");
+							sum = (uint32)0xFFFF;
+						}
+						uint16 cost = getCost(curPNode);
+						if (cost > sum || !cost) {
+							setCost(curPNode, sum);
+							uint32 newWeight = sum + abs(destx - px) + abs(desty - py);
+							if (newWeight > (uint32)0xFFFF) {
+								warning("PathFinding::findPath newWeight exceeds maximum representable!");
+								newWeight = (uint16)0xFFFF;
+							}
+							// Among equally good nodes, go on with the closest to the destination
+							_heap->push(px, py, newWeight, abs(destx - px) + abs(desty - py));
+						}
+					}
+				}
+			}
+		}
+	}
+
+	return getCost(destx + desty * _width) != 0;
+}
+
+bool PathFinding::lineIsLikelyWalkable(int16 x, int16 y, int16 x2, int16 y2) {
+	uint32 bx = x << 16;
+	int32 dx = x2 - x;
+	uint32 by = y << 16;
+	int32 dy = y2 - y;
+	uint32 adx = abs(dx);
+	uint32 ady = abs(dy);
+	int32 t = 0;
+	if (adx <= ady)
+		t = ady;
+	else
+		t = adx;
+
+	int32 cdx = (dx << 16) / t;
+	int32 cdy = (dy << 16) / t;
+
+	for (int32 i = t; i > 0; i--) {
+		if (!isWalkable(bx >> 16, by >> 16) || !isLikelyWalkable(bx >> 16, by >> 16))
+			return false;
+		bx += cdx;
+		by += cdy;
+	}
+	return true;
+}
+
+void PathFinding::smoothPath(Common::Array<Common::Point> &path) {
+	// The path runs from the destination back to the start. Each point is
+	// joined by a straight line to the farthest point further down the path
+	// that can be seen from it, without going by the characters either.
+	const int32 count = path.size();
+	if (count < 3)
+		return;
+
+	Common::Array<Common::Point> smoothed;
+	smoothed.reserve(count);
+
+	int32 from = count - 1;
+	while (from > 0) {
+		int32 to = from - 1;
+		for (int32 step = 32; step > 0; step >>= 1) {
+			while (to - step >= 0 && lineIsLikelyWalkable(path[from].x, path[from].y, path[to - step].x, path[to - step].y))
+				to -= step;
+		}
+
+		// The points of the line, the same way walkLine() puts them
+		const int16 x = path[from].x;
+		const int16 y = path[from].y;
+		const int16 x2 = path[to].x;
+		const int16 y2 = path[to].y;
+		uint32 bx = x << 16;
+		uint32 by = y << 16;
+		int32 t = MAX<int32>(abs(x2 - x), abs(y2 - y));
+		int32 cdx = ((x2 - x) << 16) / t;
+		int32 cdy = ((y2 - y) << 16) / t;
+		for (int32 i = t; i > 0; i--) {
+			smoothed.push_back(Common::Point(bx >> 16, by >> 16));
+			bx += cdx;
+			by += cdy;
+		}
+
+		from = to;
+	}
+	smoothed.push_back(path[0]);
+
+	path.clear();
+	for (int32 i = smoothed.size() - 1; i >= 0; i--)
+		path.push_back(smoothed[i]);
+}
+
 void PathFinding::addBlockingRect(int16 x1, int16 y1, int16 x2, int16 y2) {
 	debugC(1, kDebugPath, "addBlockingRect(%d, %d, %d, %d)", x1, y1, x2, y2);
 	if (_numBlockingRects >= kMaxBlockingRects) {
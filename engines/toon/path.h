@@ -42,7 +42,11 @@ public:
 	PathFindingHeap();
 	~PathFindingHeap();
 
-	void push(int16 x, int16 y, uint16 weight);
+	/**
+	 * Nodes come out by lowest weight, and among those by lowest tie, which can
+	 * for example favour the nodes closer to the goal.
+	 */
+	void push(int16 x, int16 y, uint16 weight, uint16 tie = 0);
 	void pop(int16 *x, int16 *y, uint16 *weight);
 	void init(int32 size);
 	void clear();
@@ -53,6 +57,9 @@ private:
 	struct HeapDataGrid {
 		int16 _x, _y;
 		uint16 _weight;
+		uint16 _tie;
+
+		uint32 getKey() const { return ((uint32)_weight << 16) | _tie; }
 	};
 
 	HeapDataGrid *_data;
@@ -86,14 +93,47 @@ public:
 private:
 	static const uint8 kMaxBlockingRects = 16;
 
+	// Side of the square clusters the mask is split into for the coarse search
+	static const int16 kClusterSize = 16;
+
 	Picture *_currentMask;
 
 	PathFindingHeap *_heap;
 
+	// Path costs, only valid where _sqGeneration matches _generation
 	uint16 *_sq;
+	uint16 *_sqGeneration;
+	uint16 _generation;
 	int16 _width;
 	int16 _height;
 
+	// Walkable areas of the mask, 0 where it is not walkable
+	uint16 *_areas;
+	bool _areasValid;
+
+	// Walkable area in each cluster, 0 if there is none and kMixedCluster if
+	// there are several, and the clusters the current search may use
+	static const uint16 kMixedCluster = 0xFFFF;
+	int16 _clusterWidth;
+	int16 _clusterHeight;
+	uint16 *_clusterArea;
+	bool *_clusterInCorridor;
+	uint16 *_clusterCost;
+	PathFindingHeap *_clusterHeap;
+	uint32 _maskRevision;
+
+	void buildClusters();
+	bool findCorridor(int16 x, int16 y, int16 destX, int16 destY, int16 margin);
+	bool searchPath(int16 x, int16 y, int16 destX, int16 destY, bool inCorridor);
+	void smoothPath(Common::Array<Common::Point> &path);
+	bool lineIsLikelyWalkable(int16 x, int16 y, int16 x2, int16 y2);
+
+	uint16 getCost(int32 node) const { return _sqGeneration[node] == _generation ? _sq[node] : 0; }
+	void setCost(int32 node, uint16 cost) {
+		_sq[node] = cost;
+		_sqGeneration[node] = _generation;
+	}
+
 	Common::Array<Common::Point> _tempPath;
 
 	int16 _blockingRects[kMaxBlockingRects][5];
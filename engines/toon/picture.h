@@ -57,6 +57,9 @@ public:
 	int16 getWidth() const { return _width; }
 	int16 getHeight() const { return _height; }
 
+	/** Changes every time the picture is loaded or drawn on as a mask. */
+	uint32 getRevision() const { return _revision; }
+
 protected:
 	int16 _width;
 	int16 _height;
@@ -64,6 +67,7 @@ protected:
 	uint8 *_palette; // need to be copied at 3-387
 	int32 _paletteEntries;
 	bool _useFullPalette;
+	uint32 _revision;
 
 	ToonEngine *_vm;
 };
@@ -72,7 +72,7 @@ static void drawThreads() {
 		ImGui::Text("# threads: %u", threads.size());
 		ImGui::Separator();
 
-		if (ImGui::BeginTable("Threads", 7, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg)) {
+		if (ImGui::BeginTable("Threads", 10, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg)) {
 			ImGui::TableSetupColumn("Id");
 			ImGui::TableSetupColumn("Name");
 			ImGui::TableSetupColumn("Type");
@@ -80,6 +80,9 @@ static void drawThreads() {
 			ImGui::TableSetupColumn("Src");
 			ImGui::TableSetupColumn("Line");
 			ImGui::TableSetupColumn("Upd. Time");
+			ImGui::TableSetupColumn("Resumes");
+			ImGui::TableSetupColumn("Max Time");
+			ImGui::TableSetupColumn("Total Time");
 			ImGui::TableHeadersRow();
 
 			for (const auto &thread : threads) {
@@ -108,6 +111,12 @@ static void drawThreads() {
 				}
 				ImGui::TableNextColumn();
 				ImGui::Text("%u", thread->_lastUpdateTime);
+				ImGui::TableNextColumn();
+				ImGui::Text("%u", thread->_resumeCount);
+				ImGui::TableNextColumn();
+				ImGui::Text("%u", thread->_maxResumeTime);
+				ImGui::TableNextColumn();
+				ImGui::Text("%u", thread->_totalResumeTime);
 			}
 			ImGui::EndTable();
 		}
@@ -550,6 +559,7 @@ static void drawGeneral() {
 
 	ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
 	ImGui::Text("Draw time: %u ms", g_twp->_stats.drawTime);
+	ImGui::Text("Draw calls: %u", g_twp->_stats.drawCalls);
 	ImGui::Text("Update time: %u ms", g_twp->_stats.totalUpdateTime);
 	ImGui::Text("  Update room time: %u ms", g_twp->_stats.updateRoomTime);
 	ImGui::Text("  Update tasks time: %u ms", g_twp->_stats.updateTasksTime);
@@ -218,6 +218,7 @@ void Gfx::init() {
 }
 
 void Gfx::clear(const Color &color) {
+	flush();
 	glClearColor(color.rgba.r, color.rgba.g, color.rgba.b, color.rgba.a);
 	glClear(GL_COLOR_BUFFER_BIT);
 }
@@ -244,6 +245,7 @@ void Gfx::drawLinesLoop(Vertex *vertices, int count, const Math::Matrix4 &trsf)
 }
 
 void Gfx::drawPrimitives(uint32 primitivesType, Vertex *vertices, int v_size, const Math::Matrix4 &trsf, Texture *texture) {
+	flush();
 	if (v_size > 0) {
 		_texture = texture ? texture : &_emptyTexture;
 		GL_CALL(glBindTexture(GL_TEXTURE_2D, _texture->id));
@@ -264,6 +266,7 @@ void Gfx::drawPrimitives(uint32 primitivesType, Vertex *vertices, int v_size, co
 		Math::Matrix4 m = getFinalTransform(trsf);
 		_shader->_shader.setUniform("u_transform", m);
 		GL_CALL(glDrawArrays((GLenum)primitivesType, 0, v_size));
+		_drawCalls++;
 		_shader->_shader.unbind();
 
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -277,6 +280,11 @@ void Gfx::drawPrimitives(uint32 primitivesType, Vertex *vertices, int v_size, co
 }
 
 void Gfx::drawPrimitives(uint32 primitivesType, Vertex *vertices, int v_size, uint32 *indices, int i_size, const Math::Matrix4 &trsf, Texture *texture) {
+	flush();
+	drawElements(primitivesType, vertices, v_size, indices, i_size, trsf, texture);
+}
+
+void Gfx::drawElements(uint32 primitivesType, Vertex *vertices, int v_size, uint32 *indices, int i_size, const Math::Matrix4 &trsf, Texture *texture) {
 	if (i_size > 0) {
 		int num = _shader->getNumTextures();
 		if (num == 0) {
@@ -315,6 +323,7 @@ void Gfx::drawPrimitives(uint32 primitivesType, Vertex *vertices, int v_size, ui
 		_shader->_shader.setUniform("u_transform", getFinalTransform(trsf));
 		_shader->applyUniforms();
 		GL_CALL(glDrawElements(primitivesType, i_size, GL_UNSIGNED_INT, NULL));
+		_drawCalls++;
 		_shader->_shader.unbind();
 
 		glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -362,14 +371,44 @@ void Gfx::drawSprite(const Common::Rect &textRect, Texture &texture, const Color
 	uint32 quadIndices[] = {
 		0, 1, 3,
 		1, 2, 3};
-	draw(vertices, 4, quadIndices, 6, trsf, &texture);
+
+	// Other shaders can have their own textures and uniforms, draw these sprites directly
+	if (_shader != &_defaultShader) {
+		draw(vertices, 4, quadIndices, 6, trsf, &texture);
+		return;
+	}
+
+	if (_batchTexture.id != texture.id)
+		flush();
+	_batchTexture = texture;
+
+	const uint32 base = _batchVertices.size();
+	for (int i = 0; i < 4; i++) {
+		Math::Vector3d p(vertices[i].pos.getX(), vertices[i].pos.getY(), 0.f);
+		trsf.transform(&p, true);
+		vertices[i].pos = Math::Vector2d(p.x(), p.y());
+		_batchVertices.push_back(vertices[i]);
+	}
+	for (int i = 0; i < 6; i++)
+		_batchIndices.push_back(base + quadIndices[i]);
 }
 
 void Gfx::drawSprite(Texture &texture, const Color &color, const Math::Matrix4 &trsf, bool flipX, bool flipY) {
 	drawSprite(Common::Rect(texture.width, texture.height), texture, color, trsf, flipX, flipY);
 }
 
+void Gfx::flush() {
+	if (_batchIndices.empty())
+		return;
+
+	drawElements(GL_TRIANGLES, _batchVertices.data(), _batchVertices.size(), _batchIndices.data(), _batchIndices.size(), Math::Matrix4(), &_batchTexture);
+	// Keep the storage for the next batches
+	_batchVertices.resize(0);
+	_batchIndices.resize(0);
+}
+
 void Gfx::camera(const Math::Vector2d &size) {
+	flush();
 	_cameraSize = size;
 	_mvp = ortho(0.f, size.getX(), 0.f, size.getY(), -1.f, 1.f);
 }
@@ -379,10 +418,13 @@ Math::Vector2d Gfx::camera() const {
 }
 
 void Gfx::use(Shader *shader) {
+	if ((shader ? shader : &_defaultShader) != _shader)
+		flush();
 	_shader = shader ? shader : &_defaultShader;
 }
 
 void Gfx::setRenderTarget(RenderTexture *target) {
+	flush();
 	if (!target) {
 		glBindFramebuffer(GL_FRAMEBUFFER, _oldFbo);
 		int w = g_twp->_system->getWidth();
@@ -184,9 +184,15 @@ public:
 	void drawSprite(const Common::Rect &textRect, Texture &texture, const Color &color = Color(), const Math::Matrix4 &trsf = Math::Matrix4(), bool flipX = false, bool flipY = false);
 	void drawSprite(Texture &texture, const Color &color = Color(), const Math::Matrix4 &trsf = Math::Matrix4(), bool flipX = false, bool flipY = false);
 
+	// Draws the sprites batched by drawSprite(), this is done before any other drawing or state change
+	void flush();
+	uint32 getDrawCalls() const { return _drawCalls; }
+	void resetDrawCalls() { _drawCalls = 0; }
+
 private:
 	Math::Matrix4 getFinalTransform(const Math::Matrix4 &trsf);
 	void noTexture();
+	void drawElements(uint32 primitivesType, Vertex *vertices, int v_size, uint32 *indices, int i_size, const Math::Matrix4 &trsf, Texture *texture);
 
 private:
 	Texture _emptyTexture;
@@ -199,6 +205,12 @@ private:
 	Textures _textures;
 	Texture *_texture = nullptr;
 	int _oldFbo = 0;
+	// Consecutive sprites drawn with the default shader and the same texture,
+	// already transformed to be drawn in one call
+	Common::Array<Vertex> _batchVertices;
+	Common::Array<uint32> _batchIndices;
+	Texture _batchTexture;
+	uint32 _drawCalls = 0;
 };
 } // namespace Twp
 
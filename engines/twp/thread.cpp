@@ -46,7 +46,12 @@ void ThreadBase::suspend() {
 
 void ThreadBase::resume() {
 	if (!isDead() && isSuspended()) {
+		const uint32 startTime = g_system->getMillis();
 		sq_wakeupvm(getThread(), SQFalse, SQFalse, SQTrue, SQFalse);
+		const uint32 time = g_system->getMillis() - startTime;
+		_resumeCount++;
+		_maxResumeTime = MAX(_maxResumeTime, time);
+		_totalResumeTime += time;
 	}
 }
 
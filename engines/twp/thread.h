@@ -67,6 +67,10 @@ public:
 	bool _paused = false;
 	bool _pauseable = false;
 	uint32 _lastUpdateTime = 0;
+	// Time spent in the script when it's resumed, for the debug tools
+	uint32 _resumeCount = 0;
+	uint32 _maxResumeTime = 0;
+	uint32 _totalResumeTime = 0;
 
 protected:
 	int _id = 0;
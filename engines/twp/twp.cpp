@@ -819,6 +819,7 @@ void TwpEngine::draw(RenderTexture *outTexture) {
 
 	// imgui render
 	_gfx.use(nullptr);
+	_gfx.flush();
 	_system->updateScreen();
 }
 
@@ -1323,6 +1324,8 @@ Common::Error TwpEngine::run() {
 		const uint32 startDrawTime = _system->getMillis();
 		draw();
 		_stats.drawTime = _system->getMillis() - startDrawTime;
+		_stats.drawCalls = _gfx.getDrawCalls();
+		_gfx.resetDrawCalls();
 		_cursor.update();
 
 		// Delay for a bit. All events loops should have a delay
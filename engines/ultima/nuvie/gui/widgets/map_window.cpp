@@ -961,7 +961,8 @@ inline void MapWindow::drawActor(const Actor *actor) {
 }
 
 void MapWindow::drawObjs() {
-//FIXME: we need to make this more efficient.
+	// The object lists are looked up once for all the passes below
+	collectVisibleObjLists();
 
 	drawObjSuperBlock(true, false); //draw force lower objects
 	drawObjSuperBlock(false, false); //draw lower objects
@@ -992,7 +993,7 @@ inline void MapWindow::drawLensAnim() {
 	}
 }
 
-void MapWindow::drawObjSuperBlock(bool draw_lowertiles, bool toptile) {
+void MapWindow::collectVisibleObjLists() {
 	uint16 stop_x, stop_y;
 
 	if (cur_x < 0)
@@ -1005,18 +1006,23 @@ void MapWindow::drawObjSuperBlock(bool draw_lowertiles, bool toptile) {
 	else
 		stop_y = cur_y;
 
+	m_VisibleObjLists.resize(0);
 	for (sint16 y = cur_y + win_height; y >= stop_y; y--) {
 		for (sint16 x = cur_x + win_width; x >= stop_x; x--) {
 			U6LList *obj_list = obj_manager->get_obj_list(x, y, cur_level);
-			if (obj_list) {
-				for (U6Link *link = obj_list->start(); link != nullptr; link = link->next) {
-					Obj *obj = (Obj *)link->data;
-					drawObj(obj, draw_lowertiles, toptile);
-				}
-			}
+			if (obj_list)
+				m_VisibleObjLists.push_back(obj_list);
 		}
 	}
+}
 
+void MapWindow::drawObjSuperBlock(bool draw_lowertiles, bool toptile) {
+	for (U6LList *obj_list : m_VisibleObjLists) {
+		for (U6Link *link = obj_list->start(); link != nullptr; link = link->next) {
+			Obj *obj = (Obj *)link->data;
+			drawObj(obj, draw_lowertiles, toptile);
+		}
+	}
 }
 
 inline void MapWindow::drawObj(const Obj *obj, bool draw_lowertiles, bool toptile) {
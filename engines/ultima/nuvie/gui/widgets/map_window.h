@@ -144,6 +144,7 @@ class MapWindow: public GUI_Widget {
 	bool draw_garg_lens_anim;
 // Std::vector<TileInfo> m_ViewableObjTiles; // shouldn't need this for in_town checks
 	Std::vector<TileInfo> m_ViewableMapTiles;
+	Std::vector<U6LList *> m_VisibleObjLists; // object lists of the visible tiles, in drawing order
 
 	bool lighting_update_required;
 
@@ -338,6 +339,7 @@ protected:
 	void drawActors();
 	void drawAnims(bool top_anims);
 	void drawObjs();
+	void collectVisibleObjLists();
 	void drawObjSuperBlock(bool draw_lowertiles, bool toptile);
 	inline void drawObj(const Obj *obj, bool draw_lowertiles, bool toptile);
 	inline void drawTile(const Tile *tile, uint16 x, uint16 y, bool toptile, bool use_tile_data = false);
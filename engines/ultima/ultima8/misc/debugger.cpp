@@ -44,6 +44,7 @@
 #include "ultima/ultima8/misc/id_man.h"
 #include "ultima/ultima8/misc/util.h"
 #include "ultima/ultima8/usecode/uc_machine.h"
+#include "ultima/ultima8/usecode/uc_process.h"
 #include "ultima/ultima8/usecode/bit_set.h"
 #include "ultima/ultima8/world/current_map.h"
 #include "ultima/ultima8/world/world.h"
@@ -154,6 +155,7 @@ Debugger::Debugger() : GUI::Debugger() {
 	registerCmd("UCMachine::traceClass", WRAP_METHOD(Debugger, cmdTraceClass));
 	registerCmd("UCMachine::traceAll", WRAP_METHOD(Debugger, cmdTraceAll));
 	registerCmd("UCMachine::stopTrace", WRAP_METHOD(Debugger, cmdStopTrace));
+	registerCmd("UCMachine::busyProcesses", WRAP_METHOD(Debugger, cmdBusyProcesses));
 
 	registerCmd("FastAreaVisGump::toggle", WRAP_METHOD(Debugger, cmdToggleFastArea));
 	registerCmd("InverterProcess::invertScreen", WRAP_METHOD(Debugger, cmdInvertScreen));
@@ -1493,6 +1495,38 @@ bool Debugger::cmdStopTrace(int argc, const char **argv) {
 	return true;
 }
 
+static bool compareInstructionCounts(const UCProcess *p1, const UCProcess *p2) {
+	return p1->getInstructionCount() > p2->getInstructionCount();
+}
+
+bool Debugger::cmdBusyProcesses(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("Usage: UCMachine::busyProcesses [<count>]\n");
+		return true;
+	}
+
+	uint count = argc == 2 ? strtol(argv[1], 0, 0) : 10;
+
+	Common::Array<UCProcess *> procs;
+	Kernel *kern = Kernel::get_instance();
+	for (ProcessIterator it = kern->_processes.begin(); it != kern->_processes.end(); ++it) {
+		UCProcess *p = dynamic_cast<UCProcess *>(*it);
+		if (p && p->getInstructionCount())
+			procs.push_back(p);
+	}
+	Common::sort(procs.begin(), procs.end(), compareInstructionCounts);
+
+	// The counts start again from zero, so that the next call shows the
+	// processes which were busy in between
+	debugPrintf("Usecode instructions run since the last busyProcesses:\n");
+	for (uint i = 0; i < procs.size(); i++) {
+		if (i < count)
+			debugPrintf("%8u: %s\n", procs[i]->getInstructionCount(), procs[i]->dumpInfo().c_str());
+		procs[i]->resetInstructionCount();
+	}
+	return true;
+}
+
 bool Debugger::cmdVerifyQuit(int argc, const char **argv) {
 	QuitGump::verifyQuit();
 	return false;
@@ -135,6 +135,7 @@ private:
 	bool cmdTraceClass(int argc, const char **argv);
 	bool cmdTraceAll(int argc, const char **argv);
 	bool cmdStopTrace(int argc, const char **argv);
+	bool cmdBusyProcesses(int argc, const char **argv);
 
 	// Miscellaneous
 	bool cmdToggleFastArea(int argc, const char **argv);
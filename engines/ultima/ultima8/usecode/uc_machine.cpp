@@ -173,6 +173,7 @@ void UCMachine::execProcess(UCProcess *p) {
 		//! guard against other error conditions
 
 		uint8 opcode = cs->readByte();
+		p->_instructionCount++;
 
 #ifdef DEBUG_USECODE
 		char op_info[32];
@@ -393,13 +394,12 @@ void UCMachine::execProcess(UCProcess *p) {
 				        _intrinsics[func] == UCMachine::I_true) {
 					warning("Unhandled intrinsic %u \'%s\'? called", func, _convUse->intrinsics()[func]);
 				}
-				uint8 *argbuf = new uint8[arg_bytes];
+				// arg_bytes is a byte, so the arguments always fit
+				uint8 argbuf[256];
 				p->_stack.pop(argbuf, arg_bytes);
 				p->_stack.addSP(-arg_bytes); // don't really pop the args
 
 				p->_temp32 = _intrinsics[func](argbuf, arg_bytes);
-
-				delete[] argbuf;
 			}
 
 			// WORKAROUND: In U8, the flag 'startedConvo' [0000 01] which acts
@@ -30,13 +30,14 @@ namespace Ultima8 {
 DEFINE_RUNTIME_CLASSTYPE_CODE(UCProcess)
 
 UCProcess::UCProcess() : Process(), _classId(0xFFFF), _ip(0xFFFF),
-		_bp(0x0000), _temp32(0) { // !! fixme
+		_bp(0x0000), _temp32(0), _instructionCount(0) { // !! fixme
 	_usecode = GameData::get_instance()->getMainUsecode();
 }
 
 UCProcess::UCProcess(uint16 classid, uint16 offset, uint32 this_ptr,
 					 int thissize, const uint8 *args, int argsize)
-	: Process(), _classId(0xFFFF), _ip(0xFFFF), _bp(0x0000), _temp32(0) {
+	: Process(), _classId(0xFFFF), _ip(0xFFFF), _bp(0x0000), _temp32(0),
+	  _instructionCount(0) {
 	_usecode = GameData::get_instance()->getMainUsecode();
 
 	load(classid, offset, this_ptr, thissize, args, argsize);
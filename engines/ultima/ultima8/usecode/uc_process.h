@@ -56,6 +56,15 @@ public:
 		return _classId;
 	}
 
+	//! The number of instructions run since the count was last reset
+	uint32 getInstructionCount() const {
+		return _instructionCount;
+	}
+
+	void resetInstructionCount() {
+		_instructionCount = 0;
+	}
+
 	Common::String dumpInfo() const override;
 
 	bool loadData(Common::ReadStream *rs, uint32 version);
@@ -77,6 +86,9 @@ protected:
 
 	uint32 _temp32;
 
+	// instructions run, for the debugger. Not saved
+	uint32 _instructionCount;
+
 	// data stack
 	UCStack _stack;
 
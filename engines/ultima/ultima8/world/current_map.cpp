@@ -1031,6 +1031,16 @@ bool CurrentMap::sweepTest(const Point3 &start, const Point3 &end,
 		   vel[0] - ext[0], vel[1] - ext[1], vel[2] - ext[2],
 		   vel[0] + ext[0], vel[1] + ext[1], vel[2] + ext[2]);
 
+	// Box covering the whole sweep. Items clear of it can't be hit, so they
+	// skip the sweep maths. The margin keeps items that only touch it.
+	const int32 sweepMargin = 2;
+	const int32 sweepMinX = MIN(start.x, end.x) - dims[0] - sweepMargin;
+	const int32 sweepMaxX = MAX(start.x, end.x) + sweepMargin;
+	const int32 sweepMinY = MIN(start.y, end.y) - dims[1] - sweepMargin;
+	const int32 sweepMaxY = MAX(start.y, end.y) + sweepMargin;
+	const int32 sweepMinZ = MIN(start.z, end.z) - sweepMargin;
+	const int32 sweepMaxZ = MAX(start.z, end.z) + dims[2] + sweepMargin;
+
 	Std::list<SweepItem>::iterator sw_it;
 	if (hit) sw_it = hit->end();
 
@@ -1061,6 +1071,11 @@ bool CurrentMap::sweepTest(const Point3 &start, const Point3 &end,
 				other[2] = opt.z;
 				other_item->getFootpadWorld(oext[0], oext[1], oext[2]);
 
+				if (other[0] < sweepMinX || other[0] - oext[0] > sweepMaxX ||
+				    other[1] < sweepMinY || other[1] - oext[1] > sweepMaxY ||
+				    other[2] + oext[2] < sweepMinZ || other[2] > sweepMaxZ)
+					continue;
+
 				// If the objects overlapped at the start, ignore collision.
 				// The -1 and +1 portions are to still consider collisions
 				// for items which were merely touching at the start for all
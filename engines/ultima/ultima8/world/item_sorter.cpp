@@ -45,9 +45,12 @@ namespace Ultima8 {
 static const uint32 TRANSPARENT_COLOR = TEX32_PACK_RGBA(0x7F, 0x00, 0x00, 0x7F);
 static const uint32 HIGHLIGHT_COLOR = TEX32_PACK_RGBA(0xFF, 0xFF, 0x00, 0x1F);
 
+// Size of the screenspace grid cells as a shift, 64 pixels
+static const int CELL_SHIFT = 6;
+
 ItemSorter::ItemSorter(int capacity) :
 	_shapes(nullptr), _clipWindow(0, 0, 0, 0), _items(nullptr), _itemsTail(nullptr),
-	_itemsUnused(nullptr), _painted(nullptr), _camSx(0), _camSy(0),
+	_itemsUnused(nullptr), _painted(nullptr), _cellCols(0), _cellRows(0), _camSx(0), _camSy(0),
 	_sortLimit(0), _sortLimitChanged(false) {
 	int i = capacity;
 	while (i--) {
@@ -88,6 +91,14 @@ void ItemSorter::BeginDisplayList(const Rect &clipWindow, const Point3 &cam) {
 	_itemsTail = nullptr;
 	_painted = nullptr;
 
+	// Empty the grid, keeping the memory of the cells
+	_cellCols = MAX(1, (clipWindow.right - clipWindow.left + (1 << CELL_SHIFT) - 1) >> CELL_SHIFT);
+	_cellRows = MAX(1, (clipWindow.bottom - clipWindow.top + (1 << CELL_SHIFT) - 1) >> CELL_SHIFT);
+	if (_cells.size() != (uint)(_cellCols * _cellRows))
+		_cells.resize(_cellCols * _cellRows);
+	for (uint i = 0; i < _cells.size(); i++)
+		_cells[i].resize(0);
+
 	// Screenspace bounding box bottom x coord (RNB x coord)
 	int32 camSx = (cam.x - cam.y) / 4;
 	// Screenspace bounding box bottom extent  (RNB y coord)
@@ -187,62 +198,79 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 	// are never deleted
 	si->_depends.clear();
 
-	// Iterate the list and compare _shapes
-
-	// Ok,
+	// The list is sorted, so the items with higher z than us are at its end.
+	// Get the insert point... which is before the first of them
 	SortItem *addpoint = nullptr;
-	for (SortItem *si2 = _items; si2 != nullptr; si2 = si2->_next) {
-		// Get the insert point... which is before the first item that has higher z than us
-		if (!addpoint && si->listLessThan(*si2))
-			addpoint = si2;
+	for (SortItem *si2 = _itemsTail; si2 != nullptr && si->listLessThan(*si2); si2 = si2->_prev)
+		addpoint = si2;
+
+	// Compare with the items in the grid cells we cover. An item spanning
+	// several of our cells is only checked in the first cell we both cover.
+	int32 cellLeft, cellTop, cellRight, cellBottom;
+	getCellRange(si->_sr, cellLeft, cellTop, cellRight, cellBottom);
+	for (int32 cy = cellTop; cy <= cellBottom && !si->_occluded; cy++) {
+		for (int32 cx = cellLeft; cx <= cellRight && !si->_occluded; cx++) {
+			const Common::Array<SortItem *> &cell = _cells[cy * _cellCols + cx];
+			for (uint i = 0; i < cell.size() && !si->_occluded; i++) {
+				SortItem *si2 = cell[i];
+				if (si2->_occluded)
+					continue;
 
-		if (si2->_occluded)
-			continue;
+				int32 left2, top2, right2, bottom2;
+				getCellRange(si2->_sr, left2, top2, right2, bottom2);
+				if (cx != MAX(cellLeft, left2) || cy != MAX(cellTop, top2))
+					continue;
 
 #ifdef SORTITEM_OCCLUSION_EXPERIMENTAL
-		// Find adjoining rects for better occlusion
-		if (si->_occl && si2->_occl && si->_z == si2->_z) {
-			// Does this share an edge?
-			if (si->_y == si2->_y && si->_yFar == si2->_yFar) {
-				if (si->_xLeft == si2->_x) {
-					si->_xAdjoin = si2;
-				} else if (si->_x == si2->_xLeft) {
-					si2->_xAdjoin = si;
-				}
-			}
-			else if (si->_x == si2->_x && si->_xLeft == si2->_xLeft) {
-				if (si->_yFar == si2->_y) {
-					si->_yAdjoin = si2;
-				} else if (si->_y == si2->_yFar) {
-					si2->_yAdjoin = si;
+				// Find adjoining rects for better occlusion
+				if (si->_occl && si2->_occl && si->_z == si2->_z) {
+					// Does this share an edge?
+					if (si->_y == si2->_y && si->_yFar == si2->_yFar) {
+						if (si->_xLeft == si2->_x) {
+							si->_xAdjoin = si2;
+						} else if (si->_x == si2->_xLeft) {
+							si2->_xAdjoin = si;
+						}
+					}
+					else if (si->_x == si2->_x && si->_xLeft == si2->_xLeft) {
+						if (si->_yFar == si2->_y) {
+							si->_yAdjoin = si2;
+						} else if (si->_y == si2->_yFar) {
+							si2->_yAdjoin = si;
+						}
+					}
 				}
-			}
-		}
 #endif // SORTITEM_OCCLUSION_EXPERIMENTAL
 
-		// Attempt to find paint dependency order
-		if (si->overlap(*si2)) {
-			if (si->below(*si2)) {
-				if (si2->_occl && si2->occludes(*si)) {
-					// No need to do any more checks, this isn't visible
-					si->_occluded = true;
-					break;
-				} else {
-					// si1 is behind si2, so add it to si2's dependency list
-					si2->_depends.insert_sorted(si);
-				}
-			} else {
-				if (si->_occl && si->occludes(*si2)) {
-					// Occluded, but we can't remove it from the list
-					si2->_occluded = true;
-				} else {
-					// si2 is behind si1, so add it to si1's dependency list
-					si->_depends.insert_sorted(si2);
+				// Attempt to find paint dependency order
+				if (si->overlap(*si2)) {
+					if (si->below(*si2)) {
+						if (si2->_occl && si2->occludes(*si)) {
+							// No need to do any more checks, this isn't visible
+							si->_occluded = true;
+						} else {
+							// si1 is behind si2, so add it to si2's dependency list
+							si2->_depends.insert_sorted(si);
+						}
+					} else {
+						if (si->_occl && si->occludes(*si2)) {
+							// Occluded, but we can't remove it from the list
+							si2->_occluded = true;
+						} else {
+							// si2 is behind si1, so add it to si1's dependency list
+							si->_depends.insert_sorted(si2);
+						}
+					}
 				}
 			}
 		}
 	}
 
+	for (int32 cy = cellTop; cy <= cellBottom; cy++) {
+		for (int32 cx = cellLeft; cx <= cellRight; cx++)
+			_cells[cy * _cellCols + cx].push_back(si);
+	}
+
 	// Add it to the list
 	_itemsUnused = _itemsUnused->_next;
 
@@ -269,6 +297,14 @@ void ItemSorter::AddItem(const Point3 &pt, uint32 shapeNum, uint32 frame_num, ui
 	}
 }
 
+void ItemSorter::getCellRange(const Rect &r, int32 &left, int32 &top, int32 &right, int32 &bottom) const {
+	// Rects which only touch share a cell, for the adjoin checks
+	left = CLIP<int32>((r.left - _clipWindow.left) >> CELL_SHIFT, 0, _cellCols - 1);
+	top = CLIP<int32>((r.top - _clipWindow.top) >> CELL_SHIFT, 0, _cellRows - 1);
+	right = CLIP<int32>((r.right - _clipWindow.left) >> CELL_SHIFT, 0, _cellCols - 1);
+	bottom = CLIP<int32>((r.bottom - _clipWindow.top) >> CELL_SHIFT, 0, _cellRows - 1);
+}
+
 void ItemSorter::AddItem(const Item *add) {
 	AddItem(add->getLerped(), add->getShape(), add->getFrame(),
 			add->getFlags(), add->getExtFlags(), add->getObjId());
@@ -22,6 +22,7 @@
 #ifndef ULTIMA8_WORLD_ITEMSORTER_H
 #define ULTIMA8_WORLD_ITEMSORTER_H
 
+#include "common/array.h"
 #include "ultima/ultima8/misc/rect.h"
 
 namespace Ultima {
@@ -42,6 +43,11 @@ class ItemSorter {
 	SortItem    *_itemsUnused;
 	SortItem    *_painted;
 
+	// Screenspace grid of the items in each cell, to only compare the items
+	// which are close to each other
+	Common::Array<Common::Array<SortItem *> > _cells;
+	int32       _cellCols, _cellRows;
+
 	int32       _camSx, _camSy;
 	int32       _sortLimit;
 	bool        _sortLimitChanged;
@@ -70,6 +76,7 @@ public:
 	void IncSortLimit(int count);
 
 private:
+	void getCellRange(const Rect &r, int32 &left, int32 &top, int32 &right, int32 &bottom) const;
 	bool PaintSortItem(RenderSurface *surf, SortItem *si, bool showFootpad);
 };
 
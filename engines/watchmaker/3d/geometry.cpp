@@ -2812,6 +2812,7 @@ void t3dCheckMaterialVB(MaterialPtr mat) {
 		mat->VBO->_buffer.push_back(*mat->VertsList[i]);
 		//memcpy(gv, mat->VertsList[i], sizeof(gVertex));
 	}
+	mat->VBO->invalidate();
 
 //	rUnlockVertexPtr(mat->VB);
 }
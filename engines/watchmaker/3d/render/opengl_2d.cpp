@@ -166,22 +166,29 @@ void renderTexture(WGame &game, gTexture &bitmap, Common::Rect srcRect, Common::
 	float leftDst = ((dstRect.left == 0 ? 0 : ((double)dstRect.left) / viewport.width()) * 2.0) - 1.0;
 	float rightDst = ((dstRect.right == 0 ? 0 : ((double)dstRect.right) / viewport.width()) * 2.0) - 1.0;
 
-	glBegin(GL_QUADS);
-	glColor3f(1.0, 1.0, 1.0);
-
-	glTexCoord2f(leftSrc, bottomSrc); // Bottom Left
-	glVertex3f(leftDst, bottomDst, 0.0f);
-
-	glTexCoord2f(rightSrc, bottomSrc); // Bottom Right
-	glVertex3f(rightDst, bottomDst, 0.0f);
+	// Bottom left, bottom right, top left, top right
+	const GLfloat vertices[] = {
+		leftDst, bottomDst, 0.0f,
+		rightDst, bottomDst, 0.0f,
+		leftDst, topDst, 0.0f,
+		rightDst, topDst, 0.0f
+	};
+	const GLfloat texCoords[] = {
+		leftSrc, bottomSrc,
+		rightSrc, bottomSrc,
+		leftSrc, topSrc,
+		rightSrc, topSrc
+	};
 
-	glTexCoord2f(rightSrc, topSrc); // Top Right
-	glVertex3f(rightDst, topDst, 0.0f);
-
-	glTexCoord2f(leftSrc, topSrc); // Top Left
-	glVertex3f(leftDst, topDst, 0.0f);
+	glColor3f(1.0, 1.0, 1.0);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glVertexPointer(3, GL_FLOAT, 0, vertices);
+	glTexCoordPointer(2, GL_FLOAT, 0, texCoords);
+	glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
 
-	glEnd();
 	glFlush();
 	checkGlError("Exiting renderTexture");
 }
@@ -24,20 +24,46 @@
 
 #if defined(USE_OPENGL_GAME)
 
+#include "graphics/opengl/context.h"
 #include "graphics/opengl/system_headers.h"
 #include "math/glmath.h"
 
-#include "math/glmath.h"
-
 namespace Watchmaker {
 
 OpenGLRenderer *g_renderer = nullptr;
 
-void OpenGLRenderer::drawIndexedPrimitivesVBO(PrimitiveType primitiveType, Common::SharedPtr<VertexBuffer> VBO, int firstVertex, int numVertices, Common::Array<uint16> faces, uint32 numFaces) {
+static bool useBufferObjects() {
+	return OpenGLContext.type != OpenGL::kContextGL || OpenGLContext.isGLVersionOrHigher(1, 5);
+}
+
+// Binds the retained buffer object of vb, uploading it first if the vertices changed
+// since the last draw. Returns the base pointer to pass to the gl*Pointer calls.
+static const byte *bindVertexBuffer(VertexBuffer &vb) {
+	if (!useBufferObjects())
+		return (const byte *)vb._buffer.data();
+
+	if (!vb._glBuffer) {
+		glGenBuffers(1, (GLuint *)&vb._glBuffer);
+		vb._dirty = true;
+	}
+	glBindBuffer(GL_ARRAY_BUFFER, vb._glBuffer);
+	if (vb._dirty) {
+		// Room geometry is uploaded once; anything refilled after that is animated.
+		glBufferData(GL_ARRAY_BUFFER, vb._buffer.size() * sizeof(gVertex), vb._buffer.data(), vb._uploads ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
+		vb._uploads++;
+		vb._dirty = false;
+	}
+	return nullptr;
+}
+
+void OpenGLRenderer::drawIndexedPrimitivesVBO(PrimitiveType primitiveType, const Common::SharedPtr<VertexBuffer> &VBO, int firstVertex, int numVertices, const Common::Array<uint16> &faces, uint32 numFaces) {
 	assert(numFaces <= faces.size());
 
 	assert(primitiveType == PrimitiveType::TRIANGLE);
 
+	if (!numFaces || VBO->_buffer.empty())
+		return;
+
 	float fNearPlane = 1.0f;//5000.0f;
 	float fFarPlane = 15000.0f;
 	float width = 1024;
@@ -57,23 +83,23 @@ void OpenGLRenderer::drawIndexedPrimitivesVBO(PrimitiveType primitiveType, Commo
 
 	glMatrixMode(GL_MODELVIEW);
 	glPushMatrix();
+	// The vertices are stored as loaded, flip z here instead of per vertex
+	glScalef(1.0f, 1.0f, -1.0f);
 
 	glEnable(GL_TEXTURE_2D);
+	glColor3f(1.0f, 1.0f, 1.0f);
+
+	const byte *base = bindVertexBuffer(*VBO);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+	glVertexPointer(3, GL_FLOAT, sizeof(gVertex), base + offsetof(gVertex, x));
+	glTexCoordPointer(2, GL_FLOAT, sizeof(gVertex), base + offsetof(gVertex, u1));
+	glDrawElements(GL_TRIANGLES, numFaces, GL_UNSIGNED_SHORT, faces.data());
+	glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
+	if (useBufferObjects())
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
 
-	glBegin(GL_TRIANGLES);
-	for (uint32 i = 0; i < numFaces; i++) {
-		uint16 index = faces[i];
-		assert(index <= VBO->_buffer.size());
-		auto &vertex = VBO->_buffer[index];
-		//warning("%d/%d %d: [%f, %f, %f], [%f, %f], [%f, %f]", i, numFaces, index, vertex.x, vertex.y, vertex.z, vertex.u1, vertex.v1, vertex.u2, vertex.v2);
-		//glColor3f((float)i/numFaces, 1.0, 0.0);
-		glColor3f(1.0f, 1.0f, 1.0f);
-		glTexCoord2f(vertex.u1, vertex.v1);
-		glVertex3f(vertex.x, vertex.y, -vertex.z);
-	}
-	glEnd();
-
-	glFlush();
 	glPopMatrix();
 	glMatrixMode(GL_PROJECTION);
 	glPopMatrix();
@@ -82,14 +108,15 @@ void OpenGLRenderer::drawIndexedPrimitivesVBO(PrimitiveType primitiveType, Commo
 
 void OpenGLRenderer::drawPrimitives(PrimitiveType primitiveType, Vertex *vertices, int numPrimitives) {
 	assert(primitiveType == PrimitiveType::TRIANGLE);
-	glBegin(GL_TRIANGLES);
-	for (int i = 0; i < numPrimitives; i++) {
-		auto &vertex = vertices[i];
-		glColor3f(1.0, 1.0, 1.0);
-		glVertex3f(vertex.sx, vertex.sy, -vertex.sz);
-	}
-	glEnd();
-	glFlush();
+	glMatrixMode(GL_MODELVIEW);
+	glPushMatrix();
+	glScalef(1.0f, 1.0f, -1.0f);
+	glColor3f(1.0, 1.0, 1.0);
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glVertexPointer(3, GL_FLOAT, sizeof(Vertex), &vertices[0].sx);
+	glDrawArrays(GL_TRIANGLES, 0, numPrimitives);
+	glDisableClientState(GL_VERTEX_ARRAY);
+	glPopMatrix();
 }
 void OpenGLRenderer::drawIndexedPrimitivesVBO(PrimitiveType primitiveType, int VBO, int firstVertex, int numVertices, uint16 *faces, uint32 numFaces) {
 	//warning("TODO: Implement drawIndexedPrimitivesVBO");
@@ -55,9 +55,34 @@ int cmpbb(const void *a, const void *b) {
 	else if (v1->Texture2 > v2->Texture2) return 1;
 	else if (v1->Texture1 < v2->Texture1) return -1;
 	else if (v1->Texture1 > v2->Texture1) return 1;
+	else if (v1->ViewMatrixNum < v2->ViewMatrixNum) return -1;
+	else if (v1->ViewMatrixNum > v2->ViewMatrixNum) return 1;
+	else if (v1->VBO.get() < v2->VBO.get()) return -1;
+	else if (v1->VBO.get() > v2->VBO.get()) return 1;
 	else return 0;
 }
 
+// Merges consecutive blocks sharing material, lightmap, view matrix and VB
+// into a single draw. The list has to be sorted with cmpbb first.
+void rMergeBatchBlocks(gBatchBlock *bbl, unsigned int num) {
+	gBatchBlock *last = nullptr;
+
+	for (unsigned int i = 0; i < num; i++) {
+		gBatchBlock *bb = &bbl[i];
+		if (bb->Texture1 < 0) continue;
+
+		if (last && (last->VBO == bb->VBO) && (last->ViewMatrixNum == bb->ViewMatrixNum) &&
+		        (last->Texture1 == bb->Texture1) && (last->Texture2 == bb->Texture2) &&
+		        (last->Flags1 == bb->Flags1) && (last->Flags2 == bb->Flags2)) {
+			last->FacesList.push_back(bb->FacesList);
+			bb->FacesList.clear();
+			bb->Texture1 = -3;
+			bb->Texture2 = -3;
+		} else
+			last = bb;
+	}
+}
+
 /* -----------------31/05/99 10.12-------------------
  *          Attiva o disattiva lo ZBuffer
  * --------------------------------------------------*/
@@ -148,6 +173,7 @@ void RenderGeometry() {
 	LastViewMatrixNum = LastTexture1 = LastTexture2 = -2;
 	bb = &BatchBlockList[0];
 	qsort(bb, NumBatchBlocks, sizeof(gBatchBlock), cmpbb);
+	rMergeBatchBlocks(bb, NumBatchBlocks);
 	for (uint i = 0; i < NumBatchBlocks; i++, bb++) {
 		if (bb->Texture1 < 0) continue;
 
@@ -255,6 +281,7 @@ void RenderGeometry() {
 	LastViewMatrixNum = LastTexture1 = LastTexture2 = -2;
 	bb = &BatchBlockListSpecial[0];
 	qsort(bb, NumBatchBlocksSpecial, sizeof(gBatchBlock), cmpbb);
+	rMergeBatchBlocks(bb, NumBatchBlocksSpecial);
 	for (uint i = 0; i < NumBatchBlocksSpecial; i++, bb++) {
 		if (bb->Texture1 < 0) continue;
 		if (!(bb->Flags1 & T3D_MATERIAL_CLIPMAP) ||
@@ -138,8 +138,12 @@ VertexBuffer rCreateVertexBuffer(unsigned int num) {
 }
 
 bool rDeleteVertexBuffer(VertexBuffer &vb) {
-	warning("STUBBED: rDeleteVertexBuffer");
-	return false;
+	if (vb._glBuffer) {
+		glDeleteBuffers(1, (GLuint *)&vb._glBuffer);
+		vb._glBuffer = 0;
+	}
+	vb.invalidate();
+	return true;
 }
 
 void rGetScreenInfos(unsigned int *width, unsigned int *height, unsigned int *bpp) {
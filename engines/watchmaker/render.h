@@ -83,6 +83,14 @@ namespace Watchmaker {
 struct VertexBuffer {
 	// Just cheat for now, and do this offline.
 	Common::Array<gVertex> _buffer;
+	// Retained GPU copy of _buffer, only uploaded again after invalidate()
+	uint32 _glBuffer = 0;
+	uint32 _uploads = 0;
+	bool _dirty = true;
+
+	void invalidate() {
+		_dirty = true;
+	}
 };
 
 struct SHADOW {
@@ -52,6 +52,7 @@ BaseRenderOSystem::BaseRenderOSystem(BaseGame *inGame) : BaseRenderer(inGame) {
 	_renderSurface = new Graphics::Surface();
 	_blankSurface = new Graphics::Surface();
 	_lastFrameIter = _renderQueue.end();
+	_ticketIndexDirty = true;
 	_needsFlip = true;
 	_skipThisFrame = false;
 
@@ -165,6 +166,7 @@ bool BaseRenderOSystem::flip() {
 
 		// Reset ticketing state
 		_lastFrameIter = _renderQueue.end();
+		_ticketIndexDirty = true;
 		RenderQueueIterator it;
 		for (it = _renderQueue.begin(); it != _renderQueue.end(); ++it) {
 			(*it)->_wantsDraw = false;
@@ -204,6 +206,7 @@ bool BaseRenderOSystem::flip() {
 		_needsFlip = false;
 	}
 	_lastFrameIter = _renderQueue.end();
+	_ticketIndexDirty = true;
 
 	g_system->updateScreen();
 
@@ -302,22 +305,10 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 
 	if (owner) { // Fade-tickets are owner-less
 		RenderTicket compare(owner, nullptr, srcRect, dstRect, transform);
-		RenderQueueIterator it = _lastFrameIter;
-		++it;
-		// Avoid calling end() and operator* every time, when potentially going through
-		// LOTS of tickets.
-		RenderQueueIterator endIterator = _renderQueue.end();
-		RenderTicket *compareTicket = nullptr;
-		for (; it != endIterator; ++it) {
-			compareTicket = *it;
-			if (*(compareTicket) == compare && compareTicket->_isValid) {
-				if (_disableDirtyRects) {
-					drawFromSurface(compareTicket);
-				} else {
-					drawFromQueuedTicket(it);
-				}
-				return;
-			}
+		RenderQueueIterator it;
+		if (findQueuedTicket(compare, it)) {
+			drawFromQueuedTicket(it);
+			return;
 		}
 	}
 	RenderTicket *ticket = new RenderTicket(owner, surf, srcRect, dstRect, transform);
@@ -330,6 +321,43 @@ void BaseRenderOSystem::drawSurface(BaseSurfaceOSystem *owner, const Graphics::S
 	}
 }
 
+bool BaseRenderOSystem::findQueuedTicket(const RenderTicket &compare, RenderQueueIterator &it) {
+	// Everything after _lastFrameIter is a ticket of last frame that wasn't
+	// drawn again yet. Most frames repeat the calls of the last one, so
+	// check the next ticket in order first.
+	it = _lastFrameIter;
+	++it;
+	if (it != _renderQueue.end() && **it == compare && (*it)->_isValid)
+		return true;
+
+	if (_ticketIndexDirty) {
+		_ticketIndex.clear();
+		for (RenderQueueIterator i = _renderQueue.begin(); i != _renderQueue.end(); ++i) {
+			TicketKey key = { (*i)->_owner, (*i)->_dstRect.left, (*i)->_dstRect.top };
+			QueuedTicket queued = { *i, i };
+			_ticketIndex.getOrCreateVal(key).push_back(queued);
+		}
+		_ticketIndexDirty = false;
+	}
+
+	TicketKey key = { compare._owner, compare._dstRect.left, compare._dstRect.top };
+	TicketIndex::iterator entry = _ticketIndex.find(key);
+	if (entry == _ticketIndex.end())
+		return false;
+
+	// Tickets drawn this frame may have been moved in the queue, which makes
+	// their iterators stale, but those are never candidates again
+	for (QueuedTicket &queued : entry->_value) {
+		RenderTicket *ticket = queued._ticket;
+		if (!ticket->_wantsDraw && ticket->_isValid && *ticket == compare) {
+			it = queued._it;
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void BaseRenderOSystem::invalidateTicket(RenderTicket *renderTicket) {
 	addDirtyRect(renderTicket->_dstRect);
 	renderTicket->_isValid = false;
@@ -583,6 +611,7 @@ void BaseRenderOSystem::endSaveLoad() {
 	// so just skip this single frame.
 	_skipThisFrame = true;
 	_lastFrameIter = _renderQueue.end();
+	_ticketIndexDirty = true;
 
 	_renderSurface->fillRect(Common::Rect(0, 0, _renderSurface->w, _renderSurface->h), _renderSurface->format.ARGBToColor(255, 0, 0, 0));
 	g_system->copyRectToScreen((byte *)_renderSurface->getPixels(), _renderSurface->pitch, 0, 0, _renderSurface->w, _renderSurface->h);
@@ -32,6 +32,8 @@
 
 #include "common/rect.h"
 #include "common/list.h"
+#include "common/array.h"
+#include "common/hashmap.h"
 
 #include "graphics/surface.h"
 #include "graphics/transform_struct.h"
@@ -129,9 +131,37 @@ private:
 	void drawFromSurface(RenderTicket *ticket);
 	// Dirty-rects:
 	void drawFromSurface(RenderTicket *ticket, Common::Rect *dstRect, Common::Rect *clipRect);
+	/**
+	 * Find the ticket from last frame that matches a draw call, if it wasn't reused yet.
+	 * @param compare ticket describing the draw call.
+	 * @param it set to the matching ticket in the queue when one is found.
+	 */
+	bool findQueuedTicket(const RenderTicket &compare, RenderQueueIterator &it);
 	Common::Rect *_dirtyRect;
 	Common::List<RenderTicket *> _renderQueue;
 
+	// Tickets of last frame by owner and position, in queue order, to match
+	// draw calls without walking the whole queue. Rebuilt when a frame starts.
+	struct TicketKey {
+		BaseSurfaceOSystem *_owner;
+		int16 _x;
+		int16 _y;
+
+		bool operator==(const TicketKey &k) const { return _owner == k._owner && _x == k._x && _y == k._y; }
+	};
+	struct TicketKeyHash {
+		uint operator()(const TicketKey &k) const {
+			return (uint)(size_t)k._owner ^ (((uint)(uint16)k._x * 31 + (uint)(uint16)k._y) * 2654435761U);
+		}
+	};
+	struct QueuedTicket {
+		RenderTicket *_ticket;
+		RenderQueueIterator _it;
+	};
+	typedef Common::HashMap<TicketKey, Common::Array<QueuedTicket>, TicketKeyHash> TicketIndex;
+	TicketIndex _ticketIndex;
+	bool _ticketIndexDirty;
+
 	bool _needsFlip;
 	RenderQueueIterator _lastFrameIter;
 	Common::Rect _renderRect;
@@ -56,6 +56,7 @@ ScScript::ScScript(BaseGame *inGame, ScEngine *engine) : BaseClass(inGame) {
 	_currentLine = 0;
 
 	_symbols = nullptr;
+	_symbolNames = nullptr;
 	_numSymbols = 0;
 
 	_engine = engine;
@@ -183,9 +184,11 @@ bool ScScript::initTables() {
 
 	_numSymbols = getDWORD();
 	_symbols = new char*[_numSymbols];
+	_symbolNames = new Common::String[_numSymbols];
 	for (uint32 i = 0; i < _numSymbols; i++) {
 		uint32 index = getDWORD();
 		_symbols[index] = getString();
+		_symbolNames[index] = _symbols[index];
 	}
 
 	// load functions table
@@ -394,7 +397,9 @@ void ScScript::cleanup() {
 	if (_symbols) {
 		delete[] _symbols;
 	}
+	delete[] _symbolNames;
 	_symbols = nullptr;
+	_symbolNames = nullptr;
 	_numSymbols = 0;
 
 	if (_globals && !_thread) {
@@ -571,9 +576,9 @@ bool ScScript::executeInstruction() {
 		_operand->setNULL();
 		dw = getDWORD();
 		if (_scopeStack->_sP < 0) {
-			_globals->setProp(_symbols[dw], _operand);
+			_globals->setProp(_symbolNames[dw], _operand);
 		} else {
-			_scopeStack->getTop()->setProp(_symbols[dw], _operand);
+			_scopeStack->getTop()->setProp(_symbolNames[dw], _operand);
 		}
 
 		break;
@@ -583,9 +588,9 @@ bool ScScript::executeInstruction() {
 		dw = getDWORD();
 		/*      char *temp = _symbols[dw]; // TODO delete */
 		// only create global var if it doesn't exist
-		if (!_engine->_globals->propExists(_symbols[dw])) {
+		if (!_engine->_globals->propExists(_symbolNames[dw])) {
 			_operand->setNULL();
-			_engine->_globals->setProp(_symbols[dw], _operand, false, inst == II_DEF_CONST_VAR);
+			_engine->_globals->setProp(_symbolNames[dw], _operand, false, inst == II_DEF_CONST_VAR);
 		}
 		break;
 	}
@@ -742,7 +747,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_VAR: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getVar(_symbolNames[getDWORD()]);
 		// Disabled in original code
 		/*if (false && var->_type==VAL_OBJECT || var->_type == VAL_NATIVE) {
 			_operand->setReference(var);
@@ -754,15 +759,14 @@ bool ScScript::executeInstruction() {
 	}
 
 	case II_PUSH_VAR_REF: {
-		ScValue *var = getVar(_symbols[getDWORD()]);
+		ScValue *var = getVar(_symbolNames[getDWORD()]);
 		_operand->setReference(var);
 		_stack->push(_operand);
 		break;
 	}
 
 	case II_POP_VAR: {
-		char *varName = _symbols[getDWORD()];
-		ScValue *var = getVar(varName);
+		ScValue *var = getVar(_symbolNames[getDWORD()]);
 		if (var) {
 			ScValue *val = _stack->pop();
 			if (!val) {
@@ -813,7 +817,7 @@ bool ScScript::executeInstruction() {
 		break;
 
 	case II_PUSH_THIS:
-		_operand->setReference(getVar(_symbols[getDWORD()]));
+		_operand->setReference(getVar(_symbolNames[getDWORD()]));
 		_thisStack->push(_operand);
 		break;
 
@@ -1173,6 +1177,10 @@ uint32 ScScript::getMethodPos(const Common::String &name) const {
 
 //////////////////////////////////////////////////////////////////////////
 ScValue *ScScript::getVar(char *name) {
+	return getVar(Common::String(name));
+}
+
+ScValue *ScScript::getVar(const Common::String &name) {
 	ScValue *ret = nullptr;
 
 	// scope locals
@@ -1198,7 +1206,7 @@ ScValue *ScScript::getVar(char *name) {
 
 	if (ret == nullptr) {
 		//RuntimeError("Variable '%s' is inaccessible in the current block. Consider changing the script.", name);
-		_gameRef->LOG(0, "Warning: variable '%s' is inaccessible in the current block. Consider changing the script (script:%s, line:%d)", name, _filename, _currentLine);
+		_gameRef->LOG(0, "Warning: variable '%s' is inaccessible in the current block. Consider changing the script (script:%s, line:%d)", name.c_str(), _filename, _currentLine);
 		ScValue *val = new ScValue(_gameRef);
 		ScValue *scope = _scopeStack->getTop();
 		if (scope) {
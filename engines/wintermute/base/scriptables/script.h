@@ -79,6 +79,7 @@ public:
 	TScriptState _state;
 	TScriptState _origState;
 	ScValue *getVar(char *name);
+	ScValue *getVar(const Common::String &name);
 	uint32 getFuncPos(const Common::String &name);
 	uint32 getEventPos(const Common::String &name) const;
 	uint32 getMethodPos(const Common::String &name) const;
@@ -151,6 +152,8 @@ public:
 	bool externalCall(ScStack *stack, ScStack *thisStack, ScScript::TExternalFunction *function);
 private:
 	char **_symbols;
+	// The symbols as strings, so that variable lookups don't build one each time
+	Common::String *_symbolNames;
 	uint32 _numSymbols;
 	TFunctionPos *_functions;
 	TMethodPos *_methods;
@@ -50,6 +50,8 @@ ScValue::ScValue(BaseGame *inGame) : BaseClass(inGame) {
 	_valFloat = 0.0f;
 	_valNative = nullptr;
 	_valString = nullptr;
+	_stringBuffer = nullptr;
+	_stringBufferSize = 0;
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
@@ -65,6 +67,8 @@ ScValue::ScValue(BaseGame *inGame, bool val) : BaseClass(inGame) {
 	_valFloat = 0.0f;
 	_valNative = nullptr;
 	_valString = nullptr;
+	_stringBuffer = nullptr;
+	_stringBufferSize = 0;
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
@@ -80,6 +84,8 @@ ScValue::ScValue(BaseGame *inGame, int32 val) : BaseClass(inGame) {
 	_valBool = false;
 	_valNative = nullptr;
 	_valString = nullptr;
+	_stringBuffer = nullptr;
+	_stringBufferSize = 0;
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
@@ -95,6 +101,8 @@ ScValue::ScValue(BaseGame *inGame, double val) : BaseClass(inGame) {
 	_valBool = false;
 	_valNative = nullptr;
 	_valString = nullptr;
+	_stringBuffer = nullptr;
+	_stringBufferSize = 0;
 	_valRef = nullptr;
 	_persistent = false;
 	_isConstVar = false;
@@ -105,6 +113,8 @@ ScValue::ScValue(BaseGame *inGame, double val) : BaseClass(inGame) {
 ScValue::ScValue(BaseGame *inGame, const char *val) : BaseClass(inGame) {
 	_type = VAL_STRING;
 	_valString = nullptr;
+	_stringBuffer = nullptr;
+	_stringBufferSize = 0;
 	setStringVal(val);
 
 	_valBool = false;
@@ -121,10 +131,6 @@ ScValue::ScValue(BaseGame *inGame, const char *val) : BaseClass(inGame) {
 void ScValue::cleanup(bool ignoreNatives) {
 	deleteProps();
 
-	if (_valString) {
-		delete[] _valString;
-	}
-
 	if (!ignoreNatives) {
 		if (_valNative && !_persistent) {
 			_valNative->_refCount--;
@@ -153,16 +159,22 @@ void ScValue::cleanup(bool ignoreNatives) {
 //////////////////////////////////////////////////////////////////////////
 ScValue::~ScValue() {
 	cleanup();
+
+	delete[] _stringBuffer;
 }
 
 
 //////////////////////////////////////////////////////////////////////////
 ScValue *ScValue::getProp(const char *name) {
+	return getProp(Common::String(name));
+}
+
+ScValue *ScValue::getProp(const Common::String &name) {
 	if (_type == VAL_VARIABLE_REF) {
 		return _valRef->getProp(name);
 	}
 
-	if (_type == VAL_STRING && strcmp(name, "Length") == 0) {
+	if (_type == VAL_STRING && name == "Length") {
 		_gameRef->_scValue->_type = VAL_INT;
 
 		if (_gameRef->_textEncoding == TEXT_ANSI) {
@@ -209,13 +221,17 @@ bool ScValue::deleteProp(const char *name) {
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAsConst) {
+	return setProp(Common::String(name), val, copyWhole, setAsConst);
+}
+
+bool ScValue::setProp(const Common::String &name, ScValue *val, bool copyWhole, bool setAsConst) {
 	if (_type == VAL_VARIABLE_REF) {
 		return _valRef->setProp(name, val);
 	}
 
 	bool ret = STATUS_FAILED;
 	if (_type == VAL_NATIVE && _valNative) {
-		ret = _valNative->scSetProperty(name, val);
+		ret = _valNative->scSetProperty(name.c_str(), val);
 	}
 
 	if (DID_FAIL(ret)) {
@@ -260,6 +276,10 @@ bool ScValue::setProp(const char *name, ScValue *val, bool copyWhole, bool setAs
 
 //////////////////////////////////////////////////////////////////////////
 bool ScValue::propExists(const char *name) {
+	return propExists(Common::String(name));
+}
+
+bool ScValue::propExists(const Common::String &name) {
 	if (_type == VAL_VARIABLE_REF) {
 		return _valRef->propExists(name);
 	}
@@ -448,16 +468,23 @@ void ScValue::setString(const Common::String &val) {
 
 //////////////////////////////////////////////////////////////////////////
 void ScValue::setStringVal(const char *val) {
-	delete[] _valString;
-	_valString = nullptr;
-
 	if (val == nullptr) {
+		_valString = nullptr;
 		return;
 	}
 
 	size_t valSize = strlen(val) + 1;
-	_valString = new char[valSize];
-	Common::strcpy_s(_valString, valSize, val);
+	if (valSize > _stringBufferSize) {
+		// val may point into the old buffer
+		char *newBuffer = new char[valSize];
+		Common::strcpy_s(newBuffer, valSize, val);
+		delete[] _stringBuffer;
+		_stringBuffer = newBuffer;
+		_stringBufferSize = valSize;
+	} else {
+		memmove(_stringBuffer, val, valSize);
+	}
+	_valString = _stringBuffer;
 }
 
 
@@ -833,6 +860,13 @@ bool ScValue::persist(BasePersistenceManager *persistMgr) {
 		}
 	}
 
+	if (!persistMgr->getIsSaving()) {
+		// Loaded values come from the dynamic constructor, the loaded
+		// string becomes the buffer
+		_stringBuffer = _valString;
+		_stringBufferSize = _valString ? strlen(_valString) + 1 : 0;
+	}
+
 	/* // TODO: Convert to Debug-statements.
 	FILE* f = fopen("c:\\val.log", "a+");
 	switch(_type)
@@ -52,6 +52,7 @@ public:
 	void setValue(ScValue *val);
 	bool _persistent;
 	bool propExists(const char *name);
+	bool propExists(const Common::String &name);
 	void copy(ScValue *orig, bool copyWhole = false);
 	void setStringVal(const char *val);
 	TValType getType();
@@ -81,7 +82,9 @@ public:
 	bool isInt();
 	bool isObject();
 	bool setProp(const char *name, ScValue *val, bool copyWhole = false, bool setAsConst = false);
+	bool setProp(const Common::String &name, ScValue *val, bool copyWhole = false, bool setAsConst = false);
 	ScValue *getProp(const char *name);
+	ScValue *getProp(const Common::String &name);
 	BaseScriptable *_valNative;
 	ScValue *_valRef;
 private:
@@ -89,6 +92,10 @@ private:
 	int32 _valInt;
 	double _valFloat;
 	char *_valString;
+	// Storage of _valString, kept across cleanup() so that assigning strings
+	// to a value, like the stack does all the time, rarely allocates
+	char *_stringBuffer;
+	size_t _stringBufferSize;
 public:
 	TValType _type;
 	ScValue(BaseGame *inGame);
@@ -34,6 +34,9 @@ RenderTable::RenderTable(uint numColumns, uint numRows)
 	assert(numRows != 0 && numColumns != 0);
 
 	_internalBuffer = new Common::Point[numRows * numColumns];
+	_sourceIndexes = new uint32[numRows * numColumns];
+	for (uint32 i = 0; i < numRows * numColumns; i++)
+		_sourceIndexes[i] = i;
 
 	memset(&_panoramaOptions, 0, sizeof(_panoramaOptions));
 	memset(&_tiltOptions, 0, sizeof(_tiltOptions));
@@ -41,6 +44,7 @@ RenderTable::RenderTable(uint numColumns, uint numRows)
 
 RenderTable::~RenderTable() {
 	delete[] _internalBuffer;
+	delete[] _sourceIndexes;
 }
 
 void RenderTable::setRenderState(RenderState newState) {
@@ -89,16 +93,11 @@ void RenderTable::mutateImage(uint16 *sourceBuffer, uint16 *destBuffer, uint32 d
 	for (int16 y = subRect.top; y < subRect.bottom; ++y) {
 		uint32 sourceOffset = y * _numColumns;
 
-		for (int16 x = subRect.left; x < subRect.right; ++x) {
-			uint32 normalizedX = x - subRect.left;
-			uint32 index = sourceOffset + x;
+		const uint32 *sourceIndexes = _sourceIndexes + sourceOffset + subRect.left;
+		uint16 *dest = destBuffer + destOffset;
 
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
-
-			destBuffer[destOffset + normalizedX] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
-		}
+		for (int16 x = 0; x < subRect.width(); ++x)
+			dest[x] = sourceBuffer[sourceIndexes[x]];
 
 		destOffset += destWidth;
 	}
@@ -114,13 +113,7 @@ void RenderTable::mutateImage(Graphics::Surface *dstBuf, Graphics::Surface *srcB
 		uint32 sourceOffset = y * _numColumns;
 
 		for (int16 x = 0; x < srcBuf->w; ++x) {
-			uint32 index = sourceOffset + x;
-
-			// RenderTable only stores offsets from the original coordinates
-			uint32 sourceYIndex = y + _internalBuffer[index].y;
-			uint32 sourceXIndex = x + _internalBuffer[index].x;
-
-			destBuffer[destOffset] = sourceBuffer[sourceYIndex * _numColumns + sourceXIndex];
+			destBuffer[destOffset] = sourceBuffer[_sourceIndexes[sourceOffset + x]];
 			destOffset++;
 		}
 	}
@@ -143,14 +136,7 @@ void RenderTable::generateRenderTable() {
 }
 
 void RenderTable::generatePanoramaLookupTable() {
-	for (uint y = 0; y < _numRows; y++) {
-		for (uint x = 0; x < _numColumns; x++) {
-			uint32 index = y * _numColumns + x;
-			_internalBuffer[index].x = 0;
-			_internalBuffer[index].y = 0;
-		}
-	}
-
+	// Every entry is set below
 	float halfWidth = (float)_numColumns / 2.0f;
 	float halfHeight = (float)_numRows / 2.0f;
 
@@ -178,6 +164,7 @@ void RenderTable::generatePanoramaLookupTable() {
 			// Only store the (x,y) offsets instead of the absolute positions
 			_internalBuffer[index].x = xInCylinderCoords - x;
 			_internalBuffer[index].y = yInCylinderCoords - y;
+			_sourceIndexes[index] = yInCylinderCoords * _numColumns + xInCylinderCoords;
 		}
 	}
 }
@@ -213,6 +200,7 @@ void RenderTable::generateTiltLookupTable() {
 			// Only store the (x,y) offsets instead of the absolute positions
 			_internalBuffer[index].x = xInCylinderCoords - x;
 			_internalBuffer[index].y = yInCylinderCoords - y;
+			_sourceIndexes[index] = yInCylinderCoords * _numColumns + xInCylinderCoords;
 		}
 	}
 }
@@ -42,6 +42,8 @@ public:
 private:
 	uint _numColumns, _numRows;
 	Common::Point *_internalBuffer;
+	// The source pixel of each destination pixel, so that mutating an image is a single lookup per pixel
+	uint32 *_sourceIndexes;
 	RenderState _renderState;
 
 	struct {
@@ -659,16 +659,13 @@ gradientFill(PixelType *ptr, int width, int x, int y) {
 	} else if (grad == 3 && ox) {
 		colorFill<PixelType>(ptr, ptr + width, _gradCache[curGrad + 1]);
 	} else {
-		for (int j = x; j < x + width; j++, ptr++) {
-			bool oy = ((j & 1) == 1);
+		// The dithered color only depends on whether the column is odd
+		const PixelType evenColor = ((grad == 2 || grad == 3) && ox) ? _gradCache[curGrad + 1] : _gradCache[curGrad];
+		const PixelType oddColor = (ox || grad == 3) ? _gradCache[curGrad + 1] : _gradCache[curGrad];
+		const PixelType colors[2] = { evenColor, oddColor };
 
-			if ((ox && oy) ||
-				((grad == 2 || grad == 3) && ox && !oy) ||
-				(grad == 3 && oy))
-				*ptr = _gradCache[curGrad + 1];
-			else
-				*ptr = _gradCache[curGrad];
-		}
+		for (int j = x; j < x + width; j++, ptr++)
+			*ptr = colors[j & 1];
 	}
 }
 
@@ -701,17 +698,15 @@ gradientFillClip(PixelType *ptr, int width, int x, int y, int realX, int realY)
 	} else if (grad == 3 && ox) {
 		colorFillClip<PixelType>(ptr, ptr + width, _gradCache[curGrad + 1], realX, realY, _clippingArea);
 	} else {
-		for (int j = x; j < x + width; j++, ptr++) {
-			if (realX + j - x < _clippingArea.left || realX + j - x >= _clippingArea.right) continue;
-			bool oy = ((j & 1) == 1);
-
-			if ((ox && oy) ||
-				((grad == 2 || grad == 3) && ox && !oy) ||
-				(grad == 3 && oy))
-				*ptr = _gradCache[curGrad + 1];
-			else
-				*ptr = _gradCache[curGrad];
-		}
+		const PixelType evenColor = ((grad == 2 || grad == 3) && ox) ? _gradCache[curGrad + 1] : _gradCache[curGrad];
+		const PixelType oddColor = (ox || grad == 3) ? _gradCache[curGrad + 1] : _gradCache[curGrad];
+		const PixelType colors[2] = { evenColor, oddColor };
+
+		// Only go over the columns within the clipping area
+		int start = MAX(_clippingArea.left - realX, 0);
+		int end = MIN(_clippingArea.right - realX, width);
+		for (int j = start; j < end; j++)
+			ptr[j] = colors[(x + j) & 1];
 	}
 }
 
@@ -890,6 +885,54 @@ blendPixelPtr(PixelType *ptr, PixelType color, uint8 alpha) {
 	}
 }
 
+template<typename PixelType>
+void VectorRendererSpec<PixelType>::
+blendFill(PixelType *first, PixelType *last, PixelType color, uint8 alpha) {
+	// The same as blendPixelPtr() on every pixel, with the source split up
+	// once for the whole span, so the loops below can be vectorized.
+	if (alpha == 0 || first >= last) {
+		return;
+	} else if (alpha == 0xff) {
+		colorFill<PixelType>(first, last, (PixelType)(color | _alphaMask));
+	} else if (sizeof(PixelType) == 1) {
+		if (alpha & 0x80)
+			colorFill<PixelType>(first, last, color);
+	} else if (sizeof(PixelType) == 4) {
+		const int sR = (color & _redMask) >> _format.rShift;
+		const int sG = (color & _greenMask) >> _format.gShift;
+		const int sB = (color & _blueMask) >> _format.bShift;
+		const uint rShift = _format.rShift, gShift = _format.gShift, bShift = _format.bShift, aShift = _format.aShift;
+		const PixelType redMask = _redMask, greenMask = _greenMask, blueMask = _blueMask, alphaMask = _alphaMask;
+
+		for (; first < last; ++first) {
+			const PixelType dst = *first;
+			const int dR = (dst & redMask) >> rShift;
+			const int dG = (dst & greenMask) >> gShift;
+			const int dB = (dst & blueMask) >> bShift;
+			const int dA = (dst & alphaMask) >> aShift;
+
+			*first = (((PixelType)(uint8)(dR + (((sR - dR) * alpha) >> 8)) << rShift) & redMask)
+			       | (((PixelType)(uint8)(dG + (((sG - dG) * alpha) >> 8)) << gShift) & greenMask)
+			       | (((PixelType)(uint8)(dB + (((sB - dB) * alpha) >> 8)) << bShift) & blueMask)
+			       | (((PixelType)(uint8)(dA + (((0xff - dA) * alpha) >> 8)) << aShift) & alphaMask);
+		}
+	} else {
+		const int sR = color & _redMask, sG = color & _greenMask, sB = color & _blueMask;
+		const int redMask = _redMask, greenMask = _greenMask, blueMask = _blueMask, alphaMask = _alphaMask;
+
+		for (; first < last; ++first) {
+			const int dst = *first;
+			const int dR = dst & redMask, dG = dst & greenMask, dB = dst & blueMask, dA = dst & alphaMask;
+
+			*first = (PixelType)(
+				(redMask & (dR + (((sR - dR) * alpha) >> 8))) |
+				(greenMask & (dG + (((sG - dG) * alpha) >> 8))) |
+				(blueMask & (dB + (((sB - dB) * alpha) >> 8))) |
+				(alphaMask & (dA + (((alphaMask - dA) * alpha) >> 8))));
+		}
+	}
+}
+
 template<typename PixelType>
 inline void VectorRendererSpec<PixelType>::
 blendPixelPtrClip(PixelType *ptr, PixelType color, uint8 alpha, int x, int y) {
@@ -2009,8 +2052,9 @@ drawBevelSquareAlgClip(int x, int y, int w, int h, int bevel, PixelType top_colo
 		}
 	} else {
 		while (i-- ) {
-			blendFillClip(ptr_left, ptr_left + w, ptr_x, ptr_y, _bgColor, 200);
+			blendFillClip(ptr_left, ptr_left + w, _bgColor, 200, ptr_x, ptr_y);
 			ptr_left += pitch;
+			++ptr_y;
 		}
 	}
 
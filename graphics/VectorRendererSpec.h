@@ -286,21 +286,21 @@ protected:
 	 * @param color Color of the pixel
 	 * @param alpha Alpha intensity of the pixel (0-255)
 	 */
-	inline void blendFill(PixelType *first, PixelType *last, PixelType color, uint8 alpha) {
-		while (first < last)
-			blendPixelPtr(first++, color, alpha);
-	}
+	void blendFill(PixelType *first, PixelType *last, PixelType color, uint8 alpha);
 
 	inline void blendFillClip(PixelType *first, PixelType *last, PixelType color, uint8 alpha, int realX, int realY) {
-		if (_clippingArea.top <= realY && realY < _clippingArea.bottom) {
-			while (first < last) {
-				if (_clippingArea.left <= realX && realX < _clippingArea.right)
-					blendPixelPtr(first++, color, alpha);
-				else
-					++first;
-				++realX;
-			}
+		if (realY < _clippingArea.top || realY >= _clippingArea.bottom)
+			return;
+
+		if (realX < _clippingArea.left) {
+			first += _clippingArea.left - realX;
+			realX = _clippingArea.left;
 		}
+		if (last - first > _clippingArea.right - realX)
+			last = first + (_clippingArea.right - realX);
+
+		if (first < last)
+			blendFill(first, last, color, alpha);
 	}
 
 	void darkenFill(PixelType *first, PixelType *last);
@@ -30,6 +30,7 @@ struct Point;
 }
 
 class BlendBlitUnfilteredTestSuite;
+class MicroBenchmark;
 
 namespace Graphics {
 
@@ -207,6 +208,29 @@ bool crossMaskBlitMap(byte *dst, const byte *src, const byte *mask,
 			   const uint w, const uint h,
 			   const uint bytesPerPixel, const uint32 *map);
 
+/**
+ * SIMD kernels used by crossBlit() and crossBlitMap() for the common
+ * conversions between CLUT8, RGB555, RGB565 and the 8 bits per channel
+ * 32-bit formats, by scaleBlitBilinear() and rotoscaleBlitBilinear()
+ * for 32-bit formats with alpha, and by YUVToRGBManager for YUV444, YUV422
+ * and YUV420. They give the same results as the generic code.
+ */
+enum BlitKernelSet {
+	kBlitKernelsGeneric,
+	kBlitKernelsSSE2,
+	kBlitKernelsAVX2,
+	kBlitKernelsNEON
+};
+
+/**
+ * Use the given kernels instead of the ones picked for the CPU. This is
+ * meant for tests and benchmarks, the caller has to check that the CPU
+ * supports them.
+ *
+ * @return False if the kernels are not built in.
+ */
+bool setBlitKernels(BlitKernelSet set);
+
 bool scaleBlit(byte *dst, const byte *src,
 			   const uint dstPitch, const uint srcPitch,
 			   const uint dstW, const uint dstH,
@@ -292,6 +316,7 @@ private:
 	typedef void(*BlitFunc)(Args &, const TSpriteBlendMode &, const AlphaType &);
 	static BlitFunc blitFunc;
 	friend class ::BlendBlitUnfilteredTestSuite;
+	friend class ::MicroBenchmark;
 	friend class BlendBlitImpl_Default;
 	friend class BlendBlitImpl_NEON;
 	friend class BlendBlitImpl_SSE2;
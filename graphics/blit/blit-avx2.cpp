@@ -321,6 +321,179 @@ void BlendBlit::blitAVX2(Args &args, const TSpriteBlendMode &blendMode, const Al
 	blitT<BlendBlitImpl_AVX2>(args, blendMode, alphaType);
 }
 
+//
+// crossBlit kernels
+//
+
+static FORCEINLINE __m256i avx2_convert8888(__m256i src, const __m128i *srcShifts, const __m128i *dstShifts, uint channels, __m256i alpha) {
+	const __m256i channelMask = _mm256_set1_epi32(0xFF);
+	__m256i out = alpha;
+	for (uint c = 0; c < channels; ++c)
+		out = _mm256_or_si256(out, _mm256_sll_epi32(_mm256_and_si256(_mm256_srl_epi32(src, srcShifts[c]), channelMask), dstShifts[c]));
+	return out;
+}
+
+static FORCEINLINE __m256i avx2_rgb565To8888(__m256i src, const __m128i *dstShifts, __m256i alpha) {
+	const __m256i r5 = _mm256_and_si256(_mm256_srli_epi32(src, 11), _mm256_set1_epi32(0x1F));
+	const __m256i g6 = _mm256_and_si256(_mm256_srli_epi32(src, 5), _mm256_set1_epi32(0x3F));
+	const __m256i b5 = _mm256_and_si256(src, _mm256_set1_epi32(0x1F));
+
+	const __m256i r = _mm256_or_si256(_mm256_slli_epi32(r5, 3), _mm256_srli_epi32(r5, 2));
+	const __m256i g = _mm256_or_si256(_mm256_slli_epi32(g6, 2), _mm256_srli_epi32(g6, 4));
+	const __m256i b = _mm256_or_si256(_mm256_slli_epi32(b5, 3), _mm256_srli_epi32(b5, 2));
+
+	__m256i out = _mm256_or_si256(alpha, _mm256_sll_epi32(r, dstShifts[0]));
+	out = _mm256_or_si256(out, _mm256_sll_epi32(g, dstShifts[1]));
+	return _mm256_or_si256(out, _mm256_sll_epi32(b, dstShifts[2]));
+}
+
+static FORCEINLINE __m256i avx2_8888ToRGB565(__m256i src, const __m128i *srcShifts) {
+	const __m256i r = _mm256_and_si256(_mm256_srl_epi32(src, srcShifts[0]), _mm256_set1_epi32(0xF8));
+	const __m256i g = _mm256_and_si256(_mm256_srl_epi32(src, srcShifts[1]), _mm256_set1_epi32(0xFC));
+	const __m256i b = _mm256_and_si256(_mm256_srl_epi32(src, srcShifts[2]), _mm256_set1_epi32(0xF8));
+	const __m256i out = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(r, 8), _mm256_slli_epi32(g, 3)), _mm256_srli_epi32(b, 3));
+	// Sign extend so the saturating pack keeps the low 16 bits
+	return _mm256_srai_epi32(_mm256_slli_epi32(out, 16), 16);
+}
+
+/** Pack the low 16 bits of two vectors of 32-bit values, in order. */
+static FORCEINLINE __m256i avx2_pack32To16(__m256i lo, __m256i hi) {
+	lo = _mm256_srai_epi32(_mm256_slli_epi32(lo, 16), 16);
+	hi = _mm256_srai_epi32(_mm256_slli_epi32(hi, 16), 16);
+	// The pack works on each 128-bit lane, which mixes up the quarters
+	return _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+uint convertRowRGB555ToRGB565AVX2(uint16 *dst, const uint16 *src, uint w) {
+	const __m256i redMask = _mm256_set1_epi16(0x7C00);
+	const __m256i fiveBits = _mm256_set1_epi16(0x1F);
+
+	uint x = 0;
+	for (; x + 16 <= w; x += 16) {
+		const __m256i in = _mm256_loadu_si256((const __m256i *)(src + x));
+		const __m256i g5 = _mm256_and_si256(_mm256_srli_epi16(in, 5), fiveBits);
+		const __m256i g6 = _mm256_or_si256(_mm256_slli_epi16(g5, 1), _mm256_srli_epi16(g5, 4));
+		__m256i out = _mm256_slli_epi16(_mm256_and_si256(in, redMask), 1);
+		out = _mm256_or_si256(out, _mm256_slli_epi16(g6, 5));
+		out = _mm256_or_si256(out, _mm256_and_si256(in, fiveBits));
+		_mm256_storeu_si256((__m256i *)(dst + x), out);
+	}
+	return x;
+}
+
+uint convertRowRGB565To8888AVX2(uint32 *dst, const uint16 *src, uint w, const int *dstShifts, uint32 alpha) {
+	const __m128i shifts[3] = { _mm_cvtsi32_si128(dstShifts[0]), _mm_cvtsi32_si128(dstShifts[1]), _mm_cvtsi32_si128(dstShifts[2]) };
+	const __m256i alphaV = _mm256_set1_epi32(alpha);
+
+	uint x = 0;
+	for (; x + 16 <= w; x += 16) {
+		const __m256i lo = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(src + x)));
+		const __m256i hi = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(src + x + 8)));
+		_mm256_storeu_si256((__m256i *)(dst + x), avx2_rgb565To8888(lo, shifts, alphaV));
+		_mm256_storeu_si256((__m256i *)(dst + x + 8), avx2_rgb565To8888(hi, shifts, alphaV));
+	}
+	return x;
+}
+
+uint convertRow8888ToRGB565AVX2(uint16 *dst, const uint32 *src, uint w, const int *srcShifts) {
+	const __m128i shifts[3] = { _mm_cvtsi32_si128(srcShifts[0]), _mm_cvtsi32_si128(srcShifts[1]), _mm_cvtsi32_si128(srcShifts[2]) };
+
+	uint x = 0;
+	for (; x + 16 <= w; x += 16) {
+		const __m256i lo = avx2_8888ToRGB565(_mm256_loadu_si256((const __m256i *)(src + x)), shifts);
+		const __m256i hi = avx2_8888ToRGB565(_mm256_loadu_si256((const __m256i *)(src + x + 8)), shifts);
+		_mm256_storeu_si256((__m256i *)(dst + x), _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), _MM_SHUFFLE(3, 1, 2, 0)));
+	}
+	return x;
+}
+
+uint convertRow8888AVX2(uint32 *dst, const uint32 *src, uint w, const int *srcShifts, const int *dstShifts, uint channels, uint32 alpha) {
+	__m128i srcCounts[4], dstCounts[4];
+	for (uint c = 0; c < 4; ++c) {
+		srcCounts[c] = _mm_cvtsi32_si128(srcShifts[c]);
+		dstCounts[c] = _mm_cvtsi32_si128(dstShifts[c]);
+	}
+	const __m256i alphaV = _mm256_set1_epi32(alpha);
+
+	uint x = 0;
+	for (; x + 16 <= w; x += 16) {
+		const __m256i lo = _mm256_loadu_si256((const __m256i *)(src + x));
+		const __m256i hi = _mm256_loadu_si256((const __m256i *)(src + x + 8));
+		_mm256_storeu_si256((__m256i *)(dst + x), avx2_convert8888(lo, srcCounts, dstCounts, channels, alphaV));
+		_mm256_storeu_si256((__m256i *)(dst + x + 8), avx2_convert8888(hi, srcCounts, dstCounts, channels, alphaV));
+	}
+	return x;
+}
+
+uint mapRow16AVX2(uint16 *dst, const byte *src, uint w, const uint32 *map) {
+	uint x = 0;
+	for (; x + 16 <= w; x += 16) {
+		const __m128i in = _mm_loadu_si128((const __m128i *)(src + x));
+		const __m256i lo = _mm256_i32gather_epi32((const int *)map, _mm256_cvtepu8_epi32(in), 4);
+		const __m256i hi = _mm256_i32gather_epi32((const int *)map, _mm256_cvtepu8_epi32(_mm_srli_si128(in, 8)), 4);
+		_mm256_storeu_si256((__m256i *)(dst + x), avx2_pack32To16(lo, hi));
+	}
+	return x;
+}
+
+uint mapRow32AVX2(uint32 *dst, const byte *src, uint w, const uint32 *map) {
+	uint x = 0;
+	for (; x + 8 <= w; x += 8) {
+		const __m128i in = _mm_loadl_epi64((const __m128i *)(src + x));
+		_mm256_storeu_si256((__m256i *)(dst + x), _mm256_i32gather_epi32((const int *)map, _mm256_cvtepu8_epi32(in), 4));
+	}
+	return x;
+}
+
+//
+// Bilinear scaling kernels
+//
+
+// See sse2_expandWeights(), this works within each 128-bit lane
+static FORCEINLINE void avx2_expandWeights(__m256i w, __m256i &lo, __m256i &hi) {
+	w = _mm256_srai_epi32(_mm256_slli_epi32(w, 16), 16);
+	w = _mm256_packs_epi32(w, w);
+	w = _mm256_unpacklo_epi16(w, w);
+	lo = _mm256_unpacklo_epi32(w, w);
+	hi = _mm256_unpackhi_epi32(w, w);
+}
+
+// See sse2_lerp16()
+static FORCEINLINE __m256i avx2_lerp16(__m256i a, __m256i b, __m256i w) {
+	const __m256i d = _mm256_sub_epi16(b, a);
+	const __m256i p = _mm256_add_epi16(_mm256_mulhi_epi16(d, w), _mm256_and_si256(d, _mm256_srai_epi16(w, 15)));
+	return _mm256_add_epi16(a, p);
+}
+
+uint interpolateBilinearAVX2(uint32 *dst, const uint32 *c00, const uint32 *c01, const uint32 *c10, const uint32 *c11, const int *ex, const int *ey, uint n) {
+	const __m256i zero = _mm256_setzero_si256();
+
+	uint i = 0;
+	for (; i + 8 <= n; i += 8) {
+		const __m256i p00 = _mm256_loadu_si256((const __m256i *)(c00 + i));
+		const __m256i p01 = _mm256_loadu_si256((const __m256i *)(c01 + i));
+		const __m256i p10 = _mm256_loadu_si256((const __m256i *)(c10 + i));
+		const __m256i p11 = _mm256_loadu_si256((const __m256i *)(c11 + i));
+
+		__m256i wxLo, wxHi, wyLo, wyHi;
+		avx2_expandWeights(_mm256_loadu_si256((const __m256i *)(ex + i)), wxLo, wxHi);
+		avx2_expandWeights(_mm256_loadu_si256((const __m256i *)(ey + i)), wyLo, wyHi);
+
+		__m256i t1 = avx2_lerp16(_mm256_unpacklo_epi8(p00, zero), _mm256_unpacklo_epi8(p01, zero), wxLo);
+		__m256i t2 = avx2_lerp16(_mm256_unpacklo_epi8(p10, zero), _mm256_unpacklo_epi8(p11, zero), wxLo);
+		const __m256i lo = avx2_lerp16(t1, t2, wyLo);
+
+		t1 = avx2_lerp16(_mm256_unpackhi_epi8(p00, zero), _mm256_unpackhi_epi8(p01, zero), wxHi);
+		t2 = avx2_lerp16(_mm256_unpackhi_epi8(p10, zero), _mm256_unpackhi_epi8(p11, zero), wxHi);
+		const __m256i hi = avx2_lerp16(t1, t2, wyHi);
+
+		// The unpacks and the pack stay within the 128-bit lanes, so the
+		// pixels come out in order
+		_mm256_storeu_si256((__m256i *)(dst + i), _mm256_packus_epi16(lo, hi));
+	}
+	return i;
+}
+
 } // End of namespace Graphics
 
 #if defined(__clang__)
@@ -324,6 +324,158 @@ void BlendBlit::blitNEON(Args &args, const TSpriteBlendMode &blendMode, const Al
 	blitT<BlendBlitImpl_NEON>(args, blendMode, alphaType);
 }
 
+//
+// crossBlit kernels
+//
+
+// vshlq_u32 shifts right for negative counts
+static FORCEINLINE uint32x4_t neon_convert8888(uint32x4_t src, const int32x4_t *srcShifts, const int32x4_t *dstShifts, uint channels, uint32x4_t alpha) {
+	const uint32x4_t channelMask = vdupq_n_u32(0xFF);
+	uint32x4_t out = alpha;
+	for (uint c = 0; c < channels; ++c)
+		out = vorrq_u32(out, vshlq_u32(vandq_u32(vshlq_u32(src, srcShifts[c]), channelMask), dstShifts[c]));
+	return out;
+}
+
+static FORCEINLINE uint32x4_t neon_rgb565To8888(uint32x4_t src, const int32x4_t *dstShifts, uint32x4_t alpha) {
+	const uint32x4_t r5 = vandq_u32(vshrq_n_u32(src, 11), vdupq_n_u32(0x1F));
+	const uint32x4_t g6 = vandq_u32(vshrq_n_u32(src, 5), vdupq_n_u32(0x3F));
+	const uint32x4_t b5 = vandq_u32(src, vdupq_n_u32(0x1F));
+
+	const uint32x4_t r = vorrq_u32(vshlq_n_u32(r5, 3), vshrq_n_u32(r5, 2));
+	const uint32x4_t g = vorrq_u32(vshlq_n_u32(g6, 2), vshrq_n_u32(g6, 4));
+	const uint32x4_t b = vorrq_u32(vshlq_n_u32(b5, 3), vshrq_n_u32(b5, 2));
+
+	uint32x4_t out = vorrq_u32(alpha, vshlq_u32(r, dstShifts[0]));
+	out = vorrq_u32(out, vshlq_u32(g, dstShifts[1]));
+	return vorrq_u32(out, vshlq_u32(b, dstShifts[2]));
+}
+
+static FORCEINLINE uint16x4_t neon_8888ToRGB565(uint32x4_t src, const int32x4_t *srcShifts) {
+	const uint32x4_t r = vandq_u32(vshlq_u32(src, srcShifts[0]), vdupq_n_u32(0xF8));
+	const uint32x4_t g = vandq_u32(vshlq_u32(src, srcShifts[1]), vdupq_n_u32(0xFC));
+	const uint32x4_t b = vandq_u32(vshlq_u32(src, srcShifts[2]), vdupq_n_u32(0xF8));
+	return vmovn_u32(vorrq_u32(vorrq_u32(vshlq_n_u32(r, 8), vshlq_n_u32(g, 3)), vshrq_n_u32(b, 3)));
+}
+
+uint convertRowRGB555ToRGB565NEON(uint16 *dst, const uint16 *src, uint w) {
+	const uint16x8_t redMask = vdupq_n_u16(0x7C00);
+	const uint16x8_t fiveBits = vdupq_n_u16(0x1F);
+
+	uint x = 0;
+	for (; x + 8 <= w; x += 8) {
+		const uint16x8_t in = vld1q_u16((const uint16_t *)(src + x));
+		const uint16x8_t g5 = vandq_u16(vshrq_n_u16(in, 5), fiveBits);
+		const uint16x8_t g6 = vorrq_u16(vshlq_n_u16(g5, 1), vshrq_n_u16(g5, 4));
+		uint16x8_t out = vshlq_n_u16(vandq_u16(in, redMask), 1);
+		out = vorrq_u16(out, vshlq_n_u16(g6, 5));
+		out = vorrq_u16(out, vandq_u16(in, fiveBits));
+		vst1q_u16((uint16_t *)(dst + x), out);
+	}
+	return x;
+}
+
+uint convertRowRGB565To8888NEON(uint32 *dst, const uint16 *src, uint w, const int *dstShifts, uint32 alpha) {
+	const int32x4_t shifts[3] = { vdupq_n_s32(dstShifts[0]), vdupq_n_s32(dstShifts[1]), vdupq_n_s32(dstShifts[2]) };
+	const uint32x4_t alphaV = vdupq_n_u32(alpha);
+
+	uint x = 0;
+	for (; x + 8 <= w; x += 8) {
+		const uint16x8_t in = vld1q_u16((const uint16_t *)(src + x));
+		vst1q_u32((uint32_t *)(dst + x), neon_rgb565To8888(vmovl_u16(vget_low_u16(in)), shifts, alphaV));
+		vst1q_u32((uint32_t *)(dst + x + 4), neon_rgb565To8888(vmovl_u16(vget_high_u16(in)), shifts, alphaV));
+	}
+	return x;
+}
+
+uint convertRow8888ToRGB565NEON(uint16 *dst, const uint32 *src, uint w, const int *srcShifts) {
+	const int32x4_t shifts[3] = { vdupq_n_s32(-srcShifts[0]), vdupq_n_s32(-srcShifts[1]), vdupq_n_s32(-srcShifts[2]) };
+
+	uint x = 0;
+	for (; x + 8 <= w; x += 8) {
+		const uint16x4_t lo = neon_8888ToRGB565(vld1q_u32((const uint32_t *)(src + x)), shifts);
+		const uint16x4_t hi = neon_8888ToRGB565(vld1q_u32((const uint32_t *)(src + x + 4)), shifts);
+		vst1q_u16((uint16_t *)(dst + x), vcombine_u16(lo, hi));
+	}
+	return x;
+}
+
+uint convertRow8888NEON(uint32 *dst, const uint32 *src, uint w, const int *srcShifts, const int *dstShifts, uint channels, uint32 alpha) {
+	int32x4_t srcCounts[4], dstCounts[4];
+	for (uint c = 0; c < 4; ++c) {
+		srcCounts[c] = vdupq_n_s32(-srcShifts[c]);
+		dstCounts[c] = vdupq_n_s32(dstShifts[c]);
+	}
+	const uint32x4_t alphaV = vdupq_n_u32(alpha);
+
+	uint x = 0;
+	for (; x + 8 <= w; x += 8) {
+		const uint32x4_t lo = vld1q_u32((const uint32_t *)(src + x));
+		const uint32x4_t hi = vld1q_u32((const uint32_t *)(src + x + 4));
+		vst1q_u32((uint32_t *)(dst + x), neon_convert8888(lo, srcCounts, dstCounts, channels, alphaV));
+		vst1q_u32((uint32_t *)(dst + x + 4), neon_convert8888(hi, srcCounts, dstCounts, channels, alphaV));
+	}
+	return x;
+}
+
+//
+// Bilinear scaling kernels
+//
+
+// Four 16.16 fractions as 16-bit lanes, each one repeated for the four
+// channels of a pixel, the low two pixels in lo, the high two in hi.
+static FORCEINLINE void neon_expandWeights(int32x4_t w, int16x8_t &lo, int16x8_t &hi) {
+	const int16x4_t w16 = vmovn_s32(w);
+	const int16x4x2_t pairs = vzip_s16(w16, w16);
+	const int16x4x2_t low = vzip_s16(pairs.val[0], pairs.val[0]);
+	const int16x4x2_t high = vzip_s16(pairs.val[1], pairs.val[1]);
+	lo = vcombine_s16(low.val[0], low.val[1]);
+	hi = vcombine_s16(high.val[0], high.val[1]);
+}
+
+// a + (((b - a) * w) >> 16) in 16-bit lanes. The multiply is signed, so
+// fractions from 0x8000 up count as w - 0x10000, b - a is added back for them.
+static FORCEINLINE int16x8_t neon_lerp16(int16x8_t a, int16x8_t b, int16x8_t w) {
+	const int16x8_t d = vsubq_s16(b, a);
+	const int16x4_t pLo = vshrn_n_s32(vmull_s16(vget_low_s16(d), vget_low_s16(w)), 16);
+	const int16x4_t pHi = vshrn_n_s32(vmull_s16(vget_high_s16(d), vget_high_s16(w)), 16);
+	const int16x8_t p = vaddq_s16(vcombine_s16(pLo, pHi), vandq_s16(d, vshrq_n_s16(w, 15)));
+	return vaddq_s16(a, p);
+}
+
+static FORCEINLINE int16x8_t neon_widenLow(uint8x16_t v) {
+	return vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(v)));
+}
+
+static FORCEINLINE int16x8_t neon_widenHigh(uint8x16_t v) {
+	return vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(v)));
+}
+
+uint interpolateBilinearNEON(uint32 *dst, const uint32 *c00, const uint32 *c01, const uint32 *c10, const uint32 *c11, const int *ex, const int *ey, uint n) {
+	uint i = 0;
+	for (; i + 4 <= n; i += 4) {
+		const uint8x16_t p00 = vld1q_u8((const uint8 *)(c00 + i));
+		const uint8x16_t p01 = vld1q_u8((const uint8 *)(c01 + i));
+		const uint8x16_t p10 = vld1q_u8((const uint8 *)(c10 + i));
+		const uint8x16_t p11 = vld1q_u8((const uint8 *)(c11 + i));
+
+		int16x8_t wxLo, wxHi, wyLo, wyHi;
+		neon_expandWeights(vld1q_s32(ex + i), wxLo, wxHi);
+		neon_expandWeights(vld1q_s32(ey + i), wyLo, wyHi);
+
+		int16x8_t t1 = neon_lerp16(neon_widenLow(p00), neon_widenLow(p01), wxLo);
+		int16x8_t t2 = neon_lerp16(neon_widenLow(p10), neon_widenLow(p11), wxLo);
+		const int16x8_t lo = neon_lerp16(t1, t2, wyLo);
+
+		t1 = neon_lerp16(neon_widenHigh(p00), neon_widenHigh(p01), wxHi);
+		t2 = neon_lerp16(neon_widenHigh(p10), neon_widenHigh(p11), wxHi);
+		const int16x8_t hi = neon_lerp16(t1, t2, wyHi);
+
+		vst1q_u8((uint8 *)(dst + i), vcombine_u8(vqmovun_s16(lo), vqmovun_s16(hi)));
+	}
+	return i;
+}
+
 } // end of namespace Graphics
 
 #if !defined(__aarch64__) && !defined(__ARM_NEON)
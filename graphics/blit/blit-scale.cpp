@@ -196,6 +196,115 @@ Size scaleBlitBilinearInterpolate(Size c01, Size c00, Size c11, Size c10, int ex
 	return fmt.ARGBToColorT<ColorMask>(dp_a, dp_r, dp_g, dp_b);
 }
 
+} // End of anonymous namespace
+
+#ifdef SCUMMVM_SSE2
+// Defined in blit-sse2.cpp
+uint interpolateBilinearSSE2(uint32 *dst, const uint32 *c00, const uint32 *c01, const uint32 *c10, const uint32 *c11, const int *ex, const int *ey, uint n);
+#endif
+
+#ifdef SCUMMVM_AVX2
+// Defined in blit-avx2.cpp
+uint interpolateBilinearAVX2(uint32 *dst, const uint32 *c00, const uint32 *c01, const uint32 *c10, const uint32 *c11, const int *ex, const int *ey, uint n);
+#endif
+
+#ifdef SCUMMVM_NEON
+// Defined in blit-neon.cpp
+uint interpolateBilinearNEON(uint32 *dst, const uint32 *c00, const uint32 *c01, const uint32 *c10, const uint32 *c11, const int *ex, const int *ey, uint n);
+#endif
+
+// Defined in blit.cpp
+void selectBlitKernels();
+
+namespace {
+
+// The SIMD kernels interpolate the start of the pixel run and return how
+// many pixels they did, the rest is left to interpolateBilinearBytes().
+typedef uint (*InterpolateBilinearFunc)(uint32 *dst, const uint32 *c00, const uint32 *c01, const uint32 *c10, const uint32 *c11, const int *ex, const int *ey, uint n);
+
+uint skipInterpolateBilinear(uint32 *, const uint32 *, const uint32 *, const uint32 *, const uint32 *, const int *, const int *, uint) { return 0; }
+
+InterpolateBilinearFunc interpolateBilinear = skipInterpolateBilinear;
+
+/** The pixels are gathered and interpolated in runs of this many. */
+const uint kBilinearRunLength = 64;
+
+/** Size of the square destination tiles rotoscaleBlitLogic() goes through. */
+const uint kRotoscaleTileSize = 32;
+
+/**
+ * Whether the format has four 8-bit channels on byte boundaries. For those
+ * interpolating each byte on its own is the same as interpolating each
+ * channel, which is what the SIMD kernels do.
+ */
+bool isFormatBilinearBytes(const PixelFormat &fmt) {
+	return fmt.bytesPerPixel == 4
+	    && fmt.rBits() == 8 && fmt.gBits() == 8 && fmt.bBits() == 8 && fmt.aBits() == 8
+	    && !(fmt.rShift & 7) && !(fmt.gShift & 7) && !(fmt.bShift & 7) && !(fmt.aShift & 7);
+}
+
+void interpolateBilinearBytes(uint32 *dst, const uint32 *c00, const uint32 *c01, const uint32 *c10, const uint32 *c11, const int *ex, const int *ey, uint n) {
+	for (uint i = 0; i < n; i++) {
+		uint32 color = 0;
+		for (uint shift = 0; shift < 32; shift += 8) {
+			color |= (uint32)scaleBlitBilinearInterpolate(c01[i] >> shift, c00[i] >> shift, c11[i] >> shift, c10[i] >> shift, ex[i], ey[i]) << shift;
+		}
+		dst[i] = color;
+	}
+}
+
+void interpolateBilinearRun(uint32 *dst, const uint32 *c00, const uint32 *c01, const uint32 *c10, const uint32 *c11, const int *ex, const int *ey, uint n) {
+	const uint done = interpolateBilinear(dst, c00, c01, c10, c11, ex, ey, n);
+	interpolateBilinearBytes(dst + done, c00 + done, c01 + done, c10 + done, c11 + done, ex + done, ey + done, n - done);
+}
+
+/**
+ * scaleBlitBilinearLogic() for the formats of isFormatBilinearBytes().
+ * The four source pixels of each destination pixel are gathered first,
+ * then interpolated a run at a time.
+ */
+void scaleBlitBilinearBytes(byte *dst, const byte *src,
+							const uint dstPitch, const uint srcPitch,
+							const uint dstW, const uint dstH,
+							const uint srcW, const uint srcH,
+							const int *sax, const int *say, byte flip) {
+	const bool flipx = flip & FLIP_H;
+	const bool flipy = flip & FLIP_V;
+
+	const int spixelw = (srcW - 1);
+	const int spixelh = (srcH - 1);
+
+	uint32 c00[kBilinearRunLength], c01[kBilinearRunLength], c10[kBilinearRunLength], c11[kBilinearRunLength];
+	int ex[kBilinearRunLength], ey[kBilinearRunLength];
+
+	for (uint y = 0; y < dstH; y++) {
+		const int cy = (say[y] >> 16);
+		const int row = flipy ? spixelh - cy : cy;
+		const int nextRow = (cy < spixelh) ? (flipy ? row - 1 : row + 1) : row;
+		const uint32 *sp0 = (const uint32 *)(src + row * srcPitch);
+		const uint32 *sp1 = (const uint32 *)(src + nextRow * srcPitch);
+		uint32 *dp = (uint32 *)(dst + dstPitch * y);
+
+		for (uint i = 0; i < kBilinearRunLength; i++)
+			ey[i] = (say[y] & 0xffff);
+
+		for (uint x = 0; x < dstW; x += kBilinearRunLength) {
+			const uint n = MIN(dstW - x, kBilinearRunLength);
+			for (uint i = 0; i < n; i++) {
+				const int cx = (sax[x + i] >> 16);
+				const int col = flipx ? spixelw - cx : cx;
+				const int nextCol = (cx < spixelw) ? (flipx ? col - 1 : col + 1) : col;
+				c00[i] = sp0[col];
+				c01[i] = sp0[nextCol];
+				c10[i] = sp1[col];
+				c11[i] = sp1[nextCol];
+				ex[i] = (sax[x + i] & 0xffff);
+			}
+			interpolateBilinearRun(dp + x, c00, c01, c10, c11, ex, ey, n);
+		}
+	}
+}
+
 template <typename ColorMask, typename Size>
 void scaleBlitBilinearLogic(byte *dst, const byte *src,
 							const uint dstPitch, const uint srcPitch,
@@ -288,75 +397,43 @@ void scaleBlitBilinearLogic(byte *dst, const byte *src,
 	}
 }
 
+/**
+ * Draws runs of destination pixels for rotoscaleBlitLogic(), stepping
+ * through the source by (icosx, isiny) from (sdx, sdy) in 16.16.
+ */
 template<typename ColorMask, typename Size, bool filtering>
-void rotoscaleBlitLogic(byte *dst, const byte *src,
-						const uint dstPitch, const uint srcPitch,
-						const uint dstW, const uint dstH,
-						const uint srcW, const uint srcH,
-						const Graphics::PixelFormat &fmt,
-						const TransformStruct &transform,
-						const Common::Point &newHotspot) {
-	const bool flipx = transform._flip & FLIP_H;
-	const bool flipy = transform._flip & FLIP_V;
-
-	assert(transform._angle != kDefaultAngle); // This would not be ideal; rotoscale() should never be called in conditional branches where angle = 0 anyway.
-
-	if (transform._zoom.x == 0 || transform._zoom.y == 0) {
-		return;
-	}
+struct RotoscaleSpan {
+	RotoscaleSpan(const byte *src, const uint srcPitch, const uint srcW, const uint srcH, const byte flip, const Graphics::PixelFormat &fmt) :
+		_src(src), _srcPitch(srcPitch), _srcW(srcW), _srcH(srcH), _sw(srcW - 1), _sh(srcH - 1),
+		_flipx(flip & FLIP_H), _flipy(flip & FLIP_V), _fmt(fmt) {}
 
-	uint32 invAngle = 360 - (transform._angle % 360);
-	float invAngleRad = Math::deg2rad<uint32,float>(invAngle);
-	float invCos = cos(invAngleRad);
-	float invSin = sin(invAngleRad);
-
-	int icosx = (int)(invCos * (65536.0f * kDefaultZoomX / transform._zoom.x));
-	int isinx = (int)(invSin * (65536.0f * kDefaultZoomX / transform._zoom.x));
-	int icosy = (int)(invCos * (65536.0f * kDefaultZoomY / transform._zoom.y));
-	int isiny = (int)(invSin * (65536.0f * kDefaultZoomY / transform._zoom.y));
-
-	int xd = transform._hotspot.x << 16;
-	int yd = transform._hotspot.y << 16;
-	int cx = newHotspot.x;
-	int cy = newHotspot.y;
-
-	int ax = -icosx * cx;
-	int ay = -isiny * cx;
-	int sw = srcW - 1;
-	int sh = srcH - 1;
-
-	Size *pc = (Size *)dst;
-
-	for (uint y = 0; y < dstH; y++) {
-		int t = cy - y;
-		int sdx = ax + (isinx * t) + xd;
-		int sdy = ay - (icosy * t) + yd;
-		for (uint x = 0; x < dstW; x++) {
+	void operator()(Size *pc, int sdx, int sdy, const int icosx, const int isiny, const uint n) const {
+		for (uint x = 0; x < n; x++) {
 			int dx = (sdx >> 16);
 			int dy = (sdy >> 16);
-			if (flipx) {
-				dx = sw - dx;
+			if (_flipx) {
+				dx = _sw - dx;
 			}
-			if (flipy) {
-				dy = sh - dy;
+			if (_flipy) {
+				dy = _sh - dy;
 			}
 
 			if (filtering) {
-				if ((dx > -1) && (dy > -1) && (dx < sw) && (dy < sh)) {
-					const byte *sp = src + dy * srcPitch + dx * sizeof(Size);
+				if ((dx > -1) && (dy > -1) && (dx < _sw) && (dy < _sh)) {
+					const byte *sp = _src + dy * _srcPitch + dx * sizeof(Size);
 					Size c00, c01, c10, c11;
 					c00 = *(const Size *)sp;
 					sp += sizeof(Size);
 					c01 = *(const Size *)sp;
-					sp += srcPitch;
+					sp += _srcPitch;
 					c11 = *(const Size *)sp;
 					sp -= sizeof(Size);
 					c10 = *(const Size *)sp;
-					if (flipx) {
+					if (_flipx) {
 						SWAP(c00, c01);
 						SWAP(c10, c11);
 					}
-					if (flipy) {
+					if (_flipy) {
 						SWAP(c00, c10);
 						SWAP(c01, c11);
 					}
@@ -365,11 +442,11 @@ void rotoscaleBlitLogic(byte *dst, const byte *src,
 					*/
 					int ex = (sdx & 0xffff);
 					int ey = (sdy & 0xffff);
-					*pc = scaleBlitBilinearInterpolate<ColorMask, Size>(c01, c00, c11, c10, ex, ey, fmt);
+					*pc = scaleBlitBilinearInterpolate<ColorMask, Size>(c01, c00, c11, c10, ex, ey, _fmt);
 				}
 			} else {
-				if ((dx >= 0) && (dy >= 0) && (dx < (int)srcW) && (dy < (int)srcH)) {
-					const byte *sp = src + dy * srcPitch + dx * sizeof(Size);
+				if ((dx >= 0) && (dy >= 0) && (dx < (int)_srcW) && (dy < (int)_srcH)) {
+					const byte *sp = _src + dy * _srcPitch + dx * sizeof(Size);
 					*pc = *(const Size *)sp;
 				}
 			}
@@ -378,6 +455,118 @@ void rotoscaleBlitLogic(byte *dst, const byte *src,
 			pc++;
 		}
 	}
+
+	const byte *_src;
+	const uint _srcPitch, _srcW, _srcH;
+	const int _sw, _sh;
+	const bool _flipx, _flipy;
+	const Graphics::PixelFormat &_fmt;
+};
+
+/**
+ * The filtering RotoscaleSpan for the formats of isFormatBilinearBytes().
+ * Pixels which fall outside the source are gathered as the destination
+ * pixel with no weights, so interpolating leaves them as they are.
+ */
+struct RotoscaleSpanBilinearBytes {
+	RotoscaleSpanBilinearBytes(const byte *src, const uint srcPitch, const uint srcW, const uint srcH, const byte flip, const Graphics::PixelFormat &) :
+		_src(src), _srcPitch(srcPitch), _sw(srcW - 1), _sh(srcH - 1),
+		_flipx(flip & FLIP_H), _flipy(flip & FLIP_V) {}
+
+	void operator()(uint32 *pc, int sdx, int sdy, const int icosx, const int isiny, const uint n) const {
+		uint32 c00[kBilinearRunLength], c01[kBilinearRunLength], c10[kBilinearRunLength], c11[kBilinearRunLength];
+		int ex[kBilinearRunLength], ey[kBilinearRunLength];
+		assert(n <= kBilinearRunLength);
+
+		for (uint x = 0; x < n; x++) {
+			int dx = (sdx >> 16);
+			int dy = (sdy >> 16);
+			if (_flipx) {
+				dx = _sw - dx;
+			}
+			if (_flipy) {
+				dy = _sh - dy;
+			}
+
+			if ((dx > -1) && (dy > -1) && (dx < _sw) && (dy < _sh)) {
+				const uint32 *sp0 = (const uint32 *)(_src + dy * _srcPitch) + dx;
+				const uint32 *sp1 = (const uint32 *)((const byte *)sp0 + _srcPitch);
+				const int left = _flipx ? 1 : 0;
+				const int top = _flipy ? 1 : 0;
+				const uint32 *r0 = top ? sp1 : sp0;
+				const uint32 *r1 = top ? sp0 : sp1;
+				c00[x] = r0[left];
+				c01[x] = r0[1 - left];
+				c10[x] = r1[left];
+				c11[x] = r1[1 - left];
+				ex[x] = (sdx & 0xffff);
+				ey[x] = (sdy & 0xffff);
+			} else {
+				c00[x] = c01[x] = c10[x] = c11[x] = pc[x];
+				ex[x] = ey[x] = 0;
+			}
+			sdx += icosx;
+			sdy += isiny;
+		}
+
+		interpolateBilinearRun(pc, c00, c01, c10, c11, ex, ey, n);
+	}
+
+	const byte *_src;
+	const uint _srcPitch;
+	const int _sw, _sh;
+	const bool _flipx, _flipy;
+};
+
+template<typename Size, typename Span>
+void rotoscaleBlitLogic(byte *dst, const byte *src,
+						const uint dstPitch, const uint srcPitch,
+						const uint dstW, const uint dstH,
+						const uint srcW, const uint srcH,
+						const Graphics::PixelFormat &fmt,
+						const TransformStruct &transform,
+						const Common::Point &newHotspot) {
+	assert(transform._angle != kDefaultAngle); // This would not be ideal; rotoscale() should never be called in conditional branches where angle = 0 anyway.
+
+	if (transform._zoom.x == 0 || transform._zoom.y == 0) {
+		return;
+	}
+
+	uint32 invAngle = 360 - (transform._angle % 360);
+	float invAngleRad = Math::deg2rad<uint32,float>(invAngle);
+	float invCos = cos(invAngleRad);
+	float invSin = sin(invAngleRad);
+
+	int icosx = (int)(invCos * (65536.0f * kDefaultZoomX / transform._zoom.x));
+	int isinx = (int)(invSin * (65536.0f * kDefaultZoomX / transform._zoom.x));
+	int icosy = (int)(invCos * (65536.0f * kDefaultZoomY / transform._zoom.y));
+	int isiny = (int)(invSin * (65536.0f * kDefaultZoomY / transform._zoom.y));
+
+	int xd = transform._hotspot.x << 16;
+	int yd = transform._hotspot.y << 16;
+	int cx = newHotspot.x;
+	int cy = newHotspot.y;
+
+	int ax = -icosx * cx;
+	int ay = -isiny * cx;
+
+	const Span span(src, srcPitch, srcW, srcH, transform._flip, fmt);
+
+	// Rows of the destination run through the source at an angle, so go
+	// through the destination in tiles, keeping the source pixels which
+	// neighbouring rows read in the cache.
+	for (uint ty = 0; ty < dstH; ty += kRotoscaleTileSize) {
+		const uint tileH = MIN(dstH - ty, kRotoscaleTileSize);
+		for (uint tx = 0; tx < dstW; tx += kRotoscaleTileSize) {
+			const uint tileW = MIN(dstW - tx, kRotoscaleTileSize);
+			for (uint y = ty; y < ty + tileH; y++) {
+				int t = cy - y;
+				int sdx = ax + (isinx * t) + xd + (icosx * (int)tx);
+				int sdy = ay - (icosy * t) + yd + (isiny * (int)tx);
+				span((Size *)(dst + y * dstPitch) + tx, sdx, sdy, icosx, isiny, tileW);
+			}
+		}
+	}
 }
 
 } // End of anonymous namespace
@@ -435,8 +624,10 @@ bool scaleBlitBilinear(byte *dst, const byte *src,
 		}
 	}
 
-	if (fmt == createPixelFormat<8888>()) {
-		scaleBlitBilinearLogic<ColorMasks<8888>, uint32>(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, sax, say, flip);
+	selectBlitKernels();
+
+	if (isFormatBilinearBytes(fmt)) {
+		scaleBlitBilinearBytes(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, sax, say, flip);
 	} else if (fmt == createPixelFormat<888>()) {
 		scaleBlitBilinearLogic<ColorMasks<888>,  uint32>(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, sax, say, flip);
 	} else if (fmt == createPixelFormat<565>()) {
@@ -469,11 +660,11 @@ bool rotoscaleBlit(byte *dst, const byte *src,
 				   const TransformStruct &transform,
 				   const Common::Point &newHotspot) {
 	if (fmt.bytesPerPixel == 4) {
-		rotoscaleBlitLogic<ColorMasks<0>, uint32, false>(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
+		rotoscaleBlitLogic<uint32, RotoscaleSpan<ColorMasks<0>, uint32, false> >(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
 	} else if (fmt.bytesPerPixel == 2) {
-		rotoscaleBlitLogic<ColorMasks<0>, uint16, false>(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
+		rotoscaleBlitLogic<uint16, RotoscaleSpan<ColorMasks<0>, uint16, false> >(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
 	} else if (fmt.bytesPerPixel == 1) {
-		rotoscaleBlitLogic<ColorMasks<0>, uint8, false>(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
+		rotoscaleBlitLogic<uint8, RotoscaleSpan<ColorMasks<0>, uint8, false> >(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
 	} else {
 		return false;
 	}
@@ -488,19 +679,21 @@ bool rotoscaleBlitBilinear(byte *dst, const byte *src,
 						   const Graphics::PixelFormat &fmt,
 						   const TransformStruct &transform,
 						   const Common::Point &newHotspot) {
-	if (fmt == createPixelFormat<8888>()) {
-		rotoscaleBlitLogic<ColorMasks<8888>, uint32, true>(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
+	selectBlitKernels();
+
+	if (isFormatBilinearBytes(fmt)) {
+		rotoscaleBlitLogic<uint32, RotoscaleSpanBilinearBytes>(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
 	} else if (fmt == createPixelFormat<888>()) {
-		rotoscaleBlitLogic<ColorMasks<888>,  uint32, true>(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
+		rotoscaleBlitLogic<uint32, RotoscaleSpan<ColorMasks<888>, uint32, true> >(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
 	} else if (fmt == createPixelFormat<565>()) {
-		rotoscaleBlitLogic<ColorMasks<565>,  uint16, true>(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
+		rotoscaleBlitLogic<uint16, RotoscaleSpan<ColorMasks<565>, uint16, true> >(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
 	} else if (fmt == createPixelFormat<555>()) {
-		rotoscaleBlitLogic<ColorMasks<555>,  uint16, true>(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
+		rotoscaleBlitLogic<uint16, RotoscaleSpan<ColorMasks<555>, uint16, true> >(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
 
 	} else if (fmt.bytesPerPixel == 4) {
-		rotoscaleBlitLogic<ColorMasks<0>,    uint32, true>(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
+		rotoscaleBlitLogic<uint32, RotoscaleSpan<ColorMasks<0>, uint32, true> >(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
 	} else if (fmt.bytesPerPixel == 2) {
-		rotoscaleBlitLogic<ColorMasks<0>,    uint16, true>(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
+		rotoscaleBlitLogic<uint16, RotoscaleSpan<ColorMasks<0>, uint16, true> >(dst, src, dstPitch, srcPitch, dstW, dstH, srcW, srcH, fmt, transform, newHotspot);
 	} else {
 		return false;
 	}
@@ -508,4 +701,27 @@ bool rotoscaleBlitBilinear(byte *dst, const byte *src,
 	return true;
 }
 
+void setScaleBlitKernels(BlitKernelSet set) {
+	switch (set) {
+#ifdef SCUMMVM_SSE2
+	case kBlitKernelsSSE2:
+		interpolateBilinear = interpolateBilinearSSE2;
+		break;
+#endif
+#ifdef SCUMMVM_AVX2
+	case kBlitKernelsAVX2:
+		interpolateBilinear = interpolateBilinearAVX2;
+		break;
+#endif
+#ifdef SCUMMVM_NEON
+	case kBlitKernelsNEON:
+		interpolateBilinear = interpolateBilinearNEON;
+		break;
+#endif
+	default:
+		interpolateBilinear = skipInterpolateBilinear;
+		break;
+	}
+}
+
 } // End of namespace Graphics
@@ -326,6 +326,152 @@ void BlendBlit::blitSSE2(Args &args, const TSpriteBlendMode &blendMode, const Al
 	blitT<BlendBlitImpl_SSE2>(args, blendMode, alphaType);
 }
 
+//
+// crossBlit kernels
+//
+
+static FORCEINLINE __m128i sse2_convert8888(__m128i src, const __m128i *srcShifts, const __m128i *dstShifts, uint channels, __m128i alpha) {
+	const __m128i channelMask = _mm_set1_epi32(0xFF);
+	__m128i out = alpha;
+	for (uint c = 0; c < channels; ++c)
+		out = _mm_or_si128(out, _mm_sll_epi32(_mm_and_si128(_mm_srl_epi32(src, srcShifts[c]), channelMask), dstShifts[c]));
+	return out;
+}
+
+static FORCEINLINE __m128i sse2_rgb565To8888(__m128i src, const __m128i *dstShifts, __m128i alpha) {
+	const __m128i r5 = _mm_and_si128(_mm_srli_epi32(src, 11), _mm_set1_epi32(0x1F));
+	const __m128i g6 = _mm_and_si128(_mm_srli_epi32(src, 5), _mm_set1_epi32(0x3F));
+	const __m128i b5 = _mm_and_si128(src, _mm_set1_epi32(0x1F));
+
+	const __m128i r = _mm_or_si128(_mm_slli_epi32(r5, 3), _mm_srli_epi32(r5, 2));
+	const __m128i g = _mm_or_si128(_mm_slli_epi32(g6, 2), _mm_srli_epi32(g6, 4));
+	const __m128i b = _mm_or_si128(_mm_slli_epi32(b5, 3), _mm_srli_epi32(b5, 2));
+
+	__m128i out = _mm_or_si128(alpha, _mm_sll_epi32(r, dstShifts[0]));
+	out = _mm_or_si128(out, _mm_sll_epi32(g, dstShifts[1]));
+	return _mm_or_si128(out, _mm_sll_epi32(b, dstShifts[2]));
+}
+
+static FORCEINLINE __m128i sse2_8888ToRGB565(__m128i src, const __m128i *srcShifts) {
+	const __m128i r = _mm_and_si128(_mm_srl_epi32(src, srcShifts[0]), _mm_set1_epi32(0xF8));
+	const __m128i g = _mm_and_si128(_mm_srl_epi32(src, srcShifts[1]), _mm_set1_epi32(0xFC));
+	const __m128i b = _mm_and_si128(_mm_srl_epi32(src, srcShifts[2]), _mm_set1_epi32(0xF8));
+	const __m128i out = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, 8), _mm_slli_epi32(g, 3)), _mm_srli_epi32(b, 3));
+	// Sign extend so the saturating pack keeps the low 16 bits
+	return _mm_srai_epi32(_mm_slli_epi32(out, 16), 16);
+}
+
+uint convertRowRGB555ToRGB565SSE2(uint16 *dst, const uint16 *src, uint w) {
+	const __m128i redMask = _mm_set1_epi16(0x7C00);
+	const __m128i fiveBits = _mm_set1_epi16(0x1F);
+
+	uint x = 0;
+	for (; x + 8 <= w; x += 8) {
+		const __m128i in = _mm_loadu_si128((const __m128i *)(src + x));
+		const __m128i g5 = _mm_and_si128(_mm_srli_epi16(in, 5), fiveBits);
+		const __m128i g6 = _mm_or_si128(_mm_slli_epi16(g5, 1), _mm_srli_epi16(g5, 4));
+		__m128i out = _mm_slli_epi16(_mm_and_si128(in, redMask), 1);
+		out = _mm_or_si128(out, _mm_slli_epi16(g6, 5));
+		out = _mm_or_si128(out, _mm_and_si128(in, fiveBits));
+		_mm_storeu_si128((__m128i *)(dst + x), out);
+	}
+	return x;
+}
+
+uint convertRowRGB565To8888SSE2(uint32 *dst, const uint16 *src, uint w, const int *dstShifts, uint32 alpha) {
+	const __m128i shifts[3] = { _mm_cvtsi32_si128(dstShifts[0]), _mm_cvtsi32_si128(dstShifts[1]), _mm_cvtsi32_si128(dstShifts[2]) };
+	const __m128i alphaV = _mm_set1_epi32(alpha);
+
+	uint x = 0;
+	for (; x + 8 <= w; x += 8) {
+		const __m128i in = _mm_loadu_si128((const __m128i *)(src + x));
+		const __m128i lo = _mm_unpacklo_epi16(in, _mm_setzero_si128());
+		const __m128i hi = _mm_unpackhi_epi16(in, _mm_setzero_si128());
+		_mm_storeu_si128((__m128i *)(dst + x), sse2_rgb565To8888(lo, shifts, alphaV));
+		_mm_storeu_si128((__m128i *)(dst + x + 4), sse2_rgb565To8888(hi, shifts, alphaV));
+	}
+	return x;
+}
+
+uint convertRow8888ToRGB565SSE2(uint16 *dst, const uint32 *src, uint w, const int *srcShifts) {
+	const __m128i shifts[3] = { _mm_cvtsi32_si128(srcShifts[0]), _mm_cvtsi32_si128(srcShifts[1]), _mm_cvtsi32_si128(srcShifts[2]) };
+
+	uint x = 0;
+	for (; x + 8 <= w; x += 8) {
+		const __m128i lo = sse2_8888ToRGB565(_mm_loadu_si128((const __m128i *)(src + x)), shifts);
+		const __m128i hi = sse2_8888ToRGB565(_mm_loadu_si128((const __m128i *)(src + x + 4)), shifts);
+		_mm_storeu_si128((__m128i *)(dst + x), _mm_packs_epi32(lo, hi));
+	}
+	return x;
+}
+
+uint convertRow8888SSE2(uint32 *dst, const uint32 *src, uint w, const int *srcShifts, const int *dstShifts, uint channels, uint32 alpha) {
+	__m128i srcCounts[4], dstCounts[4];
+	for (uint c = 0; c < 4; ++c) {
+		srcCounts[c] = _mm_cvtsi32_si128(srcShifts[c]);
+		dstCounts[c] = _mm_cvtsi32_si128(dstShifts[c]);
+	}
+	const __m128i alphaV = _mm_set1_epi32(alpha);
+
+	uint x = 0;
+	for (; x + 8 <= w; x += 8) {
+		const __m128i lo = _mm_loadu_si128((const __m128i *)(src + x));
+		const __m128i hi = _mm_loadu_si128((const __m128i *)(src + x + 4));
+		_mm_storeu_si128((__m128i *)(dst + x), sse2_convert8888(lo, srcCounts, dstCounts, channels, alphaV));
+		_mm_storeu_si128((__m128i *)(dst + x + 4), sse2_convert8888(hi, srcCounts, dstCounts, channels, alphaV));
+	}
+	return x;
+}
+
+//
+// Bilinear scaling kernels
+//
+
+// Turn four 16.16 fractions into 16-bit lanes, each one repeated for
+// the four channels of a pixel, the low two pixels in lo, the high two in hi.
+static FORCEINLINE void sse2_expandWeights(__m128i w, __m128i &lo, __m128i &hi) {
+	w = _mm_srai_epi32(_mm_slli_epi32(w, 16), 16);
+	w = _mm_packs_epi32(w, w);
+	w = _mm_unpacklo_epi16(w, w);
+	lo = _mm_unpacklo_epi32(w, w);
+	hi = _mm_unpackhi_epi32(w, w);
+}
+
+// a + (((b - a) * w) >> 16) in 16-bit lanes. The multiply is signed, so
+// fractions from 0x8000 up count as w - 0x10000, b - a is added back for them.
+static FORCEINLINE __m128i sse2_lerp16(__m128i a, __m128i b, __m128i w) {
+	const __m128i d = _mm_sub_epi16(b, a);
+	const __m128i p = _mm_add_epi16(_mm_mulhi_epi16(d, w), _mm_and_si128(d, _mm_srai_epi16(w, 15)));
+	return _mm_add_epi16(a, p);
+}
+
+uint interpolateBilinearSSE2(uint32 *dst, const uint32 *c00, const uint32 *c01, const uint32 *c10, const uint32 *c11, const int *ex, const int *ey, uint n) {
+	const __m128i zero = _mm_setzero_si128();
+
+	uint i = 0;
+	for (; i + 4 <= n; i += 4) {
+		const __m128i p00 = _mm_loadu_si128((const __m128i *)(c00 + i));
+		const __m128i p01 = _mm_loadu_si128((const __m128i *)(c01 + i));
+		const __m128i p10 = _mm_loadu_si128((const __m128i *)(c10 + i));
+		const __m128i p11 = _mm_loadu_si128((const __m128i *)(c11 + i));
+
+		__m128i wxLo, wxHi, wyLo, wyHi;
+		sse2_expandWeights(_mm_loadu_si128((const __m128i *)(ex + i)), wxLo, wxHi);
+		sse2_expandWeights(_mm_loadu_si128((const __m128i *)(ey + i)), wyLo, wyHi);
+
+		__m128i t1 = sse2_lerp16(_mm_unpacklo_epi8(p00, zero), _mm_unpacklo_epi8(p01, zero), wxLo);
+		__m128i t2 = sse2_lerp16(_mm_unpacklo_epi8(p10, zero), _mm_unpacklo_epi8(p11, zero), wxLo);
+		const __m128i lo = sse2_lerp16(t1, t2, wyLo);
+
+		t1 = sse2_lerp16(_mm_unpackhi_epi8(p00, zero), _mm_unpackhi_epi8(p01, zero), wxHi);
+		t2 = sse2_lerp16(_mm_unpackhi_epi8(p10, zero), _mm_unpackhi_epi8(p11, zero), wxHi);
+		const __m128i hi = sse2_lerp16(t1, t2, wyHi);
+
+		_mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(lo, hi));
+	}
+	return i;
+}
+
 } // End of namespace Graphics
 
 #if !defined(__x86_64__)
@@ -22,6 +22,7 @@
 #include "graphics/blit.h"
 #include "graphics/pixelformat.h"
 #include "common/endian.h"
+#include "common/system.h"
 
 namespace Graphics {
 
@@ -289,6 +290,261 @@ inline bool crossBlitHelper(byte *dst, const byte *src, const byte *mask, const
 
 } // End of anonymous namespace
 
+#ifdef SCUMMVM_SSE2
+// Defined in blit-sse2.cpp
+uint convertRowRGB555ToRGB565SSE2(uint16 *dst, const uint16 *src, uint w);
+uint convertRowRGB565To8888SSE2(uint32 *dst, const uint16 *src, uint w, const int *dstShifts, uint32 alpha);
+uint convertRow8888ToRGB565SSE2(uint16 *dst, const uint32 *src, uint w, const int *srcShifts);
+uint convertRow8888SSE2(uint32 *dst, const uint32 *src, uint w, const int *srcShifts, const int *dstShifts, uint channels, uint32 alpha);
+#endif
+
+#ifdef SCUMMVM_AVX2
+// Defined in blit-avx2.cpp
+uint convertRowRGB555ToRGB565AVX2(uint16 *dst, const uint16 *src, uint w);
+uint convertRowRGB565To8888AVX2(uint32 *dst, const uint16 *src, uint w, const int *dstShifts, uint32 alpha);
+uint convertRow8888ToRGB565AVX2(uint16 *dst, const uint32 *src, uint w, const int *srcShifts);
+uint convertRow8888AVX2(uint32 *dst, const uint32 *src, uint w, const int *srcShifts, const int *dstShifts, uint channels, uint32 alpha);
+uint mapRow16AVX2(uint16 *dst, const byte *src, uint w, const uint32 *map);
+uint mapRow32AVX2(uint32 *dst, const byte *src, uint w, const uint32 *map);
+#endif
+
+#ifdef SCUMMVM_NEON
+// Defined in blit-neon.cpp
+uint convertRowRGB555ToRGB565NEON(uint16 *dst, const uint16 *src, uint w);
+uint convertRowRGB565To8888NEON(uint32 *dst, const uint16 *src, uint w, const int *dstShifts, uint32 alpha);
+uint convertRow8888ToRGB565NEON(uint16 *dst, const uint32 *src, uint w, const int *srcShifts);
+uint convertRow8888NEON(uint32 *dst, const uint32 *src, uint w, const int *srcShifts, const int *dstShifts, uint channels, uint32 alpha);
+#endif
+
+namespace {
+
+// The SIMD kernels convert the start of a row and return how many pixels
+// they did, the rest is left to the generic code. The shifts are the
+// ones of the red, green, blue and alpha channels of a 32-bit format.
+typedef uint (*ConvertRowRGB555ToRGB565Func)(uint16 *dst, const uint16 *src, uint w);
+typedef uint (*ConvertRowRGB565To8888Func)(uint32 *dst, const uint16 *src, uint w, const int *dstShifts, uint32 alpha);
+typedef uint (*ConvertRow8888ToRGB565Func)(uint16 *dst, const uint32 *src, uint w, const int *srcShifts);
+typedef uint (*ConvertRow8888Func)(uint32 *dst, const uint32 *src, uint w, const int *srcShifts, const int *dstShifts, uint channels, uint32 alpha);
+typedef uint (*MapRow16Func)(uint16 *dst, const byte *src, uint w, const uint32 *map);
+typedef uint (*MapRow32Func)(uint32 *dst, const byte *src, uint w, const uint32 *map);
+
+uint skipConvertRowRGB555ToRGB565(uint16 *, const uint16 *, uint) { return 0; }
+uint skipConvertRowRGB565To8888(uint32 *, const uint16 *, uint, const int *, uint32) { return 0; }
+uint skipConvertRow8888ToRGB565(uint16 *, const uint32 *, uint, const int *) { return 0; }
+uint skipConvertRow8888(uint32 *, const uint32 *, uint, const int *, const int *, uint, uint32) { return 0; }
+uint skipMapRow16(uint16 *, const byte *, uint, const uint32 *) { return 0; }
+uint skipMapRow32(uint32 *, const byte *, uint, const uint32 *) { return 0; }
+
+ConvertRowRGB555ToRGB565Func convertRowRGB555ToRGB565 = skipConvertRowRGB555ToRGB565;
+ConvertRowRGB565To8888Func convertRowRGB565To8888 = skipConvertRowRGB565To8888;
+ConvertRow8888ToRGB565Func convertRow8888ToRGB565 = skipConvertRow8888ToRGB565;
+ConvertRow8888Func convertRow8888 = skipConvertRow8888;
+MapRow16Func mapRow16 = skipMapRow16;
+MapRow32Func mapRow32 = skipMapRow32;
+bool blitKernelsSelected = false;
+
+} // End of anonymous namespace
+
+// Defined in blit-scale.cpp
+void setScaleBlitKernels(BlitKernelSet set);
+
+// Defined in yuv_to_rgb.cpp
+void setYUVToRGBKernels(BlitKernelSet set);
+
+/**
+ * Pick the kernels for the CPU, the same way BlendBlit picks its blitters.
+ * SSE2 and NEON are part of the x86-64 and AArch64 baselines, elsewhere
+ * the backend has to be asked, once it is up.
+ */
+void selectBlitKernels() {
+	if (blitKernelsSelected)
+		return;
+
+	BlitKernelSet set = kBlitKernelsGeneric;
+#if defined(SCUMMVM_SSE2) && (defined(__x86_64__) || defined(_M_X64))
+	set = kBlitKernelsSSE2;
+#elif defined(SCUMMVM_NEON) && defined(__aarch64__)
+	set = kBlitKernelsNEON;
+#endif
+
+	if (g_system) {
+#if defined(SCUMMVM_NEON) && !defined(__aarch64__)
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON))
+			set = kBlitKernelsNEON;
+#endif
+#if defined(SCUMMVM_SSE2) && !(defined(__x86_64__) || defined(_M_X64))
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+			set = kBlitKernelsSSE2;
+#endif
+#ifdef SCUMMVM_AVX2
+		if (g_system->hasFeature(OSystem::kFeatureCpuAVX2))
+			set = kBlitKernelsAVX2;
+#endif
+	}
+
+	setBlitKernels(set);
+	// Without a backend, try again once it can tell about the CPU
+	blitKernelsSelected = (g_system != nullptr);
+}
+
+namespace {
+
+/** Whether the format is a 32-bit one the kernels handle, with 8 bits per channel on byte boundaries. */
+bool isFormat8888(const PixelFormat &fmt) {
+	return fmt.bytesPerPixel == 4
+	    && fmt.rBits() == 8 && fmt.gBits() == 8 && fmt.bBits() == 8
+	    && (fmt.aBits() == 0 || (fmt.aBits() == 8 && !(fmt.aShift & 7)))
+	    && !(fmt.rShift & 7) && !(fmt.gShift & 7) && !(fmt.bShift & 7);
+}
+
+bool rectsOverlap(const byte *dst, const byte *src, const uint dstPitch, const uint srcPitch, const uint h) {
+	return dst < src + h * srcPitch && src < dst + h * dstPitch;
+}
+
+struct RowRGB555ToRGB565 {
+	uint operator()(uint16 *dst, const uint16 *src, uint w) const {
+		return convertRowRGB555ToRGB565(dst, src, w);
+	}
+};
+
+struct RowRGB565To8888 {
+	const int *dstShifts;
+	uint32 alpha;
+
+	uint operator()(uint32 *dst, const uint16 *src, uint w) const {
+		return convertRowRGB565To8888(dst, src, w, dstShifts, alpha);
+	}
+};
+
+struct Row8888ToRGB565 {
+	const int *srcShifts;
+
+	uint operator()(uint16 *dst, const uint32 *src, uint w) const {
+		return convertRow8888ToRGB565(dst, src, w, srcShifts);
+	}
+};
+
+struct Row8888 {
+	const int *srcShifts;
+	const int *dstShifts;
+	uint channels;
+	uint32 alpha;
+
+	uint operator()(uint32 *dst, const uint32 *src, uint w) const {
+		return convertRow8888(dst, src, w, srcShifts, dstShifts, channels, alpha);
+	}
+};
+
+template<typename SrcColor, typename DstColor, typename Kernel>
+void crossBlitRows(byte *dst, const byte *src, const uint dstPitch, const uint srcPitch,
+				   const uint w, const uint h,
+				   const PixelFormat &dstFmt, const PixelFormat &srcFmt, const Kernel &kernel) {
+	for (uint y = 0; y < h; ++y) {
+		const uint done = kernel((DstColor *)dst, (const SrcColor *)src, w);
+		crossBlitLogic<SrcColor, sizeof(SrcColor), DstColor, sizeof(DstColor), false, false, false>(
+			dst + done * sizeof(DstColor), src + done * sizeof(SrcColor), nullptr, w - done, 1,
+			srcFmt, dstFmt, 0, 0, 0, 0);
+
+		dst += dstPitch;
+		src += srcPitch;
+	}
+}
+
+/**
+ * Convert the rect with the SIMD kernels, if there are some for the two
+ * formats. They work from left to right, so converting in place to a
+ * bigger format, which has to be done backwards, is left to the generic
+ * code.
+ */
+bool crossBlitKernels(byte *dst, const byte *src,
+					  const uint dstPitch, const uint srcPitch,
+					  const uint w, const uint h,
+					  const PixelFormat &dstFmt, const PixelFormat &srcFmt) {
+	static const PixelFormat formatRGB555(2, 5, 5, 5, 0, 10, 5, 0, 0);
+	static const PixelFormat formatRGB565(2, 5, 6, 5, 0, 11, 5, 0, 0);
+
+	selectBlitKernels();
+
+	const int srcShifts[4] = { srcFmt.rShift, srcFmt.gShift, srcFmt.bShift, srcFmt.aShift };
+	const int dstShifts[4] = { dstFmt.rShift, dstFmt.gShift, dstFmt.bShift, dstFmt.aShift };
+	const uint32 dstAlpha = dstFmt.aBits() ? (0xFFU << dstFmt.aShift) : 0;
+
+	if (srcFmt == formatRGB555 && dstFmt == formatRGB565) {
+		crossBlitRows<uint16, uint16>(dst, src, dstPitch, srcPitch, w, h, dstFmt, srcFmt, RowRGB555ToRGB565());
+	} else if (srcFmt == formatRGB565 && isFormat8888(dstFmt)) {
+		if (rectsOverlap(dst, src, dstPitch, srcPitch, h))
+			return false;
+
+		const RowRGB565To8888 kernel = { dstShifts, dstAlpha };
+		crossBlitRows<uint16, uint32>(dst, src, dstPitch, srcPitch, w, h, dstFmt, srcFmt, kernel);
+	} else if (isFormat8888(srcFmt) && dstFmt == formatRGB565) {
+		const Row8888ToRGB565 kernel = { srcShifts };
+		crossBlitRows<uint32, uint16>(dst, src, dstPitch, srcPitch, w, h, dstFmt, srcFmt, kernel);
+	} else if (isFormat8888(srcFmt) && isFormat8888(dstFmt)) {
+		// Without alpha in the source the destination alpha is set to
+		// opaque, without alpha in the destination it is dropped.
+		const bool copyAlpha = srcFmt.aBits() && dstFmt.aBits();
+		const Row8888 kernel = { srcShifts, dstShifts, copyAlpha ? 4U : 3U, copyAlpha ? 0 : dstAlpha };
+		crossBlitRows<uint32, uint32>(dst, src, dstPitch, srcPitch, w, h, dstFmt, srcFmt, kernel);
+	} else {
+		return false;
+	}
+
+	return true;
+}
+
+} // End of anonymous namespace
+
+bool setBlitKernels(BlitKernelSet set) {
+	switch (set) {
+	case kBlitKernelsGeneric:
+		convertRowRGB555ToRGB565 = skipConvertRowRGB555ToRGB565;
+		convertRowRGB565To8888 = skipConvertRowRGB565To8888;
+		convertRow8888ToRGB565 = skipConvertRow8888ToRGB565;
+		convertRow8888 = skipConvertRow8888;
+		mapRow16 = skipMapRow16;
+		mapRow32 = skipMapRow32;
+		break;
+#ifdef SCUMMVM_SSE2
+	case kBlitKernelsSSE2:
+		convertRowRGB555ToRGB565 = convertRowRGB555ToRGB565SSE2;
+		convertRowRGB565To8888 = convertRowRGB565To8888SSE2;
+		convertRow8888ToRGB565 = convertRow8888ToRGB565SSE2;
+		convertRow8888 = convertRow8888SSE2;
+		mapRow16 = skipMapRow16;
+		mapRow32 = skipMapRow32;
+		break;
+#endif
+#ifdef SCUMMVM_AVX2
+	case kBlitKernelsAVX2:
+		convertRowRGB555ToRGB565 = convertRowRGB555ToRGB565AVX2;
+		convertRowRGB565To8888 = convertRowRGB565To8888AVX2;
+		convertRow8888ToRGB565 = convertRow8888ToRGB565AVX2;
+		convertRow8888 = convertRow8888AVX2;
+		mapRow16 = mapRow16AVX2;
+		mapRow32 = mapRow32AVX2;
+		break;
+#endif
+#ifdef SCUMMVM_NEON
+	case kBlitKernelsNEON:
+		convertRowRGB555ToRGB565 = convertRowRGB555ToRGB565NEON;
+		convertRowRGB565To8888 = convertRowRGB565To8888NEON;
+		convertRow8888ToRGB565 = convertRow8888ToRGB565NEON;
+		convertRow8888 = convertRow8888NEON;
+		mapRow16 = skipMapRow16;
+		mapRow32 = skipMapRow32;
+		break;
+#endif
+	default:
+		return false;
+	}
+
+	setScaleBlitKernels(set);
+	setYUVToRGBKernels(set);
+	blitKernelsSelected = true;
+	return true;
+}
+
 // Function to blit a rect from one color format to another
 bool crossBlit(byte *dst, const byte *src,
 			   const uint dstPitch, const uint srcPitch,
@@ -305,6 +561,9 @@ bool crossBlit(byte *dst, const byte *src,
 		return true;
 	}
 
+	if (crossBlitKernels(dst, src, dstPitch, srcPitch, w, h, dstFmt, srcFmt))
+		return true;
+
 	return crossBlitHelper<false, false>(dst, src, nullptr, w, h, srcFmt, dstFmt, srcPitch, dstPitch, 0, 0);
 }
 
@@ -437,6 +696,46 @@ inline bool crossBlitMapHelperLogic(byte *dst, const byte *src, const byte *mask
 	return true;
 }
 
+template<typename DstColor, typename Kernel>
+void crossBlitMapRows(byte *dst, const byte *src, const uint dstPitch, const uint srcPitch,
+					  const uint w, const uint h, const uint32 *map, Kernel kernel) {
+	for (uint y = 0; y < h; ++y) {
+		const uint done = kernel((DstColor *)dst, src, w, map);
+		crossBlitMapLogic<DstColor, sizeof(DstColor), false, false, false>(
+			dst + done * sizeof(DstColor), src + done, nullptr, w - done, 1, 0, 0, 0, map, 0);
+
+		dst += dstPitch;
+		src += srcPitch;
+	}
+}
+
+/**
+ * Look up the colors with the SIMD kernels, if there are some for the
+ * destination size. Like crossBlitKernels this leaves in place conversions
+ * to the generic code.
+ */
+bool crossBlitMapKernels(byte *dst, const byte *src,
+						 const uint dstPitch, const uint srcPitch,
+						 const uint w, const uint h,
+						 const uint bytesPerPixel, const uint32 *map) {
+	selectBlitKernels();
+
+	if ((bytesPerPixel != 2 && bytesPerPixel != 4) || rectsOverlap(dst, src, dstPitch, srcPitch, h))
+		return false;
+
+	if (bytesPerPixel == 2) {
+		if (mapRow16 == skipMapRow16)
+			return false;
+		crossBlitMapRows<uint16>(dst, src, dstPitch, srcPitch, w, h, map, mapRow16);
+	} else {
+		if (mapRow32 == skipMapRow32)
+			return false;
+		crossBlitMapRows<uint32>(dst, src, dstPitch, srcPitch, w, h, map, mapRow32);
+	}
+
+	return true;
+}
+
 } // End of anonymous namespace
 
 // Function to blit a rect from one color format to another using a map
@@ -448,6 +747,9 @@ bool crossBlitMap(byte *dst, const byte *src,
 	if (!bytesPerPixel)
 		return false;
 
+	if (crossBlitMapKernels(dst, src, dstPitch, srcPitch, w, h, bytesPerPixel, map))
+		return true;
+
 	return crossBlitMapHelperLogic<false, false>(dst, src, nullptr, w, h, bytesPerPixel, map, srcPitch, dstPitch, 0, 0);
 }
 
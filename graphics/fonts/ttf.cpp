@@ -216,6 +216,18 @@ private:
 	FT_Render_Mode _renderMode;
 	bool _hasKerning;
 
+	/**
+	 * The kerning offsets already asked for, keyed by the character pair.
+	 * Text is drawn and measured over and over again, and FT_Get_Kerning
+	 * has to search the kerning table of the face for every pair.
+	 */
+	struct KerningPairHash {
+		uint operator()(uint64 pair) const { return (uint)(pair >> 32) * 31 + (uint)pair; }
+	};
+	typedef Common::HashMap<uint64, int, KerningPairHash> KerningCache;
+	mutable KerningCache _kerning;
+	static const uint kMaxKerningPairs = 16384;
+
 	bool _fakeBold;
 	bool _fakeItalic;
 };
@@ -558,6 +570,11 @@ int TTFFont::getKerningOffset(uint32 left, uint32 right) const {
 	if (!_hasKerning)
 		return 0;
 
+	const uint64 pair = ((uint64)left << 32) | right;
+	KerningCache::const_iterator kerningEntry = _kerning.find(pair);
+	if (kerningEntry != _kerning.end())
+		return kerningEntry->_value;
+
 	assureCached(left);
 	assureCached(right);
 
@@ -583,6 +600,11 @@ int TTFFont::getKerningOffset(uint32 left, uint32 right) const {
 
 	FT_Vector kerningVector;
 	FT_Get_Kerning(_face, leftGlyph, rightGlyph, FT_KERNING_DEFAULT, &kerningVector);
+
+	// Don't let it grow without bounds for fonts with very large charsets
+	if (_kerning.size() >= kMaxKerningPairs)
+		_kerning.clear();
+	_kerning[pair] = kerningVector.x / 64;
 	return (kerningVector.x / 64);
 }
 
@@ -21,6 +21,7 @@
 
 #include "graphics/framelimiter.h"
 
+#include "common/events.h"
 #include "common/util.h"
 
 namespace Graphics {
@@ -29,7 +30,8 @@ FrameLimiter::FrameLimiter(OSystem *system, const uint framerate, const bool vsy
 		_system(system),
 		_speedLimitMs(0),
 		_startFrameTime(0),
-		_lastFrameDurationMs(_speedLimitMs) {
+		_lastFrameDurationMs(_speedLimitMs),
+		_wokeEarly(false) {
 	// The frame limiter is disabled when vsync is enabled.
 	_enabled = !(vsync && _system->getFeatureState(OSystem::kFeatureVSync)) && (framerate != 0);
 
@@ -53,7 +55,13 @@ void FrameLimiter::delayBeforeSwap() {
 	uint frameDuration = endFrameTime - _startFrameTime;
 
 	if (_enabled && frameDuration < _speedLimitMs) {
-		_system->delayMillis(_speedLimitMs - frameDuration);
+		Common::EventManager *eventManager = _system->getEventManager();
+		if (eventManager && !_wokeEarly) {
+			_wokeEarly = eventManager->waitForEventOrDeadline(_startFrameTime + _speedLimitMs);
+		} else {
+			_system->delayMillis(_speedLimitMs - frameDuration);
+			_wokeEarly = false;
+		}
 	}
 }
 
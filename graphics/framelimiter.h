@@ -33,6 +33,12 @@ namespace Graphics {
  * by delaying until all of the timeslot allocated to the frame
  * is consumed.
  * Allows to curb CPU usage and have a stable framerate.
+ *
+ * The delay sleeps until an input event arrives, so that the next frame
+ * can handle it right away, or until the end of the timeslot. To keep the
+ * framerate bounded while events keep coming, a frame cut short is
+ * followed by one taking all of its timeslot. With vsync the swap paces
+ * the frames, and the limiter does not delay.
  */
 class FrameLimiter {
 public:
@@ -51,6 +57,7 @@ private:
 	uint _speedLimitMs;
 	uint _startFrameTime;
 	uint _lastFrameDurationMs;
+	bool _wokeEarly;
 };
 
 } // End of namespace Graphics
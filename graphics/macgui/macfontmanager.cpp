@@ -334,6 +334,8 @@ void MacFontManager::loadJapaneseFonts() {
 		_ttfData[fontName + "-0-0"] = stream;
 	}
 
+	_noSubstituteFonts.clear();
+
 	delete dat;
 #else
 	warning("Japanese fonts require FreeType");
@@ -362,6 +364,8 @@ void MacFontManager::loadFonts(const Common::Path &fileName) {
 }
 
 void MacFontManager::loadFonts(Common::MacResManager *fontFile) {
+	_noSubstituteFonts.clear();
+
 	Common::MacResIDArray fonts = fontFile->getResIDArray(MKTAG('F','O','N','D'));
 	if (fonts.size() > 0) {
 		for (auto &curFont : fonts) {
@@ -470,6 +474,7 @@ void MacFontManager::loadWindowsFont(const Common::Path &fileName) {
 
 	Common::String fontName = winFont->getName();
 	_winFontRegistry.setVal(fontName, winFont);
+	_noSubstituteFonts.clear();
 	MacFont *font = new MacFont();
 	Common::String fullName = Common::String::format("%s-%d-%d", fontName.c_str(), winFont->getStyle(), winFont->getFontSizeInPointsAtDPI(72));
 	font->setName(fullName);
@@ -483,7 +488,9 @@ const Font *MacFontManager::getFont(MacFont *macFont) {
 	Common::String name;
 	const Font *font = 0;
 
-	debugC(2, kDebugLevelMacGUI, "MacFontManager::getFont(%s), id: %d", getFontName(macFont->getId(), macFont->getSize(), macFont->getSlant(), 0).c_str(), macFont->getId());
+	// Don't make up the name when it is not printed, this is called for every run of text
+	if (debugChannelSet(2, kDebugLevelMacGUI))
+		debugC(2, kDebugLevelMacGUI, "MacFontManager::getFont(%s), id: %d", getFontName(macFont->getId(), macFont->getSize(), macFont->getSlant(), 0).c_str(), macFont->getId());
 
 	int aliasForId = getFontAliasForId(macFont->getId());
 	if (aliasForId > -1) {
@@ -514,7 +521,7 @@ const Font *MacFontManager::getFont(MacFont *macFont) {
 				const Graphics::WinFont *winfont = (const Graphics::WinFont *)font;
 
 				if (winfont->getFontSizeInPointsAtDPI(72) != macFont->getSize()) {
-					Common::String fullFontName = Common::String::format("%s-%d-%d", winfont->getName().c_str(), winfont->getStyle(), winfont->getFontSizeInPointsAtDPI(72));
+					Common::String fullFontName = Common::String::format("%s-%d-%d", winfont->getName().c_str(), winfont->getStyle(), macFont->getSize());
 
 					if (_winFontRegistry.contains(fullFontName)) {
 						font = _winFontRegistry.getVal(fullFontName);
@@ -542,8 +549,12 @@ const Font *MacFontManager::getFont(MacFont *macFont) {
 					macFont->setName(name);
 				}
 
-				if (!_fontRegistry.contains(macFont->getName()))
+				if (!_fontRegistry.contains(macFont->getName()) && !_noSubstituteFonts.contains(macFont->getName())) {
 					generateFontSubstitute(*macFont);
+
+					if (!_fontRegistry.contains(macFont->getName()))
+						_noSubstituteFonts.setVal(macFont->getName(), true);
+				}
 			}
 
 			font = FontMan.getFontByName(macFont->getName());
@@ -994,6 +1005,9 @@ void MacFont::setFallback(const Font *font, Common::String name) {
 }
 
 void MacFontManager::printFontRegistry(int debugLevel, uint32 channel) {
+		if (!debugChannelSet(debugLevel, channel))
+			return;
+
 		debugC(debugLevel, channel, "Font Registry: %d items", _fontRegistry.size());
 
 		for (auto &font : _fontRegistry) {
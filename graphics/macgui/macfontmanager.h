@@ -226,6 +226,9 @@ private:
 	Common::HashMap<Common::String, MacFont *> _fontRegistry;
 	Common::Array<MacFontFamily *> _fontFamilies;
 
+	/* Fonts which generateFontSubstitute() found nothing for, until more fonts get loaded */
+	Common::HashMap<Common::String, bool> _noSubstituteFonts;
+
 	Common::HashMap<int, FontInfo *> _fontInfo;
 	Common::HashMap<Common::String, int> _fontIds;
 
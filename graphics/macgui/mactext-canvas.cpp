@@ -962,14 +962,22 @@ int MacTextCanvas::getLineHeight(int line) {
 	return _text[line].height;
 }
 
-void MacTextCanvas::recalcDims() {
+void MacTextCanvas::recalcDims(uint fromLine) {
 	if (_text.empty())
 		return;
 
 	int y = 0;
-	_textMaxWidth = 0;
 
-	for (uint i = 0; i < _text.size(); i++) {
+	// The lines before fromLine are unchanged, so their positions and
+	// widths, which are already in _textMaxWidth, are still valid
+	if (fromLine > 0 && fromLine < _text.size()) {
+		y = _text[fromLine - 1].y + MAX(getLineHeight(fromLine - 1), _interLinear);
+	} else {
+		fromLine = 0;
+		_textMaxWidth = 0;
+	}
+
+	for (uint i = fromLine; i < _text.size(); i++) {
 		_text[i].y = y;
 
 		// We must calculate width first, because it enforces
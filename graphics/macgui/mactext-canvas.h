@@ -128,7 +128,14 @@ public:
 public:
 	~MacTextCanvas();
 
-	void recalcDims();
+	/**
+	 * Recalculates the positions of the lines and the text dimensions.
+	 *
+	 * @param fromLine  The first line that changed. The lines before it must
+	 *                  be untouched and the changed ones may only have grown,
+	 *                  as it happens when text is appended.
+	 */
+	void recalcDims(uint fromLine = 0);
 	void reallocSurface();
 	void render(int from, int to);
 	void render(int from, int to, int shadow);
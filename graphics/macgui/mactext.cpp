@@ -593,8 +593,8 @@ void MacText::setInterLinear(int interLinear) {
 	_contentIsDirty = true;
 }
 
-void MacText::recalcDims() {
-	_canvas.recalcDims();
+void MacText::recalcDims(uint fromLine) {
+	_canvas.recalcDims(fromLine);
 
 	if (!_fixedDims) {
 		int newBottom = _dims.top + _canvas._textMaxHeight + (2 * _border) + _gutter + _shadow;
@@ -747,8 +747,12 @@ void MacText::appendText(const Common::U32String &str, const Font *font, uint16
 void MacText::appendText_(const Common::U32String &strWithFont, uint oldLen) {
 	clearChunkInput();
 
+	// Only the last line and the new ones need to be measured, unless
+	// lines were dropped before appending
+	uint keptLen = _canvas._text.size();
+
 	_canvas.splitString(strWithFont, -1, _defaultFormatting);
-	recalcDims();
+	recalcDims(keptLen < oldLen ? 0 : keptLen - 1);
 
 	_canvas.render(oldLen - 1, _canvas._text.size());
 
@@ -774,7 +778,7 @@ void MacText::appendTextDefault(const Common::U32String &str, bool skipAdd) {
 		_str += strWithFont;
 	}
 	_canvas.splitString(strWithFont, -1, _defaultFormatting);
-	recalcDims();
+	recalcDims(oldLen - 1);
 
 	_canvas.render(oldLen - 1, _canvas._text.size());
 }
@@ -162,6 +162,15 @@ public:
 	 */
 	virtual bool isDirty() = 0;
 
+	/**
+	 * Limit the next screen update of the window contents to a part of them.
+	 * The rect is relative to the inner dimensions and is dropped once the WM
+	 * has drawn the window. An empty rect means all of the contents.
+	 * @param r Area of the contents that changed.
+	 */
+	void setDirtyContentRect(const Common::Rect &r) { _dirtyContentRect = r; }
+	const Common::Rect &getDirtyContentRect() const { return _dirtyContentRect; }
+
 	/**
 	 * Set the callback that will be used when an event needs to be processed.
 	 * @param callback A function pointer to a function that accepts:
@@ -183,6 +192,8 @@ protected:
 	bool _visible;
 
 	bool _draggable;
+
+	Common::Rect _dirtyContentRect;
 };
 
 /**
@@ -940,6 +940,11 @@ void MacWindowManager::draw() {
 	Common::Array<Common::Rect> dirtyRects;
 	for (Common::List<BaseMacWindow *>::const_iterator it = _windowStack.begin(); it != _windowStack.end(); it++) {
 		BaseMacWindow *w = *it;
+
+		// The hint is only good for the update directly following it
+		Common::Rect dirtyContent = w->getDirtyContentRect();
+		w->setDirtyContentRect(Common::Rect());
+
 		if (!w->isVisible())
 			continue;
 
@@ -997,7 +1002,20 @@ void MacWindowManager::draw() {
 				}
 
 				adjustDimensions(clip, innerDims, adjWidth, adjHeight);
-				g_system->copyRectToScreen(w->getWindowSurface()->getBasePtr(MAX(clip.left - innerDims.left, 0), MAX(clip.top - innerDims.top, 0)), w->getWindowSurface()->pitch,MAX(innerDims.left, (int16)0), MAX(innerDims.top, (int16)0), adjWidth, adjHeight);
+				int srcX = MAX(clip.left - innerDims.left, 0);
+				int srcY = MAX(clip.top - innerDims.top, 0);
+				int dstX = MAX(innerDims.left, (int16)0);
+				int dstY = MAX(innerDims.top, (int16)0);
+				Common::Rect dst(dstX, dstY, dstX + adjWidth, dstY + adjHeight);
+
+				if (!forceRedraw && !dirtyContent.isEmpty()) {
+					// Only send the part of the contents the window told us about
+					dirtyContent.translate(dstX - srcX, dstY - srcY);
+					dst.clip(dirtyContent);
+				}
+
+				if (!dst.isEmpty())
+					g_system->copyRectToScreen(w->getWindowSurface()->getBasePtr(srcX + dst.left - dstX, srcY + dst.top - dstY), w->getWindowSurface()->pitch, dst.left, dst.top, dst.width(), dst.height());
 
 				dirtyRects.push_back(clip);
 			}
@@ -495,87 +495,113 @@ void ManagedSurface::blitFrom(const ManagedSurface &src, const Common::Rect &src
 		blitFromInner(src._innerSurface, srcRect, destRect, src._palette);
 }
 
-void ManagedSurface::blitFromInner(const Surface &src, const Common::Rect &srcRect,
+template<int BYTES>
+static inline uint32 readPixel(const byte *p) {
+	if (BYTES == 1)
+		return *p;
+	else if (BYTES == 2)
+		return *(const uint16 *)p;
+	else if (BYTES == 4)
+		return *(const uint32 *)p;
+	else
+		return READ_UINT24(p);
+}
+
+template<int BYTES>
+static inline void writePixel(byte *p, uint32 color) {
+	if (BYTES == 1)
+		*p = color;
+	else if (BYTES == 2)
+		*(uint16 *)p = color;
+	else if (BYTES == 4)
+		*(uint32 *)p = color;
+	else
+		WRITE_UINT24(p, color);
+}
+
+/**
+ * Handles the unscaled blits of ManagedSurface::blitFromInner() which need
+ * no per pixel decisions: copying rows when every source pixel is opaque
+ * and in the destination format, and converting them with the blit
+ * functions otherwise.
+ *
+ * @return False if the pixels have to go through blitFromPixels().
+ */
+static bool blitFromRows(const Surface &src, const Common::Rect &srcRect, ManagedSurface &dest,
 		const Common::Rect &destRect, const Palette *srcPalette) {
+	Common::Rect destRectC = destRect;
+	destRectC.clip(Common::Rect(dest.w, dest.h));
+	if (destRectC.isEmpty())
+		return true;
+
+	const byte *srcP = (const byte *)src.getBasePtr(srcRect.left + destRectC.left - destRect.left,
+		srcRect.top + destRectC.top - destRect.top);
+	byte *destP = (byte *)dest.getBasePtr(destRectC.left, destRectC.top);
+	const uint width = destRectC.width();
+	const uint height = destRectC.height();
+
+	// For paletted format, assume the palette is the same and there is no transparency.
+	// We can thus do a straight copy of the pixels.
+	if (dest.format.isCLUT8() || (dest.format == src.format && src.format.aBits() == 0)) {
+		copyBlit(destP, srcP, dest.pitch, src.pitch, width, height, dest.format.bytesPerPixel);
+		return true;
+	}
 
-	if (destRect.isEmpty())
-		return;
+	if (src.format.isCLUT8())
+		return crossBlitMap(destP, srcP, dest.pitch, src.pitch, width, height, dest.format.bytesPerPixel,
+			srcPalette->getMap(dest.format));
 
-	const int scaleX = SCALE_THRESHOLD * srcRect.width() / destRect.width();
-	const int scaleY = SCALE_THRESHOLD * srcRect.height() / destRect.height();
+	if (src.format.aBits() == 0)
+		return crossBlit(destP, srcP, dest.pitch, src.pitch, width, height, dest.format, src.format);
 
-	if (!srcRect.isValidRect())
-		return;
+	return false;
+}
 
+/**
+ * The per pixel loop of ManagedSurface::blitFromInner(), specialized on the
+ * sizes of the source and destination pixels. CLUT8 sources are looked up
+ * in the map of their palette.
+ */
+template<int SRC_BYTES, int DEST_BYTES>
+static void blitFromPixels(const Surface &src, const Common::Rect &srcRect, ManagedSurface &dest,
+		const Common::Rect &destRect, int scaleX, int scaleY, uint32 alphaMask, const uint32 *map) {
 	// Copy format so compiler can optimize better.
 	// This should allow it to do some loop optimizations and condition hoisting as it can tell nothing
 	// inside of the loop will clobber the format.
-	Graphics::PixelFormat destFormat = format;
-	Graphics::PixelFormat srcFormat = src.format;
+	const Graphics::PixelFormat destFormat = dest.format;
+	const Graphics::PixelFormat srcFormat = src.format;
+	const bool isSameFormat = (destFormat == srcFormat);
 
-	bool isSameFormat = (destFormat == srcFormat);
-	if (!isSameFormat) {
-		assert(destFormat.bytesPerPixel == 1 || destFormat.bytesPerPixel == 2 || destFormat.bytesPerPixel == 3 || destFormat.bytesPerPixel == 4);
-		assert(srcFormat.bytesPerPixel == 1 || srcFormat.bytesPerPixel == 2 || srcFormat.bytesPerPixel == 3 || srcFormat.bytesPerPixel == 4);
-		if (srcFormat.bytesPerPixel == 1) {
-			// When the pixel format differs, the destination must be non-paletted
-			assert(!destFormat.isCLUT8() && srcPalette && srcPalette->size() > 0);
-		}
-	}
+	// Clip the destination once instead of testing every pixel
+	const int destLeft = MAX<int>(destRect.left, 0);
+	const int destRight = MIN<int>(destRect.right, dest.w);
+	const int destTop = MAX<int>(destRect.top, 0);
+	const int destBottom = MIN<int>(destRect.bottom, dest.h);
 
-
-	uint32 alphaMask = 0;
-	if (srcFormat.aBits() > 0)
-		alphaMask = (((static_cast<uint32>(1) << (srcFormat.aBits() - 1)) - 1) * 2 + 1) << srcFormat.aShift;
-
-	const bool noScale = scaleX == SCALE_THRESHOLD && scaleY == SCALE_THRESHOLD;
-	for (int destY = destRect.top, scaleYCtr = 0; destY < destRect.bottom; ++destY, scaleYCtr += scaleY) {
-		if (destY < 0 || destY >= h)
-			continue;
+	for (int destY = destTop, scaleYCtr = (destTop - destRect.top) * scaleY; destY < destBottom; ++destY, scaleYCtr += scaleY) {
 		const byte *srcP = (const byte *)src.getBasePtr(srcRect.left, scaleYCtr / SCALE_THRESHOLD + srcRect.top);
-		byte *destP = (byte *)getBasePtr(destRect.left, destY);
-
-		// For paletted format, assume the palette is the same and there is no transparency.
-		// We can thus do a straight copy of the pixels.
-		if (destFormat.isCLUT8() && noScale) {
-			int width = srcRect.width();
-			if (destRect.left + width > w)
-				width = w - destRect.left;
-			if (destRect.left < 0) {
-				srcP -= destRect.left;
-				destP -= destRect.left;
-				width += destRect.left;
-			}
-			if (width > 0)
-				Common::copy(srcP, srcP + width, destP);
-			continue;
-		}
+		byte *destP = (byte *)dest.getBasePtr(destRect.left, destY);
 
 		// Loop through drawing the pixels of the row
-		for (int destX = destRect.left, xCtr = 0, scaleXCtr = 0; destX < destRect.right; ++destX, ++xCtr, scaleXCtr += scaleX) {
-			if (destX < 0 || destX >= w)
-				continue;
-
-			const byte *srcVal = &srcP[scaleXCtr / SCALE_THRESHOLD * srcFormat.bytesPerPixel];
-			byte *destVal = &destP[xCtr * destFormat.bytesPerPixel];
-			if (destFormat.isCLUT8()) {
+		for (int xCtr = destLeft - destRect.left, scaleXCtr = xCtr * scaleX; xCtr < destRight - destRect.left; ++xCtr, scaleXCtr += scaleX) {
+			const byte *srcVal = &srcP[scaleXCtr / SCALE_THRESHOLD * SRC_BYTES];
+			byte *destVal = &destP[xCtr * DEST_BYTES];
+			if (DEST_BYTES == 1) {
 				*destVal = *srcVal;
 				continue;
 			}
 
-			uint32 col = 0;
 			// Use the src's pixel format to split up the source pixel
-			if (srcFormat.bytesPerPixel == 1)
-				col = *reinterpret_cast<const uint8 *>(srcVal);
-			else if (srcFormat.bytesPerPixel == 2)
-				col = *reinterpret_cast<const uint16 *>(srcVal);
-			else if (srcFormat.bytesPerPixel == 4)
-				col = *reinterpret_cast<const uint32 *>(srcVal);
-			else
-				col = READ_UINT24(srcVal);
+			const uint32 col = readPixel<SRC_BYTES>(srcVal);
 
-			const bool isOpaque = srcFormat.isCLUT8() ? true : ((col & alphaMask) == alphaMask);
-			const bool isTransparent = srcFormat.isCLUT8() ? false : ((col & alphaMask) == 0);
+			if (map) {
+				// Paletted source pixels are always opaque
+				writePixel<DEST_BYTES>(destVal, map[col]);
+				continue;
+			}
+
+			const bool isOpaque = ((col & alphaMask) == alphaMask);
+			const bool isTransparent = ((col & alphaMask) == 0);
 
 			uint32 destPixel = 0;
 
@@ -591,12 +617,7 @@ void ManagedSurface::blitFromInner(const Surface &src, const Common::Rect &srcRe
 				byte aDest = 0, rDest = 0, gDest = 0, bDest = 0;
 
 				// Different format or partially transparent
-				if (srcFormat.isCLUT8()) {
-					srcPalette->get(col, rSrc, gSrc, bSrc);
-					aSrc = 0xff;
-				} else {
-					srcFormat.colorToARGB(col, aSrc, rSrc, gSrc, bSrc);
-				}
+				srcFormat.colorToARGB(col, aSrc, rSrc, gSrc, bSrc);
 
 				if (isOpaque) {
 					aDest = aSrc;
@@ -605,15 +626,7 @@ void ManagedSurface::blitFromInner(const Surface &src, const Common::Rect &srcRe
 					bDest = bSrc;
 				} else {
 					// Partially transparent, so calculate new pixel colors
-					uint32 destColor;
-					if (destFormat.bytesPerPixel == 1)
-						destColor = *reinterpret_cast<uint8 *>(destVal);
-					else if (destFormat.bytesPerPixel == 2)
-						destColor = *reinterpret_cast<uint16 *>(destVal);
-					else if (destFormat.bytesPerPixel == 4)
-						destColor = *reinterpret_cast<uint32 *>(destVal);
-					else
-						destColor = READ_UINT24(destVal);
+					const uint32 destColor = readPixel<DEST_BYTES>(destVal);
 
 					destFormat.colorToARGB(destColor, aDest, rDest, gDest, bDest);
 
@@ -637,20 +650,79 @@ void ManagedSurface::blitFromInner(const Surface &src, const Common::Rect &srcRe
 				destPixel = destFormat.ARGBToColor(aDest, rDest, gDest, bDest);
 			}
 
-			if (destFormat.bytesPerPixel == 1)
-				*(uint8 *)destVal = destPixel;
-			else if (destFormat.bytesPerPixel == 2)
-				*(uint16 *)destVal = destPixel;
-			else if (destFormat.bytesPerPixel == 4)
-				*(uint32 *)destVal = destPixel;
-			else
-				WRITE_UINT24(destVal, destPixel);
+			writePixel<DEST_BYTES>(destVal, destPixel);
+		}
+	}
+}
+
+#define HANDLE_BLIT(SRC_BYTES, DEST_BYTES) \
+	if (srcFormat.bytesPerPixel == SRC_BYTES && destFormat.bytesPerPixel == DEST_BYTES) \
+		blitFromPixels<SRC_BYTES, DEST_BYTES>(src, srcRect, *this, destRect, scaleX, scaleY, alphaMask, map); \
+	else
+
+void ManagedSurface::blitFromInner(const Surface &src, const Common::Rect &srcRect,
+		const Common::Rect &destRect, const Palette *srcPalette) {
+
+	if (destRect.isEmpty())
+		return;
+
+	const int scaleX = SCALE_THRESHOLD * srcRect.width() / destRect.width();
+	const int scaleY = SCALE_THRESHOLD * srcRect.height() / destRect.height();
+
+	if (!srcRect.isValidRect())
+		return;
+
+	const Graphics::PixelFormat &destFormat = format;
+	const Graphics::PixelFormat &srcFormat = src.format;
+
+	bool isSameFormat = (destFormat == srcFormat);
+	if (!isSameFormat) {
+		assert(destFormat.bytesPerPixel == 1 || destFormat.bytesPerPixel == 2 || destFormat.bytesPerPixel == 3 || destFormat.bytesPerPixel == 4);
+		assert(srcFormat.bytesPerPixel == 1 || srcFormat.bytesPerPixel == 2 || srcFormat.bytesPerPixel == 3 || srcFormat.bytesPerPixel == 4);
+		if (srcFormat.bytesPerPixel == 1) {
+			// When the pixel format differs, the destination must be non-paletted
+			assert(!destFormat.isCLUT8() && srcPalette && srcPalette->size() > 0);
 		}
 	}
 
+
+	uint32 alphaMask = 0;
+	if (srcFormat.aBits() > 0)
+		alphaMask = (((static_cast<uint32>(1) << (srcFormat.aBits() - 1)) - 1) * 2 + 1) << srcFormat.aShift;
+
+	const bool noScale = scaleX == SCALE_THRESHOLD && scaleY == SCALE_THRESHOLD;
+	if (noScale && blitFromRows(src, srcRect, *this, destRect, srcPalette)) {
+		addDirtyRect(destRect);
+		return;
+	}
+
+	const uint32 *map = nullptr;
+	if (srcFormat.isCLUT8() && !destFormat.isCLUT8())
+		map = srcPalette->getMap(destFormat);
+
+	HANDLE_BLIT(1, 1)
+	HANDLE_BLIT(1, 2)
+	HANDLE_BLIT(1, 3)
+	HANDLE_BLIT(1, 4)
+	HANDLE_BLIT(2, 1)
+	HANDLE_BLIT(2, 2)
+	HANDLE_BLIT(2, 3)
+	HANDLE_BLIT(2, 4)
+	HANDLE_BLIT(3, 1)
+	HANDLE_BLIT(3, 2)
+	HANDLE_BLIT(3, 3)
+	HANDLE_BLIT(3, 4)
+	HANDLE_BLIT(4, 1)
+	HANDLE_BLIT(4, 2)
+	HANDLE_BLIT(4, 3)
+	HANDLE_BLIT(4, 4)
+	error("Surface::blitFrom: bytesPerPixel must be 1, 2, 3 or 4");
+
 	addDirtyRect(destRect);
 }
 
+#undef HANDLE_BLIT
+
 void ManagedSurface::transBlitFrom(const Surface &src, uint32 transColor, bool flipped,
 		uint32 srcAlpha, const Palette *srcPalette) {
 	transBlitFrom(src, Common::Rect(0, 0, src.w, src.h), Common::Rect(0, 0, this->w, this->h),
@@ -793,72 +865,131 @@ void transBlitPixel<byte, byte>(byte srcVal, byte &destVal, const Graphics::Pixe
 		destVal = lookup[destVal];
 }
 
-template<typename TSRC, typename TDEST>
-void transBlit(const Surface &src, const Common::Rect &srcRect, ManagedSurface &dest, const Common::Rect &destRect,
-		TSRC transColor, bool flipped, uint32 srcAlpha, const Palette *srcPalette,
-		const Palette *dstPalette) {
+/** How transBlit() recognizes the transparent pixels of the destination. */
+enum TransBlitDestKey {
+	kTransBlitDestKeyNone,	///< The destination has no transparent color
+	kTransBlitDestKeyValue,	///< Compare the pixel values
+	kTransBlitDestKeyRGB	///< Compare the RGB values, whatever the alpha
+};
+
+/**
+ * The per pixel loop of transBlit(), specialized on how the source and
+ * destination transparent colors are matched. With a map, the opaque
+ * CLUT8 source pixels are looked up in it.
+ */
+template<typename TSRC, typename TDEST, bool SRC_KEY_RGB, int DEST_KEY>
+void transBlitPixels(const Surface &src, const Common::Rect &srcRect, ManagedSurface &dest, const Common::Rect &destRect,
+		TSRC transColor, bool flipped, uint32 srcAlpha, const Palette *srcPalette, const byte *lookup, const uint32 *map) {
 	int scaleX = SCALE_THRESHOLD * srcRect.width() / destRect.width();
 	int scaleY = SCALE_THRESHOLD * srcRect.height() / destRect.height();
 	byte rst = 0, gst = 0, bst = 0, rdt = 0, gdt = 0, bdt = 0;
 	byte r = 0, g = 0, b = 0;
 
-	byte *lookup = nullptr;
-	if (srcPalette && dstPalette)
-		lookup = createPaletteLookup(srcPalette, dstPalette);
-
-	// If we're dealing with a 32-bit source surface, we need to split up the RGB,
-	// since we'll want to find matching RGB pixels irrespective of the alpha
-	bool isSrcTrans32 = src.format.aBits() != 0 && transColor != (uint32)-1 && transColor > 0;
-	if (isSrcTrans32) {
+	if (SRC_KEY_RGB) {
 		src.format.colorToRGB(transColor, rst, gst, bst);
 	}
-	bool isDestTrans32 = dest.format.aBits() != 0 && dest.hasTransparentColor();
-	if (isDestTrans32) {
-		dest.format.colorToRGB(dest.getTransparentColor(), rdt, gdt, bdt);
+	const uint32 destTransColor = dest.getTransparentColor();
+	if (DEST_KEY == kTransBlitDestKeyRGB) {
+		dest.format.colorToRGB(destTransColor, rdt, gdt, bdt);
 	}
 
+	// Clip the destination once instead of testing every pixel
+	const int destLeft = MAX<int>(destRect.left, 0);
+	const int destRight = MIN<int>(destRect.right, dest.w);
+	const int destTop = MAX<int>(destRect.top, 0);
+	const int destBottom = MIN<int>(destRect.bottom, dest.h);
+	if (destLeft >= destRight)
+		return;
+
+	// Unscaled keyed copies between paletted surfaces need no conversion at all
+	const bool plainCopy = sizeof(TSRC) == 1 && sizeof(TDEST) == 1 && !SRC_KEY_RGB && DEST_KEY == kTransBlitDestKeyNone &&
+		!map && !lookup && !flipped && srcAlpha != 0 && scaleX == SCALE_THRESHOLD;
+
 	// Loop through drawing output lines
-	for (int destY = destRect.top, scaleYCtr = 0; destY < destRect.bottom; ++destY, scaleYCtr += scaleY) {
-		if (destY < 0 || destY >= dest.h)
-			continue;
+	for (int destY = destTop, scaleYCtr = (destTop - destRect.top) * scaleY; destY < destBottom; ++destY, scaleYCtr += scaleY) {
 		const TSRC *srcLine = (const TSRC *)src.getBasePtr(srcRect.left, scaleYCtr / SCALE_THRESHOLD + srcRect.top);
 		TDEST *destLine = (TDEST *)dest.getBasePtr(destRect.left, destY);
 
-		// Loop through drawing the pixels of the row
-		for (int destX = destRect.left, xCtr = 0, scaleXCtr = 0; destX < destRect.right; ++destX, ++xCtr, scaleXCtr += scaleX) {
-			if (destX < 0 || destX >= dest.w)
-				continue;
+		if (plainCopy) {
+			for (int xCtr = destLeft - destRect.left; xCtr < destRight - destRect.left; ++xCtr) {
+				const TSRC srcVal = srcLine[xCtr];
+				if (srcVal != transColor)
+					destLine[xCtr] = (TDEST)srcVal;
+			}
+			continue;
+		}
 
+		// Loop through drawing the pixels of the row
+		for (int xCtr = destLeft - destRect.left, scaleXCtr = xCtr * scaleX; xCtr < destRight - destRect.left; ++xCtr, scaleXCtr += scaleX) {
 			TSRC srcVal = srcLine[flipped ? src.w - scaleXCtr / SCALE_THRESHOLD - 1 : scaleXCtr / SCALE_THRESHOLD];
 			TDEST &destVal = destLine[xCtr];
 
-			dest.format.colorToRGB(destVal, r, g, b);
+			if (SRC_KEY_RGB) {
+				src.format.colorToRGB(srcVal, r, g, b);
+				if (rst == r && gst == g && bst == b)
+					continue;
+
+			} else if (srcVal == transColor)
+				continue;
 
 			// Check if dest pixel is transparent
 			bool isDestPixelTrans = false;
-			if (isDestTrans32) {
+			if (DEST_KEY == kTransBlitDestKeyRGB) {
 				dest.format.colorToRGB(destVal, r, g, b);
 				if (rdt == r && gdt == g && bdt == b)
 					isDestPixelTrans = true;
-			} else if (dest.hasTransparentColor()) {
-				isDestPixelTrans = destVal == dest.getTransparentColor();
+			} else if (DEST_KEY == kTransBlitDestKeyValue) {
+				isDestPixelTrans = destVal == destTransColor;
 			}
 
-			if (isSrcTrans32) {
-				src.format.colorToRGB(srcVal, r, g, b);
-				if (rst == r && gst == g && bst == b)
-					continue;
-
-			} else if (srcVal == transColor)
-				continue;
-
 			if (isDestPixelTrans)
 				// Remove transparent color on dest so it isn't alpha blended
 				destVal = 0;
 
-			transBlitPixel<TSRC, TDEST>(srcVal, destVal, src.format, dest.format, srcAlpha, srcPalette, lookup);
+			if (map)
+				destVal = map[srcVal];
+			else
+				transBlitPixel<TSRC, TDEST>(srcVal, destVal, src.format, dest.format, srcAlpha, srcPalette, lookup);
 		}
 	}
+}
+
+template<typename TSRC, typename TDEST>
+void transBlit(const Surface &src, const Common::Rect &srcRect, ManagedSurface &dest, const Common::Rect &destRect,
+		TSRC transColor, bool flipped, uint32 srcAlpha, const Palette *srcPalette,
+		const Palette *dstPalette) {
+	byte *lookup = nullptr;
+	if (srcPalette && dstPalette)
+		lookup = createPaletteLookup(srcPalette, dstPalette);
+
+	// Opaque paletted pixels only need their color in the destination format
+	const uint32 *map = nullptr;
+	if (src.format.isCLUT8() && !dest.format.isCLUT8() && srcAlpha == 0xff && srcPalette && srcPalette->size() > 0)
+		map = srcPalette->getMap(dest.format);
+
+	// If we're dealing with a 32-bit source surface, we need to split up the RGB,
+	// since we'll want to find matching RGB pixels irrespective of the alpha
+	bool isSrcTrans32 = src.format.aBits() != 0 && transColor != (uint32)-1 && transColor > 0;
+	int destKey = kTransBlitDestKeyNone;
+	if (dest.format.aBits() != 0 && dest.hasTransparentColor())
+		destKey = kTransBlitDestKeyRGB;
+	else if (dest.hasTransparentColor())
+		destKey = kTransBlitDestKeyValue;
+
+#define HANDLE_KEYS(SRC_KEY_RGB, DEST_KEY) \
+	if (isSrcTrans32 == SRC_KEY_RGB && destKey == DEST_KEY) \
+		transBlitPixels<TSRC, TDEST, SRC_KEY_RGB, DEST_KEY>(src, srcRect, dest, destRect, transColor, flipped, srcAlpha, srcPalette, lookup, map); \
+	else
+
+	HANDLE_KEYS(false, kTransBlitDestKeyNone)
+	HANDLE_KEYS(false, kTransBlitDestKeyValue)
+	HANDLE_KEYS(false, kTransBlitDestKeyRGB)
+	HANDLE_KEYS(true,  kTransBlitDestKeyNone)
+	HANDLE_KEYS(true,  kTransBlitDestKeyValue)
+	HANDLE_KEYS(true,  kTransBlitDestKeyRGB)
+	{}
+
+#undef HANDLE_KEYS
 
 	delete[] lookup;
 }
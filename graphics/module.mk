@@ -97,6 +97,15 @@ MODULE_OBJS += \
 	tinygl/ztriangle.o \
 	tinygl/zblit.o \
 	tinygl/zdirtyrect.o
+
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	tinygl/zspan-neon.o
+endif
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	tinygl/zspan-sse2.o
+endif
 endif
 
 ifdef USE_ASPECT
@@ -107,6 +116,7 @@ endif
 ifdef USE_SCALERS
 MODULE_OBJS += \
 	scaler/dotmatrix.o \
+	scaler/rowkernels.o \
 	scaler/sai.o \
 	scaler/pm.o \
 	scaler/scale2x.o \
@@ -137,6 +147,19 @@ MODULE_OBJS += \
 	scaler/edge.o
 endif
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	scaler/rowkernels-neon.o
+endif
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	scaler/rowkernels-sse2.o
+endif
+ifdef SCUMMVM_AVX2
+MODULE_OBJS += \
+	scaler/rowkernels-avx2.o
+endif
+
 endif
 
 ifdef ATARI
@@ -146,15 +169,18 @@ endif
 
 ifdef SCUMMVM_NEON
 MODULE_OBJS += \
-	blit/blit-neon.o
+	blit/blit-neon.o \
+	yuv_to_rgb-neon.o
 endif
 ifdef SCUMMVM_SSE2
 MODULE_OBJS += \
-	blit/blit-sse2.o
+	blit/blit-sse2.o \
+	yuv_to_rgb-sse2.o
 endif
 ifdef SCUMMVM_AVX2
 MODULE_OBJS += \
-	blit/blit-avx2.o
+	blit/blit-avx2.o \
+	yuv_to_rgb-avx2.o
 endif
 
 # Include common rules
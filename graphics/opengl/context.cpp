@@ -78,6 +78,7 @@ void Context::reset() {
 	textureBorderClampSupported = false;
 	textureMirrorRepeatSupported = false;
 	textureMaxLevelSupported = false;
+	pixelBufferObjectSupported = false;
 }
 
 void Context::initialize(ContextType contextType) {
@@ -167,6 +168,7 @@ void Context::initialize(ContextType contextType) {
 
 	bool EXTFramebufferMultisample = false;
 	bool EXTFramebufferBlit = false;
+	bool ARBMapBufferRange = false;
 
 	Common::StringTokenizer tokenizer(extString, " ");
 	while (!tokenizer.empty()) {
@@ -199,6 +201,8 @@ void Context::initialize(ContextType contextType) {
 			textureMirrorRepeatSupported = true;
 		} else if (token == "GL_SGIS_texture_lod" || token == "GL_APPLE_texture_max_level") {
 			textureMaxLevelSupported = true;
+		} else if (token == "GL_ARB_map_buffer_range") {
+			ARBMapBufferRange = true;
 		}
 	}
 
@@ -235,6 +239,7 @@ void Context::initialize(ContextType contextType) {
 			textureMaxLevelSupported = true;
 			unpackSubImageSupported = true;
 			OESDepth24 = true;
+			pixelBufferObjectSupported = true;
 		}
 		// OpenGL ES 3.2 and later always has texture border clamp support
 		if (isGLVersionOrHigher(3, 2)) {
@@ -280,11 +285,20 @@ void Context::initialize(ContextType contextType) {
 		if (isGLVersionOrHigher(1, 4)) {
 			textureMirrorRepeatSupported = true;
 		}
+		// OpenGL 2.1 adds pixel buffer objects, and 3.0 mapping ranges of buffers
+		if (isGLVersionOrHigher(3, 0) || (isGLVersionOrHigher(2, 1) && ARBMapBufferRange)) {
+			pixelBufferObjectSupported = true;
+		}
 		debug(5, "OpenGL: GL context initialized");
 	} else {
 		warning("OpenGL: Unknown context initialized");
 	}
 
+#ifndef USE_GLAD
+	// Only the GLAD loader provides the entry points for mapping buffers
+	pixelBufferObjectSupported = false;
+#endif
+
 	if (framebufferObjectMultisampleSupported) {
 		glGetIntegerv(GL_MAX_SAMPLES, (GLint *)&multisampleMaxSamples);
 	}
@@ -314,6 +328,7 @@ void Context::initialize(ContextType contextType) {
 	debug(5, "OpenGL: Texture border clamping support: %d", textureBorderClampSupported);
 	debug(5, "OpenGL: Texture mirror repeat support: %d", textureMirrorRepeatSupported);
 	debug(5, "OpenGL: Texture max level support: %d", textureMaxLevelSupported);
+	debug(5, "OpenGL: Pixel buffer object support: %d", pixelBufferObjectSupported);
 }
 
 int Context::getGLSLVersion() const {
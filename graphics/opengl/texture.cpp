@@ -37,13 +37,17 @@ Texture::Texture(GLenum glIntFormat, GLenum glFormat, GLenum glType, bool autoCr
 	: _glIntFormat(glIntFormat), _glFormat(glFormat), _glType(glType),
 	  _width(0), _height(0), _logicalWidth(0), _logicalHeight(0),
 	  _texCoords(), _glFilter(GL_NEAREST),
-	  _glTexture(0) {
+	  _glTexture(0), _usePixelBuffers(false), _pixelBuffers(), _pixelBufferSizes(),
+	  _nextPixelBuffer(0) {
 	if (autoCreate)
 		create();
 }
 
 Texture::~Texture() {
 	GL_CALL_SAFE(glDeleteTextures, (1, &_glTexture));
+#ifdef USE_GLAD
+	GL_CALL_SAFE(glDeleteBuffers, (2, _pixelBuffers));
+#endif
 }
 
 void Texture::enableLinearFiltering(bool enable) {
@@ -106,6 +110,19 @@ void Texture::setWrapMode(WrapMode wrapMode) {
 void Texture::destroy() {
 	GL_CALL(glDeleteTextures(1, &_glTexture));
 	_glTexture = 0;
+
+	destroyPixelBuffers();
+}
+
+void Texture::destroyPixelBuffers() {
+#ifdef USE_GLAD
+	if (_pixelBuffers[0] || _pixelBuffers[1]) {
+		GL_CALL(glDeleteBuffers(2, _pixelBuffers));
+	}
+#endif
+	_pixelBuffers[0] = _pixelBuffers[1] = 0;
+	_pixelBufferSizes[0] = _pixelBufferSizes[1] = 0;
+	_nextPixelBuffer = 0;
 }
 
 void Texture::create() {
@@ -192,13 +209,24 @@ void Texture::updateArea(const Common::Rect &area, const Graphics::Surface &src)
 	// Set the texture on the active texture unit.
 	bind();
 
+	// When the context lets us specify the pitch of the source data, upload
+	// exactly the area.
+	const uint bytesPerPixel = src.format.bytesPerPixel;
+	if (OpenGLContext.unpackSubImageSupported && bytesPerPixel && src.pitch % bytesPerPixel == 0) {
+		GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, src.pitch / bytesPerPixel));
+		GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, area.left, area.top, area.width(), area.height(),
+		                        _glFormat, _glType, src.getBasePtr(area.left, area.top)));
+		GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+		return;
+	}
+
 	// Update the actual texture.
 	// Although we have the area of the texture buffer we want to update we
 	// cannot take advantage of the left/right boundaries here because it is
-	// not possible to specify a pitch to glTexSubImage2D. To be precise, with
-	// plain OpenGL we could set GL_UNPACK_ROW_LENGTH to achieve this. However,
-	// OpenGL ES 1.0 does not support GL_UNPACK_ROW_LENGTH. Thus, we are left
-	// with the following options:
+	// not possible to specify a pitch to glTexSubImage2D without
+	// GL_UNPACK_ROW_LENGTH, which OpenGL ES 1.0 and 2.0 do not support
+	// unless they have GL_EXT_unpack_subimage. Thus, we are left with the
+	// following options:
 	//
 	// 1) (As we do right now) Simply always update the whole texture lines of
 	//    rect changed. This is simplest to implement. In case performance is
@@ -214,6 +242,95 @@ void Texture::updateArea(const Common::Rect &area, const Graphics::Surface &src)
 	                       _glFormat, _glType, src.getBasePtr(0, area.top)));
 }
 
+void Texture::updateAreas(const Common::Rect *areas, uint count, const Graphics::Surface &src) {
+	if (_usePixelBuffers && OpenGLContext.pixelBufferObjectSupported && updateAreasFromPixelBuffer(areas, count, src)) {
+		return;
+	}
+
+	for (uint i = 0; i < count; ++i) {
+		updateArea(areas[i], src);
+	}
+}
+
+bool Texture::updateAreasFromPixelBuffer(const Common::Rect *areas, uint count, const Graphics::Surface &src) {
+#ifdef USE_GLAD
+	// Every area is stored with its rows packed, starting on a 4 byte boundary.
+	const uint bytesPerPixel = src.format.bytesPerPixel;
+	uint size = 0;
+	for (uint i = 0; i < count; ++i) {
+		size += (areas[i].width() * areas[i].height() * bytesPerPixel + 3) & ~3;
+	}
+
+	if (!size) {
+		return true;
+	}
+
+	// The buffer was last used two uploads ago, so the driver should be
+	// done with it. Its contents are invalidated on mapping, so it never
+	// has to be synced anyway.
+	GLuint &buffer = _pixelBuffers[_nextPixelBuffer];
+	uint &bufferSize = _pixelBufferSizes[_nextPixelBuffer];
+	_nextPixelBuffer ^= 1;
+
+	if (!buffer) {
+		GL_CALL(glGenBuffers(1, &buffer));
+	}
+
+	GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, buffer));
+	if (bufferSize < size) {
+		GL_CALL(glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW));
+		bufferSize = size;
+	}
+
+	byte *dst;
+	GL_ASSIGN(dst, (byte *)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT));
+	if (!dst) {
+		GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+		return false;
+	}
+
+	uint offset = 0;
+	for (uint i = 0; i < count; ++i) {
+		const Common::Rect &area = areas[i];
+		const uint rowSize = area.width() * bytesPerPixel;
+
+		const byte *srcRow = (const byte *)src.getBasePtr(area.left, area.top);
+		for (int y = 0; y < area.height(); ++y) {
+			memcpy(dst + offset + y * rowSize, srcRow, rowSize);
+			srcRow += src.pitch;
+		}
+
+		offset += (rowSize * area.height() + 3) & ~3;
+	}
+
+	GLboolean unmapped;
+	GL_ASSIGN(unmapped, glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER));
+	if (!unmapped) {
+		// The buffer contents were lost, e.g. because the display mode changed.
+		GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+		return false;
+	}
+
+	// Set the texture on the active texture unit, and upload from the buffer.
+	bind();
+
+	offset = 0;
+	for (uint i = 0; i < count; ++i) {
+		const Common::Rect &area = areas[i];
+		if (!area.isEmpty()) {
+			GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, area.left, area.top, area.width(), area.height(),
+			                        _glFormat, _glType, (const void *)(uintptr)offset));
+		}
+		offset += (area.width() * area.height() * bytesPerPixel + 3) & ~3;
+	}
+
+	GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+	return true;
+#else
+	return false;
+#endif
+}
+
 const Graphics::PixelFormat Texture::getRGBAPixelFormat() {
 #ifdef SCUMM_BIG_ENDIAN
 	return Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0);
@@ -112,6 +112,32 @@ public:
 	 */
 	void updateArea(const Common::Rect &area, const Graphics::Surface &src);
 
+	/**
+	 * Copy several areas of image data to the texture.
+	 *
+	 * With pixel buffers enabled, all areas are packed into one buffer and
+	 * uploaded from there in one go.
+	 *
+	 * @param areas    The areas to update.
+	 * @param count    The number of areas.
+	 * @param src      Surface for the whole texture containing the pixel data
+	 *                 to upload.
+	 */
+	void updateAreas(const Common::Rect *areas, uint count, const Graphics::Surface &src);
+
+	/**
+	 * Upload image data through pixel buffer objects when the context
+	 * supports them.
+	 *
+	 * The data is then copied into a buffer owned by the driver and
+	 * transferred to the texture asynchronously, instead of
+	 * glTexSubImage2D waiting for the GPU to be done with the texture.
+	 * Two buffers are used in turns, so that filling one never waits for
+	 * the upload from the other. This is worth it for textures which are
+	 * updated every frame.
+	 */
+	void enablePixelBuffers(bool enable) { _usePixelBuffers = enable; }
+
 	/**
 	 * Query the GL texture's width.
 	 */
@@ -159,6 +185,15 @@ protected:
 	GLint _glFilter;
 
 	GLuint _glTexture;
+
+private:
+	bool updateAreasFromPixelBuffer(const Common::Rect *areas, uint count, const Graphics::Surface &src);
+	void destroyPixelBuffers();
+
+	bool _usePixelBuffers;
+	GLuint _pixelBuffers[2];
+	uint _pixelBufferSizes[2];
+	uint _nextPixelBuffer;
 };
 
 } // End of namespace OpenGL
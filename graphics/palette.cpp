@@ -18,6 +18,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "graphics/blit.h"
 #include "graphics/palette.h"
 
 namespace Graphics {
@@ -32,13 +33,13 @@ static const byte EGA_PALETTE[16][3] = {
 };
 
 
-Palette::Palette(uint size) : _data(nullptr), _size(size) {
+Palette::Palette(uint size) : _data(nullptr), _size(size), _map(nullptr) {
 	if (_size > 0) {
 		_data = new byte[_size * 3]();
 	}
 }
 
-Palette::Palette(const byte *data, uint size) : _data(nullptr), _size(0) {
+Palette::Palette(const byte *data, uint size) : _data(nullptr), _size(0), _map(nullptr) {
 	if (data && size > 0) {
 		_size = size;
 		_data = new byte[_size * 3]();
@@ -46,7 +47,7 @@ Palette::Palette(const byte *data, uint size) : _data(nullptr), _size(0) {
 	}
 }
 
-Palette::Palette(const Palette &p) : _data(nullptr), _size(p._size) {
+Palette::Palette(const Palette &p) : _data(nullptr), _size(p._size), _map(nullptr) {
 	if (_size > 0) {
 		_data = new byte[_size * 3]();
 		memcpy(_data, p._data, _size * 3);
@@ -55,6 +56,7 @@ Palette::Palette(const Palette &p) : _data(nullptr), _size(p._size) {
 
 Palette::~Palette() {
 	delete[] _data;
+	delete[] _map;
 }
 
 Palette Palette::createEGAPalette() {
@@ -63,6 +65,7 @@ Palette Palette::createEGAPalette() {
 
 
 Palette &Palette::operator=(const Palette &rhs) {
+	invalidateMap();
 	delete[] _data;
 	_data = nullptr;
 	_size = rhs._size;
@@ -84,12 +87,14 @@ bool Palette::contains(const Palette& p) const {
 }
 
 void Palette::clear() {
+	invalidateMap();
 	delete[] _data;
 	_data = nullptr;
 	_size = 0;
 }
 
 void Palette::resize(uint newSize, bool preserve) {
+	invalidateMap();
 	if (newSize > _size) {
 		byte *newData = nullptr;
 		if (newSize > 0) {
@@ -165,14 +170,31 @@ byte Palette::findBestColor(byte cr, byte cg, byte cb, ColorDistanceMethod metho
 
 void Palette::set(const byte *colors, uint start, uint num) {
 	assert(start < _size && (start + num) <= _size);
+	invalidateMap();
 	memcpy(_data + 3 * start, colors, 3 * num);
 }
 
 void Palette::set(const Palette &p, uint start, uint num) {
 	assert(start < _size && (start + num) <= _size);
+	invalidateMap();
 	memcpy(_data + 3 * start, p._data, 3 * num);
 }
 
+const uint32 *Palette::getMap(const PixelFormat &format) const {
+	if (_map && _mapFormat == format && format.bytesPerPixel != 0)
+		return _map;
+
+	if (!_map)
+		_map = new uint32[PALETTE_COUNT];
+
+	convertPaletteToMap(_map, _data, MIN<uint>(_size, PALETTE_COUNT), format);
+	for (uint i = _size; i < PALETTE_COUNT; i++)
+		_map[i] = 0;
+	_mapFormat = format;
+
+	return _map;
+}
+
 void Palette::grab(byte *colors, uint start, uint num) const {
 	assert(start < _size && (start + num) <= _size);
 	memcpy(colors, _data + 3 * start, 3 * num);
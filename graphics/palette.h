@@ -24,6 +24,8 @@
 
 #include "common/hashmap.h"
 
+#include "graphics/pixelformat.h"
+
 namespace Graphics {
 
 enum ColorDistanceMethod {
@@ -52,6 +54,12 @@ class Palette {
 	byte *_data;
 	uint16 _size;
 
+	/** The colors converted by getMap(), valid as long as _mapFormat is set. */
+	mutable uint32 *_map;
+	mutable PixelFormat _mapFormat;
+
+	void invalidateMap() { _mapFormat = PixelFormat(); }
+
 public:
 	static const uint16 npos = 0xFFFF;
 
@@ -105,6 +113,7 @@ public:
 
 	void set(uint entry, byte r, byte g, byte b) {
 		assert(entry < _size);
+		invalidateMap();
 		_data[entry * 3 + 0] = r;
 		_data[entry * 3 + 1] = g;
 		_data[entry * 3 + 2] = b;
@@ -139,6 +148,17 @@ public:
 	 */
 	byte findBestColor(byte r, byte g, byte b, ColorDistanceMethod method = kColorDistanceRedmean) const;
 
+	/**
+	 * Returns the colors of the palette in the given format, as a map for
+	 * crossBlitMap() with PALETTE_COUNT entries, the ones past the size of
+	 * the palette being zero.
+	 *
+	 * The map is kept until the palette changes or a map for another
+	 * format is asked for, so blitting from the same palette over and over
+	 * converts it only once.
+	 */
+	const uint32 *getMap(const PixelFormat &format) const;
+
 	/**
 	 * Replace the specified range of the palette with new colors.
 	 * The palette entries from 'start' till (start+num-1) will be replaced - so
@@ -97,6 +97,8 @@
 #include "common/system.h"
 #include "graphics/scaler/intern.h"
 #include "graphics/scaler/edge.h"
+#include "graphics/scaler/rowkernels.h"
+#include "common/array.h"
 
 /* Randomly XORs one of 2x2 or 3x3 resized pixels in order to indicate
  * which pixels have been redrawn.  Useful for seeing which areas of
@@ -3236,29 +3238,6 @@ void EdgeScaler::antiAliasGrid2x(uint8 *dptr, int dstPitch,
 
 
 /* Check for changed pixel grid, return 1 if unchanged. */
-template<typename Pixel>
-int checkUnchangedPixels(const Pixel *old_src_ptr, const Pixel *pixels, int w) {
-	const Pixel *dptr;
-
-	dptr = old_src_ptr - w - 1;
-	if (*dptr++ != pixels[0]) return 0;
-	if (*dptr++ != pixels[1]) return 0;
-	if (*dptr != pixels[2]) return 0;
-
-	dptr += w - 2;
-	if (*dptr != pixels[3]) return 0;
-	dptr += 2;
-	if (*dptr != pixels[5]) return 0;
-
-	dptr += w - 2;
-	if (*dptr++ != pixels[6]) return 0;
-	if (*dptr++ != pixels[7]) return 0;
-	if (*dptr != pixels[8]) return 0;
-
-	return 1;
-}
-
-
 /* Draw unchanged pixel grid, 3x */
 /* old_dptr starts in top left of grid, dptr in center */
 template<typename Pixel>
@@ -3320,7 +3299,6 @@ void EdgeScaler::antiAliasPass3x(const uint8 *src, uint8 *dst,
 	const uint8 *sptr8 = src;
 	uint8 *dptr8 = dst + dstPitch + sizeof(Pixel);
 	const Pixel *sptr16;
-	const Pixel *oldSptr;
 	const Pixel *oldDptr;
 	Pixel *dptr16;
 	int16 *bplane;
@@ -3331,13 +3309,19 @@ void EdgeScaler::antiAliasPass3x(const uint8 *src, uint8 *dst,
 	int dstPitch3 = dstPitch * 3;
 	int bufferPitch3 = bufferPitch * 3;
 
+	// Which 3x3 blocks of the row are the same as in the old source
+	Common::Array<uint8> unchanged(haveOldSrc ? w : 0);
+	assert(!haveOldSrc || oldPitch == srcPitch);
+
 	for (y = 0; y < h; y++, sptr8 += srcPitch, dptr8 += dstPitch3, oldSrc += oldPitch, buffer += bufferPitch3) {
+		if (haveOldSrc)
+			Graphics::edgeUnchangedRow((const Pixel *)sptr8, (const Pixel *)oldSrc, srcPitch / sizeof(Pixel), unchanged.data(), w);
+
 		for (x = 0,
 		        sptr16 = (const Pixel *) sptr8,
-		        oldSptr = (const Pixel *) oldSrc,
 		        oldDptr = (const Pixel *) buffer,
 		        dptr16 = (Pixel *) dptr8;
-		        x < w; x++, sptr16++, dptr16 += 3, oldDptr += 3, oldSptr++) {
+		        x < w; x++, sptr16++, dptr16 += 3, oldDptr += 3) {
 			const Pixel *sptr2, *addr3;
 			Pixel pixels[9];
 			char edge_type;
@@ -3352,11 +3336,11 @@ void EdgeScaler::antiAliasPass3x(const uint8 *src, uint8 *dst,
 
 			if (haveOldSrc) {
 				/* skip interior unchanged 3x3 blocks */
-				if (*sptr16 == *oldSptr &&
+				if (unchanged[x]
 #if DEBUG_DRAW_REFRESH_BORDERS
-						x > 0 && x < w - 1 && y > 0 && y < h - 1 &&
+						&& x > 0 && x < w - 1 && y > 0 && y < h - 1
 #endif
-						checkUnchangedPixels(oldSptr, pixels, oldPitch / sizeof(Pixel))) {
+						) {
 					drawUnchangedGrid3x<Pixel>((byte *)dptr16, dstPitch, (const byte *)oldDptr, bufferPitch);
 
 #if DEBUG_REFRESH_RANDOM_XOR
@@ -3405,7 +3389,6 @@ void EdgeScaler::antiAliasPass2x(const uint8 *src, uint8 *dst,
 	const uint8 *sptr8 = src;
 	uint8 *dptr8 = dst;
 	const Pixel *sptr16;
-	const Pixel *oldSptr;
 	const Pixel *oldDptr;
 	Pixel *dptr16;
 	int16 *bplane;
@@ -3416,13 +3399,19 @@ void EdgeScaler::antiAliasPass2x(const uint8 *src, uint8 *dst,
 	int dstPitch2 = dstPitch << 1;
 	int bufferPitch2 = bufferPitch * 2;
 
+	// Which 3x3 blocks of the row are the same as in the old source
+	Common::Array<uint8> unchanged(haveOldSrc ? w : 0);
+	assert(!haveOldSrc || oldSrcPitch == srcPitch);
+
 	for (y = 0; y < h; y++, sptr8 += srcPitch, dptr8 += dstPitch2, oldSrc += oldSrcPitch, buffer += bufferPitch2) {
+		if (haveOldSrc)
+			Graphics::edgeUnchangedRow((const Pixel *)sptr8, (const Pixel *)oldSrc, srcPitch / sizeof(Pixel), unchanged.data(), w);
+
 		for (x = 0,
 		        sptr16 = (const Pixel *) sptr8,
 		        dptr16 = (Pixel *) dptr8,
-				oldSptr = (const Pixel *) oldSrc,
 				oldDptr = (const Pixel *) buffer;
-		        x < w; x++, sptr16++, dptr16 += 2, oldDptr += 2, oldSptr++) {
+		        x < w; x++, sptr16++, dptr16 += 2, oldDptr += 2) {
 			const Pixel *sptr2, *addr3;
 			Pixel pixels[9];
 			char edge_type;
@@ -3437,11 +3426,11 @@ void EdgeScaler::antiAliasPass2x(const uint8 *src, uint8 *dst,
 
 			if (haveOldSrc) {
 				/* skip interior unchanged 3x3 blocks */
-				if (*sptr16 == *oldSptr &&
+				if (unchanged[x]
 #if DEBUG_DRAW_REFRESH_BORDERS
-						x > 0 && x < w - 1 && y > 0 && y < h - 1 &&
+						&& x > 0 && x < w - 1 && y > 0 && y < h - 1
 #endif
-						checkUnchangedPixels<Pixel>(oldSptr, pixels, oldSrcPitch / sizeof(Pixel))) {
+						) {
 					drawUnchangedGrid2x<Pixel>((byte *)dptr16, dstPitch, (const byte *)oldDptr, bufferPitch);
 
 #if DEBUG_REFRESH_RANDOM_XOR
@@ -21,6 +21,8 @@
 #include "graphics/scaler/hq.h"
 #include "graphics/scaler.h"
 #include "graphics/scaler/intern.h"
+#include "graphics/scaler/rowkernels.h"
+#include "common/array.h"
 
 // RGB-to-YUV lookup table
 
@@ -193,6 +195,19 @@ static inline uint32 ConvertYUV(uint32 x, const uint32 *RGBtoYUV) {
 	return RGBtoYUV[r | g | b];
 }
 
+/**
+ * Convert a row of pixels to YUV, see ConvertYUV.
+ */
+template<typename ColorMask>
+static inline void ConvertYUVRow(const typename ColorMask::PixelType *src, uint32 *dst, int count, const uint32 *RGBtoYUV) {
+	if (sizeof(typename ColorMask::PixelType) == 2) {
+		Graphics::hqConvertYUVRow((const uint16 *)src, dst, count, RGBtoYUV);
+	} else {
+		for (int x = 0; x < count; ++x)
+			dst[x] = ConvertYUV<ColorMask>(src[x], RGBtoYUV);
+	}
+}
+
 /*
  * The HQ2x high quality 2x graphics filter.
  * Original author Maxim Stepin (https://web.archive.org/web/20090204033742/http://www.hiend3d.com/hq2x.html).
@@ -221,7 +236,23 @@ static void HQ2x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 	//	 | w7 | w8 | w9 |
 	//	 +----+----+----+
 
+	// YUV values of the rows above, at and below the current one, with one
+	// pixel of border on each side. They are converted once per row, and
+	// the patterns of the whole row are computed in one go.
+	Common::Array<uint32> yuvRows(3 * (width + 2));
+	uint32 *yuvPrev = &yuvRows[1];
+	uint32 *yuvCur = yuvPrev + width + 2;
+	uint32 *yuvNext = yuvCur + width + 2;
+	Common::Array<uint8> patterns(width);
+
+	ConvertYUVRow<ColorMask>(p - nextlineSrc - 1, yuvPrev - 1, width + 2, RGBtoYUV);
+	ConvertYUVRow<ColorMask>(p - 1, yuvCur - 1, width + 2, RGBtoYUV);
+
 	while (height--) {
+		ConvertYUVRow<ColorMask>(p + nextlineSrc - 1, yuvNext - 1, width + 2, RGBtoYUV);
+		Graphics::hqPatternRow(yuvPrev, yuvCur, yuvNext, patterns.data(), width);
+		const uint8 *pattern = patterns.data();
+
 		w1 = *(p - 1 - nextlineSrc);
 		w4 = *(p - 1);
 		w7 = *(p - 1 + nextlineSrc);
@@ -238,18 +269,7 @@ static void HQ2x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 			w6 = *(p);
 			w9 = *(p + nextlineSrc);
 
-			int pattern = 0;
-			const int yuv5 = YUV(5);
-			if (w5 != w1 && diffYUV(yuv5, YUV(1))) pattern |= 0x0001;
-			if (w5 != w2 && diffYUV(yuv5, YUV(2))) pattern |= 0x0002;
-			if (w5 != w3 && diffYUV(yuv5, YUV(3))) pattern |= 0x0004;
-			if (w5 != w4 && diffYUV(yuv5, YUV(4))) pattern |= 0x0008;
-			if (w5 != w6 && diffYUV(yuv5, YUV(6))) pattern |= 0x0010;
-			if (w5 != w7 && diffYUV(yuv5, YUV(7))) pattern |= 0x0020;
-			if (w5 != w8 && diffYUV(yuv5, YUV(8))) pattern |= 0x0040;
-			if (w5 != w9 && diffYUV(yuv5, YUV(9))) pattern |= 0x0080;
-
-			switch (pattern) {
+			switch (*pattern++) {
 			case 0:
 			case 1:
 			case 4:
@@ -2053,6 +2073,11 @@ static void HQ2x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 		}
 		p += nextlineSrc - width;
 		q += (nextlineDst - width) * 2;
+
+		uint32 *yuvTmp = yuvPrev;
+		yuvPrev = yuvCur;
+		yuvCur = yuvNext;
+		yuvNext = yuvTmp;
 	}
 }
 
@@ -2139,7 +2164,23 @@ static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 	//	 | w7 | w8 | w9 |
 	//	 +----+----+----+
 
+	// YUV values of the rows above, at and below the current one, with one
+	// pixel of border on each side. They are converted once per row, and
+	// the patterns of the whole row are computed in one go.
+	Common::Array<uint32> yuvRows(3 * (width + 2));
+	uint32 *yuvPrev = &yuvRows[1];
+	uint32 *yuvCur = yuvPrev + width + 2;
+	uint32 *yuvNext = yuvCur + width + 2;
+	Common::Array<uint8> patterns(width);
+
+	ConvertYUVRow<ColorMask>(p - nextlineSrc - 1, yuvPrev - 1, width + 2, RGBtoYUV);
+	ConvertYUVRow<ColorMask>(p - 1, yuvCur - 1, width + 2, RGBtoYUV);
+
 	while (height--) {
+		ConvertYUVRow<ColorMask>(p + nextlineSrc - 1, yuvNext - 1, width + 2, RGBtoYUV);
+		Graphics::hqPatternRow(yuvPrev, yuvCur, yuvNext, patterns.data(), width);
+		const uint8 *pattern = patterns.data();
+
 		w1 = *(p - 1 - nextlineSrc);
 		w4 = *(p - 1);
 		w7 = *(p - 1 + nextlineSrc);
@@ -2156,18 +2197,7 @@ static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 			w6 = *(p);
 			w9 = *(p + nextlineSrc);
 
-			int pattern = 0;
-			const int yuv5 = YUV(5);
-			if (w5 != w1 && diffYUV(yuv5, YUV(1))) pattern |= 0x0001;
-			if (w5 != w2 && diffYUV(yuv5, YUV(2))) pattern |= 0x0002;
-			if (w5 != w3 && diffYUV(yuv5, YUV(3))) pattern |= 0x0004;
-			if (w5 != w4 && diffYUV(yuv5, YUV(4))) pattern |= 0x0008;
-			if (w5 != w6 && diffYUV(yuv5, YUV(6))) pattern |= 0x0010;
-			if (w5 != w7 && diffYUV(yuv5, YUV(7))) pattern |= 0x0020;
-			if (w5 != w8 && diffYUV(yuv5, YUV(8))) pattern |= 0x0040;
-			if (w5 != w9 && diffYUV(yuv5, YUV(9))) pattern |= 0x0080;
-
-			switch (pattern) {
+			switch (*pattern++) {
 			case 0:
 			case 1:
 			case 4:
@@ -4944,6 +4974,11 @@ static void HQ3x_implementation(const uint8 *srcPtr, uint32 srcPitch, uint8 *dst
 		}
 		p += nextlineSrc - width;
 		q += (nextlineDst - width) * 3;
+
+		uint32 *yuvTmp = yuvPrev;
+		yuvPrev = yuvCur;
+		yuvCur = yuvNext;
+		yuvNext = yuvTmp;
 	}
 }
 
@@ -0,0 +1,121 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "graphics/scaler/rowkernels.h"
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+namespace Graphics {
+
+int hqConvertYUVRowAVX2(const uint16 *src, uint32 *dst, int count, const uint32 *RGBtoYUV) {
+	int x = 0;
+
+	for (; x + 8 <= count; x += 8) {
+		const __m256i indices = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(src + x)));
+		_mm256_storeu_si256((__m256i *)(dst + x), _mm256_i32gather_epi32((const int *)RGBtoYUV, indices, 4));
+	}
+	return x;
+}
+
+/** @see similarYUV in rowkernels-sse2.cpp */
+static FORCEINLINE __m256i similarYUV(__m256i a, __m256i b, __m256i thresholds) {
+	const __m256i diff = _mm256_or_si256(_mm256_subs_epu8(a, b), _mm256_subs_epu8(b, a));
+	return _mm256_cmpeq_epi32(_mm256_subs_epu8(diff, thresholds), _mm256_setzero_si256());
+}
+
+static FORCEINLINE __m256i neighborBit(__m256i yuv5, const uint32 *neighbor, __m256i thresholds, int bit) {
+	return _mm256_andnot_si256(similarYUV(yuv5, _mm256_loadu_si256((const __m256i *)neighbor), thresholds), _mm256_set1_epi32(bit));
+}
+
+int hqPatternRowAVX2(const uint32 *yuvPrev, const uint32 *yuvCur, const uint32 *yuvNext, uint8 *patterns, int width) {
+	// Same as trY, trU and trV of diffYUV
+	const __m256i thresholds = _mm256_set1_epi32(0x00300706);
+	int x = 0;
+
+	for (; x + 8 <= width; x += 8) {
+		const __m256i yuv5 = _mm256_loadu_si256((const __m256i *)(yuvCur + x));
+		__m256i pattern;
+
+		pattern =                          neighborBit(yuv5, yuvPrev + x - 1, thresholds, 0x01);
+		pattern = _mm256_or_si256(pattern, neighborBit(yuv5, yuvPrev + x,     thresholds, 0x02));
+		pattern = _mm256_or_si256(pattern, neighborBit(yuv5, yuvPrev + x + 1, thresholds, 0x04));
+		pattern = _mm256_or_si256(pattern, neighborBit(yuv5, yuvCur + x - 1,  thresholds, 0x08));
+		pattern = _mm256_or_si256(pattern, neighborBit(yuv5, yuvCur + x + 1,  thresholds, 0x10));
+		pattern = _mm256_or_si256(pattern, neighborBit(yuv5, yuvNext + x - 1, thresholds, 0x20));
+		pattern = _mm256_or_si256(pattern, neighborBit(yuv5, yuvNext + x,     thresholds, 0x40));
+		pattern = _mm256_or_si256(pattern, neighborBit(yuv5, yuvNext + x + 1, thresholds, 0x80));
+
+		const __m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(pattern), _mm256_extracti128_si256(pattern, 1));
+		_mm_storel_epi64((__m128i *)(patterns + x), _mm_packus_epi16(packed, packed));
+	}
+	return x;
+}
+
+int edgeUnchangedRowAVX2(const uint16 *src, const uint16 *oldSrc, int pitch, uint8 *unchanged, int width) {
+	int x = 0;
+
+	for (; x + 16 <= width; x += 16) {
+		__m256i equal = _mm256_set1_epi32(-1);
+		for (int offset = x - pitch - 1; offset <= x + pitch - 1; offset += pitch) {
+			for (int i = 0; i < 3; ++i) {
+				const __m256i a = _mm256_loadu_si256((const __m256i *)(src + offset + i));
+				const __m256i b = _mm256_loadu_si256((const __m256i *)(oldSrc + offset + i));
+				equal = _mm256_and_si256(equal, _mm256_cmpeq_epi16(a, b));
+			}
+		}
+		const __m128i packed = _mm_packs_epi16(_mm256_castsi256_si128(equal), _mm256_extracti128_si256(equal, 1));
+		_mm_storeu_si128((__m128i *)(unchanged + x), _mm_and_si128(packed, _mm_set1_epi8(1)));
+	}
+	return x;
+}
+
+int edgeUnchangedRowAVX2(const uint32 *src, const uint32 *oldSrc, int pitch, uint8 *unchanged, int width) {
+	int x = 0;
+
+	for (; x + 8 <= width; x += 8) {
+		__m256i equal = _mm256_set1_epi32(-1);
+		for (int offset = x - pitch - 1; offset <= x + pitch - 1; offset += pitch) {
+			for (int i = 0; i < 3; ++i) {
+				const __m256i a = _mm256_loadu_si256((const __m256i *)(src + offset + i));
+				const __m256i b = _mm256_loadu_si256((const __m256i *)(oldSrc + offset + i));
+				equal = _mm256_and_si256(equal, _mm256_cmpeq_epi32(a, b));
+			}
+		}
+		const __m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(equal), _mm256_extracti128_si256(equal, 1));
+		_mm_storel_epi64((__m128i *)(unchanged + x), _mm_and_si128(_mm_packs_epi16(packed, packed), _mm_set1_epi8(1)));
+	}
+	return x;
+}
+
+} // End of namespace Graphics
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
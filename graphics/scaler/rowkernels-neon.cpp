@@ -0,0 +1,127 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "graphics/scaler/rowkernels.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Graphics {
+
+/** @see similarYUV in rowkernels-sse2.cpp */
+static FORCEINLINE uint32x4_t similarYUV(uint32x4_t a, uint32x4_t b, uint8x16_t thresholds) {
+	const uint8x16_t diff = vabdq_u8(vreinterpretq_u8_u32(a), vreinterpretq_u8_u32(b));
+	return vceqq_u32(vreinterpretq_u32_u8(vqsubq_u8(diff, thresholds)), vdupq_n_u32(0));
+}
+
+static FORCEINLINE uint32x4_t neighborBit(uint32x4_t yuv5, const uint32 *neighbor, uint8x16_t thresholds, uint32 bit) {
+	return vbicq_u32(vdupq_n_u32(bit), similarYUV(yuv5, vld1q_u32(neighbor), thresholds));
+}
+
+static FORCEINLINE uint16x4_t pattern4(const uint32 *prev, const uint32 *cur, const uint32 *next, uint8x16_t thresholds) {
+	const uint32x4_t yuv5 = vld1q_u32(cur);
+	uint32x4_t pattern;
+
+	pattern =                    neighborBit(yuv5, prev - 1, thresholds, 0x01);
+	pattern = vorrq_u32(pattern, neighborBit(yuv5, prev,     thresholds, 0x02));
+	pattern = vorrq_u32(pattern, neighborBit(yuv5, prev + 1, thresholds, 0x04));
+	pattern = vorrq_u32(pattern, neighborBit(yuv5, cur - 1,  thresholds, 0x08));
+	pattern = vorrq_u32(pattern, neighborBit(yuv5, cur + 1,  thresholds, 0x10));
+	pattern = vorrq_u32(pattern, neighborBit(yuv5, next - 1, thresholds, 0x20));
+	pattern = vorrq_u32(pattern, neighborBit(yuv5, next,     thresholds, 0x40));
+	pattern = vorrq_u32(pattern, neighborBit(yuv5, next + 1, thresholds, 0x80));
+	return vmovn_u32(pattern);
+}
+
+int hqPatternRowNEON(const uint32 *yuvPrev, const uint32 *yuvCur, const uint32 *yuvNext, uint8 *patterns, int width) {
+	// Same as trY, trU and trV of diffYUV
+	const uint8x16_t thresholds = vreinterpretq_u8_u32(vdupq_n_u32(0x00300706));
+	int x = 0;
+
+	for (; x + 8 <= width; x += 8) {
+		const uint16x4_t lo = pattern4(yuvPrev + x, yuvCur + x, yuvNext + x, thresholds);
+		const uint16x4_t hi = pattern4(yuvPrev + x + 4, yuvCur + x + 4, yuvNext + x + 4, thresholds);
+		vst1_u8(patterns + x, vmovn_u16(vcombine_u16(lo, hi)));
+	}
+	return x;
+}
+
+int edgeUnchangedRowNEON(const uint16 *src, const uint16 *oldSrc, int pitch, uint8 *unchanged, int width) {
+	int x = 0;
+
+	for (; x + 8 <= width; x += 8) {
+		uint16x8_t equal = vdupq_n_u16(0xFFFF);
+		for (int offset = x - pitch - 1; offset <= x + pitch - 1; offset += pitch) {
+			for (int i = 0; i < 3; ++i)
+				equal = vandq_u16(equal, vceqq_u16(vld1q_u16(src + offset + i), vld1q_u16(oldSrc + offset + i)));
+		}
+		vst1_u8(unchanged + x, vand_u8(vmovn_u16(equal), vdup_n_u8(1)));
+	}
+	return x;
+}
+
+int edgeUnchangedRowNEON(const uint32 *src, const uint32 *oldSrc, int pitch, uint8 *unchanged, int width) {
+	int x = 0;
+
+	for (; x + 8 <= width; x += 8) {
+		uint32x4_t equalLo = vdupq_n_u32(0xFFFFFFFF);
+		uint32x4_t equalHi = vdupq_n_u32(0xFFFFFFFF);
+		for (int offset = x - pitch - 1; offset <= x + pitch - 1; offset += pitch) {
+			for (int i = 0; i < 3; ++i) {
+				const uint32 *a = src + offset + i;
+				const uint32 *b = oldSrc + offset + i;
+				equalLo = vandq_u32(equalLo, vceqq_u32(vld1q_u32(a), vld1q_u32(b)));
+				equalHi = vandq_u32(equalHi, vceqq_u32(vld1q_u32(a + 4), vld1q_u32(b + 4)));
+			}
+		}
+		const uint16x8_t equal = vcombine_u16(vmovn_u32(equalLo), vmovn_u32(equalHi));
+		vst1_u8(unchanged + x, vand_u8(vmovn_u16(equal), vdup_n_u8(1)));
+	}
+	return x;
+}
+
+} // End of namespace Graphics
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,127 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "graphics/scaler/rowkernels.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Graphics {
+
+/**
+ * Per lane, all bits set when the YUV values are within the diffYUV
+ * thresholds. The components are one byte each, so the absolute
+ * differences are taken bytewise, and the thresholds are subtracted
+ * with saturation: anything left over is a difference.
+ */
+static FORCEINLINE __m128i similarYUV(__m128i a, __m128i b, __m128i thresholds) {
+	const __m128i diff = _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a));
+	return _mm_cmpeq_epi32(_mm_subs_epu8(diff, thresholds), _mm_setzero_si128());
+}
+
+static FORCEINLINE __m128i pattern4(const uint32 *prev, const uint32 *cur, const uint32 *next, __m128i thresholds) {
+	const __m128i yuv5 = _mm_loadu_si128((const __m128i *)cur);
+	__m128i pattern;
+
+	pattern =                       _mm_andnot_si128(similarYUV(yuv5, _mm_loadu_si128((const __m128i *)(prev - 1)), thresholds), _mm_set1_epi32(0x01));
+	pattern = _mm_or_si128(pattern, _mm_andnot_si128(similarYUV(yuv5, _mm_loadu_si128((const __m128i *)(prev)), thresholds), _mm_set1_epi32(0x02)));
+	pattern = _mm_or_si128(pattern, _mm_andnot_si128(similarYUV(yuv5, _mm_loadu_si128((const __m128i *)(prev + 1)), thresholds), _mm_set1_epi32(0x04)));
+	pattern = _mm_or_si128(pattern, _mm_andnot_si128(similarYUV(yuv5, _mm_loadu_si128((const __m128i *)(cur - 1)), thresholds), _mm_set1_epi32(0x08)));
+	pattern = _mm_or_si128(pattern, _mm_andnot_si128(similarYUV(yuv5, _mm_loadu_si128((const __m128i *)(cur + 1)), thresholds), _mm_set1_epi32(0x10)));
+	pattern = _mm_or_si128(pattern, _mm_andnot_si128(similarYUV(yuv5, _mm_loadu_si128((const __m128i *)(next - 1)), thresholds), _mm_set1_epi32(0x20)));
+	pattern = _mm_or_si128(pattern, _mm_andnot_si128(similarYUV(yuv5, _mm_loadu_si128((const __m128i *)(next)), thresholds), _mm_set1_epi32(0x40)));
+	pattern = _mm_or_si128(pattern, _mm_andnot_si128(similarYUV(yuv5, _mm_loadu_si128((const __m128i *)(next + 1)), thresholds), _mm_set1_epi32(0x80)));
+	return pattern;
+}
+
+int hqPatternRowSSE2(const uint32 *yuvPrev, const uint32 *yuvCur, const uint32 *yuvNext, uint8 *patterns, int width) {
+	// Same as trY, trU and trV of diffYUV
+	const __m128i thresholds = _mm_set1_epi32(0x00300706);
+	int x = 0;
+
+	for (; x + 8 <= width; x += 8) {
+		const __m128i lo = pattern4(yuvPrev + x, yuvCur + x, yuvNext + x, thresholds);
+		const __m128i hi = pattern4(yuvPrev + x + 4, yuvCur + x + 4, yuvNext + x + 4, thresholds);
+		const __m128i packed = _mm_packs_epi32(lo, hi);
+		_mm_storel_epi64((__m128i *)(patterns + x), _mm_packus_epi16(packed, packed));
+	}
+	return x;
+}
+
+int edgeUnchangedRowSSE2(const uint16 *src, const uint16 *oldSrc, int pitch, uint8 *unchanged, int width) {
+	int x = 0;
+
+	for (; x + 8 <= width; x += 8) {
+		__m128i equal = _mm_set1_epi32(-1);
+		for (int offset = x - pitch - 1; offset <= x + pitch - 1; offset += pitch) {
+			for (int i = 0; i < 3; ++i) {
+				const __m128i a = _mm_loadu_si128((const __m128i *)(src + offset + i));
+				const __m128i b = _mm_loadu_si128((const __m128i *)(oldSrc + offset + i));
+				equal = _mm_and_si128(equal, _mm_cmpeq_epi16(a, b));
+			}
+		}
+		const __m128i packed = _mm_packs_epi16(equal, equal);
+		_mm_storel_epi64((__m128i *)(unchanged + x), _mm_and_si128(packed, _mm_set1_epi8(1)));
+	}
+	return x;
+}
+
+int edgeUnchangedRowSSE2(const uint32 *src, const uint32 *oldSrc, int pitch, uint8 *unchanged, int width) {
+	int x = 0;
+
+	for (; x + 8 <= width; x += 8) {
+		__m128i equalLo = _mm_set1_epi32(-1);
+		__m128i equalHi = _mm_set1_epi32(-1);
+		for (int offset = x - pitch - 1; offset <= x + pitch - 1; offset += pitch) {
+			for (int i = 0; i < 3; ++i) {
+				const uint32 *a = src + offset + i;
+				const uint32 *b = oldSrc + offset + i;
+				equalLo = _mm_and_si128(equalLo, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)a), _mm_loadu_si128((const __m128i *)b)));
+				equalHi = _mm_and_si128(equalHi, _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(a + 4)), _mm_loadu_si128((const __m128i *)(b + 4))));
+			}
+		}
+		const __m128i packed = _mm_packs_epi32(equalLo, equalHi);
+		_mm_storel_epi64((__m128i *)(unchanged + x), _mm_and_si128(_mm_packs_epi16(packed, packed), _mm_set1_epi8(1)));
+	}
+	return x;
+}
+
+} // End of namespace Graphics
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
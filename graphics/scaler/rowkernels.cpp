@@ -0,0 +1,207 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "graphics/scaler/rowkernels.h"
+#include "graphics/scaler/intern.h"
+#include "common/system.h"
+
+namespace Graphics {
+
+#ifdef SCUMMVM_SSE2
+// Defined in rowkernels-sse2.cpp
+int hqPatternRowSSE2(const uint32 *yuvPrev, const uint32 *yuvCur, const uint32 *yuvNext, uint8 *patterns, int width);
+int edgeUnchangedRowSSE2(const uint16 *src, const uint16 *oldSrc, int pitch, uint8 *unchanged, int width);
+int edgeUnchangedRowSSE2(const uint32 *src, const uint32 *oldSrc, int pitch, uint8 *unchanged, int width);
+#endif
+
+#ifdef SCUMMVM_AVX2
+// Defined in rowkernels-avx2.cpp
+int hqConvertYUVRowAVX2(const uint16 *src, uint32 *dst, int count, const uint32 *RGBtoYUV);
+int hqPatternRowAVX2(const uint32 *yuvPrev, const uint32 *yuvCur, const uint32 *yuvNext, uint8 *patterns, int width);
+int edgeUnchangedRowAVX2(const uint16 *src, const uint16 *oldSrc, int pitch, uint8 *unchanged, int width);
+int edgeUnchangedRowAVX2(const uint32 *src, const uint32 *oldSrc, int pitch, uint8 *unchanged, int width);
+#endif
+
+#ifdef SCUMMVM_NEON
+// Defined in rowkernels-neon.cpp
+int hqPatternRowNEON(const uint32 *yuvPrev, const uint32 *yuvCur, const uint32 *yuvNext, uint8 *patterns, int width);
+int edgeUnchangedRowNEON(const uint16 *src, const uint16 *oldSrc, int pitch, uint8 *unchanged, int width);
+int edgeUnchangedRowNEON(const uint32 *src, const uint32 *oldSrc, int pitch, uint8 *unchanged, int width);
+#endif
+
+namespace {
+
+// The SIMD kernels return how many pixels they did, the rest is left to
+// the generic code
+typedef int (*ConvertYUVRowFunc)(const uint16 *src, uint32 *dst, int count, const uint32 *RGBtoYUV);
+typedef int (*PatternRowFunc)(const uint32 *yuvPrev, const uint32 *yuvCur, const uint32 *yuvNext, uint8 *patterns, int width);
+typedef int (*UnchangedRow16Func)(const uint16 *src, const uint16 *oldSrc, int pitch, uint8 *unchanged, int width);
+typedef int (*UnchangedRow32Func)(const uint32 *src, const uint32 *oldSrc, int pitch, uint8 *unchanged, int width);
+
+void hqConvertYUVRowGeneric(const uint16 *src, uint32 *dst, int count, const uint32 *RGBtoYUV) {
+	for (int x = 0; x < count; ++x)
+		dst[x] = RGBtoYUV[src[x]];
+}
+
+void hqPatternRowGeneric(const uint32 *yuvPrev, const uint32 *yuvCur, const uint32 *yuvNext, uint8 *patterns, int width) {
+	for (int x = 0; x < width; ++x) {
+		const int yuv5 = yuvCur[x];
+		int pattern = 0;
+		if (diffYUV(yuv5, yuvPrev[x - 1])) pattern |= 0x0001;
+		if (diffYUV(yuv5, yuvPrev[x]))     pattern |= 0x0002;
+		if (diffYUV(yuv5, yuvPrev[x + 1])) pattern |= 0x0004;
+		if (diffYUV(yuv5, yuvCur[x - 1]))  pattern |= 0x0008;
+		if (diffYUV(yuv5, yuvCur[x + 1]))  pattern |= 0x0010;
+		if (diffYUV(yuv5, yuvNext[x - 1])) pattern |= 0x0020;
+		if (diffYUV(yuv5, yuvNext[x]))     pattern |= 0x0040;
+		if (diffYUV(yuv5, yuvNext[x + 1])) pattern |= 0x0080;
+		patterns[x] = pattern;
+	}
+}
+
+template<typename Pixel>
+void edgeUnchangedRowGeneric(const Pixel *src, const Pixel *oldSrc, int pitch, uint8 *unchanged, int width) {
+	for (int x = 0; x < width; ++x) {
+		uint8 result = 1;
+		for (int row = -pitch; row <= pitch && result; row += pitch) {
+			const Pixel *a = src + row + x - 1;
+			const Pixel *b = oldSrc + row + x - 1;
+			if (a[0] != b[0] || a[1] != b[1] || a[2] != b[2])
+				result = 0;
+		}
+		unchanged[x] = result;
+	}
+}
+
+int skipConvertYUVRow(const uint16 *, uint32 *, int, const uint32 *) { return 0; }
+int skipPatternRow(const uint32 *, const uint32 *, const uint32 *, uint8 *, int) { return 0; }
+template<typename Pixel>
+int skipUnchangedRow(const Pixel *, const Pixel *, int, uint8 *, int) { return 0; }
+
+ConvertYUVRowFunc convertYUVRowFunc = skipConvertYUVRow;
+PatternRowFunc patternRowFunc = skipPatternRow;
+UnchangedRow16Func unchangedRow16Func = skipUnchangedRow<uint16>;
+UnchangedRow32Func unchangedRow32Func = skipUnchangedRow<uint32>;
+bool kernelsSelected = false;
+
+/**
+ * Pick the kernels for the CPU, the same way BlendBlit picks its blitters.
+ * SSE2 and NEON are part of the x86-64 and AArch64 baselines, elsewhere
+ * the backend has to be asked, once it is up.
+ */
+void selectKernels() {
+	if (kernelsSelected)
+		return;
+
+	RowKernelSet set = kRowKernelsGeneric;
+#if defined(SCUMMVM_SSE2) && (defined(__x86_64__) || defined(_M_X64))
+	set = kRowKernelsSSE2;
+#elif defined(SCUMMVM_NEON) && defined(__aarch64__)
+	set = kRowKernelsNEON;
+#endif
+
+	if (g_system) {
+#if defined(SCUMMVM_NEON) && !defined(__aarch64__)
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON))
+			set = kRowKernelsNEON;
+#endif
+#if defined(SCUMMVM_SSE2) && !(defined(__x86_64__) || defined(_M_X64))
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+			set = kRowKernelsSSE2;
+#endif
+#ifdef SCUMMVM_AVX2
+		if (g_system->hasFeature(OSystem::kFeatureCpuAVX2))
+			set = kRowKernelsAVX2;
+#endif
+	}
+
+	setRowKernels(set);
+	// Without a backend, try again once it can tell about the CPU
+	kernelsSelected = (g_system != nullptr);
+}
+
+} // End of anonymous namespace
+
+bool setRowKernels(RowKernelSet set) {
+	switch (set) {
+	case kRowKernelsGeneric:
+		convertYUVRowFunc = skipConvertYUVRow;
+		patternRowFunc = skipPatternRow;
+		unchangedRow16Func = skipUnchangedRow<uint16>;
+		unchangedRow32Func = skipUnchangedRow<uint32>;
+		break;
+#ifdef SCUMMVM_SSE2
+	case kRowKernelsSSE2:
+		convertYUVRowFunc = skipConvertYUVRow;
+		patternRowFunc = hqPatternRowSSE2;
+		unchangedRow16Func = edgeUnchangedRowSSE2;
+		unchangedRow32Func = edgeUnchangedRowSSE2;
+		break;
+#endif
+#ifdef SCUMMVM_AVX2
+	case kRowKernelsAVX2:
+		convertYUVRowFunc = hqConvertYUVRowAVX2;
+		patternRowFunc = hqPatternRowAVX2;
+		unchangedRow16Func = edgeUnchangedRowAVX2;
+		unchangedRow32Func = edgeUnchangedRowAVX2;
+		break;
+#endif
+#ifdef SCUMMVM_NEON
+	case kRowKernelsNEON:
+		convertYUVRowFunc = skipConvertYUVRow;
+		patternRowFunc = hqPatternRowNEON;
+		unchangedRow16Func = edgeUnchangedRowNEON;
+		unchangedRow32Func = edgeUnchangedRowNEON;
+		break;
+#endif
+	default:
+		return false;
+	}
+
+	kernelsSelected = true;
+	return true;
+}
+
+void hqConvertYUVRow(const uint16 *src, uint32 *dst, int count, const uint32 *RGBtoYUV) {
+	selectKernels();
+	const int done = convertYUVRowFunc(src, dst, count, RGBtoYUV);
+	hqConvertYUVRowGeneric(src + done, dst + done, count - done, RGBtoYUV);
+}
+
+void hqPatternRow(const uint32 *yuvPrev, const uint32 *yuvCur, const uint32 *yuvNext, uint8 *patterns, int width) {
+	selectKernels();
+	const int done = patternRowFunc(yuvPrev, yuvCur, yuvNext, patterns, width);
+	hqPatternRowGeneric(yuvPrev + done, yuvCur + done, yuvNext + done, patterns + done, width - done);
+}
+
+void edgeUnchangedRow(const uint16 *src, const uint16 *oldSrc, int pitch, uint8 *unchanged, int width) {
+	selectKernels();
+	const int done = unchangedRow16Func(src, oldSrc, pitch, unchanged, width);
+	edgeUnchangedRowGeneric(src + done, oldSrc + done, pitch, unchanged + done, width - done);
+}
+
+void edgeUnchangedRow(const uint32 *src, const uint32 *oldSrc, int pitch, uint8 *unchanged, int width) {
+	selectKernels();
+	const int done = unchangedRow32Func(src, oldSrc, pitch, unchanged, width);
+	edgeUnchangedRowGeneric(src + done, oldSrc + done, pitch, unchanged + done, width - done);
+}
+
+} // End of namespace Graphics
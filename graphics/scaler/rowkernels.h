@@ -0,0 +1,86 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef GRAPHICS_SCALER_ROWKERNELS_H
+#define GRAPHICS_SCALER_ROWKERNELS_H
+
+#include "common/scummsys.h"
+
+namespace Graphics {
+
+/**
+ * @defgroup graphics_scaler_rowkernels Scaler row kernels
+ * @ingroup graphics
+ *
+ * @brief Per-row building blocks of the HQ and Edge scalers.
+ *
+ * The kernels process a whole row of pixels at once, so they can use
+ * SSE2, AVX2 or NEON. The implementation is picked at runtime the same
+ * way BlendBlit picks its blitters, and gives the same results as the
+ * generic code.
+ * @{
+ */
+
+/**
+ * Look up the YUV values of count 16-bit pixels in the RGBtoYUV table
+ * of the HQ scalers.
+ */
+void hqConvertYUVRow(const uint16 *src, uint32 *dst, int count, const uint32 *RGBtoYUV);
+
+/**
+ * Compute the HQ pattern of width pixels: bit n of patterns[x] is set
+ * when the YUV value of the pixel differs from the one of its n-th
+ * neighbor, in the order w1, w2, w3, w4, w6, w7, w8, w9 (see diffYUV).
+ *
+ * The three rows hold the YUV values of the pixels above, at and below
+ * the ones to process, and must be readable from index -1 to width.
+ */
+void hqPatternRow(const uint32 *yuvPrev, const uint32 *yuvCur, const uint32 *yuvNext, uint8 *patterns, int width);
+
+/**
+ * For width pixels, set unchanged[x] to 1 if the 3x3 block around the
+ * pixel is the same in src and oldSrc, and to 0 otherwise. Both images
+ * have a pitch of pitch pixels and a border of at least one pixel.
+ */
+void edgeUnchangedRow(const uint16 *src, const uint16 *oldSrc, int pitch, uint8 *unchanged, int width);
+void edgeUnchangedRow(const uint32 *src, const uint32 *oldSrc, int pitch, uint8 *unchanged, int width);
+
+enum RowKernelSet {
+	kRowKernelsGeneric,
+	kRowKernelsSSE2,
+	kRowKernelsAVX2,
+	kRowKernelsNEON
+};
+
+/**
+ * Use the given kernels instead of the ones picked for the CPU. This is
+ * meant for tests and benchmarks, the caller has to check that the CPU
+ * supports them.
+ *
+ * @return False if the kernels are not built in.
+ */
+bool setRowKernels(RowKernelSet set);
+
+/** @} */
+
+} // End of namespace Graphics
+
+#endif
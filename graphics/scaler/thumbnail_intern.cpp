@@ -23,6 +23,7 @@
 #include "common/scummsys.h"
 #include "common/system.h"
 
+#include "graphics/blit.h"
 #include "graphics/colormasks.h"
 #include "graphics/scaler.h"
 #include "graphics/scaler/intern.h"
@@ -180,36 +181,20 @@ static bool grabScreen565(Graphics::Surface *surf) {
 
 	surf->create(screen->w, screen->h, Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
 
-	byte *palette = 0;
+	// Convert the whole screen at once, this runs while the game waits for
+	// its save to be written
 	if (screenFormat.bytesPerPixel == 1) {
-		palette = new byte[256 * 3];
-		assert(palette);
+		byte palette[256 * 3];
+		uint32 map[256];
 		g_system->getPaletteManager()->grabPalette(palette, 0, 256);
+		Graphics::convertPaletteToMap(map, palette, 256, surf->format);
+		Graphics::crossBlitMap((byte *)surf->getPixels(), (const byte *)screen->getPixels(),
+		                       surf->pitch, screen->pitch, screen->w, screen->h, surf->format.bytesPerPixel, map);
+	} else {
+		Graphics::crossBlit((byte *)surf->getPixels(), (const byte *)screen->getPixels(),
+		                    surf->pitch, screen->pitch, screen->w, screen->h, surf->format, screenFormat);
 	}
 
-	for (int y = 0; y < screen->h; ++y) {
-		for (int x = 0; x < screen->w; ++x) {
-			byte r = 0, g = 0, b = 0;
-
-			if (screenFormat.bytesPerPixel == 1) {
-				uint8 pixel = *(uint8 *)screen->getBasePtr(x, y);
-				r = palette[pixel * 3 + 0];
-				g = palette[pixel * 3 + 1];
-				b = palette[pixel * 3 + 2];
-			} else if (screenFormat.bytesPerPixel == 2) {
-				uint16 col = READ_UINT16(screen->getBasePtr(x, y));
-				screenFormat.colorToRGB(col, r, g, b);
-			} else if (screenFormat.bytesPerPixel == 4) {
-				uint32 col = READ_UINT32(screen->getBasePtr(x, y));
-				screenFormat.colorToRGB(col, r, g, b);
-			}
-
-			*((uint16 *)surf->getBasePtr(x, y)) = surf->format.RGBToColor(r, g, b);
-		}
-	}
-
-	delete[] palette;
-
 	g_system->unlockScreen();
 	return true;
 }
@@ -246,16 +231,9 @@ bool createThumbnail(Graphics::Surface *surf, const uint8 *pixels, int w, int h,
 	Graphics::Surface screen;
 	screen.create(w, h, Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
 
-	for (int y = 0; y < screen.h; ++y) {
-		for (int x = 0; x < screen.w; ++x) {
-			byte r, g, b;
-			r = palette[pixels[y * w + x] * 3];
-			g = palette[pixels[y * w + x] * 3 + 1];
-			b = palette[pixels[y * w + x] * 3 + 2];
-
-			*((uint16 *)screen.getBasePtr(x, y)) = screen.format.RGBToColor(r, g, b);
-		}
-	}
+	uint32 map[256];
+	Graphics::convertPaletteToMap(map, palette, 256, screen.format);
+	Graphics::crossBlitMap((byte *)screen.getPixels(), pixels, screen.pitch, w, w, h, screen.format.bytesPerPixel, map);
 
 	return createThumbnail(*surf, screen);
 }
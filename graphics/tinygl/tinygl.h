@@ -39,6 +39,13 @@ void destroyContext(ContextHandle *handle);
 void setContext(ContextHandle *handle);
 void presentBuffer();
 void presentBuffer(Common::List<Common::Rect> &dirtyAreas);
+/**
+ * Replay the draw calls of a frame tile by tile instead of one draw call
+ * at a time over the whole screen, so that the color and depth buffers of
+ * a tile stay in the cache. The image is the same in both modes.
+ * Only takes effect for the draw calls issued after the call.
+ */
+void setTiledRasterization(bool enable);
 void getSurfaceRef(Graphics::Surface &surface);
 Graphics::Surface *copyFromFrameBuffer(const Graphics::PixelFormat &dstFormat);
 
@@ -28,6 +28,7 @@
 #ifndef GRAPHICS_TINYGL_ZBUFFER_H_
 #define GRAPHICS_TINYGL_ZBUFFER_H_
 
+#include "graphics/blit.h"
 #include "graphics/surface.h"
 #include "graphics/tinygl/texelbuffer.h"
 #include "graphics/tinygl/gl.h"
@@ -103,6 +104,27 @@ struct ZBufferPoint {
 	}
 };
 
+/**
+ * A run of pixels of a triangle scan line, for the SIMD span kernels.
+ * The interpolated values are the ones of the first pixel.
+ */
+struct ZBufferSpan {
+	uint z, r, g, b, a;
+	int dzdx, drdx, dgdx, dbdx, dadx;
+	int depthFunc;      // TGL_ALWAYS without depth test
+	bool depthWrite;
+	bool writeColor;    // False for depth only spans
+	int bpp;
+	int shifts[4];      // Of the alpha, red, green and blue channels
+	int losses[4];
+};
+
+/**
+ * Select the SIMD span kernels used by the rasterizer, mainly for testing.
+ * Returns false if the set was not compiled in.
+ */
+bool setSpanKernels(Graphics::BlitKernelSet set);
+
 struct FrameBuffer {
 	FrameBuffer(int width, int height, const Graphics::PixelFormat &format, bool enableStencilBuffer);
 	~FrameBuffer();
@@ -391,6 +413,11 @@ private:
 		return !_clipRectangle.contains(x, y);
 	}
 
+	void initSpan(ZBufferSpan &span, bool writeColor, bool depthWrite, bool depthTest) const;
+
+	template <bool kEnableScissor>
+	int fillSpan(int pixel, int x, int y, int n, ZBufferSpan &span);
+
 public:
 
 	FORCEINLINE void writePixel(int pixel, byte aSrc, byte rSrc, byte gSrc, byte bSrc) {
@@ -191,12 +191,18 @@ void GLContext::presentBufferDirtyRects(Common::List<Common::Rect> &dirtyAreas)
 		}
 
 		// Execute draw calls.
-		for (auto &drawCall : _drawCallsQueue) {
-			Common::Rect drawCallRegion = drawCall->getDirtyRegion();
+		if (_enableTiledRasterization) {
 			for (auto &rect : rectangles) {
-				Common::Rect dirtyRegion = rect.rectangle;
-				if (dirtyRegion.intersects(drawCallRegion)) {
-					drawCall->execute(dirtyRegion, true);
+				executeDrawCallsTiled(rect.rectangle);
+			}
+		} else {
+			for (auto &drawCall : _drawCallsQueue) {
+				Common::Rect drawCallRegion = drawCall->getDirtyRegion();
+				for (auto &rect : rectangles) {
+					Common::Rect dirtyRegion = rect.rectangle;
+					if (dirtyRegion.intersects(drawCallRegion)) {
+						drawCall->execute(dirtyRegion, true);
+					}
 				}
 			}
 		}
@@ -236,9 +242,16 @@ void GLContext::presentBufferDirtyRects(Common::List<Common::Rect> &dirtyAreas)
 void GLContext::presentBufferSimple(Common::List<Common::Rect> &dirtyAreas) {
 	dirtyAreas.push_back(Common::Rect(fb->getPixelBufferWidth(), fb->getPixelBufferHeight()));
 
-	for (const auto &drawCall : _drawCallsQueue) {
-		drawCall->execute(true);
-		delete drawCall;
+	if (_enableTiledRasterization) {
+		executeDrawCallsTiled(renderRect);
+		for (const auto &drawCall : _drawCallsQueue) {
+			delete drawCall;
+		}
+	} else {
+		for (const auto &drawCall : _drawCallsQueue) {
+			drawCall->execute(true);
+			delete drawCall;
+		}
 	}
 
 	_drawCallsQueue.clear();
@@ -248,6 +261,57 @@ void GLContext::presentBufferSimple(Common::List<Common::Rect> &dirtyAreas) {
 	_drawCallAllocator[_currentAllocatorIndex].reset();
 }
 
+void GLContext::executeDrawCallsTiled(const Common::Rect &region) {
+	// Clipped draw calls only touch the pixels inside the clipping rectangle,
+	// so replaying each tile's draw calls in queue order gives every pixel
+	// the same sequence of writes as replaying the whole queue at once.
+	if (region.isEmpty())
+		return;
+
+	const int tilesX = (region.width() + DRAW_CALL_TILE_SIZE - 1) / DRAW_CALL_TILE_SIZE;
+	const int tilesY = (region.height() + DRAW_CALL_TILE_SIZE - 1) / DRAW_CALL_TILE_SIZE;
+	if (_drawCallTiles.size() < (uint)(tilesX * tilesY))
+		_drawCallTiles.resize(tilesX * tilesY);
+
+	for (const auto &drawCall : _drawCallsQueue) {
+		Common::Rect drawCallRegion = drawCall->getDirtyRegion();
+		if (!drawCallRegion.intersects(region))
+			continue;
+		drawCallRegion.clip(region);
+		const int x0 = (drawCallRegion.left - region.left) / DRAW_CALL_TILE_SIZE;
+		const int x1 = (drawCallRegion.right - 1 - region.left) / DRAW_CALL_TILE_SIZE;
+		const int y0 = (drawCallRegion.top - region.top) / DRAW_CALL_TILE_SIZE;
+		const int y1 = (drawCallRegion.bottom - 1 - region.top) / DRAW_CALL_TILE_SIZE;
+		for (int y = y0; y <= y1; y++) {
+			for (int x = x0; x <= x1; x++) {
+				_drawCallTiles[y * tilesX + x].push_back(drawCall);
+			}
+		}
+	}
+
+	for (int y = 0; y < tilesY; y++) {
+		for (int x = 0; x < tilesX; x++) {
+			Common::Array<DrawCall *> &tile = _drawCallTiles[y * tilesX + x];
+			if (tile.empty())
+				continue;
+
+			Common::Rect tileRect(region.left + x * DRAW_CALL_TILE_SIZE, region.top + y * DRAW_CALL_TILE_SIZE,
+			                      region.left + (x + 1) * DRAW_CALL_TILE_SIZE, region.top + (y + 1) * DRAW_CALL_TILE_SIZE);
+			tileRect.clip(region);
+			for (const auto &drawCall : tile) {
+				drawCall->execute(tileRect, true);
+			}
+			// Keep the storage for the next frame
+			tile.resize(0);
+		}
+	}
+}
+
+void setTiledRasterization(bool enable) {
+	GLContext *c = gl_get_context();
+	c->_enableTiledRasterization = enable;
+}
+
 void presentBuffer(Common::List<Common::Rect> &dirtyAreas) {
 	GLContext *c = gl_get_context();
 	if (c->_enableDirtyRectangles) {
@@ -291,7 +355,7 @@ RasterizationDrawCall::RasterizationDrawCall() : DrawCall(DrawCall_Rasterization
 	_drawTriangleBack = c->draw_triangle_back;
 	memcpy(_vertex, c->vertex, sizeof(GLVertex) * _vertexCount);
 	_state = captureState();
-	if (c->_enableDirtyRectangles) {
+	if (c->_enableDirtyRectangles || c->_enableTiledRasterization) {
 		computeDirtyRegion();
 	}
 }
@@ -573,7 +637,8 @@ BlittingDrawCall::BlittingDrawCall(BlitImage *image, const BlitTransform &transf
 	tglIncBlitImageRef(image);
 	_blitState = captureState();
 	_imageVersion = tglGetBlitImageVersion(image);
-	if (gl_get_context()->_enableDirtyRectangles) {
+	TinyGL::GLContext *c = gl_get_context();
+	if (c->_enableDirtyRectangles || c->_enableTiledRasterization) {
 		computeDirtyRegion();
 	}
 }
@@ -690,7 +755,7 @@ ClearBufferDrawCall::ClearBufferDrawCall(bool clearZBuffer, int zValue,
 	  _rValue(rValue), _gValue(gValue), _bValue(bValue), _clearStencilBuffer(clearStencilBuffer),
 	  _stencilValue(stencilValue), DrawCall(DrawCall_Clear) {
 	TinyGL::GLContext *c = gl_get_context();
-	if (c->_enableDirtyRectangles) {
+	if (c->_enableDirtyRectangles || c->_enableTiledRasterization) {
 		_dirtyRegion = c->renderRect;
 	}
 }
@@ -75,6 +75,7 @@ enum {
 
 #define MAX_DISPLAY_LISTS 1024
 #define OP_BUFFER_MAX_SIZE 512
+#define DRAW_CALL_TILE_SIZE 64
 
 #define TGL_OFFSET_FILL    0x1
 #define TGL_OFFSET_LINE    0x2
@@ -451,6 +452,7 @@ struct GLContext {
 	Common::Rect _scissorRect;
 
 	bool _enableDirtyRectangles;
+	bool _enableTiledRasterization;
 
 	// stipple
 	bool polygon_stipple_enabled;
@@ -464,6 +466,7 @@ struct GLContext {
 	Common::List<DrawCall *> _previousFrameDrawCallsQueue;
 	int _currentAllocatorIndex;
 	LinearAllocator _drawCallAllocator[2];
+	Common::Array<Common::Array<DrawCall *> > _drawCallTiles;
 	bool _debugRectsEnabled;
 	bool _profilingEnabled;
 
@@ -523,6 +526,7 @@ public:
 
 	void presentBufferDirtyRects(Common::List<Common::Rect> &dirtyAreas);
 	void presentBufferSimple(Common::List<Common::Rect> &dirtyAreas);
+	void executeDrawCallsTiled(const Common::Rect &region);
 
 	void debugDrawRectangle(Common::Rect rect, int r, int g, int b);
 
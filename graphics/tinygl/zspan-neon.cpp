@@ -0,0 +1,173 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "graphics/tinygl/zbuffer.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace TinyGL {
+
+/**
+ * The depth test of compareDepth() on four pixels, see zspan-sse2.cpp.
+ */
+struct SpanDepthTestNEON {
+	uint32x4_t less, equal, greater;
+
+	SpanDepthTestNEON(int func) {
+		const bool l = (func == TGL_LESS || func == TGL_LEQUAL || func == TGL_NOTEQUAL || func == TGL_ALWAYS);
+		const bool e = (func == TGL_EQUAL || func == TGL_LEQUAL || func == TGL_GEQUAL || func == TGL_ALWAYS);
+		const bool g = (func == TGL_GREATER || func == TGL_GEQUAL || func == TGL_NOTEQUAL || func == TGL_ALWAYS);
+		less = vdupq_n_u32(l ? 0xFFFFFFFF : 0);
+		equal = vdupq_n_u32(e ? 0xFFFFFFFF : 0);
+		greater = vdupq_n_u32(g ? 0xFFFFFFFF : 0);
+	}
+
+	inline uint32x4_t pass(uint32x4_t zDst, uint32x4_t zSrc) const {
+		const uint32x4_t lt = vandq_u32(vcltq_u32(zDst, zSrc), less);
+		const uint32x4_t eq = vandq_u32(vceqq_u32(zDst, zSrc), equal);
+		const uint32x4_t gt = vandq_u32(vcgtq_u32(zDst, zSrc), greater);
+		return vorrq_u32(vorrq_u32(lt, eq), gt);
+	}
+};
+
+static FORCEINLINE uint32x4_t neon_ramp(uint start, int step) {
+	const uint32_t values[4] = { start, start + step, start + 2 * (uint)step, start + 3 * (uint)step };
+	return vld1q_u32(values);
+}
+
+static FORCEINLINE bool neon_any(uint32x4_t mask) {
+	const uint32x2_t m = vorr_u32(vget_low_u32(mask), vget_high_u32(mask));
+	return (vget_lane_u32(m, 0) | vget_lane_u32(m, 1)) != 0;
+}
+
+/** The channel as writePixel() gets it from the interpolated value, packed into the pixel. */
+static FORCEINLINE uint32x4_t neon_packChannel(uint32x4_t value, int bits, int32x4_t loss, int32x4_t shift) {
+	const uint32x4_t c = vandq_u32(vshlq_u32(value, vdupq_n_s32(8 - bits)), vdupq_n_u32(0xFF));
+	return vshlq_u32(vshlq_u32(c, loss), shift);
+}
+
+template <bool kWriteColor, bool kDepthWrite, int kBpp>
+static int fillSpan(byte *pbuf, uint *zbuf, int n, const ZBufferSpan &span) {
+	const SpanDepthTestNEON depthTest(span.depthFunc);
+	int32x4_t losses[4], shifts[4];
+	for (int i = 0; i < 4; i++) {
+		losses[i] = vdupq_n_s32(-span.losses[i]);
+		shifts[i] = vdupq_n_s32(span.shifts[i]);
+	}
+
+	uint32x4_t z = neon_ramp(span.z, span.dzdx);
+	uint32x4_t r = neon_ramp(span.r, span.drdx);
+	uint32x4_t g = neon_ramp(span.g, span.dgdx);
+	uint32x4_t b = neon_ramp(span.b, span.dbdx);
+	uint32x4_t a = neon_ramp(span.a, span.dadx);
+	const uint32x4_t dz = vdupq_n_u32(4 * (uint)span.dzdx);
+	const uint32x4_t dr = vdupq_n_u32(4 * (uint)span.drdx);
+	const uint32x4_t dg = vdupq_n_u32(4 * (uint)span.dgdx);
+	const uint32x4_t db = vdupq_n_u32(4 * (uint)span.dbdx);
+	const uint32x4_t da = vdupq_n_u32(4 * (uint)span.dadx);
+
+	int i = 0;
+	for (; i + 4 <= n; i += 4) {
+		const uint32x4_t zDst = vld1q_u32((const uint32_t *)zbuf + i);
+		const uint32x4_t mask = depthTest.pass(zDst, z);
+		if (neon_any(mask)) {
+			if (kWriteColor) {
+				uint32x4_t color = neon_packChannel(a, ZB_POINT_ALPHA_BITS, losses[0], shifts[0]);
+				color = vorrq_u32(color, neon_packChannel(r, ZB_POINT_RED_BITS, losses[1], shifts[1]));
+				color = vorrq_u32(color, neon_packChannel(g, ZB_POINT_GREEN_BITS, losses[2], shifts[2]));
+				color = vorrq_u32(color, neon_packChannel(b, ZB_POINT_BLUE_BITS, losses[3], shifts[3]));
+
+				if (kBpp == 2) {
+					uint16_t *dst = (uint16_t *)pbuf + i;
+					vst1_u16(dst, vbsl_u16(vmovn_u32(mask), vmovn_u32(color), vld1_u16(dst)));
+				} else {
+					uint32_t *dst = (uint32_t *)pbuf + i;
+					vst1q_u32(dst, vbslq_u32(mask, color, vld1q_u32(dst)));
+				}
+			}
+
+			if (kDepthWrite) {
+				// writePixel() stores the depth through a float
+				const uint32x4_t zOut = kWriteColor ? vcvtq_u32_f32(vcvtq_f32_u32(z)) : z;
+				vst1q_u32((uint32_t *)zbuf + i, vbslq_u32(mask, zOut, zDst));
+			}
+		}
+
+		z = vaddq_u32(z, dz);
+		if (kWriteColor) {
+			r = vaddq_u32(r, dr);
+			g = vaddq_u32(g, dg);
+			b = vaddq_u32(b, db);
+			a = vaddq_u32(a, da);
+		}
+	}
+	return i;
+}
+
+int fillSpanNEON(byte *pbuf, uint *zbuf, int n, const ZBufferSpan &span) {
+	if (!span.writeColor) {
+		if (!span.depthWrite)
+			return n;
+		return fillSpan<false, true, 4>(pbuf, zbuf, n, span);
+	}
+
+	switch (span.bpp) {
+	case 2:
+		if (span.depthWrite)
+			return fillSpan<true, true, 2>(pbuf, zbuf, n, span);
+		return fillSpan<true, false, 2>(pbuf, zbuf, n, span);
+	case 4:
+		if (span.depthWrite)
+			return fillSpan<true, true, 4>(pbuf, zbuf, n, span);
+		return fillSpan<true, false, 4>(pbuf, zbuf, n, span);
+	default:
+		return 0;
+	}
+}
+
+} // End of namespace TinyGL
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,178 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#include "graphics/tinygl/zbuffer.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace TinyGL {
+
+/**
+ * The depth test of compareDepth() on four pixels. Every function is a
+ * choice of the less, equal and greater outcomes of comparing the depth
+ * buffer value to the fragment's.
+ */
+struct SpanDepthTestSSE2 {
+	__m128i less, equal, greater;
+
+	SpanDepthTestSSE2(int func) {
+		const bool l = (func == TGL_LESS || func == TGL_LEQUAL || func == TGL_NOTEQUAL || func == TGL_ALWAYS);
+		const bool e = (func == TGL_EQUAL || func == TGL_LEQUAL || func == TGL_GEQUAL || func == TGL_ALWAYS);
+		const bool g = (func == TGL_GREATER || func == TGL_GEQUAL || func == TGL_NOTEQUAL || func == TGL_ALWAYS);
+		less = _mm_set1_epi32(l ? -1 : 0);
+		equal = _mm_set1_epi32(e ? -1 : 0);
+		greater = _mm_set1_epi32(g ? -1 : 0);
+	}
+
+	inline __m128i pass(__m128i zDst, __m128i zSrc) const {
+		// There are only signed comparisons
+		const __m128i sign = _mm_set1_epi32((int)0x80000000);
+		const __m128i lt = _mm_cmplt_epi32(_mm_xor_si128(zDst, sign), _mm_xor_si128(zSrc, sign));
+		const __m128i eq = _mm_cmpeq_epi32(zDst, zSrc);
+		const __m128i gt = _mm_andnot_si128(_mm_or_si128(lt, eq), _mm_set1_epi32(-1));
+		return _mm_or_si128(_mm_or_si128(_mm_and_si128(lt, less), _mm_and_si128(eq, equal)), _mm_and_si128(gt, greater));
+	}
+};
+
+static FORCEINLINE __m128i sse2_ramp(uint start, int step) {
+	return _mm_setr_epi32(start, start + step, start + 2 * (uint)step, start + 3 * (uint)step);
+}
+
+/** The channel as writePixel() gets it from the interpolated value, packed into the pixel. */
+static FORCEINLINE __m128i sse2_packChannel(__m128i value, int bits, __m128i loss, __m128i shift) {
+	const __m128i c = _mm_and_si128(_mm_srli_epi32(value, bits - 8), _mm_set1_epi32(0xFF));
+	return _mm_sll_epi32(_mm_srl_epi32(c, loss), shift);
+}
+
+static FORCEINLINE __m128i sse2_blend(__m128i mask, __m128i a, __m128i b) {
+	return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+template <bool kWriteColor, bool kDepthWrite, int kBpp>
+static int fillSpan(byte *pbuf, uint *zbuf, int n, const ZBufferSpan &span) {
+	const SpanDepthTestSSE2 depthTest(span.depthFunc);
+	__m128i losses[4], shifts[4];
+	for (int i = 0; i < 4; i++) {
+		losses[i] = _mm_cvtsi32_si128(span.losses[i]);
+		shifts[i] = _mm_cvtsi32_si128(span.shifts[i]);
+	}
+
+	__m128i z = sse2_ramp(span.z, span.dzdx);
+	__m128i r = sse2_ramp(span.r, span.drdx);
+	__m128i g = sse2_ramp(span.g, span.dgdx);
+	__m128i b = sse2_ramp(span.b, span.dbdx);
+	__m128i a = sse2_ramp(span.a, span.dadx);
+	const __m128i dz = _mm_set1_epi32(4 * (uint)span.dzdx);
+	const __m128i dr = _mm_set1_epi32(4 * (uint)span.drdx);
+	const __m128i dg = _mm_set1_epi32(4 * (uint)span.dgdx);
+	const __m128i db = _mm_set1_epi32(4 * (uint)span.dbdx);
+	const __m128i da = _mm_set1_epi32(4 * (uint)span.dadx);
+
+	int i = 0;
+	for (; i + 4 <= n; i += 4) {
+		// writePixel() stores the depth through a float, which is only
+		// the same as a signed conversion below 2^31
+		if (kWriteColor && kDepthWrite && (_mm_movemask_epi8(z) & 0x8888))
+			break;
+
+		const __m128i zDst = _mm_loadu_si128((const __m128i *)(zbuf + i));
+		const __m128i mask = depthTest.pass(zDst, z);
+		if (_mm_movemask_epi8(mask)) {
+			if (kWriteColor) {
+				__m128i color = sse2_packChannel(a, ZB_POINT_ALPHA_BITS, losses[0], shifts[0]);
+				color = _mm_or_si128(color, sse2_packChannel(r, ZB_POINT_RED_BITS, losses[1], shifts[1]));
+				color = _mm_or_si128(color, sse2_packChannel(g, ZB_POINT_GREEN_BITS, losses[2], shifts[2]));
+				color = _mm_or_si128(color, sse2_packChannel(b, ZB_POINT_BLUE_BITS, losses[3], shifts[3]));
+
+				if (kBpp == 2) {
+					color = _mm_srai_epi32(_mm_slli_epi32(color, 16), 16);
+					color = _mm_packs_epi32(color, color);
+					const __m128i mask16 = _mm_packs_epi32(mask, mask);
+					__m128i *dst = (__m128i *)(pbuf + i * 2);
+					_mm_storel_epi64(dst, sse2_blend(mask16, color, _mm_loadl_epi64(dst)));
+				} else {
+					__m128i *dst = (__m128i *)(pbuf + i * 4);
+					_mm_storeu_si128(dst, sse2_blend(mask, color, _mm_loadu_si128(dst)));
+				}
+			}
+
+			if (kDepthWrite) {
+				const __m128i zOut = kWriteColor ? _mm_cvttps_epi32(_mm_cvtepi32_ps(z)) : z;
+				_mm_storeu_si128((__m128i *)(zbuf + i), sse2_blend(mask, zOut, zDst));
+			}
+		}
+
+		z = _mm_add_epi32(z, dz);
+		if (kWriteColor) {
+			r = _mm_add_epi32(r, dr);
+			g = _mm_add_epi32(g, dg);
+			b = _mm_add_epi32(b, db);
+			a = _mm_add_epi32(a, da);
+		}
+	}
+	return i;
+}
+
+int fillSpanSSE2(byte *pbuf, uint *zbuf, int n, const ZBufferSpan &span) {
+	if (!span.writeColor) {
+		if (!span.depthWrite)
+			return n;
+		return fillSpan<false, true, 4>(pbuf, zbuf, n, span);
+	}
+
+	switch (span.bpp) {
+	case 2:
+		if (span.depthWrite)
+			return fillSpan<true, true, 2>(pbuf, zbuf, n, span);
+		return fillSpan<true, false, 2>(pbuf, zbuf, n, span);
+	case 4:
+		if (span.depthWrite)
+			return fillSpan<true, true, 4>(pbuf, zbuf, n, span);
+		return fillSpan<true, false, 4>(pbuf, zbuf, n, span);
+	default:
+		return 0;
+	}
+}
+
+} // End of namespace TinyGL
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
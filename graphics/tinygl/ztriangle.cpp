@@ -26,6 +26,7 @@
  */
 
 #include "common/endian.h"
+#include "common/system.h"
 #include "graphics/tinygl/texelbuffer.h"
 #include "graphics/tinygl/zbuffer.h"
 #include "graphics/tinygl/zgl.h"
@@ -34,6 +35,124 @@ namespace TinyGL {
 
 static const int NB_INTERP = 8;
 
+#ifdef SCUMMVM_SSE2
+// Defined in zspan-sse2.cpp
+int fillSpanSSE2(byte *pbuf, uint *zbuf, int n, const ZBufferSpan &span);
+#endif
+
+#ifdef SCUMMVM_NEON
+// Defined in zspan-neon.cpp
+int fillSpanNEON(byte *pbuf, uint *zbuf, int n, const ZBufferSpan &span);
+#endif
+
+// The SIMD kernels fill the start of a span and return how many pixels
+// they did, the rest is left to the generic code.
+typedef int (*FillSpanFunc)(byte *pbuf, uint *zbuf, int n, const ZBufferSpan &span);
+
+static int skipFillSpan(byte *, uint *, int, const ZBufferSpan &) { return 0; }
+
+static FillSpanFunc fillSpanKernel = skipFillSpan;
+static bool spanKernelsSelected = false;
+
+bool setSpanKernels(Graphics::BlitKernelSet set) {
+	switch (set) {
+	case Graphics::kBlitKernelsGeneric:
+		fillSpanKernel = skipFillSpan;
+		break;
+#ifdef SCUMMVM_SSE2
+	case Graphics::kBlitKernelsSSE2:
+	case Graphics::kBlitKernelsAVX2:
+		// The spans are too short for the wider registers to pay off
+		fillSpanKernel = fillSpanSSE2;
+		break;
+#endif
+#ifdef SCUMMVM_NEON
+	case Graphics::kBlitKernelsNEON:
+		fillSpanKernel = fillSpanNEON;
+		break;
+#endif
+	default:
+		return false;
+	}
+
+	spanKernelsSelected = true;
+	return true;
+}
+
+/**
+ * Pick the span kernels for the CPU, the same way the blitting code does.
+ */
+static void selectSpanKernels() {
+	if (spanKernelsSelected)
+		return;
+
+	Graphics::BlitKernelSet set = Graphics::kBlitKernelsGeneric;
+#if defined(SCUMMVM_SSE2) && (defined(__x86_64__) || defined(_M_X64))
+	set = Graphics::kBlitKernelsSSE2;
+#elif defined(SCUMMVM_NEON) && defined(__aarch64__)
+	set = Graphics::kBlitKernelsNEON;
+#endif
+
+	if (g_system) {
+#if defined(SCUMMVM_NEON) && !defined(__aarch64__)
+		if (g_system->hasFeature(OSystem::kFeatureCpuNEON))
+			set = Graphics::kBlitKernelsNEON;
+#endif
+#if defined(SCUMMVM_SSE2) && !(defined(__x86_64__) || defined(_M_X64))
+		if (g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+			set = Graphics::kBlitKernelsSSE2;
+#endif
+	}
+
+	setSpanKernels(set);
+	// Without a backend, try again once it can tell about the CPU
+	spanKernelsSelected = (g_system != nullptr);
+}
+
+void FrameBuffer::initSpan(ZBufferSpan &span, bool writeColor, bool depthWrite, bool depthTest) const {
+	selectSpanKernels();
+
+	span.z = span.r = span.g = span.b = span.a = 0;
+	span.dzdx = span.drdx = span.dgdx = span.dbdx = span.dadx = 0;
+	span.depthFunc = depthTest ? _depthFunc : TGL_ALWAYS;
+	span.depthWrite = depthWrite;
+	span.writeColor = writeColor;
+	span.bpp = _pbufBpp;
+	span.shifts[0] = _pbufFormat.aShift;
+	span.shifts[1] = _pbufFormat.rShift;
+	span.shifts[2] = _pbufFormat.gShift;
+	span.shifts[3] = _pbufFormat.bShift;
+	span.losses[0] = _pbufFormat.aLoss;
+	span.losses[1] = _pbufFormat.rLoss;
+	span.losses[2] = _pbufFormat.gLoss;
+	span.losses[3] = _pbufFormat.bLoss;
+}
+
+/**
+ * Hand the start of a span of n pixels over to the SIMD kernel, and return
+ * how many pixels are done. Pixels left of the scissor rectangle are
+ * skipped and count as done, so do all of them on a scissored line.
+ */
+template <bool kEnableScissor>
+int FrameBuffer::fillSpan(int pixel, int x, int y, int n, ZBufferSpan &span) {
+	int skip = 0;
+	if (kEnableScissor) {
+		if (y < _clipRectangle.top || y >= _clipRectangle.bottom)
+			return MAX(n, 0);
+		skip = CLIP<int>(_clipRectangle.left - x, 0, MAX(n, 0));
+		n = MIN<int>(n, _clipRectangle.right - x) - skip;
+	}
+	if (n < 4)
+		return 0;
+
+	span.z += (uint)skip * span.dzdx;
+	span.r += (uint)skip * span.drdx;
+	span.g += (uint)skip * span.dgdx;
+	span.b += (uint)skip * span.dbdx;
+	span.a += (uint)skip * span.dadx;
+	return skip + fillSpanKernel(_pbuf + (pixel + skip) * _pbufBpp, _zbuf + pixel + skip, n, span);
+}
+
 static bool applyStipplePattern(int x, int y, const byte *stipple) {
 
 	int stippleX = x % 32;
@@ -347,6 +466,18 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 		ndtzdx = NB_INTERP * dtzdx;
 	}
 
+	ZBufferSpan span;
+	if (kInterpZ && !(kInterpST || kInterpSTZ)) {
+		initSpan(span, kInterpRGB, kDepthWrite, kDepthTestEnabled);
+		span.dzdx = dzdx;
+		if (kInterpRGB && kSmoothMode) {
+			span.drdx = drdx;
+			span.dgdx = dgdx;
+			span.dbdx = dbdx;
+			span.dadx = dadx;
+		}
+	}
+
 	if (fz0 > 0) {
 		l1 = p0;
 		l2 = p2;
@@ -459,6 +590,14 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 				if (kStencilEnabled) {
 					ps = ps1 + x1;
 				}
+				if (kInterpZ && !kStencilEnabled) {
+					span.z = z;
+					const int done = fillSpan<kEnableScissor>(pz - _zbuf, x, y, n + 1, span);
+					pz += done;
+					z += (uint)done * dzdx;
+					n -= done;
+					x += done;
+				}
 				while (n >= 3) {
 					putPixelDepth<kDepthWrite, kEnableScissor, kStencilEnabled, kStippleEnabled, kDepthTestEnabled>(pz, ps, 0, x, y, z, dzdx);
 					putPixelDepth<kDepthWrite, kEnableScissor, kStencilEnabled, kStippleEnabled, kDepthTestEnabled>(pz, ps, 1, x, y, z, dzdx);
@@ -505,6 +644,25 @@ void FrameBuffer::fillTriangle(ZBufferPoint *p0, ZBufferPoint *p1, ZBufferPoint
 				if (kStencilEnabled) {
 					ps = ps1 + x1;
 				}
+				if (kInterpZ && !kFogMode && !kAlphaTestEnabled && !kBlendingEnabled && !kStencilEnabled && !kStippleEnabled) {
+					span.z = z;
+					span.r = r;
+					span.g = g;
+					span.b = b;
+					span.a = a;
+					const int done = fillSpan<kEnableScissor>(pp, x, y, n + 1, span);
+					pp += done;
+					pz += done;
+					z += (uint)done * dzdx;
+					if (kSmoothMode) {
+						r += (uint)done * drdx;
+						g += (uint)done * dgdx;
+						b += (uint)done * dbdx;
+						a += (uint)done * dadx;
+					}
+					n -= done;
+					x += done;
+				}
 				while (n >= 3) {
 					putPixelNoTexture<kDepthWrite, kSmoothMode, kFogMode, kAlphaTestEnabled, kEnableScissor, kBlendingEnabled, kStencilEnabled, kStippleEnabled, kDepthTestEnabled>
 					                 (pp, pz, ps, 0, x, y, z, r, g, b, a, dzdx, drdx, dgdx, dbdx, dadx, fog, fog_r, fog_g, fog_b, dfdx);
@@ -0,0 +1,148 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#include "graphics/pixelformat.h"
+#include "graphics/yuv_to_rgb-kernels.h"
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("avx2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+namespace Graphics {
+
+namespace {
+
+/** The product of a chroma factor and the chroma values, truncated the way the tables are. */
+template<int kShift>
+FORCEINLINE __m256i avx2_chromaProduct(__m256i magnitude, __m256i sign, int multiplier) {
+	const __m256i product = _mm256_mulhi_epu16(_mm256_slli_epi16(magnitude, kShift), _mm256_set1_epi16((int16)multiplier));
+	return _mm256_sub_epi16(_mm256_xor_si256(product, sign), sign);
+}
+
+/** A channel as the clip tables give it, before the loss of the format. */
+template<bool kScaleITU>
+FORCEINLINE __m256i avx2_clipChannel(__m256i value) {
+	if (!kScaleITU)
+		return _mm256_min_epi16(_mm256_max_epi16(value, _mm256_setzero_si256()), _mm256_set1_epi16(255));
+
+	value = _mm256_min_epi16(_mm256_max_epi16(value, _mm256_set1_epi16(16)), _mm256_set1_epi16(235));
+	value = _mm256_slli_epi16(_mm256_sub_epi16(value, _mm256_set1_epi16(16)), kYUVScaleITUShift);
+	return _mm256_mulhi_epu16(value, _mm256_set1_epi16((int16)kYUVScaleITUMultiplier));
+}
+
+FORCEINLINE __m256i avx2_loadChroma(const byte *src, bool halfChroma) {
+	if (!halfChroma)
+		return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)src));
+
+	const __m128i c = _mm_loadl_epi64((const __m128i *)src);
+	return _mm256_cvtepu8_epi16(_mm_unpacklo_epi8(c, c));
+}
+
+/** Put the channels of eight pixels together, from the 16-bit lanes they are in. */
+FORCEINLINE __m256i avx2_packPixels(__m128i r, __m128i g, __m128i b, __m128i rShift, __m128i gShift, __m128i bShift, __m256i alpha) {
+	__m256i pixels = _mm256_or_si256(_mm256_sll_epi32(_mm256_cvtepu16_epi32(r), rShift), _mm256_sll_epi32(_mm256_cvtepu16_epi32(g), gShift));
+	return _mm256_or_si256(pixels, _mm256_or_si256(_mm256_sll_epi32(_mm256_cvtepu16_epi32(b), bShift), alpha));
+}
+
+template<int kBytesPerPixel, bool kHalfChroma, bool kScaleITU>
+uint convertYUVRow(byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, uint w, const PixelFormat &format) {
+	const __m128i rLoss = _mm_cvtsi32_si128(format.rLoss);
+	const __m128i gLoss = _mm_cvtsi32_si128(format.gLoss);
+	const __m128i bLoss = _mm_cvtsi32_si128(format.bLoss);
+	const __m128i rShift = _mm_cvtsi32_si128(format.rShift);
+	const __m128i gShift = _mm_cvtsi32_si128(format.gShift);
+	const __m128i bShift = _mm_cvtsi32_si128(format.bShift);
+	const uint32 alpha = (0xFF >> format.aLoss) << format.aShift;
+	const __m256i offset = _mm256_set1_epi16(128);
+
+	uint x = 0;
+	for (; x + 16 <= w; x += 16) {
+		const uint uvX = kHalfChroma ? x / 2 : x;
+		const __m256i y = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(ySrc + x)));
+		const __m256i u = _mm256_sub_epi16(avx2_loadChroma(uSrc + uvX, kHalfChroma), offset);
+		const __m256i v = _mm256_sub_epi16(avx2_loadChroma(vSrc + uvX, kHalfChroma), offset);
+
+		const __m256i uSign = _mm256_srai_epi16(u, 15);
+		const __m256i vSign = _mm256_srai_epi16(v, 15);
+		const __m256i uMagnitude = _mm256_abs_epi16(u);
+		const __m256i vMagnitude = _mm256_abs_epi16(v);
+
+		const __m256i dr = avx2_chromaProduct<kYUVCrToRShift>(vMagnitude, vSign, kYUVCrToRMultiplier);
+		const __m256i dg = _mm256_add_epi16(avx2_chromaProduct<kYUVCrToGShift>(vMagnitude, vSign, kYUVCrToGMultiplier),
+		                                    avx2_chromaProduct<kYUVCbToGShift>(uMagnitude, uSign, kYUVCbToGMultiplier));
+		const __m256i db = avx2_chromaProduct<kYUVCbToBShift>(uMagnitude, uSign, kYUVCbToBMultiplier);
+
+		const __m256i r = _mm256_srl_epi16(avx2_clipChannel<kScaleITU>(_mm256_add_epi16(y, dr)), rLoss);
+		const __m256i g = _mm256_srl_epi16(avx2_clipChannel<kScaleITU>(_mm256_sub_epi16(y, dg)), gLoss);
+		const __m256i b = _mm256_srl_epi16(avx2_clipChannel<kScaleITU>(_mm256_add_epi16(y, db)), bLoss);
+
+		if (kBytesPerPixel == 2) {
+			__m256i pixels = _mm256_or_si256(_mm256_sll_epi16(r, rShift), _mm256_sll_epi16(g, gShift));
+			pixels = _mm256_or_si256(pixels, _mm256_sll_epi16(b, bShift));
+			pixels = _mm256_or_si256(pixels, _mm256_set1_epi16((int16)alpha));
+			_mm256_storeu_si256((__m256i *)(dst + x * 2), pixels);
+		} else {
+			const __m256i a = _mm256_set1_epi32(alpha);
+			_mm256_storeu_si256((__m256i *)(dst + x * 4),
+			                    avx2_packPixels(_mm256_castsi256_si128(r), _mm256_castsi256_si128(g), _mm256_castsi256_si128(b), rShift, gShift, bShift, a));
+			_mm256_storeu_si256((__m256i *)(dst + x * 4 + 32),
+			                    avx2_packPixels(_mm256_extracti128_si256(r, 1), _mm256_extracti128_si256(g, 1), _mm256_extracti128_si256(b, 1), rShift, gShift, bShift, a));
+		}
+	}
+
+	return x;
+}
+
+template<int kBytesPerPixel>
+uint convertYUVRow(byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, uint w, bool halfChroma, const PixelFormat &format, bool scaleITU) {
+	if (halfChroma) {
+		if (scaleITU)
+			return convertYUVRow<kBytesPerPixel, true, true>(dst, ySrc, uSrc, vSrc, w, format);
+		return convertYUVRow<kBytesPerPixel, true, false>(dst, ySrc, uSrc, vSrc, w, format);
+	}
+
+	if (scaleITU)
+		return convertYUVRow<kBytesPerPixel, false, true>(dst, ySrc, uSrc, vSrc, w, format);
+	return convertYUVRow<kBytesPerPixel, false, false>(dst, ySrc, uSrc, vSrc, w, format);
+}
+
+} // End of anonymous namespace
+
+uint convertYUVRowAVX2(byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, uint w, bool halfChroma, const PixelFormat &format, bool scaleITU) {
+	if (format.bytesPerPixel == 2)
+		return convertYUVRow<2>(dst, ySrc, uSrc, vSrc, w, halfChroma, format, scaleITU);
+	return convertYUVRow<4>(dst, ySrc, uSrc, vSrc, w, halfChroma, format, scaleITU);
+}
+
+} // End of namespace Graphics
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
@@ -0,0 +1,52 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef GRAPHICS_YUV_TO_RGB_KERNELS_H
+#define GRAPHICS_YUV_TO_RGB_KERNELS_H
+
+#include "common/scummsys.h"
+
+namespace Graphics {
+
+/**
+ * The tables of YUVToRGBLookup in 16-bit fixed point, for the SIMD
+ * kernels. The chroma tables hold the products of the chroma value and
+ * a factor, truncated; for all chroma values, the magnitude of such a
+ * product is ((|chroma| << shift) * multiplier) >> 16. How the clip tables
+ * map the luminance range of ITU-R BT.601 onto [0, 255] is done the same
+ * way. Checked against the tables by test/graphics/yuv_to_rgb.h.
+ */
+enum {
+	kYUVCrToRShift = 1,
+	kYUVCrToRMultiplier = 45917, // 0.419 / 0.299
+	kYUVCrToGShift = 0,
+	kYUVCrToGMultiplier = 46764, // 0.299 / 0.419, negated
+	kYUVCbToGShift = 0,
+	kYUVCbToGMultiplier = 22569, // 0.114 / 0.331, negated
+	kYUVCbToBShift = 1,
+	kYUVCbToBMultiplier = 58109, // 0.587 / 0.331
+	kYUVScaleITUShift = 1,
+	kYUVScaleITUMultiplier = 38155 // 255 / 219
+};
+
+} // End of namespace Graphics
+
+#endif
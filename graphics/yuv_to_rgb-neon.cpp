@@ -0,0 +1,167 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "graphics/pixelformat.h"
+#include "graphics/yuv_to_rgb-kernels.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Graphics {
+
+namespace {
+
+/** The high halves of the unsigned products, as _mm_mulhi_epu16() gives them. */
+FORCEINLINE uint16x8_t neon_mulhi(uint16x8_t a, uint16_t b) {
+	const uint32x4_t lo = vmull_n_u16(vget_low_u16(a), b);
+	const uint32x4_t hi = vmull_n_u16(vget_high_u16(a), b);
+	return vcombine_u16(vshrn_n_u32(lo, 16), vshrn_n_u32(hi, 16));
+}
+
+/** The product of a chroma factor and the chroma values, truncated the way the tables are. */
+FORCEINLINE int16x8_t neon_chromaProduct(uint16x8_t magnitude, int16x8_t sign, int shift, int multiplier) {
+	const int16x8_t product = vreinterpretq_s16_u16(neon_mulhi(vshlq_u16(magnitude, vdupq_n_s16(shift)), multiplier));
+	return vsubq_s16(veorq_s16(product, sign), sign);
+}
+
+/** A channel as the clip tables give it, before the loss of the format. */
+template<bool kScaleITU>
+FORCEINLINE uint16x8_t neon_clipChannel(int16x8_t value) {
+	if (!kScaleITU)
+		return vreinterpretq_u16_s16(vminq_s16(vmaxq_s16(value, vdupq_n_s16(0)), vdupq_n_s16(255)));
+
+	value = vminq_s16(vmaxq_s16(value, vdupq_n_s16(16)), vdupq_n_s16(235));
+	const uint16x8_t scaled = vshlq_n_u16(vreinterpretq_u16_s16(vsubq_s16(value, vdupq_n_s16(16))), kYUVScaleITUShift);
+	return neon_mulhi(scaled, kYUVScaleITUMultiplier);
+}
+
+FORCEINLINE int16x8_t neon_loadChroma(const byte *src, bool halfChroma) {
+	uint8x8_t c;
+	if (!halfChroma) {
+		c = vld1_u8(src);
+	} else {
+		uint32_t pairs;
+		memcpy(&pairs, src, sizeof(pairs));
+		const uint8x8_t p = vreinterpret_u8_u32(vdup_n_u32(pairs));
+		c = vzip_u8(p, p).val[0];
+	}
+	return vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(c)), vdupq_n_s16(128));
+}
+
+FORCEINLINE uint32x4_t neon_packPixels(uint16x4_t r, uint16x4_t g, uint16x4_t b, int32x4_t rShift, int32x4_t gShift, int32x4_t bShift, uint32x4_t alpha) {
+	uint32x4_t pixels = vorrq_u32(vshlq_u32(vmovl_u16(r), rShift), vshlq_u32(vmovl_u16(g), gShift));
+	return vorrq_u32(pixels, vorrq_u32(vshlq_u32(vmovl_u16(b), bShift), alpha));
+}
+
+template<int kBytesPerPixel, bool kHalfChroma, bool kScaleITU>
+uint convertYUVRow(byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, uint w, const PixelFormat &format) {
+	const int16x8_t rLoss = vdupq_n_s16(-format.rLoss);
+	const int16x8_t gLoss = vdupq_n_s16(-format.gLoss);
+	const int16x8_t bLoss = vdupq_n_s16(-format.bLoss);
+	const uint32 alpha = (0xFF >> format.aLoss) << format.aShift;
+
+	uint x = 0;
+	for (; x + 8 <= w; x += 8) {
+		const uint uvX = kHalfChroma ? x / 2 : x;
+		const int16x8_t y = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(ySrc + x)));
+		const int16x8_t u = neon_loadChroma(uSrc + uvX, kHalfChroma);
+		const int16x8_t v = neon_loadChroma(vSrc + uvX, kHalfChroma);
+
+		const int16x8_t uSign = vshrq_n_s16(u, 15);
+		const int16x8_t vSign = vshrq_n_s16(v, 15);
+		const uint16x8_t uMagnitude = vreinterpretq_u16_s16(vabsq_s16(u));
+		const uint16x8_t vMagnitude = vreinterpretq_u16_s16(vabsq_s16(v));
+
+		const int16x8_t dr = neon_chromaProduct(vMagnitude, vSign, kYUVCrToRShift, kYUVCrToRMultiplier);
+		const int16x8_t dg = vaddq_s16(neon_chromaProduct(vMagnitude, vSign, kYUVCrToGShift, kYUVCrToGMultiplier),
+		                               neon_chromaProduct(uMagnitude, uSign, kYUVCbToGShift, kYUVCbToGMultiplier));
+		const int16x8_t db = neon_chromaProduct(uMagnitude, uSign, kYUVCbToBShift, kYUVCbToBMultiplier);
+
+		const uint16x8_t r = vshlq_u16(neon_clipChannel<kScaleITU>(vaddq_s16(y, dr)), rLoss);
+		const uint16x8_t g = vshlq_u16(neon_clipChannel<kScaleITU>(vsubq_s16(y, dg)), gLoss);
+		const uint16x8_t b = vshlq_u16(neon_clipChannel<kScaleITU>(vaddq_s16(y, db)), bLoss);
+
+		if (kBytesPerPixel == 2) {
+			uint16x8_t pixels = vorrq_u16(vshlq_u16(r, vdupq_n_s16(format.rShift)), vshlq_u16(g, vdupq_n_s16(format.gShift)));
+			pixels = vorrq_u16(pixels, vshlq_u16(b, vdupq_n_s16(format.bShift)));
+			pixels = vorrq_u16(pixels, vdupq_n_u16(alpha));
+			vst1q_u16((uint16_t *)(dst + x * 2), pixels);
+		} else {
+			const int32x4_t rShift = vdupq_n_s32(format.rShift);
+			const int32x4_t gShift = vdupq_n_s32(format.gShift);
+			const int32x4_t bShift = vdupq_n_s32(format.bShift);
+			const uint32x4_t a = vdupq_n_u32(alpha);
+			vst1q_u32((uint32_t *)(dst + x * 4), neon_packPixels(vget_low_u16(r), vget_low_u16(g), vget_low_u16(b), rShift, gShift, bShift, a));
+			vst1q_u32((uint32_t *)(dst + x * 4 + 16), neon_packPixels(vget_high_u16(r), vget_high_u16(g), vget_high_u16(b), rShift, gShift, bShift, a));
+		}
+	}
+
+	return x;
+}
+
+template<int kBytesPerPixel>
+uint convertYUVRow(byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, uint w, bool halfChroma, const PixelFormat &format, bool scaleITU) {
+	if (halfChroma) {
+		if (scaleITU)
+			return convertYUVRow<kBytesPerPixel, true, true>(dst, ySrc, uSrc, vSrc, w, format);
+		return convertYUVRow<kBytesPerPixel, true, false>(dst, ySrc, uSrc, vSrc, w, format);
+	}
+
+	if (scaleITU)
+		return convertYUVRow<kBytesPerPixel, false, true>(dst, ySrc, uSrc, vSrc, w, format);
+	return convertYUVRow<kBytesPerPixel, false, false>(dst, ySrc, uSrc, vSrc, w, format);
+}
+
+} // End of anonymous namespace
+
+uint convertYUVRowNEON(byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, uint w, bool halfChroma, const PixelFormat &format, bool scaleITU) {
+	if (format.bytesPerPixel == 2)
+		return convertYUVRow<2>(dst, ySrc, uSrc, vSrc, w, halfChroma, format, scaleITU);
+	return convertYUVRow<4>(dst, ySrc, uSrc, vSrc, w, halfChroma, format, scaleITU);
+}
+
+} // End of namespace Graphics
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,156 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#include "graphics/pixelformat.h"
+#include "graphics/yuv_to_rgb-kernels.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Graphics {
+
+namespace {
+
+/** The product of a chroma factor and the chroma values, truncated the way the tables are. */
+template<int kShift>
+FORCEINLINE __m128i sse2_chromaProduct(__m128i magnitude, __m128i sign, int multiplier) {
+	const __m128i product = _mm_mulhi_epu16(_mm_slli_epi16(magnitude, kShift), _mm_set1_epi16((int16)multiplier));
+	return _mm_sub_epi16(_mm_xor_si128(product, sign), sign);
+}
+
+/** A channel as the clip tables give it, before the loss of the format. */
+template<bool kScaleITU>
+FORCEINLINE __m128i sse2_clipChannel(__m128i value) {
+	if (!kScaleITU)
+		return _mm_min_epi16(_mm_max_epi16(value, _mm_setzero_si128()), _mm_set1_epi16(255));
+
+	value = _mm_min_epi16(_mm_max_epi16(value, _mm_set1_epi16(16)), _mm_set1_epi16(235));
+	value = _mm_slli_epi16(_mm_sub_epi16(value, _mm_set1_epi16(16)), kYUVScaleITUShift);
+	return _mm_mulhi_epu16(value, _mm_set1_epi16((int16)kYUVScaleITUMultiplier));
+}
+
+FORCEINLINE __m128i sse2_loadChroma(const byte *src, bool halfChroma) {
+	if (!halfChroma)
+		return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)src), _mm_setzero_si128());
+
+	int32 pairs;
+	memcpy(&pairs, src, sizeof(pairs));
+	const __m128i c = _mm_cvtsi32_si128(pairs);
+	return _mm_unpacklo_epi8(_mm_unpacklo_epi8(c, c), _mm_setzero_si128());
+}
+
+template<int kBytesPerPixel, bool kHalfChroma, bool kScaleITU>
+uint convertYUVRow(byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, uint w, const PixelFormat &format) {
+	const __m128i rLoss = _mm_cvtsi32_si128(format.rLoss);
+	const __m128i gLoss = _mm_cvtsi32_si128(format.gLoss);
+	const __m128i bLoss = _mm_cvtsi32_si128(format.bLoss);
+	const __m128i rShift = _mm_cvtsi32_si128(format.rShift);
+	const __m128i gShift = _mm_cvtsi32_si128(format.gShift);
+	const __m128i bShift = _mm_cvtsi32_si128(format.bShift);
+	const uint32 alpha = (0xFF >> format.aLoss) << format.aShift;
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i offset = _mm_set1_epi16(128);
+
+	uint x = 0;
+	for (; x + 8 <= w; x += 8) {
+		const uint uvX = kHalfChroma ? x / 2 : x;
+		const __m128i y = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)(ySrc + x)), zero);
+		const __m128i u = _mm_sub_epi16(sse2_loadChroma(uSrc + uvX, kHalfChroma), offset);
+		const __m128i v = _mm_sub_epi16(sse2_loadChroma(vSrc + uvX, kHalfChroma), offset);
+
+		const __m128i uSign = _mm_srai_epi16(u, 15);
+		const __m128i vSign = _mm_srai_epi16(v, 15);
+		const __m128i uMagnitude = _mm_sub_epi16(_mm_xor_si128(u, uSign), uSign);
+		const __m128i vMagnitude = _mm_sub_epi16(_mm_xor_si128(v, vSign), vSign);
+
+		const __m128i dr = sse2_chromaProduct<kYUVCrToRShift>(vMagnitude, vSign, kYUVCrToRMultiplier);
+		const __m128i dg = _mm_add_epi16(sse2_chromaProduct<kYUVCrToGShift>(vMagnitude, vSign, kYUVCrToGMultiplier),
+		                                 sse2_chromaProduct<kYUVCbToGShift>(uMagnitude, uSign, kYUVCbToGMultiplier));
+		const __m128i db = sse2_chromaProduct<kYUVCbToBShift>(uMagnitude, uSign, kYUVCbToBMultiplier);
+
+		const __m128i r = _mm_srl_epi16(sse2_clipChannel<kScaleITU>(_mm_add_epi16(y, dr)), rLoss);
+		const __m128i g = _mm_srl_epi16(sse2_clipChannel<kScaleITU>(_mm_sub_epi16(y, dg)), gLoss);
+		const __m128i b = _mm_srl_epi16(sse2_clipChannel<kScaleITU>(_mm_add_epi16(y, db)), bLoss);
+
+		if (kBytesPerPixel == 2) {
+			__m128i pixels = _mm_or_si128(_mm_sll_epi16(r, rShift), _mm_sll_epi16(g, gShift));
+			pixels = _mm_or_si128(pixels, _mm_sll_epi16(b, bShift));
+			pixels = _mm_or_si128(pixels, _mm_set1_epi16((int16)alpha));
+			_mm_storeu_si128((__m128i *)(dst + x * 2), pixels);
+		} else {
+			const __m128i a = _mm_set1_epi32(alpha);
+			__m128i pixels = _mm_or_si128(_mm_sll_epi32(_mm_unpacklo_epi16(r, zero), rShift), _mm_sll_epi32(_mm_unpacklo_epi16(g, zero), gShift));
+			pixels = _mm_or_si128(pixels, _mm_or_si128(_mm_sll_epi32(_mm_unpacklo_epi16(b, zero), bShift), a));
+			_mm_storeu_si128((__m128i *)(dst + x * 4), pixels);
+
+			pixels = _mm_or_si128(_mm_sll_epi32(_mm_unpackhi_epi16(r, zero), rShift), _mm_sll_epi32(_mm_unpackhi_epi16(g, zero), gShift));
+			pixels = _mm_or_si128(pixels, _mm_or_si128(_mm_sll_epi32(_mm_unpackhi_epi16(b, zero), bShift), a));
+			_mm_storeu_si128((__m128i *)(dst + x * 4 + 16), pixels);
+		}
+	}
+
+	return x;
+}
+
+template<int kBytesPerPixel>
+uint convertYUVRow(byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, uint w, bool halfChroma, const PixelFormat &format, bool scaleITU) {
+	if (halfChroma) {
+		if (scaleITU)
+			return convertYUVRow<kBytesPerPixel, true, true>(dst, ySrc, uSrc, vSrc, w, format);
+		return convertYUVRow<kBytesPerPixel, true, false>(dst, ySrc, uSrc, vSrc, w, format);
+	}
+
+	if (scaleITU)
+		return convertYUVRow<kBytesPerPixel, false, true>(dst, ySrc, uSrc, vSrc, w, format);
+	return convertYUVRow<kBytesPerPixel, false, false>(dst, ySrc, uSrc, vSrc, w, format);
+}
+
+} // End of anonymous namespace
+
+uint convertYUVRowSSE2(byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, uint w, bool halfChroma, const PixelFormat &format, bool scaleITU) {
+	if (format.bytesPerPixel == 2)
+		return convertYUVRow<2>(dst, ySrc, uSrc, vSrc, w, halfChroma, format, scaleITU);
+	return convertYUVRow<4>(dst, ySrc, uSrc, vSrc, w, halfChroma, format, scaleITU);
+}
+
+} // End of namespace Graphics
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
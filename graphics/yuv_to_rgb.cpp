@@ -82,6 +82,10 @@
 // BASIS, AND BROWN UNIVERSITY HAS NO OBLIGATION TO PROVIDE MAINTENANCE,
 // SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
 
+#include "common/system.h"
+#include "common/textconsole.h"
+
+#include "graphics/blit.h"
 #include "graphics/surface.h"
 #include "graphics/yuv_to_rgb.h"
 
@@ -91,6 +95,61 @@ DECLARE_SINGLETON(Graphics::YUVToRGBManager);
 
 namespace Graphics {
 
+#ifdef SCUMMVM_SSE2
+// Defined in yuv_to_rgb-sse2.cpp
+uint convertYUVRowSSE2(byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, uint w, bool halfChroma, const PixelFormat &format, bool scaleITU);
+#endif
+
+#ifdef SCUMMVM_AVX2
+// Defined in yuv_to_rgb-avx2.cpp
+uint convertYUVRowAVX2(byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, uint w, bool halfChroma, const PixelFormat &format, bool scaleITU);
+#endif
+
+#ifdef SCUMMVM_NEON
+// Defined in yuv_to_rgb-neon.cpp
+uint convertYUVRowNEON(byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, uint w, bool halfChroma, const PixelFormat &format, bool scaleITU);
+#endif
+
+// Defined in blit/blit.cpp
+void selectBlitKernels();
+
+namespace {
+
+// The SIMD kernels convert the start of a row and return how many pixels
+// they did, the rest is left to the generic code. With halfChroma there
+// is one chroma sample for every two pixels. They give the same results
+// as the tables of YUVToRGBLookup, see yuv_to_rgb-kernels.h.
+typedef uint (*ConvertYUVRowFunc)(byte *dst, const byte *ySrc, const byte *uSrc, const byte *vSrc, uint w, bool halfChroma, const PixelFormat &format, bool scaleITU);
+
+uint skipConvertYUVRow(byte *, const byte *, const byte *, const byte *, uint, bool, const PixelFormat &, bool) { return 0; }
+
+ConvertYUVRowFunc convertYUVRow = skipConvertYUVRow;
+
+} // End of anonymous namespace
+
+void setYUVToRGBKernels(BlitKernelSet set) {
+	switch (set) {
+#ifdef SCUMMVM_SSE2
+	case kBlitKernelsSSE2:
+		convertYUVRow = convertYUVRowSSE2;
+		break;
+#endif
+#ifdef SCUMMVM_AVX2
+	case kBlitKernelsAVX2:
+		convertYUVRow = convertYUVRowAVX2;
+		break;
+#endif
+#ifdef SCUMMVM_NEON
+	case kBlitKernelsNEON:
+		convertYUVRow = convertYUVRowNEON;
+		break;
+#endif
+	default:
+		convertYUVRow = skipConvertYUVRow;
+		break;
+	}
+}
+
 class YUVToRGBLookup {
 public:
 	YUVToRGBLookup(Graphics::PixelFormat format, YUVToRGBManager::LuminanceScale scale);
@@ -216,8 +275,16 @@ void convertYUV444ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup
 	const byte b_shift = lookup->getFormat().bShift;
 	const PixelInt a_mask = (0xFF >> lookup->getFormat().aLoss) << lookup->getFormat().aShift;
 
+	const bool scaleITU = (lookup->getScale() == YUVToRGBManager::kScaleITU);
+
 	for (int h = 0; h < yHeight; h++) {
-		for (int w = 0; w < yWidth; w++) {
+		const int done = convertYUVRow(dstPtr, ySrc, uSrc, vSrc, yWidth, false, lookup->getFormat(), scaleITU);
+		dstPtr += done * sizeof(PixelInt);
+		ySrc += done;
+		uSrc += done;
+		vSrc += done;
+
+		for (int w = done; w < yWidth; w++) {
 			const byte *L;
 
 			int16 cr_r  = Cr_r_tab[*vSrc];
@@ -245,6 +312,7 @@ void YUVToRGBManager::convert444(Graphics::Surface *dst, YUVToRGBManager::Lumina
 	assert(ySrc && uSrc && vSrc);
 
 	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
+	selectBlitKernels();
 
 	// Use a templated function to avoid an if check on every pixel
 	if (dst->format.bytesPerPixel == 2)
@@ -269,8 +337,16 @@ void convertYUV422ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup
 	const byte b_shift = lookup->getFormat().bShift;
 	const PixelInt a_mask = (0xFF >> lookup->getFormat().aLoss) << lookup->getFormat().aShift;
 
+	const bool scaleITU = (lookup->getScale() == YUVToRGBManager::kScaleITU);
+
 	for (int h = 0; h < yHeight; h++) {
-		for (int w = 0; w < halfWidth; w++) {
+		const int done = convertYUVRow(dstPtr, ySrc, uSrc, vSrc, yWidth, true, lookup->getFormat(), scaleITU);
+		dstPtr += done * sizeof(PixelInt);
+		ySrc += done;
+		uSrc += done / 2;
+		vSrc += done / 2;
+
+		for (int w = done / 2; w < halfWidth; w++) {
 			const byte *L;
 
 			int16 cr_r  = Cr_r_tab[*vSrc];
@@ -302,6 +378,7 @@ void YUVToRGBManager::convert422(Graphics::Surface *dst, YUVToRGBManager::Lumina
 	assert((yWidth & 1) == 0);
 
 	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
+	selectBlitKernels();
 
 	// Use a templated function to avoid an if check on every pixel
 	if (dst->format.bytesPerPixel == 2)
@@ -326,9 +403,18 @@ void convertYUV420ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup
 	const byte g_shift = lookup->getFormat().gShift;
 	const byte b_shift = lookup->getFormat().bShift;
 	const PixelInt a_mask = (0xFF >> lookup->getFormat().aLoss) << lookup->getFormat().aShift;
+	const bool scaleITU = (lookup->getScale() == YUVToRGBManager::kScaleITU);
 
 	for (int h = 0; h < halfHeight; h++) {
-		for (int w = 0; w < halfWidth; w++) {
+		// Both rows share the chroma samples, so the kernel does as much of each
+		const int done = convertYUVRow(dstPtr, ySrc, uSrc, vSrc, yWidth, true, lookup->getFormat(), scaleITU);
+		convertYUVRow(dstPtr + dstPitch, ySrc + yPitch, uSrc, vSrc, yWidth, true, lookup->getFormat(), scaleITU);
+		dstPtr += done * sizeof(PixelInt);
+		ySrc += done;
+		uSrc += done / 2;
+		vSrc += done / 2;
+
+		for (int w = done / 2; w < halfWidth; w++) {
 			const byte *L;
 
 			int16 cr_r  = Cr_r_tab[*vSrc];
@@ -347,7 +433,7 @@ void convertYUV420ToRGB(byte *dstPtr, int dstPitch, const YUVToRGBLookup *lookup
 			dstPtr += sizeof(PixelInt);
 		}
 
-		dstPtr += dstPitch;
+		dstPtr += (dstPitch << 1) - yWidth * sizeof(PixelInt);
 		ySrc += (yPitch << 1) - yWidth;
 		uSrc += uvPitch - halfWidth;
 		vSrc += uvPitch - halfWidth;
@@ -363,6 +449,7 @@ void YUVToRGBManager::convert420(Graphics::Surface *dst, YUVToRGBManager::Lumina
 	assert((yHeight & 1) == 0);
 
 	const YUVToRGBLookup *lookup = getLookup(dst->format, scale);
+	selectBlitKernels();
 
 	// Use a templated function to avoid an if check on every pixel
 	if (dst->format.bytesPerPixel == 2)
@@ -415,7 +502,7 @@ void convertYUVA420ToRGBA(byte *dstPtr, int dstPitch, const YUVToRGBLookup *look
 			dstPtr += sizeof(PixelInt);
 		}
 
-		dstPtr += dstPitch;
+		dstPtr += (dstPitch << 1) - yWidth * sizeof(PixelInt);
 		ySrc += (yPitch << 1) - yWidth;
 		aSrc += (yPitch << 1) - yWidth;
 		uSrc += uvPitch - halfWidth;
@@ -530,4 +617,40 @@ void YUVToRGBManager::convert410(Graphics::Surface *dst, YUVToRGBManager::Lumina
 		convertYUV410ToRGB<uint32>((byte *)dst->getPixels(), dst->pitch, lookup, ySrc, uSrc, vSrc, yWidth, yHeight, yPitch, uvPitch);
 }
 
+void YUVToRGBManager::convert(Graphics::Surface *dst, const YUVSurface &src) {
+	switch (src.subsampling) {
+	case YUVSurface::kSubsampling444:
+		convert444(dst, src.scale, src.y, src.u, src.v, src.w, src.h, src.yPitch, src.uvPitch);
+		break;
+	case YUVSurface::kSubsampling422:
+		convert422(dst, src.scale, src.y, src.u, src.v, src.w, src.h, src.yPitch, src.uvPitch);
+		break;
+	case YUVSurface::kSubsampling420:
+		convert420(dst, src.scale, src.y, src.u, src.v, src.w, src.h, src.yPitch, src.uvPitch);
+		break;
+	case YUVSurface::kSubsampling410:
+		convert410(dst, src.scale, src.y, src.u, src.v, src.w, src.h, src.yPitch, src.uvPitch);
+		break;
+	default:
+		break;
+	}
+}
+
+void copyYUVToScreen(const YUVSurface &src, int x, int y) {
+	if (g_system->copyYUVRectToScreen(src, x, y))
+		return;
+
+	const Graphics::PixelFormat format = g_system->getScreenFormat();
+	if (format.bytesPerPixel != 2 && format.bytesPerPixel != 4) {
+		warning("copyYUVToScreen: Unsupported screen format %s", format.toString().c_str());
+		return;
+	}
+
+	Graphics::Surface surface;
+	surface.create(src.w, src.h, format);
+	YUVToRGBMan.convert(&surface, src);
+	g_system->copyRectToScreen(surface.getPixels(), surface.pitch, x, y, surface.w, surface.h);
+	surface.free();
+}
+
 } // End of namespace Graphics
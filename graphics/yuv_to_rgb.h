@@ -44,6 +44,7 @@
 namespace Graphics {
 
 class YUVToRGBLookup;
+struct YUVSurface;
 
 class YUVToRGBManager : public Common::Singleton<YUVToRGBManager> {
 public:
@@ -135,6 +136,15 @@ public:
 	 */
 	void convert410(Graphics::Surface *dst, LuminanceScale scale, const byte *ySrc, const byte *uSrc, const byte *vSrc, int yWidth, int yHeight, int yPitch, int uvPitch);
 
+	/**
+	 * Convert a planar YUV image to an RGB surface, with the function for
+	 * its subsampling
+	 *
+	 * @param dst     the destination surface
+	 * @param src     the planes of the image
+	 */
+	void convert(Graphics::Surface *dst, const YUVSurface &src);
+
 private:
 	friend class Common::Singleton<SingletonBaseType>;
 	YUVToRGBManager();
@@ -144,6 +154,44 @@ private:
 
 	YUVToRGBLookup *_lookup;
 };
+/**
+ * The planes of a YUV image, for passing a decoded video frame on without
+ * converting it to RGB first, see OSystem::copyYUVRectToScreen().
+ *
+ * The surface does not own the planes.
+ */
+struct YUVSurface {
+	/** How the chroma planes are subsampled */
+	enum Subsampling {
+		kSubsampling444, /** Full resolution chroma */
+		kSubsampling422, /** Half horizontal resolution chroma */
+		kSubsampling420, /** Half horizontal and vertical resolution chroma */
+		kSubsampling410  /** Quarter resolution chroma, see YUVToRGBManager::convert410() */
+	};
+
+	const byte *y;  ///< The luminance plane
+	const byte *u;  ///< The blue difference chroma plane
+	const byte *v;  ///< The red difference chroma plane
+
+	int w;          ///< The width of the luminance plane
+	int h;          ///< The height of the luminance plane
+	int yPitch;     ///< The pitch of the luminance plane
+	int uvPitch;    ///< The pitch of the chroma planes
+
+	Subsampling subsampling;
+	YUVToRGBManager::LuminanceScale scale;
+};
+
+/**
+ * Blit a YUV image to the virtual screen at the given position.
+ *
+ * The conversion is left to the backend if it can do it, otherwise the
+ * image is converted to the screen format here first.
+ *
+ * @see OSystem::copyYUVRectToScreen
+ */
+void copyYUVToScreen(const YUVSurface &src, int x, int y);
+
  /** @} */
 } // End of namespace Graphics
 
@@ -32,6 +32,7 @@ DECLARE_SINGLETON(GUI::EventRecorder);
 #include "backends/timer/sdl/sdl-timer.h"
 #include "backends/mixer/mixer.h"
 #include "common/config-manager.h"
+#include "common/cyclecounter.h"
 #include "common/md5.h"
 #include "gui/gui-manager.h"
 #include "gui/widget.h"
@@ -57,6 +58,8 @@ EventRecorder::EventRecorder() {
 	_needRedraw = false;
 	_processingMillis = false;
 	_fastPlayback = false;
+	_benchmark = false;
+	memset(&_benchmarkStats, 0, sizeof(_benchmarkStats));
 	_lastTimeDate.tm_sec = 0;
 	_lastTimeDate.tm_min = 0;
 	_lastTimeDate.tm_hour = 0;
@@ -89,6 +92,11 @@ void EventRecorder::deinit() {
 		return;
 	}
 	setFileHeader();
+	if (_benchmark) {
+		reportBenchmark();
+		_benchmark = false;
+		_fastPlayback = false;
+	}
 	_needRedraw = false;
 	_initialized = false;
 	_recordMode = kPassthrough;
@@ -571,7 +579,10 @@ void EventRecorder::updateSubsystems() {
 	}
 	RecordMode oldRecordMode = _recordMode;
 	_recordMode = kPassthrough;
+	const uint64 startTicks = _benchmark ? Common::getCycleCount() : 0;
 	_fakeMixerManager->update();
+	if (_benchmark)
+		_benchmarkStats.audioTicks += Common::getCycleCount() - startTicks;
 	_recordMode = oldRecordMode;
 }
 
@@ -699,6 +710,19 @@ Common::SaveFileManager *EventRecorder::getSaveManager(Common::SaveFileManager *
 }
 
 void EventRecorder::preDrawOverlayGui() {
+	if (_benchmark) {
+		// The control panel is not shown, to measure the game alone
+		BenchmarkStats &stats = _benchmarkStats;
+		stats.frameStartTicks = Common::getCycleCount();
+		stats.frameEngineTicks = 0;
+		if (stats.lastFrameEndTicks) {
+			const uint64 audio = stats.audioTicks - stats.frameAudioTicks;
+			const uint64 frame = stats.frameStartTicks - stats.lastFrameEndTicks;
+			stats.frameEngineTicks = frame - MIN(audio, frame);
+			stats.engineTicks += stats.frameEngineTicks;
+		}
+		return;
+	}
 	if ((_initialized) || (_needRedraw)) {
 		RecordMode oldMode = _recordMode;
 		_recordMode = kPassthrough;
@@ -716,6 +740,17 @@ void EventRecorder::preDrawOverlayGui() {
 }
 
 void EventRecorder::postDrawOverlayGui() {
+	if (_benchmark) {
+		BenchmarkStats &stats = _benchmarkStats;
+		const uint64 now = Common::getCycleCount();
+		const uint64 render = now - stats.frameStartTicks;
+		stats.renderTicks += render;
+		stats.maxFrameTicks = MAX(stats.maxFrameTicks, stats.frameEngineTicks + render);
+		stats.frames++;
+		stats.lastFrameEndTicks = now;
+		stats.frameAudioTicks = stats.audioTicks;
+		return;
+	}
 	if ((_initialized) || (_needRedraw)) {
 		RecordMode oldMode = _recordMode;
 		_recordMode = kPassthrough;
@@ -724,6 +759,39 @@ void EventRecorder::postDrawOverlayGui() {
 	}
 }
 
+void EventRecorder::startBenchmark() {
+	if (_recordMode != kRecorderPlayback)
+		return;
+
+	_benchmark = true;
+	_fastPlayback = true;
+	memset(&_benchmarkStats, 0, sizeof(_benchmarkStats));
+	_benchmarkStats.startMillis = getRealMillis();
+	_benchmarkStats.startTicks = Common::getCycleCount();
+}
+
+uint32 EventRecorder::getRealMillis() {
+	// Only ask the backend clock, without replacing it with the recorded one
+	bool initialized = _initialized;
+	_initialized = false;
+	uint32 millis = g_system->getMillis(true);
+	_initialized = initialized;
+	return millis;
+}
+
+void EventRecorder::reportBenchmark() {
+	const BenchmarkStats &stats = _benchmarkStats;
+	const uint32 millis = MAX<uint32>(getRealMillis() - stats.startMillis, 1);
+	const uint64 ticks = Common::getCycleCount() - stats.startTicks;
+	const double ticksPerMs = ticks ? (double)ticks / millis : 1.0;
+	const uint32 frames = MAX<uint32>(stats.frames, 1);
+
+	debug("benchmark:wall=%u ms replayed=%u ms frames=%u", millis, _fakeTimer, stats.frames);
+	debug("benchmark:per_frame engine=%.3f ms render=%.3f ms audio=%.3f ms max=%.3f ms",
+		stats.engineTicks / ticksPerMs / frames, stats.renderTicks / ticksPerMs / frames,
+		stats.audioTicks / ticksPerMs / frames, stats.maxFrameTicks / ticksPerMs);
+}
+
 Common::StringArray EventRecorder::listSaveFiles(const Common::String &pattern) {
 	if ((_recordMode == kRecorderPlayback) || (_recordMode == kRecorderUpdate)) {
 		Common::StringArray result;
@@ -79,6 +79,12 @@ public:
 
 	void init(const Common::String &recordFileName, RecordMode mode);
 	void deinit();
+
+	/**
+	 * Replay the recording of the playback started by init() as fast as
+	 * possible, and report where the time went once it is done.
+	 */
+	void startBenchmark();
 	bool processDelayMillis();
 	uint32 getRandomSeed(const Common::String &name);
 	void processTimeAndDate(TimeDate &td, bool skipRecord);
@@ -249,6 +255,27 @@ private:
 	bool _fastPlayback;
 	bool _needRedraw;
 	bool _processingMillis;
+
+	/** Real time cost of a benchmark playback, in ticks of Common::getCycleCount(). */
+	struct BenchmarkStats {
+		uint32 startMillis;
+		uint64 startTicks;
+		uint32 frames;
+		uint64 engineTicks;   ///< Between screen updates, without audio.
+		uint64 renderTicks;   ///< In the graphics manager updating the screen.
+		uint64 audioTicks;    ///< Mixing the sound.
+		uint64 maxFrameTicks; ///< Longest engine plus render time of a frame.
+		uint64 frameStartTicks;
+		uint64 frameEngineTicks;
+		uint64 frameAudioTicks;
+		uint64 lastFrameEndTicks;
+	};
+
+	bool _benchmark;
+	BenchmarkStats _benchmarkStats;
+
+	uint32 getRealMillis();
+	void reportBenchmark();
 };
 
 } // End of namespace GUI
@@ -1550,10 +1550,26 @@ void ThemeEngine::addDirtyRect(Common::Rect r) {
 
 		// Conversely, if we find rectangles which are contained in
 		// the new one, we can remove them
-		if (r.contains(*it))
+		if (r.contains(*it)) {
 			it = _dirtyScreen.erase(it);
-		else
-			++it;
+			continue;
+		}
+
+		// Merge overlapping rectangles when their union is not larger than
+		// both of them, so the overlap does not get copied to the screen
+		// twice. The merged rectangle may now overlap others in the list.
+		if (r.intersects(*it)) {
+			Common::Rect merged(r);
+			merged.extend(*it);
+			if (merged.width() * merged.height() <= r.width() * r.height() + it->width() * it->height()) {
+				r = merged;
+				_dirtyScreen.erase(it);
+				it = _dirtyScreen.begin();
+				continue;
+			}
+		}
+
+		++it;
 	}
 
 	// If we got here, we can safely add r to the list of dirty rects.
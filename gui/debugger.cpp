@@ -22,9 +22,11 @@
 // NB: This is really only necessary if USE_READLINE is defined
 #define FORBIDDEN_SYMBOL_ALLOW_ALL
 
+#include "common/archive.h"
 #include "common/file.h"
 #include "common/debug.h"
 #include "common/debug-channels.h"
+#include "common/memtag.h"
 #include "common/system.h"
 
 #ifndef DISABLE_MD5
@@ -34,6 +36,8 @@
 #include "common/stream.h"
 #endif
 
+#include "audio/mixer_intern.h"
+
 #include "engines/engine.h"
 
 #include "gui/debugger.h"
@@ -76,6 +80,11 @@ Debugger::Debugger() {
 	registerCmd("clear",			WRAP_METHOD(Debugger, cmdClearLog));
 	registerCmd("cls",			WRAP_METHOD(Debugger, cmdClearLog)); // alias
 	registerCmd("exec",				WRAP_METHOD(Debugger, cmdExecFile));
+	registerCmd("archive_cache",	WRAP_METHOD(Debugger, cmdArchiveCache));
+	registerCmd("mixerstats",		WRAP_METHOD(Debugger, cmdMixerStats));
+#ifdef USE_MEMORY_TAGS
+	registerCmd("meminfo",			WRAP_METHOD(Debugger, cmdMemInfo));
+#endif
 
 	registerCmd("debuglevel",		WRAP_METHOD(Debugger, cmdDebugLevel));
 	registerCmd("debugflag_list",		WRAP_METHOD(Debugger, cmdDebugFlagsList));
@@ -857,6 +866,120 @@ bool Debugger::cmdDebugFlagDisable(int argc, const char **argv) {
 	return true;
 }
 
+bool Debugger::cmdArchiveCache(int argc, const char **argv) {
+	debugPrintf("Member cache of the archives in the search path:\n");
+	printArchiveCacheStats(SearchMan, "");
+	return true;
+}
+
+void Debugger::printArchiveCacheStats(const Common::SearchSet &searchSet, const Common::String &prefix) {
+	Common::List<Common::String> names;
+	searchSet.listArchiveNames(names);
+
+	for (const Common::String &name : names) {
+		Common::Archive *archive = searchSet.getArchive(name);
+		Common::String path = prefix + name;
+
+		const Common::SearchSet *subSet = dynamic_cast<const Common::SearchSet *>(archive);
+		if (subSet) {
+			printArchiveCacheStats(*subSet, path + " > ");
+			continue;
+		}
+
+		const Common::MemcachingCaseInsensitiveArchive *cached = dynamic_cast<const Common::MemcachingCaseInsensitiveArchive *>(archive);
+		if (!cached)
+			continue;
+
+		const Common::MemcachingCaseInsensitiveArchive::CacheStats &stats = cached->getCacheStats();
+		debugPrintf("%s: %u hits, %u misses, %u evictions, %u/%u bytes\n", path.c_str(),
+			stats.hits, stats.misses, stats.evictions, stats.strongBytes, cached->getStrongCacheBudget());
+	}
+}
+
+bool Debugger::cmdMixerStats(int argc, const char **argv) {
+	Audio::MixerImpl *mixer = dynamic_cast<Audio::MixerImpl *>(g_system->getMixer());
+	if (!mixer) {
+		debugPrintf("No mixer to measure\n");
+		return true;
+	}
+
+	if (argc == 2 && (!strcmp(argv[1], "on") || !strcmp(argv[1], "reset"))) {
+		mixer->enableStats(true);
+		debugPrintf("Measuring the mixer from now on\n");
+		return true;
+	} else if (argc == 2 && !strcmp(argv[1], "off")) {
+		mixer->enableStats(false);
+		debugPrintf("Stopped measuring the mixer\n");
+		return true;
+	} else if (argc != 1) {
+		debugPrintf("Usage: %s [on|off|reset]\n", argv[0]);
+		return true;
+	}
+
+	if (!mixer->isStatsEnabled()) {
+		debugPrintf("The mixer is not being measured, start with '%s on'\n", argv[0]);
+		return true;
+	}
+
+	Audio::MixerImpl::Stats stats;
+	mixer->getStats(stats);
+	if (!stats.elapsedMillis || !stats.elapsedTicks || !stats.callbacks) {
+		debugPrintf("Nothing measured yet\n");
+		return true;
+	}
+
+	const double seconds = stats.elapsedMillis / 1000.0;
+	const double ticksPerUs = (double)stats.elapsedTicks / (stats.elapsedMillis * 1000.0);
+	const double bufferUs = stats.samples * 1000000.0 / stats.callbacks / mixer->getOutputRate();
+
+	debugPrintf("Measured for %.1f s at %u Hz: %u callbacks of %.0f us on average\n",
+		seconds, mixer->getOutputRate(), stats.callbacks, bufferUs);
+	debugPrintf("Callback duration: %.0f us on average, %.0f us at most, %u missed deadlines\n",
+		stats.callbackTicks / ticksPerUs / stats.callbacks, stats.maxCallbackTicks / ticksPerUs, stats.missedDeadlines);
+
+	for (int i = 0; i < Audio::MixerImpl::kStatsHistogramSize; ++i) {
+		if (stats.histogram[i])
+			debugPrintf("  < %8.0f us: %u\n", (double)((uint64)2 << i) / ticksPerUs, stats.histogram[i]);
+	}
+
+	static const char *const typeNames[] = { "plain", "music", "sfx", "speech" };
+	debugPrintf("Channels (time per second of measurement):\n");
+	for (const Audio::MixerImpl::ChannelStats &channel : stats.channels) {
+		debugPrintf("  channel %d, id %d, %s, %u Hz: decode %.2f ms, resample %.2f ms, %.1f s mixed\n",
+			channel.slot, channel.id, typeNames[channel.type], channel.rate,
+			channel.decodeTicks / ticksPerUs / 1000.0 / seconds, channel.resampleTicks / ticksPerUs / 1000.0 / seconds,
+			(double)channel.samples / mixer->getOutputRate());
+	}
+	if (stats.channels.empty())
+		debugPrintf("  none playing\n");
+
+	return true;
+}
+
+#ifdef USE_MEMORY_TAGS
+bool Debugger::cmdMemInfo(int argc, const char **argv) {
+	if (argc > 2) {
+		debugPrintf("Usage: %s [number of allocations]\n", argv[0]);
+		return true;
+	}
+	uint count = (argc == 2) ? atoi(argv[1]) : 10;
+
+	const Common::Array<Common::MemoryTagInfo> tags = Common::getMemoryTagInfo();
+	debugPrintf("Memory per tag (current KB, peak KB, allocations):\n");
+	for (const Common::MemoryTagInfo &tag : tags) {
+		debugPrintf("  %-31s %10.1f %10.1f %10.0f\n", tag.name,
+			tag.currentBytes / 1024.0, tag.peakBytes / 1024.0, (double)tag.allocations);
+	}
+
+	const Common::Array<Common::MemoryAllocationInfo> largest = Common::getLargestAllocations(count);
+	debugPrintf("Largest allocations:\n");
+	for (const Common::MemoryAllocationInfo &allocation : largest)
+		debugPrintf("  %10.1f KB  %s\n", allocation.size / 1024.0, allocation.tag);
+
+	return true;
+}
+#endif
+
 // Console handler
 #ifndef USE_TEXT_CONSOLE_FOR_DEBUGGER
 bool Debugger::debuggerInputCallback(GUI::ConsoleDialog *console, const char *input, void *refCon) {
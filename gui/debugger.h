@@ -32,6 +32,10 @@
 
 #include "engines/engine.h"
 
+namespace Common {
+class SearchSet;
+}
+
 namespace GUI {
 
 #ifndef USE_TEXT_CONSOLE_FOR_DEBUGGER
@@ -277,6 +281,14 @@ protected:
 	bool cmdDebugFlagDisable(int argc, const char **argv);
 	bool cmdClearLog(int argc, const char **argv);
 	bool cmdExecFile(int argc, const char **argv);
+	bool cmdArchiveCache(int argc, const char **argv);
+	bool cmdMixerStats(int argc, const char **argv);
+#ifdef USE_MEMORY_TAGS
+	bool cmdMemInfo(int argc, const char **argv);
+#endif
+
+private:
+	void printArchiveCacheStats(const Common::SearchSet &searchSet, const Common::String &prefix);
 
 #ifndef USE_TEXT_CONSOLE_FOR_DEBUGGER
 private:
@@ -65,29 +65,36 @@ DownloadDLCsDialog::DownloadDLCsDialog()
 
 Common::U32String DownloadDLCsDialog::getSizeLabelText() {
 	const char *downloadedUnits, *totalUnits;
-	Common::String downloaded = Common::getHumanReadableBytes(DLCMan._currentDownloadedSize, downloadedUnits);
-	Common::String total = Common::getHumanReadableBytes(DLCMan._queuedDownloadTasks.front()->size, totalUnits);
+	Common::String downloaded = Common::getHumanReadableBytes(DLCMan.getActiveDownloadedSize(), downloadedUnits);
+	Common::String total = Common::getHumanReadableBytes(DLCMan.getActiveDownloadSize(), totalUnits);
 	return Common::U32String::format(_("Downloaded %s %S / %s %S"), downloaded.c_str(), _(downloadedUnits).c_str(), total.c_str(), _(totalUnits).c_str());
 }
 
 uint32 DownloadDLCsDialog::getDownloadingProgress() {
-	if (DLCMan._queuedDownloadTasks.empty()) {
+	if (DLCMan.getActiveDownloadSize() == 0) {
 		// no DLC is currently downloading
 		return 0;
 	}
-	uint32 progress = (uint32)(100 * ((double)DLCMan._currentDownloadedSize / (double)DLCMan._queuedDownloadTasks.front()->size));
+	uint32 progress = (uint32)(100 * ((double)DLCMan.getActiveDownloadedSize() / (double)DLCMan.getActiveDownloadSize()));
 	return progress;
 }
 
 void DownloadDLCsDialog::refreshWidgets() {
 	Common::U32StringArray pendingList;
-	if (DLCMan._queuedDownloadTasks.empty()) {
+	if (DLCMan._dlcsInProgress.empty()) {
 		// no DLC is currently downloading
 		_currentDownloadLabel->setLabel(Common::U32String("No downloads in progress"));
 		_downloadedSizeLabel->setLabel(Common::U32String());
 		_pendingDownloadsList->setList(pendingList);
 	} else {
-		_currentDownloadLabel->setLabel(DLCMan._queuedDownloadTasks.front()->name);
+		// several DLCs are downloaded at the same time
+		Common::String current;
+		for (const auto &it : DLCMan.getActiveDownloads()) {
+			if (!current.empty())
+				current += ", ";
+			current += it->name;
+		}
+		_currentDownloadLabel->setLabel(current);
 		_downloadedSizeLabel->setLabel(getSizeLabelText());
 
 		for (const auto &it : DLCMan._dlcsInProgress) {
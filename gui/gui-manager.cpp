@@ -74,6 +74,10 @@ GuiManager::GuiManager() : CommandSender(nullptr), _redrawStatus(kRedrawDisabled
 
 	_displayTopDialogOnly = false;
 
+	_showFrameStats = false;
+	memset(_frameHistory, 0, sizeof(_frameHistory));
+	_frameHistoryPos = 0;
+
 	// Clear the cursor
 	memset(_cursor, 0xFF, sizeof(_cursor));
 
@@ -104,6 +108,7 @@ GuiManager::GuiManager() : CommandSender(nullptr), _redrawStatus(kRedrawDisabled
 }
 
 GuiManager::~GuiManager() {
+	_frameStatsSurface.free();
 	delete _theme;
 	delete _wm;
 }
@@ -482,13 +487,19 @@ void GuiManager::redraw() {
 		setDialogPaddings(0, 0);
 	}
 
-	if (_displayTopDialogOnly) {
-		redrawInternalTopDialogOnly();
-	} else {
-		redrawInternal();
+	{
+		FrameTimingScope scope("draw");
+		if (_displayTopDialogOnly) {
+			redrawInternalTopDialogOnly();
+		} else {
+			redrawInternal();
+		}
 	}
 
-	_theme->updateScreen();
+	{
+		FrameTimingScope scope("copy");
+		_theme->updateScreen();
+	}
 	_redrawStatus = kRedrawDisabled;
 }
 
@@ -553,6 +564,8 @@ void GuiManager::runLoop() {
 	Common::EventManager *eventMan = _system->getEventManager();
 	const uint32 targetFrameDuration = 1000 / 60;
 
+	_showFrameStats = ConfMan.getBool("gui_frame_stats");
+
 	while (!_dialogStack.empty() && activeDialog == getTopDialog() && !eventMan->shouldQuit() && (!g_engine || !eventMan->shouldReturnToLauncher())) {
 		uint32 frameStartTime = _system->getMillis(true);
 
@@ -660,6 +673,9 @@ void GuiManager::runLoop() {
 
 		redraw();
 
+		if (_showFrameStats)
+			drawFrameStats(_system->getMillis(true) - frameStartTime);
+
 		// Delay until the allocated frame time is elapsed to match the target frame rate.
 		// In case we have vsync enabled, we should rely on vsync to do take care about frame times.
 		// With vsync enabled, we currently have to force a frame time of 1ms since otherwise
@@ -825,6 +841,8 @@ void GuiManager::screenChange() {
 
 	computeScaleFactor();
 
+	uint32 layoutStartTime = _system->getMillis(true);
+
 	// reinit the whole theme
 	_theme->refresh();
 
@@ -832,6 +850,8 @@ void GuiManager::screenChange() {
 	for (DialogStack::size_type i = 0; i < _dialogStack.size(); ++i) {
 		_dialogStack[i]->reflowLayout();
 	}
+	addFrameTiming("layout", _system->getMillis(true) - layoutStartTime);
+
 	// We need to redraw immediately. Otherwise
 	// some other event may cause a widget to be
 	// redrawn before redraw() has been called.
@@ -999,4 +1019,86 @@ Graphics::MacWindowManager *GuiManager::getWM() {
 	return _wm;
 }
 
+void GuiManager::addFrameTiming(const Common::String &label, uint32 millis) {
+	if (!_showFrameStats)
+		return;
+
+	for (uint i = 0; i < _frameTimings.size(); i++) {
+		if (_frameTimings[i].label == label) {
+			_frameTimings[i].millis += millis;
+			return;
+		}
+	}
+
+	FrameTiming timing;
+	timing.label = label;
+	timing.millis = millis;
+	_frameTimings.push_back(timing);
+}
+
+void GuiManager::drawFrameStats(uint32 frameTime) {
+	_frameHistory[_frameHistoryPos] = frameTime;
+	_frameHistoryPos = (_frameHistoryPos + 1) % kFrameStatsHistory;
+
+	// Keep the timings of the frame on screen until the next one is done
+	_lastFrameTimings.swap(_frameTimings);
+	_frameTimings.clear();
+
+	const Graphics::Font *font = _theme->getFont(ThemeEngine::kFontStyleTooltip);
+	if (!font)
+		return;
+
+	const int lineHeight = font->getFontHeight() + 2;
+	const int graphHeight = 32;
+	const int width = kFrameStatsHistory * 2 + 4;
+	const int height = (_lastFrameTimings.size() + 1) * lineHeight + graphHeight + 6;
+
+	const Graphics::PixelFormat format = _system->getOverlayFormat();
+	if (_frameStatsSurface.w != width || _frameStatsSurface.h != height || _frameStatsSurface.format != format) {
+		_frameStatsSurface.free();
+		_frameStatsSurface.create(width, height, format);
+	}
+
+	const uint32 black = format.RGBToColor(0, 0, 0);
+	const uint32 white = format.RGBToColor(255, 255, 255);
+	const uint32 green = format.RGBToColor(0, 192, 0);
+	const uint32 red = format.RGBToColor(224, 0, 0);
+
+	_frameStatsSurface.fillRect(Common::Rect(width, height), black);
+
+	int y = 2;
+	font->drawString(&_frameStatsSurface, Common::String::format("frame %u ms", frameTime), 2, y, width - 4, white);
+	y += lineHeight;
+	for (uint i = 0; i < _lastFrameTimings.size(); i++) {
+		font->drawString(&_frameStatsSurface, Common::String::format("%s %u ms", _lastFrameTimings[i].label.c_str(), _lastFrameTimings[i].millis), 2, y, width - 4, white);
+		y += lineHeight;
+	}
+
+	// Rolling histogram of the frame times, oldest first. One pixel is
+	// one millisecond, and the frames over the 60 Hz budget are in red.
+	const int bottom = y + graphHeight;
+	for (uint i = 0; i < kFrameStatsHistory; i++) {
+		const uint32 time = _frameHistory[(_frameHistoryPos + i) % kFrameStatsHistory];
+		const int barHeight = MIN<uint32>(time, graphHeight);
+		if (barHeight > 0)
+			_frameStatsSurface.fillRect(Common::Rect(2 + i * 2, bottom - barHeight, 4 + i * 2, bottom), time > 1000 / 60 ? red : green);
+	}
+
+	const int x = MAX<int>(0, _system->getOverlayWidth() - width);
+	_system->copyRectToOverlay(_frameStatsSurface.getPixels(), _frameStatsSurface.pitch, x, 0,
+		MIN<int>(width, _system->getOverlayWidth()), MIN<int>(height, _system->getOverlayHeight()));
+
+	// Have the theme restore what is below the overlay once it goes away
+	_theme->addDirtyRect(Common::Rect(x, 0, x + width, height));
+}
+
+FrameTimingScope::FrameTimingScope(const char *label) : _label(label) {
+	_start = g_system->getMillis(true);
+}
+
+FrameTimingScope::~FrameTimingScope() {
+	if (GuiManager::hasInstance())
+		g_gui.addFrameTiming(_label, g_system->getMillis(true) - _start);
+}
+
 } // End of namespace GUI
@@ -28,6 +28,9 @@
 #include "common/str.h"
 #include "common/list.h"
 #include "common/mutex.h"
+#include "common/array.h"
+
+#include "graphics/surface.h"
 
 #include "gui/ThemeEngine.h"
 #include "gui/widget.h"
@@ -158,6 +161,15 @@ public:
 
 	Graphics::MacWindowManager *getWM();
 
+	/**
+	 * Add a labeled timing to the frame time overlay, which is shown when
+	 * the "gui_frame_stats" setting is enabled. Timings with the same label
+	 * are summed up over the frame.
+	 *
+	 * @see FrameTimingScope
+	 */
+	void addFrameTiming(const Common::String &label, uint32 millis);
+
 protected:
 	enum RedrawStatus {
 		kRedrawDisabled = 0,
@@ -222,6 +234,24 @@ protected:
 	};
 	Common::List<GuiObjectTrashItem> _guiObjectTrash;
 
+	// frame time overlay
+	enum {
+		kFrameStatsHistory = 64
+	};
+
+	struct FrameTiming {
+		Common::String label;
+		uint32 millis;
+	};
+
+	bool _showFrameStats;
+	Common::Array<FrameTiming> _frameTimings, _lastFrameTimings;
+	uint32 _frameHistory[kFrameStatsHistory];
+	uint _frameHistoryPos;
+	Graphics::Surface _frameStatsSurface;
+
+	void drawFrameStats(uint32 frameTime);
+
 	void initKeymap();
 	void enableKeymap(bool enabled);
 
@@ -246,6 +276,20 @@ protected:
 	void setLastMousePos(int16 x, int16 y);
 };
 
+/**
+ * Measures the time until the end of the scope and adds it to the frame
+ * time overlay of the GUI under the given label.
+ */
+class FrameTimingScope {
+public:
+	FrameTimingScope(const char *label);
+	~FrameTimingScope();
+
+private:
+	const char *_label;
+	uint32 _start;
+};
+
 } // End of namespace GUI
 
 #endif
@@ -170,17 +170,23 @@ void MassAddDialog::handleCommand(CommandSender *sender, uint32 cmd, uint32 data
 	}
 }
 
+static Common::U32String getGameListEntry(const DetectedGame &game) {
+	return game.isSelected ? Common::String("[x] ") + game.description : Common::String("[\u2000] ") + game.description;
+}
+
 void MassAddDialog::updateGameList() {
-	// Update list to correctly display selected / unselected games
+	// Update list to correctly display selected / unselected games. The
+	// entries are set at once, appending them refilters the list each time.
 	Common::U32StringArray l;
-	_list->setList(l);
+	l.reserve(_games.size());
 	_list->clearSelectedList();
 
 	for (const auto &game : _games) {
-		Common::U32String displayString = game.isSelected ? Common::String("[x] ") + game.description : Common::String("[\u2000] ") + game.description;
-		_list->append(displayString);
+		l.push_back(getGameListEntry(game));
 		_list->appendToSelectedList(game.isSelected);
 	}
+
+	_list->setList(l);
 }
 
 void MassAddDialog::handleTickle() {
@@ -194,7 +200,9 @@ void MassAddDialog::handleTickle() {
 		Common::FSNode dir = _scanStack.pop();
 
 		Common::FSList files;
-		if (!dir.getChildren(files, Common::FSNode::kListAll)) {
+		if (!dir.getChildren(files, Common::FSNode::kListAll) || files.empty()) {
+			// There is nothing to detect in an empty directory, nor to recurse into
+			_dirsScanned++;
 			continue;
 		}
 
@@ -244,17 +252,15 @@ void MassAddDialog::handleTickle() {
 					continue;	// Skip duplicates
 				}
 			}
+			// Only the new games are added to the list, so that the choices
+			// made while the scan goes on are kept
 			_games.push_back(result);
+			_games.back().isSelected = true;
 
-			_list->append(result.description);
+			_list->append(getGameListEntry(_games.back()));
+			_list->appendToSelectedList(true);
 		}
 
-		for (DetectedGame &game : _games) {
-			game.isSelected = true;
-		}
-
-		updateGameList();
-
 		// Recurse into all subdirs
 		for (const auto &file : files) {
 			if (file.isDirectory()) {
@@ -20,6 +20,7 @@
  */
 
 #include "common/system.h"
+#include "common/algorithm.h"
 #include "common/file.h"
 #include "common/language.h"
 #include "common/platform.h"
@@ -428,6 +429,7 @@ GridWidget::GridWidget(GuiObject *boss, const Common::String &name)
 	_scrollSpeed = 1;
 	_firstVisibleItem = 0;
 	_lastVisibleItem = 0;
+	_surfaceUseCounter = 0;
 	_rows = 0;
 	_itemsPerRow = 0;
 
@@ -700,17 +702,20 @@ void GridWidget::setGroupHeaderFormat(const Common::U32String &prefix, const Com
 void GridWidget::reloadThumbnails() {
 	const int thumbnailWidth = MAX(_thumbnailWidth - 2 * _thumbnailMargin, 0);
 	const int thumbnailHeight = MAX(_thumbnailHeight - 2 * _thumbnailMargin, 0);
+	++_surfaceUseCounter;
 	for (Common::Array<GridItemInfo *>::iterator iter = _visibleEntryList.begin(); iter != _visibleEntryList.end(); ++iter) {
 		GridItemInfo *entry = *iter;
 		if (entry->thumbPath.empty())
 			continue;
 
+		_surfaceUses[entry->thumbPath] = _surfaceUseCounter;
 		if (!_loadedSurfaces.contains(entry->thumbPath)) {
 			_loadedSurfaces[entry->thumbPath] = nullptr;
 			Common::String path = Common::String::format("icons/%s-%s.png", entry->engineid.c_str(), entry->gameid.c_str());
 			Graphics::ManagedSurface *surf = loadSurfaceFromFile(path);
 			if (!surf) {
 				path = Common::String::format("icons/%s.png", entry->engineid.c_str());
+				_surfaceUses[path] = _surfaceUseCounter;
 				if (!_loadedSurfaces.contains(path)) {
 					surf = loadSurfaceFromFile(path);
 				} else {
@@ -740,6 +745,36 @@ void GridWidget::reloadThumbnails() {
 			}
 		}
 	}
+
+	unloadUnusedThumbnails();
+}
+
+void GridWidget::unloadUnusedThumbnails() {
+	// The grid items keep their own copy of the thumbnail, so any image
+	// which is not visible right now can go.
+	const uint maxSurfaces = MAX<uint>(kMaxLoadedThumbnails, 4 * _visibleEntryList.size());
+	if (_loadedSurfaces.size() <= maxSurfaces)
+		return;
+
+	// Find the pass below which the oldest images are to be dropped
+	Common::Array<uint32> uses;
+	uses.reserve(_loadedSurfaces.size());
+	for (Common::HashMap<Common::String, const Graphics::ManagedSurface *>::const_iterator i = _loadedSurfaces.begin(); i != _loadedSurfaces.end(); ++i)
+		uses.push_back(_surfaceUses.getValOrDefault(i->_key, 0));
+	Common::sort(uses.begin(), uses.end());
+	const uint32 oldestKept = MIN(uses[uses.size() - maxSurfaces], _surfaceUseCounter);
+
+	Common::StringArray unused;
+	for (Common::HashMap<Common::String, const Graphics::ManagedSurface *>::const_iterator i = _loadedSurfaces.begin(); i != _loadedSurfaces.end(); ++i) {
+		if (_surfaceUses.getValOrDefault(i->_key, 0) < oldestKept)
+			unused.push_back(i->_key);
+	}
+
+	for (Common::StringArray::const_iterator i = unused.begin(); i != unused.end(); ++i) {
+		delete _loadedSurfaces[*i];
+		_loadedSurfaces.erase(*i);
+		_surfaceUses.erase(*i);
+	}
 }
 
 void GridWidget::loadFlagIcons() {
@@ -1074,6 +1109,7 @@ void GridWidget::reflowLayout() {
 		unloadSurfaces(_platformIcons);
 		unloadSurfaces(_languageIcons);
 		unloadSurfaces(_loadedSurfaces);
+		_surfaceUses.clear();
 		_platformIconsAlpha.clear();
 		_languageIconsAlpha.clear();
 		_extraIconsAlpha.clear();
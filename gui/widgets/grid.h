@@ -108,6 +108,12 @@ protected:
 	Graphics::ManagedSurface *_disabledIconOverlay;
 	// Images are mapped by filename -> surface.
 	Common::HashMap<Common::String, const Graphics::ManagedSurface *> _loadedSurfaces;
+	// The reloadThumbnails() pass each image was last needed in, so that
+	// only the recently visible ones are kept when scrolling through a
+	// large library.
+	Common::HashMap<Common::String, uint32> _surfaceUses;
+	uint32 _surfaceUseCounter;
+	static const uint kMaxLoadedThumbnails = 256;
 
 	Common::Array<GridItemInfo>			_dataEntryList;
 	Common::Array<GridItemInfo>			_headerEntryList;
@@ -198,6 +204,7 @@ public:
 	void saveClosedGroups(const Common::U32String &groupName);
 
 	void reloadThumbnails();
+	void unloadUnusedThumbnails();
 	void loadFlagIcons();
 	void loadPlatformIcons();
 	void loadExtraIcons();
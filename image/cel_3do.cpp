@@ -108,9 +108,7 @@ bool Cel3DODecoder::loadStream(Common::SeekableReadStream &stream) {
 
 	if(!(flags & kCCBPacked)) {
 		// RAW
-		// TODO: this can be optimized, especially on BE systems, but do we care?
-		for (uint xy = 0; xy < width * height; xy++)
-			*dst++ = stream.readUint16BE();
+		stream.readUint16BEArray(dst, width * height);
 	} else {
 		// RLE
 		for (uint y = 0; y < height; y++) {
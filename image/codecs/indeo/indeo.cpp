@@ -474,6 +474,8 @@ IndeoDecoderBase::IndeoDecoderBase(uint16 width, uint16 height, uint bitsPerPixe
 		_pixelFormat = Graphics::PixelFormat(4, 8, 8, 8, 8, 8, 16, 24, 0);
 
 	_ctx._bRefBuf = 3; // buffer 2 is used for scalability mode
+
+	IndeoDSP::selectKernels();
 }
 
 IndeoDecoderBase::~IndeoDecoderBase() {
@@ -0,0 +1,207 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Image {
+namespace Indeo {
+
+/** INV_HAAR8 of indeo_dsp.cpp on four columns or rows, see indeo_dsp-sse2.cpp. */
+struct HaarNEON {
+	static FORCEINLINE void bfly(int32x4_t &o1, int32x4_t &o2, int32x4_t s1, int32x4_t s2) {
+		o2 = vshrq_n_s32(vsubq_s32(s1, s2), 1);
+		o1 = vshrq_n_s32(vaddq_s32(s1, s2), 1);
+	}
+
+	static FORCEINLINE void transform(int32x4_t *d, const int32x4_t *s) {
+		int32x4_t t1 = vshlq_n_s32(s[0], 1), t5 = vshlq_n_s32(s[1], 1);
+		int32x4_t t2, t3, t4, t6, t7, t8;
+		bfly(t1, t5, t1, t5);
+		bfly(t1, t3, t1, s[2]);
+		bfly(t5, t7, t5, s[3]);
+		bfly(t1, t2, t1, s[4]);
+		bfly(t3, t4, t3, s[5]);
+		bfly(t5, t6, t5, s[6]);
+		bfly(t7, t8, t7, s[7]);
+		d[0] = t1;
+		d[1] = t2;
+		d[2] = t3;
+		d[3] = t4;
+		d[4] = t5;
+		d[5] = t6;
+		d[6] = t7;
+		d[7] = t8;
+	}
+
+	static FORCEINLINE void column(int32x4_t *d, int32x4_t *s, int half) {
+		if (half == 0) {
+			for (int i = 0; i < 4; i++)
+				s[i] = vshlq_n_s32(s[i], 1);
+		}
+		transform(d, s);
+	}
+
+	static FORCEINLINE void row(int32x4_t *d, const int32x4_t *s) {
+		transform(d, s);
+	}
+};
+
+/** IVI_INV_SLANT8 of indeo_dsp.cpp on four columns or rows at once. */
+struct SlantNEON {
+	static FORCEINLINE void bfly(int32x4_t &o1, int32x4_t &o2, int32x4_t s1, int32x4_t s2) {
+		o2 = vsubq_s32(s1, s2);
+		o1 = vaddq_s32(s1, s2);
+	}
+
+	static FORCEINLINE void ireflect(int32x4_t &o1, int32x4_t &o2, int32x4_t s1, int32x4_t s2) {
+		const int32x4_t two = vdupq_n_s32(2);
+		o1 = vaddq_s32(vshrq_n_s32(vaddq_s32(vaddq_s32(s1, vshlq_n_s32(s2, 1)), two), 2), s1);
+		o2 = vsubq_s32(vshrq_n_s32(vaddq_s32(vsubq_s32(vshlq_n_s32(s1, 1), s2), two), 2), s2);
+	}
+
+	template <bool kRow>
+	static FORCEINLINE void transform(int32x4_t *d, const int32x4_t *s) {
+		const int32x4_t s1 = s[0], s4 = s[1], s8 = s[2], s5 = s[3];
+		const int32x4_t s2 = s[4], s6 = s[5], s3 = s[6], s7 = s[7];
+		const int32x4_t four = vdupq_n_s32(4);
+		int32x4_t t1, t2, t3, t4, t5, t6, t7, t8;
+
+		// IVI_SLANT_PART4
+		t4 = vaddq_s32(s5, vshrq_n_s32(vaddq_s32(vsubq_s32(vshlq_n_s32(s4, 2), s5), four), 3));
+		t5 = vaddq_s32(s4, vshrq_n_s32(vaddq_s32(vnegq_s32(vaddq_s32(s4, vshlq_n_s32(s5, 2))), four), 3));
+
+		bfly(t1, t5, s1, t5);
+		bfly(t2, t6, s2, s6);
+		bfly(t7, t3, s7, s3);
+		bfly(t4, t8, t4, s8);
+
+		bfly(t1, t2, t1, t2);
+		ireflect(t4, t3, t4, t3);
+		bfly(t5, t6, t5, t6);
+		ireflect(t8, t7, t8, t7);
+		bfly(t1, t4, t1, t4);
+		bfly(t2, t3, t2, t3);
+		bfly(t5, t8, t5, t8);
+		bfly(t6, t7, t6, t7);
+
+		d[0] = t1;
+		d[1] = t2;
+		d[2] = t3;
+		d[3] = t4;
+		d[4] = t5;
+		d[5] = t6;
+		d[6] = t7;
+		d[7] = t8;
+
+		if (kRow) {
+			// COMPENSATE(x) is ((x) + 1) >> 1
+			for (int i = 0; i < 8; i++)
+				d[i] = vshrq_n_s32(vaddq_s32(d[i], vdupq_n_s32(1)), 1);
+		}
+	}
+
+	static FORCEINLINE void column(int32x4_t *d, int32x4_t *s, int) {
+		transform<false>(d, s);
+	}
+
+	static FORCEINLINE void row(int32x4_t *d, const int32x4_t *s) {
+		transform<true>(d, s);
+	}
+};
+
+static FORCEINLINE void neon_transpose4x4(int32x4_t *d, int32x4_t s0, int32x4_t s1, int32x4_t s2, int32x4_t s3) {
+	const int32x4x2_t t01 = vtrnq_s32(s0, s1);
+	const int32x4x2_t t23 = vtrnq_s32(s2, s3);
+	d[0] = vcombine_s32(vget_low_s32(t01.val[0]), vget_low_s32(t23.val[0]));
+	d[1] = vcombine_s32(vget_low_s32(t01.val[1]), vget_low_s32(t23.val[1]));
+	d[2] = vcombine_s32(vget_high_s32(t01.val[0]), vget_high_s32(t23.val[0]));
+	d[3] = vcombine_s32(vget_high_s32(t01.val[1]), vget_high_s32(t23.val[1]));
+}
+
+/** The separable 8x8 inverse transform, see indeo_dsp-sse2.cpp. */
+template <class Transform>
+static FORCEINLINE void neon_inverse8x8(const int32 *in, int16 *out, uint32 pitch, const uint8 *flags) {
+	int32x4_t s[8], d[8], cols[16];
+	for (int h = 0; h < 2; h++) {
+		for (int i = 0; i < 8; i++)
+			s[i] = vld1q_s32((const int32_t *)in + 8 * i + 4 * h);
+		Transform::column(d, s, h);
+
+		const uint32_t maskValues[4] = {
+			flags[4 * h] ? 0xFFFFFFFF : 0, flags[4 * h + 1] ? 0xFFFFFFFF : 0,
+			flags[4 * h + 2] ? 0xFFFFFFFF : 0, flags[4 * h + 3] ? 0xFFFFFFFF : 0
+		};
+		const int32x4_t mask = vreinterpretq_s32_u32(vld1q_u32(maskValues));
+		for (int i = 0; i < 8; i++)
+			cols[2 * i + h] = vandq_s32(d[i], mask);
+	}
+
+	for (int g = 0; g < 2; g++) {
+		for (int h = 0; h < 2; h++)
+			neon_transpose4x4(s + 4 * h, cols[8 * g + h], cols[8 * g + 2 + h], cols[8 * g + 4 + h], cols[8 * g + 6 + h]);
+		Transform::row(d, s);
+
+		int32x4_t lo[4], hi[4];
+		neon_transpose4x4(lo, d[0], d[1], d[2], d[3]);
+		neon_transpose4x4(hi, d[4], d[5], d[6], d[7]);
+		// vmovn truncates like storing to the int16 output
+		for (int i = 0; i < 4; i++)
+			vst1q_s16((int16_t *)out + (4 * g + i) * pitch, vcombine_s16(vmovn_s32(lo[i]), vmovn_s32(hi[i])));
+	}
+}
+
+void inverseHaar8x8NEON(const int32 *in, int16 *out, uint32 pitch, const uint8 *flags) {
+	neon_inverse8x8<HaarNEON>(in, out, pitch, flags);
+}
+
+void inverseSlant8x8NEON(const int32 *in, int16 *out, uint32 pitch, const uint8 *flags) {
+	neon_inverse8x8<SlantNEON>(in, out, pitch, flags);
+}
+
+} // End of namespace Indeo
+} // End of namespace Image
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,214 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Image {
+namespace Indeo {
+
+/**
+ * INV_HAAR8 of indeo_dsp.cpp on four columns or rows at once. The inputs
+ * are in the order of the coefficients, the pre-scaling of the first half
+ * of the columns is done by the caller.
+ */
+struct HaarSSE2 {
+	static FORCEINLINE void bfly(__m128i &o1, __m128i &o2, __m128i s1, __m128i s2) {
+		o2 = _mm_srai_epi32(_mm_sub_epi32(s1, s2), 1);
+		o1 = _mm_srai_epi32(_mm_add_epi32(s1, s2), 1);
+	}
+
+	static FORCEINLINE void transform(__m128i *d, const __m128i *s) {
+		__m128i t1 = _mm_slli_epi32(s[0], 1), t5 = _mm_slli_epi32(s[1], 1);
+		__m128i t2, t3, t4, t6, t7, t8;
+		bfly(t1, t5, t1, t5);
+		bfly(t1, t3, t1, s[2]);
+		bfly(t5, t7, t5, s[3]);
+		bfly(t1, t2, t1, s[4]);
+		bfly(t3, t4, t3, s[5]);
+		bfly(t5, t6, t5, s[6]);
+		bfly(t7, t8, t7, s[7]);
+		d[0] = t1;
+		d[1] = t2;
+		d[2] = t3;
+		d[3] = t4;
+		d[4] = t5;
+		d[5] = t6;
+		d[6] = t7;
+		d[7] = t8;
+	}
+
+	static FORCEINLINE void column(__m128i *d, __m128i *s, int half) {
+		if (half == 0) {
+			for (int i = 0; i < 4; i++)
+				s[i] = _mm_slli_epi32(s[i], 1);
+		}
+		transform(d, s);
+	}
+
+	static FORCEINLINE void row(__m128i *d, const __m128i *s) {
+		transform(d, s);
+	}
+};
+
+/** IVI_INV_SLANT8 of indeo_dsp.cpp on four columns or rows at once. */
+struct SlantSSE2 {
+	static FORCEINLINE void bfly(__m128i &o1, __m128i &o2, __m128i s1, __m128i s2) {
+		o2 = _mm_sub_epi32(s1, s2);
+		o1 = _mm_add_epi32(s1, s2);
+	}
+
+	static FORCEINLINE void ireflect(__m128i &o1, __m128i &o2, __m128i s1, __m128i s2) {
+		const __m128i two = _mm_set1_epi32(2);
+		o1 = _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(_mm_add_epi32(s1, _mm_slli_epi32(s2, 1)), two), 2), s1);
+		o2 = _mm_sub_epi32(_mm_srai_epi32(_mm_add_epi32(_mm_sub_epi32(_mm_slli_epi32(s1, 1), s2), two), 2), s2);
+	}
+
+	template <bool kRow>
+	static FORCEINLINE void transform(__m128i *d, const __m128i *s) {
+		const __m128i s1 = s[0], s4 = s[1], s8 = s[2], s5 = s[3];
+		const __m128i s2 = s[4], s6 = s[5], s3 = s[6], s7 = s[7];
+		const __m128i four = _mm_set1_epi32(4);
+		__m128i t1, t2, t3, t4, t5, t6, t7, t8;
+
+		// IVI_SLANT_PART4
+		t4 = _mm_add_epi32(s5, _mm_srai_epi32(_mm_add_epi32(_mm_sub_epi32(_mm_slli_epi32(s4, 2), s5), four), 3));
+		t5 = _mm_add_epi32(s4, _mm_srai_epi32(_mm_add_epi32(_mm_sub_epi32(_mm_setzero_si128(), _mm_add_epi32(s4, _mm_slli_epi32(s5, 2))), four), 3));
+
+		bfly(t1, t5, s1, t5);
+		bfly(t2, t6, s2, s6);
+		bfly(t7, t3, s7, s3);
+		bfly(t4, t8, t4, s8);
+
+		bfly(t1, t2, t1, t2);
+		ireflect(t4, t3, t4, t3);
+		bfly(t5, t6, t5, t6);
+		ireflect(t8, t7, t8, t7);
+		bfly(t1, t4, t1, t4);
+		bfly(t2, t3, t2, t3);
+		bfly(t5, t8, t5, t8);
+		bfly(t6, t7, t6, t7);
+
+		d[0] = t1;
+		d[1] = t2;
+		d[2] = t3;
+		d[3] = t4;
+		d[4] = t5;
+		d[5] = t6;
+		d[6] = t7;
+		d[7] = t8;
+
+		if (kRow) {
+			const __m128i one = _mm_set1_epi32(1);
+			for (int i = 0; i < 8; i++)
+				d[i] = _mm_srai_epi32(_mm_add_epi32(d[i], one), 1);
+		}
+	}
+
+	static FORCEINLINE void column(__m128i *d, __m128i *s, int) {
+		transform<false>(d, s);
+	}
+
+	static FORCEINLINE void row(__m128i *d, const __m128i *s) {
+		transform<true>(d, s);
+	}
+};
+
+static FORCEINLINE void sse2_transpose4x4(__m128i *d, const __m128i &s0, const __m128i &s1, const __m128i &s2, const __m128i &s3) {
+	const __m128i t0 = _mm_unpacklo_epi32(s0, s1);
+	const __m128i t1 = _mm_unpacklo_epi32(s2, s3);
+	const __m128i t2 = _mm_unpackhi_epi32(s0, s1);
+	const __m128i t3 = _mm_unpackhi_epi32(s2, s3);
+	d[0] = _mm_unpacklo_epi64(t0, t1);
+	d[1] = _mm_unpackhi_epi64(t0, t1);
+	d[2] = _mm_unpacklo_epi64(t2, t3);
+	d[3] = _mm_unpackhi_epi64(t2, t3);
+}
+
+/** The low 16 bits of 32-bit lanes, like storing to the int16 output. */
+static FORCEINLINE __m128i sse2_low16(const __m128i &lo, const __m128i &hi) {
+	return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16), _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16));
+}
+
+/**
+ * A separable 8x8 inverse transform: the columns first, with the ones
+ * without a flag set to zero, then the rows. Skipping the rows that are
+ * all zero like the generic code does makes no difference to the result.
+ */
+template <class Transform>
+static FORCEINLINE void sse2_inverse8x8(const int32 *in, int16 *out, uint32 pitch, const uint8 *flags) {
+	__m128i s[8], d[8], cols[16];
+	for (int h = 0; h < 2; h++) {
+		for (int i = 0; i < 8; i++)
+			s[i] = _mm_loadu_si128((const __m128i *)(in + 8 * i + 4 * h));
+		Transform::column(d, s, h);
+
+		const __m128i mask = _mm_setr_epi32(flags[4 * h] ? -1 : 0, flags[4 * h + 1] ? -1 : 0,
+		                                    flags[4 * h + 2] ? -1 : 0, flags[4 * h + 3] ? -1 : 0);
+		for (int i = 0; i < 8; i++)
+			cols[2 * i + h] = _mm_and_si128(d[i], mask);
+	}
+
+	for (int g = 0; g < 2; g++) {
+		for (int h = 0; h < 2; h++)
+			sse2_transpose4x4(s + 4 * h, cols[8 * g + h], cols[8 * g + 2 + h], cols[8 * g + 4 + h], cols[8 * g + 6 + h]);
+		Transform::row(d, s);
+
+		__m128i lo[4], hi[4];
+		sse2_transpose4x4(lo, d[0], d[1], d[2], d[3]);
+		sse2_transpose4x4(hi, d[4], d[5], d[6], d[7]);
+		for (int i = 0; i < 4; i++)
+			_mm_storeu_si128((__m128i *)(out + (4 * g + i) * pitch), sse2_low16(lo[i], hi[i]));
+	}
+}
+
+void inverseHaar8x8SSE2(const int32 *in, int16 *out, uint32 pitch, const uint8 *flags) {
+	sse2_inverse8x8<HaarSSE2>(in, out, pitch, flags);
+}
+
+void inverseSlant8x8SSE2(const int32 *in, int16 *out, uint32 pitch, const uint8 *flags) {
+	sse2_inverse8x8<SlantSSE2>(in, out, pitch, flags);
+}
+
+} // End of namespace Indeo
+} // End of namespace Image
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
@@ -26,10 +26,63 @@
  */
 
 #include "image/codecs/indeo/indeo_dsp.h"
+#include "common/system.h"
 
 namespace Image {
 namespace Indeo {
 
+#ifdef SCUMMVM_SSE2
+// Defined in indeo_dsp-sse2.cpp
+void inverseHaar8x8SSE2(const int32 *in, int16 *out, uint32 pitch, const uint8 *flags);
+void inverseSlant8x8SSE2(const int32 *in, int16 *out, uint32 pitch, const uint8 *flags);
+#endif
+
+#ifdef SCUMMVM_NEON
+// Defined in indeo_dsp-neon.cpp
+void inverseHaar8x8NEON(const int32 *in, int16 *out, uint32 pitch, const uint8 *flags);
+void inverseSlant8x8NEON(const int32 *in, int16 *out, uint32 pitch, const uint8 *flags);
+#endif
+
+namespace {
+
+// The SIMD versions of the 8x8 transforms, or null for the generic code.
+// They are called from the IndeoDSP functions since the decoders compare
+// the transform pointers against those.
+InvTransformPtr *inverseHaar8x8Kernel = nullptr;
+InvTransformPtr *inverseSlant8x8Kernel = nullptr;
+bool indeoKernelsSelected = false;
+
+} // End of anonymous namespace
+
+void IndeoDSP::selectKernels() {
+	if (indeoKernelsSelected)
+		return;
+
+#if defined(SCUMMVM_SSE2)
+#if defined(__x86_64__) || defined(_M_X64)
+	const bool useSSE2 = true;
+#else
+	const bool useSSE2 = g_system->hasFeature(OSystem::kFeatureCpuSSE2);
+#endif
+	if (useSSE2) {
+		inverseHaar8x8Kernel = inverseHaar8x8SSE2;
+		inverseSlant8x8Kernel = inverseSlant8x8SSE2;
+	}
+#elif defined(SCUMMVM_NEON)
+#if defined(__aarch64__)
+	const bool useNEON = true;
+#else
+	const bool useNEON = g_system->hasFeature(OSystem::kFeatureCpuNEON);
+#endif
+	if (useNEON) {
+		inverseHaar8x8Kernel = inverseHaar8x8NEON;
+		inverseSlant8x8Kernel = inverseSlant8x8NEON;
+	}
+#endif
+
+	indeoKernelsSelected = true;
+}
+
 /**
  * butterfly operation for the inverse Haar transform
  */
@@ -72,6 +125,11 @@ namespace Indeo {
 
 void IndeoDSP::ffIviInverseHaar8x8(const int32 *in, int16 *out, uint32 pitch,
 							 const uint8 *flags) {
+	if (inverseHaar8x8Kernel) {
+		inverseHaar8x8Kernel(in, out, pitch, flags);
+		return;
+	}
+
 	int32 tmp[64];
 	int t0, t1, t2, t3, t4, t5, t6, t7, t8;
 
@@ -321,6 +379,11 @@ void IndeoDSP::ffIviDcHaar2d(const int32 *in, int16 *out, uint32 pitch,
 	d4 = COMPENSATE(t4);}
 
 void IndeoDSP::ffIviInverseSlant8x8(const int32 *in, int16 *out, uint32 pitch, const uint8 *flags) {
+	if (inverseSlant8x8Kernel) {
+		inverseSlant8x8Kernel(in, out, pitch, flags);
+		return;
+	}
+
 	int32 tmp[64];
 	int t0, t1, t2, t3, t4, t5, t6, t7, t8;
 
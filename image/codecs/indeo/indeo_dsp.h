@@ -37,6 +37,12 @@ namespace Indeo {
 
 class IndeoDSP {
 public:
+	/**
+	 * Pick the SIMD versions of the 8x8 inverse transforms the CPU has,
+	 * called once by the decoders before the first frame.
+	 */
+	static void selectKernels();
+
 	/**
 	 *  two-dimensional inverse Haar 8x8 transform for Indeo 4
 	 *
@@ -45,15 +45,13 @@ MJPEGDecoder::MJPEGDecoder() : Codec() {
 	if (_pixelFormat.bytesPerPixel == 1)
 		_pixelFormat = Graphics::PixelFormat(4, 8, 8, 8, 8, 8, 16, 24, 0);
 
-	_surface = 0;
 	_accuracy = CodecAccuracy::Default;
+	_data = nullptr;
+	_dataSize = 0;
 }
 
 MJPEGDecoder::~MJPEGDecoder() {
-	if (_surface) {
-		_surface->free();
-		delete _surface;
-	}
+	free(_data);
 }
 
 // Header to be inserted
@@ -168,13 +166,20 @@ const Graphics::Surface *MJPEGDecoder::decodeFrame(Common::SeekableReadStream &s
 	}
 
 	uint32 outputSize = stream.size() - inputSkip + sizeof(s_jpegHeader) + DHT_SEGMENT_SIZE;
-	byte *data = (byte *)malloc(outputSize);
+	if (outputSize > _dataSize) {
+		byte *data = (byte *)realloc(_data, outputSize);
 
-	if (!data) {
-		warning("Failed to allocate data for MJPEG conversion");
-		return 0;
+		if (!data) {
+			warning("Failed to allocate data for MJPEG conversion");
+			return 0;
+		}
+
+		_data = data;
+		_dataSize = outputSize;
 	}
 
+	byte *data = _data;
+
 	// Copy the header
 	memcpy(data, s_jpegHeader, sizeof(s_jpegHeader));
 	uint32 dataOffset = sizeof(s_jpegHeader);
@@ -203,27 +208,20 @@ const Graphics::Surface *MJPEGDecoder::decodeFrame(Common::SeekableReadStream &s
 	stream.seek(inputSkip);
 	stream.read(data + dataOffset, stream.size() - inputSkip);
 
-	Common::MemoryReadStream convertedStream(data, outputSize, DisposeAfterUse::YES);
-	JPEGDecoder jpeg;
-	jpeg.setCodecAccuracy(_accuracy);
-	jpeg.setOutputPixelFormat(_pixelFormat);
+	Common::MemoryReadStream convertedStream(data, outputSize);
+	_jpeg.setCodecAccuracy(_accuracy);
+	_jpeg.setOutputPixelFormat(_pixelFormat);
 
-	if (!jpeg.loadStream(convertedStream)) {
+	if (!_jpeg.loadStream(convertedStream)) {
 		warning("Failed to decode MJPEG frame");
 		return 0;
 	}
 
-	if (_surface) {
-		_surface->free();
-		delete _surface;
-	}
-
-	_surface = new Graphics::Surface();
-	_surface->copyFrom(*jpeg.getSurface());
-
-	assert(_surface->format == _pixelFormat);
+	// The surface is only valid until the next frame is decoded
+	const Graphics::Surface *surface = _jpeg.getSurface();
+	assert(surface->format == _pixelFormat);
 
-	return _surface;
+	return surface;
 }
 
 void MJPEGDecoder::setCodecAccuracy(CodecAccuracy accuracy) {
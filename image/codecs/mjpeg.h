@@ -23,6 +23,7 @@
 #define IMAGE_CODECS_MJPEG_H
 
 #include "image/codecs/codec.h"
+#include "image/jpeg.h"
 #include "graphics/pixelformat.h"
 
 namespace Common {
@@ -57,8 +58,14 @@ public:
 
 private:
 	Graphics::PixelFormat _pixelFormat;
-	Graphics::Surface *_surface;
 	CodecAccuracy _accuracy;
+
+	/** Decodes the frames, and keeps the last one */
+	JPEGDecoder _jpeg;
+
+	/** The frame turned into a JPEG file, kept between frames */
+	byte *_data;
+	uint32 _dataSize;
 };
 
 } // End of namespace Image
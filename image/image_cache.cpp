@@ -0,0 +1,210 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "image/image_cache.h"
+#include "image/image_decoder.h"
+
+#include "common/config-manager.h"
+#include "common/debug.h"
+#include "common/md5.h"
+#include "common/memstream.h"
+#include "common/savefile.h"
+#include "common/stream.h"
+#include "common/system.h"
+#include "common/textconsole.h"
+
+#include "graphics/surface.h"
+
+namespace Image {
+
+static const uint32 kCacheTag = MKTAG('D', 'I', 'C', '1');
+
+enum {
+	kCacheFlagLittleEndian = 1 << 0
+};
+
+#ifdef SCUMM_LITTLE_ENDIAN
+static const byte kNativeFlags = kCacheFlagLittleEndian;
+#else
+static const byte kNativeFlags = 0;
+#endif
+
+DecodedImageCache::DecodedImageCache(uint32 memoryBudget) :
+	_memoryBudget(memoryBudget),
+	_memoryUsage(0) {
+}
+
+DecodedImageCache::~DecodedImageCache() {
+	clear();
+}
+
+bool DecodedImageCache::isDiskCacheEnabled() {
+	return ConfMan.hasKey("image_cache") && ConfMan.getBool("image_cache");
+}
+
+Common::String DecodedImageCache::makeKey(const Common::String &key, uint32 sourceSize, const Graphics::PixelFormat &format) const {
+	return Common::String::format("%s|%u|%s", key.c_str(), sourceSize, format.toString().c_str());
+}
+
+DecodedImageCache::SurfacePtr DecodedImageCache::load(const Common::String &key, Common::SeekableReadStream &stream,
+                                                      ImageDecoder &decoder, const Graphics::PixelFormat &format) {
+	assert(!format.isCLUT8());
+	const Common::String fullKey = makeKey(key, stream.size(), format);
+
+	if (_index.contains(fullKey)) {
+		// Move the image to the front
+		EntryList::iterator it = _index[fullKey];
+		const Entry entry = *it;
+		_entries.erase(it);
+		_entries.push_front(entry);
+		_index[fullKey] = _entries.begin();
+		return entry.surface;
+	}
+
+	const bool useDisk = isDiskCacheEnabled();
+	Common::String fileName;
+	if (useDisk) {
+		Common::MemoryReadStream keyStream((const byte *)fullKey.c_str(), fullKey.size());
+		fileName = "imagecache-" + Common::computeStreamMD5AsString(keyStream);
+
+		SurfacePtr surface = loadFromDisk(fileName, format);
+		if (surface) {
+			add(fullKey, surface);
+			return surface;
+		}
+	}
+
+	if (!decoder.loadStream(stream) || !decoder.getSurface() || !decoder.getSurface()->getPixels())
+		return SurfacePtr();
+
+	const Graphics::Surface *decoded = decoder.getSurface();
+	Graphics::Surface *converted;
+	if (decoded->format == format) {
+		converted = new Graphics::Surface();
+		converted->copyFrom(*decoded);
+	} else {
+		converted = decoded->convertTo(format, decoder.getPalette(), decoder.getPaletteColorCount());
+	}
+	decoder.destroy();
+
+	SurfacePtr surface(converted, Graphics::SurfaceDeleter());
+	if (useDisk)
+		saveToDisk(fileName, *surface);
+	add(fullKey, surface);
+	return surface;
+}
+
+DecodedImageCache::SurfacePtr DecodedImageCache::loadFromDisk(const Common::String &fileName, const Graphics::PixelFormat &format) const {
+	Common::SaveFileManager *saveMan = g_system ? g_system->getSavefileManager() : nullptr;
+	Common::SeekableReadStream *file = saveMan ? saveMan->openForLoading(fileName) : nullptr;
+	if (!file)
+		return SurfacePtr();
+
+	const uint32 tag = file->readUint32BE();
+	const byte flags = file->readByte();
+	const byte bytesPerPixel = file->readByte();
+	const uint16 width = file->readUint16LE();
+	const uint16 height = file->readUint16LE();
+
+	if (file->err() || file->eos() || tag != kCacheTag || flags != kNativeFlags ||
+	    bytesPerPixel != format.bytesPerPixel || !width || !height) {
+		debug(3, "DecodedImageCache: Ignoring unusable cache file '%s'", fileName.c_str());
+		delete file;
+		return SurfacePtr();
+	}
+
+	Graphics::Surface *surface = new Graphics::Surface();
+	surface->create(width, height, format);
+	for (uint y = 0; y < height; ++y)
+		file->read(surface->getBasePtr(0, y), width * bytesPerPixel);
+
+	const bool failed = file->err() || file->eos();
+	delete file;
+	if (failed) {
+		debug(3, "DecodedImageCache: Ignoring truncated cache file '%s'", fileName.c_str());
+		surface->free();
+		delete surface;
+		return SurfacePtr();
+	}
+
+	return SurfacePtr(surface, Graphics::SurfaceDeleter());
+}
+
+void DecodedImageCache::saveToDisk(const Common::String &fileName, const Graphics::Surface &surface) const {
+	Common::SaveFileManager *saveMan = g_system ? g_system->getSavefileManager() : nullptr;
+	Common::OutSaveFile *file = saveMan ? saveMan->openForSaving(fileName) : nullptr;
+	if (!file)
+		return;
+
+	file->writeUint32BE(kCacheTag);
+	file->writeByte(kNativeFlags);
+	file->writeByte(surface.format.bytesPerPixel);
+	file->writeUint16LE(surface.w);
+	file->writeUint16LE(surface.h);
+	for (int y = 0; y < surface.h; ++y)
+		file->write(surface.getBasePtr(0, y), surface.w * surface.format.bytesPerPixel);
+	file->finalize();
+
+	const bool failed = file->err();
+	delete file;
+	if (failed) {
+		warning("DecodedImageCache: Could not write '%s'", fileName.c_str());
+		saveMan->removeSavefile(fileName);
+	}
+}
+
+void DecodedImageCache::add(const Common::String &key, const SurfacePtr &surface) {
+	Entry entry;
+	entry.key = key;
+	entry.surface = surface;
+	entry.size = surface->pitch * surface->h;
+
+	// Images larger than the budget are only returned
+	if (entry.size > _memoryBudget)
+		return;
+
+	_entries.push_front(entry);
+	_index[key] = _entries.begin();
+	_memoryUsage += entry.size;
+	trim();
+}
+
+void DecodedImageCache::trim() {
+	while (_memoryUsage > _memoryBudget && !_entries.empty()) {
+		const Entry &entry = _entries.back();
+		_memoryUsage -= entry.size;
+		_index.erase(entry.key);
+		_entries.pop_back();
+	}
+}
+
+void DecodedImageCache::clear() {
+	_entries.clear();
+	_index.clear();
+	_memoryUsage = 0;
+}
+
+void DecodedImageCache::setMemoryBudget(uint32 budget) {
+	_memoryBudget = budget;
+	trim();
+}
+
+} // End of namespace Image
@@ -0,0 +1,128 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IMAGE_IMAGE_CACHE_H
+#define IMAGE_IMAGE_CACHE_H
+
+#include "common/hashmap.h"
+#include "common/hash-str.h"
+#include "common/list.h"
+#include "common/noncopyable.h"
+#include "common/ptr.h"
+#include "common/str.h"
+
+#include "graphics/pixelformat.h"
+
+namespace Common {
+class SeekableReadStream;
+}
+
+namespace Graphics {
+struct Surface;
+}
+
+namespace Image {
+
+class ImageDecoder;
+
+/**
+ * @defgroup image_cache Decoded image cache
+ * @ingroup image
+ *
+ * @brief Cache of decoded images, in memory and on disk.
+ * @{
+ */
+
+/**
+ * Keeps images decoded and converted to the format they are used in, for
+ * engines that load the same images again, e.g. with every scene.
+ *
+ * The images used last are kept in memory up to a budget. With the
+ * image_cache setting on, the images are also stored as raw pixels in the
+ * saves directory, compressed the way save files are, and are loaded from
+ * there by later runs instead of being decoded again.
+ *
+ * The surfaces are shared with the callers, so dropping an image from the
+ * cache does not free a surface still in use.
+ */
+class DecodedImageCache : Common::NonCopyable {
+public:
+	typedef Common::SharedPtr<Graphics::Surface> SurfacePtr;
+
+	static const uint32 kDefaultMemoryBudget = 64 * 1024 * 1024;
+
+	explicit DecodedImageCache(uint32 memoryBudget = kDefaultMemoryBudget);
+	~DecodedImageCache();
+
+	/** Whether keeping the images on disk is enabled by the user. */
+	static bool isDiskCacheEnabled();
+
+	/**
+	 * Get an image in the given format, from the cache or else by decoding
+	 * and converting it.
+	 *
+	 * @param key      Name of the image, e.g. its path. The size of the
+	 *                 stream is added to it, to catch changed files.
+	 * @param stream   The encoded image, only read when it is not cached.
+	 * @param decoder  The decoder for the image, set up by the caller.
+	 * @param format   The format the image is wanted in, not CLUT8.
+	 *
+	 * @return The image, or null if decoding failed.
+	 */
+	SurfacePtr load(const Common::String &key, Common::SeekableReadStream &stream,
+	                ImageDecoder &decoder, const Graphics::PixelFormat &format);
+
+	/** Drop all images from memory, the ones on disk are kept. */
+	void clear();
+
+	/** Set the budget, dropping images if the cache keeps more. */
+	void setMemoryBudget(uint32 budget);
+
+	/** The size of the pixels of the images kept in memory. */
+	uint32 getMemoryUsage() const { return _memoryUsage; }
+
+private:
+	struct Entry {
+		Common::String key;
+		SurfacePtr surface;
+		uint32 size;
+	};
+
+	typedef Common::List<Entry> EntryList;
+
+	Common::String makeKey(const Common::String &key, uint32 sourceSize, const Graphics::PixelFormat &format) const;
+	SurfacePtr loadFromDisk(const Common::String &fileName, const Graphics::PixelFormat &format) const;
+	void saveToDisk(const Common::String &fileName, const Graphics::Surface &surface) const;
+	void add(const Common::String &key, const SurfacePtr &surface);
+	void trim();
+
+	uint32 _memoryBudget;
+	uint32 _memoryUsage;
+
+	/** The images, used last first. */
+	EntryList _entries;
+	Common::HashMap<Common::String, EntryList::iterator> _index;
+};
+
+/** @} */
+} // End of namespace Image
+
+#endif
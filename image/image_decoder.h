@@ -43,6 +43,26 @@ namespace Image {
  * @{
  */
 
+/**
+ * Receives the rows of an image while it is being decoded.
+ *
+ * Decoders that support this hand the image over in strips of rows from
+ * the top down, so large images can be uploaded to a texture as they are
+ * decoded, without first keeping the whole image in memory.
+ */
+class ImageRowListener {
+public:
+	virtual ~ImageRowListener() {}
+
+	/**
+	 * Called with every strip of decoded rows.
+	 *
+	 * @param rows  The decoded rows, only valid during the call.
+	 * @param y     The row of the image the first row of the strip is.
+	 */
+	virtual void decodedRows(const Graphics::Surface &rows, uint y) = 0;
+};
+
 /**
  * A representation of an image decoder that maintains ownership of the surface
  * and palette it decodes to.
@@ -24,6 +24,7 @@
 #define FORBIDDEN_SYMBOL_ALLOW_ALL
 
 #include "image/jpeg.h"
+#include "image/row_output.h"
 
 #include "common/debug.h"
 #include "common/endian.h"
@@ -48,7 +49,8 @@ JPEGDecoder::JPEGDecoder() :
 		_surface(),
 		_colorSpace(kColorSpaceRGB),
 		_accuracy(CodecAccuracy::Default),
-		_requestedPixelFormat(getByteOrderRgbPixelFormat()) {
+		_requestedPixelFormat(getByteOrderRgbPixelFormat()),
+		_rowListener(nullptr) {
 }
 
 JPEGDecoder::~JPEGDecoder() {
@@ -71,6 +73,16 @@ void JPEGDecoder::destroy() {
 	_surface.free();
 }
 
+void JPEGDecoder::createSurface(uint width, uint height, const Graphics::PixelFormat &format) {
+	// Keep the pixels of the previous image when they fit, so decoding a
+	// stream of frames does not allocate for every frame
+	if (_surface.getPixels() && _surface.w == (int16)width && _surface.h == (int16)height && _surface.format == format)
+		return;
+
+	_surface.free();
+	_surface.create(width, height, format);
+}
+
 const Graphics::Surface *JPEGDecoder::decodeFrame(Common::SeekableReadStream &stream) {
 	if (!loadStream(stream))
 		return 0;
@@ -236,9 +248,6 @@ J_COLOR_SPACE fromScummvmPixelFormat(const Graphics::PixelFormat &format) {
 
 bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
 #ifdef USE_JPEG
-	// Reset member variables from previous decodings
-	destroy();
-
 	jpeg_decompress_struct cinfo;
 	jpeg_error_mgr jerr;
 
@@ -295,52 +304,59 @@ bool JPEGDecoder::loadStream(Common::SeekableReadStream &stream) {
 	jpeg_start_decompress(&cinfo);
 
 	// Allocate buffers for the output data
+	Graphics::PixelFormat decodeFormat;
+	Graphics::PixelFormat outputFormat;
 	switch (_colorSpace) {
-	case kColorSpaceRGB: {
-		Graphics::PixelFormat outputPixelFormat;
+	case kColorSpaceRGB:
 		if (cinfo.out_color_space == JCS_RGB) {
-			outputPixelFormat = getByteOrderRgbPixelFormat();
+			decodeFormat = getByteOrderRgbPixelFormat();
 		} else {
-			outputPixelFormat = _requestedPixelFormat;
+			decodeFormat = _requestedPixelFormat;
 		}
-		_surface.create(cinfo.output_width, cinfo.output_height, outputPixelFormat);
+		outputFormat = _requestedPixelFormat;
 		break;
-	}
 	case kColorSpaceYUV:
 		// We use YUV with 3 bytes per pixel otherwise.
 		// This is pretty ugly since our PixelFormat cannot express YUV...
-		_surface.create(cinfo.output_width, cinfo.output_height, Graphics::PixelFormat(3, 0, 0, 0, 0, 0, 0, 0, 0));
+		decodeFormat = outputFormat = Graphics::PixelFormat(3, 0, 0, 0, 0, 0, 0, 0, 0);
 		break;
 	default:
 		break;
 	}
+
+	if (!_rowListener)
+		createSurface(cinfo.output_width, cinfo.output_height, outputFormat);
+	else
+		destroy();
+
 	// Size of output pixel must match 4 bytes.
 	if (cinfo.out_color_space == JCS_CMYK) {
-		assert(_surface.format.bytesPerPixel == 4);
+		assert(decodeFormat.bytesPerPixel == 4);
 	}
 
-	// Allocate buffer for one scanline
-	JDIMENSION pitch = cinfo.output_width * _surface.format.bytesPerPixel;
-	assert(_surface.pitch >= (int)pitch);
-	JSAMPARRAY buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr)&cinfo, JPOOL_IMAGE, pitch, 1);
+	// Decode straight into the surface when libjpeg writes the requested
+	// format, otherwise convert a few rows at a time while they are still
+	// in the cache. The strips hold a whole number of the batches of rows
+	// libjpeg produces in one go.
+	JSAMPROW rows[4];
+	const JDIMENSION batchHeight = MIN<JDIMENSION>(cinfo.rec_outbuf_height, ARRAYSIZE(rows));
+	RowOutput output(_rowListener ? nullptr : &_surface, _rowListener, outputFormat,
+	                 cinfo.output_width, cinfo.output_height, decodeFormat, batchHeight * 8);
 
-	// Go through the image data scanline by scanline
 	while (cinfo.output_scanline < cinfo.output_height) {
-		byte *dst = (byte *)_surface.getBasePtr(0, cinfo.output_scanline);
-
-		jpeg_read_scanlines(&cinfo, buffer, 1);
+		const JDIMENSION count = MIN<JDIMENSION>(batchHeight, cinfo.output_height - cinfo.output_scanline);
+		for (JDIMENSION i = 0; i < count; i++)
+			rows[i] = output.getRow(cinfo.output_scanline + i);
 
-		memcpy(dst, buffer[0], pitch);
+		jpeg_read_scanlines(&cinfo, rows, count);
 	}
 
+	output.flush();
+
 	// We are done with decompressing, thus free all the data
 	jpeg_finish_decompress(&cinfo);
 	jpeg_destroy_decompress(&cinfo);
 
-	if (_colorSpace == kColorSpaceRGB && _surface.format != _requestedPixelFormat) {
-		_surface.convertToInPlace(_requestedPixelFormat); // Slow path
-	}
-
 	return true;
 #else
 	return false;
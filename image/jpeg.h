@@ -102,13 +102,21 @@ public:
 	 */
 	void setOutputColorSpace(ColorSpace outSpace) { _colorSpace = outSpace; }
 
+	/**
+	 * Pass the rows to the listener while decoding instead of keeping the
+	 * image, getSurface() then returns an empty surface after loadStream().
+	 */
+	void setRowListener(ImageRowListener *listener) { _rowListener = listener; }
+
 private:
 	Graphics::Surface _surface;
 	ColorSpace _colorSpace;
 	Graphics::PixelFormat _requestedPixelFormat;
 	CodecAccuracy _accuracy;
+	ImageRowListener *_rowListener;
 
 	Graphics::PixelFormat getByteOrderRgbPixelFormat() const;
+	void createSurface(uint width, uint height, const Graphics::PixelFormat &format);
 };
 /** @} */
 } // End of namespace Image
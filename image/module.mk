@@ -7,11 +7,13 @@ MODULE_OBJS := \
 	cicn.o \
 	icocur.o \
 	iff.o \
+	image_cache.o \
 	jpeg.o \
 	neo.o \
 	pcx.o \
 	pict.o \
 	png.o \
+	row_output.o \
 	scr.o \
 	tga.o \
 	xbm.o \
@@ -55,6 +57,15 @@ MODULE_OBJS += \
 	codecs/indeo/indeo_dsp.o \
 	codecs/indeo/mem.o \
 	codecs/indeo/vlc.o
+
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	codecs/indeo/indeo_dsp-neon.o
+endif
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	codecs/indeo/indeo_dsp-sse2.o
+endif
 endif
 
 ifdef USE_HNM
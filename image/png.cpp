@@ -29,6 +29,7 @@
 #endif
 
 #include "image/png.h"
+#include "image/row_output.h"
 
 #include "graphics/pixelformat.h"
 #include "graphics/surface.h"
@@ -45,7 +46,15 @@ PNGDecoder::PNGDecoder() :
 		_skipSignature(false),
 		_keepTransparencyPaletted(false),
 		_hasTransparentColor(false),
-		_transparentColor(0) {
+		_transparentColor(0),
+		_rowListener(nullptr) {
+}
+
+bool PNGDecoder::setOutputPixelFormat(const Graphics::PixelFormat &format) {
+	if (format.bytesPerPixel < 2)
+		return false;
+	_outputPixelFormat = format;
+	return true;
 }
 
 PNGDecoder::~PNGDecoder() {
@@ -71,6 +80,49 @@ Graphics::PixelFormat PNGDecoder::getByteOrderRgbaPixelFormat(bool isAlpha) cons
 }
 
 #ifdef USE_PNG
+namespace {
+
+// The number of rows converted or passed to the row listener at once
+const uint kRowStripHeight = 16;
+
+/** The position in memory of the byte at the given shift of a pixel. */
+uint getBytePosition(uint shift, uint bytesPerPixel) {
+#ifdef SCUMM_BIG_ENDIAN
+	return bytesPerPixel - 1 - shift / 8;
+#else
+	return shift / 8;
+#endif
+}
+
+/**
+ * Check whether libpng can decode to the format by reordering its RGBA
+ * bytes, which is the case for 24 and 32-bit formats with a byte for
+ * every channel.
+ */
+bool getByteOrder(const Graphics::PixelFormat &format, bool &bgr, bool &alphaFirst) {
+	const uint bpp = format.bytesPerPixel;
+	if ((bpp != 3 && bpp != 4) || format.rLoss || format.gLoss || format.bLoss)
+		return false;
+	if (format.aBits() && (bpp != 4 || format.aLoss))
+		return false;
+	if ((format.rShift | format.gShift | format.bShift | format.aShift) & 7)
+		return false;
+
+	// The alpha channel or the padding takes up the remaining byte
+	const uint r = getBytePosition(format.rShift, bpp);
+	const uint g = getBytePosition(format.gShift, bpp);
+	const uint b = getBytePosition(format.bShift, bpp);
+	const uint first = (bpp == 4 && g == 2) ? 1 : 0;
+	if (g != first + 1 || !((r == first && b == first + 2) || (r == first + 2 && b == first)))
+		return false;
+
+	bgr = (r != first);
+	alphaFirst = (first == 1);
+	return true;
+}
+
+} // End of anonymous namespace
+
 // libpng-error-handling:
 void pngError(png_structp pngptr, png_const_charp errorMsg) {
 	error("libpng: %s", errorMsg);
@@ -158,13 +210,15 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 	width = w;
 	height = h;
 
-	// Allocate memory for the final image data.
-	// To keep memory framentation low this happens before allocating memory for temporary image data.
-	_outputSurface = new Graphics::Surface();
+	// Requesting an output format expands paletted images as well
+	const bool hasOutputFormat = _outputPixelFormat.bytesPerPixel != 0;
+	Graphics::PixelFormat outputFormat;
+	Graphics::PixelFormat decodeFormat;
 
 	// Images of all color formats except PNG_COLOR_TYPE_PALETTE
 	// will be transformed into ARGB images
-	if (colorType == PNG_COLOR_TYPE_PALETTE && (_keepTransparencyPaletted || !png_get_valid(pngPtr, infoPtr, PNG_INFO_tRNS))) {
+	if (colorType == PNG_COLOR_TYPE_PALETTE && !hasOutputFormat &&
+	    (_keepTransparencyPaletted || !png_get_valid(pngPtr, infoPtr, PNG_INFO_tRNS))) {
 		int numPalette = 0;
 		png_colorp palette = NULL;
 		png_bytep trans = nullptr;
@@ -198,8 +252,8 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 			}
 		}
 
-		_outputSurface->create(width, height,
-			hasRgbaPalette ? getByteOrderRgbaPixelFormat(true) : Graphics::PixelFormat::createFormatCLUT8());
+		outputFormat = hasRgbaPalette ? getByteOrderRgbaPixelFormat(true) : Graphics::PixelFormat::createFormatCLUT8();
+		decodeFormat = outputFormat;
 		png_set_packing(pngPtr);
 
 		if (hasRgbaPalette) {
@@ -207,7 +261,7 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 			Common::fill(&rgbaPalette[0], &rgbaPalette[256], 0);
 			for (int i = 0; i < numPalette; ++i) {
 				byte a = (i < numTrans) ? trans[i] : 0xff;
-				rgbaPalette[i] = _outputSurface->format.ARGBToColor(
+				rgbaPalette[i] = outputFormat.ARGBToColor(
 					a, palette[i].red, palette[i].green, palette[i].blue);
 			}
 
@@ -221,20 +275,45 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 			png_set_expand(pngPtr);
 		}
 
-		_outputSurface->create(width, height, getByteOrderRgbaPixelFormat(isAlpha));
-		if (!_outputSurface->getPixels()) {
-			error("Could not allocate memory for output image.");
-		}
 		if (bitDepth == 16)
 			png_set_strip_16(pngPtr);
-		if (bitDepth < 8)
+		if (bitDepth < 8 || colorType == PNG_COLOR_TYPE_PALETTE)
 			png_set_expand(pngPtr);
 		if (colorType == PNG_COLOR_TYPE_GRAY ||
 			colorType == PNG_COLOR_TYPE_GRAY_ALPHA)
 			png_set_gray_to_rgb(pngPtr);
 
-		if (colorType != PNG_COLOR_TYPE_RGB_ALPHA)
+		decodeFormat = getByteOrderRgbaPixelFormat(isAlpha);
+		outputFormat = hasOutputFormat ? _outputPixelFormat : decodeFormat;
+
+		bool bgr, alphaFirst;
+		if (hasOutputFormat && getByteOrder(outputFormat, bgr, alphaFirst)) {
+			// Let libpng write the requested byte order
+			decodeFormat = outputFormat;
+			if (bgr)
+				png_set_bgr(pngPtr);
+			if (outputFormat.bytesPerPixel == 3) {
+				if (isAlpha)
+					png_set_strip_alpha(pngPtr);
+			} else if (isAlpha) {
+				if (alphaFirst)
+					png_set_swap_alpha(pngPtr);
+			} else {
+				png_set_filler(pngPtr, 0xff, alphaFirst ? PNG_FILLER_BEFORE : PNG_FILLER_AFTER);
+			}
+		} else if (colorType != PNG_COLOR_TYPE_RGB_ALPHA) {
 			png_set_filler(pngPtr, 0xff, PNG_FILLER_AFTER);
+		}
+	}
+
+	// Allocate memory for the final image data.
+	// To keep memory framentation low this happens before allocating memory for temporary image data.
+	if (!_rowListener) {
+		_outputSurface = new Graphics::Surface();
+		_outputSurface->create(width, height, outputFormat);
+		if (!_outputSurface->getPixels()) {
+			error("Could not allocate memory for output image.");
+		}
 	}
 
 	// After the transformations have been registered, the image data is read again.
@@ -244,6 +323,13 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 	width = w;
 	height = h;
 
+	// This decodes straight into the output surface unless the rows need
+	// converting or go to the row listener. PNGs with interlacing need
+	// all of the rows at once.
+	const bool isInterlaced = (interlaceType != PNG_INTERLACE_NONE);
+	RowOutput output(_outputSurface, _rowListener, outputFormat, width, height, decodeFormat,
+	                 isInterlaced ? height : kRowStripHeight);
+
 	if (hasRgbaPalette) {
 		// Build up the RGBA surface from paletted rows
 		png_bytep rowPtr = new byte[width];
@@ -252,17 +338,17 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 
 		for (int yp = 0; yp < height; ++yp) {
 			png_read_row(pngPtr, rowPtr, nullptr);
-			uint32 *destRowP = (uint32 *)_outputSurface->getBasePtr(0, yp);
+			uint32 *destRowP = (uint32 *)output.getRow(yp);
 
 			for (int xp = 0; xp < width; ++xp)
 				destRowP[xp] = rgbaPalette[rowPtr[xp]];
 		}
 
 		delete[] rowPtr;
-	} else  if (interlaceType == PNG_INTERLACE_NONE) {
+	} else if (!isInterlaced) {
 		// PNGs without interlacing can simply be read row by row.
 		for (int i = 0; i < height; i++) {
-			png_read_row(pngPtr, (png_bytep)_outputSurface->getBasePtr(0, i), NULL);
+			png_read_row(pngPtr, output.getRow(i), NULL);
 		}
 	} else {
 		// PNGs with interlacing require us to allocate an auxiliary
@@ -276,7 +362,7 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 
 		// Initialize row pointers
 		for (int i = 0; i < height; i++)
-			rowPtr[i] = (png_bytep)_outputSurface->getBasePtr(0, i);
+			rowPtr[i] = output.getRow(i);
 
 		// Read image data
 		png_read_image(pngPtr, rowPtr);
@@ -285,6 +371,8 @@ bool PNGDecoder::loadStream(Common::SeekableReadStream &stream) {
 		delete[] rowPtr;
 	}
 
+	output.flush();
+
 	// Read additional data at the end.
 	png_read_end(pngPtr, NULL);
 
@@ -68,6 +68,24 @@ public:
 	uint32 getTransparentColor() const override { return _transparentColor; }
 	void setSkipSignature(bool skip) { _skipSignature = skip; }
 	void setKeepTransparencyPaletted(bool keep) { _keepTransparencyPaletted = keep; }
+
+	/**
+	 * Decode all images, paletted ones included, to the given format.
+	 *
+	 * libpng writes the 24 and 32-bit byte order formats directly, others
+	 * are converted a few rows at a time while decoding, which saves
+	 * converting the whole surface afterwards.
+	 *
+	 * @return Whether images can be decoded to the format.
+	 */
+	bool setOutputPixelFormat(const Graphics::PixelFormat &format);
+
+	/**
+	 * Pass the rows to the listener while decoding instead of keeping the
+	 * image, getSurface() then returns null after loadStream(). Interlaced
+	 * images are still decoded in full before their rows are passed on.
+	 */
+	void setRowListener(ImageRowListener *listener) { _rowListener = listener; }
 private:
 	Graphics::PixelFormat getByteOrderRgbaPixelFormat(bool isAlpha) const;
 
@@ -81,6 +99,9 @@ private:
 	bool _hasTransparentColor;
 	uint32 _transparentColor;
 
+	Graphics::PixelFormat _outputPixelFormat;
+	ImageRowListener *_rowListener;
+
 	Graphics::Surface *_outputSurface;
 };
 
@@ -0,0 +1,86 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "image/row_output.h"
+#include "image/image_decoder.h"
+
+#include "common/rect.h"
+
+#include "graphics/blit.h"
+
+namespace Image {
+
+RowOutput::RowOutput(Graphics::Surface *surface, ImageRowListener *listener, const Graphics::PixelFormat &outputFormat,
+                     uint width, uint height, const Graphics::PixelFormat &decodeFormat, uint stripHeight) :
+		_surface(surface), _listener(listener), _outputFormat(outputFormat), _width(width),
+		_stripHeight(MAX<uint>(MIN(stripHeight, height), 1)), _stripY(0), _nextY(0) {
+	assert(!surface || surface->format == outputFormat);
+	_direct = surface && decodeFormat == outputFormat;
+
+	if (!_direct) {
+		_strip.create(width, _stripHeight, decodeFormat);
+		if (!surface && decodeFormat != outputFormat)
+			_converted.create(width, _stripHeight, outputFormat);
+	}
+}
+
+RowOutput::~RowOutput() {
+	_strip.free();
+	_converted.free();
+}
+
+byte *RowOutput::getRow(uint y) {
+	assert(y == _nextY);
+	if (_nextY - _stripY == _stripHeight)
+		flush();
+	_nextY++;
+
+	if (_direct)
+		return (byte *)_surface->getBasePtr(0, y);
+	return (byte *)_strip.getBasePtr(0, y - _stripY);
+}
+
+void RowOutput::flush() {
+	const uint rows = _nextY - _stripY;
+	if (!rows)
+		return;
+
+	const Common::Rect stripRect(0, 0, _width, rows);
+	const Common::Rect imageRect(0, _stripY, _width, _nextY);
+	if (_direct) {
+		if (_listener)
+			_listener->decodedRows(_surface->getSubArea(imageRect), _stripY);
+	} else if (_strip.format == _outputFormat) {
+		// Only a listener and no surface
+		_listener->decodedRows(_strip.getSubArea(stripRect), _stripY);
+	} else {
+		Graphics::Surface *dst = _surface ? _surface : &_converted;
+		const Common::Rect &dstRect = _surface ? imageRect : stripRect;
+		Graphics::crossBlit((byte *)dst->getBasePtr(0, dstRect.top), (const byte *)_strip.getPixels(),
+		                    dst->pitch, _strip.pitch, _width, rows, _outputFormat, _strip.format);
+		if (_listener)
+			_listener->decodedRows(dst->getSubArea(dstRect), _stripY);
+	}
+
+	_stripY = _nextY;
+}
+
+} // End of namespace Image
@@ -0,0 +1,86 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef IMAGE_ROW_OUTPUT_H
+#define IMAGE_ROW_OUTPUT_H
+
+#include "graphics/pixelformat.h"
+#include "graphics/surface.h"
+
+namespace Image {
+
+class ImageRowListener;
+
+/**
+ * Helper for decoders that produce an image row by row.
+ *
+ * The rows are decoded in the format the decoding library writes and end
+ * up in the output surface and/or with a row listener, in the output
+ * format. When the two formats match, the rows are decoded straight into
+ * the output surface. Otherwise they are decoded into a strip of a few
+ * rows which is converted while it is still in the cache, instead of
+ * converting the whole image again afterwards.
+ */
+class RowOutput {
+public:
+	/**
+	 * @param surface         The surface to store the image in, already
+	 *                        created in the output format, or null.
+	 * @param listener        The row listener to pass the strips to, or null.
+	 * @param outputFormat    The format of the rows for the surface and the listener.
+	 * @param width           The width of the image.
+	 * @param height          The height of the image.
+	 * @param decodeFormat    The format the rows are decoded in.
+	 * @param stripHeight     The number of rows to buffer before they are
+	 *                        passed on, the height of the image for decoders
+	 *                        that need all of the rows at once.
+	 */
+	RowOutput(Graphics::Surface *surface, ImageRowListener *listener, const Graphics::PixelFormat &outputFormat,
+	          uint width, uint height, const Graphics::PixelFormat &decodeFormat, uint stripHeight);
+	~RowOutput();
+
+	/**
+	 * Get the buffer for decoding the next row into. The rows have to be
+	 * asked for in order, and the rows asked for before have to be
+	 * decoded then, since this can pass them on.
+	 */
+	byte *getRow(uint y);
+
+	/** Pass on the rows decoded since the last strip. */
+	void flush();
+
+private:
+	Graphics::Surface *_surface;
+	ImageRowListener *_listener;
+	Graphics::PixelFormat _outputFormat;
+	uint _width;
+	uint _stripHeight;
+	bool _direct;
+
+	Graphics::Surface _strip;
+	Graphics::Surface _converted;
+	uint _stripY;
+	uint _nextY;
+};
+
+} // End of namespace Image
+
+#endif
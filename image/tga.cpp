@@ -222,9 +222,7 @@ bool TGADecoder::readData(Common::SeekableReadStream &tga, byte imageType, byte
 				} else {
 					dst = (uint16 *)_surface.getBasePtr(0, i);
 				}
-				for (int j = 0; j < _surface.w; j++) {
-					*dst++ = tga.readUint16LE();
-				}
+				tga.readUint16LEArray(dst, _surface.w);
 			}
 		} else if (pixelDepth == 32) {
 			for (int i = 0; i < _surface.h; i++) {
@@ -0,0 +1,115 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "math/utils.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Math {
+
+/**
+ * One TRANSFORM of the scalar pass on two neighbouring complex numbers,
+ * z[0] and z[1], with their twiddles spread over the lanes as
+ * (w0, w0, w1, w1). Multiplications and additions are kept apart, as fused
+ * ones would round differently from the scalar code.
+ */
+static FORCEINLINE void transform2(float *z, int o1, int o2, int o3, float32x4_t wre, float32x4_t wim) {
+	static const float kSignIm[4] = { 1.f, -1.f, 1.f, -1.f };
+	static const float kSignRe[4] = { -1.f, 1.f, -1.f, 1.f };
+
+	const float32x4_t a0 = vld1q_f32(z);
+	const float32x4_t a1 = vld1q_f32(z + o1);
+	const float32x4_t a2 = vld1q_f32(z + o2);
+	const float32x4_t a3 = vld1q_f32(z + o3);
+
+	// (t1, t2) and (t5, t6) of both numbers
+	const float32x4_t a2Swapped = vrev64q_f32(a2);
+	const float32x4_t a3Swapped = vrev64q_f32(a3);
+	const float32x4_t t12 = vaddq_f32(vmulq_f32(a2, wre), vmulq_f32(vmulq_f32(a2Swapped, wim), vld1q_f32(kSignIm)));
+	const float32x4_t t56 = vaddq_f32(vmulq_f32(a3, wre), vmulq_f32(vmulq_f32(a3Swapped, wim), vld1q_f32(kSignRe)));
+
+	// (t5 + t1, t2 + t6), and (t2 - t6, t5 - t1) which are t4 and t3
+	const float32x4_t sum = vaddq_f32(t56, t12);
+	const float32x4_t diff12 = vsubq_f32(t12, t56);
+	const float32x4_t diff56 = vsubq_f32(t56, t12);
+	const float32x4_t t43 = vtrnq_f32(vrev64q_f32(diff12), diff56).val[0];
+
+	vst1q_f32(z, vaddq_f32(a0, sum));
+	vst1q_f32(z + o2, vsubq_f32(a0, sum));
+	vst1q_f32(z + o1, vaddq_f32(a1, t43));
+	vst1q_f32(z + o3, vsubq_f32(a1, t43));
+}
+
+/** The pass of FFT::fft(), on z[0...8n-1] with the twiddles w[1...2n-1]. */
+void fftPassNEON(Complex *z, const float *wre, unsigned int n) {
+	float *d = (float *)z;
+	const int o1 = 4 * n;
+	const int o2 = 8 * n;
+	const int o3 = 12 * n;
+	const float *wim = wre + 2 * n;
+
+	// z[0] is TRANSFORM_ZERO, a multiplication by one
+	const float firstRe[4] = { 1.f, 1.f, wre[1], wre[1] };
+	const float firstIm[4] = { 0.f, 0.f, wim[-1], wim[-1] };
+	transform2(d, o1, o2, o3, vld1q_f32(firstRe), vld1q_f32(firstIm));
+
+	for (unsigned int i = 1; i < n; i++) {
+		d += 4;
+		wre += 2;
+		wim -= 2;
+
+		const float32x2_t re = vld1_f32(wre);
+		const float32x2_t im = vrev64_f32(vld1_f32(wim - 1));
+		const float32x4_t wre4 = vcombine_f32(vdup_lane_f32(re, 0), vdup_lane_f32(re, 1));
+		const float32x4_t wim4 = vcombine_f32(vdup_lane_f32(im, 0), vdup_lane_f32(im, 1));
+		transform2(d, o1, o2, o3, wre4, wim4);
+	}
+}
+
+} // End of namespace Math
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
@@ -0,0 +1,105 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "math/utils.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Math {
+
+/**
+ * One TRANSFORM of the scalar pass on two neighbouring complex numbers,
+ * z[0] and z[1], with their twiddles spread over the lanes as
+ * (w0, w0, w1, w1). The operations are the scalar ones, in the same order.
+ */
+static FORCEINLINE void transform2(float *z, int o1, int o2, int o3, __m128 wre, __m128 wim) {
+	const __m128 signIm = _mm_castsi128_ps(_mm_setr_epi32(0, (int)0x80000000, 0, (int)0x80000000));
+	const __m128 signRe = _mm_castsi128_ps(_mm_setr_epi32((int)0x80000000, 0, (int)0x80000000, 0));
+
+	const __m128 a0 = _mm_loadu_ps(z);
+	const __m128 a1 = _mm_loadu_ps(z + o1);
+	const __m128 a2 = _mm_loadu_ps(z + o2);
+	const __m128 a3 = _mm_loadu_ps(z + o3);
+
+	// (t1, t2) and (t5, t6) of both numbers
+	const __m128 a2Swapped = _mm_shuffle_ps(a2, a2, _MM_SHUFFLE(2, 3, 0, 1));
+	const __m128 a3Swapped = _mm_shuffle_ps(a3, a3, _MM_SHUFFLE(2, 3, 0, 1));
+	const __m128 t12 = _mm_add_ps(_mm_mul_ps(a2, wre), _mm_xor_ps(_mm_mul_ps(a2Swapped, wim), signIm));
+	const __m128 t56 = _mm_add_ps(_mm_mul_ps(a3, wre), _mm_xor_ps(_mm_mul_ps(a3Swapped, wim), signRe));
+
+	// (t5 + t1, t2 + t6), and (t2 - t6, t5 - t1) which are t4 and t3
+	const __m128 sum = _mm_add_ps(t56, t12);
+	const __m128 diff12 = _mm_sub_ps(t12, t56);
+	const __m128 diff56 = _mm_sub_ps(t56, t12);
+	__m128 t43 = _mm_shuffle_ps(diff12, diff56, _MM_SHUFFLE(2, 0, 3, 1));
+	t43 = _mm_shuffle_ps(t43, t43, _MM_SHUFFLE(3, 1, 2, 0));
+
+	_mm_storeu_ps(z, _mm_add_ps(a0, sum));
+	_mm_storeu_ps(z + o2, _mm_sub_ps(a0, sum));
+	_mm_storeu_ps(z + o1, _mm_add_ps(a1, t43));
+	_mm_storeu_ps(z + o3, _mm_sub_ps(a1, t43));
+}
+
+/** The pass of FFT::fft(), on z[0...8n-1] with the twiddles w[1...2n-1]. */
+void fftPassSSE2(Complex *z, const float *wre, unsigned int n) {
+	float *d = (float *)z;
+	const int o1 = 4 * n;
+	const int o2 = 8 * n;
+	const int o3 = 12 * n;
+	const float *wim = wre + 2 * n;
+
+	// z[0] is TRANSFORM_ZERO, a multiplication by one
+	transform2(d, o1, o2, o3, _mm_setr_ps(1.f, 1.f, wre[1], wre[1]), _mm_setr_ps(0.f, 0.f, wim[-1], wim[-1]));
+
+	for (unsigned int i = 1; i < n; i++) {
+		d += 4;
+		wre += 2;
+		wim -= 2;
+
+		const __m128 re = _mm_castsi128_ps(_mm_loadl_epi64((const __m128i *)wre));
+		const __m128 im = _mm_castsi128_ps(_mm_loadl_epi64((const __m128i *)(wim - 1)));
+		transform2(d, o1, o2, o3, _mm_unpacklo_ps(re, re), _mm_shuffle_ps(im, im, _MM_SHUFFLE(0, 0, 1, 1)));
+	}
+}
+
+} // End of namespace Math
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
@@ -28,15 +28,55 @@
 #include "math/fft.h"
 #include "math/cosinetables.h"
 #include "math/utils.h"
+#include "common/mutex.h"
+#include "common/system.h"
 #include "common/util.h"
 
 namespace Math {
 
+#ifdef SCUMMVM_SSE2
+void fftPassSSE2(Complex *z, const float *wre, unsigned int n);
+#endif
+
+#ifdef SCUMMVM_NEON
+void fftPassNEON(Complex *z, const float *wre, unsigned int n);
+#endif
+
+namespace {
+
+// The cosine tables only depend on their size, so all the transforms share
+// them: a decoder's FFTs, MDCTs and RDFTs are mostly of the same few sizes.
+// Created from the main thread when the first FFT is, like the seek indices.
+Common::Mutex *g_cosTablesMutex = nullptr;
+CosineTable *g_cosTables[13] = { nullptr };
+uint g_cosTablesRefs[13] = { 0 };
+
+CosineTable *acquireCosineTable(int index) {
+	if (!g_cosTablesMutex)
+		g_cosTablesMutex = new Common::Mutex();
+	Common::StackLock lock(*g_cosTablesMutex);
+
+	if (!g_cosTables[index])
+		g_cosTables[index] = new CosineTable(1 << (index + 4));
+	g_cosTablesRefs[index]++;
+	return g_cosTables[index];
+}
+
+void releaseCosineTable(int index) {
+	Common::StackLock lock(*g_cosTablesMutex);
+
+	if (--g_cosTablesRefs[index] == 0) {
+		delete g_cosTables[index];
+		g_cosTables[index] = nullptr;
+	}
+}
+
+} // End of anonymous namespace
+
 FFT::FFT(int bits, int inverse) : _bits(bits), _inverse(inverse) {
 	assert((_bits >= 2) && (_bits <= 16));
 
 	int n = 1 << bits;
-	int nPoints;
 
 	_tmpBuf = new Complex[n];
 	_expTab = new Complex[n / 2];
@@ -48,10 +88,8 @@ FFT::FFT(int bits, int inverse) : _bits(bits), _inverse(inverse) {
 		_revTab[-splitRadixPermutation(i, n, _inverse) & (n - 1)] = i;
 
 	for (int i = 0; i < ARRAYSIZE(_cosTables); i++) {
-		if (i + 4 <= _bits) {
-			nPoints = 1 << (i + 4);
-			_cosTables[i] = new CosineTable(nPoints);
-		}
+		if (i + 4 <= _bits)
+			_cosTables[i] = acquireCosineTable(i);
 		else
 			_cosTables[i] = nullptr;
 	}
@@ -59,7 +97,8 @@ FFT::FFT(int bits, int inverse) : _bits(bits), _inverse(inverse) {
 
 FFT::~FFT() {
 	for (int i = 0; i < ARRAYSIZE(_cosTables); i++) {
-		delete _cosTables[i];
+		if (_cosTables[i])
+			releaseCosineTable(i);
 	}
 
 	delete[] _revTab;
@@ -180,6 +219,51 @@ PASS(pass)
 #define BUTTERFLIES BUTTERFLIES_BIG
 PASS(pass_big)
 
+namespace {
+
+typedef void (*PassFunc)(Complex *z, const float *wre, unsigned int n);
+
+void passGeneric(Complex *z, const float *wre, unsigned int n) {
+	if (n > 128)
+		pass_big(z, wre, n);
+	else
+		pass(z, wre, n);
+}
+
+PassFunc passFunc = passGeneric;
+bool kernelsSelected = false;
+
+/**
+ * Pick the kernels for the CPU, like the audio mix bus does. SSE2 and NEON
+ * are part of the x86-64 and AArch64 baselines, elsewhere the backend has
+ * to be asked, once it is up.
+ */
+void selectKernels() {
+	if (kernelsSelected)
+		return;
+
+#if defined(SCUMMVM_SSE2) && (defined(__x86_64__) || defined(_M_X64))
+	passFunc = fftPassSSE2;
+#elif defined(SCUMMVM_NEON) && defined(__aarch64__)
+	passFunc = fftPassNEON;
+#else
+	if (!g_system)
+		return;
+
+#ifdef SCUMMVM_NEON
+	if (g_system->hasFeature(OSystem::kFeatureCpuNEON))
+		passFunc = fftPassNEON;
+#endif
+#ifdef SCUMMVM_SSE2
+	if (g_system->hasFeature(OSystem::kFeatureCpuSSE2))
+		passFunc = fftPassSSE2;
+#endif
+#endif
+	kernelsSelected = true;
+}
+
+} // End of anonymous namespace
+
 void FFT::fft4(Complex *z) {
 	float t1, t2, t3, t4, t5, t6, t7, t8;
 
@@ -244,14 +328,12 @@ void FFT::fft(int n, int logn, Complex *z) {
 		fft((n / 4), logn - 2, z + (n / 4) * 2);
 		fft((n / 4), logn - 2, z + (n / 4) * 3);
 		assert(_cosTables[logn - 4]);
-		if (n > 1024)
-			pass_big(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
-		else
-			pass(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
+		passFunc(z, _cosTables[logn - 4]->getTable(), (n / 4) / 2);
 	}
 }
 
 void FFT::calc(Complex *z) {
+	selectKernels();
 	fft(1 << _bits, _bits, z);
 }
 
@@ -0,0 +1,103 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include "math/matrix4.h"
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Math {
+
+/**
+ * Each row of the product is the rows of b weighted by a row of a. The
+ * multiplications and additions are kept apart, as fused ones would round
+ * differently from the scalar code.
+ */
+void matrix4MultiplyNEON(float *r, const float *a, const float *b) {
+	const float32x4_t b0 = vld1q_f32(b);
+	const float32x4_t b1 = vld1q_f32(b + 4);
+	const float32x4_t b2 = vld1q_f32(b + 8);
+	const float32x4_t b3 = vld1q_f32(b + 12);
+
+	for (int i = 0; i < 16; i += 4) {
+		float32x4_t row = vmulq_n_f32(b0, a[i + 0]);
+		row = vaddq_f32(row, vmulq_n_f32(b1, a[i + 1]));
+		row = vaddq_f32(row, vmulq_n_f32(b2, a[i + 2]));
+		row = vaddq_f32(row, vmulq_n_f32(b3, a[i + 3]));
+		vst1q_f32(r + i, row);
+	}
+}
+
+/** Each point is the columns of the matrix weighted by its coordinates. */
+void matrix4TransformPointsNEON(const float *m, const Vector3d *in, Vector3d *out, uint count, bool translate) {
+	const float w = translate ? 1.f : 0.f;
+	const float columns[16] = {
+		m[0], m[4], m[8], m[12],
+		m[1], m[5], m[9], m[13],
+		m[2], m[6], m[10], m[14],
+		m[3] * w, m[7] * w, m[11] * w, m[15] * w
+	};
+	const float32x4_t c0 = vld1q_f32(columns);
+	const float32x4_t c1 = vld1q_f32(columns + 4);
+	const float32x4_t c2 = vld1q_f32(columns + 8);
+	const float32x4_t c3 = vld1q_f32(columns + 12);
+
+	for (uint i = 0; i < count; ++i) {
+		const float *v = in[i].getData();
+		float32x4_t p = vmulq_n_f32(c0, v[0]);
+		p = vaddq_f32(p, vmulq_n_f32(c1, v[1]));
+		p = vaddq_f32(p, vmulq_n_f32(c2, v[2]));
+		p = vaddq_f32(p, c3);
+
+		float *o = out[i].getData();
+		vst1_f32(o, vget_low_f32(p));
+		vst1q_lane_f32(o + 2, p, 2);
+	}
+}
+
+} // End of namespace Math
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
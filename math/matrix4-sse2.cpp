@@ -0,0 +1,182 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "math/matrix4.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Math {
+
+/**
+ * Each row of the product is the rows of b weighted by a row of a, summed
+ * in the same order as the scalar code so that the result is the same.
+ */
+void matrix4MultiplySSE2(float *r, const float *a, const float *b) {
+	const __m128 b0 = _mm_loadu_ps(b);
+	const __m128 b1 = _mm_loadu_ps(b + 4);
+	const __m128 b2 = _mm_loadu_ps(b + 8);
+	const __m128 b3 = _mm_loadu_ps(b + 12);
+
+	for (int i = 0; i < 16; i += 4) {
+		__m128 row = _mm_mul_ps(_mm_set1_ps(a[i + 0]), b0);
+		row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[i + 1]), b1));
+		row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[i + 2]), b2));
+		row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(a[i + 3]), b3));
+		_mm_storeu_ps(r + i, row);
+	}
+}
+
+/**
+ * The inverse through the cofactors of 2x2 sub-matrices, after Intel's
+ * application note AP-928 "Streaming SIMD Extensions - Inverse of 4x4
+ * Matrix", dividing by the determinant instead of estimating its inverse.
+ */
+bool matrix4InverseSSE2(float *m) {
+	__m128 tmp1 = _mm_setzero_ps();
+	__m128 row1 = _mm_setzero_ps();
+	__m128 row3 = _mm_setzero_ps();
+
+	// Transpose the matrix, swapping the two last rows' halves
+	tmp1 = _mm_loadh_pi(_mm_loadl_pi(tmp1, (const __m64 *)(m)), (const __m64 *)(m + 4));
+	row1 = _mm_loadh_pi(_mm_loadl_pi(row1, (const __m64 *)(m + 8)), (const __m64 *)(m + 12));
+	__m128 row0 = _mm_shuffle_ps(tmp1, row1, 0x88);
+	row1 = _mm_shuffle_ps(row1, tmp1, 0xDD);
+	tmp1 = _mm_loadh_pi(_mm_loadl_pi(tmp1, (const __m64 *)(m + 2)), (const __m64 *)(m + 6));
+	row3 = _mm_loadh_pi(_mm_loadl_pi(row3, (const __m64 *)(m + 10)), (const __m64 *)(m + 14));
+	__m128 row2 = _mm_shuffle_ps(tmp1, row3, 0x88);
+	row3 = _mm_shuffle_ps(row3, tmp1, 0xDD);
+
+	__m128 minor0, minor1, minor2, minor3;
+
+	tmp1 = _mm_mul_ps(row2, row3);
+	tmp1 = _mm_shuffle_ps(tmp1, tmp1, 0xB1);
+	minor0 = _mm_mul_ps(row1, tmp1);
+	minor1 = _mm_mul_ps(row0, tmp1);
+	tmp1 = _mm_shuffle_ps(tmp1, tmp1, 0x4E);
+	minor0 = _mm_sub_ps(_mm_mul_ps(row1, tmp1), minor0);
+	minor1 = _mm_sub_ps(_mm_mul_ps(row0, tmp1), minor1);
+	minor1 = _mm_shuffle_ps(minor1, minor1, 0x4E);
+
+	tmp1 = _mm_mul_ps(row1, row2);
+	tmp1 = _mm_shuffle_ps(tmp1, tmp1, 0xB1);
+	minor0 = _mm_add_ps(_mm_mul_ps(row3, tmp1), minor0);
+	minor3 = _mm_mul_ps(row0, tmp1);
+	tmp1 = _mm_shuffle_ps(tmp1, tmp1, 0x4E);
+	minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row3, tmp1));
+	minor3 = _mm_sub_ps(_mm_mul_ps(row0, tmp1), minor3);
+	minor3 = _mm_shuffle_ps(minor3, minor3, 0x4E);
+
+	tmp1 = _mm_mul_ps(_mm_shuffle_ps(row1, row1, 0x4E), row3);
+	tmp1 = _mm_shuffle_ps(tmp1, tmp1, 0xB1);
+	row2 = _mm_shuffle_ps(row2, row2, 0x4E);
+	minor0 = _mm_add_ps(_mm_mul_ps(row2, tmp1), minor0);
+	minor2 = _mm_mul_ps(row0, tmp1);
+	tmp1 = _mm_shuffle_ps(tmp1, tmp1, 0x4E);
+	minor0 = _mm_sub_ps(minor0, _mm_mul_ps(row2, tmp1));
+	minor2 = _mm_sub_ps(_mm_mul_ps(row0, tmp1), minor2);
+	minor2 = _mm_shuffle_ps(minor2, minor2, 0x4E);
+
+	tmp1 = _mm_mul_ps(row0, row1);
+	tmp1 = _mm_shuffle_ps(tmp1, tmp1, 0xB1);
+	minor2 = _mm_add_ps(_mm_mul_ps(row3, tmp1), minor2);
+	minor3 = _mm_sub_ps(_mm_mul_ps(row2, tmp1), minor3);
+	tmp1 = _mm_shuffle_ps(tmp1, tmp1, 0x4E);
+	minor2 = _mm_sub_ps(_mm_mul_ps(row3, tmp1), minor2);
+	minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row2, tmp1));
+
+	tmp1 = _mm_mul_ps(row0, row3);
+	tmp1 = _mm_shuffle_ps(tmp1, tmp1, 0xB1);
+	minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row2, tmp1));
+	minor2 = _mm_add_ps(_mm_mul_ps(row1, tmp1), minor2);
+	tmp1 = _mm_shuffle_ps(tmp1, tmp1, 0x4E);
+	minor1 = _mm_add_ps(_mm_mul_ps(row2, tmp1), minor1);
+	minor2 = _mm_sub_ps(minor2, _mm_mul_ps(row1, tmp1));
+
+	tmp1 = _mm_mul_ps(row0, row2);
+	tmp1 = _mm_shuffle_ps(tmp1, tmp1, 0xB1);
+	minor1 = _mm_add_ps(_mm_mul_ps(row3, tmp1), minor1);
+	minor3 = _mm_sub_ps(minor3, _mm_mul_ps(row1, tmp1));
+	tmp1 = _mm_shuffle_ps(tmp1, tmp1, 0x4E);
+	minor1 = _mm_sub_ps(minor1, _mm_mul_ps(row3, tmp1));
+	minor3 = _mm_add_ps(_mm_mul_ps(row1, tmp1), minor3);
+
+	__m128 det = _mm_mul_ps(row0, minor0);
+	det = _mm_add_ps(_mm_shuffle_ps(det, det, 0x4E), det);
+	det = _mm_add_ss(_mm_shuffle_ps(det, det, 0xB1), det);
+
+	const float detValue = _mm_cvtss_f32(det);
+	if (detValue == 0)
+		return false;
+
+	det = _mm_set1_ps(1.0f / detValue);
+	_mm_storeu_ps(m, _mm_mul_ps(det, minor0));
+	_mm_storeu_ps(m + 4, _mm_mul_ps(det, minor1));
+	_mm_storeu_ps(m + 8, _mm_mul_ps(det, minor2));
+	_mm_storeu_ps(m + 12, _mm_mul_ps(det, minor3));
+	return true;
+}
+
+/**
+ * Each point is the columns of the matrix weighted by its coordinates,
+ * summed in the same order as the scalar code.
+ */
+void matrix4TransformPointsSSE2(const float *m, const Vector3d *in, Vector3d *out, uint count, bool translate) {
+	const __m128 c0 = _mm_setr_ps(m[0], m[4], m[8], m[12]);
+	const __m128 c1 = _mm_setr_ps(m[1], m[5], m[9], m[13]);
+	const __m128 c2 = _mm_setr_ps(m[2], m[6], m[10], m[14]);
+	const __m128 c3 = _mm_mul_ps(_mm_setr_ps(m[3], m[7], m[11], m[15]), _mm_set1_ps(translate ? 1.f : 0.f));
+
+	for (uint i = 0; i < count; ++i) {
+		const float *v = in[i].getData();
+		__m128 p = _mm_mul_ps(c0, _mm_set1_ps(v[0]));
+		p = _mm_add_ps(p, _mm_mul_ps(c1, _mm_set1_ps(v[1])));
+		p = _mm_add_ps(p, _mm_mul_ps(c2, _mm_set1_ps(v[2])));
+		p = _mm_add_ps(p, c3);
+
+		float *o = out[i].getData();
+		_mm_storel_pi((__m64 *)o, p);
+		_mm_store_ss(o + 2, _mm_movehl_ps(p, p));
+	}
+}
+
+} // End of namespace Math
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
@@ -22,9 +22,221 @@
 #include "math/matrix4.h"
 #include "math/vector4d.h"
 #include "math/squarematrix.h"
+#include "common/system.h"
 
 namespace Math {
 
+#ifdef SCUMMVM_SSE2
+void matrix4MultiplySSE2(float *r, const float *a, const float *b);
+bool matrix4InverseSSE2(float *m);
+void matrix4TransformPointsSSE2(const float *m, const Vector3d *in, Vector3d *out, uint count, bool translate);
+#endif
+
+#ifdef SCUMMVM_NEON
+void matrix4MultiplyNEON(float *r, const float *a, const float *b);
+void matrix4TransformPointsNEON(const float *m, const Vector3d *in, Vector3d *out, uint count, bool translate);
+#endif
+
+namespace {
+
+typedef void (*MultiplyFunc)(float *r, const float *a, const float *b);
+typedef bool (*InverseFunc)(float *m);
+typedef void (*TransformPointsFunc)(const float *m, const Vector3d *in, Vector3d *out, uint count, bool translate);
+
+void matrix4MultiplyGeneric(float *r, const float *d1, const float *d2) {
+	for (int i = 0; i < 16; i += 4) {
+		for (int j = 0; j < 4; ++j) {
+			r[i + j] = (d1[i + 0] * d2[j + 0]) +
+			           (d1[i + 1] * d2[j + 4]) +
+			           (d1[i + 2] * d2[j + 8]) +
+			           (d1[i + 3] * d2[j + 12]);
+		}
+	}
+}
+
+bool matrix4InverseGeneric(float *m) {
+	float inv[16];
+
+	inv[0] = m[5]  * m[10] * m[15] -
+	         m[5]  * m[11] * m[14] -
+	         m[9]  * m[6]  * m[15] +
+	         m[9]  * m[7]  * m[14] +
+	         m[13] * m[6]  * m[11] -
+	         m[13] * m[7]  * m[10];
+
+	inv[4] = -m[4]  * m[10] * m[15] +
+	          m[4]  * m[11] * m[14] +
+	          m[8]  * m[6]  * m[15] -
+	          m[8]  * m[7]  * m[14] -
+	          m[12] * m[6]  * m[11] +
+	          m[12] * m[7]  * m[10];
+
+	inv[8] = m[4]  * m[9]  * m[15] -
+	         m[4]  * m[11] * m[13] -
+	         m[8]  * m[5]  * m[15] +
+	         m[8]  * m[7]  * m[13] +
+	         m[12] * m[5]  * m[11] -
+	         m[12] * m[7]  * m[9];
+
+	inv[12] = -m[4]  * m[9]  * m[14] +
+	           m[4]  * m[10] * m[13] +
+	           m[8]  * m[5]  * m[14] -
+	           m[8]  * m[6]  * m[13] -
+	           m[12] * m[5]  * m[10] +
+	           m[12] * m[6]  * m[9];
+
+	inv[1] = -m[1]  * m[10] * m[15] +
+	          m[1]  * m[11] * m[14] +
+	          m[9]  * m[2]  * m[15] -
+	          m[9]  * m[3]  * m[14] -
+	          m[13] * m[2]  * m[11] +
+	          m[13] * m[3]  * m[10];
+
+	inv[5] = m[0]  * m[10] * m[15] -
+	         m[0]  * m[11] * m[14] -
+	         m[8]  * m[2]  * m[15] +
+	         m[8]  * m[3]  * m[14] +
+	         m[12] * m[2]  * m[11] -
+	         m[12] * m[3]  * m[10];
+
+	inv[9] = -m[0]  * m[9]  * m[15] +
+	          m[0]  * m[11] * m[13] +
+	          m[8]  * m[1]  * m[15] -
+	          m[8]  * m[3]  * m[13] -
+	          m[12] * m[1]  * m[11] +
+	          m[12] * m[3]  * m[9];
+
+	inv[13] = m[0]  * m[9]  * m[14] -
+	          m[0]  * m[10] * m[13] -
+	          m[8]  * m[1]  * m[14] +
+	          m[8]  * m[2]  * m[13] +
+	          m[12] * m[1]  * m[10] -
+	          m[12] * m[2]  * m[9];
+
+	inv[2] = m[1]  * m[6] * m[15] -
+	         m[1]  * m[7] * m[14] -
+	         m[5]  * m[2] * m[15] +
+	         m[5]  * m[3] * m[14] +
+	         m[13] * m[2] * m[7] -
+	         m[13] * m[3] * m[6];
+
+	inv[6] = -m[0]  * m[6] * m[15] +
+	          m[0]  * m[7] * m[14] +
+	          m[4]  * m[2] * m[15] -
+	          m[4]  * m[3] * m[14] -
+	          m[12] * m[2] * m[7] +
+	          m[12] * m[3] * m[6];
+
+	inv[10] = m[0]  * m[5] * m[15] -
+	          m[0]  * m[7] * m[13] -
+	          m[4]  * m[1] * m[15] +
+	          m[4]  * m[3] * m[13] +
+	          m[12] * m[1] * m[7] -
+	          m[12] * m[3] * m[5];
+
+	inv[14] = -m[0]  * m[5] * m[14] +
+	           m[0]  * m[6] * m[13] +
+	           m[4]  * m[1] * m[14] -
+	           m[4]  * m[2] * m[13] -
+	           m[12] * m[1] * m[6] +
+	           m[12] * m[2] * m[5];
+
+	inv[3] = -m[1] * m[6] * m[11] +
+	          m[1] * m[7] * m[10] +
+	          m[5] * m[2] * m[11] -
+	          m[5] * m[3] * m[10] -
+	          m[9] * m[2] * m[7] +
+	          m[9] * m[3] * m[6];
+
+	inv[7] = m[0] * m[6] * m[11] -
+	         m[0] * m[7] * m[10] -
+	         m[4] * m[2] * m[11] +
+	         m[4] * m[3] * m[10] +
+	         m[8] * m[2] * m[7] -
+	         m[8] * m[3] * m[6];
+
+	inv[11] = -m[0] * m[5] * m[11] +
+	           m[0] * m[7] * m[9] +
+	           m[4] * m[1] * m[11] -
+	           m[4] * m[3] * m[9] -
+	           m[8] * m[1] * m[7] +
+	           m[8] * m[3] * m[5];
+
+	inv[15] = m[0] * m[5] * m[10] -
+	          m[0] * m[6] * m[9] -
+	          m[4] * m[1] * m[10] +
+	          m[4] * m[2] * m[9] +
+	          m[8] * m[1] * m[6] -
+	          m[8] * m[2] * m[5];
+
+	float det = m[0] * inv[0] + m[1] * inv[4] + m[2] * inv[8] + m[3] * inv[12];
+
+	if (det == 0)
+		return false;
+
+	det = 1.0 / det;
+
+	for (int i = 0; i < 16; i++) {
+		m[i] = inv[i] * det;
+	}
+
+	return true;
+}
+
+void matrix4TransformPointsGeneric(const float *m, const Vector3d *in, Vector3d *out, uint count, bool translate) {
+	const float w = translate ? 1.f : 0.f;
+	for (uint i = 0; i < count; ++i) {
+		const float x = in[i].x(), y = in[i].y(), z = in[i].z();
+		out[i].set(m[0] * x + m[1] * y + m[2] * z + m[3] * w,
+		           m[4] * x + m[5] * y + m[6] * z + m[7] * w,
+		           m[8] * x + m[9] * y + m[10] * z + m[11] * w);
+	}
+}
+
+MultiplyFunc multiplyFunc = matrix4MultiplyGeneric;
+InverseFunc inverseFunc = matrix4InverseGeneric;
+TransformPointsFunc transformPointsFunc = matrix4TransformPointsGeneric;
+bool kernelsSelected = false;
+
+/**
+ * Pick the kernels for the CPU, like the audio mix bus does. SSE2 and NEON
+ * are part of the x86-64 and AArch64 baselines, elsewhere the backend has
+ * to be asked, once it is up.
+ */
+void selectKernels() {
+	if (kernelsSelected)
+		return;
+
+#if defined(SCUMMVM_SSE2) && (defined(__x86_64__) || defined(_M_X64))
+	multiplyFunc = matrix4MultiplySSE2;
+	inverseFunc = matrix4InverseSSE2;
+	transformPointsFunc = matrix4TransformPointsSSE2;
+#elif defined(SCUMMVM_NEON) && defined(__aarch64__)
+	multiplyFunc = matrix4MultiplyNEON;
+	transformPointsFunc = matrix4TransformPointsNEON;
+#else
+	if (!g_system)
+		return;
+
+#ifdef SCUMMVM_NEON
+	if (g_system->hasFeature(OSystem::kFeatureCpuNEON)) {
+		multiplyFunc = matrix4MultiplyNEON;
+		transformPointsFunc = matrix4TransformPointsNEON;
+	}
+#endif
+#ifdef SCUMMVM_SSE2
+	if (g_system->hasFeature(OSystem::kFeatureCpuSSE2)) {
+		multiplyFunc = matrix4MultiplySSE2;
+		inverseFunc = matrix4InverseSSE2;
+		transformPointsFunc = matrix4TransformPointsSSE2;
+	}
+#endif
+#endif
+	kernelsSelected = true;
+}
+
+} // End of anonymous namespace
+
 Matrix<4, 4>::Matrix() :
 	MatrixType<4, 4>(), Rotation3D<Matrix4>() {
 }
@@ -34,15 +246,24 @@ Matrix<4, 4>::Matrix(const MatrixBase<4, 4> &m) :
 }
 
 void Matrix<4, 4>::transform(Vector3d *v, bool trans) const {
-	Vector4d m;
-	m(0, 0) = v->x();
-	m(1, 0) = v->y();
-	m(2, 0) = v->z();
-	m(3, 0) = (trans ? 1.f : 0.f);
+	transformPoints(v, v, 1, trans);
+}
 
-	m = *this * m;
+Matrix<4, 4> Matrix<4, 4>::operator*(const Matrix<4, 4> &m2) const {
+	Matrix<4, 4> result;
+	selectKernels();
+	multiplyFunc(result.getData(), getData(), m2.getData());
+	return result;
+}
+
+void Matrix<4, 4>::transformPoints(const Vector3d *in, Vector3d *out, uint count, bool translate) const {
+	selectKernels();
+	transformPointsFunc(getData(), in, out, count, translate);
+}
 
-	v->set(m(0, 0), m(1, 0), m(2, 0));
+bool Matrix<4, 4>::inverse() {
+	selectKernels();
+	return inverseFunc(getData());
 }
 
 Vector3d Matrix<4, 4>::getPosition() const {
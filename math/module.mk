@@ -24,5 +24,16 @@ MODULE_OBJS := \
 	vector3d.o \
 	vector4d.o
 
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	fft-neon.o \
+	matrix4-neon.o
+endif
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	fft-sse2.o \
+	matrix4-sse2.o
+endif
+
 # Include common rules
 include $(srcdir)/rules.mk
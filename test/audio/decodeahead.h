@@ -0,0 +1,57 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/decodeahead.h"
+
+#include "helper.h"
+
+class DecodeAheadTestSuite : public CxxTest::TestSuite {
+public:
+	void test_buffered_read() {
+		int16 *sine = 0;
+		Audio::SeekableAudioStream *source = createSineStream<int16>(11025, 1, &sine, false, true);
+		Audio::AudioStream *stream = Audio::makeDecodeAheadStream(source, 300);
+		const int total = 11025 * 2;
+
+		TS_ASSERT(stream->isStereo());
+		TS_ASSERT_EQUALS(stream->getRate(), 11025);
+
+		// 300ms of stereo samples take one full chunk and part of another
+		TS_ASSERT(Audio::fillDecodeAheadStreams());
+		TS_ASSERT(!Audio::fillDecodeAheadStreams());
+
+		int16 buffer[1000];
+		int pos = 0;
+		while (pos < total) {
+			const int read = stream->readBuffer(buffer, MIN(1000, total - pos));
+			TS_ASSERT_EQUALS(read, MIN(1000, total - pos));
+			TS_ASSERT_EQUALS(memcmp(buffer, sine + pos, read * sizeof(int16)), 0);
+			pos += read;
+
+			Audio::fillDecodeAheadStreams();
+		}
+
+		TS_ASSERT(stream->endOfData());
+		TS_ASSERT_EQUALS(stream->readBuffer(buffer, 1000), 0);
+
+		delete stream;
+		delete[] sine;
+	}
+
+	void test_read_without_filling() {
+		int16 *sine = 0;
+		Audio::SeekableAudioStream *source = createSineStream<int16>(8000, 1, &sine, true, false);
+		Audio::AudioStream *stream = Audio::makeDecodeAheadStream(source);
+
+		int16 *buffer = new int16[8000];
+		TS_ASSERT_EQUALS(stream->readBuffer(buffer, 3000), 3000);
+		Audio::fillDecodeAheadStreams();
+		// Part comes from the buffer, the rest is decoded right away
+		TS_ASSERT_EQUALS(stream->readBuffer(buffer + 3000, 5000), 5000);
+		TS_ASSERT_EQUALS(memcmp(buffer, sine, 8000 * sizeof(int16)), 0);
+		TS_ASSERT(stream->endOfData());
+
+		delete stream;
+		delete[] buffer;
+		delete[] sine;
+	}
+};
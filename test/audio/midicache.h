@@ -0,0 +1,99 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/midicache.h"
+
+class MidiRenderCacheTestSuite : public CxxTest::TestSuite {
+	enum {
+		kFrames = 64
+	};
+
+	int16 _block[kFrames * 2];
+
+	void fillBlock(int first) {
+		for (int i = 0; i < kFrames; ++i)
+			_block[i * 2] = _block[i * 2 + 1] = first + i;
+	}
+
+	// Record a track of 80 frames, numbered 16 to 95
+	void record(Audio::MidiRenderCache &cache) {
+		TS_ASSERT(!cache.start("track", 16));
+		TS_ASSERT(!cache.beginBlock());
+		fillBlock(0);
+		cache.endBlock(_block, kFrames, false);
+
+		TS_ASSERT(!cache.beginBlock());
+		fillBlock(kFrames);
+		cache.finish(32);
+		cache.endBlock(_block, kFrames, false);
+	}
+
+public:
+	void test_record_and_play_back() {
+		Audio::MidiRenderCache cache(22050, true, "test");
+		record(cache);
+		TS_ASSERT(!cache.isPlaying());
+
+		TS_ASSERT(cache.start("track", 0));
+		TS_ASSERT(cache.isPlaying());
+
+		// Rendered live, but replaced by the recording
+		TS_ASSERT(!cache.beginBlock());
+		fillBlock(1000);
+		cache.endBlock(_block, kFrames, false);
+		TS_ASSERT_EQUALS(_block[0], 16);
+		TS_ASSERT_EQUALS(_block[kFrames * 2 - 1], 16 + kFrames - 1);
+
+		// Not rendered at all; past the end is silence
+		TS_ASSERT(cache.beginBlock());
+		cache.endBlock(_block, kFrames, true);
+		TS_ASSERT_EQUALS(_block[0], 16 + kFrames);
+		TS_ASSERT_EQUALS(_block[31], 95);
+		TS_ASSERT_EQUALS(_block[32], 0);
+		TS_ASSERT_EQUALS(_block[kFrames * 2 - 1], 0);
+		TS_ASSERT(cache.isPlaying());
+
+		// Playing it again starts over
+		TS_ASSERT(cache.start("track", 0));
+		cache.endBlock(_block, kFrames, true);
+		TS_ASSERT_EQUALS(_block[0], 16);
+	}
+
+	void test_stop() {
+		Audio::MidiRenderCache cache(22050, true, "test");
+
+		// A stopped recording is not kept
+		TS_ASSERT(!cache.start("track", 0));
+		cache.endBlock(_block, kFrames, false);
+		cache.stop(10);
+		cache.finish(20);
+		cache.endBlock(_block, kFrames, false);
+		TS_ASSERT(!cache.start("track", 0));
+
+		record(cache);
+		TS_ASSERT(cache.start("track", 0));
+		cache.endBlock(_block, kFrames, false);
+
+		// The rest of a block which is not rendered is still filled in
+		TS_ASSERT(cache.beginBlock());
+		cache.stop(4);
+		TS_ASSERT(!cache.isPlaying());
+		cache.endBlock(_block, kFrames, true);
+		TS_ASSERT_EQUALS(_block[8], 16 + kFrames + 4);
+		TS_ASSERT(!cache.beginBlock());
+	}
+
+	void test_sysex_state() {
+		Audio::MidiRenderCache cache(22050, true, "test");
+		const byte sysex[] = { 0x41, 0x10, 0x16, 0x12, 0x00 };
+
+		record(cache);
+		cache.noteSysEx(sysex, sizeof(sysex));
+		// The synth may sound different now
+		TS_ASSERT(!cache.start("track", 0));
+
+		// Sending the same message again changes nothing
+		record(cache);
+		cache.noteSysEx(sysex, sizeof(sysex));
+		TS_ASSERT(cache.start("track", 0));
+	}
+};
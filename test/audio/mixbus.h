@@ -0,0 +1,101 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/mixbus.h"
+#include "audio/mixer.h"
+#include "audio/rate.h"
+
+#include "helper.h"
+
+class MixBusTestSuite : public CxxTest::TestSuite {
+private:
+	void convertTestTemplate(Audio::st_rate_t inRate, Audio::st_rate_t outRate, bool inStereo) {
+		const int outFrames = 2000;
+		Audio::SeekableAudioStream *s16 = createSineStream<int16>(inRate, 1, nullptr, false, inStereo);
+		Audio::SeekableAudioStream *s32 = createSineStream<int16>(inRate, 1, nullptr, false, inStereo);
+		Audio::RateConverter *conv16 = Audio::makeRateConverter(inRate, outRate, inStereo, true, false);
+		Audio::RateConverter *conv32 = Audio::makeRateConverter(inRate, outRate, inStereo, true, false);
+
+		int16 *out16 = new int16[outFrames * 2]();
+		int32 *bus = new int32[outFrames * 2]();
+		int16 *out32 = new int16[outFrames * 2]();
+
+		TS_ASSERT_EQUALS(conv16->convert(*s16, out16, outFrames, 200, 120), outFrames);
+		TS_ASSERT_EQUALS(conv32->convert(*s32, bus, outFrames, 200, 120), outFrames);
+		Audio::mixBusClamp(out32, bus, outFrames * 2);
+		TS_ASSERT_EQUALS(memcmp(out16, out32, outFrames * 2 * sizeof(int16)), 0);
+
+		delete[] out16;
+		delete[] bus;
+		delete[] out32;
+		delete conv16;
+		delete conv32;
+		delete s16;
+		delete s32;
+	}
+
+public:
+	void test_accumulate() {
+		int16 src[2 * 37];
+		for (int i = 0; i < ARRAYSIZE(src); ++i)
+			src[i] = (int16)(i * 7919 - 32768);
+		src[3] = -32768;
+		src[4] = 32767;
+
+		const Audio::st_volume_t volumes[] = { 0, 1, 100, 255, 256 };
+		for (uint frames = 1; frames <= 37; frames += 4) {
+			for (int srcStereo = 0; srcStereo < 2; ++srcStereo) {
+				for (int v = 0; v < ARRAYSIZE(volumes); ++v) {
+					const Audio::st_volume_t volL = volumes[v];
+					const Audio::st_volume_t volR = volumes[ARRAYSIZE(volumes) - 1 - v];
+
+					int32 dst[2 * 37];
+					int32 expected[2 * 37];
+					for (uint i = 0; i < 2 * frames; ++i)
+						dst[i] = expected[i] = 1000 - (int32)i * 50000;
+
+					Audio::mixBusAccumulate(dst, src, frames, srcStereo, volL, volR);
+
+					for (uint i = 0; i < frames; ++i) {
+						const int inL = srcStereo ? src[2 * i] : src[i];
+						const int inR = srcStereo ? src[2 * i + 1] : src[i];
+						expected[2 * i] += (inL * volL) / Audio::Mixer::kMaxMixerVolume;
+						expected[2 * i + 1] += (inR * volR) / Audio::Mixer::kMaxMixerVolume;
+					}
+					TS_ASSERT_EQUALS(memcmp(dst, expected, 2 * frames * sizeof(int32)), 0);
+				}
+			}
+		}
+	}
+
+	void test_clamp() {
+		int32 src[19];
+		for (int i = 0; i < ARRAYSIZE(src); ++i)
+			src[i] = (i - 9) * 10000;
+
+		int16 dst[ARRAYSIZE(src)];
+		Audio::mixBusClamp(dst, src, ARRAYSIZE(src));
+
+		for (int i = 0; i < ARRAYSIZE(src); ++i) {
+			int16 expected = (int16)CLIP<int32>(src[i], -32768, 32767);
+#ifdef OUTPUT_UNSIGNED_AUDIO
+			expected ^= 0x8000;
+#endif
+			TS_ASSERT_EQUALS(dst[i], expected);
+		}
+	}
+
+	void test_convert_copy() {
+		convertTestTemplate(11025, 11025, false);
+		convertTestTemplate(11025, 11025, true);
+	}
+
+	void test_convert_simple() {
+		convertTestTemplate(22050, 11025, false);
+		convertTestTemplate(22050, 11025, true);
+	}
+
+	void test_convert_interpolate() {
+		convertTestTemplate(11025, 48000, false);
+		convertTestTemplate(11025, 48000, true);
+	}
+};
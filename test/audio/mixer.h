@@ -0,0 +1,126 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/mixer_intern.h"
+#include "common/config-manager.h"
+
+#include "helper.h"
+#include "../null_osystem.h"
+
+class MixerTestSuite : public CxxTest::TestSuite {
+public:
+	void test_queued_settings() {
+		Audio::MixerImpl mixer(22050);
+		mixer.setReady(true);
+
+		Audio::SoundHandle handle;
+		((Audio::Mixer &)mixer).playStream(Audio::Mixer::kSFXSoundType, &handle, createSineStream<int16>(22050, 1, nullptr, false, false));
+
+		// Settings are queued, but never seen pending
+		mixer.setChannelVolume(handle, 100);
+		mixer.setChannelBalance(handle, -20);
+		TS_ASSERT_EQUALS(mixer.getChannelVolume(handle), 100);
+		TS_ASSERT_EQUALS(mixer.getChannelBalance(handle), -20);
+
+		// More than the queue holds
+		for (int i = 0; i < 1000; ++i)
+			mixer.setChannelVolume(handle, i & 0xFF);
+		TS_ASSERT_EQUALS(mixer.getChannelVolume(handle), 999 & 0xFF);
+
+		mixer.stopHandle(handle);
+		TS_ASSERT(!mixer.isSoundHandleActive(handle));
+		TS_ASSERT_EQUALS(mixer.getChannelVolume(handle), 0);
+	}
+
+	void test_output_latency() {
+		Audio::MixerImpl mixer(44100, true, 2048);
+		TS_ASSERT_EQUALS(((Audio::Mixer &)mixer).getOutputLatency(), 46u);
+
+		// The backend reopened its device with a smaller buffer
+		mixer.setOutputBufSize(512);
+		TS_ASSERT_EQUALS(mixer.getOutputBufSize(), 512u);
+		TS_ASSERT_EQUALS(((Audio::Mixer &)mixer).getOutputLatency(), 11u);
+
+		Audio::MixerImpl unknown(22050);
+		TS_ASSERT_EQUALS(((Audio::Mixer &)unknown).getOutputLatency(), 0u);
+	}
+
+	void test_paused_channel() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+
+		Audio::MixerImpl mixer(22050, false);
+		mixer.setReady(true);
+
+		Audio::SoundHandle handle;
+		((Audio::Mixer &)mixer).playStream(Audio::Mixer::kSFXSoundType, &handle, createSineStream<int16>(22050, 1, nullptr, false, false));
+
+		int16 buffer[256];
+		mixer.pauseHandle(handle, true);
+		TS_ASSERT_EQUALS(mixer.mixCallback((byte *)buffer, sizeof(buffer)), 0);
+
+		mixer.pauseHandle(handle, false);
+		TS_ASSERT_EQUALS(mixer.mixCallback((byte *)buffer, sizeof(buffer)), 256);
+#endif
+	}
+	void test_stats() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+
+		Audio::MixerImpl mixer(22050, false);
+		mixer.setReady(true);
+
+		Audio::SoundHandle handle;
+		((Audio::Mixer &)mixer).playStream(Audio::Mixer::kMusicSoundType, &handle, createSineStream<int16>(11025, 1, nullptr, false, false), 7);
+
+		int16 buffer[256];
+		mixer.mixCallback((byte *)buffer, sizeof(buffer));
+
+		// Nothing is counted until enabled
+		mixer.enableStats(true);
+		TS_ASSERT(mixer.isStatsEnabled());
+		mixer.mixCallback((byte *)buffer, sizeof(buffer));
+		mixer.mixCallback((byte *)buffer, sizeof(buffer));
+
+		Audio::MixerImpl::Stats stats;
+		mixer.getStats(stats);
+		TS_ASSERT_EQUALS(stats.callbacks, 2u);
+		TS_ASSERT_EQUALS(stats.samples, 512u);
+
+		uint32 histogramTotal = 0;
+		for (int i = 0; i < Audio::MixerImpl::kStatsHistogramSize; ++i)
+			histogramTotal += stats.histogram[i];
+		TS_ASSERT_EQUALS(histogramTotal, 2u);
+
+		TS_ASSERT_EQUALS(stats.channels.size(), 1u);
+		TS_ASSERT_EQUALS(stats.channels[0].id, 7);
+		TS_ASSERT_EQUALS(stats.channels[0].type, Audio::Mixer::kMusicSoundType);
+		TS_ASSERT_EQUALS(stats.channels[0].rate, 11025u);
+		TS_ASSERT_EQUALS(stats.channels[0].samples, 512u);
+
+		mixer.enableStats(false);
+		mixer.mixCallback((byte *)buffer, sizeof(buffer));
+		mixer.getStats(stats);
+		TS_ASSERT_EQUALS(stats.callbacks, 2u);
+#endif
+	}
+
+	void test_same_rate_skips_sinc() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+		ConfMan.set("resampler", "sinc", Common::ConfigManager::kTransientDomain);
+
+		Audio::MixerImpl mixer(22050, false);
+		mixer.setReady(true);
+
+		Audio::SoundHandle handle;
+		((Audio::Mixer &)mixer).playStream(Audio::Mixer::kSFXSoundType, &handle, createSineStream<int16>(22050, 1, nullptr, false, false));
+
+		// The sinc filter would delay the stream by 8 samples of silence
+		int16 buffer[16];
+		TS_ASSERT_EQUALS(mixer.mixCallback((byte *)buffer, sizeof(buffer)), 16);
+		TS_ASSERT_DIFFERS(buffer[4], 0);
+
+		ConfMan.removeKey("resampler", Common::ConfigManager::kTransientDomain);
+#endif
+	}
+};
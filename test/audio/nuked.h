@@ -0,0 +1,60 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/softsynth/opl/nuked.h"
+
+class NukedOPLTestSuite : public CxxTest::TestSuite {
+public:
+	void test_simd_matches_scalar() {
+#ifndef DISABLE_NUKED_OPL
+		OPL::NUKED::opl3_mixfunc mixfunc = OPL::NUKED::OPL3_GetSIMDMixFunc();
+		if (!mixfunc)
+			return;
+
+		OPL::NUKED::opl3_chip *scalar = new OPL::NUKED::opl3_chip();
+		OPL::NUKED::opl3_chip *simd = new OPL::NUKED::opl3_chip();
+		OPL3_Reset(scalar, 44100);
+		OPL3_Reset(simd, 44100);
+		simd->mixfunc = mixfunc;
+
+		uint32 seed = 12345;
+		int16 scalarOut[2 * 256];
+		int16 simdOut[2 * 256];
+		bool identical = true;
+		bool audible = false;
+
+		for (int block = 0; block < 200 && identical; ++block) {
+			// Random register writes, with OPL3 mode and the keys of a few
+			// channels forced on now and then so there is something to hear
+			for (int i = 0; i < 16; ++i) {
+				seed = seed * 1103515245 + 12345;
+				uint16 reg = (seed >> 8) % 0x200;
+				uint8 val = seed >> 24;
+				if ((block % 16) == 0 && i < 4) {
+					reg = 0x105;
+					val = 1;
+				} else if ((block % 8) == 0 && i < 6) {
+					reg = ((i & 1) ? 0x100 : 0) + 0xB0 + i;
+					val |= 0x20;
+				}
+
+				OPL3_WriteReg(scalar, reg, val);
+				OPL3_WriteReg(simd, reg, val);
+			}
+
+			OPL3_GenerateStream(scalar, scalarOut, 256);
+			OPL3_GenerateStream(simd, simdOut, 256);
+
+			for (int i = 0; i < 2 * 256; ++i) {
+				identical = identical && scalarOut[i] == simdOut[i];
+				audible = audible || scalarOut[i] != 0;
+			}
+		}
+
+		TS_ASSERT(identical);
+		TS_ASSERT(audible);
+
+		delete scalar;
+		delete simd;
+#endif
+	}
+};
@@ -0,0 +1,134 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/mixer.h"
+#include "audio/rate.h"
+
+#include "helper.h"
+
+class RateConverterTestSuite : public CxxTest::TestSuite {
+private:
+	// The linear interpolation of the general case, one sample at a time
+	static void interpolateReference(const int16 *in, int inFrames, bool stereo, int factor, int16 *out, int outFrames) {
+		const int step = 32768 / factor;
+		int lastL = 0, lastR = 0, curL = 0, curR = 0, pos = 32768, inPos = 0;
+
+		for (int i = 0; i < outFrames; ++i) {
+			while (pos >= 32768) {
+				lastL = curL;
+				lastR = curR;
+				curL = in[inPos * (stereo ? 2 : 1)];
+				curR = stereo ? in[inPos * 2 + 1] : curL;
+				inPos++;
+				pos -= 32768;
+			}
+			assert(inPos <= inFrames);
+
+			out[2 * i] = (int16)(lastL + (((curL - lastL) * pos + 16384) >> 15));
+			out[2 * i + 1] = (int16)(lastR + (((curR - lastR) * pos + 16384) >> 15));
+			pos += step;
+		}
+	}
+
+	void upsampleTestTemplate(int factor, bool stereo) {
+		const int inRate = 11025;
+		const int outFrames = 5000;
+
+		int16 *in;
+		Audio::SeekableAudioStream *s = createSineStream<int16>(inRate, 1, &in, false, stereo);
+		Audio::RateConverter *conv = Audio::makeRateConverter(inRate, inRate * factor, stereo, true, false);
+
+		int16 *out = new int16[outFrames * 2]();
+		int16 *expected = new int16[outFrames * 2];
+		interpolateReference(in, inRate, stereo, factor, expected, outFrames);
+
+		// Odd chunk sizes to stop in the middle of groups
+		int done = 0;
+		const int chunks[] = { 1, 7, 333, 2, 1000, 3 };
+		for (int i = 0; done < outFrames; i = (i + 1) % ARRAYSIZE(chunks)) {
+			const int len = MIN(chunks[i], outFrames - done);
+			TS_ASSERT_EQUALS(conv->convert(*s, out + done * 2, len, Audio::Mixer::kMaxMixerVolume, Audio::Mixer::kMaxMixerVolume), len);
+			done += len;
+		}
+		TS_ASSERT_EQUALS(memcmp(out, expected, outFrames * 2 * sizeof(int16)), 0);
+
+		delete[] in;
+		delete[] out;
+		delete[] expected;
+		delete conv;
+		delete s;
+	}
+
+	static Audio::SeekableAudioStream *makeConstantStream(int16 value, int frames, int rate) {
+		int16 *data = (int16 *)malloc(frames * sizeof(int16));
+		for (int i = 0; i < frames; ++i)
+			data[i] = value;
+		return Audio::makeRawStream((const byte *)data, frames * sizeof(int16), rate, Audio::FLAG_16BITS
+#ifdef SCUMM_LITTLE_ENDIAN
+				| Audio::FLAG_LITTLE_ENDIAN
+#endif
+				);
+	}
+
+public:
+	void test_upsample_2x() {
+		upsampleTestTemplate(2, false);
+		upsampleTestTemplate(2, true);
+	}
+
+	void test_upsample_4x() {
+		upsampleTestTemplate(4, false);
+		upsampleTestTemplate(4, true);
+	}
+
+	void test_sinc_dc() {
+		Audio::SeekableAudioStream *s = makeConstantStream(10000, 1000, 11025);
+		Audio::RateConverter *conv = Audio::makeRateConverter(11025, 48000, false, true, false, Audio::kResamplerSinc);
+
+		int16 out[2 * 2000] = {};
+		TS_ASSERT_EQUALS(conv->convert(*s, out, 2000, Audio::Mixer::kMaxMixerVolume, Audio::Mixer::kMaxMixerVolume), 2000);
+
+		// After the filter has filled up, a constant stays constant
+		for (int i = 200; i < 2000; ++i) {
+			TS_ASSERT_LESS_THAN_EQUALS(ABS(out[2 * i] - 10000), 2);
+			TS_ASSERT_EQUALS(out[2 * i], out[2 * i + 1]);
+		}
+
+		delete conv;
+		delete s;
+	}
+
+	void test_sinc_same_rate() {
+		int16 *in;
+		Audio::SeekableAudioStream *s = createSineStream<int16>(22050, 1, &in, false, false);
+		Audio::RateConverter *conv = Audio::makeRateConverter(22050, 22050, false, false, false, Audio::kResamplerSinc);
+
+		int16 out[1000] = {};
+		TS_ASSERT_EQUALS(conv->convert(*s, out, 1000, Audio::Mixer::kMaxMixerVolume, Audio::Mixer::kMaxMixerVolume), 1000);
+
+		// Passed through with the delay of the filter
+		for (int i = 0; i < 8; ++i)
+			TS_ASSERT_EQUALS(out[i], 0);
+		TS_ASSERT_EQUALS(memcmp(out + 8, in, (1000 - 8) * sizeof(int16)), 0);
+
+		delete[] in;
+		delete conv;
+		delete s;
+	}
+
+	void test_sinc_drain() {
+		Audio::SeekableAudioStream *s = makeConstantStream(5000, 100, 11025);
+		Audio::RateConverter *conv = Audio::makeRateConverter(11025, 22050, false, true, false, Audio::kResamplerSinc);
+
+		int16 out[2 * 400] = {};
+		int total = 0, res;
+		while ((res = conv->convert(*s, out, 400, Audio::Mixer::kMaxMixerVolume, Audio::Mixer::kMaxMixerVolume)) > 0)
+			total += res;
+
+		// The input plus the 8 samples of silence flushing the filter
+		TS_ASSERT_EQUALS(total, (100 + 8) * 2);
+		TS_ASSERT(!conv->needsDraining());
+
+		delete conv;
+		delete s;
+	}
+};
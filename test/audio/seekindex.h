@@ -0,0 +1,68 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/decoders/seekindex.h"
+
+class SeekIndexTestSuite : public CxxTest::TestSuite {
+public:
+	void test_find() {
+		Audio::SeekIndex::clear();
+		Audio::SeekIndex::add("file", 0, 100, 1000);
+		Audio::SeekIndex::add("file", 2000, 900, 1000);
+		Audio::SeekIndex::add("file", 1000, 500, 1000);
+
+		uint64 sample;
+		int64 offset;
+		TS_ASSERT(Audio::SeekIndex::find("file", 1500, sample, offset));
+		TS_ASSERT_EQUALS(sample, 1000u);
+		TS_ASSERT_EQUALS(offset, 500);
+
+		TS_ASSERT(Audio::SeekIndex::find("file", 2000, sample, offset));
+		TS_ASSERT_EQUALS(sample, 2000u);
+		TS_ASSERT_EQUALS(offset, 900);
+
+		TS_ASSERT(!Audio::SeekIndex::find("other", 1500, sample, offset));
+	}
+
+	void test_spacing() {
+		Audio::SeekIndex::clear();
+		Audio::SeekIndex::add("file", 1000, 500, 1000);
+		// Too close to the existing point on either side
+		Audio::SeekIndex::add("file", 1500, 700, 1000);
+		Audio::SeekIndex::add("file", 600, 300, 1000);
+
+		uint64 sample;
+		int64 offset;
+		TS_ASSERT(Audio::SeekIndex::find("file", 1999, sample, offset));
+		TS_ASSERT_EQUALS(sample, 1000u);
+		TS_ASSERT(!Audio::SeekIndex::find("file", 999, sample, offset));
+	}
+
+	void test_remove() {
+		Audio::SeekIndex::clear();
+		Audio::SeekIndex::add("file", 0, 100, 1000);
+		Audio::SeekIndex::add("file", 1000, 500, 1000);
+		Audio::SeekIndex::remove("file", 1000);
+
+		uint64 sample;
+		int64 offset;
+		TS_ASSERT(Audio::SeekIndex::find("file", 1500, sample, offset));
+		TS_ASSERT_EQUALS(sample, 0u);
+		TS_ASSERT_EQUALS(offset, 100);
+	}
+
+	void test_eviction() {
+		Audio::SeekIndex::clear();
+		for (int i = 0; i < 100; ++i)
+			Audio::SeekIndex::add(Common::String::format("file%d", i), 0, i, 1);
+
+		uint64 sample;
+		int64 offset;
+		// The oldest files were forgotten
+		TS_ASSERT(!Audio::SeekIndex::find("file0", 0, sample, offset));
+		TS_ASSERT(Audio::SeekIndex::find("file99", 0, sample, offset));
+		TS_ASSERT_EQUALS(offset, 99);
+
+		Audio::SeekIndex::clear();
+		TS_ASSERT(!Audio::SeekIndex::find("file99", 0, sample, offset));
+	}
+};
@@ -0,0 +1,125 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/arena.h"
+
+struct ArenaTracked {
+	ArenaTracked(int value, int *destroyed) : _value(value), _destroyed(destroyed) {}
+	~ArenaTracked() { *_destroyed = *_destroyed * 10 + _value; }
+
+	int _value;
+	int *_destroyed;
+};
+
+class ArenaTestSuite : public CxxTest::TestSuite {
+public:
+	void test_alignment() {
+		Common::Arena arena(256);
+
+		arena.allocate(1, 1);
+		void *p = arena.allocate(8, 16);
+		TS_ASSERT_EQUALS((uintptr)p & 15, 0u);
+
+		arena.allocate(3, 1);
+		double *d = arena.allocateArray<double>(4);
+		TS_ASSERT_EQUALS((uintptr)d % alignof(double), 0u);
+
+		TS_ASSERT_EQUALS(arena.getBytesUsed(), 1u + 8 + 3 + 4 * sizeof(double));
+	}
+
+	void test_big_allocations() {
+		Common::Arena arena(64);
+
+		byte *small = (byte *)arena.allocate(16);
+		byte *big = (byte *)arena.allocate(1000);
+		memset(big, 0xAB, 1000);
+		memset(small, 0xCD, 16);
+		TS_ASSERT_EQUALS(big[999], 0xAB);
+		TS_ASSERT_EQUALS(small[0], 0xCD);
+		TS_ASSERT(arena.getBytesReserved() >= 1064u);
+	}
+
+	void test_reset_merges_blocks() {
+		Common::Arena arena(64);
+
+		for (int i = 0; i < 10; ++i)
+			arena.allocate(48);
+		size_t reserved = arena.getBytesReserved();
+
+		arena.reset();
+		TS_ASSERT_EQUALS(arena.getBytesUsed(), 0u);
+		TS_ASSERT_EQUALS(arena.getBytesReserved(), reserved);
+
+		// The same workload now fits without growing
+		for (int i = 0; i < 10; ++i)
+			arena.allocate(48);
+		TS_ASSERT_EQUALS(arena.getBytesReserved(), reserved);
+	}
+
+	void test_destructors_run_on_reset() {
+		Common::Arena arena;
+		int destroyed = 0;
+
+		ArenaTracked *a = arena.create<ArenaTracked>(1, &destroyed);
+		arena.create<ArenaTracked>(2, &destroyed);
+		arena.create<ArenaTracked>(3, &destroyed);
+		TS_ASSERT_EQUALS(a->_value, 1);
+		TS_ASSERT_EQUALS(destroyed, 0);
+
+		arena.reset();
+		// Reverse order of creation
+		TS_ASSERT_EQUALS(destroyed, 321);
+
+		arena.reset();
+		TS_ASSERT_EQUALS(destroyed, 321);
+	}
+
+	void test_copy_string() {
+		Common::Arena arena;
+
+		const char *str = arena.copyString(Common::String("hello"));
+		const char *part = arena.copyString("world!", 5);
+		TS_ASSERT_EQUALS(Common::String(str), "hello");
+		TS_ASSERT_EQUALS(Common::String(part), "world");
+	}
+
+	void test_frame_allocator() {
+		Common::FrameAllocator frames(128);
+
+		int *first = (int *)frames.allocate(sizeof(int), alignof(int));
+		*first = 42;
+
+		frames.nextFrame();
+		frames.allocate(64);
+		// Data of the previous frame is still alive
+		TS_ASSERT_EQUALS(*first, 42);
+		TS_ASSERT_EQUALS(frames.previous().getBytesUsed(), sizeof(int));
+
+		frames.nextFrame();
+		TS_ASSERT_EQUALS(frames.current().getBytesUsed(), 0u);
+		TS_ASSERT_EQUALS(frames.previous().getBytesUsed(), 64u);
+	}
+
+	void test_arena_array() {
+		Common::Arena arena(64);
+		Common::ArenaArray<Common::String> array(arena);
+
+		for (int i = 0; i < 100; ++i)
+			array.push_back(Common::String::format("%d", i));
+		array.emplace_back("last");
+
+		TS_ASSERT_EQUALS(array.size(), 101u);
+		TS_ASSERT_EQUALS(array[0], "0");
+		TS_ASSERT_EQUALS(array[99], "99");
+		TS_ASSERT_EQUALS(array[100], "last");
+
+		int count = 0;
+		for (Common::ArenaArray<Common::String>::const_iterator i = array.begin(); i != array.end(); ++i)
+			count++;
+		TS_ASSERT_EQUALS(count, 101);
+
+		array.pop_back();
+		TS_ASSERT_EQUALS(array.size(), 100u);
+		array.clear();
+		TS_ASSERT(array.empty());
+	}
+};
@@ -517,6 +517,122 @@ class ArrayTestSuite : public CxxTest::TestSuite
 		TS_ASSERT_EQUALS(array2[2], 17);
 	}
 
+	void test_insert_in_reserved_space() {
+		Common::Array<Common::String> array;
+		array.reserve(8);
+		array.push_back("a");
+		array.push_back("c");
+		const Common::String *storage = array.data();
+
+		array.insert(array.begin() + 1, Common::String("b"));
+		array.insert_at(0, array[2]);
+
+		// No reallocation took place
+		TS_ASSERT_EQUALS(array.data(), storage);
+		TS_ASSERT_EQUALS(array.size(), 4u);
+		TS_ASSERT_EQUALS(array[0], "c");
+		TS_ASSERT_EQUALS(array[1], "a");
+		TS_ASSERT_EQUALS(array[2], "b");
+		TS_ASSERT_EQUALS(array[3], "c");
+	}
+
+	void test_insert_move() {
+		Common::Array<ArrayTestMovable> array;
+		array.push_back(ArrayTestMovable(1));
+		array.push_back(ArrayTestMovable(3));
+
+		ArrayTestMovable movable(2);
+		array.insert_at(1, Common::move(movable));
+
+		TS_ASSERT(movable._wasMovedFrom);
+		TS_ASSERT_EQUALS(array[0]._value, 1);
+		TS_ASSERT_EQUALS(array[1]._value, 2);
+		TS_ASSERT_EQUALS(array[2]._value, 3);
+		TS_ASSERT(array[2]._wasMoveConstructed);
+	}
+
+};
+
+class SmallArrayTestSuite : public CxxTest::TestSuite {
+public:
+	void test_inline_storage() {
+		Common::SmallArray<int, 4> array;
+		TS_ASSERT(array.empty());
+
+		for (int i = 0; i < 4; ++i)
+			array.push_back(i);
+		TS_ASSERT(array.isInline());
+
+		array.push_back(4);
+		TS_ASSERT(!array.isInline());
+		TS_ASSERT_EQUALS(array.size(), 5u);
+		for (int i = 0; i < 5; ++i)
+			TS_ASSERT_EQUALS(array[i], i);
+	}
+
+	void test_insert_remove() {
+		Common::SmallArray<Common::String, 2> array = { "a", "c" };
+
+		array.insert_at(1, "b");
+		array.insert_at(3, "d");
+		TS_ASSERT_EQUALS(array.size(), 4u);
+		TS_ASSERT_EQUALS(array.front(), "a");
+		TS_ASSERT_EQUALS(array[1], "b");
+		TS_ASSERT_EQUALS(array[2], "c");
+		TS_ASSERT_EQUALS(array.back(), "d");
+
+		TS_ASSERT_EQUALS(array.remove_at(0), "a");
+		array.erase(array.begin() + 1);
+		TS_ASSERT_EQUALS(array.size(), 2u);
+		TS_ASSERT_EQUALS(array[0], "b");
+		TS_ASSERT_EQUALS(array[1], "d");
+
+		array.pop_back();
+		TS_ASSERT_EQUALS(array.size(), 1u);
+	}
+
+	void test_copy_move() {
+		Common::SmallArray<Common::String, 2> small = { "x" };
+		Common::SmallArray<Common::String, 2> big = { "a", "b", "c" };
+
+		Common::SmallArray<Common::String, 2> smallCopy(small);
+		Common::SmallArray<Common::String, 2> bigCopy(big);
+		TS_ASSERT_EQUALS(smallCopy[0], "x");
+		TS_ASSERT_EQUALS(bigCopy.size(), 3u);
+		TS_ASSERT_EQUALS(bigCopy[2], "c");
+
+		const Common::String *bigStorage = big.data();
+		Common::SmallArray<Common::String, 2> moved(Common::move(big));
+		TS_ASSERT_EQUALS(moved.data(), bigStorage);
+		TS_ASSERT(big.empty());
+		TS_ASSERT(big.isInline());
+
+		moved = Common::move(small);
+		TS_ASSERT(moved.isInline());
+		TS_ASSERT_EQUALS(moved.size(), 1u);
+		TS_ASSERT_EQUALS(moved[0], "x");
+
+		moved = bigCopy;
+		TS_ASSERT_EQUALS(moved.size(), 3u);
+		TS_ASSERT_EQUALS(moved[1], "b");
+	}
+
+	void test_resize() {
+		Common::SmallArray<int, 8> array;
+		array.resize(3);
+		TS_ASSERT_EQUALS(array.size(), 3u);
+		TS_ASSERT_EQUALS(array[2], 0);
+
+		array.resize(20);
+		TS_ASSERT(!array.isInline());
+		array.resize(1);
+		TS_ASSERT_EQUALS(array.size(), 1u);
+
+		int count = 0;
+		for (Common::SmallArray<int, 8>::const_iterator i = array.begin(); i != array.end(); ++i)
+			count++;
+		TS_ASSERT_EQUALS(count, 1);
+	}
 };
 
 struct ListElement {
@@ -255,4 +255,42 @@ public:
 		tmpl_align_16<Common::MemoryReadStream, Common::BitStream16BELSB>();
 		tmpl_align_16<Common::BitStreamMemoryStream, Common::BitStreamMemory16BELSB>();
 	}
+
+private:
+	template<class BS, class BSM>
+	void tmpl_memory_refill() {
+		byte contents[67];
+		for (uint i = 0; i < sizeof(contents); ++i)
+			contents[i] = (byte)(i * 37 + 11);
+
+		Common::MemoryReadStream ms(contents, sizeof(contents));
+		Common::BitStreamMemoryStream bms(contents, sizeof(contents));
+
+		BS bs(ms);
+		BSM bsm(bms);
+
+		// The memory stream refills 64 bits at a time, which must not
+		// change what is read
+		uint n = 1;
+		while (!bs.eos()) {
+			TS_ASSERT_EQUALS(bsm.peekBits(n), bs.peekBits(n));
+			TS_ASSERT_EQUALS(bsm.getBits(n), bs.getBits(n));
+			TS_ASSERT_EQUALS(bsm.pos(), bs.pos());
+			n = n % 32 + 1;
+		}
+		TS_ASSERT(bsm.eos());
+	}
+public:
+	void test_memory_refill() {
+		tmpl_memory_refill<Common::BitStream8MSB, Common::BitStreamMemory8MSB>();
+		tmpl_memory_refill<Common::BitStream8LSB, Common::BitStreamMemory8LSB>();
+		tmpl_memory_refill<Common::BitStream16LEMSB, Common::BitStreamMemory16LEMSB>();
+		tmpl_memory_refill<Common::BitStream16LELSB, Common::BitStreamMemory16LELSB>();
+		tmpl_memory_refill<Common::BitStream16BEMSB, Common::BitStreamMemory16BEMSB>();
+		tmpl_memory_refill<Common::BitStream16BELSB, Common::BitStreamMemory16BELSB>();
+		tmpl_memory_refill<Common::BitStream32LEMSB, Common::BitStreamMemory32LEMSB>();
+		tmpl_memory_refill<Common::BitStream32LELSB, Common::BitStreamMemory32LELSB>();
+		tmpl_memory_refill<Common::BitStream32BEMSB, Common::BitStreamMemory32BEMSB>();
+		tmpl_memory_refill<Common::BitStream32BELSB, Common::BitStreamMemory32BELSB>();
+	}
 };
@@ -0,0 +1,98 @@
+#include <cxxtest/TestSuite.h>
+#include "common/compression/dcl.h"
+#include "common/memstream.h"
+
+/**
+ * A test suite for the PKWARE DCL decompressor in common/compression/dcl.h
+ */
+class DCLTestSuite : public CxxTest::TestSuite {
+	/** Appends bits to a buffer in the least significant bit first order DCL uses. */
+	struct BitWriterLSB {
+		Common::Array<byte> data;
+		uint32 bits;
+		int count;
+
+		BitWriterLSB() : bits(0), count(0) {}
+
+		void put(uint32 value, int n) {
+			for (int i = 0; i < n; i++) {
+				bits |= ((value >> i) & 1) << count;
+				if (++count == 8)
+					flush();
+			}
+		}
+
+		void flush() {
+			if (count) {
+				data.push_back(bits);
+				bits = 0;
+				count = 0;
+			}
+		}
+	};
+
+	public:
+	void test_known_stream() {
+		// The example of the format description by Ben Rudiak-Gould
+		const byte packed[] = { 0x00, 0x04, 0x82, 0x24, 0x25, 0x8f, 0x80, 0x7f };
+		byte unpacked[13];
+
+		Common::MemoryReadStream stream(packed, sizeof(packed));
+		TS_ASSERT(Common::decompressDCL(&stream, unpacked, sizeof(packed), sizeof(unpacked)));
+		TS_ASSERT_EQUALS(memcmp(unpacked, "AIAIAIAIAIAIA", sizeof(unpacked)), 0);
+
+		Common::MemoryReadStream dynamicStream(packed, sizeof(packed));
+		Common::SeekableReadStream *result = Common::decompressDCL(&dynamicStream);
+		TS_ASSERT(result != nullptr);
+		if (result) {
+			TS_ASSERT_EQUALS(result->size(), 13);
+			delete result;
+		}
+	}
+
+	void test_literals_and_copies() {
+		// Binary mode with a 1024 byte dictionary: every byte is a literal and
+		// the stream ends with a pair with the longest length
+		BitWriterLSB writer;
+		writer.put(0, 8);
+		writer.put(4, 8);
+		for (int i = 0; i < 256; i++) {
+			writer.put(0, 1);
+			writer.put(i, 8);
+		}
+		// Copy 3 bytes from 255 bytes back: the length code is 1 (bits 1, 1)
+		// and the distance 254 is the code 15 (bits 0, 1, 0, 1, 1, 1)
+		// followed by the four low bits
+		writer.put(1, 1);
+		writer.put(0x3, 2);
+		writer.put(0x3A, 6);
+		writer.put(14, 4);
+		writer.put(1, 1);
+		// The end of stream is the length 519, code 15 (seven 0 bits) and 255
+		writer.put(0, 7);
+		writer.put(0xFF, 8);
+		writer.flush();
+
+		Common::MemoryReadStream stream(writer.data.data(), writer.data.size());
+		Common::SeekableReadStream *result = Common::decompressDCL(&stream);
+		TS_ASSERT(result != nullptr);
+		if (!result)
+			return;
+
+		TS_ASSERT_EQUALS(result->size(), 259);
+		for (int i = 0; i < 256; i++)
+			TS_ASSERT_EQUALS(result->readByte(), i);
+		TS_ASSERT_EQUALS(result->readByte(), 1);
+		TS_ASSERT_EQUALS(result->readByte(), 2);
+		TS_ASSERT_EQUALS(result->readByte(), 3);
+		delete result;
+	}
+
+	void test_invalid_header() {
+		const byte packed[] = { 0x02, 0x04, 0x00, 0x00 };
+		byte unpacked[4];
+
+		Common::MemoryReadStream stream(packed, sizeof(packed));
+		TS_ASSERT(!Common::decompressDCL(&stream, unpacked, sizeof(packed), sizeof(unpacked)));
+	}
+};
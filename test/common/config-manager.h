@@ -0,0 +1,42 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/config-manager.h"
+
+class ConfigManagerTestSuite : public CxxTest::TestSuite {
+public:
+	void tearDown() {
+		ConfMan.removeKey("test_binding_int", Common::ConfigManager::kTransientDomain);
+		ConfMan.removeKey("test_binding_bool", Common::ConfigManager::kTransientDomain);
+		ConfMan.removeKey("test_binding_int", Common::ConfigManager::kApplicationDomain);
+	}
+
+	void test_bind_int() {
+		ConfMan.registerDefault("test_binding_int", 3);
+		Common::ConfigManager::IntBinding binding = ConfMan.bindInt("test_binding_int");
+		TS_ASSERT_EQUALS(binding.get(), 3);
+		TS_ASSERT_EQUALS(binding.getKey(), "test_binding_int");
+
+		ConfMan.setInt("test_binding_int", 0x10, Common::ConfigManager::kApplicationDomain);
+		TS_ASSERT_EQUALS(binding.get(), 16);
+
+		// The transient domain takes priority, like it does for get()
+		ConfMan.set("test_binding_int", "-4", Common::ConfigManager::kTransientDomain);
+		TS_ASSERT_EQUALS(binding.get(), -4);
+
+		ConfMan.getDomain(Common::ConfigManager::kTransientDomain)->erase("test_binding_int");
+		TS_ASSERT_EQUALS(binding.get(), 16);
+	}
+
+	void test_bind_bool() {
+		Common::ConfigManager::BoolBinding binding = ConfMan.bindBool("test_binding_bool");
+		ConfMan.setBool("test_binding_bool", true, Common::ConfigManager::kTransientDomain);
+		TS_ASSERT(binding);
+
+		ConfMan.getDomain(Common::ConfigManager::kTransientDomain)->setVal("test_binding_bool", "no");
+		TS_ASSERT(!binding);
+
+		Common::ConfigManager::BoolBinding copy;
+		copy = binding;
+		TS_ASSERT(!copy.get());
+	}
+};
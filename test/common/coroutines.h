@@ -0,0 +1,44 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/coroutines.h"
+
+class CoroutinesTestSuite : public CxxTest::TestSuite {
+	struct SmallContext : Common::CoroBaseContext {
+		SmallContext() : Common::CoroBaseContext("small"), value(0) {}
+		int value;
+	};
+
+	struct LargeContext : Common::CoroBaseContext {
+		LargeContext() : Common::CoroBaseContext("large") {}
+		byte data[1024];
+	};
+
+public:
+	void test_context_pool() {
+		Common::CoroContext ctx = new SmallContext();
+		void *first = ctx;
+		delete ctx;
+
+		// A freed context is reused for the next one of the same size
+		ctx = new SmallContext();
+		TS_ASSERT_EQUALS((void *)ctx, first);
+
+		// Sub contexts are deleted with their parent
+		ctx->_subctx = new SmallContext();
+		void *sub = ctx->_subctx;
+		delete ctx;
+		ctx = new SmallContext();
+		Common::CoroContext other = new SmallContext();
+		TS_ASSERT((void *)ctx == first || (void *)ctx == sub);
+		TS_ASSERT((void *)other == first || (void *)other == sub);
+
+		// Large contexts are not pooled but still work
+		Common::CoroContext large = new LargeContext();
+		TS_ASSERT_DIFFERS((void *)large, first);
+		delete large;
+
+		delete other;
+		delete ctx;
+		Common::CoroBaseContext::freePool();
+	}
+};
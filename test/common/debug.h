@@ -0,0 +1,97 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/debug.h"
+#include "common/debug-channels.h"
+#include "common/log.h"
+#include "common/str.h"
+
+static Common::String s_debugOutput;
+
+static void debugTestLogWatcher(LogMessageType::Type type, int level, uint32 debugChannel, const char *message) {
+	if (type == LogMessageType::kDebug)
+		s_debugOutput += message;
+}
+
+class DebugTestSuite : public CxxTest::TestSuite {
+	// Far from the engine and global channels, bit 13 of the filter
+	static const uint32 kTestChannel = 77;
+
+	int _oldDebugLevel;
+
+public:
+	void setUp() {
+		_oldDebugLevel = gDebugLevel;
+		s_debugOutput.clear();
+		Common::setLogWatcher(debugTestLogWatcher);
+	}
+
+	void tearDown() {
+		Common::setLogWatcher(nullptr);
+		gDebugLevel = _oldDebugLevel;
+	}
+
+	void test_channel_filter() {
+		gDebugLevel = 1;
+		DebugMan.addDebugChannel(kTestChannel, "debugtest", "Test channel");
+
+		int evaluated = 0;
+		TS_ASSERT(!debugCEnabled(kTestChannel, ""));
+		TS_ASSERT(!DebugMan.isDebugChannelEnabled(kTestChannel));
+		debugC(1, kTestChannel, "%d", ++evaluated);
+		debugC(kTestChannel, "%d", ++evaluated);
+		TS_ASSERT_EQUALS(evaluated, 0);
+		TS_ASSERT(s_debugOutput.empty());
+
+		DebugMan.enableDebugChannel(kTestChannel);
+		TS_ASSERT(debugCEnabled(1, kTestChannel));
+		TS_ASSERT(!debugCEnabled(2, kTestChannel));
+		TS_ASSERT(DebugMan.isDebugChannelEnabled(kTestChannel));
+		debugC(1, kTestChannel, "%d", ++evaluated);
+		debugCN(kTestChannel, "%d", ++evaluated);
+		TS_ASSERT_EQUALS(evaluated, 2);
+		TS_ASSERT_EQUALS(s_debugOutput, "1\n2");
+
+		DebugMan.disableDebugChannel(kTestChannel);
+		TS_ASSERT(!debugCEnabled(kTestChannel, ""));
+		DebugMan.removeAllDebugChannels();
+	}
+
+	void test_deferred() {
+		enableDeferredDebug(true);
+
+		debug("%d %5.2f %s %c %x%%", -42, 3.14159, "abc", 'z', 255u);
+		debugN("%*d|%-4s|%lld|%lu", 4, 7, "ab", -5000000000LL, 12ul);
+		TS_ASSERT(s_debugOutput.empty());
+
+		flushDeferredDebug();
+		TS_ASSERT_EQUALS(s_debugOutput, "-42  3.14 abc z ff%\n   7|ab  |-5000000000|12");
+
+		enableDeferredDebug(false);
+	}
+
+	void test_deferred_copies_strings() {
+		enableDeferredDebug(true);
+
+		char buffer[8] = "before";
+		debug("[%s]", buffer);
+		Common::strcpy_s(buffer, "after");
+		debug("[%s]", (const char *)nullptr);
+
+		flushDeferredDebug();
+		TS_ASSERT_EQUALS(s_debugOutput, "[before]\n[(null)]\n");
+
+		enableDeferredDebug(false);
+	}
+
+	void test_deferred_disable_flushes() {
+		enableDeferredDebug(true);
+		debug("pending");
+		TS_ASSERT(s_debugOutput.empty());
+
+		enableDeferredDebug(false);
+		TS_ASSERT_EQUALS(s_debugOutput, "pending\n");
+
+		debug("direct");
+		TS_ASSERT_EQUALS(s_debugOutput, "pending\ndirect\n");
+	}
+};
@@ -271,4 +271,47 @@ public:
 		result = Common::U32String((const char *) utf8_2, sizeof(utf8_2)-1, Common::kUtf8).encode(Common::kISO8859_2);
 		TS_ASSERT_EQUALS(memcmp(result.c_str(), iso_8859_2, sizeof(iso_8859_2)), 0);
 	}
+
+	void test_ascii_runs() {
+		// Long ASCII runs around multibyte characters, at every alignment
+		// and with a sequence truncated at the end
+		for (uint prefix = 0; prefix < 20; prefix++) {
+			Common::String utf8;
+			Common::U32String utf32;
+			for (uint i = 0; i < prefix; i++) {
+				utf8 += (char)('a' + i);
+				utf32 += (Common::u32char_type_t)('a' + i);
+			}
+
+			utf8 += "\xC3\x96" "0123456789abcdefghij" "\xE2\x82\xAC" "xyz" "\xE2\x98\x83" "klmnopqrstuvw";
+			utf32 += (Common::u32char_type_t)0xD6;
+			utf32 += Common::U32String("0123456789abcdefghij");
+			utf32 += (Common::u32char_type_t)0x20AC;
+			utf32 += Common::U32String("xyz");
+			utf32 += (Common::u32char_type_t)0x2603;
+			utf32 += Common::U32String("klmnopqrstuvw");
+
+			Common::U32String decoded = utf8.decode(Common::kUtf8);
+			TS_ASSERT_EQUALS(decoded, utf32);
+			TS_ASSERT_EQUALS(decoded.encode(Common::kUtf8), utf8);
+
+			Common::String truncated = utf8 + "\xF0\x9F\x98";
+			TS_ASSERT_EQUALS(truncated.decode(Common::kUtf8), utf32);
+
+			Common::U32String astral = utf32 + Common::U32String((Common::u32char_type_t)0x1F600);
+			TS_ASSERT_EQUALS(astral.encode(Common::kUtf8), utf8 + "\xF0\x9F\x98\x80");
+
+			// The euro sign is 0x80 in Windows-1252, the snowman is not there
+			Common::String cp1252 = utf32.encode(Common::kWindows1252);
+			TS_ASSERT_EQUALS(cp1252.size(), utf32.size());
+			TS_ASSERT_EQUALS(cp1252[prefix], (char)0xD6);
+			TS_ASSERT_EQUALS(cp1252[prefix + 21], (char)0x80);
+			TS_ASSERT_EQUALS(cp1252[prefix + 25], '?');
+
+			Common::U32String roundTrip = cp1252.decode(Common::kWindows1252);
+			TS_ASSERT_EQUALS(roundTrip.size(), utf32.size());
+			TS_ASSERT_EQUALS(roundTrip[prefix + 21], (Common::u32char_type_t)0x20AC);
+			TS_ASSERT_EQUALS(roundTrip.encode(Common::kUtf8).substr(prefix + 29), "klmnopqrstuvw");
+		}
+	}
 };
@@ -0,0 +1,134 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/flathashmap.h"
+#include "common/hash-str.h"
+#include "common/str.h"
+
+class FlatHashMapTestSuite : public CxxTest::TestSuite
+{
+	public:
+	void test_empty_clear() {
+		Common::FlatHashMap<int, int> container;
+		TS_ASSERT(container.empty());
+		container[0] = 17;
+		container[1] = 33;
+		TS_ASSERT(!container.empty());
+		container.clear();
+		TS_ASSERT(container.empty());
+
+		Common::FlatHashMap<Common::String, Common::String> container2;
+		TS_ASSERT(container2.empty());
+		container2["foo"] = "bar";
+		container2["quux"] = "blub";
+		TS_ASSERT(!container2.empty());
+		container2.clear(true);
+		TS_ASSERT(container2.empty());
+	}
+
+	void test_contains() {
+		Common::FlatHashMap<int, int> container;
+		container[0] = 17;
+		container[1] = 33;
+		TS_ASSERT(container.contains(0));
+		TS_ASSERT(container.contains(1));
+		TS_ASSERT(!container.contains(17));
+		TS_ASSERT(!container.contains(-1));
+
+		Common::FlatHashMap<Common::String, Common::String, Common::IgnoreCase_Hash, Common::IgnoreCase_EqualTo> container2;
+		container2["foo"] = "bar";
+		container2["quux"] = "blub";
+		TS_ASSERT(container2.contains("FOO"));
+		TS_ASSERT(container2.contains("quux"));
+		TS_ASSERT(!container2.contains("bar"));
+		TS_ASSERT(!container2.contains("asdf"));
+	}
+
+	void test_lookup() {
+		Common::FlatHashMap<int, int> container;
+		container[0] = 17;
+		container[1] = -1;
+		container.setVal(2, 45);
+
+		TS_ASSERT_EQUALS(container[0], 17);
+		TS_ASSERT_EQUALS(container[1], -1);
+		TS_ASSERT_EQUALS(container.getVal(2), 45);
+
+		const Common::FlatHashMap<int, int> &containerRef = container;
+		TS_ASSERT_EQUALS(containerRef.getValOrDefault(0), 17);
+		TS_ASSERT_EQUALS(containerRef.getValOrDefault(17), 0);
+		TS_ASSERT_EQUALS(containerRef.getValOrDefault(17, -10), -10);
+
+		int out = 0;
+		TS_ASSERT(containerRef.tryGetVal(1, out));
+		TS_ASSERT_EQUALS(out, -1);
+		TS_ASSERT(!containerRef.tryGetVal(5, out));
+	}
+
+	void test_collision() {
+		// All of these share their home slot in the initial table
+		Common::FlatHashMap<int, int> h;
+		h[5] = 1;
+		h[16+5] = 2;
+		h[32+5] = 3;
+		h[6] = 4;
+		h[48+5] = 5;
+		TS_ASSERT_EQUALS(h.size(), 5u);
+		TS_ASSERT_EQUALS(h[6], 4);
+		h.erase(16+5);
+		TS_ASSERT(h.contains(5));
+		TS_ASSERT(!h.contains(16+5));
+		TS_ASSERT_EQUALS(h[32+5], 3);
+		TS_ASSERT_EQUALS(h[48+5], 5);
+		TS_ASSERT_EQUALS(h[6], 4);
+		h.erase(5);
+		h.erase(32+5);
+		h.erase(48+5);
+		TS_ASSERT_EQUALS(h[6], 4);
+		h.erase(6);
+		TS_ASSERT(h.empty());
+	}
+
+	void test_grow_and_erase() {
+		Common::FlatHashMap<int, int> h;
+		for (int i = 0; i < 1000; i++)
+			h[i * 7] = i;
+		TS_ASSERT_EQUALS(h.size(), 1000u);
+		for (int i = 0; i < 1000; i += 2)
+			h.erase(i * 7);
+		TS_ASSERT_EQUALS(h.size(), 500u);
+		for (int i = 0; i < 1000; i++)
+			TS_ASSERT_EQUALS(h.contains(i * 7), (i & 1) != 0);
+	}
+
+	void test_iterator() {
+		Common::FlatHashMap<int, Common::String> container;
+		container[0] = "a";
+		container[2] = "b";
+		container[3] = "c";
+		container[4] = "d";
+		container.erase(container.find(0));
+
+		int found = 0;
+		for (Common::FlatHashMap<int, Common::String>::const_iterator i = container.begin(); i != container.end(); ++i) {
+			int key = i->_key;
+			TS_ASSERT(key >= 0 && key <= 4);
+			TS_ASSERT(!(found & (1 << key)));
+			found |= 1 << key;
+		}
+		TS_ASSERT_EQUALS(found, 16+8+4);
+		TS_ASSERT_EQUALS(container.find(1), container.end());
+	}
+
+	void test_copy() {
+		Common::FlatHashMap<Common::String, int> map1, map2;
+		map1["one"] = 1;
+		map1["two"] = 2;
+		map2 = map1;
+		map1.clear();
+		TS_ASSERT_EQUALS(map2.size(), 2u);
+		TS_ASSERT_EQUALS(map2["two"], 2);
+
+		Common::FlatHashMap<Common::String, int> map3(map2);
+		TS_ASSERT_EQUALS(map3["one"], 1);
+	}
+};
@@ -27,6 +27,9 @@ static const byte VALID_MHDR_DATA[] = { // a 'correct' quicktime file with a hea
 
 class QuickTimeTestParser : public Common::QuickTimeParser {
 public:
+	typedef Common::QuickTimeParser::TimeToSampleEntry TestTimeToSampleEntry;
+	typedef Common::QuickTimeParser::SampleToChunkEntry TestSampleToChunkEntry;
+
 	uint32 getDuration() const { return _duration; }
 	const Common::Rational &getScaleFactorX() const { return _scaleFactorX; }
 	const Common::Rational &getScaleFactorY() const { return _scaleFactorY; }
@@ -80,4 +83,46 @@ public:
 		TS_ASSERT(!result);
 	}
 
+	void test_sampleIndex() {
+		// Two chunks of 3 and 2 samples, the second sample description in
+		// the second chunk, two different frame durations and keyframes 0, 3
+		Common::QuickTimeParser::Track track;
+		track.chunkCount = 2;
+		track.chunkOffsets = new uint32[2] { 100, 1000 };
+		track.sampleToChunkCount = 2;
+		track.sampleToChunk = new QuickTimeTestParser::TestSampleToChunkEntry[2] { { 0, 3, 1 }, { 1, 2, 2 } };
+		track.timeToSampleCount = 2;
+		track.timeToSample = new QuickTimeTestParser::TestTimeToSampleEntry[2] { { 2, 10 }, { 3, 20 } };
+		track.sampleCount = 5;
+		track.sampleSizes = new uint32[5] { 5, 6, 7, 8, 9 };
+		track.keyframeCount = 2;
+		track.keyframes = new uint32[2] { 0, 3 };
+
+		track.buildSampleIndex();
+		TS_ASSERT_EQUALS(track.sampleIndex.size(), 5u);
+
+		static const uint32 offsets[] = { 100, 105, 111, 1000, 1008 };
+		static const uint32 times[] = { 0, 10, 20, 40, 60 };
+		static const uint32 keyframes[] = { 0, 0, 0, 3, 3 };
+		for (uint32 i = 0; i < track.sampleIndex.size(); i++) {
+			TS_ASSERT_EQUALS(track.sampleIndex[i].offset, offsets[i]);
+			TS_ASSERT_EQUALS(track.sampleIndex[i].size, track.sampleSizes[i]);
+			TS_ASSERT_EQUALS(track.sampleIndex[i].time, times[i]);
+			TS_ASSERT_EQUALS(track.sampleIndex[i].duration, i < 2 ? 10u : 20u);
+			TS_ASSERT_EQUALS(track.sampleIndex[i].descId, i < 3 ? 1u : 2u);
+			TS_ASSERT_EQUALS(track.sampleIndex[i].keyframe, keyframes[i]);
+		}
+
+		TS_ASSERT_EQUALS(track.findSampleAtTime(0), 0u);
+		TS_ASSERT_EQUALS(track.findSampleAtTime(9), 0u);
+		TS_ASSERT_EQUALS(track.findSampleAtTime(10), 1u);
+		TS_ASSERT_EQUALS(track.findSampleAtTime(45), 3u);
+		TS_ASSERT_EQUALS(track.findSampleAtTime(79), 4u);
+		TS_ASSERT_EQUALS(track.findSampleAtTime(80), 5u);
+
+		// Tables disagreeing on the sample count leave the index empty
+		track.timeToSample[1].count = 4;
+		track.buildSampleIndex();
+		TS_ASSERT(track.sampleIndex.empty());
+	}
 };
@@ -0,0 +1,79 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/formats/xmlparser.h"
+
+#include "../../null_osystem.h"
+
+class XMLTestParser : public Common::XMLParser {
+public:
+	XMLTestParser() : _items(0) {}
+
+	int _items;
+	Common::String _lastName;
+	Common::String _text;
+
+protected:
+	CUSTOM_XML_PARSER(XMLTestParser) {
+		XML_KEY(list)
+			XML_KEY(item)
+				XML_PROP(name, true)
+				XML_PROP(size, false)
+			KEY_END()
+		KEY_END()
+	} PARSER_END()
+
+	bool parserCallback_list(ParserNode *node) { return true; }
+
+	bool parserCallback_item(ParserNode *node) {
+		_items++;
+		_lastName = node->values["name"];
+		return true;
+	}
+
+	bool textCallback(const Common::String &val) override {
+		_text += val;
+		return true;
+	}
+};
+
+class XMLParserTestSuite : public CxxTest::TestSuite {
+	bool parse(XMLTestParser &parser, const char *xml) {
+		if (!parser.loadBuffer((const byte *)xml, strlen(xml)))
+			return false;
+		bool result = parser.parse();
+		parser.close();
+		return result;
+	}
+
+public:
+	void test_properties() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+
+		XMLTestParser valid;
+		TS_ASSERT(parse(valid, "<?xml version = '1.0'?><list><item name='a'/><item NAME='b' size='2'/></list>"));
+		TS_ASSERT_EQUALS(valid._items, 2);
+		TS_ASSERT_EQUALS(valid._lastName, "b");
+
+		XMLTestParser spaces;
+		TS_ASSERT(parse(spaces, "<?xml version = '1.0'?>\n<!-- items -->\n<list>\n\t<item name = \"a b\" />\n</list>\n"));
+		TS_ASSERT_EQUALS(spaces._items, 1);
+		TS_ASSERT_EQUALS(spaces._lastName, "a b");
+
+		XMLTestParser text;
+		text.setAllowText();
+		TS_ASSERT(parse(text, "<?xml version = '1.0'?><list>one<item name='a'/>two</list>"));
+		TS_ASSERT_EQUALS(text._text, "onetwo");
+
+		// A required property is missing
+		XMLTestParser missing;
+		TS_ASSERT(!parse(missing, "<?xml version = '1.0'?><list><item size='2'/></list>"));
+		TS_ASSERT_EQUALS(missing._items, 0);
+
+		// An unknown property
+		XMLTestParser unknown;
+		TS_ASSERT(!parse(unknown, "<?xml version = '1.0'?><list><item name='a' color='red'/></list>"));
+		TS_ASSERT_EQUALS(unknown._items, 0);
+#endif
+	}
+};
@@ -1,6 +1,7 @@
 #include <cxxtest/TestSuite.h>
 
 #include "common/hashmap.h"
+#include "common/flathashmap.h"
 #include "common/hash-str.h"
 
 class HashMapTestSuite : public CxxTest::TestSuite
@@ -230,5 +231,37 @@ class HashMapTestSuite : public CxxTest::TestSuite
 		TS_ASSERT(found == 16+8+4);
 }
 
+	template<class Map>
+	uint runWorkload(Map &map) {
+		// A mix of inserts, hits, misses and erasures, as in a resource table
+		uint checksum = 0;
+		uint seed = 12345;
+		for (int i = 0; i < 20000; i++) {
+			seed = seed * 1103515245 + 12345;
+			uint key = (seed >> 8) % 4096;
+			switch (seed % 4) {
+			case 0:
+				map[key] = i;
+				break;
+			case 1:
+				map.erase(key);
+				break;
+			default:
+				checksum = checksum * 31 + map.getValOrDefault(key, 0xFFFF);
+				break;
+			}
+		}
+		return checksum + map.size();
+	}
+
+	void test_flat_hash_map_workload() {
+		// FlatHashMap is meant as a drop-in replacement in hot paths,
+		// make sure it behaves the same on a mixed workload
+		Common::HashMap<uint, uint> map;
+		Common::FlatHashMap<uint, uint> flatMap;
+		TS_ASSERT_EQUALS(runWorkload(map), runWorkload(flatMap));
+		TS_ASSERT_EQUALS(map.size(), flatMap.size());
+	}
+
 	// TODO: Add test cases for iterators, find, ...
 };
@@ -0,0 +1,59 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/formats/json.h"
+
+class JSONTestSuite : public CxxTest::TestSuite {
+public:
+	void test_parse() {
+		Common::JSONValue *value = Common::JSON::parse(" { \"name\" : \"a\\tb\\u00e9\", \"list\": [1, -2.5, true, null, {}], \"n\": 1, \"n\": 2 } ");
+		TS_ASSERT(value != nullptr);
+		if (!value)
+			return;
+
+		TS_ASSERT(value->isObject());
+		TS_ASSERT_EQUALS(value->countChildren(), 3U);
+		TS_ASSERT_EQUALS(value->child("name")->asString(), "a\tb\xc3\xa9");
+		// The last of the duplicated names wins
+		TS_ASSERT_EQUALS(value->child("n")->asIntegerNumber(), 2);
+
+		const Common::JSONArray &list = value->child("list")->asArray();
+		TS_ASSERT_EQUALS(list.size(), 5U);
+		TS_ASSERT_EQUALS(list[0]->asIntegerNumber(), 1);
+		TS_ASSERT_EQUALS(list[1]->asNumber(), -2.5);
+		TS_ASSERT(list[2]->asBool());
+		TS_ASSERT(list[3]->isNull());
+		TS_ASSERT(list[4]->isObject());
+
+		delete value;
+	}
+
+	void test_parse_errors() {
+		TS_ASSERT(Common::JSON::parse("") == nullptr);
+		TS_ASSERT(Common::JSON::parse("[1, 2") == nullptr);
+		TS_ASSERT(Common::JSON::parse("{\"a\": \"b}") == nullptr);
+		TS_ASSERT(Common::JSON::parse("{\"a\" 1}") == nullptr);
+		TS_ASSERT(Common::JSON::parse("[\"a\nb\"]") == nullptr);
+		TS_ASSERT(Common::JSON::parse("[1] 2") == nullptr);
+	}
+
+	void test_stringify() {
+		Common::JSONArray list;
+		list.push_back(new Common::JSONValue((long long int)1));
+		list.push_back(new Common::JSONValue((long long int)2));
+		Common::JSONObject object;
+		object.setVal("a", new Common::JSONValue(list));
+		Common::JSONValue value(object);
+
+		TS_ASSERT_EQUALS(value.stringify(), "{\"a\":[1,2]}");
+		TS_ASSERT_EQUALS(value.stringify(true), "{\n  \"a\":[\n    1,2\n  ]\n}");
+
+		Common::JSONValue text(Common::String("\"q\"/\n\xc3\xa9"));
+		TS_ASSERT_EQUALS(text.stringify(), "\"\\\"q\\\"\\/\\n\\u00e9\"");
+
+		Common::JSONValue *parsed = Common::JSON::parse(value.stringify(true).c_str());
+		TS_ASSERT(parsed != nullptr);
+		if (parsed)
+			TS_ASSERT_EQUALS(parsed->stringify(), "{\"a\":[1,2]}");
+		delete parsed;
+	}
+};
@@ -0,0 +1,54 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/lockfree-queue.h"
+
+class LockFreeQueueTestSuite : public CxxTest::TestSuite {
+public:
+	void test_push_pop() {
+		Common::LockFreeQueue<int, 4> queue;
+		int value = 0;
+
+		TS_ASSERT(queue.empty());
+		TS_ASSERT(!queue.pop(value));
+
+		TS_ASSERT(queue.push(1));
+		TS_ASSERT(queue.push(2));
+		TS_ASSERT(!queue.empty());
+
+		TS_ASSERT(queue.pop(value));
+		TS_ASSERT_EQUALS(value, 1);
+		TS_ASSERT(queue.pop(value));
+		TS_ASSERT_EQUALS(value, 2);
+		TS_ASSERT(queue.empty());
+	}
+
+	void test_full() {
+		Common::LockFreeQueue<int, 4> queue;
+		int value = 0;
+
+		for (int i = 0; i < 4; ++i)
+			TS_ASSERT(queue.push(i));
+		TS_ASSERT(!queue.push(4));
+
+		TS_ASSERT(queue.pop(value));
+		TS_ASSERT_EQUALS(value, 0);
+		TS_ASSERT(queue.push(4));
+		TS_ASSERT(!queue.push(5));
+	}
+
+	void test_wrap_around() {
+		Common::LockFreeQueue<int, 4> queue;
+		int value = 0;
+
+		// Many laps around the ring, in order
+		for (int i = 0; i < 100; ++i) {
+			TS_ASSERT(queue.push(2 * i));
+			TS_ASSERT(queue.push(2 * i + 1));
+			TS_ASSERT(queue.pop(value));
+			TS_ASSERT_EQUALS(value, 2 * i);
+			TS_ASSERT(queue.pop(value));
+			TS_ASSERT_EQUALS(value, 2 * i + 1);
+		}
+		TS_ASSERT(queue.empty());
+	}
+};
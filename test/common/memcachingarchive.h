@@ -0,0 +1,100 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/archive.h"
+#include "common/stream.h"
+
+class TestMemcachingArchive : public Common::MemcachingCaseInsensitiveArchive {
+public:
+	TestMemcachingArchive(uint32 maxStronglyCachedSize, uint32 strongCacheBudget) :
+		Common::MemcachingCaseInsensitiveArchive(maxStronglyCachedSize, strongCacheBudget), reads(0) {}
+
+	bool hasFile(const Common::Path &path) const override { return true; }
+	int listMembers(Common::ArchiveMemberList &list) const override { return 0; }
+	const Common::ArchiveMemberPtr getMember(const Common::Path &path) const override { return Common::ArchiveMemberPtr(); }
+
+	Common::SharedArchiveContents readContentsForPath(const Common::Path &translatedPath) const override {
+		reads++;
+		// Member size is given by the length of its name
+		uint32 size = translatedPath.toString().size();
+		byte *data = new byte[size];
+		memset(data, 'x', size);
+		return Common::SharedArchiveContents(data, size);
+	}
+
+	mutable int reads;
+};
+
+class MemcachingArchiveTestSuite : public CxxTest::TestSuite {
+	void open(TestMemcachingArchive &archive, const char *name) {
+		delete archive.createReadStreamForMember(Common::Path(name));
+	}
+
+public:
+	void test_hits_and_misses() {
+		TestMemcachingArchive archive(16, 0);
+
+		open(archive, "aaaa");
+		open(archive, "aaaa");
+		open(archive, "bbbb");
+
+		TS_ASSERT_EQUALS(archive.reads, 2);
+		TS_ASSERT_EQUALS(archive.getCacheStats().hits, 1u);
+		TS_ASSERT_EQUALS(archive.getCacheStats().misses, 2u);
+		TS_ASSERT_EQUALS(archive.getCacheStats().strongBytes, 8u);
+	}
+
+	void test_big_members_are_not_kept() {
+		TestMemcachingArchive archive(4, 0);
+
+		open(archive, "aaaaaaaa");
+		open(archive, "aaaaaaaa");
+
+		TS_ASSERT_EQUALS(archive.reads, 2);
+		TS_ASSERT_EQUALS(archive.getCacheStats().strongBytes, 0u);
+	}
+
+	void test_lru_eviction() {
+		TestMemcachingArchive archive(16, 8);
+
+		open(archive, "aaaa");
+		open(archive, "bbbb");
+		// Touch "aaaa" so "bbbb" becomes the least recently used
+		open(archive, "aaaa");
+		open(archive, "cccc");
+
+		TS_ASSERT_EQUALS(archive.getCacheStats().evictions, 1u);
+		TS_ASSERT_EQUALS(archive.getCacheStats().strongBytes, 8u);
+
+		int reads = archive.reads;
+		open(archive, "aaaa");
+		open(archive, "cccc");
+		TS_ASSERT_EQUALS(archive.reads, reads);
+
+		open(archive, "bbbb");
+		TS_ASSERT_EQUALS(archive.reads, reads + 1);
+	}
+
+	void test_live_streams_survive_eviction() {
+		TestMemcachingArchive archive(16, 4);
+
+		Common::SeekableReadStream *stream = archive.createReadStreamForMember(Common::Path("aaaa"));
+		open(archive, "bbbb");
+		TS_ASSERT_EQUALS(archive.getCacheStats().evictions, 1u);
+
+		TS_ASSERT_EQUALS(stream->size(), 4);
+		TS_ASSERT_EQUALS(stream->readByte(), 'x');
+		delete stream;
+	}
+
+	void test_set_cache_policy() {
+		TestMemcachingArchive archive(16, 0);
+
+		open(archive, "aaaa");
+		open(archive, "bbbb");
+		open(archive, "cccccccc");
+
+		archive.setCachePolicy(4, 4);
+		TS_ASSERT_EQUALS(archive.getCacheStats().strongBytes, 4u);
+		TS_ASSERT_EQUALS(archive.getStrongCacheBudget(), 4u);
+	}
+};
@@ -60,4 +60,28 @@ public:
 
 		TS_ASSERT_EQUALS(memcmp(expected, step3, sizeof(expected)), 0);
 	}
+
+	void test_swap_bytes() {
+		// Long enough for the SIMD paths, with an odd tail
+		uint16 data16[37];
+		uint32 data32[23];
+		for (uint i = 0; i < ARRAYSIZE(data16); ++i)
+			data16[i] = (uint16)(0x0102 + i * 0x0303);
+		for (uint i = 0; i < ARRAYSIZE(data32); ++i)
+			data32[i] = 0x01020304 + i * 0x05050505;
+
+		Common::swapBytes16(data16, ARRAYSIZE(data16));
+		Common::swapBytes32(data32, ARRAYSIZE(data32));
+
+		for (uint i = 0; i < ARRAYSIZE(data16); ++i)
+			TS_ASSERT_EQUALS(data16[i], SWAP_BYTES_16((uint16)(0x0102 + i * 0x0303)));
+		for (uint i = 0; i < ARRAYSIZE(data32); ++i)
+			TS_ASSERT_EQUALS(data32[i], SWAP_BYTES_32(0x01020304 + i * 0x05050505));
+
+		// Short buffers take the scalar path
+		uint16 short16[3] = { 0x1234, 0x5678, 0x9ABC };
+		Common::swapBytes16(short16, 3);
+		TS_ASSERT_EQUALS(short16[0], 0x3412);
+		TS_ASSERT_EQUALS(short16[2], 0xBC9A);
+	}
 };
@@ -467,6 +467,34 @@ class PathTestSuite : public CxxTest::TestSuite
 		TS_ASSERT_EQUALS(map.size(), 3u);
 	}
 
+	void test_hashIgnoreCase_cache() {
+		Common::Path p("dir/file");
+		Common::Path lower("dir/file.txt");
+		uint hash = p.hashIgnoreCase();
+
+		// Copies keep the cached hash, in place modifications drop it
+		Common::Path copy(p);
+		TS_ASSERT_EQUALS(copy.hashIgnoreCase(), hash);
+		copy.appendInPlace(".txt");
+		TS_ASSERT_EQUALS(copy.hashIgnoreCase(), lower.hashIgnoreCase());
+
+		copy = p;
+		TS_ASSERT_EQUALS(copy.hashIgnoreCase(), hash);
+		copy.toUppercase();
+		TS_ASSERT_EQUALS(copy.hashIgnoreCase(), hash);
+		copy.joinInPlace("FILE.TXT");
+		TS_ASSERT_EQUALS(copy.hashIgnoreCase(), Common::Path("dir/file/file.txt").hashIgnoreCase());
+
+		TS_ASSERT_EQUALS(p.appendComponent("x").hashIgnoreCase(), Common::Path("dir/file/x").hashIgnoreCase());
+
+		copy = p;
+		copy.set("other");
+		TS_ASSERT_EQUALS(copy.hashIgnoreCase(), Common::Path("other").hashIgnoreCase());
+
+		copy.clear();
+		TS_ASSERT_EQUALS(copy.hashIgnoreCase(), Common::Path().hashIgnoreCase());
+	}
+
 	void test_casesensitive() {
 		Common::Path p2("parent:dir:Sound Manager 3.1 / SoundLib:Sound", ':');
 		Common::Path p3("parent:dir:sound manager 3.1 / soundlib:sound", ':');
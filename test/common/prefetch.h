@@ -0,0 +1,83 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/archive.h"
+#include "common/memstream.h"
+
+class TestPrefetchRequest : public Common::PrefetchRequest {
+public:
+	TestPrefetchRequest(uint32 size) : _size(size), _opened(0) {}
+
+	uint32 _size;
+	int _opened;
+
+protected:
+	Common::SeekableReadStream *open() override {
+		_opened++;
+		byte *data = (byte *)malloc(_size);
+		for (uint32 i = 0; i < _size; ++i)
+			data[i] = i & 0xFF;
+		return new Common::MemoryReadStream(data, _size, DisposeAfterUse::YES);
+	}
+};
+
+class PrefetchTestSuite : public CxxTest::TestSuite {
+public:
+	void test_background_read() {
+		// Three chunks
+		TestPrefetchRequest request(150 * 1024);
+		request.queue();
+		TS_ASSERT_EQUALS(request.getState(), Common::PrefetchRequest::kStateQueued);
+
+		TS_ASSERT(Common::PrefetchRequest::processQueue(2));
+		TS_ASSERT_EQUALS(request.getState(), Common::PrefetchRequest::kStateQueued);
+		TS_ASSERT(!Common::PrefetchRequest::processQueue(1));
+		TS_ASSERT_EQUALS(request.getState(), Common::PrefetchRequest::kStateDone);
+
+		Common::SeekableReadStream *stream = request.takeStream();
+		TS_ASSERT(stream);
+		TS_ASSERT_EQUALS(stream->size(), 150 * 1024);
+		stream->seek(1000);
+		TS_ASSERT_EQUALS(stream->readByte(), 1000 & 0xFF);
+		delete stream;
+
+		TS_ASSERT_EQUALS(request._opened, 1);
+		TS_ASSERT_EQUALS(request.getState(), Common::PrefetchRequest::kStateCancelled);
+		TS_ASSERT(!request.takeStream());
+	}
+
+	void test_take_before_done() {
+		TestPrefetchRequest request(100 * 1024);
+		request.queue();
+		Common::PrefetchRequest::processQueue(1);
+
+		// The rest is read right away
+		Common::SeekableReadStream *stream = request.takeStream();
+		TS_ASSERT(stream);
+		TS_ASSERT_EQUALS(stream->size(), 100 * 1024);
+		stream->seek(-1, SEEK_END);
+		TS_ASSERT_EQUALS(stream->readByte(), (100 * 1024 - 1) & 0xFF);
+		delete stream;
+
+		TS_ASSERT(!Common::PrefetchRequest::processQueue(1));
+	}
+
+	void test_cancel() {
+		TestPrefetchRequest first(16);
+		TestPrefetchRequest second(16);
+		first.queue();
+		second.queue();
+
+		Common::PrefetchHandle handle(Common::SharedPtr<Common::PrefetchRequest>(new TestPrefetchRequest(16)));
+		TS_ASSERT(handle.isValid());
+		TS_ASSERT(!handle.isDone());
+
+		first.cancel();
+		TS_ASSERT(!Common::PrefetchRequest::processQueue(4));
+		TS_ASSERT_EQUALS(first._opened, 0);
+		TS_ASSERT_EQUALS(second._opened, 1);
+		TS_ASSERT(!first.takeStream());
+
+		handle.cancel();
+		TS_ASSERT(!Common::PrefetchHandle().isValid());
+	}
+};
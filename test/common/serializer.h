@@ -1,5 +1,6 @@
 #include <cxxtest/TestSuite.h>
 
+#include "common/memstream.h"
 #include "common/serializer.h"
 #include "common/stream.h"
 
@@ -108,4 +109,63 @@ public:
 	void test_read_v2_as_v2() {
 		readVersioned_v2(_inStreamV2, 2);
 	}
+
+	void test_sync_array_as() {
+		int32 values[300];
+		int16 shorts[300];
+		for (int i = 0; i < 300; i++) {
+			values[i] = i * 70001 - 5000000;
+			shorts[i] = (int16)(i * 217 - 30000);
+		}
+
+		// Write the arrays in bulk, and the same data element by element
+		Common::MemoryWriteStreamDynamic bulk(DisposeAfterUse::YES);
+		Common::Serializer bulkSaver(nullptr, &bulk);
+		bulkSaver.syncArrayAsSint32LE(values, 300);
+		bulkSaver.syncArrayAsSint32BE(values, 300);
+		bulkSaver.syncArrayAsSint16LE(values, 300);
+		bulkSaver.syncArrayAsUint16BE(shorts, 300);
+		bulkSaver.syncArrayAsByte(shorts, 300);
+		bulkSaver.syncArrayAsSint32LE(values, 300, 1);
+
+		Common::MemoryWriteStreamDynamic single(DisposeAfterUse::YES);
+		Common::Serializer singleSaver(nullptr, &single);
+		for (int i = 0; i < 300; i++)
+			singleSaver.syncAsSint32LE(values[i]);
+		for (int i = 0; i < 300; i++)
+			singleSaver.syncAsSint32BE(values[i]);
+		for (int i = 0; i < 300; i++)
+			singleSaver.syncAsSint16LE(values[i]);
+		for (int i = 0; i < 300; i++)
+			singleSaver.syncAsUint16BE(shorts[i]);
+		for (int i = 0; i < 300; i++)
+			singleSaver.syncAsByte(shorts[i]);
+
+		TS_ASSERT_EQUALS(bulkSaver.bytesSynced(), singleSaver.bytesSynced());
+		TS_ASSERT_EQUALS(bulk.size(), single.size());
+		TS_ASSERT(memcmp(bulk.getData(), single.getData(), single.size()) == 0);
+
+		// Read it back
+		Common::MemoryReadStream stream(bulk.getData(), bulk.size());
+		Common::Serializer loader(&stream, nullptr);
+		int32 loaded[300];
+		int16 loadedShorts[300];
+		int32 loadedShortsSigned[300];
+
+		loader.syncArrayAsSint32LE(loaded, 300);
+		TS_ASSERT(memcmp(loaded, values, sizeof(values)) == 0);
+		memset(loaded, 0, sizeof(loaded));
+		loader.syncArrayAsSint32BE(loaded, 300);
+		TS_ASSERT(memcmp(loaded, values, sizeof(values)) == 0);
+		loader.syncArrayAsSint16LE(loadedShortsSigned, 300);
+		loader.syncArrayAsUint16BE(loadedShorts, 300);
+		TS_ASSERT(memcmp(loadedShorts, shorts, sizeof(shorts)) == 0);
+		for (int i = 0; i < 300; i++)
+			TS_ASSERT_EQUALS(loadedShortsSigned[i], (int16)values[i]);
+		loader.syncArrayAsByte(loadedShorts, 300);
+		for (int i = 0; i < 300; i++)
+			TS_ASSERT_EQUALS(loadedShorts[i], (byte)shorts[i]);
+		TS_ASSERT(stream.pos() == stream.size());
+		TS_ASSERT_EQUALS(loader.bytesSynced(), singleSaver.bytesSynced());
+	}
 };
@@ -1,6 +1,7 @@
 #include <cxxtest/TestSuite.h>
 
 #include "common/str.h"
+#include "common/str-builder.h"
 #include "common/ustr.h"
 
 #include "test/common/str-helper.h"
@@ -745,4 +746,47 @@ class StringTestSuite : public CxxTest::TestSuite
 		TS_ASSERT(a > c);
 		TS_ASSERT(c < a);
 	}
+
+	void test_concat_temporaries() {
+		Common::String a("a string which does not fit in the builtin storage");
+		Common::String b = Common::String(a) + " and some more" + '!' + Common::String(" and more");
+		TS_ASSERT_EQUALS(b, "a string which does not fit in the builtin storage and some more! and more");
+		TS_ASSERT_EQUALS(a, "a string which does not fit in the builtin storage");
+
+		Common::U32String u = Common::U32String("abc") + Common::U32String("def") + (Common::u32char_type_t)'g';
+		TS_ASSERT_EQUALS(u, Common::U32String("abcdefg"));
+	}
+
+	void test_reserve() {
+		Common::String str("shared");
+		Common::String copy(str);
+		str.reserve(100);
+		const char *storage = str.c_str();
+		for (int i = 0; i < 90; ++i)
+			str += 'x';
+		TS_ASSERT_EQUALS(str.c_str(), storage);
+		TS_ASSERT_EQUALS(copy, "shared");
+	}
+
+	void test_string_builder() {
+		Common::StringBuilder builder(8);
+		builder.append("foo").append(Common::String("bar")).append('-').append("bazqux", 3);
+		builder += "!";
+		TS_ASSERT_EQUALS(builder.size(), 11u);
+		TS_ASSERT_EQUALS(Common::String(builder.c_str()), "foobar-baz!");
+
+		Common::String result = builder.finish();
+		TS_ASSERT_EQUALS(result, "foobar-baz!");
+		TS_ASSERT(builder.empty());
+
+		for (int i = 0; i < 1000; ++i)
+			builder.append('a' + i % 26);
+		result = builder.finish();
+		TS_ASSERT_EQUALS(result.size(), 1000u);
+		TS_ASSERT_EQUALS(result[999], 'a' + 999 % 26);
+
+		Common::U32StringBuilder ubuilder;
+		ubuilder.append(Common::U32String("abc")).append((Common::u32char_type_t)'d');
+		TS_ASSERT_EQUALS(ubuilder.finish(), Common::U32String("abcd"));
+	}
 };
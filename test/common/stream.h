@@ -43,4 +43,31 @@ class ReadLineStreamTestSuite : public CxxTest::TestSuite {
 
 		TS_ASSERT(ms.eos());
 	}
+
+	void test_read_arrays() {
+		byte contents[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+		Common::MemoryReadStream ms(contents, sizeof(contents));
+
+		uint16 words[4];
+		TS_ASSERT_EQUALS(ms.readUint16LEArray(words, 2), 2u);
+		TS_ASSERT_EQUALS(words[0], 0x0201);
+		TS_ASSERT_EQUALS(words[1], 0x0403);
+		TS_ASSERT_EQUALS(ms.readUint16BEArray(words, 2), 2u);
+		TS_ASSERT_EQUALS(words[0], 0x0506);
+		TS_ASSERT_EQUALS(words[1], 0x0708);
+
+		ms.seek(0);
+		uint32 dwords[3];
+		TS_ASSERT_EQUALS(ms.readUint32LEArray(dwords, 1), 1u);
+		TS_ASSERT_EQUALS(dwords[0], 0x04030201u);
+		TS_ASSERT_EQUALS(ms.readUint32BEArray(dwords, 1), 1u);
+		TS_ASSERT_EQUALS(dwords[0], 0x05060708u);
+
+		// Only one byte is left
+		ms.seek(-3, SEEK_END);
+		int16 samples[2];
+		TS_ASSERT_EQUALS(ms.readSint16BEArray(samples, 2), 1u);
+		TS_ASSERT_EQUALS(samples[0], 0x0708);
+		TS_ASSERT(ms.eos());
+	}
 };
@@ -0,0 +1,80 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/threadpool.h"
+
+/** Runs the jobs backwards on the calling thread, pretending to have several threads. */
+class ReverseThreadPool : public Common::ThreadPoolInternal {
+public:
+	ReverseThreadPool(uint numThreads) : _numThreads(numThreads), _runs(0) {}
+
+	uint getNumThreads() const override { return _numThreads; }
+
+	void run(Common::Job *const *jobs, uint count) override {
+		_runs++;
+		for (uint i = count; i > 0; i--)
+			jobs[i - 1]->run();
+	}
+
+	uint _numThreads;
+	uint _runs;
+};
+
+struct RangeCounter {
+	Common::Array<int> *counts;
+	uint *calls;
+
+	void operator()(uint first, uint last) const {
+		(*calls)++;
+		for (uint i = first; i < last; i++)
+			(*counts)[i]++;
+	}
+};
+
+class ThreadPoolTestSuite : public CxxTest::TestSuite {
+public:
+	void test_parallel_for() {
+		ReverseThreadPool *internal = new ReverseThreadPool(4);
+		Common::ThreadPool pool(internal);
+		TS_ASSERT_EQUALS(pool.getNumThreads(), 4U);
+
+		Common::Array<int> counts;
+		counts.resize(103);
+		uint calls = 0;
+		RangeCounter counter = { &counts, &calls };
+
+		// Every index is visited exactly once, in one range per thread
+		pool.parallelFor(0, 103, counter);
+		TS_ASSERT_EQUALS(calls, 4U);
+		TS_ASSERT_EQUALS(internal->_runs, 1U);
+		for (uint i = 0; i < counts.size(); i++)
+			TS_ASSERT_EQUALS(counts[i], 1);
+
+		// Ranges too small to split run inline
+		calls = 0;
+		pool.parallelFor(10, 20, counter, 8);
+		TS_ASSERT_EQUALS(calls, 1U);
+		TS_ASSERT_EQUALS(internal->_runs, 1U);
+		TS_ASSERT_EQUALS(counts[9], 1);
+		TS_ASSERT_EQUALS(counts[10], 2);
+		TS_ASSERT_EQUALS(counts[19], 2);
+		TS_ASSERT_EQUALS(counts[20], 1);
+
+		pool.parallelFor(5, 5, counter);
+		TS_ASSERT_EQUALS(calls, 1U);
+	}
+
+	void test_inline() {
+		Common::ThreadPool pool(nullptr);
+		TS_ASSERT_EQUALS(pool.getNumThreads(), 1U);
+
+		Common::Array<int> counts;
+		counts.resize(16);
+		uint calls = 0;
+		RangeCounter counter = { &counts, &calls };
+
+		pool.parallelFor(0, 16, counter);
+		TS_ASSERT_EQUALS(calls, 1U);
+		for (uint i = 0; i < counts.size(); i++)
+			TS_ASSERT_EQUALS(counts[i], 1);
+	}
+};
@@ -0,0 +1,93 @@
+#include <cxxtest/TestSuite.h>
+
+#include "backends/timer/default/default-timer.h"
+
+/** A timer manager running on a clock the test advances. */
+class TestTimerManager : public DefaultTimerManager {
+public:
+	TestTimerManager() : now(1000000) {}
+
+	uint64 now;
+
+protected:
+	uint64 getMicros() override { return now; }
+};
+
+struct TimerLog {
+	TestTimerManager *manager;
+	Common::String calls;
+	Common::TimerManager::TimerProc removeProc;
+};
+
+static void timerProcA(void *refCon) {
+	TimerLog *log = (TimerLog *)refCon;
+	log->calls += 'A';
+	// Taking a while
+	log->manager->now += 500;
+}
+
+static void timerProcB(void *refCon) {
+	TimerLog *log = (TimerLog *)refCon;
+	log->calls += 'B';
+	if (log->removeProc)
+		log->manager->removeTimerProc(log->removeProc);
+}
+
+class TimerTestSuite : public CxxTest::TestSuite {
+public:
+	void test_order() {
+		TestTimerManager manager;
+		TimerLog log = { &manager, "", nullptr };
+
+		TS_ASSERT_EQUALS(manager.handler(), 0xFFFFFFFFU);
+
+		manager.installTimerProc(timerProcA, 3000, &log, "A");
+		manager.installTimerProc(timerProcB, 2000, &log, "B");
+		TS_ASSERT_EQUALS(manager.handler(), 2U);
+		TS_ASSERT_EQUALS(log.calls, "");
+
+		// Late timers catch up in order, and A taking a while makes it
+		// run once more
+		manager.now += 6000;
+		TS_ASSERT_EQUALS(manager.handler(), 1U);
+		TS_ASSERT_EQUALS(log.calls, "BABAB");
+
+		Common::Array<Common::TimerManager::TimerStats> stats;
+		manager.getTimerStats(stats);
+		TS_ASSERT_EQUALS(stats.size(), 2U);
+		for (uint i = 0; i < stats.size(); ++i) {
+			if (stats[i].id == "A") {
+				TS_ASSERT_EQUALS(stats[i].calls, 2U);
+				TS_ASSERT_EQUALS(stats[i].totalTime, 1000U);
+				TS_ASSERT_EQUALS(stats[i].maxTime, 500U);
+				TS_ASSERT_EQUALS(stats[i].overruns, 1U);
+			} else {
+				TS_ASSERT_EQUALS(stats[i].id, "B");
+				TS_ASSERT_EQUALS(stats[i].calls, 3U);
+				TS_ASSERT_EQUALS(stats[i].interval, 2000U);
+				TS_ASSERT_EQUALS(stats[i].overruns, 2U);
+			}
+		}
+	}
+
+	void test_remove() {
+		TestTimerManager manager;
+		TimerLog log = { &manager, "", nullptr };
+
+		manager.installTimerProc(timerProcA, 1000, &log, "A");
+		manager.installTimerProc(timerProcB, 1000, &log, "B");
+		manager.removeTimerProc(timerProcA);
+		manager.now += 1000;
+		manager.handler();
+		TS_ASSERT_EQUALS(log.calls, "B");
+
+		// A callback removing itself
+		log.removeProc = timerProcB;
+		manager.now += 1000;
+		TS_ASSERT_EQUALS(manager.handler(), 0xFFFFFFFFU);
+		TS_ASSERT_EQUALS(log.calls, "BB");
+
+		// The names are free again
+		TS_ASSERT(manager.installTimerProc(timerProcA, 1000, &log, "B"));
+	}
+};
@@ -0,0 +1,197 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/random.h"
+#include "common/textconsole.h"
+#include "graphics/blit.h"
+#include "graphics/pixelformat.h"
+
+#include "../null_osystem.h"
+#include "test/instrset_detect.h"
+
+/**
+ * Pick a kernel set if both the build and the CPU have it.
+ */
+static bool useCrossBlitKernels(Graphics::BlitKernelSet set) {
+#ifdef SCUMMVM_SSE2
+	if (set == Graphics::kBlitKernelsSSE2 && instrset_detect() < 2)
+		return false;
+	if (set == Graphics::kBlitKernelsAVX2 && instrset_detect() < 8)
+		return false;
+#endif
+	return Graphics::setBlitKernels(set);
+}
+
+static const Graphics::BlitKernelSet allCrossBlitKernels[] = {
+	Graphics::kBlitKernelsSSE2, Graphics::kBlitKernelsAVX2, Graphics::kBlitKernelsNEON
+};
+
+static const char *const crossBlitKernelNames[] = { "SSE2", "AVX2", "NEON" };
+
+static const Graphics::PixelFormat crossBlitFormats[] = {
+	Graphics::PixelFormat(2, 5, 5, 5, 0, 10, 5, 0, 0),  // RGB555
+	Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0),  // RGB565
+	Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24), // ARGB8888
+	Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0), // RGBA8888
+	Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24), // ABGR8888
+	Graphics::PixelFormat(4, 8, 8, 8, 0, 16, 8, 0, 0)   // XRGB8888
+};
+
+class CrossBlitKernelsTestSuite : public CxxTest::TestSuite {
+private:
+	// Rows are padded so that writes past the end of a row show up
+	static const uint kWidth = 45;
+	static const uint kHeight = 3;
+	static const uint kPitchPad = 8;
+
+	void fillRandom(byte *buf, uint size, Common::RandomSource &rnd) {
+		for (uint i = 0; i < size; ++i)
+			buf[i] = rnd.getRandomNumber(255);
+	}
+
+	void conversionTest(const Graphics::PixelFormat &dstFmt, const Graphics::PixelFormat &srcFmt, Graphics::BlitKernelSet set) {
+		Common::RandomSource rnd("crossblit");
+		const uint srcPitch = (kWidth + kPitchPad) * srcFmt.bytesPerPixel;
+		const uint dstPitch = (kWidth + kPitchPad) * dstFmt.bytesPerPixel;
+		byte *src = new byte[srcPitch * kHeight];
+		byte *expected = new byte[dstPitch * kHeight];
+		byte *out = new byte[dstPitch * kHeight];
+
+		// Every width up to kWidth covers the leftovers of all vector sizes
+		for (uint w = 1; w <= kWidth; ++w) {
+			fillRandom(src, srcPitch * kHeight, rnd);
+			fillRandom(expected, dstPitch * kHeight, rnd);
+			memcpy(out, expected, dstPitch * kHeight);
+
+			Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+			TS_ASSERT(Graphics::crossBlit(expected, src, dstPitch, srcPitch, w, kHeight, dstFmt, srcFmt));
+			useCrossBlitKernels(set);
+			TS_ASSERT(Graphics::crossBlit(out, src, dstPitch, srcPitch, w, kHeight, dstFmt, srcFmt));
+
+			TS_ASSERT_EQUALS(memcmp(expected, out, dstPitch * kHeight), 0);
+		}
+
+		delete[] src;
+		delete[] expected;
+		delete[] out;
+	}
+
+	void mapTest(uint bytesPerPixel, Graphics::BlitKernelSet set) {
+		Common::RandomSource rnd("crossblitmap");
+		const uint srcPitch = kWidth + kPitchPad;
+		const uint dstPitch = (kWidth + kPitchPad) * bytesPerPixel;
+		byte *src = new byte[srcPitch * kHeight];
+		byte *expected = new byte[dstPitch * kHeight];
+		byte *out = new byte[dstPitch * kHeight];
+		uint32 map[256];
+		for (uint i = 0; i < 256; ++i)
+			map[i] = rnd.getRandomNumber(0xFFFFFFFF);
+
+		for (uint w = 1; w <= kWidth; ++w) {
+			fillRandom(src, srcPitch * kHeight, rnd);
+			fillRandom(expected, dstPitch * kHeight, rnd);
+			memcpy(out, expected, dstPitch * kHeight);
+
+			Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+			TS_ASSERT(Graphics::crossBlitMap(expected, src, dstPitch, srcPitch, w, kHeight, bytesPerPixel, map));
+			useCrossBlitKernels(set);
+			TS_ASSERT(Graphics::crossBlitMap(out, src, dstPitch, srcPitch, w, kHeight, bytesPerPixel, map));
+
+			TS_ASSERT_EQUALS(memcmp(expected, out, dstPitch * kHeight), 0);
+		}
+
+		delete[] src;
+		delete[] expected;
+		delete[] out;
+	}
+
+public:
+	void test_conversions() {
+		for (int i = 0; i < ARRAYSIZE(allCrossBlitKernels); ++i) {
+			if (!useCrossBlitKernels(allCrossBlitKernels[i]))
+				continue;
+
+			for (int s = 0; s < ARRAYSIZE(crossBlitFormats); ++s) {
+				for (int d = 0; d < ARRAYSIZE(crossBlitFormats); ++d) {
+					if (s != d)
+						conversionTest(crossBlitFormats[d], crossBlitFormats[s], allCrossBlitKernels[i]);
+				}
+			}
+		}
+	}
+
+	void test_map() {
+		for (int i = 0; i < ARRAYSIZE(allCrossBlitKernels); ++i) {
+			if (!useCrossBlitKernels(allCrossBlitKernels[i]))
+				continue;
+
+			mapTest(2, allCrossBlitKernels[i]);
+			mapTest(4, allCrossBlitKernels[i]);
+		}
+	}
+
+	void test_in_place() {
+		const Graphics::PixelFormat rgb565(2, 5, 6, 5, 0, 11, 5, 0, 0);
+		const Graphics::PixelFormat argb8888(4, 8, 8, 8, 8, 16, 8, 0, 24);
+		const uint w = 37, h = 4;
+
+		for (int i = 0; i < ARRAYSIZE(allCrossBlitKernels); ++i) {
+			if (!useCrossBlitKernels(allCrossBlitKernels[i]))
+				continue;
+
+			// Growing has to work backwards, shrinking forwards
+			uint32 buf[w * h], original[w * h];
+			for (uint j = 0; j < w * h; ++j)
+				original[j] = argb8888.RGBToColor(j * 7, j * 3, j * 5);
+			Graphics::crossBlit((byte *)buf, (const byte *)original, w * 2, w * 4, w, h, rgb565, argb8888);
+			Graphics::crossBlit((byte *)buf, (const byte *)buf, w * 4, w * 2, w, h, argb8888, rgb565);
+
+			uint16 shrunk[w * h];
+			Graphics::crossBlit((byte *)shrunk, (const byte *)buf, w * 2, w * 4, w, h, rgb565, argb8888);
+			Graphics::crossBlit((byte *)buf, (const byte *)buf, w * 2, w * 4, w, h, rgb565, argb8888);
+			TS_ASSERT_EQUALS(memcmp(buf, shrunk, sizeof(shrunk)), 0);
+
+			for (uint j = 0; j < w * h; ++j)
+				TS_ASSERT_EQUALS(shrunk[j], rgb565.RGBToColor(j * 7, j * 3, j * 5));
+		}
+	}
+
+	void test_crossblit_speed() {
+#if NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+
+		const Graphics::PixelFormat rgb565(2, 5, 6, 5, 0, 11, 5, 0, 0);
+		const Graphics::PixelFormat argb8888(4, 8, 8, 8, 8, 16, 8, 0, 24);
+		const uint w = 640, h = 480;
+		byte *src = new byte[w * h * 4];
+		byte *dst = new byte[w * h * 4];
+		memset(src, 0x5A, w * h * 4);
+		uint32 map[256] = {};
+#ifdef SLOW_TESTS
+		const int iters = 200;
+#else
+		const int iters = 1;
+#endif
+
+		for (int i = -1; i < ARRAYSIZE(allCrossBlitKernels); ++i) {
+			const char *name = (i < 0) ? "generic" : crossBlitKernelNames[i];
+			if (i < 0)
+				Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+			else if (!useCrossBlitKernels(allCrossBlitKernels[i]))
+				continue;
+
+			uint32 start = g_system->getMillis();
+			for (int j = 0; j < iters; ++j)
+				Graphics::crossBlit(dst, src, w * 4, w * 2, w, h, argb8888, rgb565);
+			debug("RGB565 to ARGB8888 with %s kernels: %f ms per frame", name, (double)(g_system->getMillis() - start) / iters);
+
+			start = g_system->getMillis();
+			for (int j = 0; j < iters; ++j)
+				Graphics::crossBlitMap(dst, src, w * 4, w, w, h, 4, map);
+			debug("CLUT8 to 32-bit with %s kernels: %f ms per frame", name, (double)(g_system->getMillis() - start) / iters);
+		}
+
+		delete[] src;
+		delete[] dst;
+#endif
+	}
+};
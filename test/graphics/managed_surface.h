@@ -0,0 +1,137 @@
+#include <cxxtest/TestSuite.h>
+
+#include "graphics/managed_surface.h"
+#include "graphics/palette.h"
+
+class ManagedSurfaceTestSuite : public CxxTest::TestSuite {
+private:
+	static Graphics::PixelFormat rgb565() {
+		return Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0);
+	}
+
+	static void fillIndices(Graphics::Surface &surf) {
+		for (int y = 0; y < surf.h; ++y)
+			for (int x = 0; x < surf.w; ++x)
+				*(byte *)surf.getBasePtr(x, y) = (x + y) & 3;
+	}
+
+public:
+	void test_palette_map() {
+		const Graphics::PixelFormat fmt = rgb565();
+		Graphics::Palette pal(2);
+		pal.set(0, 0xff, 0, 0);
+		pal.set(1, 0, 0xff, 0);
+
+		const uint32 *map = pal.getMap(fmt);
+		TS_ASSERT_EQUALS(map[0], fmt.RGBToColor(0xff, 0, 0));
+		TS_ASSERT_EQUALS(map[1], fmt.RGBToColor(0, 0xff, 0));
+		TS_ASSERT_EQUALS(map[2], 0U);
+		TS_ASSERT_EQUALS(map[255], 0U);
+
+		// Changing the colors has to drop the cached map
+		pal.set(1, 0, 0, 0xff);
+		map = pal.getMap(fmt);
+		TS_ASSERT_EQUALS(map[1], fmt.RGBToColor(0, 0, 0xff));
+
+		const Graphics::Palette copy(pal);
+		TS_ASSERT_EQUALS(copy.getMap(fmt)[1], fmt.RGBToColor(0, 0, 0xff));
+	}
+
+	void test_blit_clut8() {
+		const Graphics::PixelFormat fmt = rgb565();
+		const byte colors[4 * 3] = { 0, 0, 0,  0xff, 0, 0,  0, 0xff, 0,  0, 0, 0xff };
+		Graphics::Palette pal(colors, 4);
+
+		Graphics::Surface src;
+		src.create(7, 5, Graphics::PixelFormat::createFormatCLUT8());
+		fillIndices(src);
+
+		Graphics::ManagedSurface dst(10, 8, fmt);
+		dst.clear(0);
+
+		// Partly off the destination, unscaled and then scaled
+		dst.blitFrom(src, Common::Point(5, 4), &pal);
+		for (int y = 4; y < 8; ++y) {
+			for (int x = 5; x < 10; ++x) {
+				const byte index = ((x - 5) + (y - 4)) & 3;
+				TS_ASSERT_EQUALS(*(const uint16 *)dst.getBasePtr(x, y),
+				                 fmt.RGBToColor(colors[index * 3], colors[index * 3 + 1], colors[index * 3 + 2]));
+			}
+		}
+		TS_ASSERT_EQUALS(*(const uint16 *)dst.getBasePtr(4, 4), 0);
+
+		pal.set(1, 0xff, 0xff, 0xff);
+		dst.blitFrom(src, Common::Rect(0, 0, 2, 1), Common::Rect(0, 0, 4, 2), &pal);
+		TS_ASSERT_EQUALS(*(const uint16 *)dst.getBasePtr(0, 1), fmt.RGBToColor(0, 0, 0));
+		TS_ASSERT_EQUALS(*(const uint16 *)dst.getBasePtr(3, 1), fmt.RGBToColor(0xff, 0xff, 0xff));
+
+		src.free();
+	}
+
+	void test_trans_blit_clut8() {
+		const Graphics::PixelFormat fmt = rgb565();
+		const byte colors[4 * 3] = { 0, 0, 0,  0xff, 0, 0,  0, 0xff, 0,  0, 0, 0xff };
+		const Graphics::Palette pal(colors, 4);
+
+		Graphics::Surface src;
+		src.create(4, 4, Graphics::PixelFormat::createFormatCLUT8());
+		fillIndices(src);
+
+		Graphics::ManagedSurface dst(4, 4, fmt);
+		dst.clear(0x1234);
+		dst.transBlitFrom(src, Common::Point(0, 0), 2, false, 0xff, &pal);
+
+		for (int y = 0; y < 4; ++y) {
+			for (int x = 0; x < 4; ++x) {
+				const byte index = (x + y) & 3;
+				const uint16 expected = (index == 2) ? 0x1234 :
+				                        fmt.RGBToColor(colors[index * 3], colors[index * 3 + 1], colors[index * 3 + 2]);
+				TS_ASSERT_EQUALS(*(const uint16 *)dst.getBasePtr(x, y), expected);
+			}
+		}
+
+		src.free();
+	}
+
+	void test_trans_blit_clut8_to_clut8() {
+		Graphics::Surface src;
+		src.create(6, 3, Graphics::PixelFormat::createFormatCLUT8());
+		for (int y = 0; y < src.h; ++y)
+			for (int x = 0; x < src.w; ++x)
+				*(byte *)src.getBasePtr(x, y) = 10 + x + y * src.w;
+		*(byte *)src.getBasePtr(2, 1) = 0;
+
+		// Unscaled and partly off the left and bottom edges
+		Graphics::ManagedSurface dst(8, 4, Graphics::PixelFormat::createFormatCLUT8());
+		dst.clear(1);
+		dst.transBlitFrom(src, Common::Point(-2, 2), 0);
+		for (int y = 0; y < 4; ++y) {
+			for (int x = 0; x < 8; ++x) {
+				byte expected = 1;
+				if (y >= 2 && x < 4) {
+					const byte srcVal = *(const byte *)src.getBasePtr(x + 2, y - 2);
+					if (srcVal != 0)
+						expected = srcVal;
+				}
+				TS_ASSERT_EQUALS(*(const byte *)dst.getBasePtr(x, y), expected);
+			}
+		}
+
+		// Flipped and scaled up, partly off the right edge
+		dst.clear(1);
+		dst.transBlitFrom(src, Common::Rect(0, 0, 6, 3), Common::Rect(4, 0, 16, 6), 0, true);
+		for (int y = 0; y < 4; ++y) {
+			for (int x = 0; x < 8; ++x) {
+				byte expected = 1;
+				if (x >= 4) {
+					const byte srcVal = *(const byte *)src.getBasePtr(5 - (x - 4) / 2, y / 2);
+					if (srcVal != 0)
+						expected = srcVal;
+				}
+				TS_ASSERT_EQUALS(*(const byte *)dst.getBasePtr(x, y), expected);
+			}
+		}
+
+		src.free();
+	}
+};
@@ -0,0 +1,232 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/random.h"
+#include "common/textconsole.h"
+#include "graphics/scaler/intern.h"
+#include "graphics/scaler/rowkernels.h"
+#ifdef USE_HQ_SCALERS
+#include "graphics/scaler/hq.h"
+#endif
+#ifdef USE_EDGE_SCALERS
+#include "graphics/scaler/edge.h"
+#endif
+
+#include "../null_osystem.h"
+#include "test/instrset_detect.h"
+
+/**
+ * Pick a kernel set if both the build and the CPU have it.
+ */
+static bool useRowKernels(Graphics::RowKernelSet set) {
+#ifdef SCUMMVM_SSE2
+	if (set == Graphics::kRowKernelsSSE2 && instrset_detect() < 2)
+		return false;
+	if (set == Graphics::kRowKernelsAVX2 && instrset_detect() < 8)
+		return false;
+#endif
+	return Graphics::setRowKernels(set);
+}
+
+static const Graphics::RowKernelSet allRowKernels[] = {
+	Graphics::kRowKernelsGeneric, Graphics::kRowKernelsSSE2, Graphics::kRowKernelsAVX2, Graphics::kRowKernelsNEON
+};
+
+static const char *const rowKernelNames[] = { "generic", "SSE2", "AVX2", "NEON" };
+
+/**
+ * A 16-bit test picture with a one pixel border: flat areas with edges and
+ * noise, the kind of content the HQ and Edge scalers look for.
+ */
+static uint16 *createScalerPicture(int width, int height, uint32 seed) {
+	Common::RandomSource rnd("scaler");
+	rnd.setSeed(seed);
+	const int pitch = width + 2;
+	uint16 *pixels = new uint16[pitch * (height + 2)];
+	for (int y = 0; y < height + 2; ++y) {
+		for (int x = 0; x < pitch; ++x) {
+			uint16 color = ((x / 5 + y / 7) & 3) * 0x3457;
+			if (rnd.getRandomNumber(15) == 0)
+				color ^= rnd.getRandomNumber(0xFFFF);
+			pixels[y * pitch + x] = color;
+		}
+	}
+	return pixels;
+}
+
+class ScalerRowKernelsTestSuite : public CxxTest::TestSuite {
+private:
+	template<typename Pixel>
+	void unchangedTestTemplate() {
+		Common::RandomSource rnd("unchanged");
+		const int width = 45, pitch = width + 2;
+
+		for (int round = 0; round < 20; ++round) {
+			Pixel src[3 * pitch], oldSrc[3 * pitch];
+			for (int i = 0; i < 3 * pitch; ++i)
+				src[i] = oldSrc[i] = (Pixel)rnd.getRandomNumber(0xFFFF);
+			// A few changed pixels, some of them on the border
+			for (int i = 0; i < round % 5; ++i)
+				src[rnd.getRandomNumber(3 * pitch - 1)] ^= 0x100;
+
+			uint8 unchanged[width];
+			Graphics::edgeUnchangedRow(src + pitch + 1, oldSrc + pitch + 1, pitch, unchanged, width);
+
+			for (int x = 0; x < width; ++x) {
+				uint8 expected = 1;
+				for (int y = 0; y < 3; ++y) {
+					for (int dx = 0; dx < 3; ++dx) {
+						if (src[y * pitch + x + dx] != oldSrc[y * pitch + x + dx])
+							expected = 0;
+					}
+				}
+				TS_ASSERT_EQUALS(unchanged[x], expected);
+			}
+		}
+	}
+
+	void patternsTest() {
+		Common::RandomSource rnd("patterns");
+		uint32 *lut = new uint32[65536];
+		for (int i = 0; i < 65536; ++i)
+			lut[i] = (rnd.getRandomNumber(255) << 16) | (rnd.getRandomNumber(255) << 8) | rnd.getRandomNumber(255);
+
+		static const int widths[] = { 1, 7, 8, 13, 64, 77 };
+		for (int i = 0; i < ARRAYSIZE(widths); ++i) {
+			const int width = widths[i];
+			uint16 pixels[3 * 79];
+			uint32 yuv[3 * 79];
+			for (int j = 0; j < 3 * (width + 2); ++j) {
+				// Few different values, and some close ones
+				pixels[j] = rnd.getRandomNumber(7) * 9000;
+				yuv[j] = lut[pixels[j]] ^ (rnd.getRandomNumber(15) << (8 * rnd.getRandomNumber(2)));
+			}
+
+			uint32 converted[79];
+			Graphics::hqConvertYUVRow(pixels, converted, width + 2, lut);
+			for (int x = 0; x < width + 2; ++x)
+				TS_ASSERT_EQUALS(converted[x], lut[pixels[x]]);
+
+			uint8 patterns[77];
+			const uint32 *prev = yuv + 1, *cur = prev + width + 2, *next = cur + width + 2;
+			Graphics::hqPatternRow(prev, cur, next, patterns, width);
+
+			for (int x = 0; x < width; ++x) {
+				const uint32 neighbors[8] = { prev[x - 1], prev[x], prev[x + 1], cur[x - 1], cur[x + 1], next[x - 1], next[x], next[x + 1] };
+				int expected = 0;
+				for (int n = 0; n < 8; ++n) {
+					if (diffYUV(cur[x], neighbors[n]))
+						expected |= 1 << n;
+				}
+				TS_ASSERT_EQUALS(patterns[x], expected);
+			}
+		}
+
+		delete[] lut;
+	}
+
+	/**
+	 * Scale a picture twice, the second time with the previous source
+	 * enabled for scalers which have one.
+	 */
+	void scalePicture(Scaler &scaler, bool useOldSource, const uint16 *picture, int width, int height, uint16 *out) {
+		const int pitch = (width + 2) * 2;
+		const int factor = scaler.getFactor();
+		const uint8 *src = (const uint8 *)picture + pitch + 2;
+
+		if (useOldSource) {
+			scaler.setSource((const byte *)picture, pitch, width, height, 1);
+			scaler.enableSource(true);
+		}
+		for (int i = 0; i < 2; ++i)
+			scaler.scale(src, pitch, (uint8 *)out, width * factor * 2, width, height, 0, 0);
+	}
+
+	template<class ScalerType>
+	void scalerTest(uint factor, bool useOldSource) {
+		const Graphics::PixelFormat format(2, 5, 6, 5, 0, 11, 5, 0, 0);
+		const int width = 45, height = 19;
+		uint16 *picture = createScalerPicture(width, height, 1234);
+
+		const int outSize = width * height * factor * factor;
+		uint16 *expected = new uint16[outSize];
+		uint16 *out = new uint16[outSize];
+
+		for (int i = 0; i < ARRAYSIZE(allRowKernels); ++i) {
+			if (!useRowKernels(allRowKernels[i]))
+				continue;
+
+			// Some scalers are too big for the stack
+			ScalerType *scaler = new ScalerType(format);
+			scaler->setFactor(factor);
+			scalePicture(*scaler, useOldSource, picture, width, height, i == 0 ? expected : out);
+			delete scaler;
+			if (i != 0)
+				TS_ASSERT_EQUALS(memcmp(expected, out, outSize * 2), 0);
+		}
+
+		delete[] picture;
+		delete[] expected;
+		delete[] out;
+	}
+
+public:
+	void test_hq_patterns() {
+		for (int i = 0; i < ARRAYSIZE(allRowKernels); ++i) {
+			if (useRowKernels(allRowKernels[i]))
+				patternsTest();
+		}
+	}
+
+	void test_edge_unchanged() {
+		for (int i = 0; i < ARRAYSIZE(allRowKernels); ++i) {
+			if (useRowKernels(allRowKernels[i])) {
+				unchangedTestTemplate<uint16>();
+				unchangedTestTemplate<uint32>();
+			}
+		}
+	}
+
+	void test_scaler_output() {
+#ifdef USE_HQ_SCALERS
+		scalerTest<HQScaler>(2, false);
+		scalerTest<HQScaler>(3, false);
+#endif
+#ifdef USE_EDGE_SCALERS
+		scalerTest<EdgeScaler>(2, true);
+		scalerTest<EdgeScaler>(3, true);
+#endif
+	}
+
+	void test_scaler_speed() {
+#if NULL_OSYSTEM_IS_AVAILABLE && defined(USE_HQ_SCALERS)
+		Common::install_null_g_system();
+
+		const Graphics::PixelFormat format(2, 5, 6, 5, 0, 11, 5, 0, 0);
+		const int width = 320, height = 200;
+		uint16 *picture = createScalerPicture(width, height, 5678);
+		uint16 *out = new uint16[width * height * 9];
+#ifdef SLOW_TESTS
+		const int iters = 100;
+#else
+		const int iters = 1;
+#endif
+
+		for (uint factor = 2; factor <= 3; ++factor) {
+			for (int i = 0; i < ARRAYSIZE(allRowKernels); ++i) {
+				if (!useRowKernels(allRowKernels[i]))
+					continue;
+
+				HQScaler scaler(format);
+				scaler.setFactor(factor);
+				uint32 start = g_system->getMillis();
+				for (int j = 0; j < iters; ++j)
+					scalePicture(scaler, false, picture, width, height, out);
+				debug("HQ%dx with %s kernels: %f ms per frame", factor, rowKernelNames[i], (double)(g_system->getMillis() - start) / (2 * iters));
+			}
+		}
+
+		delete[] picture;
+		delete[] out;
+#endif
+	}
+};
@@ -0,0 +1,220 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/random.h"
+#include "common/rect.h"
+#include "common/textconsole.h"
+#include "graphics/blit.h"
+#include "graphics/pixelformat.h"
+#include "graphics/transform_struct.h"
+
+#include "../null_osystem.h"
+#include "test/instrset_detect.h"
+
+/**
+ * Pick a kernel set if both the build and the CPU have it.
+ */
+static bool useScaleBlitKernels(Graphics::BlitKernelSet set) {
+#ifdef SCUMMVM_SSE2
+	if (set == Graphics::kBlitKernelsSSE2 && instrset_detect() < 2)
+		return false;
+	if (set == Graphics::kBlitKernelsAVX2 && instrset_detect() < 8)
+		return false;
+#endif
+	return Graphics::setBlitKernels(set);
+}
+
+static const Graphics::BlitKernelSet allScaleBlitKernels[] = {
+	Graphics::kBlitKernelsSSE2, Graphics::kBlitKernelsAVX2, Graphics::kBlitKernelsNEON
+};
+
+static const char *const scaleBlitKernelNames[] = { "SSE2", "AVX2", "NEON" };
+
+static const Graphics::PixelFormat scaleBlitFormats[] = {
+	Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24), // ARGB8888
+	Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0), // RGBA8888
+	Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24)  // ABGR8888
+};
+
+class ScaleBlitKernelsTestSuite : public CxxTest::TestSuite {
+private:
+	static const uint kSrcW = 23;
+	static const uint kSrcH = 17;
+	static const uint kPitchPad = 8;
+
+	void fillRandom(byte *buf, uint size, Common::RandomSource &rnd) {
+		for (uint i = 0; i < size; ++i)
+			buf[i] = rnd.getRandomNumber(255);
+	}
+
+	/**
+	 * Interpolate one channel the way the generic code of blit-scale.cpp
+	 * does, for checking the pixel gathering as well as the kernels.
+	 */
+	static byte interpolateChannel(byte c00, byte c01, byte c10, byte c11, int ex, int ey) {
+		int t1 = ((((c01 - c00) * ex) >> 16) + c00) & 0xff;
+		int t2 = ((((c11 - c10) * ex) >> 16) + c10) & 0xff;
+		return (((t2 - t1) * ey) >> 16) + t1;
+	}
+
+	void scaleTest(Graphics::BlitKernelSet set, const Graphics::PixelFormat &fmt, uint dstW, uint dstH, byte flip) {
+		Common::RandomSource rnd("scaleblit");
+		const uint srcPitch = (kSrcW + kPitchPad) * 4;
+		const uint dstPitch = (dstW + kPitchPad) * 4;
+		byte *src = new byte[srcPitch * kSrcH];
+		byte *expected = new byte[dstPitch * dstH];
+		byte *out = new byte[dstPitch * dstH];
+		fillRandom(src, srcPitch * kSrcH, rnd);
+		fillRandom(expected, dstPitch * dstH, rnd);
+		memcpy(out, expected, dstPitch * dstH);
+
+		Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+		Graphics::scaleBlitBilinear(expected, src, dstPitch, srcPitch, dstW, dstH, kSrcW, kSrcH, fmt, flip);
+		useScaleBlitKernels(set);
+		Graphics::scaleBlitBilinear(out, src, dstPitch, srcPitch, dstW, dstH, kSrcW, kSrcH, fmt, flip);
+
+		TS_ASSERT_SAME_DATA(out, expected, dstPitch * dstH);
+
+		delete[] src;
+		delete[] expected;
+		delete[] out;
+	}
+
+	void rotoscaleTest(Graphics::BlitKernelSet set, const Graphics::PixelFormat &fmt, int angle, int zoom, byte flip) {
+		Common::RandomSource rnd("rotoscaleblit");
+		const uint dstW = 61, dstH = 35;
+		const uint srcPitch = (kSrcW + kPitchPad) * 4;
+		const uint dstPitch = (dstW + kPitchPad) * 4;
+		byte *src = new byte[srcPitch * kSrcH];
+		byte *expected = new byte[dstPitch * dstH];
+		byte *out = new byte[dstPitch * dstH];
+		fillRandom(src, srcPitch * kSrcH, rnd);
+		fillRandom(expected, dstPitch * dstH, rnd);
+		memcpy(out, expected, dstPitch * dstH);
+
+		Graphics::TransformStruct transform(zoom, zoom, angle, kSrcW / 2, kSrcH / 2);
+		transform._flip = flip;
+		const Common::Point hotspot(dstW / 2, dstH / 2);
+
+		Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+		Graphics::rotoscaleBlitBilinear(expected, src, dstPitch, srcPitch, dstW, dstH, kSrcW, kSrcH, fmt, transform, hotspot);
+		useScaleBlitKernels(set);
+		Graphics::rotoscaleBlitBilinear(out, src, dstPitch, srcPitch, dstW, dstH, kSrcW, kSrcH, fmt, transform, hotspot);
+
+		TS_ASSERT_SAME_DATA(out, expected, dstPitch * dstH);
+
+		delete[] src;
+		delete[] expected;
+		delete[] out;
+	}
+
+public:
+	void test_scale_generic() {
+		// Check the generic gathering against the positions worked out
+		// independently, the kernels are checked against it below.
+		const Graphics::PixelFormat fmt = scaleBlitFormats[1];
+		const uint32 src[4] = { 0x00000000, 0xFF804020, 0x10203040, 0xFFFFFFFF };
+		uint32 dst[16];
+
+		Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+		Graphics::scaleBlitBilinear((byte *)dst, (const byte *)src, 4 * 4, 2 * 4, 4, 4, 2, 2, fmt, Graphics::FLIP_NONE);
+
+		const int step = (int)(65536.0f / 3);
+		for (uint y = 0; y < 4; ++y) {
+			for (uint x = 0; x < 4; ++x) {
+				const int sx = MIN<int>(step * x, (2 << 16) - 1);
+				const int sy = MIN<int>(step * y, (2 << 16) - 1);
+				const uint cx = sx >> 16, cy = sy >> 16;
+				const uint nx = MIN<uint>(cx + 1, 1), ny = MIN<uint>(cy + 1, 1);
+				uint32 color = 0;
+				for (uint shift = 0; shift < 32; shift += 8) {
+					color |= (uint32)interpolateChannel(src[cy * 2 + cx] >> shift, src[cy * 2 + nx] >> shift,
+					                                    src[ny * 2 + cx] >> shift, src[ny * 2 + nx] >> shift,
+					                                    sx & 0xffff, sy & 0xffff) << shift;
+				}
+				TS_ASSERT_EQUALS(dst[y * 4 + x], color);
+			}
+		}
+	}
+
+	void test_scale() {
+		static const uint sizes[][2] = { { 2, 2 }, { 5, 3 }, { 23, 17 }, { 47, 40 }, { 130, 9 }, { 11, 60 } };
+
+		for (int i = 0; i < ARRAYSIZE(allScaleBlitKernels); ++i) {
+			if (!useScaleBlitKernels(allScaleBlitKernels[i]))
+				continue;
+
+			for (int f = 0; f < ARRAYSIZE(scaleBlitFormats); ++f) {
+				for (int s = 0; s < ARRAYSIZE(sizes); ++s) {
+					for (byte flip = 0; flip <= (Graphics::FLIP_H | Graphics::FLIP_V); ++flip)
+						scaleTest(allScaleBlitKernels[i], scaleBlitFormats[f], sizes[s][0], sizes[s][1], flip);
+				}
+			}
+		}
+	}
+
+	void test_rotoscale() {
+		static const int angles[] = { 15, 90, 137, 200, 333 };
+		static const int zooms[] = { 50, 100, 170 };
+
+		for (int i = 0; i < ARRAYSIZE(allScaleBlitKernels); ++i) {
+			if (!useScaleBlitKernels(allScaleBlitKernels[i]))
+				continue;
+
+			for (int f = 0; f < ARRAYSIZE(scaleBlitFormats); ++f) {
+				for (int a = 0; a < ARRAYSIZE(angles); ++a) {
+					for (int z = 0; z < ARRAYSIZE(zooms); ++z) {
+						for (byte flip = 0; flip <= (Graphics::FLIP_H | Graphics::FLIP_V); ++flip)
+							rotoscaleTest(allScaleBlitKernels[i], scaleBlitFormats[f], angles[a], zooms[z], flip);
+					}
+				}
+			}
+		}
+	}
+
+	void test_scaleblit_speed() {
+#ifdef NULL_OSYSTEM_IS_AVAILABLE
+		static const uint sizes[] = { 64, 256, 1024 };
+		const Graphics::PixelFormat fmt = scaleBlitFormats[1];
+#ifdef SLOW_TESTS
+		const int iters = 200;
+#else
+		const int iters = 1;
+#endif
+
+		for (int s = 0; s < ARRAYSIZE(sizes); ++s) {
+			const uint srcSize = sizes[s] / 2;
+			const uint dstSize = sizes[s];
+			byte *src = new byte[srcSize * srcSize * 4];
+			byte *dst = new byte[dstSize * dstSize * 4];
+			memset(src, 0x5A, srcSize * srcSize * 4);
+			Graphics::TransformStruct transform(200, 200, 30, srcSize / 2, srcSize / 2);
+			const Common::Point hotspot(dstSize / 2, dstSize / 2);
+
+			for (int i = -1; i < ARRAYSIZE(allScaleBlitKernels); ++i) {
+				const char *name = (i < 0) ? "generic" : scaleBlitKernelNames[i];
+				if (i < 0)
+					Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+				else if (!useScaleBlitKernels(allScaleBlitKernels[i]))
+					continue;
+
+				uint32 start = g_system->getMillis();
+				for (int j = 0; j < iters; ++j)
+					Graphics::scaleBlitBilinear(dst, src, dstSize * 4, srcSize * 4, dstSize, dstSize, srcSize, srcSize, fmt, Graphics::FLIP_NONE);
+				const uint32 scaleTime = g_system->getMillis() - start;
+
+				start = g_system->getMillis();
+				for (int j = 0; j < iters; ++j)
+					Graphics::rotoscaleBlitBilinear(dst, src, dstSize * 4, srcSize * 4, dstSize, dstSize, srcSize, srcSize, fmt, transform, hotspot);
+				const uint32 rotoscaleTime = g_system->getMillis() - start;
+
+				debug("%ux%u to %ux%u with %s kernels: scaling %f Mpixels/s, rotating %f Mpixels/s", srcSize, srcSize, dstSize, dstSize, name,
+				      (double)dstSize * dstSize * iters / 1000.0 / MAX<uint32>(scaleTime, 1),
+				      (double)dstSize * dstSize * iters / 1000.0 / MAX<uint32>(rotoscaleTime, 1));
+			}
+
+			delete[] src;
+			delete[] dst;
+		}
+#endif
+	}
+};
@@ -0,0 +1,242 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/random.h"
+#include "graphics/blit.h"
+#include "graphics/surface.h"
+#include "graphics/yuv_to_rgb.h"
+
+#include "test/instrset_detect.h"
+
+/**
+ * Pick a kernel set if both the build and the CPU have it.
+ */
+static bool useYUVToRGBKernels(Graphics::BlitKernelSet set) {
+#ifdef SCUMMVM_SSE2
+	if (set == Graphics::kBlitKernelsSSE2 && instrset_detect() < 2)
+		return false;
+	if (set == Graphics::kBlitKernelsAVX2 && instrset_detect() < 8)
+		return false;
+#endif
+	return Graphics::setBlitKernels(set);
+}
+
+class YUVToRGBTestSuite : public CxxTest::TestSuite {
+private:
+	enum Subsampling {
+		k444,
+		k422,
+		k420
+	};
+
+	static void convert(Graphics::Surface &dst, Subsampling subsampling, Graphics::YUVToRGBManager::LuminanceScale scale,
+	                    const byte *y, const byte *u, const byte *v, int w, int h, int yPitch, int uvPitch) {
+		switch (subsampling) {
+		case k444:
+			YUVToRGBMan.convert444(&dst, scale, y, u, v, w, h, yPitch, uvPitch);
+			break;
+		case k422:
+			YUVToRGBMan.convert422(&dst, scale, y, u, v, w, h, yPitch, uvPitch);
+			break;
+		case k420:
+			YUVToRGBMan.convert420(&dst, scale, y, u, v, w, h, yPitch, uvPitch);
+			break;
+		}
+	}
+
+	/**
+	 * Convert the planes with the generic code and with the kernels, and
+	 * check that they agree.
+	 */
+	void compare(Graphics::BlitKernelSet set, const Graphics::PixelFormat &fmt, Subsampling subsampling,
+	             Graphics::YUVToRGBManager::LuminanceScale scale, const byte *y, const byte *u, const byte *v,
+	             int w, int h, int yPitch, int uvPitch) {
+		Graphics::Surface expected, out;
+		expected.create(w, h, fmt);
+		out.create(w, h, fmt);
+
+		Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+		convert(expected, subsampling, scale, y, u, v, w, h, yPitch, uvPitch);
+		useYUVToRGBKernels(set);
+		convert(out, subsampling, scale, y, u, v, w, h, yPitch, uvPitch);
+
+		TS_ASSERT_SAME_DATA(out.getPixels(), expected.getPixels(), h * expected.pitch);
+
+		expected.free();
+		out.free();
+	}
+
+	static const Graphics::PixelFormat *formats() {
+		static const Graphics::PixelFormat list[] = {
+			Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0),  // RGB565
+			Graphics::PixelFormat(2, 5, 5, 5, 1, 10, 5, 0, 15), // ARGB1555
+			Graphics::PixelFormat(4, 8, 8, 8, 0, 16, 8, 0, 0),  // XRGB8888
+			Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0), // RGBA8888
+			Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24)  // ABGR8888
+		};
+		return list;
+	}
+
+	static const int kFormatCount = 5;
+
+public:
+	void test_all_chroma() {
+		// Every chroma pair, with the luminance running over its range too
+		static const int kSize = 256;
+		byte *y = new byte[kSize * kSize];
+		byte *u = new byte[kSize * kSize];
+		byte *v = new byte[kSize * kSize];
+		for (int j = 0; j < kSize; ++j) {
+			for (int i = 0; i < kSize; ++i) {
+				y[j * kSize + i] = (i * 7 + j * 13) & 0xFF;
+				u[j * kSize + i] = i;
+				v[j * kSize + i] = j;
+			}
+		}
+
+		static const Graphics::BlitKernelSet sets[] = { Graphics::kBlitKernelsSSE2, Graphics::kBlitKernelsAVX2, Graphics::kBlitKernelsNEON };
+		for (int s = 0; s < ARRAYSIZE(sets); ++s) {
+			if (!useYUVToRGBKernels(sets[s]))
+				continue;
+
+			for (int f = 0; f < kFormatCount; ++f) {
+				compare(sets[s], formats()[f], k444, Graphics::YUVToRGBManager::kScaleFull, y, u, v, kSize, kSize, kSize, kSize);
+				compare(sets[s], formats()[f], k444, Graphics::YUVToRGBManager::kScaleITU, y, u, v, kSize, kSize, kSize, kSize);
+			}
+		}
+
+		Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+		delete[] y;
+		delete[] u;
+		delete[] v;
+	}
+
+	void test_subsampling() {
+		static const int widths[] = { 2, 6, 8, 14, 16, 22, 34, 66 };
+		static const int kHeight = 6;
+		static const int kPitchPad = 5;
+		Common::RandomSource rnd("yuv_to_rgb");
+
+		static const Graphics::BlitKernelSet sets[] = { Graphics::kBlitKernelsSSE2, Graphics::kBlitKernelsAVX2, Graphics::kBlitKernelsNEON };
+		for (int s = 0; s < ARRAYSIZE(sets); ++s) {
+			if (!useYUVToRGBKernels(sets[s]))
+				continue;
+
+			for (int i = 0; i < ARRAYSIZE(widths); ++i) {
+				const int w = widths[i];
+				const int yPitch = w + kPitchPad;
+				const int uvPitch = w + kPitchPad;
+				byte *y = new byte[yPitch * kHeight];
+				byte *u = new byte[uvPitch * kHeight];
+				byte *v = new byte[uvPitch * kHeight];
+				for (int j = 0; j < yPitch * kHeight; ++j)
+					y[j] = rnd.getRandomNumber(255);
+				for (int j = 0; j < uvPitch * kHeight; ++j) {
+					u[j] = rnd.getRandomNumber(255);
+					v[j] = rnd.getRandomNumber(255);
+				}
+
+				for (int f = 0; f < kFormatCount; ++f) {
+					for (int sub = k444; sub <= k420; ++sub) {
+						compare(sets[s], formats()[f], (Subsampling)sub, Graphics::YUVToRGBManager::kScaleFull, y, u, v, w, kHeight, yPitch, uvPitch);
+						compare(sets[s], formats()[f], (Subsampling)sub, Graphics::YUVToRGBManager::kScaleITU, y, u, v, w, kHeight, yPitch, uvPitch);
+					}
+				}
+
+				delete[] y;
+				delete[] u;
+				delete[] v;
+			}
+		}
+
+		Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+	}
+
+	void test_sub_area() {
+		// Converting into part of a surface has to leave the rest alone,
+		// whatever the surface pitch
+		static const int kW = 10, kH = 6;
+		Common::RandomSource rnd("yuv_to_rgb_sub_area");
+		byte y[kW * kH], u[kW * kH], v[kW * kH];
+		for (int i = 0; i < kW * kH; ++i) {
+			y[i] = rnd.getRandomNumber(255);
+			u[i] = rnd.getRandomNumber(255);
+			v[i] = rnd.getRandomNumber(255);
+		}
+
+		const Graphics::PixelFormat fmt = formats()[2];
+		Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+		for (int sub = k444; sub <= k420; ++sub) {
+			Graphics::Surface expected, out;
+			expected.create(kW, kH, fmt);
+			out.create(kW + 6, kH + 4, fmt);
+			memset(out.getPixels(), 0x5A, out.h * out.pitch);
+
+			convert(expected, (Subsampling)sub, Graphics::YUVToRGBManager::kScaleITU, y, u, v, kW, kH, kW, kW);
+			Graphics::Surface area = out.getSubArea(Common::Rect(2, 2, 2 + kW, 2 + kH));
+			convert(area, (Subsampling)sub, Graphics::YUVToRGBManager::kScaleITU, y, u, v, kW, kH, kW, kW);
+
+			for (int j = 0; j < out.h; ++j) {
+				for (int i = 0; i < out.w; ++i) {
+					const bool inside = (i >= 2 && i < 2 + kW && j >= 2 && j < 2 + kH);
+					const uint32 pixel = *(const uint32 *)out.getBasePtr(i, j);
+					TS_ASSERT_EQUALS(pixel, inside ? *(const uint32 *)expected.getBasePtr(i - 2, j - 2) : 0x5A5A5A5A);
+				}
+			}
+
+			expected.free();
+			out.free();
+		}
+	}
+
+	void test_yuv_surface() {
+		// The planes have to go to the conversion for their subsampling
+		static const int kW = 16, kH = 8;
+		Common::RandomSource rnd("yuv_surface");
+		byte y[kW * kH], u[(kW / 2 + 1) * (kH + 1)], v[(kW / 2 + 1) * (kH + 1)];
+		for (int i = 0; i < ARRAYSIZE(y); ++i)
+			y[i] = rnd.getRandomNumber(255);
+		for (int i = 0; i < ARRAYSIZE(u); ++i) {
+			u[i] = rnd.getRandomNumber(255);
+			v[i] = rnd.getRandomNumber(255);
+		}
+
+		Graphics::YUVSurface src;
+		src.y = y;
+		src.u = u;
+		src.v = v;
+		src.w = kW;
+		src.h = kH;
+		src.yPitch = kW;
+		src.uvPitch = kW / 2;
+		src.scale = Graphics::YUVToRGBManager::kScaleITU;
+
+		const Graphics::PixelFormat fmt = formats()[3];
+		Graphics::Surface expected, out;
+		expected.create(kW, kH, fmt);
+		out.create(kW, kH, fmt);
+
+		const Graphics::YUVSurface::Subsampling subsamplings[] = {
+			Graphics::YUVSurface::kSubsampling422, Graphics::YUVSurface::kSubsampling420, Graphics::YUVSurface::kSubsampling410
+		};
+		for (int i = 0; i < ARRAYSIZE(subsamplings); ++i) {
+			src.subsampling = subsamplings[i];
+			switch (src.subsampling) {
+			case Graphics::YUVSurface::kSubsampling422:
+				YUVToRGBMan.convert422(&expected, src.scale, y, u, v, kW, kH, kW, kW / 2);
+				break;
+			case Graphics::YUVSurface::kSubsampling420:
+				YUVToRGBMan.convert420(&expected, src.scale, y, u, v, kW, kH, kW, kW / 2);
+				break;
+			default:
+				YUVToRGBMan.convert410(&expected, src.scale, y, u, v, kW, kH, kW, kW / 2);
+				break;
+			}
+
+			YUVToRGBMan.convert(&out, src);
+			TS_ASSERT_SAME_DATA(out.getPixels(), expected.getPixels(), kH * expected.pitch);
+		}
+
+		expected.free();
+		out.free();
+	}
+};
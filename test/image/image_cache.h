@@ -0,0 +1,84 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/memstream.h"
+#include "graphics/blit.h"
+#include "graphics/surface.h"
+#include "image/image_cache.h"
+#include "image/image_decoder.h"
+
+/** Decodes a stream into a CLUT8 image as wide as the stream is long. */
+class CountingImageDecoder : public Image::ImageDecoder {
+public:
+	Graphics::Surface surface;
+	byte palette[3 * 2];
+	int loads;
+
+	CountingImageDecoder() : loads(0) {
+		static const byte colors[3 * 2] = { 0x00, 0x00, 0x00, 0xff, 0x80, 0x40 };
+		memcpy(palette, colors, sizeof(palette));
+	}
+	~CountingImageDecoder() { destroy(); }
+
+	bool loadStream(Common::SeekableReadStream &stream) override {
+		destroy();
+		loads++;
+		surface.create(stream.size(), 4, Graphics::PixelFormat::createFormatCLUT8());
+		for (int x = 0; x < surface.w; ++x) {
+			const byte value = stream.readByte() & 1;
+			for (int y = 0; y < surface.h; ++y)
+				*(byte *)surface.getBasePtr(x, y) = value;
+		}
+		return true;
+	}
+	void destroy() override { surface.free(); }
+	const Graphics::Surface *getSurface() const override { return &surface; }
+	const byte *getPalette() const override { return palette; }
+	uint16 getPaletteColorCount() const override { return 2; }
+};
+
+class DecodedImageCacheTestSuite : public CxxTest::TestSuite {
+public:
+	void test_memory_cache() {
+		Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+
+		const Graphics::PixelFormat format(4, 8, 8, 8, 8, 24, 16, 8, 0);
+		const byte data[] = { 0, 1, 1, 0 };
+		CountingImageDecoder decoder;
+		// Room for two of the 4x4 images
+		Image::DecodedImageCache cache(2 * 4 * 4 * 4);
+
+		Common::MemoryReadStream stream(data, sizeof(data));
+		Image::DecodedImageCache::SurfacePtr first = cache.load("a", stream, decoder, format);
+		TS_ASSERT(first);
+		TS_ASSERT_EQUALS(first->format, format);
+		TS_ASSERT_EQUALS(first->getPixel(0, 0), format.RGBToColor(0x00, 0x00, 0x00));
+		TS_ASSERT_EQUALS(first->getPixel(1, 3), format.RGBToColor(0xff, 0x80, 0x40));
+		TS_ASSERT_EQUALS(cache.getMemoryUsage(), 4U * 4 * 4);
+
+		// Loading it again uses the cache
+		stream.seek(0);
+		TS_ASSERT_EQUALS(cache.load("a", stream, decoder, format), first);
+		TS_ASSERT_EQUALS(decoder.loads, 1);
+
+		// Another format or a changed file is another image
+		Common::MemoryReadStream shorter(data, 3);
+		TS_ASSERT(cache.load("a", shorter, decoder, Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0)));
+		TS_ASSERT_EQUALS(decoder.loads, 2);
+		stream.seek(0);
+		TS_ASSERT(cache.load("b", stream, decoder, format));
+		TS_ASSERT_EQUALS(decoder.loads, 3);
+		TS_ASSERT(cache.getMemoryUsage() <= 2U * 4 * 4 * 4);
+
+		// "a" was used longer ago than the others, and is dropped
+		stream.seek(0);
+		Image::DecodedImageCache::SurfacePtr again = cache.load("a", stream, decoder, format);
+		TS_ASSERT_EQUALS(decoder.loads, 4);
+		TS_ASSERT_DIFFERS(again, first);
+		// The surface dropped from the cache is still valid
+		TS_ASSERT_EQUALS(first->getPixel(2, 2), format.RGBToColor(0xff, 0x80, 0x40));
+
+		cache.setMemoryBudget(0);
+		TS_ASSERT_EQUALS(cache.getMemoryUsage(), 0U);
+		cache.clear();
+	}
+};
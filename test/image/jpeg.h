@@ -0,0 +1,205 @@
+#include <cxxtest/TestSuite.h>
+
+#if defined(HAVE_CONFIG_H)
+#include "config.h"
+#endif
+
+#include "common/memstream.h"
+#include "common/system.h"
+#include "common/textconsole.h"
+#include "graphics/blit.h"
+#include "graphics/surface.h"
+#include "image/jpeg.h"
+
+#include "../null_osystem.h"
+
+class JPEGRowCollector : public Image::ImageRowListener {
+public:
+	Graphics::Surface image;
+	uint nextRow;
+
+	JPEGRowCollector() : nextRow(0) {}
+	~JPEGRowCollector() { image.free(); }
+
+	void decodedRows(const Graphics::Surface &rows, uint y) override {
+		if (!image.getPixels())
+			image.create(rows.w, 16, rows.format);
+		TS_ASSERT_EQUALS(y, nextRow);
+		image.copyRectToSurface(rows, 0, y, Common::Rect(rows.w, rows.h));
+		nextRow += rows.h;
+	}
+};
+
+class JPEGDecoderTestSuite : public CxxTest::TestSuite {
+private:
+	/**
+	 * A 32x16 JPEG with 4:2:0 chroma. The quadrants are white, green,
+	 * red and blue from the top left.
+	 */
+	static const byte *image(uint32 &size) {
+		static const byte data[] = {
+			0xff, 0xd8, 0xff, 0xe0, 0x00, 0x10, 0x4a, 0x46, 0x49, 0x46, 0x00, 0x01,
+			0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0xff, 0xdb, 0x00, 0x43,
+			0x00, 0x03, 0x02, 0x02, 0x03, 0x02, 0x02, 0x03, 0x03, 0x03, 0x03, 0x04,
+			0x03, 0x03, 0x04, 0x05, 0x08, 0x05, 0x05, 0x04, 0x04, 0x05, 0x0a, 0x07,
+			0x07, 0x06, 0x08, 0x0c, 0x0a, 0x0c, 0x0c, 0x0b, 0x0a, 0x0b, 0x0b, 0x0d,
+			0x0e, 0x12, 0x10, 0x0d, 0x0e, 0x11, 0x0e, 0x0b, 0x0b, 0x10, 0x16, 0x10,
+			0x11, 0x13, 0x14, 0x15, 0x15, 0x15, 0x0c, 0x0f, 0x17, 0x18, 0x16, 0x14,
+			0x18, 0x12, 0x14, 0x15, 0x14, 0xff, 0xdb, 0x00, 0x43, 0x01, 0x03, 0x04,
+			0x04, 0x05, 0x04, 0x05, 0x09, 0x05, 0x05, 0x09, 0x14, 0x0d, 0x0b, 0x0d,
+			0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+			0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+			0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+			0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+			0x14, 0x14, 0xff, 0xc0, 0x00, 0x11, 0x08, 0x00, 0x10, 0x00, 0x20, 0x03,
+			0x01, 0x22, 0x00, 0x02, 0x11, 0x01, 0x03, 0x11, 0x01, 0xff, 0xc4, 0x00,
+			0x1f, 0x00, 0x00, 0x01, 0x05, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+			0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+			0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x10, 0x00,
+			0x02, 0x01, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x05, 0x04, 0x04, 0x00,
+			0x00, 0x01, 0x7d, 0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21,
+			0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81,
+			0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24,
+			0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x25,
+			0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a,
+			0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56,
+			0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a,
+			0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86,
+			0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+			0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3,
+			0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6,
+			0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9,
+			0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1,
+			0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xc4, 0x00,
+			0x1f, 0x01, 0x00, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+			0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+			0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0xff, 0xc4, 0x00, 0xb5, 0x11, 0x00,
+			0x02, 0x01, 0x02, 0x04, 0x04, 0x03, 0x04, 0x07, 0x05, 0x04, 0x04, 0x00,
+			0x01, 0x02, 0x77, 0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31,
+			0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08,
+			0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15,
+			0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25, 0xf1, 0x17, 0x18,
+			0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39,
+			0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x53, 0x54, 0x55,
+			0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+			0x6a, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84,
+			0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+			0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa,
+			0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3, 0xc4,
+			0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+			0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea,
+			0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xff, 0xda, 0x00,
+			0x0c, 0x03, 0x01, 0x00, 0x02, 0x11, 0x03, 0x11, 0x00, 0x3f, 0x00, 0xfd,
+			0x53, 0xa2, 0xbf, 0x08, 0x68, 0xaf, 0x86, 0xff, 0x00, 0x59, 0xff, 0x00,
+			0xe9, 0xcf, 0xfe, 0x4d, 0xff, 0x00, 0xda, 0x9f, 0xd5, 0x3f, 0xf1, 0x03,
+			0x3f, 0xea, 0x65, 0xff, 0x00, 0x94, 0xbf, 0xfb, 0xa9, 0xf6, 0x35, 0x15,
+			0xf9, 0x79, 0x45, 0x7e, 0xe5, 0xff, 0x00, 0x12, 0x81, 0xff, 0x00, 0x53,
+			0xef, 0xfc, 0xb6, 0xff, 0x00, 0xef, 0x83, 0xfc, 0xab, 0xff, 0x00, 0x88,
+			0x63, 0xff, 0x00, 0x51, 0x9f, 0xf9, 0x4f, 0xff, 0x00, 0xb7, 0x3f, 0xff,
+			0xd9
+		};
+		size = sizeof(data);
+		return data;
+	}
+
+	static bool near(byte value, byte expected) {
+		return ABS<int>(value - expected) <= 8;
+	}
+
+public:
+	void test_decode() {
+#ifdef USE_JPEG
+		uint32 size;
+		const byte *data = image(size);
+
+		Image::JPEGDecoder decoder;
+		const Graphics::PixelFormat format(4, 8, 8, 8, 8, 24, 16, 8, 0);
+		TS_ASSERT(decoder.setOutputPixelFormat(format));
+
+		static const byte expected[4][3] = {
+			{ 0xFF, 0xFF, 0xFF }, { 0x00, 0xFF, 0x00 }, { 0xFF, 0x00, 0x00 }, { 0x00, 0x00, 0xFF }
+		};
+
+		// Decoding the next frame of the same size reuses the pixels
+		const void *pixels = nullptr;
+		for (int i = 0; i < 2; ++i) {
+			Common::MemoryReadStream stream(data, size);
+			TS_ASSERT(decoder.loadStream(stream));
+
+			const Graphics::Surface *surface = decoder.getSurface();
+			if (i == 0)
+				pixels = surface->getPixels();
+			TS_ASSERT_EQUALS(surface->getPixels(), pixels);
+			TS_ASSERT_EQUALS(surface->w, 32);
+			TS_ASSERT_EQUALS(surface->h, 16);
+			TS_ASSERT_EQUALS(surface->format, format);
+
+			for (int q = 0; q < 4; ++q) {
+				byte r, g, b;
+				format.colorToRGB(*(const uint32 *)surface->getBasePtr(4 + (q & 1) * 16, 4 + (q >> 1) * 8), r, g, b);
+				TS_ASSERT(near(r, expected[q][0]));
+				TS_ASSERT(near(g, expected[q][1]));
+				TS_ASSERT(near(b, expected[q][2]));
+			}
+		}
+#endif
+	}
+
+	void test_row_listener() {
+#ifdef USE_JPEG
+		Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+
+		uint32 size;
+		const byte *data = image(size);
+
+		// RGB565 is converted from what libjpeg writes while decoding
+		JPEGRowCollector collector;
+		Image::JPEGDecoder decoder;
+		const Graphics::PixelFormat format(2, 5, 6, 5, 0, 11, 5, 0, 0);
+		TS_ASSERT(decoder.setOutputPixelFormat(format));
+		decoder.setRowListener(&collector);
+
+		Common::MemoryReadStream stream(data, size);
+		TS_ASSERT(decoder.loadStream(stream));
+		TS_ASSERT(!decoder.getSurface()->getPixels());
+		TS_ASSERT_EQUALS(collector.nextRow, 16U);
+		TS_ASSERT_EQUALS(collector.image.format, format);
+
+		static const byte expected[4][3] = {
+			{ 0xFF, 0xFF, 0xFF }, { 0x00, 0xFF, 0x00 }, { 0xFF, 0x00, 0x00 }, { 0x00, 0x00, 0xFF }
+		};
+		for (int q = 0; q < 4; ++q) {
+			byte r, g, b;
+			format.colorToRGB(*(const uint16 *)collector.image.getBasePtr(4 + (q & 1) * 16, 4 + (q >> 1) * 8), r, g, b);
+			TS_ASSERT(near(r, expected[q][0]));
+			TS_ASSERT(near(g, expected[q][1]));
+			TS_ASSERT(near(b, expected[q][2]));
+		}
+#endif
+	}
+
+	void test_decode_speed() {
+#if defined(USE_JPEG) && NULL_OSYSTEM_IS_AVAILABLE
+		Common::install_null_g_system();
+
+#ifdef SLOW_TESTS
+		const int iters = 20000;
+#else
+		const int iters = 1;
+#endif
+		uint32 size;
+		const byte *data = image(size);
+
+		Image::JPEGDecoder decoder;
+		decoder.setOutputPixelFormat(Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0));
+
+		const uint32 start = g_system->getMillis();
+		for (int i = 0; i < iters; ++i) {
+			Common::MemoryReadStream stream(data, size);
+			TS_ASSERT(decoder.loadStream(stream));
+		}
+
+		debug("JPEG: %d frames of 32x16 in %u ms", iters, g_system->getMillis() - start);
+#endif
+	}
+};
@@ -0,0 +1,141 @@
+#include <cxxtest/TestSuite.h>
+
+#if defined(HAVE_CONFIG_H)
+#include "config.h"
+#endif
+
+#include "common/array.h"
+#include "common/memstream.h"
+#include "graphics/blit.h"
+#include "graphics/surface.h"
+#include "image/png.h"
+
+class PNGRowCollector : public Image::ImageRowListener {
+public:
+	Graphics::Surface image;
+	uint nextRow;
+	uint strips;
+
+	PNGRowCollector() : nextRow(0), strips(0) {}
+	~PNGRowCollector() { image.free(); }
+
+	void decodedRows(const Graphics::Surface &rows, uint y) override {
+		if (!image.getPixels())
+			image.create(rows.w, 0x100, rows.format);
+		TS_ASSERT_EQUALS(y, nextRow);
+		TS_ASSERT_EQUALS(rows.format, image.format);
+		image.copyRectToSurface(rows, 0, y, Common::Rect(rows.w, rows.h));
+		nextRow += rows.h;
+		strips++;
+	}
+};
+
+class PNGDecoderTestSuite : public CxxTest::TestSuite {
+private:
+	static const int kWidth = 13;
+	static const int kHeight = 37;
+
+	static byte alphaAt(int x, int y, bool hasAlpha) {
+		return hasAlpha ? (x * 7 + y * 3) & 0xff : 0xff;
+	}
+
+	/** Encode an image with a different color in every pixel. */
+	static void encode(Common::MemoryWriteStreamDynamic &out, bool hasAlpha) {
+#ifdef SCUMM_LITTLE_ENDIAN
+		const Graphics::PixelFormat format = hasAlpha ? Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24) : Graphics::PixelFormat(3, 8, 8, 8, 0, 0, 8, 16, 0);
+#else
+		const Graphics::PixelFormat format = hasAlpha ? Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0) : Graphics::PixelFormat(3, 8, 8, 8, 0, 16, 8, 0, 0);
+#endif
+		Graphics::Surface surface;
+		surface.create(kWidth, kHeight, format);
+		for (int y = 0; y < kHeight; ++y)
+			for (int x = 0; x < kWidth; ++x)
+				surface.setPixel(x, y, format.ARGBToColor(alphaAt(x, y, hasAlpha), x * 19, y * 5, x + y));
+		TS_ASSERT(Image::writePNG(out, surface));
+		surface.free();
+	}
+
+	static void checkPixels(const Graphics::Surface &surface, bool hasAlpha) {
+		const Graphics::PixelFormat &format = surface.format;
+		TS_ASSERT_EQUALS(surface.w, kWidth);
+		for (int y = 0; y < kHeight; ++y) {
+			for (int x = 0; x < kWidth; ++x) {
+				byte a, r, g, b;
+				format.colorToARGB(surface.getPixel(x, y), a, r, g, b);
+				const uint32 expected = format.ARGBToColor(format.aBits() ? alphaAt(x, y, hasAlpha) : 0xff, x * 19, y * 5, x + y);
+				byte ea, er, eg, eb;
+				format.colorToARGB(expected, ea, er, eg, eb);
+				if (r != er || g != eg || b != eb || a != ea) {
+					TS_FAIL(Common::String::format("Pixel %d,%d", x, y).c_str());
+					return;
+				}
+			}
+		}
+	}
+
+public:
+	void test_output_format() {
+#ifdef USE_PNG
+		Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+
+		static const Graphics::PixelFormat formats[] = {
+			Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0),
+			Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24),
+			Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24),
+			Graphics::PixelFormat(4, 8, 8, 8, 8, 8, 16, 24, 0),
+			Graphics::PixelFormat(4, 8, 8, 8, 0, 16, 8, 0, 0),
+			Graphics::PixelFormat(3, 8, 8, 8, 0, 0, 8, 16, 0),
+			Graphics::PixelFormat(3, 8, 8, 8, 0, 16, 8, 0, 0),
+			Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0),
+			Graphics::PixelFormat(2, 4, 4, 4, 4, 12, 8, 4, 0)
+		};
+
+		for (int alpha = 0; alpha < 2; ++alpha) {
+			Common::MemoryWriteStreamDynamic out(DisposeAfterUse::YES);
+			encode(out, alpha != 0);
+
+			for (int i = 0; i < ARRAYSIZE(formats); ++i) {
+				Image::PNGDecoder decoder;
+				TS_ASSERT(decoder.setOutputPixelFormat(formats[i]));
+				Common::MemoryReadStream stream(out.getData(), out.size());
+				TS_ASSERT(decoder.loadStream(stream));
+
+				const Graphics::Surface *surface = decoder.getSurface();
+				TS_ASSERT(surface);
+				TS_ASSERT_EQUALS(surface->format, formats[i]);
+				TS_ASSERT_EQUALS(surface->h, kHeight);
+				checkPixels(*surface, alpha != 0);
+			}
+		}
+
+		Image::PNGDecoder decoder;
+		TS_ASSERT(!decoder.setOutputPixelFormat(Graphics::PixelFormat::createFormatCLUT8()));
+#endif
+	}
+
+	void test_row_listener() {
+#ifdef USE_PNG
+		Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+
+		Common::MemoryWriteStreamDynamic out(DisposeAfterUse::YES);
+		encode(out, true);
+
+		for (int convert = 0; convert < 2; ++convert) {
+			PNGRowCollector collector;
+			Image::PNGDecoder decoder;
+			decoder.setRowListener(&collector);
+			if (convert)
+				decoder.setOutputPixelFormat(Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
+
+			Common::MemoryReadStream stream(out.getData(), out.size());
+			TS_ASSERT(decoder.loadStream(stream));
+			TS_ASSERT(!decoder.getSurface());
+			TS_ASSERT_EQUALS(collector.nextRow, (uint)kHeight);
+			TS_ASSERT(collector.strips > 1);
+
+			const Graphics::Surface image = collector.image.getSubArea(Common::Rect(kWidth, kHeight));
+			checkPixels(image, true);
+		}
+#endif
+	}
+};
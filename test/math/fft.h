@@ -0,0 +1,56 @@
+#include <cxxtest/TestSuite.h>
+
+#include "math/fft.h"
+#include "math/utils.h"
+
+class FFTTestSuite : public CxxTest::TestSuite {
+	// The largest difference from a direct DFT, relative to the largest output
+	static double compareWithDFT(Math::FFT &fft, int bits, bool inverse) {
+		const int n = 1 << bits;
+		Common::Array<Math::Complex> data(n), input(n);
+		for (int i = 0; i < n; i++) {
+			input[i].re = (float)((i * 37 % 101) - 50) / 50.f;
+			input[i].im = (float)((i * 53 % 89) - 44) / 44.f;
+			data[i] = input[i];
+		}
+
+		fft.permute(data.begin());
+		fft.calc(data.begin());
+
+		double maxDiff = 0.0, maxValue = 0.0;
+		const double sign = inverse ? 1.0 : -1.0;
+		for (int k = 0; k < n; k++) {
+			double re = 0.0, im = 0.0;
+			for (int i = 0; i < n; i++) {
+				const double angle = sign * 2.0 * M_PI * ((double)i * k / n);
+				re += input[i].re * cos(angle) - input[i].im * sin(angle);
+				im += input[i].re * sin(angle) + input[i].im * cos(angle);
+			}
+			maxDiff = MAX(maxDiff, MAX(fabs(re - data[k].re), fabs(im - data[k].im)));
+			maxValue = MAX(maxValue, MAX(fabs(re), fabs(im)));
+		}
+		return maxDiff / maxValue;
+	}
+
+public:
+	void test_dft() {
+		for (int bits = 2; bits <= 11; bits++) {
+			Math::FFT forward(bits, 0);
+			Math::FFT inverse(bits, 1);
+			TS_ASSERT_LESS_THAN(compareWithDFT(forward, bits, false), 1e-5);
+			TS_ASSERT_LESS_THAN(compareWithDFT(inverse, bits, true), 1e-5);
+		}
+	}
+
+	void test_shared_tables() {
+		// The tables stay valid while any transform of their size is alive
+		Math::FFT *first = new Math::FFT(8, 0);
+		Math::FFT *second = new Math::FFT(9, 0);
+		delete first;
+		TS_ASSERT_LESS_THAN(compareWithDFT(*second, 9, false), 1e-5);
+		delete second;
+
+		Math::FFT third(8, 0);
+		TS_ASSERT_LESS_THAN(compareWithDFT(third, 8, false), 1e-5);
+	}
+};
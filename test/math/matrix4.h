@@ -0,0 +1,91 @@
+#include <cxxtest/TestSuite.h>
+
+#include "math/matrix4.h"
+
+class Matrix4TestSuite : public CxxTest::TestSuite {
+	static void fill(Math::Matrix4 &m, float seed) {
+		float *d = m.getData();
+		for (int i = 0; i < 16; ++i)
+			d[i] = seed + (i * 7 % 11) * 0.25f - (i % 3) * 1.5f;
+	}
+
+public:
+	void test_multiply() {
+		Math::Matrix4 a, b;
+		fill(a, 1.f);
+		fill(b, -2.f);
+
+		const Math::Matrix4 r = a * b;
+		for (int row = 0; row < 4; ++row) {
+			for (int col = 0; col < 4; ++col) {
+				float sum = 0.f;
+				for (int k = 0; k < 4; ++k)
+					sum += a(row, k) * b(k, col);
+				TS_ASSERT_DELTA(r(row, col), sum, 1e-4f);
+			}
+		}
+	}
+
+	void test_inverse() {
+		Math::Matrix4 m;
+		m.buildAroundX(30);
+		m.buildAroundY(-45);
+		m.setPosition(Math::Vector3d(1.f, -2.f, 3.f));
+		m(3, 0) = 0.5f;
+		m(0, 0) *= 2.f;
+
+		Math::Matrix4 inv(m);
+		TS_ASSERT(inv.inverse());
+
+		const Math::Matrix4 identity = m * inv;
+		for (int row = 0; row < 4; ++row) {
+			for (int col = 0; col < 4; ++col)
+				TS_ASSERT_DELTA(identity(row, col), row == col ? 1.f : 0.f, 1e-5f);
+		}
+
+		// A singular matrix is left alone
+		Math::Matrix4 singular;
+		fill(singular, 1.f);
+		for (int col = 0; col < 4; ++col)
+			singular(3, col) = singular(1, col) * 2.f;
+		const Math::Matrix4 before(singular);
+		TS_ASSERT(!singular.inverse());
+		TS_ASSERT(singular == before);
+	}
+
+	void test_transformPoints() {
+		Math::Matrix4 m;
+		fill(m, 0.5f);
+
+		Math::Vector3d points[5];
+		for (int i = 0; i < 5; ++i)
+			points[i].set(i * 1.5f, -i * 0.5f, 2.f - i);
+
+		for (int translate = 0; translate < 2; ++translate) {
+			Math::Vector3d out[5];
+			m.transformPoints(points, out, 5, translate);
+
+			for (int i = 0; i < 5; ++i) {
+				const Math::Vector4d v(points[i].x(), points[i].y(), points[i].z(), translate ? 1.f : 0.f);
+				for (int row = 0; row < 3; ++row) {
+					float sum = 0.f;
+					for (int k = 0; k < 4; ++k)
+						sum += m(row, k) * v.getData()[k];
+					TS_ASSERT_DELTA(out[i].getData()[row], sum, 1e-4f);
+				}
+
+				Math::Vector3d single(points[i]);
+				m.transform(&single, translate);
+				TS_ASSERT(single == out[i]);
+			}
+
+			// In place
+			Math::Vector3d inPlace[5];
+			for (int i = 0; i < 5; ++i)
+				inPlace[i] = points[i];
+			m.transformPoints(inPlace, inPlace, 5, translate);
+			for (int i = 0; i < 5; ++i)
+				TS_ASSERT(inPlace[i] == out[i]);
+		}
+	}
+};
@@ -0,0 +1,835 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Micro-benchmarks of the hot code shared by the engines: containers,
+ * blitting, scalers, resampling, the OPL emulators, decompression, YUV
+ * conversion and 3D math. Build and run them with 'make bench'.
+ *
+ * Every benchmark is run in batches for a few milliseconds and the fastest
+ * batch is reported, one tab separated line per benchmark:
+ *
+ *   <name> <ns per operation> <MB per second>
+ *
+ * The throughput is 0 for benchmarks without a meaningful amount of data.
+ */
+
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+#include "null_osystem.cpp"
+
+#include "backends/mixer/null/null-mixer.h"
+
+#include "common/array.h"
+#include "common/compression/dcl.h"
+#include "common/compression/deflate.h"
+#include "common/cyclecounter.h"
+#include "common/hashmap.h"
+#include "common/memstream.h"
+#include "common/str.h"
+
+#include "graphics/blit.h"
+#include "graphics/surface.h"
+#include "graphics/yuv_to_rgb.h"
+#include "graphics/scaler/normal.h"
+#include "graphics/scaler/rowkernels.h"
+#ifdef USE_SCALERS
+#include "graphics/scaler/sai.h"
+#endif
+#ifdef USE_HQ_SCALERS
+#include "graphics/scaler/hq.h"
+#endif
+#ifdef USE_EDGE_SCALERS
+#include "graphics/scaler/edge.h"
+#endif
+
+#include "audio/audiostream.h"
+#include "audio/mixer.h"
+#include "audio/rate.h"
+#include "audio/softsynth/opl/dosbox.h"
+#include "audio/softsynth/opl/mame.h"
+#ifndef DISABLE_NUKED_OPL
+#include "audio/softsynth/opl/nuked.h"
+#endif
+
+#include "math/matrix4.h"
+
+#include "test/instrset_detect.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+
+/**
+ * Selects the BlendBlit kernels, which are private to BlendBlit and not
+ * switched by Graphics::setBlitKernels().
+ */
+class MicroBenchmark {
+public:
+	static bool setBlendBlitKernels(Graphics::BlitKernelSet set) {
+		switch (set) {
+		case Graphics::kBlitKernelsGeneric:
+			Graphics::BlendBlit::blitFunc = Graphics::BlendBlit::blitGeneric;
+			return true;
+#ifdef SCUMMVM_SSE2
+		case Graphics::kBlitKernelsSSE2:
+			Graphics::BlendBlit::blitFunc = Graphics::BlendBlit::blitSSE2;
+			return true;
+#endif
+#ifdef SCUMMVM_AVX2
+		case Graphics::kBlitKernelsAVX2:
+			Graphics::BlendBlit::blitFunc = Graphics::BlendBlit::blitAVX2;
+			return true;
+#endif
+#ifdef SCUMMVM_NEON
+		case Graphics::kBlitKernelsNEON:
+			Graphics::BlendBlit::blitFunc = Graphics::BlendBlit::blitNEON;
+			return true;
+#endif
+		default:
+			return false;
+		}
+	}
+};
+
+namespace {
+
+/**
+ * The null backend with a mixer, which the OPL emulators take their output
+ * rate from.
+ */
+class BenchSystem : public OSystem_NULL {
+public:
+	BenchSystem() : OSystem_NULL(false) {}
+
+	void initManagers() {
+		_mixerManager = new NullMixerManager();
+		_mixerManager->init();
+	}
+};
+
+/** One measured operation, which is repeated until it has run long enough. */
+class Benchmark {
+public:
+	Benchmark(const Common::String &name, uint64 bytes) : _name(name), _bytes(bytes) {}
+	virtual ~Benchmark() {}
+
+	const Common::String &getName() const { return _name; }
+	/** The amount of data one operation processes, 0 if there is none. */
+	uint64 getBytes() const { return _bytes; }
+
+	/** Prepare the data, not measured. Return false to skip the benchmark. */
+	virtual bool setUp() { return true; }
+	virtual void run() = 0;
+	virtual void tearDown() {}
+
+protected:
+	void setBytes(uint64 bytes) { _bytes = bytes; }
+
+private:
+	Common::String _name;
+	uint64 _bytes;
+};
+
+/** Defeats the optimizer in benchmarks which compute a value. */
+volatile uint32 g_sink = 0;
+
+/** Fill a buffer with data which has some repetition, like game data. */
+void fillPattern(byte *data, uint32 size, uint32 seed) {
+	for (uint32 i = 0; i < size; i++) {
+		seed = seed * 1103515245 + 12345;
+		data[i] = ((i / 16) & 1) ? (byte)(seed >> 24) : (byte)(i >> 3);
+	}
+}
+
+struct KernelName {
+	const char *name;
+	Graphics::BlitKernelSet blit;
+	Graphics::RowKernelSet row;
+};
+
+const KernelName kernels[] = {
+	{ "generic", Graphics::kBlitKernelsGeneric, Graphics::kRowKernelsGeneric },
+	{ "sse2",    Graphics::kBlitKernelsSSE2,    Graphics::kRowKernelsSSE2 },
+	{ "avx2",    Graphics::kBlitKernelsAVX2,    Graphics::kRowKernelsAVX2 },
+	{ "neon",    Graphics::kBlitKernelsNEON,    Graphics::kRowKernelsNEON }
+};
+
+/** Whether both the build and the CPU have a kernel set. */
+bool hasKernels(int kernel) {
+#ifdef SCUMMVM_SSE2
+	if (kernels[kernel].blit == Graphics::kBlitKernelsSSE2 && instrset_detect() < 2)
+		return false;
+	if (kernels[kernel].blit == Graphics::kBlitKernelsAVX2 && instrset_detect() < 8)
+		return false;
+#endif
+	// Selecting the set reports whether it is compiled in, and the generic
+	// set is always the one left selected between benchmarks
+	const bool available = Graphics::setBlitKernels(kernels[kernel].blit);
+	Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+	return available;
+}
+
+// Containers
+
+class HashMapInsertBenchmark : public Benchmark {
+public:
+	HashMapInsertBenchmark() : Benchmark("hashmap.insert.1000", 0) {}
+
+	bool setUp() override {
+		for (int i = 0; i < 1000; i++)
+			_keys.push_back(Common::String::format("object%d", i * 7919));
+		return true;
+	}
+
+	void run() override {
+		Common::HashMap<Common::String, int> map;
+		for (uint i = 0; i < _keys.size(); i++)
+			map[_keys[i]] = i;
+		g_sink += map.size();
+	}
+
+private:
+	Common::Array<Common::String> _keys;
+};
+
+class HashMapLookupBenchmark : public Benchmark {
+public:
+	HashMapLookupBenchmark() : Benchmark("hashmap.lookup.1000", 0) {}
+
+	bool setUp() override {
+		for (int i = 0; i < 1000; i++) {
+			_keys.push_back(Common::String::format("object%d", i * 7919));
+			_map[_keys[i]] = i;
+		}
+		return true;
+	}
+
+	void run() override {
+		uint32 sum = 0;
+		for (uint i = 0; i < _keys.size(); i++)
+			sum += _map.getValOrDefault(_keys[i], 0);
+		g_sink += sum;
+	}
+
+private:
+	Common::Array<Common::String> _keys;
+	Common::HashMap<Common::String, int> _map;
+};
+
+class StringAppendBenchmark : public Benchmark {
+public:
+	StringAppendBenchmark() : Benchmark("string.append.1000", 1000 * 8) {}
+
+	void run() override {
+		Common::String str;
+		for (int i = 0; i < 1000; i++)
+			str += "abcdefgh";
+		g_sink += str.size();
+	}
+};
+
+class StringCompareBenchmark : public Benchmark {
+public:
+	StringCompareBenchmark() : Benchmark("string.compareIgnoreCase.1000", 0) {}
+
+	bool setUp() override {
+		for (int i = 0; i < 1000; i++) {
+			_names.push_back(Common::String::format("SCENE%04d.DAT", i));
+			_lowerNames.push_back(Common::String::format("scene%04d.dat", 999 - i));
+		}
+		return true;
+	}
+
+	void run() override {
+		uint32 equal = 0;
+		for (uint i = 0; i < _names.size(); i++)
+			equal += _names[i].equalsIgnoreCase(_lowerNames[_names.size() - 1 - i]);
+		g_sink += equal;
+	}
+
+private:
+	Common::Array<Common::String> _names, _lowerNames;
+};
+
+// Blitting
+
+class BlendBlitBenchmark : public Benchmark {
+public:
+	BlendBlitBenchmark(int kernel, bool scaled) :
+		Benchmark(Common::String::format("blendblit.%s.%s.256x256", scaled ? "scaled" : "normal", kernels[kernel].name), 256 * 256 * 4),
+		_kernel(kernel), _scaled(scaled) {}
+
+	bool setUp() override {
+		if (!hasKernels(_kernel) || !MicroBenchmark::setBlendBlitKernels(kernels[_kernel].blit))
+			return false;
+		const Graphics::PixelFormat format = Graphics::BlendBlit::getSupportedPixelFormat();
+		_src.create(256, 256, format);
+		_dst.create(256, 256, format);
+		fillPattern((byte *)_src.getPixels(), _src.pitch * _src.h, 1);
+		fillPattern((byte *)_dst.getPixels(), _dst.pitch * _dst.h, 2);
+		return true;
+	}
+
+	void run() override {
+		// Scaled blits read a 192x192 part of the source
+		const int scale = _scaled ? Graphics::BlendBlit::SCALE_THRESHOLD * 3 / 4 : Graphics::BlendBlit::SCALE_THRESHOLD;
+		Graphics::BlendBlit::blit((byte *)_dst.getPixels(), (const byte *)_src.getPixels(), _dst.pitch, _src.pitch,
+		                          0, 0, 256, 256, scale, scale, 0, 0, 0xffffffff, Graphics::FLIP_NONE,
+		                          Graphics::BLEND_NORMAL, Graphics::ALPHA_FULL);
+	}
+
+	void tearDown() override {
+		_src.free();
+		_dst.free();
+		MicroBenchmark::setBlendBlitKernels(Graphics::kBlitKernelsGeneric);
+	}
+
+private:
+	int _kernel;
+	bool _scaled;
+	Graphics::Surface _src, _dst;
+};
+
+class CrossBlitBenchmark : public Benchmark {
+public:
+	CrossBlitBenchmark(int kernel, const char *conversion, const Graphics::PixelFormat &srcFormat, const Graphics::PixelFormat &dstFormat) :
+		Benchmark(Common::String::format("crossblit.%s.%s.640x480", conversion, kernels[kernel].name), 640 * 480 * dstFormat.bytesPerPixel),
+		_kernel(kernel), _srcFormat(srcFormat), _dstFormat(dstFormat) {}
+
+	bool setUp() override {
+		if (!hasKernels(_kernel))
+			return false;
+		Graphics::setBlitKernels(kernels[_kernel].blit);
+		_src.create(640, 480, _srcFormat);
+		_dst.create(640, 480, _dstFormat);
+		fillPattern((byte *)_src.getPixels(), _src.pitch * _src.h, 3);
+		return true;
+	}
+
+	void run() override {
+		Graphics::crossBlit((byte *)_dst.getPixels(), (const byte *)_src.getPixels(), _dst.pitch, _src.pitch,
+		                    _src.w, _src.h, _dstFormat, _srcFormat);
+	}
+
+	void tearDown() override {
+		_src.free();
+		_dst.free();
+		Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+	}
+
+private:
+	int _kernel;
+	Graphics::PixelFormat _srcFormat, _dstFormat;
+	Graphics::Surface _src, _dst;
+};
+
+// Scalers
+
+template<class ScalerType>
+class ScalerBenchmark : public Benchmark {
+public:
+	ScalerBenchmark(const char *name, int kernel, uint factor) :
+		Benchmark(Common::String::format("scaler.%s%ux.%s.320x200", name, factor, kernels[kernel].name), 320 * 200 * factor * factor * 2),
+		_kernel(kernel), _factor(factor), _scaler(nullptr), _src(nullptr), _dst(nullptr) {}
+
+	bool setUp() override {
+		if (!hasKernels(_kernel) || !Graphics::setRowKernels(kernels[_kernel].row))
+			return false;
+		// The scalers read one pixel around the area
+		_src = new uint16[322 * 202];
+		_dst = new uint16[320 * 200 * _factor * _factor];
+		fillPattern((byte *)_src, 322 * 202 * 2, 4);
+		_scaler = new ScalerType(Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
+		_scaler->setFactor(_factor);
+		return true;
+	}
+
+	void run() override {
+		_scaler->scale((const uint8 *)(_src + 322 + 1), 322 * 2, (uint8 *)_dst, 320 * _factor * 2, 320, 200, 0, 0);
+	}
+
+	void tearDown() override {
+		delete _scaler;
+		delete[] _src;
+		delete[] _dst;
+		Graphics::setRowKernels(Graphics::kRowKernelsGeneric);
+	}
+
+private:
+	int _kernel;
+	uint _factor;
+	ScalerType *_scaler;
+	uint16 *_src, *_dst;
+};
+
+// Audio
+
+/** An endless saw wave. */
+class SawStream : public Audio::AudioStream {
+public:
+	SawStream(int rate, bool stereo) : _rate(rate), _stereo(stereo), _value(0) {}
+
+	int readBuffer(int16 *buffer, const int numSamples) override {
+		for (int i = 0; i < numSamples; i++) {
+			_value += 97;
+			buffer[i] = _value;
+		}
+		return numSamples;
+	}
+
+	bool isStereo() const override { return _stereo; }
+	int getRate() const override { return _rate; }
+	bool endOfData() const override { return false; }
+
+private:
+	int _rate;
+	bool _stereo;
+	int16 _value;
+};
+
+class RateBenchmark : public Benchmark {
+public:
+	RateBenchmark(const char *name, Audio::ResamplerType type, int inRate, bool stereo) :
+		Benchmark(Common::String::format("rate.%s.%d-44100.%s.4096", name, inRate, stereo ? "stereo" : "mono"), 4096 * 2 * 2),
+		_stream(inRate, stereo), _converter(nullptr) {
+		_type = type;
+		_inRate = inRate;
+		_stereo = stereo;
+	}
+
+	bool setUp() override {
+		_converter = Audio::makeRateConverter(_inRate, 44100, _stereo, true, false, _type);
+		return _converter != nullptr;
+	}
+
+	void run() override {
+		// The converter mixes into the buffer
+		memset(_out, 0, sizeof(_out));
+		_converter->convert(_stream, _out, 4096, Audio::Mixer::kMaxMixerVolume, Audio::Mixer::kMaxMixerVolume);
+	}
+
+	void tearDown() override {
+		delete _converter;
+	}
+
+private:
+	Audio::ResamplerType _type;
+	int _inRate;
+	bool _stereo;
+	SawStream _stream;
+	Audio::RateConverter *_converter;
+	int16 _out[4096 * 2];
+};
+
+/** Creates one of the emulators, only one of which can exist at a time. */
+template<class EmulatorType>
+EmulatorType *createOPL(OPL::Config::OplType type, bool simd);
+
+template<>
+OPL::MAME::OPL *createOPL(OPL::Config::OplType type, bool simd) { return new OPL::MAME::OPL(); }
+template<>
+OPL::DOSBox::OPL *createOPL(OPL::Config::OplType type, bool simd) { return new OPL::DOSBox::OPL(type); }
+#ifndef DISABLE_NUKED_OPL
+template<>
+OPL::NUKED::OPL *createOPL(OPL::Config::OplType type, bool simd) { return new OPL::NUKED::OPL(type, simd); }
+#endif
+
+template<class EmulatorType>
+class OPLBenchmark : public Benchmark {
+public:
+	OPLBenchmark(const char *name, OPL::Config::OplType type, bool stereo, bool simd = false) :
+		Benchmark(Common::String::format("opl.%s.4096", name), 4096 * 2 * (stereo ? 2 : 1)),
+		_type(type), _simd(simd), _opl(nullptr) {}
+
+	bool setUp() override {
+		_opl = createOPL<EmulatorType>(_type, _simd);
+		if (!_opl->init())
+			return false;
+		// Not started in the mixer, but readBuffer() steps by the ticks
+		_opl->setCallbackFrequency(::OPL::OPL::kDefaultCallbackFrequency);
+		// Nine melodic channels playing notes
+		_opl->writeReg(0x01, 0x20);
+		static const byte operators[9] = { 0x00, 0x01, 0x02, 0x08, 0x09, 0x0A, 0x10, 0x11, 0x12 };
+		for (int ch = 0; ch < 9; ch++) {
+			for (int op = 0; op < 2; op++) {
+				const int offset = operators[ch] + op * 3;
+				_opl->writeReg(0x20 + offset, 0x21);
+				_opl->writeReg(0x40 + offset, op ? 0x00 : 0x10);
+				_opl->writeReg(0x60 + offset, 0xF2);
+				_opl->writeReg(0x80 + offset, 0x54);
+			}
+			_opl->writeReg(0xC0 + ch, 0x06);
+			_opl->writeReg(0xA0 + ch, 0x41 + ch * 16);
+			_opl->writeReg(0xB0 + ch, 0x31);
+		}
+		return true;
+	}
+
+	void run() override {
+		_opl->readBuffer(_out, 4096 * (_opl->isStereo() ? 2 : 1));
+	}
+
+	void tearDown() override {
+		delete _opl;
+		_opl = nullptr;
+	}
+
+private:
+	OPL::Config::OplType _type;
+	bool _simd;
+	EmulatorType *_opl;
+	int16 _out[4096 * 2];
+};
+
+// Decompression
+
+#ifdef USE_ZLIB
+class InflateBenchmark : public Benchmark {
+public:
+	InflateBenchmark() : Benchmark("inflate.zlib.256k", kSize) {}
+
+	bool setUp() override {
+		fillPattern(_data, kSize, 5);
+		uLongf packedSize = compressBound(kSize);
+		_packed.resize(packedSize);
+		if (compress2(_packed.data(), &packedSize, _data, kSize, 6) != Z_OK)
+			return false;
+		_packed.resize(packedSize);
+		return true;
+	}
+
+	void run() override {
+		Common::inflateZlib(_data, (unsigned long)kSize, _packed.data(), _packed.size());
+	}
+
+private:
+	static const uint32 kSize = 256 * 1024;
+	byte _data[kSize];
+	Common::Array<byte> _packed;
+};
+#endif
+
+class DCLBenchmark : public Benchmark {
+public:
+	DCLBenchmark() : Benchmark("dcl.binary.64k", 0), _unpackedSize(0), _bits(0), _count(0) {}
+
+	bool setUp() override {
+		// Binary mode with a 1024 byte dictionary: 256 literals, and then
+		// groups of eight literals and a copy of 3 bytes from 255 bytes back
+		put(0, 8);
+		put(4, 8);
+		uint32 seed = 6;
+		while (_unpackedSize < 64 * 1024) {
+			const int literals = _unpackedSize ? 8 : 256;
+			for (int i = 0; i < literals; i++) {
+				seed = seed * 1103515245 + 12345;
+				put(0, 1);
+				put(seed >> 24, 8);
+			}
+			put(1, 1);
+			put(0x3, 2);
+			put(0x3A, 6);
+			put(14, 4);
+			_unpackedSize += literals + 3;
+		}
+		// The end of stream
+		put(1, 1);
+		put(0, 7);
+		put(0xFF, 8);
+		if (_count)
+			_packed.push_back(_bits);
+
+		_unpacked.resize(_unpackedSize);
+		setBytes(_unpackedSize);
+		return true;
+	}
+
+	void run() override {
+		Common::MemoryReadStream stream(_packed.data(), _packed.size());
+		g_sink += Common::decompressDCL(&stream, _unpacked.data(), _packed.size(), _unpackedSize);
+	}
+
+private:
+	void put(uint32 value, int n) {
+		for (int i = 0; i < n; i++) {
+			_bits |= ((value >> i) & 1) << _count;
+			if (++_count == 8) {
+				_packed.push_back(_bits);
+				_bits = 0;
+				_count = 0;
+			}
+		}
+	}
+
+	Common::Array<byte> _packed, _unpacked;
+	uint32 _unpackedSize;
+	uint32 _bits;
+	int _count;
+};
+
+// YUV conversion
+
+class YUVBenchmark : public Benchmark {
+public:
+	YUVBenchmark(const char *name, const Graphics::PixelFormat &format) :
+		Benchmark(Common::String::format("yuv420.%s.640x480", name), 640 * 480 * format.bytesPerPixel),
+		_format(format) {}
+
+	bool setUp() override {
+		_ySrc.resize(640 * 480);
+		_uSrc.resize(320 * 240);
+		_vSrc.resize(320 * 240);
+		fillPattern(_ySrc.data(), _ySrc.size(), 7);
+		fillPattern(_uSrc.data(), _uSrc.size(), 8);
+		fillPattern(_vSrc.data(), _vSrc.size(), 9);
+		_dst.create(640, 480, _format);
+		return true;
+	}
+
+	void run() override {
+		YUVToRGBMan.convert420(&_dst, Graphics::YUVToRGBManager::kScaleITU, _ySrc.data(), _uSrc.data(), _vSrc.data(),
+		                       640, 480, 640, 320);
+	}
+
+	void tearDown() override {
+		_dst.free();
+	}
+
+private:
+	Graphics::PixelFormat _format;
+	Common::Array<byte> _ySrc, _uSrc, _vSrc;
+	Graphics::Surface _dst;
+};
+
+// 3D math
+
+class Matrix4Benchmark : public Benchmark {
+public:
+	enum Operation {
+		kMultiply,
+		kInverse,
+		kTransformPoints
+	};
+
+	Matrix4Benchmark(const char *name, Operation operation) :
+		Benchmark(Common::String::format("matrix4.%s", name), operation == kTransformPoints ? kPoints * sizeof(Math::Vector3d) : 0),
+		_operation(operation) {}
+
+	bool setUp() override {
+		_matrix.buildAroundY(30);
+		_matrix.setPosition(Math::Vector3d(1.f, 2.f, 3.f));
+		for (uint i = 0; i < kPoints; i++)
+			_points[i].set(i * 0.5f, 1.f - i, i * 0.25f);
+		return true;
+	}
+
+	void run() override {
+		switch (_operation) {
+		case kMultiply:
+			_matrix = _matrix * _matrix;
+			_matrix.setPosition(Math::Vector3d(1.f, 2.f, 3.f));
+			break;
+		case kInverse:
+			g_sink += _matrix.inverse();
+			break;
+		case kTransformPoints:
+			_matrix.transformPoints(_points, _out, kPoints);
+			break;
+		}
+	}
+
+private:
+	static const uint kPoints = 1024;
+
+	Operation _operation;
+	Math::Matrix4 _matrix;
+	Math::Vector3d _points[kPoints], _out[kPoints];
+};
+
+void addBenchmarks(Common::Array<Benchmark *> &list) {
+	list.push_back(new HashMapInsertBenchmark());
+	list.push_back(new HashMapLookupBenchmark());
+	list.push_back(new StringAppendBenchmark());
+	list.push_back(new StringCompareBenchmark());
+
+	const Graphics::PixelFormat rgb555(2, 5, 5, 5, 0, 10, 5, 0, 0);
+	const Graphics::PixelFormat rgb565(2, 5, 6, 5, 0, 11, 5, 0, 0);
+	const Graphics::PixelFormat argb8888(4, 8, 8, 8, 8, 16, 8, 0, 24);
+	const Graphics::PixelFormat abgr8888(4, 8, 8, 8, 8, 0, 8, 16, 24);
+
+	for (int k = 0; k < ARRAYSIZE(kernels); k++) {
+		list.push_back(new BlendBlitBenchmark(k, false));
+		list.push_back(new BlendBlitBenchmark(k, true));
+		list.push_back(new CrossBlitBenchmark(k, "rgb555-rgb565", rgb555, rgb565));
+		list.push_back(new CrossBlitBenchmark(k, "rgb565-argb8888", rgb565, argb8888));
+		list.push_back(new CrossBlitBenchmark(k, "argb8888-rgb565", argb8888, rgb565));
+		list.push_back(new CrossBlitBenchmark(k, "argb8888-abgr8888", argb8888, abgr8888));
+	}
+
+	for (int k = 0; k < ARRAYSIZE(kernels); k++) {
+		for (uint factor = 2; factor <= 3; factor++) {
+			list.push_back(new ScalerBenchmark<NormalScaler>("normal", k, factor));
+#ifdef USE_HQ_SCALERS
+			list.push_back(new ScalerBenchmark<HQScaler>("hq", k, factor));
+#endif
+#ifdef USE_EDGE_SCALERS
+			list.push_back(new ScalerBenchmark<EdgeScaler>("edge", k, factor));
+#endif
+		}
+#ifdef USE_SCALERS
+		list.push_back(new ScalerBenchmark<SuperSAIScaler>("supersai", k, 2));
+#endif
+	}
+
+	list.push_back(new RateBenchmark("linear", Audio::kResamplerLinear, 22050, false));
+	list.push_back(new RateBenchmark("linear", Audio::kResamplerLinear, 22050, true));
+	list.push_back(new RateBenchmark("linear", Audio::kResamplerLinear, 44100, true));
+	list.push_back(new RateBenchmark("sinc", Audio::kResamplerSinc, 22050, false));
+	list.push_back(new RateBenchmark("sinc", Audio::kResamplerSinc, 22050, true));
+
+	list.push_back(new OPLBenchmark<OPL::MAME::OPL>("mame.opl2", OPL::Config::kOpl2, false));
+	list.push_back(new OPLBenchmark<OPL::DOSBox::OPL>("dosbox.opl2", OPL::Config::kOpl2, false));
+	list.push_back(new OPLBenchmark<OPL::DOSBox::OPL>("dosbox.opl3", OPL::Config::kOpl3, true));
+#ifndef DISABLE_NUKED_OPL
+	list.push_back(new OPLBenchmark<OPL::NUKED::OPL>("nuked.opl3", OPL::Config::kOpl3, true));
+	if (OPL::NUKED::OPL3_GetSIMDMixFunc())
+		list.push_back(new OPLBenchmark<OPL::NUKED::OPL>("nuked.opl3.simd", OPL::Config::kOpl3, true, true));
+#endif
+
+#ifdef USE_ZLIB
+	list.push_back(new InflateBenchmark());
+#endif
+	list.push_back(new DCLBenchmark());
+
+	list.push_back(new YUVBenchmark("rgb565", rgb565));
+	list.push_back(new YUVBenchmark("argb8888", argb8888));
+
+	list.push_back(new Matrix4Benchmark("multiply", Matrix4Benchmark::kMultiply));
+	list.push_back(new Matrix4Benchmark("inverse", Matrix4Benchmark::kInverse));
+	list.push_back(new Matrix4Benchmark("transformPoints.1024", Matrix4Benchmark::kTransformPoints));
+}
+
+/** The counts of Common::getCycleCount() in a millisecond. */
+double calibrateCycles() {
+	const uint32 start = g_system->getMillis();
+	while (g_system->getMillis() == start)
+		;
+	const uint32 begin = g_system->getMillis();
+	const uint64 beginCycles = Common::getCycleCount();
+	while (g_system->getMillis() - begin < 100)
+		;
+	return (double)(Common::getCycleCount() - beginCycles) / (g_system->getMillis() - begin);
+}
+
+/** The fastest time of an operation in nanoseconds over a number of batches. */
+double measure(Benchmark &benchmark, double cyclesPerMs, uint batches, uint batchMillis) {
+	// Warm up the caches, and estimate how many operations fill a batch
+	uint64 start = Common::getCycleCount();
+	benchmark.run();
+	const uint64 once = MAX<uint64>(Common::getCycleCount() - start, 1);
+	const uint64 iterations = CLIP<uint64>((uint64)(batchMillis * cyclesPerMs / once), 1, 1000000);
+
+	double best = -1.0;
+	for (uint b = 0; b < batches; b++) {
+		start = Common::getCycleCount();
+		for (uint64 i = 0; i < iterations; i++)
+			benchmark.run();
+		const double ns = (Common::getCycleCount() - start) * 1000000.0 / cyclesPerMs / iterations;
+		if (best < 0.0 || ns < best)
+			best = ns;
+	}
+	return best;
+}
+
+void usage() {
+	fprintf(stderr,
+	        "Usage: microbench [options]\n"
+	        "  --filter <text>    Only run the benchmarks with the text in their name\n"
+	        "  --batches <n>      Number of measured batches, the fastest is reported (5)\n"
+	        "  --time <ms>        Length of a batch (20)\n"
+	        "  --list             List the benchmarks and exit\n");
+}
+
+} // End of anonymous namespace
+
+int main(int argc, char *argv[]) {
+	const char *filter = nullptr;
+	uint batches = 5;
+	uint batchMillis = 20;
+	bool listOnly = false;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--filter") && i + 1 < argc) {
+			filter = argv[++i];
+		} else if (!strcmp(argv[i], "--batches") && i + 1 < argc) {
+			batches = MAX(atoi(argv[++i]), 1);
+		} else if (!strcmp(argv[i], "--time") && i + 1 < argc) {
+			batchMillis = MAX(atoi(argv[++i]), 1);
+		} else if (!strcmp(argv[i], "--list")) {
+			listOnly = true;
+		} else {
+			usage();
+			return 1;
+		}
+	}
+
+	BenchSystem *system = new BenchSystem();
+	g_system = system;
+	system->initManagers();
+	Graphics::setBlitKernels(Graphics::kBlitKernelsGeneric);
+	Graphics::setRowKernels(Graphics::kRowKernelsGeneric);
+
+	Common::Array<Benchmark *> list;
+	addBenchmarks(list);
+
+	const double cyclesPerMs = listOnly ? 0.0 : calibrateCycles();
+	if (!listOnly)
+		printf("# benchmark\tns/op\tMB/s\n");
+
+	for (uint i = 0; i < list.size(); i++) {
+		Benchmark &benchmark = *list[i];
+		if (filter && !strstr(benchmark.getName().c_str(), filter))
+			continue;
+		if (listOnly) {
+			printf("%s\n", benchmark.getName().c_str());
+			continue;
+		}
+		if (!benchmark.setUp()) {
+			benchmark.tearDown();
+			continue;
+		}
+
+		const double ns = measure(benchmark, cyclesPerMs, batches, batchMillis);
+		const uint64 bytes = benchmark.getBytes();
+		printf("%s\t%.1f\t%.1f\n", benchmark.getName().c_str(), ns, bytes ? bytes * 1000.0 / ns : 0.0);
+		fflush(stdout);
+		benchmark.tearDown();
+	}
+
+	for (uint i = 0; i < list.size(); i++)
+		delete list[i];
+	g_system->destroy();
+	return 0;
+}
@@ -5,7 +5,7 @@
 #
 ######################################################################
 
-TESTS        := $(srcdir)/test/common/*.h $(srcdir)/test/common/formats/*.h $(srcdir)/test/audio/*.h $(srcdir)/test/math/*.h $(srcdir)/test/image/*.h
+TESTS        := $(srcdir)/test/common/*.h $(srcdir)/test/common/formats/*.h $(srcdir)/test/common/compression/*.h $(srcdir)/test/audio/*.h $(srcdir)/test/math/*.h $(srcdir)/test/image/*.h $(srcdir)/test/graphics/*.h
 TEST_LIBS    :=
 
 ifdef POSIX
@@ -15,7 +15,8 @@ TEST_LIBS += test/null_osystem.o \
 	backends/fs/posix/posix-iostream.o \
 	backends/fs/abstract-fs.o \
 	backends/fs/stdiostream.o \
-	backends/modular-backend.o
+	backends/modular-backend.o \
+	backends/timer/default/default-timer.o
 endif
 
 ifdef WIN32
@@ -25,6 +26,7 @@ TEST_LIBS += test/null_osystem.o \
 	backends/fs/abstract-fs.o \
 	backends/fs/stdiostream.o \
 	backends/modular-backend.o \
+	backends/timer/default/default-timer.o \
 	backends/platform/sdl/win32/win32_wrapper.o
 endif
 
@@ -79,9 +81,26 @@ test/runner.cpp: $(TESTS) $(srcdir)/test/module.mk
 	@mkdir -p test
 	$(srcdir)/test/cxxtest/cxxtestgen.py $(TEST_FLAGS) -o $@ $+
 
+# Decoding benchmark of the videos, see test/videobench.cpp. It includes
+# the null backend itself, so it doesn't link test/null_osystem.o.
+VIDEOBENCH_LIBS := video/libvideo.a backends/mixer/null/null-mixer.o $(filter-out test/null_osystem.o,$(TEST_LIBS)) common/formats/libformats.a common/libcommon.a image/libimage.a
+
+videobench: test/videobench
+test/videobench: $(srcdir)/test/videobench.cpp $(VIDEOBENCH_LIBS)
+	+$(QUIET_CXX)$(LD) $(TEST_CXXFLAGS) $(CPPFLAGS) $(TEST_CFLAGS) -I$(srcdir)/test -o $@ $(srcdir)/test/videobench.cpp $(VIDEOBENCH_LIBS) $(TEST_LDFLAGS)
+
+# Micro-benchmarks of the shared code, see test/microbench.cpp. 'make bench'
+# builds and runs them; pass the options with BENCH_FLAGS.
+MICROBENCH_LIBS := backends/mixer/null/null-mixer.o $(filter-out test/null_osystem.o,$(TEST_LIBS)) common/libcommon.a
+
+bench: test/microbench
+	./test/microbench $(BENCH_FLAGS)
+test/microbench: $(srcdir)/test/microbench.cpp $(MICROBENCH_LIBS)
+	+$(QUIET_CXX)$(LD) $(TEST_CXXFLAGS) $(CPPFLAGS) $(TEST_CFLAGS) -I$(srcdir)/test -o $@ $(srcdir)/test/microbench.cpp $(MICROBENCH_LIBS) $(TEST_LDFLAGS)
+
 clean: clean-test
 clean-test:
-	-$(RM) test/runner.cpp test/runner test/engine-data/encoding.dat test/null_osystem.o
+	-$(RM) test/runner.cpp test/runner test/videobench test/microbench test/engine-data/encoding.dat test/null_osystem.o
 	-rmdir test/engine-data
 
 test/engine-data/encoding.dat: $(srcdir)/dists/engine-data/encoding.dat
@@ -90,4 +109,4 @@ test/engine-data/encoding.dat: $(srcdir)/dists/engine-data/encoding.dat
 
 copy-dat: test/engine-data/encoding.dat
 
-.PHONY: test clean-test copy-dat
+.PHONY: test videobench bench clean-test copy-dat
@@ -0,0 +1,3617 @@
+/* Generated file, do not edit */
+
+#ifndef CXXTEST_RUNNING
+#define CXXTEST_RUNNING
+#endif
+
+#define _CXXTEST_HAVE_STD
+#include <cxxtest/TestListener.h>
+#include <cxxtest/TestTracker.h>
+#include <cxxtest/TestRunner.h>
+#include <cxxtest/RealDescriptions.h>
+#include <cxxtest/StdioPrinter.h>
+
+int main() {
+ return CxxTest::StdioPrinter().run();
+}
+#include "test/common/algorithm.h"
+
+static AlgorithmTestSuite suite_AlgorithmTestSuite;
+
+static CxxTest::List Tests_AlgorithmTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_AlgorithmTestSuite( "test/common/algorithm.h", 10, "AlgorithmTestSuite", suite_AlgorithmTestSuite, Tests_AlgorithmTestSuite );
+
+static class TestDescription_AlgorithmTestSuite_test_check_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_check_sort() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 67, "test_check_sort" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_check_sort(); }
+} testDescription_AlgorithmTestSuite_test_check_sort;
+
+static class TestDescription_AlgorithmTestSuite_test_pod_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_pod_sort() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 78, "test_pod_sort" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_pod_sort(); }
+} testDescription_AlgorithmTestSuite_test_pod_sort;
+
+static class TestDescription_AlgorithmTestSuite_test_container_sort : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_container_sort() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 116, "test_container_sort" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_container_sort(); }
+} testDescription_AlgorithmTestSuite_test_container_sort;
+
+static class TestDescription_AlgorithmTestSuite_test_string_replace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_string_replace() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 131, "test_string_replace" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_string_replace(); }
+} testDescription_AlgorithmTestSuite_test_string_replace;
+
+static class TestDescription_AlgorithmTestSuite_test_container_replace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_container_replace() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 141, "test_container_replace" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_container_replace(); }
+} testDescription_AlgorithmTestSuite_test_container_replace;
+
+static class TestDescription_AlgorithmTestSuite_test_container_remove : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_container_remove() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 159, "test_container_remove" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_container_remove(); }
+} testDescription_AlgorithmTestSuite_test_container_remove;
+
+static class TestDescription_AlgorithmTestSuite_test_lower_bound_equal_found : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_lower_bound_equal_found() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 186, "test_lower_bound_equal_found" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_lower_bound_equal_found(); }
+} testDescription_AlgorithmTestSuite_test_lower_bound_equal_found;
+
+static class TestDescription_AlgorithmTestSuite_test_lower_bound_greater_found : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_lower_bound_greater_found() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 200, "test_lower_bound_greater_found" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_lower_bound_greater_found(); }
+} testDescription_AlgorithmTestSuite_test_lower_bound_greater_found;
+
+static class TestDescription_AlgorithmTestSuite_test_lower_bound_element_nothing_found : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_lower_bound_element_nothing_found() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 214, "test_lower_bound_element_nothing_found" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_lower_bound_element_nothing_found(); }
+} testDescription_AlgorithmTestSuite_test_lower_bound_element_nothing_found;
+
+static class TestDescription_AlgorithmTestSuite_test_lower_bound_empty_input : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_lower_bound_empty_input() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 221, "test_lower_bound_empty_input" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_lower_bound_empty_input(); }
+} testDescription_AlgorithmTestSuite_test_lower_bound_empty_input;
+
+static class TestDescription_AlgorithmTestSuite_test_upper_bound_element_found : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_upper_bound_element_found() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 234, "test_upper_bound_element_found" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_upper_bound_element_found(); }
+} testDescription_AlgorithmTestSuite_test_upper_bound_element_found;
+
+static class TestDescription_AlgorithmTestSuite_test_upper_bound_nothing_found : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_upper_bound_nothing_found() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 248, "test_upper_bound_nothing_found" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_upper_bound_nothing_found(); }
+} testDescription_AlgorithmTestSuite_test_upper_bound_nothing_found;
+
+static class TestDescription_AlgorithmTestSuite_test_upper_bound_empty_input : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AlgorithmTestSuite_test_upper_bound_empty_input() : CxxTest::RealTestDescription( Tests_AlgorithmTestSuite, suiteDescription_AlgorithmTestSuite, 261, "test_upper_bound_empty_input" ) {}
+ void runTest() { suite_AlgorithmTestSuite.test_upper_bound_empty_input(); }
+} testDescription_AlgorithmTestSuite_test_upper_bound_empty_input;
+
+#include "test/common/arena.h"
+
+static ArenaTestSuite suite_ArenaTestSuite;
+
+static CxxTest::List Tests_ArenaTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ArenaTestSuite( "test/common/arena.h", 13, "ArenaTestSuite", suite_ArenaTestSuite, Tests_ArenaTestSuite );
+
+static class TestDescription_ArenaTestSuite_test_alignment : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArenaTestSuite_test_alignment() : CxxTest::RealTestDescription( Tests_ArenaTestSuite, suiteDescription_ArenaTestSuite, 15, "test_alignment" ) {}
+ void runTest() { suite_ArenaTestSuite.test_alignment(); }
+} testDescription_ArenaTestSuite_test_alignment;
+
+static class TestDescription_ArenaTestSuite_test_big_allocations : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArenaTestSuite_test_big_allocations() : CxxTest::RealTestDescription( Tests_ArenaTestSuite, suiteDescription_ArenaTestSuite, 29, "test_big_allocations" ) {}
+ void runTest() { suite_ArenaTestSuite.test_big_allocations(); }
+} testDescription_ArenaTestSuite_test_big_allocations;
+
+static class TestDescription_ArenaTestSuite_test_reset_merges_blocks : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArenaTestSuite_test_reset_merges_blocks() : CxxTest::RealTestDescription( Tests_ArenaTestSuite, suiteDescription_ArenaTestSuite, 41, "test_reset_merges_blocks" ) {}
+ void runTest() { suite_ArenaTestSuite.test_reset_merges_blocks(); }
+} testDescription_ArenaTestSuite_test_reset_merges_blocks;
+
+static class TestDescription_ArenaTestSuite_test_destructors_run_on_reset : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArenaTestSuite_test_destructors_run_on_reset() : CxxTest::RealTestDescription( Tests_ArenaTestSuite, suiteDescription_ArenaTestSuite, 58, "test_destructors_run_on_reset" ) {}
+ void runTest() { suite_ArenaTestSuite.test_destructors_run_on_reset(); }
+} testDescription_ArenaTestSuite_test_destructors_run_on_reset;
+
+static class TestDescription_ArenaTestSuite_test_copy_string : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArenaTestSuite_test_copy_string() : CxxTest::RealTestDescription( Tests_ArenaTestSuite, suiteDescription_ArenaTestSuite, 76, "test_copy_string" ) {}
+ void runTest() { suite_ArenaTestSuite.test_copy_string(); }
+} testDescription_ArenaTestSuite_test_copy_string;
+
+static class TestDescription_ArenaTestSuite_test_frame_allocator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArenaTestSuite_test_frame_allocator() : CxxTest::RealTestDescription( Tests_ArenaTestSuite, suiteDescription_ArenaTestSuite, 85, "test_frame_allocator" ) {}
+ void runTest() { suite_ArenaTestSuite.test_frame_allocator(); }
+} testDescription_ArenaTestSuite_test_frame_allocator;
+
+static class TestDescription_ArenaTestSuite_test_arena_array : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArenaTestSuite_test_arena_array() : CxxTest::RealTestDescription( Tests_ArenaTestSuite, suiteDescription_ArenaTestSuite, 102, "test_arena_array" ) {}
+ void runTest() { suite_ArenaTestSuite.test_arena_array(); }
+} testDescription_ArenaTestSuite_test_arena_array;
+
+#include "test/common/array.h"
+
+static ArrayTestSuite suite_ArrayTestSuite;
+
+static CxxTest::List Tests_ArrayTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ArrayTestSuite( "test/common/array.h", 41, "ArrayTestSuite", suite_ArrayTestSuite, Tests_ArrayTestSuite );
+
+static class TestDescription_ArrayTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 44, "test_empty_clear" ) {}
+ void runTest() { suite_ArrayTestSuite.test_empty_clear(); }
+} testDescription_ArrayTestSuite_test_empty_clear;
+
+static class TestDescription_ArrayTestSuite_test_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_iterator() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 54, "test_iterator" ) {}
+ void runTest() { suite_ArrayTestSuite.test_iterator(); }
+} testDescription_ArrayTestSuite_test_iterator;
+
+static class TestDescription_ArrayTestSuite_test_erase_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_erase_iterator() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 82, "test_erase_iterator" ) {}
+ void runTest() { suite_ArrayTestSuite.test_erase_iterator(); }
+} testDescription_ArrayTestSuite_test_erase_iterator;
+
+static class TestDescription_ArrayTestSuite_test_erase_iterator_range : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_erase_iterator_range() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 102, "test_erase_iterator_range" ) {}
+ void runTest() { suite_ArrayTestSuite.test_erase_iterator_range(); }
+} testDescription_ArrayTestSuite_test_erase_iterator_range;
+
+static class TestDescription_ArrayTestSuite_test_insert_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_insert_iterator() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 127, "test_insert_iterator" ) {}
+ void runTest() { suite_ArrayTestSuite.test_insert_iterator(); }
+} testDescription_ArrayTestSuite_test_insert_iterator;
+
+static class TestDescription_ArrayTestSuite_test_direct_access : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_direct_access() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 149, "test_direct_access" ) {}
+ void runTest() { suite_ArrayTestSuite.test_direct_access(); }
+} testDescription_ArrayTestSuite_test_direct_access;
+
+static class TestDescription_ArrayTestSuite_test_insert_at : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_insert_at() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 162, "test_insert_at" ) {}
+ void runTest() { suite_ArrayTestSuite.test_insert_at(); }
+} testDescription_ArrayTestSuite_test_insert_at;
+
+static class TestDescription_ArrayTestSuite_test_insert_at_array : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_insert_at_array() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 183, "test_insert_at_array" ) {}
+ void runTest() { suite_ArrayTestSuite.test_insert_at_array(); }
+} testDescription_ArrayTestSuite_test_insert_at_array;
+
+static class TestDescription_ArrayTestSuite_test_self_insert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_self_insert() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 212, "test_self_insert" ) {}
+ void runTest() { suite_ArrayTestSuite.test_self_insert(); }
+} testDescription_ArrayTestSuite_test_self_insert;
+
+static class TestDescription_ArrayTestSuite_test_remove_at : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_remove_at() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 241, "test_remove_at" ) {}
+ void runTest() { suite_ArrayTestSuite.test_remove_at(); }
+} testDescription_ArrayTestSuite_test_remove_at;
+
+static class TestDescription_ArrayTestSuite_test_push_back : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_push_back() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 262, "test_push_back" ) {}
+ void runTest() { suite_ArrayTestSuite.test_push_back(); }
+} testDescription_ArrayTestSuite_test_push_back;
+
+static class TestDescription_ArrayTestSuite_test_push_back_ex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_push_back_ex() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 297, "test_push_back_ex" ) {}
+ void runTest() { suite_ArrayTestSuite.test_push_back_ex(); }
+} testDescription_ArrayTestSuite_test_push_back_ex;
+
+static class TestDescription_ArrayTestSuite_test_copy_constructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_copy_constructor() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 310, "test_copy_constructor" ) {}
+ void runTest() { suite_ArrayTestSuite.test_copy_constructor(); }
+} testDescription_ArrayTestSuite_test_copy_constructor;
+
+static class TestDescription_ArrayTestSuite_test_equals : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_equals() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 332, "test_equals" ) {}
+ void runTest() { suite_ArrayTestSuite.test_equals(); }
+} testDescription_ArrayTestSuite_test_equals;
+
+static class TestDescription_ArrayTestSuite_test_array_constructor : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_array_constructor() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 349, "test_array_constructor" ) {}
+ void runTest() { suite_ArrayTestSuite.test_array_constructor(); }
+} testDescription_ArrayTestSuite_test_array_constructor;
+
+static class TestDescription_ArrayTestSuite_test_array_constructor_count : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_array_constructor_count() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 373, "test_array_constructor_count" ) {}
+ void runTest() { suite_ArrayTestSuite.test_array_constructor_count(); }
+} testDescription_ArrayTestSuite_test_array_constructor_count;
+
+static class TestDescription_ArrayTestSuite_test_array_constructor_list : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_array_constructor_list() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 384, "test_array_constructor_list" ) {}
+ void runTest() { suite_ArrayTestSuite.test_array_constructor_list(); }
+} testDescription_ArrayTestSuite_test_array_constructor_list;
+
+static class TestDescription_ArrayTestSuite_test_array_constructor_count_copy_value : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_array_constructor_count_copy_value() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 392, "test_array_constructor_count_copy_value" ) {}
+ void runTest() { suite_ArrayTestSuite.test_array_constructor_count_copy_value(); }
+} testDescription_ArrayTestSuite_test_array_constructor_count_copy_value;
+
+static class TestDescription_ArrayTestSuite_test_array_constructor_str : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_array_constructor_str() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 416, "test_array_constructor_str" ) {}
+ void runTest() { suite_ArrayTestSuite.test_array_constructor_str(); }
+} testDescription_ArrayTestSuite_test_array_constructor_str;
+
+static class TestDescription_ArrayTestSuite_test_data : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_data() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 428, "test_data" ) {}
+ void runTest() { suite_ArrayTestSuite.test_data(); }
+} testDescription_ArrayTestSuite_test_data;
+
+static class TestDescription_ArrayTestSuite_test_front_back_push_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_front_back_push_pop() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 437, "test_front_back_push_pop" ) {}
+ void runTest() { suite_ArrayTestSuite.test_front_back_push_pop(); }
+} testDescription_ArrayTestSuite_test_front_back_push_pop;
+
+static class TestDescription_ArrayTestSuite_test_resize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_resize() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 456, "test_resize" ) {}
+ void runTest() { suite_ArrayTestSuite.test_resize(); }
+} testDescription_ArrayTestSuite_test_resize;
+
+static class TestDescription_ArrayTestSuite_test_swap : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_swap() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 492, "test_swap" ) {}
+ void runTest() { suite_ArrayTestSuite.test_swap(); }
+} testDescription_ArrayTestSuite_test_swap;
+
+static class TestDescription_ArrayTestSuite_test_insert_in_reserved_space : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_insert_in_reserved_space() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 520, "test_insert_in_reserved_space" ) {}
+ void runTest() { suite_ArrayTestSuite.test_insert_in_reserved_space(); }
+} testDescription_ArrayTestSuite_test_insert_in_reserved_space;
+
+static class TestDescription_ArrayTestSuite_test_insert_move : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ArrayTestSuite_test_insert_move() : CxxTest::RealTestDescription( Tests_ArrayTestSuite, suiteDescription_ArrayTestSuite, 539, "test_insert_move" ) {}
+ void runTest() { suite_ArrayTestSuite.test_insert_move(); }
+} testDescription_ArrayTestSuite_test_insert_move;
+
+static SmallArrayTestSuite suite_SmallArrayTestSuite;
+
+static CxxTest::List Tests_SmallArrayTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SmallArrayTestSuite( "test/common/array.h", 556, "SmallArrayTestSuite", suite_SmallArrayTestSuite, Tests_SmallArrayTestSuite );
+
+static class TestDescription_SmallArrayTestSuite_test_inline_storage : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SmallArrayTestSuite_test_inline_storage() : CxxTest::RealTestDescription( Tests_SmallArrayTestSuite, suiteDescription_SmallArrayTestSuite, 558, "test_inline_storage" ) {}
+ void runTest() { suite_SmallArrayTestSuite.test_inline_storage(); }
+} testDescription_SmallArrayTestSuite_test_inline_storage;
+
+static class TestDescription_SmallArrayTestSuite_test_insert_remove : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SmallArrayTestSuite_test_insert_remove() : CxxTest::RealTestDescription( Tests_SmallArrayTestSuite, suiteDescription_SmallArrayTestSuite, 573, "test_insert_remove" ) {}
+ void runTest() { suite_SmallArrayTestSuite.test_insert_remove(); }
+} testDescription_SmallArrayTestSuite_test_insert_remove;
+
+static class TestDescription_SmallArrayTestSuite_test_copy_move : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SmallArrayTestSuite_test_copy_move() : CxxTest::RealTestDescription( Tests_SmallArrayTestSuite, suiteDescription_SmallArrayTestSuite, 594, "test_copy_move" ) {}
+ void runTest() { suite_SmallArrayTestSuite.test_copy_move(); }
+} testDescription_SmallArrayTestSuite_test_copy_move;
+
+static class TestDescription_SmallArrayTestSuite_test_resize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SmallArrayTestSuite_test_resize() : CxxTest::RealTestDescription( Tests_SmallArrayTestSuite, suiteDescription_SmallArrayTestSuite, 620, "test_resize" ) {}
+ void runTest() { suite_SmallArrayTestSuite.test_resize(); }
+} testDescription_SmallArrayTestSuite_test_resize;
+
+static SortedArrayTestSuite suite_SortedArrayTestSuite;
+
+static CxxTest::List Tests_SortedArrayTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SortedArrayTestSuite( "test/common/array.h", 649, "SortedArrayTestSuite", suite_SortedArrayTestSuite, Tests_SortedArrayTestSuite );
+
+static class TestDescription_SortedArrayTestSuite_test_insert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SortedArrayTestSuite_test_insert() : CxxTest::RealTestDescription( Tests_SortedArrayTestSuite, suiteDescription_SortedArrayTestSuite, 651, "test_insert" ) {}
+ void runTest() { suite_SortedArrayTestSuite.test_insert(); }
+} testDescription_SortedArrayTestSuite_test_insert;
+
+static class TestDescription_SortedArrayTestSuite_test_stability : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SortedArrayTestSuite_test_stability() : CxxTest::RealTestDescription( Tests_SortedArrayTestSuite, suiteDescription_SortedArrayTestSuite, 682, "test_stability" ) {}
+ void runTest() { suite_SortedArrayTestSuite.test_stability(); }
+} testDescription_SortedArrayTestSuite_test_stability;
+
+static class TestDescription_SortedArrayTestSuite_test_emplace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SortedArrayTestSuite_test_emplace() : CxxTest::RealTestDescription( Tests_SortedArrayTestSuite, suiteDescription_SortedArrayTestSuite, 713, "test_emplace" ) {}
+ void runTest() { suite_SortedArrayTestSuite.test_emplace(); }
+} testDescription_SortedArrayTestSuite_test_emplace;
+
+static class TestDescription_SortedArrayTestSuite_test_push_back_move : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SortedArrayTestSuite_test_push_back_move() : CxxTest::RealTestDescription( Tests_SortedArrayTestSuite, suiteDescription_SortedArrayTestSuite, 723, "test_push_back_move" ) {}
+ void runTest() { suite_SortedArrayTestSuite.test_push_back_move(); }
+} testDescription_SortedArrayTestSuite_test_push_back_move;
+
+#include "test/common/base64.h"
+
+static Base64TestSuite suite_Base64TestSuite;
+
+static CxxTest::List Tests_Base64TestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_Base64TestSuite( "test/common/base64.h", 45, "Base64TestSuite", suite_Base64TestSuite, Tests_Base64TestSuite );
+
+static class TestDescription_Base64TestSuite_test_b64Validate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Base64TestSuite_test_b64Validate() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 47, "test_b64Validate" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64Validate(); }
+} testDescription_Base64TestSuite_test_b64Validate;
+
+static class TestDescription_Base64TestSuite_test_b64EncodeString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Base64TestSuite_test_b64EncodeString() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 61, "test_b64EncodeString" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64EncodeString(); }
+} testDescription_Base64TestSuite_test_b64EncodeString;
+
+static class TestDescription_Base64TestSuite_test_b64EncodeStream : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Base64TestSuite_test_b64EncodeStream() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 69, "test_b64EncodeStream" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64EncodeStream(); }
+} testDescription_Base64TestSuite_test_b64EncodeStream;
+
+static class TestDescription_Base64TestSuite_test_b64EncodeData : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Base64TestSuite_test_b64EncodeData() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 77, "test_b64EncodeData" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64EncodeData(); }
+} testDescription_Base64TestSuite_test_b64EncodeData;
+
+static class TestDescription_Base64TestSuite_test_b64DecodeString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Base64TestSuite_test_b64DecodeString() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 90, "test_b64DecodeString" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64DecodeString(); }
+} testDescription_Base64TestSuite_test_b64DecodeString;
+
+static class TestDescription_Base64TestSuite_test_b64DecodeStream : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Base64TestSuite_test_b64DecodeStream() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 98, "test_b64DecodeStream" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64DecodeStream(); }
+} testDescription_Base64TestSuite_test_b64DecodeStream;
+
+static class TestDescription_Base64TestSuite_test_b64DecodeData : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Base64TestSuite_test_b64DecodeData() : CxxTest::RealTestDescription( Tests_Base64TestSuite, suiteDescription_Base64TestSuite, 114, "test_b64DecodeData" ) {}
+ void runTest() { suite_Base64TestSuite.test_b64DecodeData(); }
+} testDescription_Base64TestSuite_test_b64DecodeData;
+
+#include "test/common/bitstream.h"
+
+static BitStreamTestSuite suite_BitStreamTestSuite;
+
+static CxxTest::List Tests_BitStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BitStreamTestSuite( "test/common/bitstream.h", 6, "BitStreamTestSuite", suite_BitStreamTestSuite, Tests_BitStreamTestSuite );
+
+static class TestDescription_BitStreamTestSuite_test_get_bit : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_get_bit() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 24, "test_get_bit" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_get_bit(); }
+} testDescription_BitStreamTestSuite_test_get_bit;
+
+static class TestDescription_BitStreamTestSuite_test_get_bits : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_get_bits() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 45, "test_get_bits" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_get_bits(); }
+} testDescription_BitStreamTestSuite_test_get_bits;
+
+static class TestDescription_BitStreamTestSuite_test_skip : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_skip() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 69, "test_skip" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_skip(); }
+} testDescription_BitStreamTestSuite_test_skip;
+
+static class TestDescription_BitStreamTestSuite_test_rewind : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_rewind() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 93, "test_rewind" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_rewind(); }
+} testDescription_BitStreamTestSuite_test_rewind;
+
+static class TestDescription_BitStreamTestSuite_test_peek_bit : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_peek_bit() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 116, "test_peek_bit" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_peek_bit(); }
+} testDescription_BitStreamTestSuite_test_peek_bit;
+
+static class TestDescription_BitStreamTestSuite_test_peek_bits : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_peek_bits() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 142, "test_peek_bits" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_peek_bits(); }
+} testDescription_BitStreamTestSuite_test_peek_bits;
+
+static class TestDescription_BitStreamTestSuite_test_eos : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_eos() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 165, "test_eos" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_eos(); }
+} testDescription_BitStreamTestSuite_test_eos;
+
+static class TestDescription_BitStreamTestSuite_test_get_bits_lsb : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_get_bits_lsb() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 186, "test_get_bits_lsb" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_get_bits_lsb(); }
+} testDescription_BitStreamTestSuite_test_get_bits_lsb;
+
+static class TestDescription_BitStreamTestSuite_test_peek_bits_lsb : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_peek_bits_lsb() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 212, "test_peek_bits_lsb" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_peek_bits_lsb(); }
+} testDescription_BitStreamTestSuite_test_peek_bits_lsb;
+
+static class TestDescription_BitStreamTestSuite_test_align : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_align() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 233, "test_align" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_align(); }
+} testDescription_BitStreamTestSuite_test_align;
+
+static class TestDescription_BitStreamTestSuite_test_align_16 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_align_16() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 254, "test_align_16" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_align_16(); }
+} testDescription_BitStreamTestSuite_test_align_16;
+
+static class TestDescription_BitStreamTestSuite_test_memory_refill : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BitStreamTestSuite_test_memory_refill() : CxxTest::RealTestDescription( Tests_BitStreamTestSuite, suiteDescription_BitStreamTestSuite, 284, "test_memory_refill" ) {}
+ void runTest() { suite_BitStreamTestSuite.test_memory_refill(); }
+} testDescription_BitStreamTestSuite_test_memory_refill;
+
+#include "test/common/bufferedreadstream.h"
+
+static BufferedReadStreamTestSuite suite_BufferedReadStreamTestSuite;
+
+static CxxTest::List Tests_BufferedReadStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BufferedReadStreamTestSuite( "test/common/bufferedreadstream.h", 6, "BufferedReadStreamTestSuite", suite_BufferedReadStreamTestSuite, Tests_BufferedReadStreamTestSuite );
+
+static class TestDescription_BufferedReadStreamTestSuite_test_traverse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BufferedReadStreamTestSuite_test_traverse() : CxxTest::RealTestDescription( Tests_BufferedReadStreamTestSuite, suiteDescription_BufferedReadStreamTestSuite, 8, "test_traverse" ) {}
+ void runTest() { suite_BufferedReadStreamTestSuite.test_traverse(); }
+} testDescription_BufferedReadStreamTestSuite_test_traverse;
+
+static class TestDescription_BufferedReadStreamTestSuite_test_traverse2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BufferedReadStreamTestSuite_test_traverse2() : CxxTest::RealTestDescription( Tests_BufferedReadStreamTestSuite, suiteDescription_BufferedReadStreamTestSuite, 34, "test_traverse2" ) {}
+ void runTest() { suite_BufferedReadStreamTestSuite.test_traverse2(); }
+} testDescription_BufferedReadStreamTestSuite_test_traverse2;
+
+#include "test/common/bufferedseekablereadstream.h"
+
+static BufferedSeekableReadStreamTestSuite suite_BufferedSeekableReadStreamTestSuite;
+
+static CxxTest::List Tests_BufferedSeekableReadStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BufferedSeekableReadStreamTestSuite( "test/common/bufferedseekablereadstream.h", 6, "BufferedSeekableReadStreamTestSuite", suite_BufferedSeekableReadStreamTestSuite, Tests_BufferedSeekableReadStreamTestSuite );
+
+static class TestDescription_BufferedSeekableReadStreamTestSuite_test_traverse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BufferedSeekableReadStreamTestSuite_test_traverse() : CxxTest::RealTestDescription( Tests_BufferedSeekableReadStreamTestSuite, suiteDescription_BufferedSeekableReadStreamTestSuite, 8, "test_traverse" ) {}
+ void runTest() { suite_BufferedSeekableReadStreamTestSuite.test_traverse(); }
+} testDescription_BufferedSeekableReadStreamTestSuite_test_traverse;
+
+static class TestDescription_BufferedSeekableReadStreamTestSuite_test_seek : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BufferedSeekableReadStreamTestSuite_test_seek() : CxxTest::RealTestDescription( Tests_BufferedSeekableReadStreamTestSuite, suiteDescription_BufferedSeekableReadStreamTestSuite, 33, "test_seek" ) {}
+ void runTest() { suite_BufferedSeekableReadStreamTestSuite.test_seek(); }
+} testDescription_BufferedSeekableReadStreamTestSuite_test_seek;
+
+#include "test/common/config-manager.h"
+
+static ConfigManagerTestSuite suite_ConfigManagerTestSuite;
+
+static CxxTest::List Tests_ConfigManagerTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ConfigManagerTestSuite( "test/common/config-manager.h", 5, "ConfigManagerTestSuite", suite_ConfigManagerTestSuite, Tests_ConfigManagerTestSuite );
+
+static class TestDescription_ConfigManagerTestSuite_test_bind_int : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ConfigManagerTestSuite_test_bind_int() : CxxTest::RealTestDescription( Tests_ConfigManagerTestSuite, suiteDescription_ConfigManagerTestSuite, 13, "test_bind_int" ) {}
+ void runTest() { suite_ConfigManagerTestSuite.test_bind_int(); }
+} testDescription_ConfigManagerTestSuite_test_bind_int;
+
+static class TestDescription_ConfigManagerTestSuite_test_bind_bool : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ConfigManagerTestSuite_test_bind_bool() : CxxTest::RealTestDescription( Tests_ConfigManagerTestSuite, suiteDescription_ConfigManagerTestSuite, 30, "test_bind_bool" ) {}
+ void runTest() { suite_ConfigManagerTestSuite.test_bind_bool(); }
+} testDescription_ConfigManagerTestSuite_test_bind_bool;
+
+#include "test/common/coroutines.h"
+
+static CoroutinesTestSuite suite_CoroutinesTestSuite;
+
+static CxxTest::List Tests_CoroutinesTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CoroutinesTestSuite( "test/common/coroutines.h", 5, "CoroutinesTestSuite", suite_CoroutinesTestSuite, Tests_CoroutinesTestSuite );
+
+static class TestDescription_CoroutinesTestSuite_test_context_pool : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CoroutinesTestSuite_test_context_pool() : CxxTest::RealTestDescription( Tests_CoroutinesTestSuite, suiteDescription_CoroutinesTestSuite, 17, "test_context_pool" ) {}
+ void runTest() { suite_CoroutinesTestSuite.test_context_pool(); }
+} testDescription_CoroutinesTestSuite_test_context_pool;
+
+#include "test/common/crc.h"
+
+static CrcTestSuite suite_CrcTestSuite;
+
+static CxxTest::List Tests_CrcTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CrcTestSuite( "test/common/crc.h", 11, "CrcTestSuite", suite_CrcTestSuite, Tests_CrcTestSuite );
+
+static class TestDescription_CrcTestSuite_test_crc32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc32() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 14, "test_crc32" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc32(); }
+} testDescription_CrcTestSuite_test_crc32;
+
+static class TestDescription_CrcTestSuite_test_crc16 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc16() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 24, "test_crc16" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc16(); }
+} testDescription_CrcTestSuite_test_crc16;
+
+static class TestDescription_CrcTestSuite_test_crc_ccitt : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc_ccitt() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 34, "test_crc_ccitt" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc_ccitt(); }
+} testDescription_CrcTestSuite_test_crc_ccitt;
+
+static class TestDescription_CrcTestSuite_test_crc_binhex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc_binhex() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 44, "test_crc_binhex" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc_binhex(); }
+} testDescription_CrcTestSuite_test_crc_binhex;
+
+static class TestDescription_CrcTestSuite_test_crc32_slow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc32_slow() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 54, "test_crc32_slow" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc32_slow(); }
+} testDescription_CrcTestSuite_test_crc32_slow;
+
+static class TestDescription_CrcTestSuite_test_crc16_slow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc16_slow() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 59, "test_crc16_slow" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc16_slow(); }
+} testDescription_CrcTestSuite_test_crc16_slow;
+
+static class TestDescription_CrcTestSuite_test_crc_ccitt_slow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc_ccitt_slow() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 64, "test_crc_ccitt_slow" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc_ccitt_slow(); }
+} testDescription_CrcTestSuite_test_crc_ccitt_slow;
+
+static class TestDescription_CrcTestSuite_test_crc_binhex_slow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrcTestSuite_test_crc_binhex_slow() : CxxTest::RealTestDescription( Tests_CrcTestSuite, suiteDescription_CrcTestSuite, 69, "test_crc_binhex_slow" ) {}
+ void runTest() { suite_CrcTestSuite.test_crc_binhex_slow(); }
+} testDescription_CrcTestSuite_test_crc_binhex_slow;
+
+#include "test/common/debug.h"
+
+static DebugTestSuite suite_DebugTestSuite;
+
+static CxxTest::List Tests_DebugTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_DebugTestSuite( "test/common/debug.h", 15, "DebugTestSuite", suite_DebugTestSuite, Tests_DebugTestSuite );
+
+static class TestDescription_DebugTestSuite_test_channel_filter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_DebugTestSuite_test_channel_filter() : CxxTest::RealTestDescription( Tests_DebugTestSuite, suiteDescription_DebugTestSuite, 33, "test_channel_filter" ) {}
+ void runTest() { suite_DebugTestSuite.test_channel_filter(); }
+} testDescription_DebugTestSuite_test_channel_filter;
+
+static class TestDescription_DebugTestSuite_test_deferred : public CxxTest::RealTestDescription {
+public:
+ TestDescription_DebugTestSuite_test_deferred() : CxxTest::RealTestDescription( Tests_DebugTestSuite, suiteDescription_DebugTestSuite, 59, "test_deferred" ) {}
+ void runTest() { suite_DebugTestSuite.test_deferred(); }
+} testDescription_DebugTestSuite_test_deferred;
+
+static class TestDescription_DebugTestSuite_test_deferred_copies_strings : public CxxTest::RealTestDescription {
+public:
+ TestDescription_DebugTestSuite_test_deferred_copies_strings() : CxxTest::RealTestDescription( Tests_DebugTestSuite, suiteDescription_DebugTestSuite, 72, "test_deferred_copies_strings" ) {}
+ void runTest() { suite_DebugTestSuite.test_deferred_copies_strings(); }
+} testDescription_DebugTestSuite_test_deferred_copies_strings;
+
+static class TestDescription_DebugTestSuite_test_deferred_disable_flushes : public CxxTest::RealTestDescription {
+public:
+ TestDescription_DebugTestSuite_test_deferred_disable_flushes() : CxxTest::RealTestDescription( Tests_DebugTestSuite, suiteDescription_DebugTestSuite, 86, "test_deferred_disable_flushes" ) {}
+ void runTest() { suite_DebugTestSuite.test_deferred_disable_flushes(); }
+} testDescription_DebugTestSuite_test_deferred_disable_flushes;
+
+#include "test/common/encoding.h"
+
+static EncodingTestSuite suite_EncodingTestSuite;
+
+static CxxTest::List Tests_EncodingTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_EncodingTestSuite( "test/common/encoding.h", 15, "EncodingTestSuite", suite_EncodingTestSuite, Tests_EncodingTestSuite );
+
+static class TestDescription_EncodingTestSuite_test_korean : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_korean() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 18, "test_korean" ) {}
+ void runTest() { suite_EncodingTestSuite.test_korean(); }
+} testDescription_EncodingTestSuite_test_korean;
+
+static class TestDescription_EncodingTestSuite_test_chinese : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_chinese() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 59, "test_chinese" ) {}
+ void runTest() { suite_EncodingTestSuite.test_chinese(); }
+} testDescription_EncodingTestSuite_test_chinese;
+
+static class TestDescription_EncodingTestSuite_test_japanese : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_japanese() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 95, "test_japanese" ) {}
+ void runTest() { suite_EncodingTestSuite.test_japanese(); }
+} testDescription_EncodingTestSuite_test_japanese;
+
+static class TestDescription_EncodingTestSuite_test_conversion_unicode_machine_endian : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_conversion_unicode_machine_endian() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 140, "test_conversion_unicode_machine_endian" ) {}
+ void runTest() { suite_EncodingTestSuite.test_conversion_unicode_machine_endian(); }
+} testDescription_EncodingTestSuite_test_conversion_unicode_machine_endian;
+
+static class TestDescription_EncodingTestSuite_test_conversion_unicode_big_endian : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_conversion_unicode_big_endian() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 194, "test_conversion_unicode_big_endian" ) {}
+ void runTest() { suite_EncodingTestSuite.test_conversion_unicode_big_endian(); }
+} testDescription_EncodingTestSuite_test_conversion_unicode_big_endian;
+
+static class TestDescription_EncodingTestSuite_test_conversion_unicode_little_endian : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_conversion_unicode_little_endian() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 214, "test_conversion_unicode_little_endian" ) {}
+ void runTest() { suite_EncodingTestSuite.test_conversion_unicode_little_endian(); }
+} testDescription_EncodingTestSuite_test_conversion_unicode_little_endian;
+
+static class TestDescription_EncodingTestSuite_test_cyrillic_transliteration : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_cyrillic_transliteration() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 233, "test_cyrillic_transliteration" ) {}
+ void runTest() { suite_EncodingTestSuite.test_cyrillic_transliteration(); }
+} testDescription_EncodingTestSuite_test_cyrillic_transliteration;
+
+static class TestDescription_EncodingTestSuite_test_other_conversions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_other_conversions() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 255, "test_other_conversions" ) {}
+ void runTest() { suite_EncodingTestSuite.test_other_conversions(); }
+} testDescription_EncodingTestSuite_test_other_conversions;
+
+static class TestDescription_EncodingTestSuite_test_ascii_runs : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EncodingTestSuite_test_ascii_runs() : CxxTest::RealTestDescription( Tests_EncodingTestSuite, suiteDescription_EncodingTestSuite, 275, "test_ascii_runs" ) {}
+ void runTest() { suite_EncodingTestSuite.test_ascii_runs(); }
+} testDescription_EncodingTestSuite_test_ascii_runs;
+
+#include "test/common/endian.h"
+
+static EndianTestSuite suite_EndianTestSuite;
+
+static CxxTest::List Tests_EndianTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_EndianTestSuite( "test/common/endian.h", 4, "EndianTestSuite", suite_EndianTestSuite, Tests_EndianTestSuite );
+
+static class TestDescription_EndianTestSuite_test_MKTAG : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_MKTAG() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 7, "test_MKTAG" ) {}
+ void runTest() { suite_EndianTestSuite.test_MKTAG(); }
+} testDescription_EndianTestSuite_test_MKTAG;
+
+static class TestDescription_EndianTestSuite_test_READ_BE_UINT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_BE_UINT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 13, "test_READ_BE_UINT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_BE_UINT64(); }
+} testDescription_EndianTestSuite_test_READ_BE_UINT64;
+
+static class TestDescription_EndianTestSuite_test_READ_LE_UINT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_LE_UINT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 19, "test_READ_LE_UINT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_LE_UINT64(); }
+} testDescription_EndianTestSuite_test_READ_LE_UINT64;
+
+static class TestDescription_EndianTestSuite_test_READ_BE_UINT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_BE_UINT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 25, "test_READ_BE_UINT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_BE_UINT32(); }
+} testDescription_EndianTestSuite_test_READ_BE_UINT32;
+
+static class TestDescription_EndianTestSuite_test_READ_LE_UINT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_LE_UINT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 31, "test_READ_LE_UINT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_LE_UINT32(); }
+} testDescription_EndianTestSuite_test_READ_LE_UINT32;
+
+static class TestDescription_EndianTestSuite_test_READ_BE_UINT16 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_BE_UINT16() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 37, "test_READ_BE_UINT16" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_BE_UINT16(); }
+} testDescription_EndianTestSuite_test_READ_BE_UINT16;
+
+static class TestDescription_EndianTestSuite_test_READ_LE_UINT16 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_LE_UINT16() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 43, "test_READ_LE_UINT16" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_LE_UINT16(); }
+} testDescription_EndianTestSuite_test_READ_LE_UINT16;
+
+static class TestDescription_EndianTestSuite_test_READ_BE_FLOAT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_BE_FLOAT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 49, "test_READ_BE_FLOAT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_BE_FLOAT32(); }
+} testDescription_EndianTestSuite_test_READ_BE_FLOAT32;
+
+static class TestDescription_EndianTestSuite_test_READ_LE_FLOAT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_LE_FLOAT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 55, "test_READ_LE_FLOAT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_LE_FLOAT32(); }
+} testDescription_EndianTestSuite_test_READ_LE_FLOAT32;
+
+static class TestDescription_EndianTestSuite_test_READ_BE_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_BE_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 61, "test_READ_BE_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_BE_FLOAT64(); }
+} testDescription_EndianTestSuite_test_READ_BE_FLOAT64;
+
+static class TestDescription_EndianTestSuite_test_READ_LE_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_LE_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 67, "test_READ_LE_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_LE_FLOAT64(); }
+} testDescription_EndianTestSuite_test_READ_LE_FLOAT64;
+
+static class TestDescription_EndianTestSuite_test_READ_FPA_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_READ_FPA_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 73, "test_READ_FPA_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_READ_FPA_FLOAT64(); }
+} testDescription_EndianTestSuite_test_READ_FPA_FLOAT64;
+
+static class TestDescription_EndianTestSuite_test_WRITE_BE_FLOAT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_WRITE_BE_FLOAT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 79, "test_WRITE_BE_FLOAT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_WRITE_BE_FLOAT32(); }
+} testDescription_EndianTestSuite_test_WRITE_BE_FLOAT32;
+
+static class TestDescription_EndianTestSuite_test_WRITE_LE_FLOAT32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_WRITE_LE_FLOAT32() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 86, "test_WRITE_LE_FLOAT32" ) {}
+ void runTest() { suite_EndianTestSuite.test_WRITE_LE_FLOAT32(); }
+} testDescription_EndianTestSuite_test_WRITE_LE_FLOAT32;
+
+static class TestDescription_EndianTestSuite_test_WRITE_BE_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_WRITE_BE_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 93, "test_WRITE_BE_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_WRITE_BE_FLOAT64(); }
+} testDescription_EndianTestSuite_test_WRITE_BE_FLOAT64;
+
+static class TestDescription_EndianTestSuite_test_WRITE_LE_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_WRITE_LE_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 100, "test_WRITE_LE_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_WRITE_LE_FLOAT64(); }
+} testDescription_EndianTestSuite_test_WRITE_LE_FLOAT64;
+
+static class TestDescription_EndianTestSuite_test_WRITE_FPA_FLOAT64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_EndianTestSuite_test_WRITE_FPA_FLOAT64() : CxxTest::RealTestDescription( Tests_EndianTestSuite, suiteDescription_EndianTestSuite, 107, "test_WRITE_FPA_FLOAT64" ) {}
+ void runTest() { suite_EndianTestSuite.test_WRITE_FPA_FLOAT64(); }
+} testDescription_EndianTestSuite_test_WRITE_FPA_FLOAT64;
+
+#include "test/common/fixedstack.h"
+
+static FixedStackTestSuite suite_FixedStackTestSuite;
+
+static CxxTest::List Tests_FixedStackTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FixedStackTestSuite( "test/common/fixedstack.h", 5, "FixedStackTestSuite", suite_FixedStackTestSuite, Tests_FixedStackTestSuite );
+
+static class TestDescription_FixedStackTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FixedStackTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_FixedStackTestSuite, suiteDescription_FixedStackTestSuite, 7, "test_empty_clear" ) {}
+ void runTest() { suite_FixedStackTestSuite.test_empty_clear(); }
+} testDescription_FixedStackTestSuite_test_empty_clear;
+
+static class TestDescription_FixedStackTestSuite_test_size : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FixedStackTestSuite_test_size() : CxxTest::RealTestDescription( Tests_FixedStackTestSuite, suiteDescription_FixedStackTestSuite, 20, "test_size" ) {}
+ void runTest() { suite_FixedStackTestSuite.test_size(); }
+} testDescription_FixedStackTestSuite_test_size;
+
+static class TestDescription_FixedStackTestSuite_test_top_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FixedStackTestSuite_test_top_pop() : CxxTest::RealTestDescription( Tests_FixedStackTestSuite, suiteDescription_FixedStackTestSuite, 37, "test_top_pop" ) {}
+ void runTest() { suite_FixedStackTestSuite.test_top_pop(); }
+} testDescription_FixedStackTestSuite_test_top_pop;
+
+static class TestDescription_FixedStackTestSuite_test_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FixedStackTestSuite_test_assign() : CxxTest::RealTestDescription( Tests_FixedStackTestSuite, suiteDescription_FixedStackTestSuite, 55, "test_assign" ) {}
+ void runTest() { suite_FixedStackTestSuite.test_assign(); }
+} testDescription_FixedStackTestSuite_test_assign;
+
+#include "test/common/flathashmap.h"
+
+static FlatHashMapTestSuite suite_FlatHashMapTestSuite;
+
+static CxxTest::List Tests_FlatHashMapTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FlatHashMapTestSuite( "test/common/flathashmap.h", 7, "FlatHashMapTestSuite", suite_FlatHashMapTestSuite, Tests_FlatHashMapTestSuite );
+
+static class TestDescription_FlatHashMapTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FlatHashMapTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_FlatHashMapTestSuite, suiteDescription_FlatHashMapTestSuite, 10, "test_empty_clear" ) {}
+ void runTest() { suite_FlatHashMapTestSuite.test_empty_clear(); }
+} testDescription_FlatHashMapTestSuite_test_empty_clear;
+
+static class TestDescription_FlatHashMapTestSuite_test_contains : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FlatHashMapTestSuite_test_contains() : CxxTest::RealTestDescription( Tests_FlatHashMapTestSuite, suiteDescription_FlatHashMapTestSuite, 28, "test_contains" ) {}
+ void runTest() { suite_FlatHashMapTestSuite.test_contains(); }
+} testDescription_FlatHashMapTestSuite_test_contains;
+
+static class TestDescription_FlatHashMapTestSuite_test_lookup : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FlatHashMapTestSuite_test_lookup() : CxxTest::RealTestDescription( Tests_FlatHashMapTestSuite, suiteDescription_FlatHashMapTestSuite, 46, "test_lookup" ) {}
+ void runTest() { suite_FlatHashMapTestSuite.test_lookup(); }
+} testDescription_FlatHashMapTestSuite_test_lookup;
+
+static class TestDescription_FlatHashMapTestSuite_test_collision : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FlatHashMapTestSuite_test_collision() : CxxTest::RealTestDescription( Tests_FlatHashMapTestSuite, suiteDescription_FlatHashMapTestSuite, 67, "test_collision" ) {}
+ void runTest() { suite_FlatHashMapTestSuite.test_collision(); }
+} testDescription_FlatHashMapTestSuite_test_collision;
+
+static class TestDescription_FlatHashMapTestSuite_test_grow_and_erase : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FlatHashMapTestSuite_test_grow_and_erase() : CxxTest::RealTestDescription( Tests_FlatHashMapTestSuite, suiteDescription_FlatHashMapTestSuite, 91, "test_grow_and_erase" ) {}
+ void runTest() { suite_FlatHashMapTestSuite.test_grow_and_erase(); }
+} testDescription_FlatHashMapTestSuite_test_grow_and_erase;
+
+static class TestDescription_FlatHashMapTestSuite_test_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FlatHashMapTestSuite_test_iterator() : CxxTest::RealTestDescription( Tests_FlatHashMapTestSuite, suiteDescription_FlatHashMapTestSuite, 103, "test_iterator" ) {}
+ void runTest() { suite_FlatHashMapTestSuite.test_iterator(); }
+} testDescription_FlatHashMapTestSuite_test_iterator;
+
+static class TestDescription_FlatHashMapTestSuite_test_copy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FlatHashMapTestSuite_test_copy() : CxxTest::RealTestDescription( Tests_FlatHashMapTestSuite, suiteDescription_FlatHashMapTestSuite, 122, "test_copy" ) {}
+ void runTest() { suite_FlatHashMapTestSuite.test_copy(); }
+} testDescription_FlatHashMapTestSuite_test_copy;
+
+#include "test/common/func.h"
+
+static FuncTestSuite suite_FuncTestSuite;
+
+static CxxTest::List Tests_FuncTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FuncTestSuite( "test/common/func.h", 8, "FuncTestSuite", suite_FuncTestSuite, Tests_FuncTestSuite );
+
+static class TestDescription_FuncTestSuite_test_bind1st : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FuncTestSuite_test_bind1st() : CxxTest::RealTestDescription( Tests_FuncTestSuite, suiteDescription_FuncTestSuite, 11, "test_bind1st" ) {}
+ void runTest() { suite_FuncTestSuite.test_bind1st(); }
+} testDescription_FuncTestSuite_test_bind1st;
+
+static class TestDescription_FuncTestSuite_test_bind2nd : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FuncTestSuite_test_bind2nd() : CxxTest::RealTestDescription( Tests_FuncTestSuite, suiteDescription_FuncTestSuite, 17, "test_bind2nd" ) {}
+ void runTest() { suite_FuncTestSuite.test_bind2nd(); }
+} testDescription_FuncTestSuite_test_bind2nd;
+
+static class TestDescription_FuncTestSuite_test_mem_fun_ref : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FuncTestSuite_test_mem_fun_ref() : CxxTest::RealTestDescription( Tests_FuncTestSuite, suiteDescription_FuncTestSuite, 33, "test_mem_fun_ref" ) {}
+ void runTest() { suite_FuncTestSuite.test_mem_fun_ref(); }
+} testDescription_FuncTestSuite_test_mem_fun_ref;
+
+static class TestDescription_FuncTestSuite_test_mem_fun : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FuncTestSuite_test_mem_fun() : CxxTest::RealTestDescription( Tests_FuncTestSuite, suiteDescription_FuncTestSuite, 44, "test_mem_fun" ) {}
+ void runTest() { suite_FuncTestSuite.test_mem_fun(); }
+} testDescription_FuncTestSuite_test_mem_fun;
+
+#include "test/common/hash-str.h"
+
+static HashStrTestSuite suite_HashStrTestSuite;
+
+static CxxTest::List Tests_HashStrTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HashStrTestSuite( "test/common/hash-str.h", 10, "HashStrTestSuite", suite_HashStrTestSuite, Tests_HashStrTestSuite );
+
+static class TestDescription_HashStrTestSuite_test_case_sensitive_string_equal_to : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashStrTestSuite_test_case_sensitive_string_equal_to() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 13, "test_case_sensitive_string_equal_to" ) {}
+ void runTest() { suite_HashStrTestSuite.test_case_sensitive_string_equal_to(); }
+} testDescription_HashStrTestSuite_test_case_sensitive_string_equal_to;
+
+static class TestDescription_HashStrTestSuite_test_ignore_case_equal_to : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashStrTestSuite_test_ignore_case_equal_to() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 45, "test_ignore_case_equal_to" ) {}
+ void runTest() { suite_HashStrTestSuite.test_ignore_case_equal_to(); }
+} testDescription_HashStrTestSuite_test_ignore_case_equal_to;
+
+static class TestDescription_HashStrTestSuite_test_case_sensitive_string_hash : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashStrTestSuite_test_case_sensitive_string_hash() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 76, "test_case_sensitive_string_hash" ) {}
+ void runTest() { suite_HashStrTestSuite.test_case_sensitive_string_hash(); }
+} testDescription_HashStrTestSuite_test_case_sensitive_string_hash;
+
+static class TestDescription_HashStrTestSuite_test_ignore_case_hash : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashStrTestSuite_test_ignore_case_hash() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 98, "test_ignore_case_hash" ) {}
+ void runTest() { suite_HashStrTestSuite.test_ignore_case_hash(); }
+} testDescription_HashStrTestSuite_test_ignore_case_hash;
+
+static class TestDescription_HashStrTestSuite_test_cpp_string_hash : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashStrTestSuite_test_cpp_string_hash() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 116, "test_cpp_string_hash" ) {}
+ void runTest() { suite_HashStrTestSuite.test_cpp_string_hash(); }
+} testDescription_HashStrTestSuite_test_cpp_string_hash;
+
+static class TestDescription_HashStrTestSuite_test_c_style_string_hash : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashStrTestSuite_test_c_style_string_hash() : CxxTest::RealTestDescription( Tests_HashStrTestSuite, suiteDescription_HashStrTestSuite, 138, "test_c_style_string_hash" ) {}
+ void runTest() { suite_HashStrTestSuite.test_c_style_string_hash(); }
+} testDescription_HashStrTestSuite_test_c_style_string_hash;
+
+#include "test/common/hashmap.h"
+
+static HashMapTestSuite suite_HashMapTestSuite;
+
+static CxxTest::List Tests_HashMapTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HashMapTestSuite( "test/common/hashmap.h", 7, "HashMapTestSuite", suite_HashMapTestSuite, Tests_HashMapTestSuite );
+
+static class TestDescription_HashMapTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 10, "test_empty_clear" ) {}
+ void runTest() { suite_HashMapTestSuite.test_empty_clear(); }
+} testDescription_HashMapTestSuite_test_empty_clear;
+
+static class TestDescription_HashMapTestSuite_test_contains : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_contains() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 28, "test_contains" ) {}
+ void runTest() { suite_HashMapTestSuite.test_contains(); }
+} testDescription_HashMapTestSuite_test_contains;
+
+static class TestDescription_HashMapTestSuite_test_add_remove : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_add_remove() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 46, "test_add_remove" ) {}
+ void runTest() { suite_HashMapTestSuite.test_add_remove(); }
+} testDescription_HashMapTestSuite_test_add_remove;
+
+static class TestDescription_HashMapTestSuite_test_add_remove_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_add_remove_iterator() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 75, "test_add_remove_iterator" ) {}
+ void runTest() { suite_HashMapTestSuite.test_add_remove_iterator(); }
+} testDescription_HashMapTestSuite_test_add_remove_iterator;
+
+static class TestDescription_HashMapTestSuite_test_lookup : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_lookup() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 104, "test_lookup" ) {}
+ void runTest() { suite_HashMapTestSuite.test_lookup(); }
+} testDescription_HashMapTestSuite_test_lookup;
+
+static class TestDescription_HashMapTestSuite_test_lookup_with_default : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_lookup_with_default() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 119, "test_lookup_with_default" ) {}
+ void runTest() { suite_HashMapTestSuite.test_lookup_with_default(); }
+} testDescription_HashMapTestSuite_test_lookup_with_default;
+
+static class TestDescription_HashMapTestSuite_test_iterator_begin_end : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_iterator_begin_end() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 137, "test_iterator_begin_end" ) {}
+ void runTest() { suite_HashMapTestSuite.test_iterator_begin_end(); }
+} testDescription_HashMapTestSuite_test_iterator_begin_end;
+
+static class TestDescription_HashMapTestSuite_test_hash_map_copy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_hash_map_copy() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 152, "test_hash_map_copy" ) {}
+ void runTest() { suite_HashMapTestSuite.test_hash_map_copy(); }
+} testDescription_HashMapTestSuite_test_hash_map_copy;
+
+static class TestDescription_HashMapTestSuite_test_collision : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_collision() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 159, "test_collision" ) {}
+ void runTest() { suite_HashMapTestSuite.test_collision(); }
+} testDescription_HashMapTestSuite_test_collision;
+
+static class TestDescription_HashMapTestSuite_test_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_iterator() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 201, "test_iterator" ) {}
+ void runTest() { suite_HashMapTestSuite.test_iterator(); }
+} testDescription_HashMapTestSuite_test_iterator;
+
+static class TestDescription_HashMapTestSuite_test_flat_hash_map_workload : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HashMapTestSuite_test_flat_hash_map_workload() : CxxTest::RealTestDescription( Tests_HashMapTestSuite, suiteDescription_HashMapTestSuite, 257, "test_flat_hash_map_workload" ) {}
+ void runTest() { suite_HashMapTestSuite.test_flat_hash_map_workload(); }
+} testDescription_HashMapTestSuite_test_flat_hash_map_workload;
+
+#include "test/common/ini-file.h"
+
+static IniFileTestSuite suite_IniFileTestSuite;
+
+static CxxTest::List Tests_IniFileTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_IniFileTestSuite( "test/common/ini-file.h", 7, "IniFileTestSuite", suite_IniFileTestSuite, Tests_IniFileTestSuite );
+
+static class TestDescription_IniFileTestSuite_test_blank_ini_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_IniFileTestSuite_test_blank_ini_file() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 9, "test_blank_ini_file" ) {}
+ void runTest() { suite_IniFileTestSuite.test_blank_ini_file(); }
+} testDescription_IniFileTestSuite_test_blank_ini_file;
+
+static class TestDescription_IniFileTestSuite_test_simple_ini_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_IniFileTestSuite_test_simple_ini_file() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 18, "test_simple_ini_file" ) {}
+ void runTest() { suite_IniFileTestSuite.test_simple_ini_file(); }
+} testDescription_IniFileTestSuite_test_simple_ini_file;
+
+static class TestDescription_IniFileTestSuite_test_multisection_ini_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_IniFileTestSuite_test_multisection_ini_file() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 41, "test_multisection_ini_file" ) {}
+ void runTest() { suite_IniFileTestSuite.test_multisection_ini_file(); }
+} testDescription_IniFileTestSuite_test_multisection_ini_file;
+
+static class TestDescription_IniFileTestSuite_test_modify_ini_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_IniFileTestSuite_test_modify_ini_file() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 69, "test_modify_ini_file" ) {}
+ void runTest() { suite_IniFileTestSuite.test_modify_ini_file(); }
+} testDescription_IniFileTestSuite_test_modify_ini_file;
+
+static class TestDescription_IniFileTestSuite_test_name_validity : public CxxTest::RealTestDescription {
+public:
+ TestDescription_IniFileTestSuite_test_name_validity() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 93, "test_name_validity" ) {}
+ void runTest() { suite_IniFileTestSuite.test_name_validity(); }
+} testDescription_IniFileTestSuite_test_name_validity;
+
+static class TestDescription_IniFileTestSuite_test_write_simple_ini_file : public CxxTest::RealTestDescription {
+public:
+ TestDescription_IniFileTestSuite_test_write_simple_ini_file() : CxxTest::RealTestDescription( Tests_IniFileTestSuite, suiteDescription_IniFileTestSuite, 126, "test_write_simple_ini_file" ) {}
+ void runTest() { suite_IniFileTestSuite.test_write_simple_ini_file(); }
+} testDescription_IniFileTestSuite_test_write_simple_ini_file;
+
+#include "test/common/intrinsics.h"
+
+static IntrinsicsTestSuite suite_IntrinsicsTestSuite;
+
+static CxxTest::List Tests_IntrinsicsTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_IntrinsicsTestSuite( "test/common/intrinsics.h", 5, "IntrinsicsTestSuite", suite_IntrinsicsTestSuite, Tests_IntrinsicsTestSuite );
+
+static class TestDescription_IntrinsicsTestSuite_test_intLog2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_IntrinsicsTestSuite_test_intLog2() : CxxTest::RealTestDescription( Tests_IntrinsicsTestSuite, suiteDescription_IntrinsicsTestSuite, 8, "test_intLog2" ) {}
+ void runTest() { suite_IntrinsicsTestSuite.test_intLog2(); }
+} testDescription_IntrinsicsTestSuite_test_intLog2;
+
+#include "test/common/json.h"
+
+static JSONTestSuite suite_JSONTestSuite;
+
+static CxxTest::List Tests_JSONTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_JSONTestSuite( "test/common/json.h", 5, "JSONTestSuite", suite_JSONTestSuite, Tests_JSONTestSuite );
+
+static class TestDescription_JSONTestSuite_test_parse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_JSONTestSuite_test_parse() : CxxTest::RealTestDescription( Tests_JSONTestSuite, suiteDescription_JSONTestSuite, 7, "test_parse" ) {}
+ void runTest() { suite_JSONTestSuite.test_parse(); }
+} testDescription_JSONTestSuite_test_parse;
+
+static class TestDescription_JSONTestSuite_test_parse_errors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_JSONTestSuite_test_parse_errors() : CxxTest::RealTestDescription( Tests_JSONTestSuite, suiteDescription_JSONTestSuite, 30, "test_parse_errors" ) {}
+ void runTest() { suite_JSONTestSuite.test_parse_errors(); }
+} testDescription_JSONTestSuite_test_parse_errors;
+
+static class TestDescription_JSONTestSuite_test_stringify : public CxxTest::RealTestDescription {
+public:
+ TestDescription_JSONTestSuite_test_stringify() : CxxTest::RealTestDescription( Tests_JSONTestSuite, suiteDescription_JSONTestSuite, 39, "test_stringify" ) {}
+ void runTest() { suite_JSONTestSuite.test_stringify(); }
+} testDescription_JSONTestSuite_test_stringify;
+
+#include "test/common/list.h"
+
+static ListTestSuite suite_ListTestSuite;
+
+static CxxTest::List Tests_ListTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ListTestSuite( "test/common/list.h", 5, "ListTestSuite", suite_ListTestSuite, Tests_ListTestSuite );
+
+static class TestDescription_ListTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 8, "test_empty_clear" ) {}
+ void runTest() { suite_ListTestSuite.test_empty_clear(); }
+} testDescription_ListTestSuite_test_empty_clear;
+
+static class TestDescription_ListTestSuite_test_size : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_size() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 19, "test_size" ) {}
+ void runTest() { suite_ListTestSuite.test_size(); }
+} testDescription_ListTestSuite_test_size;
+
+static class TestDescription_ListTestSuite_test_iterator_begin_end : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_iterator_begin_end() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 30, "test_iterator_begin_end" ) {}
+ void runTest() { suite_ListTestSuite.test_iterator_begin_end(); }
+} testDescription_ListTestSuite_test_iterator_begin_end;
+
+static class TestDescription_ListTestSuite_test_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_iterator() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 45, "test_iterator" ) {}
+ void runTest() { suite_ListTestSuite.test_iterator(); }
+} testDescription_ListTestSuite_test_iterator;
+
+static class TestDescription_ListTestSuite_test_insert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_insert() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 89, "test_insert" ) {}
+ void runTest() { suite_ListTestSuite.test_insert(); }
+} testDescription_ListTestSuite_test_insert;
+
+static class TestDescription_ListTestSuite_test_erase : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_erase() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 141, "test_erase" ) {}
+ void runTest() { suite_ListTestSuite.test_erase(); }
+} testDescription_ListTestSuite_test_erase;
+
+static class TestDescription_ListTestSuite_test_remove : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_remove() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 181, "test_remove" ) {}
+ void runTest() { suite_ListTestSuite.test_remove(); }
+} testDescription_ListTestSuite_test_remove;
+
+static class TestDescription_ListTestSuite_test_reverse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_reverse() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 217, "test_reverse" ) {}
+ void runTest() { suite_ListTestSuite.test_reverse(); }
+} testDescription_ListTestSuite_test_reverse;
+
+static class TestDescription_ListTestSuite_test_front_back_push_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ListTestSuite_test_front_back_push_pop() : CxxTest::RealTestDescription( Tests_ListTestSuite, suiteDescription_ListTestSuite, 259, "test_front_back_push_pop" ) {}
+ void runTest() { suite_ListTestSuite.test_front_back_push_pop(); }
+} testDescription_ListTestSuite_test_front_back_push_pop;
+
+#include "test/common/lockfree-queue.h"
+
+static LockFreeQueueTestSuite suite_LockFreeQueueTestSuite;
+
+static CxxTest::List Tests_LockFreeQueueTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_LockFreeQueueTestSuite( "test/common/lockfree-queue.h", 5, "LockFreeQueueTestSuite", suite_LockFreeQueueTestSuite, Tests_LockFreeQueueTestSuite );
+
+static class TestDescription_LockFreeQueueTestSuite_test_push_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_LockFreeQueueTestSuite_test_push_pop() : CxxTest::RealTestDescription( Tests_LockFreeQueueTestSuite, suiteDescription_LockFreeQueueTestSuite, 7, "test_push_pop" ) {}
+ void runTest() { suite_LockFreeQueueTestSuite.test_push_pop(); }
+} testDescription_LockFreeQueueTestSuite_test_push_pop;
+
+static class TestDescription_LockFreeQueueTestSuite_test_full : public CxxTest::RealTestDescription {
+public:
+ TestDescription_LockFreeQueueTestSuite_test_full() : CxxTest::RealTestDescription( Tests_LockFreeQueueTestSuite, suiteDescription_LockFreeQueueTestSuite, 25, "test_full" ) {}
+ void runTest() { suite_LockFreeQueueTestSuite.test_full(); }
+} testDescription_LockFreeQueueTestSuite_test_full;
+
+static class TestDescription_LockFreeQueueTestSuite_test_wrap_around : public CxxTest::RealTestDescription {
+public:
+ TestDescription_LockFreeQueueTestSuite_test_wrap_around() : CxxTest::RealTestDescription( Tests_LockFreeQueueTestSuite, suiteDescription_LockFreeQueueTestSuite, 39, "test_wrap_around" ) {}
+ void runTest() { suite_LockFreeQueueTestSuite.test_wrap_around(); }
+} testDescription_LockFreeQueueTestSuite_test_wrap_around;
+
+#include "test/common/md5.h"
+
+static MD5TestSuite suite_MD5TestSuite;
+
+static CxxTest::List Tests_MD5TestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MD5TestSuite( "test/common/md5.h", 30, "MD5TestSuite", suite_MD5TestSuite, Tests_MD5TestSuite );
+
+static class TestDescription_MD5TestSuite_test_computeStreamMD5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MD5TestSuite_test_computeStreamMD5() : CxxTest::RealTestDescription( Tests_MD5TestSuite, suiteDescription_MD5TestSuite, 32, "test_computeStreamMD5" ) {}
+ void runTest() { suite_MD5TestSuite.test_computeStreamMD5(); }
+} testDescription_MD5TestSuite_test_computeStreamMD5;
+
+#include "test/common/memcachingarchive.h"
+
+static MemcachingArchiveTestSuite suite_MemcachingArchiveTestSuite;
+
+static CxxTest::List Tests_MemcachingArchiveTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MemcachingArchiveTestSuite( "test/common/memcachingarchive.h", 27, "MemcachingArchiveTestSuite", suite_MemcachingArchiveTestSuite, Tests_MemcachingArchiveTestSuite );
+
+static class TestDescription_MemcachingArchiveTestSuite_test_hits_and_misses : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemcachingArchiveTestSuite_test_hits_and_misses() : CxxTest::RealTestDescription( Tests_MemcachingArchiveTestSuite, suiteDescription_MemcachingArchiveTestSuite, 33, "test_hits_and_misses" ) {}
+ void runTest() { suite_MemcachingArchiveTestSuite.test_hits_and_misses(); }
+} testDescription_MemcachingArchiveTestSuite_test_hits_and_misses;
+
+static class TestDescription_MemcachingArchiveTestSuite_test_big_members_are_not_kept : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemcachingArchiveTestSuite_test_big_members_are_not_kept() : CxxTest::RealTestDescription( Tests_MemcachingArchiveTestSuite, suiteDescription_MemcachingArchiveTestSuite, 46, "test_big_members_are_not_kept" ) {}
+ void runTest() { suite_MemcachingArchiveTestSuite.test_big_members_are_not_kept(); }
+} testDescription_MemcachingArchiveTestSuite_test_big_members_are_not_kept;
+
+static class TestDescription_MemcachingArchiveTestSuite_test_lru_eviction : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemcachingArchiveTestSuite_test_lru_eviction() : CxxTest::RealTestDescription( Tests_MemcachingArchiveTestSuite, suiteDescription_MemcachingArchiveTestSuite, 56, "test_lru_eviction" ) {}
+ void runTest() { suite_MemcachingArchiveTestSuite.test_lru_eviction(); }
+} testDescription_MemcachingArchiveTestSuite_test_lru_eviction;
+
+static class TestDescription_MemcachingArchiveTestSuite_test_live_streams_survive_eviction : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemcachingArchiveTestSuite_test_live_streams_survive_eviction() : CxxTest::RealTestDescription( Tests_MemcachingArchiveTestSuite, suiteDescription_MemcachingArchiveTestSuite, 77, "test_live_streams_survive_eviction" ) {}
+ void runTest() { suite_MemcachingArchiveTestSuite.test_live_streams_survive_eviction(); }
+} testDescription_MemcachingArchiveTestSuite_test_live_streams_survive_eviction;
+
+static class TestDescription_MemcachingArchiveTestSuite_test_set_cache_policy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemcachingArchiveTestSuite_test_set_cache_policy() : CxxTest::RealTestDescription( Tests_MemcachingArchiveTestSuite, suiteDescription_MemcachingArchiveTestSuite, 89, "test_set_cache_policy" ) {}
+ void runTest() { suite_MemcachingArchiveTestSuite.test_set_cache_policy(); }
+} testDescription_MemcachingArchiveTestSuite_test_set_cache_policy;
+
+#include "test/common/memory.h"
+
+static MemoryTestSuite suite_MemoryTestSuite;
+
+static CxxTest::List Tests_MemoryTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MemoryTestSuite( "test/common/memory.h", 5, "MemoryTestSuite", suite_MemoryTestSuite, Tests_MemoryTestSuite );
+
+static class TestDescription_MemoryTestSuite_test_memset16 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryTestSuite_test_memset16() : CxxTest::RealTestDescription( Tests_MemoryTestSuite, suiteDescription_MemoryTestSuite, 7, "test_memset16" ) {}
+ void runTest() { suite_MemoryTestSuite.test_memset16(); }
+} testDescription_MemoryTestSuite_test_memset16;
+
+static class TestDescription_MemoryTestSuite_test_memset32 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryTestSuite_test_memset32() : CxxTest::RealTestDescription( Tests_MemoryTestSuite, suiteDescription_MemoryTestSuite, 26, "test_memset32" ) {}
+ void runTest() { suite_MemoryTestSuite.test_memset32(); }
+} testDescription_MemoryTestSuite_test_memset32;
+
+static class TestDescription_MemoryTestSuite_test_memset64 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryTestSuite_test_memset64() : CxxTest::RealTestDescription( Tests_MemoryTestSuite, suiteDescription_MemoryTestSuite, 45, "test_memset64" ) {}
+ void runTest() { suite_MemoryTestSuite.test_memset64(); }
+} testDescription_MemoryTestSuite_test_memset64;
+
+static class TestDescription_MemoryTestSuite_test_swap_bytes : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryTestSuite_test_swap_bytes() : CxxTest::RealTestDescription( Tests_MemoryTestSuite, suiteDescription_MemoryTestSuite, 64, "test_swap_bytes" ) {}
+ void runTest() { suite_MemoryTestSuite.test_swap_bytes(); }
+} testDescription_MemoryTestSuite_test_swap_bytes;
+
+#include "test/common/memoryreadstream.h"
+
+static MemoryReadStreamTestSuite suite_MemoryReadStreamTestSuite;
+
+static CxxTest::List Tests_MemoryReadStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MemoryReadStreamTestSuite( "test/common/memoryreadstream.h", 5, "MemoryReadStreamTestSuite", suite_MemoryReadStreamTestSuite, Tests_MemoryReadStreamTestSuite );
+
+static class TestDescription_MemoryReadStreamTestSuite_test_seek_set : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamTestSuite_test_seek_set() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 7, "test_seek_set" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_seek_set(); }
+} testDescription_MemoryReadStreamTestSuite_test_seek_set;
+
+static class TestDescription_MemoryReadStreamTestSuite_test_seek_cur : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamTestSuite_test_seek_cur() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 24, "test_seek_cur" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_seek_cur(); }
+} testDescription_MemoryReadStreamTestSuite_test_seek_cur;
+
+static class TestDescription_MemoryReadStreamTestSuite_test_seek_end : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamTestSuite_test_seek_end() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 45, "test_seek_end" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_seek_end(); }
+} testDescription_MemoryReadStreamTestSuite_test_seek_end;
+
+static class TestDescription_MemoryReadStreamTestSuite_test_seek_read_le : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamTestSuite_test_seek_read_le() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 62, "test_seek_read_le" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_seek_read_le(); }
+} testDescription_MemoryReadStreamTestSuite_test_seek_read_le;
+
+static class TestDescription_MemoryReadStreamTestSuite_test_seek_read_be : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamTestSuite_test_seek_read_be() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 77, "test_seek_read_be" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_seek_read_be(); }
+} testDescription_MemoryReadStreamTestSuite_test_seek_read_be;
+
+static class TestDescription_MemoryReadStreamTestSuite_test_eos : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamTestSuite_test_eos() : CxxTest::RealTestDescription( Tests_MemoryReadStreamTestSuite, suiteDescription_MemoryReadStreamTestSuite, 92, "test_eos" ) {}
+ void runTest() { suite_MemoryReadStreamTestSuite.test_eos(); }
+} testDescription_MemoryReadStreamTestSuite_test_eos;
+
+#include "test/common/memoryreadstreamendian.h"
+
+static MemoryReadStreamEndianTestSuite suite_MemoryReadStreamEndianTestSuite;
+
+static CxxTest::List Tests_MemoryReadStreamEndianTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MemoryReadStreamEndianTestSuite( "test/common/memoryreadstreamendian.h", 5, "MemoryReadStreamEndianTestSuite", suite_MemoryReadStreamEndianTestSuite, Tests_MemoryReadStreamEndianTestSuite );
+
+static class TestDescription_MemoryReadStreamEndianTestSuite_test_seek_set : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamEndianTestSuite_test_seek_set() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 7, "test_seek_set" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_set(); }
+} testDescription_MemoryReadStreamEndianTestSuite_test_seek_set;
+
+static class TestDescription_MemoryReadStreamEndianTestSuite_test_seek_cur : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamEndianTestSuite_test_seek_cur() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 24, "test_seek_cur" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_cur(); }
+} testDescription_MemoryReadStreamEndianTestSuite_test_seek_cur;
+
+static class TestDescription_MemoryReadStreamEndianTestSuite_test_seek_end : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamEndianTestSuite_test_seek_end() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 45, "test_seek_end" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_end(); }
+} testDescription_MemoryReadStreamEndianTestSuite_test_seek_end;
+
+static class TestDescription_MemoryReadStreamEndianTestSuite_test_seek_read_le : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamEndianTestSuite_test_seek_read_le() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 62, "test_seek_read_le" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_read_le(); }
+} testDescription_MemoryReadStreamEndianTestSuite_test_seek_read_le;
+
+static class TestDescription_MemoryReadStreamEndianTestSuite_test_seek_read_be : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamEndianTestSuite_test_seek_read_be() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 77, "test_seek_read_be" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_read_be(); }
+} testDescription_MemoryReadStreamEndianTestSuite_test_seek_read_be;
+
+static class TestDescription_MemoryReadStreamEndianTestSuite_test_seek_read_le2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamEndianTestSuite_test_seek_read_le2() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 92, "test_seek_read_le2" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_read_le2(); }
+} testDescription_MemoryReadStreamEndianTestSuite_test_seek_read_le2;
+
+static class TestDescription_MemoryReadStreamEndianTestSuite_test_seek_read_be2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryReadStreamEndianTestSuite_test_seek_read_be2() : CxxTest::RealTestDescription( Tests_MemoryReadStreamEndianTestSuite, suiteDescription_MemoryReadStreamEndianTestSuite, 107, "test_seek_read_be2" ) {}
+ void runTest() { suite_MemoryReadStreamEndianTestSuite.test_seek_read_be2(); }
+} testDescription_MemoryReadStreamEndianTestSuite_test_seek_read_be2;
+
+#include "test/common/memorywritestream.h"
+
+static MemoryWriteStreamTestSuite suite_MemoryWriteStreamTestSuite;
+
+static CxxTest::List Tests_MemoryWriteStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MemoryWriteStreamTestSuite( "test/common/memorywritestream.h", 5, "MemoryWriteStreamTestSuite", suite_MemoryWriteStreamTestSuite, Tests_MemoryWriteStreamTestSuite );
+
+static class TestDescription_MemoryWriteStreamTestSuite_test_err : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryWriteStreamTestSuite_test_err() : CxxTest::RealTestDescription( Tests_MemoryWriteStreamTestSuite, suiteDescription_MemoryWriteStreamTestSuite, 7, "test_err" ) {}
+ void runTest() { suite_MemoryWriteStreamTestSuite.test_err(); }
+} testDescription_MemoryWriteStreamTestSuite_test_err;
+
+static class TestDescription_MemoryWriteStreamTestSuite_test_write : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MemoryWriteStreamTestSuite_test_write() : CxxTest::RealTestDescription( Tests_MemoryWriteStreamTestSuite, suiteDescription_MemoryWriteStreamTestSuite, 22, "test_write" ) {}
+ void runTest() { suite_MemoryWriteStreamTestSuite.test_write(); }
+} testDescription_MemoryWriteStreamTestSuite_test_write;
+
+#include "test/common/pack.h"
+
+static PackTestSuite suite_PackTestSuite;
+
+static CxxTest::List Tests_PackTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PackTestSuite( "test/common/pack.h", 20, "PackTestSuite", suite_PackTestSuite, Tests_PackTestSuite );
+
+static class TestDescription_PackTestSuite_test_packing : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PackTestSuite_test_packing() : CxxTest::RealTestDescription( Tests_PackTestSuite, suiteDescription_PackTestSuite, 23, "test_packing" ) {}
+ void runTest() { suite_PackTestSuite.test_packing(); }
+} testDescription_PackTestSuite_test_packing;
+
+static class TestDescription_PackTestSuite_test_offsets : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PackTestSuite_test_offsets() : CxxTest::RealTestDescription( Tests_PackTestSuite, suiteDescription_PackTestSuite, 27, "test_offsets" ) {}
+ void runTest() { suite_PackTestSuite.test_offsets(); }
+} testDescription_PackTestSuite_test_offsets;
+
+#include "test/common/path.h"
+
+static PathTestSuite suite_PathTestSuite;
+
+static CxxTest::List Tests_PathTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PathTestSuite( "test/common/path.h", 13, "PathTestSuite", suite_PathTestSuite, Tests_PathTestSuite );
+
+static class TestDescription_PathTestSuite_test_Path : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_Path() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 16, "test_Path" ) {}
+ void runTest() { suite_PathTestSuite.test_Path(); }
+} testDescription_PathTestSuite_test_Path;
+
+static class TestDescription_PathTestSuite_test_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_clear() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 55, "test_clear" ) {}
+ void runTest() { suite_PathTestSuite.test_clear(); }
+} testDescription_PathTestSuite_test_clear;
+
+static class TestDescription_PathTestSuite_test_getLastComponent : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_getLastComponent() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 66, "test_getLastComponent" ) {}
+ void runTest() { suite_PathTestSuite.test_getLastComponent(); }
+} testDescription_PathTestSuite_test_getLastComponent;
+
+static class TestDescription_PathTestSuite_test_baseName : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_baseName() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 80, "test_baseName" ) {}
+ void runTest() { suite_PathTestSuite.test_baseName(); }
+} testDescription_PathTestSuite_test_baseName;
+
+static class TestDescription_PathTestSuite_test_getParent : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_getParent() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 97, "test_getParent" ) {}
+ void runTest() { suite_PathTestSuite.test_getParent(); }
+} testDescription_PathTestSuite_test_getParent;
+
+static class TestDescription_PathTestSuite_test_join : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_join() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 117, "test_join" ) {}
+ void runTest() { suite_PathTestSuite.test_join(); }
+} testDescription_PathTestSuite_test_join;
+
+static class TestDescription_PathTestSuite_test_joinInPlace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_joinInPlace() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 156, "test_joinInPlace" ) {}
+ void runTest() { suite_PathTestSuite.test_joinInPlace(); }
+} testDescription_PathTestSuite_test_joinInPlace;
+
+static class TestDescription_PathTestSuite_test_append : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_append() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 178, "test_append" ) {}
+ void runTest() { suite_PathTestSuite.test_append(); }
+} testDescription_PathTestSuite_test_append;
+
+static class TestDescription_PathTestSuite_test_appendComponent : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_appendComponent() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 200, "test_appendComponent" ) {}
+ void runTest() { suite_PathTestSuite.test_appendComponent(); }
+} testDescription_PathTestSuite_test_appendComponent;
+
+static class TestDescription_PathTestSuite_test_separator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_separator() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 220, "test_separator" ) {}
+ void runTest() { suite_PathTestSuite.test_separator(); }
+} testDescription_PathTestSuite_test_separator;
+
+static class TestDescription_PathTestSuite_test_splitComponents : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_splitComponents() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 231, "test_splitComponents" ) {}
+ void runTest() { suite_PathTestSuite.test_splitComponents(); }
+} testDescription_PathTestSuite_test_splitComponents;
+
+static class TestDescription_PathTestSuite_test_joinComponents : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_joinComponents() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 266, "test_joinComponents" ) {}
+ void runTest() { suite_PathTestSuite.test_joinComponents(); }
+} testDescription_PathTestSuite_test_joinComponents;
+
+static class TestDescription_PathTestSuite_test_removeTrailingSeparators : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_removeTrailingSeparators() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 283, "test_removeTrailingSeparators" ) {}
+ void runTest() { suite_PathTestSuite.test_removeTrailingSeparators(); }
+} testDescription_PathTestSuite_test_removeTrailingSeparators;
+
+static class TestDescription_PathTestSuite_test_isRelativeTo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_isRelativeTo() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 301, "test_isRelativeTo" ) {}
+ void runTest() { suite_PathTestSuite.test_isRelativeTo(); }
+} testDescription_PathTestSuite_test_isRelativeTo;
+
+static class TestDescription_PathTestSuite_test_relativeTo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_relativeTo() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 330, "test_relativeTo" ) {}
+ void runTest() { suite_PathTestSuite.test_relativeTo(); }
+} testDescription_PathTestSuite_test_relativeTo;
+
+static class TestDescription_PathTestSuite_test_normalize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_normalize() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 362, "test_normalize" ) {}
+ void runTest() { suite_PathTestSuite.test_normalize(); }
+} testDescription_PathTestSuite_test_normalize;
+
+static class TestDescription_PathTestSuite_test_punycode : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_punycode() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 396, "test_punycode" ) {}
+ void runTest() { suite_PathTestSuite.test_punycode(); }
+} testDescription_PathTestSuite_test_punycode;
+
+static class TestDescription_PathTestSuite_test_lowerupper : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_lowerupper() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 429, "test_lowerupper" ) {}
+ void runTest() { suite_PathTestSuite.test_lowerupper(); }
+} testDescription_PathTestSuite_test_lowerupper;
+
+static class TestDescription_PathTestSuite_test_caseinsensitive : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_caseinsensitive() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 449, "test_caseinsensitive" ) {}
+ void runTest() { suite_PathTestSuite.test_caseinsensitive(); }
+} testDescription_PathTestSuite_test_caseinsensitive;
+
+static class TestDescription_PathTestSuite_test_hashIgnoreCase_cache : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_hashIgnoreCase_cache() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 470, "test_hashIgnoreCase_cache" ) {}
+ void runTest() { suite_PathTestSuite.test_hashIgnoreCase_cache(); }
+} testDescription_PathTestSuite_test_hashIgnoreCase_cache;
+
+static class TestDescription_PathTestSuite_test_casesensitive : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_casesensitive() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 498, "test_casesensitive" ) {}
+ void runTest() { suite_PathTestSuite.test_casesensitive(); }
+} testDescription_PathTestSuite_test_casesensitive;
+
+static class TestDescription_PathTestSuite_test_matchString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_matchString() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 508, "test_matchString" ) {}
+ void runTest() { suite_PathTestSuite.test_matchString(); }
+} testDescription_PathTestSuite_test_matchString;
+
+static class TestDescription_PathTestSuite_test_findLastSeparator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_findLastSeparator() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 549, "test_findLastSeparator" ) {}
+ void runTest() { suite_PathTestSuite.test_findLastSeparator(); }
+} testDescription_PathTestSuite_test_findLastSeparator;
+
+static class TestDescription_PathTestSuite_test_extract : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_extract() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 557, "test_extract" ) {}
+ void runTest() { suite_PathTestSuite.test_extract(); }
+} testDescription_PathTestSuite_test_extract;
+
+static class TestDescription_PathTestSuite_test_canUnescape : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PathTestSuite_test_canUnescape() : CxxTest::RealTestDescription( Tests_PathTestSuite, suiteDescription_PathTestSuite, 566, "test_canUnescape" ) {}
+ void runTest() { suite_PathTestSuite.test_canUnescape(); }
+} testDescription_PathTestSuite_test_canUnescape;
+
+#include "test/common/prefetch.h"
+
+static PrefetchTestSuite suite_PrefetchTestSuite;
+
+static CxxTest::List Tests_PrefetchTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PrefetchTestSuite( "test/common/prefetch.h", 23, "PrefetchTestSuite", suite_PrefetchTestSuite, Tests_PrefetchTestSuite );
+
+static class TestDescription_PrefetchTestSuite_test_background_read : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PrefetchTestSuite_test_background_read() : CxxTest::RealTestDescription( Tests_PrefetchTestSuite, suiteDescription_PrefetchTestSuite, 25, "test_background_read" ) {}
+ void runTest() { suite_PrefetchTestSuite.test_background_read(); }
+} testDescription_PrefetchTestSuite_test_background_read;
+
+static class TestDescription_PrefetchTestSuite_test_take_before_done : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PrefetchTestSuite_test_take_before_done() : CxxTest::RealTestDescription( Tests_PrefetchTestSuite, suiteDescription_PrefetchTestSuite, 48, "test_take_before_done" ) {}
+ void runTest() { suite_PrefetchTestSuite.test_take_before_done(); }
+} testDescription_PrefetchTestSuite_test_take_before_done;
+
+static class TestDescription_PrefetchTestSuite_test_cancel : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PrefetchTestSuite_test_cancel() : CxxTest::RealTestDescription( Tests_PrefetchTestSuite, suiteDescription_PrefetchTestSuite, 64, "test_cancel" ) {}
+ void runTest() { suite_PrefetchTestSuite.test_cancel(); }
+} testDescription_PrefetchTestSuite_test_cancel;
+
+#include "test/common/ptr.h"
+
+static PtrTestSuite suite_PtrTestSuite;
+
+static CxxTest::List Tests_PtrTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PtrTestSuite( "test/common/ptr.h", 5, "PtrTestSuite", suite_PtrTestSuite, Tests_PtrTestSuite );
+
+static class TestDescription_PtrTestSuite_test_deletion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_deletion() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 25, "test_deletion" ) {}
+ void runTest() { suite_PtrTestSuite.test_deletion(); }
+} testDescription_PtrTestSuite_test_deletion;
+
+static class TestDescription_PtrTestSuite_test_scoped_deleter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_scoped_deleter() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 45, "test_scoped_deleter" ) {}
+ void runTest() { suite_PtrTestSuite.test_scoped_deleter(); }
+} testDescription_PtrTestSuite_test_scoped_deleter;
+
+static class TestDescription_PtrTestSuite_test_disposable_deleter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_disposable_deleter() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 56, "test_disposable_deleter" ) {}
+ void runTest() { suite_PtrTestSuite.test_disposable_deleter(); }
+} testDescription_PtrTestSuite_test_disposable_deleter;
+
+static class TestDescription_PtrTestSuite_test_scoped_deref : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_scoped_deref() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 76, "test_scoped_deref" ) {}
+ void runTest() { suite_PtrTestSuite.test_scoped_deref(); }
+} testDescription_PtrTestSuite_test_scoped_deref;
+
+static class TestDescription_PtrTestSuite_test_disposable_deref : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_disposable_deref() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 84, "test_disposable_deref" ) {}
+ void runTest() { suite_PtrTestSuite.test_disposable_deref(); }
+} testDescription_PtrTestSuite_test_disposable_deref;
+
+static class TestDescription_PtrTestSuite_test_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_assign() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 92, "test_assign" ) {}
+ void runTest() { suite_PtrTestSuite.test_assign(); }
+} testDescription_PtrTestSuite_test_assign;
+
+static class TestDescription_PtrTestSuite_test_deleter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_deleter() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 128, "test_deleter" ) {}
+ void runTest() { suite_PtrTestSuite.test_deleter(); }
+} testDescription_PtrTestSuite_test_deleter;
+
+static class TestDescription_PtrTestSuite_test_compare : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_compare() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 140, "test_compare" ) {}
+ void runTest() { suite_PtrTestSuite.test_compare(); }
+} testDescription_PtrTestSuite_test_compare;
+
+static class TestDescription_PtrTestSuite_test_cast : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_cast() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 154, "test_cast" ) {}
+ void runTest() { suite_PtrTestSuite.test_cast(); }
+} testDescription_PtrTestSuite_test_cast;
+
+static class TestDescription_PtrTestSuite_test_weak_ptr : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PtrTestSuite_test_weak_ptr() : CxxTest::RealTestDescription( Tests_PtrTestSuite, suiteDescription_PtrTestSuite, 160, "test_weak_ptr" ) {}
+ void runTest() { suite_PtrTestSuite.test_weak_ptr(); }
+} testDescription_PtrTestSuite_test_weak_ptr;
+
+#include "test/common/punycode.h"
+
+static PunycodeTestSuite suite_PunycodeTestSuite;
+
+static CxxTest::List Tests_PunycodeTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PunycodeTestSuite( "test/common/punycode.h", 28, "PunycodeTestSuite", suite_PunycodeTestSuite, Tests_PunycodeTestSuite );
+
+static class TestDescription_PunycodeTestSuite_test_punycode : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PunycodeTestSuite_test_punycode() : CxxTest::RealTestDescription( Tests_PunycodeTestSuite, suiteDescription_PunycodeTestSuite, 31, "test_punycode" ) {}
+ void runTest() { suite_PunycodeTestSuite.test_punycode(); }
+} testDescription_PunycodeTestSuite_test_punycode;
+
+#include "test/common/queue.h"
+
+static QueueTestSuite suite_QueueTestSuite;
+
+static CxxTest::List Tests_QueueTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_QueueTestSuite( "test/common/queue.h", 5, "QueueTestSuite", suite_QueueTestSuite, Tests_QueueTestSuite );
+
+static class TestDescription_QueueTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QueueTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_QueueTestSuite, suiteDescription_QueueTestSuite, 7, "test_empty_clear" ) {}
+ void runTest() { suite_QueueTestSuite.test_empty_clear(); }
+} testDescription_QueueTestSuite_test_empty_clear;
+
+static class TestDescription_QueueTestSuite_test_size : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QueueTestSuite_test_size() : CxxTest::RealTestDescription( Tests_QueueTestSuite, suiteDescription_QueueTestSuite, 20, "test_size" ) {}
+ void runTest() { suite_QueueTestSuite.test_size(); }
+} testDescription_QueueTestSuite_test_size;
+
+static class TestDescription_QueueTestSuite_test_front_back_push_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QueueTestSuite_test_front_back_push_pop() : CxxTest::RealTestDescription( Tests_QueueTestSuite, suiteDescription_QueueTestSuite, 35, "test_front_back_push_pop" ) {}
+ void runTest() { suite_QueueTestSuite.test_front_back_push_pop(); }
+} testDescription_QueueTestSuite_test_front_back_push_pop;
+
+static class TestDescription_QueueTestSuite_test_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QueueTestSuite_test_assign() : CxxTest::RealTestDescription( Tests_QueueTestSuite, suiteDescription_QueueTestSuite, 54, "test_assign" ) {}
+ void runTest() { suite_QueueTestSuite.test_assign(); }
+} testDescription_QueueTestSuite_test_assign;
+
+#include "test/common/rational.h"
+
+static RationalTestSuite suite_RationalTestSuite;
+
+static CxxTest::List Tests_RationalTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RationalTestSuite( "test/common/rational.h", 5, "RationalTestSuite", suite_RationalTestSuite, Tests_RationalTestSuite );
+
+static class TestDescription_RationalTestSuite_test_operators : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RationalTestSuite_test_operators() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 7, "test_operators" ) {}
+ void runTest() { suite_RationalTestSuite.test_operators(); }
+} testDescription_RationalTestSuite_test_operators;
+
+static class TestDescription_RationalTestSuite_test_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RationalTestSuite_test_assign() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 48, "test_assign" ) {}
+ void runTest() { suite_RationalTestSuite.test_assign(); }
+} testDescription_RationalTestSuite_test_assign;
+
+static class TestDescription_RationalTestSuite_test_negative : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RationalTestSuite_test_negative() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 60, "test_negative" ) {}
+ void runTest() { suite_RationalTestSuite.test_negative(); }
+} testDescription_RationalTestSuite_test_negative;
+
+static class TestDescription_RationalTestSuite_test_add_sub : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RationalTestSuite_test_add_sub() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 74, "test_add_sub" ) {}
+ void runTest() { suite_RationalTestSuite.test_add_sub(); }
+} testDescription_RationalTestSuite_test_add_sub;
+
+static class TestDescription_RationalTestSuite_test_add_sub2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RationalTestSuite_test_add_sub2() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 89, "test_add_sub2" ) {}
+ void runTest() { suite_RationalTestSuite.test_add_sub2(); }
+} testDescription_RationalTestSuite_test_add_sub2;
+
+static class TestDescription_RationalTestSuite_test_mul : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RationalTestSuite_test_mul() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 105, "test_mul" ) {}
+ void runTest() { suite_RationalTestSuite.test_mul(); }
+} testDescription_RationalTestSuite_test_mul;
+
+static class TestDescription_RationalTestSuite_test_div : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RationalTestSuite_test_div() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 124, "test_div" ) {}
+ void runTest() { suite_RationalTestSuite.test_div(); }
+} testDescription_RationalTestSuite_test_div;
+
+static class TestDescription_RationalTestSuite_test_isOne : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RationalTestSuite_test_isOne() : CxxTest::RealTestDescription( Tests_RationalTestSuite, suiteDescription_RationalTestSuite, 134, "test_isOne" ) {}
+ void runTest() { suite_RationalTestSuite.test_isOne(); }
+} testDescription_RationalTestSuite_test_isOne;
+
+#include "test/common/rect.h"
+
+static RectTestSuite suite_RectTestSuite;
+
+static CxxTest::List Tests_RectTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RectTestSuite( "test/common/rect.h", 5, "RectTestSuite", suite_RectTestSuite, Tests_RectTestSuite );
+
+static class TestDescription_RectTestSuite_test_point_sqrDist : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RectTestSuite_test_point_sqrDist() : CxxTest::RealTestDescription( Tests_RectTestSuite, suiteDescription_RectTestSuite, 8, "test_point_sqrDist" ) {}
+ void runTest() { suite_RectTestSuite.test_point_sqrDist(); }
+} testDescription_RectTestSuite_test_point_sqrDist;
+
+static class TestDescription_RectTestSuite_test_intersects : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RectTestSuite_test_intersects() : CxxTest::RealTestDescription( Tests_RectTestSuite, suiteDescription_RectTestSuite, 21, "test_intersects" ) {}
+ void runTest() { suite_RectTestSuite.test_intersects(); }
+} testDescription_RectTestSuite_test_intersects;
+
+static class TestDescription_RectTestSuite_test_contains : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RectTestSuite_test_contains() : CxxTest::RealTestDescription( Tests_RectTestSuite, suiteDescription_RectTestSuite, 27, "test_contains" ) {}
+ void runTest() { suite_RectTestSuite.test_contains(); }
+} testDescription_RectTestSuite_test_contains;
+
+static class TestDescription_RectTestSuite_test_extend : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RectTestSuite_test_extend() : CxxTest::RealTestDescription( Tests_RectTestSuite, suiteDescription_RectTestSuite, 44, "test_extend" ) {}
+ void runTest() { suite_RectTestSuite.test_extend(); }
+} testDescription_RectTestSuite_test_extend;
+
+#include "test/common/rendermode.h"
+
+static RenderModeTestSuite suite_RenderModeTestSuite;
+
+static CxxTest::List Tests_RenderModeTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RenderModeTestSuite( "test/common/rendermode.h", 6, "RenderModeTestSuite", suite_RenderModeTestSuite, Tests_RenderModeTestSuite );
+
+static class TestDescription_RenderModeTestSuite_test_parse_render_mode_good : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RenderModeTestSuite_test_parse_render_mode_good() : CxxTest::RealTestDescription( Tests_RenderModeTestSuite, suiteDescription_RenderModeTestSuite, 8, "test_parse_render_mode_good" ) {}
+ void runTest() { suite_RenderModeTestSuite.test_parse_render_mode_good(); }
+} testDescription_RenderModeTestSuite_test_parse_render_mode_good;
+
+static class TestDescription_RenderModeTestSuite_test_parse_render_mode_bad : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RenderModeTestSuite_test_parse_render_mode_bad() : CxxTest::RealTestDescription( Tests_RenderModeTestSuite, suiteDescription_RenderModeTestSuite, 28, "test_parse_render_mode_bad" ) {}
+ void runTest() { suite_RenderModeTestSuite.test_parse_render_mode_bad(); }
+} testDescription_RenderModeTestSuite_test_parse_render_mode_bad;
+
+static class TestDescription_RenderModeTestSuite_test_get_render_mode_code_back_and_forth : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RenderModeTestSuite_test_get_render_mode_code_back_and_forth() : CxxTest::RealTestDescription( Tests_RenderModeTestSuite, suiteDescription_RenderModeTestSuite, 46, "test_get_render_mode_code_back_and_forth" ) {}
+ void runTest() { suite_RenderModeTestSuite.test_get_render_mode_code_back_and_forth(); }
+} testDescription_RenderModeTestSuite_test_get_render_mode_code_back_and_forth;
+
+static class TestDescription_RenderModeTestSuite_test_render_2_guio : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RenderModeTestSuite_test_render_2_guio() : CxxTest::RealTestDescription( Tests_RenderModeTestSuite, suiteDescription_RenderModeTestSuite, 64, "test_render_2_guio" ) {}
+ void runTest() { suite_RenderModeTestSuite.test_render_2_guio(); }
+} testDescription_RenderModeTestSuite_test_render_2_guio;
+
+#include "test/common/seekablesubreadstream.h"
+
+static SeekableSubReadStreamTestSuite suite_SeekableSubReadStreamTestSuite;
+
+static CxxTest::List Tests_SeekableSubReadStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SeekableSubReadStreamTestSuite( "test/common/seekablesubreadstream.h", 6, "SeekableSubReadStreamTestSuite", suite_SeekableSubReadStreamTestSuite, Tests_SeekableSubReadStreamTestSuite );
+
+static class TestDescription_SeekableSubReadStreamTestSuite_test_traverse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SeekableSubReadStreamTestSuite_test_traverse() : CxxTest::RealTestDescription( Tests_SeekableSubReadStreamTestSuite, suiteDescription_SeekableSubReadStreamTestSuite, 8, "test_traverse" ) {}
+ void runTest() { suite_SeekableSubReadStreamTestSuite.test_traverse(); }
+} testDescription_SeekableSubReadStreamTestSuite_test_traverse;
+
+static class TestDescription_SeekableSubReadStreamTestSuite_test_seek : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SeekableSubReadStreamTestSuite_test_seek() : CxxTest::RealTestDescription( Tests_SeekableSubReadStreamTestSuite, suiteDescription_SeekableSubReadStreamTestSuite, 32, "test_seek" ) {}
+ void runTest() { suite_SeekableSubReadStreamTestSuite.test_seek(); }
+} testDescription_SeekableSubReadStreamTestSuite_test_seek;
+
+#include "test/common/serializer.h"
+
+static SerializerTestSuite suite_SerializerTestSuite;
+
+static CxxTest::List Tests_SerializerTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SerializerTestSuite( "test/common/serializer.h", 7, "SerializerTestSuite", suite_SerializerTestSuite, Tests_SerializerTestSuite );
+
+static class TestDescription_SerializerTestSuite_test_read_v1_as_v1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SerializerTestSuite_test_read_v1_as_v1() : CxxTest::RealTestDescription( Tests_SerializerTestSuite, suiteDescription_SerializerTestSuite, 97, "test_read_v1_as_v1" ) {}
+ void runTest() { suite_SerializerTestSuite.test_read_v1_as_v1(); }
+} testDescription_SerializerTestSuite_test_read_v1_as_v1;
+
+static class TestDescription_SerializerTestSuite_test_read_v1_as_v2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SerializerTestSuite_test_read_v1_as_v2() : CxxTest::RealTestDescription( Tests_SerializerTestSuite, suiteDescription_SerializerTestSuite, 105, "test_read_v1_as_v2" ) {}
+ void runTest() { suite_SerializerTestSuite.test_read_v1_as_v2(); }
+} testDescription_SerializerTestSuite_test_read_v1_as_v2;
+
+static class TestDescription_SerializerTestSuite_test_read_v2_as_v2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SerializerTestSuite_test_read_v2_as_v2() : CxxTest::RealTestDescription( Tests_SerializerTestSuite, suiteDescription_SerializerTestSuite, 109, "test_read_v2_as_v2" ) {}
+ void runTest() { suite_SerializerTestSuite.test_read_v2_as_v2(); }
+} testDescription_SerializerTestSuite_test_read_v2_as_v2;
+
+static class TestDescription_SerializerTestSuite_test_sync_array_as : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SerializerTestSuite_test_sync_array_as() : CxxTest::RealTestDescription( Tests_SerializerTestSuite, suiteDescription_SerializerTestSuite, 113, "test_sync_array_as" ) {}
+ void runTest() { suite_SerializerTestSuite.test_sync_array_as(); }
+} testDescription_SerializerTestSuite_test_sync_array_as;
+
+#include "test/common/span.h"
+
+static SpanTestSuite suite_SpanTestSuite;
+
+static CxxTest::List Tests_SpanTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SpanTestSuite( "test/common/span.h", 8, "SpanTestSuite", suite_SpanTestSuite, Tests_SpanTestSuite );
+
+static class TestDescription_SpanTestSuite_test_sibling_span : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_sibling_span() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 64, "test_sibling_span" ) {}
+ void runTest() { suite_SpanTestSuite.test_sibling_span(); }
+} testDescription_SpanTestSuite_test_sibling_span;
+
+static class TestDescription_SpanTestSuite_test_sub_span : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_sub_span() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 72, "test_sub_span" ) {}
+ void runTest() { suite_SpanTestSuite.test_sub_span(); }
+} testDescription_SpanTestSuite_test_sub_span;
+
+static class TestDescription_SpanTestSuite_test_span_iterator_const : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_iterator_const() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 82, "test_span_iterator_const" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_iterator_const(); }
+} testDescription_SpanTestSuite_test_span_iterator_const;
+
+static class TestDescription_SpanTestSuite_test_span_iterator : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_iterator() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 134, "test_span_iterator" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_iterator(); }
+} testDescription_SpanTestSuite_test_span_iterator;
+
+static class TestDescription_SpanTestSuite_test_span_iterator_integers : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_iterator_integers() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 200, "test_span_iterator_integers" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_iterator_integers(); }
+} testDescription_SpanTestSuite_test_span_iterator_integers;
+
+static class TestDescription_SpanTestSuite_test_span_iterator_ptr : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_iterator_ptr() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 225, "test_span_iterator_ptr" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_iterator_ptr(); }
+} testDescription_SpanTestSuite_test_span_iterator_ptr;
+
+static class TestDescription_SpanTestSuite_test_span_owner : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_owner() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 242, "test_span_owner" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_owner(); }
+} testDescription_SpanTestSuite_test_span_owner;
+
+static class TestDescription_SpanTestSuite_test_span_owner_named_span : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_owner_named_span() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 337, "test_span_owner_named_span" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_owner_named_span(); }
+} testDescription_SpanTestSuite_test_span_owner_named_span;
+
+static class TestDescription_SpanTestSuite_test_span_allocate_from_stream : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_allocate_from_stream() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 412, "test_span_allocate_from_stream" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_allocate_from_stream(); }
+} testDescription_SpanTestSuite_test_span_allocate_from_stream;
+
+static class TestDescription_SpanTestSuite_test_span_byte : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_byte() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 447, "test_span_byte" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_byte(); }
+} testDescription_SpanTestSuite_test_span_byte;
+
+static class TestDescription_SpanTestSuite_test_span_integers : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_integers() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 485, "test_span_integers" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_integers(); }
+} testDescription_SpanTestSuite_test_span_integers;
+
+static class TestDescription_SpanTestSuite_test_span_string : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_string() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 511, "test_span_string" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_string(); }
+} testDescription_SpanTestSuite_test_span_string;
+
+static class TestDescription_SpanTestSuite_test_span_unsafe_data : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_unsafe_data() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 524, "test_span_unsafe_data" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_unsafe_data(); }
+} testDescription_SpanTestSuite_test_span_unsafe_data;
+
+static class TestDescription_SpanTestSuite_test_span_subspan : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_subspan() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 540, "test_span_subspan" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_subspan(); }
+} testDescription_SpanTestSuite_test_span_subspan;
+
+static class TestDescription_SpanTestSuite_test_span_to_stream : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_to_stream() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 601, "test_span_to_stream" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_to_stream(); }
+} testDescription_SpanTestSuite_test_span_to_stream;
+
+static class TestDescription_SpanTestSuite_test_span_copying : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_copying() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 630, "test_span_copying" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_copying(); }
+} testDescription_SpanTestSuite_test_span_copying;
+
+static class TestDescription_SpanTestSuite_test_span_validation : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_validation() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 648, "test_span_validation" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_validation(); }
+} testDescription_SpanTestSuite_test_span_validation;
+
+static class TestDescription_SpanTestSuite_test_span_validation_message : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_validation_message() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 668, "test_span_validation_message" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_validation_message(); }
+} testDescription_SpanTestSuite_test_span_validation_message;
+
+static class TestDescription_SpanTestSuite_test_span_comparators : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_span_comparators() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 689, "test_span_comparators" ) {}
+ void runTest() { suite_SpanTestSuite.test_span_comparators(); }
+} testDescription_SpanTestSuite_test_span_comparators;
+
+static class TestDescription_SpanTestSuite_test_named_span : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SpanTestSuite_test_named_span() : CxxTest::RealTestDescription( Tests_SpanTestSuite, suiteDescription_SpanTestSuite, 716, "test_named_span" ) {}
+ void runTest() { suite_SpanTestSuite.test_named_span(); }
+} testDescription_SpanTestSuite_test_named_span;
+
+#include "test/common/stack.h"
+
+static StackTestSuite suite_StackTestSuite;
+
+static CxxTest::List Tests_StackTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StackTestSuite( "test/common/stack.h", 5, "StackTestSuite", suite_StackTestSuite, Tests_StackTestSuite );
+
+static class TestDescription_StackTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StackTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_StackTestSuite, suiteDescription_StackTestSuite, 7, "test_empty_clear" ) {}
+ void runTest() { suite_StackTestSuite.test_empty_clear(); }
+} testDescription_StackTestSuite_test_empty_clear;
+
+static class TestDescription_StackTestSuite_test_size : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StackTestSuite_test_size() : CxxTest::RealTestDescription( Tests_StackTestSuite, suiteDescription_StackTestSuite, 20, "test_size" ) {}
+ void runTest() { suite_StackTestSuite.test_size(); }
+} testDescription_StackTestSuite_test_size;
+
+static class TestDescription_StackTestSuite_test_top_pop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StackTestSuite_test_top_pop() : CxxTest::RealTestDescription( Tests_StackTestSuite, suiteDescription_StackTestSuite, 37, "test_top_pop" ) {}
+ void runTest() { suite_StackTestSuite.test_top_pop(); }
+} testDescription_StackTestSuite_test_top_pop;
+
+static class TestDescription_StackTestSuite_test_assign : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StackTestSuite_test_assign() : CxxTest::RealTestDescription( Tests_StackTestSuite, suiteDescription_StackTestSuite, 55, "test_assign" ) {}
+ void runTest() { suite_StackTestSuite.test_assign(); }
+} testDescription_StackTestSuite_test_assign;
+
+#include "test/common/str.h"
+
+static StringTestSuite suite_StringTestSuite;
+
+static CxxTest::List Tests_StringTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_StringTestSuite( "test/common/str.h", 9, "StringTestSuite", suite_StringTestSuite, Tests_StringTestSuite );
+
+static class TestDescription_StringTestSuite_test_constructors : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_constructors() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 12, "test_constructors" ) {}
+ void runTest() { suite_StringTestSuite.test_constructors(); }
+} testDescription_StringTestSuite_test_constructors;
+
+static class TestDescription_StringTestSuite_test_trim : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_trim() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 23, "test_trim" ) {}
+ void runTest() { suite_StringTestSuite.test_trim(); }
+} testDescription_StringTestSuite_test_trim;
+
+static class TestDescription_StringTestSuite_test_chop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_chop() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 31, "test_chop" ) {}
+ void runTest() { suite_StringTestSuite.test_chop(); }
+} testDescription_StringTestSuite_test_chop;
+
+static class TestDescription_StringTestSuite_test_empty_clear : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_empty_clear() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 55, "test_empty_clear" ) {}
+ void runTest() { suite_StringTestSuite.test_empty_clear(); }
+} testDescription_StringTestSuite_test_empty_clear;
+
+static class TestDescription_StringTestSuite_test_lastChar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_lastChar() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 62, "test_lastChar" ) {}
+ void runTest() { suite_StringTestSuite.test_lastChar(); }
+} testDescription_StringTestSuite_test_lastChar;
+
+static class TestDescription_StringTestSuite_test_firstChar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_firstChar() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 71, "test_firstChar" ) {}
+ void runTest() { suite_StringTestSuite.test_firstChar(); }
+} testDescription_StringTestSuite_test_firstChar;
+
+static class TestDescription_StringTestSuite_test_concat1 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_concat1() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 80, "test_concat1" ) {}
+ void runTest() { suite_StringTestSuite.test_concat1(); }
+} testDescription_StringTestSuite_test_concat1;
+
+static class TestDescription_StringTestSuite_test_concat2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_concat2() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 88, "test_concat2" ) {}
+ void runTest() { suite_StringTestSuite.test_concat2(); }
+} testDescription_StringTestSuite_test_concat2;
+
+static class TestDescription_StringTestSuite_test_concat3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_concat3() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 94, "test_concat3" ) {}
+ void runTest() { suite_StringTestSuite.test_concat3(); }
+} testDescription_StringTestSuite_test_concat3;
+
+static class TestDescription_StringTestSuite_test_refCount : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_refCount() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 100, "test_refCount" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount(); }
+} testDescription_StringTestSuite_test_refCount;
+
+static class TestDescription_StringTestSuite_test_refCount2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_refCount2() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 115, "test_refCount2" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount2(); }
+} testDescription_StringTestSuite_test_refCount2;
+
+static class TestDescription_StringTestSuite_test_refCount3 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_refCount3() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 130, "test_refCount3" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount3(); }
+} testDescription_StringTestSuite_test_refCount3;
+
+static class TestDescription_StringTestSuite_test_refCount4 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_refCount4() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 144, "test_refCount4" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount4(); }
+} testDescription_StringTestSuite_test_refCount4;
+
+static class TestDescription_StringTestSuite_test_refCount5 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_refCount5() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 158, "test_refCount5" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount5(); }
+} testDescription_StringTestSuite_test_refCount5;
+
+static class TestDescription_StringTestSuite_test_refCount6 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_refCount6() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 170, "test_refCount6" ) {}
+ void runTest() { suite_StringTestSuite.test_refCount6(); }
+} testDescription_StringTestSuite_test_refCount6;
+
+static class TestDescription_StringTestSuite_test_self_asignment : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_self_asignment() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 182, "test_self_asignment" ) {}
+ void runTest() { suite_StringTestSuite.test_self_asignment(); }
+} testDescription_StringTestSuite_test_self_asignment;
+
+static class TestDescription_StringTestSuite_test_hasPrefix : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_hasPrefix() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 232, "test_hasPrefix" ) {}
+ void runTest() { suite_StringTestSuite.test_hasPrefix(); }
+} testDescription_StringTestSuite_test_hasPrefix;
+
+static class TestDescription_StringTestSuite_test_hasSuffix : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_hasSuffix() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 240, "test_hasSuffix" ) {}
+ void runTest() { suite_StringTestSuite.test_hasSuffix(); }
+} testDescription_StringTestSuite_test_hasSuffix;
+
+static class TestDescription_StringTestSuite_test_contains : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_contains() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 248, "test_contains" ) {}
+ void runTest() { suite_StringTestSuite.test_contains(); }
+} testDescription_StringTestSuite_test_contains;
+
+static class TestDescription_StringTestSuite_test_toLowercase : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_toLowercase() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 259, "test_toLowercase" ) {}
+ void runTest() { suite_StringTestSuite.test_toLowercase(); }
+} testDescription_StringTestSuite_test_toLowercase;
+
+static class TestDescription_StringTestSuite_test_toUppercase : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_toUppercase() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 267, "test_toUppercase" ) {}
+ void runTest() { suite_StringTestSuite.test_toUppercase(); }
+} testDescription_StringTestSuite_test_toUppercase;
+
+static class TestDescription_StringTestSuite_test_deleteChar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_deleteChar() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 275, "test_deleteChar" ) {}
+ void runTest() { suite_StringTestSuite.test_deleteChar(); }
+} testDescription_StringTestSuite_test_deleteChar;
+
+static class TestDescription_StringTestSuite_test_erase : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_erase() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 283, "test_erase" ) {}
+ void runTest() { suite_StringTestSuite.test_erase(); }
+} testDescription_StringTestSuite_test_erase;
+
+static class TestDescription_StringTestSuite_test_sharing : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_sharing() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 291, "test_sharing" ) {}
+ void runTest() { suite_StringTestSuite.test_sharing(); }
+} testDescription_StringTestSuite_test_sharing;
+
+static class TestDescription_StringTestSuite_test_lastPathComponent : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_lastPathComponent() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 300, "test_lastPathComponent" ) {}
+ void runTest() { suite_StringTestSuite.test_lastPathComponent(); }
+} testDescription_StringTestSuite_test_lastPathComponent;
+
+static class TestDescription_StringTestSuite_test_normalizePath : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_normalizePath() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 318, "test_normalizePath" ) {}
+ void runTest() { suite_StringTestSuite.test_normalizePath(); }
+} testDescription_StringTestSuite_test_normalizePath;
+
+static class TestDescription_StringTestSuite_test_matchString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_matchString() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 347, "test_matchString" ) {}
+ void runTest() { suite_StringTestSuite.test_matchString(); }
+} testDescription_StringTestSuite_test_matchString;
+
+static class TestDescription_StringTestSuite_test_string_printf : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_string_printf() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 383, "test_string_printf" ) {}
+ void runTest() { suite_StringTestSuite.test_string_printf(); }
+} testDescription_StringTestSuite_test_string_printf;
+
+static class TestDescription_StringTestSuite_test_ustring_printf : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_ustring_printf() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 394, "test_ustring_printf" ) {}
+ void runTest() { suite_StringTestSuite.test_ustring_printf(); }
+} testDescription_StringTestSuite_test_ustring_printf;
+
+static class TestDescription_StringTestSuite_test_strlcpy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_strlcpy() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 411, "test_strlcpy" ) {}
+ void runTest() { suite_StringTestSuite.test_strlcpy(); }
+} testDescription_StringTestSuite_test_strlcpy;
+
+static class TestDescription_StringTestSuite_test_strlcat : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_strlcat() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 433, "test_strlcat" ) {}
+ void runTest() { suite_StringTestSuite.test_strlcat(); }
+} testDescription_StringTestSuite_test_strlcat;
+
+static class TestDescription_StringTestSuite_test_strnlen : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_strnlen() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 464, "test_strnlen" ) {}
+ void runTest() { suite_StringTestSuite.test_strnlen(); }
+} testDescription_StringTestSuite_test_strnlen;
+
+static class TestDescription_StringTestSuite_test_scumm_stricmp : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_scumm_stricmp() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 487, "test_scumm_stricmp" ) {}
+ void runTest() { suite_StringTestSuite.test_scumm_stricmp(); }
+} testDescription_StringTestSuite_test_scumm_stricmp;
+
+static class TestDescription_StringTestSuite_test_scumm_strnicmp : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_scumm_strnicmp() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 494, "test_scumm_strnicmp" ) {}
+ void runTest() { suite_StringTestSuite.test_scumm_strnicmp(); }
+} testDescription_StringTestSuite_test_scumm_strnicmp;
+
+static class TestDescription_StringTestSuite_test_wordWrap : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_wordWrap() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 504, "test_wordWrap" ) {}
+ void runTest() { suite_StringTestSuite.test_wordWrap(); }
+} testDescription_StringTestSuite_test_wordWrap;
+
+static class TestDescription_StringTestSuite_test_replace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_replace() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 526, "test_replace" ) {}
+ void runTest() { suite_StringTestSuite.test_replace(); }
+} testDescription_StringTestSuite_test_replace;
+
+static class TestDescription_StringTestSuite_test_ustring_replace : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_ustring_replace() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 600, "test_ustring_replace" ) {}
+ void runTest() { suite_StringTestSuite.test_ustring_replace(); }
+} testDescription_StringTestSuite_test_ustring_replace;
+
+static class TestDescription_StringTestSuite_test_find : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_find() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 658, "test_find" ) {}
+ void runTest() { suite_StringTestSuite.test_find(); }
+} testDescription_StringTestSuite_test_find;
+
+static class TestDescription_StringTestSuite_test_setChar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_setChar() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 674, "test_setChar" ) {}
+ void runTest() { suite_StringTestSuite.test_setChar(); }
+} testDescription_StringTestSuite_test_setChar;
+
+static class TestDescription_StringTestSuite_test_insertChar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_insertChar() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 682, "test_insertChar" ) {}
+ void runTest() { suite_StringTestSuite.test_insertChar(); }
+} testDescription_StringTestSuite_test_insertChar;
+
+static class TestDescription_StringTestSuite_test_insertString : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_insertString() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 692, "test_insertString" ) {}
+ void runTest() { suite_StringTestSuite.test_insertString(); }
+} testDescription_StringTestSuite_test_insertString;
+
+static class TestDescription_StringTestSuite_test_comparison : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_comparison() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 702, "test_comparison" ) {}
+ void runTest() { suite_StringTestSuite.test_comparison(); }
+} testDescription_StringTestSuite_test_comparison;
+
+static class TestDescription_StringTestSuite_test_ustr_comparison : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_ustr_comparison() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 725, "test_ustr_comparison" ) {}
+ void runTest() { suite_StringTestSuite.test_ustr_comparison(); }
+} testDescription_StringTestSuite_test_ustr_comparison;
+
+static class TestDescription_StringTestSuite_test_concat_temporaries : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_concat_temporaries() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 750, "test_concat_temporaries" ) {}
+ void runTest() { suite_StringTestSuite.test_concat_temporaries(); }
+} testDescription_StringTestSuite_test_concat_temporaries;
+
+static class TestDescription_StringTestSuite_test_reserve : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_reserve() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 760, "test_reserve" ) {}
+ void runTest() { suite_StringTestSuite.test_reserve(); }
+} testDescription_StringTestSuite_test_reserve;
+
+static class TestDescription_StringTestSuite_test_string_builder : public CxxTest::RealTestDescription {
+public:
+ TestDescription_StringTestSuite_test_string_builder() : CxxTest::RealTestDescription( Tests_StringTestSuite, suiteDescription_StringTestSuite, 771, "test_string_builder" ) {}
+ void runTest() { suite_StringTestSuite.test_string_builder(); }
+} testDescription_StringTestSuite_test_string_builder;
+
+#include "test/common/stream.h"
+
+static ReadLineStreamTestSuite suite_ReadLineStreamTestSuite;
+
+static CxxTest::List Tests_ReadLineStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ReadLineStreamTestSuite( "test/common/stream.h", 5, "ReadLineStreamTestSuite", suite_ReadLineStreamTestSuite, Tests_ReadLineStreamTestSuite );
+
+static class TestDescription_ReadLineStreamTestSuite_test_readline : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ReadLineStreamTestSuite_test_readline() : CxxTest::RealTestDescription( Tests_ReadLineStreamTestSuite, suiteDescription_ReadLineStreamTestSuite, 7, "test_readline" ) {}
+ void runTest() { suite_ReadLineStreamTestSuite.test_readline(); }
+} testDescription_ReadLineStreamTestSuite_test_readline;
+
+static class TestDescription_ReadLineStreamTestSuite_test_readline2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ReadLineStreamTestSuite_test_readline2() : CxxTest::RealTestDescription( Tests_ReadLineStreamTestSuite, suiteDescription_ReadLineStreamTestSuite, 29, "test_readline2" ) {}
+ void runTest() { suite_ReadLineStreamTestSuite.test_readline2(); }
+} testDescription_ReadLineStreamTestSuite_test_readline2;
+
+static class TestDescription_ReadLineStreamTestSuite_test_read_arrays : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ReadLineStreamTestSuite_test_read_arrays() : CxxTest::RealTestDescription( Tests_ReadLineStreamTestSuite, suiteDescription_ReadLineStreamTestSuite, 47, "test_read_arrays" ) {}
+ void runTest() { suite_ReadLineStreamTestSuite.test_read_arrays(); }
+} testDescription_ReadLineStreamTestSuite_test_read_arrays;
+
+#include "test/common/subreadstream.h"
+
+static SubReadStreamTestSuite suite_SubReadStreamTestSuite;
+
+static CxxTest::List Tests_SubReadStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SubReadStreamTestSuite( "test/common/subreadstream.h", 6, "SubReadStreamTestSuite", suite_SubReadStreamTestSuite, Tests_SubReadStreamTestSuite );
+
+static class TestDescription_SubReadStreamTestSuite_test_traverse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SubReadStreamTestSuite_test_traverse() : CxxTest::RealTestDescription( Tests_SubReadStreamTestSuite, suiteDescription_SubReadStreamTestSuite, 8, "test_traverse" ) {}
+ void runTest() { suite_SubReadStreamTestSuite.test_traverse(); }
+} testDescription_SubReadStreamTestSuite_test_traverse;
+
+static class TestDescription_SubReadStreamTestSuite_test_safe_eos : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SubReadStreamTestSuite_test_safe_eos() : CxxTest::RealTestDescription( Tests_SubReadStreamTestSuite, suiteDescription_SubReadStreamTestSuite, 30, "test_safe_eos" ) {}
+ void runTest() { suite_SubReadStreamTestSuite.test_safe_eos(); }
+} testDescription_SubReadStreamTestSuite_test_safe_eos;
+
+#include "test/common/threadpool.h"
+
+static ThreadPoolTestSuite suite_ThreadPoolTestSuite;
+
+static CxxTest::List Tests_ThreadPoolTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ThreadPoolTestSuite( "test/common/threadpool.h", 33, "ThreadPoolTestSuite", suite_ThreadPoolTestSuite, Tests_ThreadPoolTestSuite );
+
+static class TestDescription_ThreadPoolTestSuite_test_parallel_for : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ThreadPoolTestSuite_test_parallel_for() : CxxTest::RealTestDescription( Tests_ThreadPoolTestSuite, suiteDescription_ThreadPoolTestSuite, 35, "test_parallel_for" ) {}
+ void runTest() { suite_ThreadPoolTestSuite.test_parallel_for(); }
+} testDescription_ThreadPoolTestSuite_test_parallel_for;
+
+static class TestDescription_ThreadPoolTestSuite_test_inline : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ThreadPoolTestSuite_test_inline() : CxxTest::RealTestDescription( Tests_ThreadPoolTestSuite, suiteDescription_ThreadPoolTestSuite, 66, "test_inline" ) {}
+ void runTest() { suite_ThreadPoolTestSuite.test_inline(); }
+} testDescription_ThreadPoolTestSuite_test_inline;
+
+#include "test/common/timer.h"
+
+static TimerTestSuite suite_TimerTestSuite;
+
+static CxxTest::List Tests_TimerTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TimerTestSuite( "test/common/timer.h", 36, "TimerTestSuite", suite_TimerTestSuite, Tests_TimerTestSuite );
+
+static class TestDescription_TimerTestSuite_test_order : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimerTestSuite_test_order() : CxxTest::RealTestDescription( Tests_TimerTestSuite, suiteDescription_TimerTestSuite, 38, "test_order" ) {}
+ void runTest() { suite_TimerTestSuite.test_order(); }
+} testDescription_TimerTestSuite_test_order;
+
+static class TestDescription_TimerTestSuite_test_remove : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimerTestSuite_test_remove() : CxxTest::RealTestDescription( Tests_TimerTestSuite, suiteDescription_TimerTestSuite, 73, "test_remove" ) {}
+ void runTest() { suite_TimerTestSuite.test_remove(); }
+} testDescription_TimerTestSuite_test_remove;
+
+#include "test/common/tokenizer.h"
+
+static TokenizerTestSuite suite_TokenizerTestSuite;
+
+static CxxTest::List Tests_TokenizerTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TokenizerTestSuite( "test/common/tokenizer.h", 5, "TokenizerTestSuite", suite_TokenizerTestSuite, Tests_TokenizerTestSuite );
+
+static class TestDescription_TokenizerTestSuite_test_nextToken : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TokenizerTestSuite_test_nextToken() : CxxTest::RealTestDescription( Tests_TokenizerTestSuite, suiteDescription_TokenizerTestSuite, 7, "test_nextToken" ) {}
+ void runTest() { suite_TokenizerTestSuite.test_nextToken(); }
+} testDescription_TokenizerTestSuite_test_nextToken;
+
+static class TestDescription_TokenizerTestSuite_test_resetAndEmpty : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TokenizerTestSuite_test_resetAndEmpty() : CxxTest::RealTestDescription( Tests_TokenizerTestSuite, suiteDescription_TokenizerTestSuite, 40, "test_resetAndEmpty" ) {}
+ void runTest() { suite_TokenizerTestSuite.test_resetAndEmpty(); }
+} testDescription_TokenizerTestSuite_test_resetAndEmpty;
+
+#include "test/common/util.h"
+
+static UtilTestSuite suite_UtilTestSuite;
+
+static CxxTest::List Tests_UtilTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_UtilTestSuite( "test/common/util.h", 7, "UtilTestSuite", suite_UtilTestSuite, Tests_UtilTestSuite );
+
+static class TestDescription_UtilTestSuite_test_parsebool_yesno : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_parsebool_yesno() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 9, "test_parsebool_yesno" ) {}
+ void runTest() { suite_UtilTestSuite.test_parsebool_yesno(); }
+} testDescription_UtilTestSuite_test_parsebool_yesno;
+
+static class TestDescription_UtilTestSuite_test_parsebool_truefalse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_parsebool_truefalse() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 28, "test_parsebool_truefalse" ) {}
+ void runTest() { suite_UtilTestSuite.test_parsebool_truefalse(); }
+} testDescription_UtilTestSuite_test_parsebool_truefalse;
+
+static class TestDescription_UtilTestSuite_test_parsebool_onezero : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_parsebool_onezero() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 47, "test_parsebool_onezero" ) {}
+ void runTest() { suite_UtilTestSuite.test_parsebool_onezero(); }
+} testDescription_UtilTestSuite_test_parsebool_onezero;
+
+static class TestDescription_UtilTestSuite_test_parsebool_bad : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_parsebool_bad() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 70, "test_parsebool_bad" ) {}
+ void runTest() { suite_UtilTestSuite.test_parsebool_bad(); }
+} testDescription_UtilTestSuite_test_parsebool_bad;
+
+static class TestDescription_UtilTestSuite_test_is_al_num : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_is_al_num() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 107, "test_is_al_num" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_al_num(); }
+} testDescription_UtilTestSuite_test_is_al_num;
+
+static class TestDescription_UtilTestSuite_test_is_alpha : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_is_alpha() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 128, "test_is_alpha" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_alpha(); }
+} testDescription_UtilTestSuite_test_is_alpha;
+
+static class TestDescription_UtilTestSuite_test_is_digit : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_is_digit() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 149, "test_is_digit" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_digit(); }
+} testDescription_UtilTestSuite_test_is_digit;
+
+static class TestDescription_UtilTestSuite_test_is_lower : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_is_lower() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 170, "test_is_lower" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_lower(); }
+} testDescription_UtilTestSuite_test_is_lower;
+
+static class TestDescription_UtilTestSuite_test_is_upper : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_is_upper() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 192, "test_is_upper" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_upper(); }
+} testDescription_UtilTestSuite_test_is_upper;
+
+static class TestDescription_UtilTestSuite_test_is_space : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_is_space() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 212, "test_is_space" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_space(); }
+} testDescription_UtilTestSuite_test_is_space;
+
+static class TestDescription_UtilTestSuite_test_is_print : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_is_print() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 226, "test_is_print" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_print(); }
+} testDescription_UtilTestSuite_test_is_print;
+
+static class TestDescription_UtilTestSuite_test_is_punct : public CxxTest::RealTestDescription {
+public:
+ TestDescription_UtilTestSuite_test_is_punct() : CxxTest::RealTestDescription( Tests_UtilTestSuite, suiteDescription_UtilTestSuite, 237, "test_is_punct" ) {}
+ void runTest() { suite_UtilTestSuite.test_is_punct(); }
+} testDescription_UtilTestSuite_test_is_punct;
+
+#include "test/common/formats/quicktime.h"
+
+static QuicktimeParserTestSuite suite_QuicktimeParserTestSuite;
+
+static CxxTest::List Tests_QuicktimeParserTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_QuicktimeParserTestSuite( "test/common/formats/quicktime.h", 43, "QuicktimeParserTestSuite", suite_QuicktimeParserTestSuite, Tests_QuicktimeParserTestSuite );
+
+static class TestDescription_QuicktimeParserTestSuite_test_streamAtEOS : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuicktimeParserTestSuite_test_streamAtEOS() : CxxTest::RealTestDescription( Tests_QuicktimeParserTestSuite, suiteDescription_QuicktimeParserTestSuite, 45, "test_streamAtEOS" ) {}
+ void runTest() { suite_QuicktimeParserTestSuite.test_streamAtEOS(); }
+} testDescription_QuicktimeParserTestSuite_test_streamAtEOS;
+
+static class TestDescription_QuicktimeParserTestSuite_test_streamInvalid : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuicktimeParserTestSuite_test_streamInvalid() : CxxTest::RealTestDescription( Tests_QuicktimeParserTestSuite, suiteDescription_QuicktimeParserTestSuite, 54, "test_streamInvalid" ) {}
+ void runTest() { suite_QuicktimeParserTestSuite.test_streamInvalid(); }
+} testDescription_QuicktimeParserTestSuite_test_streamInvalid;
+
+static class TestDescription_QuicktimeParserTestSuite_test_moov : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuicktimeParserTestSuite_test_moov() : CxxTest::RealTestDescription( Tests_QuicktimeParserTestSuite, suiteDescription_QuicktimeParserTestSuite, 62, "test_moov" ) {}
+ void runTest() { suite_QuicktimeParserTestSuite.test_moov(); }
+} testDescription_QuicktimeParserTestSuite_test_moov;
+
+static class TestDescription_QuicktimeParserTestSuite_test_mhdr : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuicktimeParserTestSuite_test_mhdr() : CxxTest::RealTestDescription( Tests_QuicktimeParserTestSuite, suiteDescription_QuicktimeParserTestSuite, 69, "test_mhdr" ) {}
+ void runTest() { suite_QuicktimeParserTestSuite.test_mhdr(); }
+} testDescription_QuicktimeParserTestSuite_test_mhdr;
+
+static class TestDescription_QuicktimeParserTestSuite_test_mhdrEarlyEOF : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuicktimeParserTestSuite_test_mhdrEarlyEOF() : CxxTest::RealTestDescription( Tests_QuicktimeParserTestSuite, suiteDescription_QuicktimeParserTestSuite, 79, "test_mhdrEarlyEOF" ) {}
+ void runTest() { suite_QuicktimeParserTestSuite.test_mhdrEarlyEOF(); }
+} testDescription_QuicktimeParserTestSuite_test_mhdrEarlyEOF;
+
+static class TestDescription_QuicktimeParserTestSuite_test_sampleIndex : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuicktimeParserTestSuite_test_sampleIndex() : CxxTest::RealTestDescription( Tests_QuicktimeParserTestSuite, suiteDescription_QuicktimeParserTestSuite, 86, "test_sampleIndex" ) {}
+ void runTest() { suite_QuicktimeParserTestSuite.test_sampleIndex(); }
+} testDescription_QuicktimeParserTestSuite_test_sampleIndex;
+
+#include "test/common/formats/xmlparser.h"
+
+static XMLParserTestSuite suite_XMLParserTestSuite;
+
+static CxxTest::List Tests_XMLParserTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_XMLParserTestSuite( "test/common/formats/xmlparser.h", 39, "XMLParserTestSuite", suite_XMLParserTestSuite, Tests_XMLParserTestSuite );
+
+static class TestDescription_XMLParserTestSuite_test_properties : public CxxTest::RealTestDescription {
+public:
+ TestDescription_XMLParserTestSuite_test_properties() : CxxTest::RealTestDescription( Tests_XMLParserTestSuite, suiteDescription_XMLParserTestSuite, 49, "test_properties" ) {}
+ void runTest() { suite_XMLParserTestSuite.test_properties(); }
+} testDescription_XMLParserTestSuite_test_properties;
+
+#include "test/common/compression/dcl.h"
+
+static DCLTestSuite suite_DCLTestSuite;
+
+static CxxTest::List Tests_DCLTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_DCLTestSuite( "test/common/compression/dcl.h", 8, "DCLTestSuite", suite_DCLTestSuite, Tests_DCLTestSuite );
+
+static class TestDescription_DCLTestSuite_test_known_stream : public CxxTest::RealTestDescription {
+public:
+ TestDescription_DCLTestSuite_test_known_stream() : CxxTest::RealTestDescription( Tests_DCLTestSuite, suiteDescription_DCLTestSuite, 35, "test_known_stream" ) {}
+ void runTest() { suite_DCLTestSuite.test_known_stream(); }
+} testDescription_DCLTestSuite_test_known_stream;
+
+static class TestDescription_DCLTestSuite_test_literals_and_copies : public CxxTest::RealTestDescription {
+public:
+ TestDescription_DCLTestSuite_test_literals_and_copies() : CxxTest::RealTestDescription( Tests_DCLTestSuite, suiteDescription_DCLTestSuite, 53, "test_literals_and_copies" ) {}
+ void runTest() { suite_DCLTestSuite.test_literals_and_copies(); }
+} testDescription_DCLTestSuite_test_literals_and_copies;
+
+static class TestDescription_DCLTestSuite_test_invalid_header : public CxxTest::RealTestDescription {
+public:
+ TestDescription_DCLTestSuite_test_invalid_header() : CxxTest::RealTestDescription( Tests_DCLTestSuite, suiteDescription_DCLTestSuite, 91, "test_invalid_header" ) {}
+ void runTest() { suite_DCLTestSuite.test_invalid_header(); }
+} testDescription_DCLTestSuite_test_invalid_header;
+
+#include "test/common/compression/huffman.h"
+
+static HuffmanTestSuite suite_HuffmanTestSuite;
+
+static CxxTest::List Tests_HuffmanTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_HuffmanTestSuite( "test/common/compression/huffman.h", 12, "HuffmanTestSuite", suite_HuffmanTestSuite, Tests_HuffmanTestSuite );
+
+static class TestDescription_HuffmanTestSuite_test_get_with_full_symbols : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HuffmanTestSuite_test_get_with_full_symbols() : CxxTest::RealTestDescription( Tests_HuffmanTestSuite, suiteDescription_HuffmanTestSuite, 14, "test_get_with_full_symbols" ) {}
+ void runTest() { suite_HuffmanTestSuite.test_get_with_full_symbols(); }
+} testDescription_HuffmanTestSuite_test_get_with_full_symbols;
+
+static class TestDescription_HuffmanTestSuite_test_get_without_symbols : public CxxTest::RealTestDescription {
+public:
+ TestDescription_HuffmanTestSuite_test_get_without_symbols() : CxxTest::RealTestDescription( Tests_HuffmanTestSuite, suiteDescription_HuffmanTestSuite, 60, "test_get_without_symbols" ) {}
+ void runTest() { suite_HuffmanTestSuite.test_get_without_symbols(); }
+} testDescription_HuffmanTestSuite_test_get_without_symbols;
+
+#include "test/audio/audiostream.h"
+
+static AudioStreamTestSuite suite_AudioStreamTestSuite;
+
+static CxxTest::List Tests_AudioStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_AudioStreamTestSuite( "test/audio/audiostream.h", 7, "AudioStreamTestSuite", suite_AudioStreamTestSuite, Tests_AudioStreamTestSuite );
+
+static class TestDescription_AudioStreamTestSuite_test_convertTimeToStreamPos : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_convertTimeToStreamPos() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 10, "test_convertTimeToStreamPos" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_convertTimeToStreamPos(); }
+} testDescription_AudioStreamTestSuite_test_convertTimeToStreamPos;
+
+static class TestDescription_AudioStreamTestSuite_test_looping_audio_stream_mono_11025_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_looping_audio_stream_mono_11025_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 104, "test_looping_audio_stream_mono_11025_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_looping_audio_stream_mono_11025_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_looping_audio_stream_mono_11025_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_looping_audio_stream_mono_22050_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_looping_audio_stream_mono_22050_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 108, "test_looping_audio_stream_mono_22050_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_looping_audio_stream_mono_22050_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_looping_audio_stream_mono_22050_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_looping_audio_stream_stereo_11025_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_looping_audio_stream_stereo_11025_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 112, "test_looping_audio_stream_stereo_11025_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_looping_audio_stream_stereo_11025_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_looping_audio_stream_stereo_11025_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_looping_audio_stream_stereo_22050_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_looping_audio_stream_stereo_22050_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 116, "test_looping_audio_stream_stereo_22050_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_looping_audio_stream_stereo_22050_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_looping_audio_stream_stereo_22050_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_mid_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_mid_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 177, "test_sub_looping_audio_stream_mono_11025_mid_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_mono_11025_mid_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_mid_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_mid_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_mid_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 181, "test_sub_looping_audio_stream_mono_22050_mid_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_mono_22050_mid_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_mid_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_mid_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_mid_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 185, "test_sub_looping_audio_stream_stereo_11025_mid_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_stereo_11025_mid_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_mid_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_mid_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_mid_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 189, "test_sub_looping_audio_stream_stereo_22050_mid_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_stereo_22050_mid_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_mid_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_end_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_end_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 193, "test_sub_looping_audio_stream_mono_11025_end_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_mono_11025_end_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_11025_end_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_end_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_end_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 197, "test_sub_looping_audio_stream_mono_22050_end_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_mono_22050_end_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_mono_22050_end_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_end_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_end_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 201, "test_sub_looping_audio_stream_stereo_11025_end_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_stereo_11025_end_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_11025_end_fixed_iter;
+
+static class TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_end_fixed_iter : public CxxTest::RealTestDescription {
+public:
+ TestDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_end_fixed_iter() : CxxTest::RealTestDescription( Tests_AudioStreamTestSuite, suiteDescription_AudioStreamTestSuite, 205, "test_sub_looping_audio_stream_stereo_22050_end_fixed_iter" ) {}
+ void runTest() { suite_AudioStreamTestSuite.test_sub_looping_audio_stream_stereo_22050_end_fixed_iter(); }
+} testDescription_AudioStreamTestSuite_test_sub_looping_audio_stream_stereo_22050_end_fixed_iter;
+
+#include "test/audio/decodeahead.h"
+
+static DecodeAheadTestSuite suite_DecodeAheadTestSuite;
+
+static CxxTest::List Tests_DecodeAheadTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_DecodeAheadTestSuite( "test/audio/decodeahead.h", 7, "DecodeAheadTestSuite", suite_DecodeAheadTestSuite, Tests_DecodeAheadTestSuite );
+
+static class TestDescription_DecodeAheadTestSuite_test_buffered_read : public CxxTest::RealTestDescription {
+public:
+ TestDescription_DecodeAheadTestSuite_test_buffered_read() : CxxTest::RealTestDescription( Tests_DecodeAheadTestSuite, suiteDescription_DecodeAheadTestSuite, 9, "test_buffered_read" ) {}
+ void runTest() { suite_DecodeAheadTestSuite.test_buffered_read(); }
+} testDescription_DecodeAheadTestSuite_test_buffered_read;
+
+static class TestDescription_DecodeAheadTestSuite_test_read_without_filling : public CxxTest::RealTestDescription {
+public:
+ TestDescription_DecodeAheadTestSuite_test_read_without_filling() : CxxTest::RealTestDescription( Tests_DecodeAheadTestSuite, suiteDescription_DecodeAheadTestSuite, 40, "test_read_without_filling" ) {}
+ void runTest() { suite_DecodeAheadTestSuite.test_read_without_filling(); }
+} testDescription_DecodeAheadTestSuite_test_read_without_filling;
+
+#include "test/audio/midicache.h"
+
+static MidiRenderCacheTestSuite suite_MidiRenderCacheTestSuite;
+
+static CxxTest::List Tests_MidiRenderCacheTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MidiRenderCacheTestSuite( "test/audio/midicache.h", 5, "MidiRenderCacheTestSuite", suite_MidiRenderCacheTestSuite, Tests_MidiRenderCacheTestSuite );
+
+static class TestDescription_MidiRenderCacheTestSuite_test_record_and_play_back : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MidiRenderCacheTestSuite_test_record_and_play_back() : CxxTest::RealTestDescription( Tests_MidiRenderCacheTestSuite, suiteDescription_MidiRenderCacheTestSuite, 31, "test_record_and_play_back" ) {}
+ void runTest() { suite_MidiRenderCacheTestSuite.test_record_and_play_back(); }
+} testDescription_MidiRenderCacheTestSuite_test_record_and_play_back;
+
+static class TestDescription_MidiRenderCacheTestSuite_test_stop : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MidiRenderCacheTestSuite_test_stop() : CxxTest::RealTestDescription( Tests_MidiRenderCacheTestSuite, suiteDescription_MidiRenderCacheTestSuite, 61, "test_stop" ) {}
+ void runTest() { suite_MidiRenderCacheTestSuite.test_stop(); }
+} testDescription_MidiRenderCacheTestSuite_test_stop;
+
+static class TestDescription_MidiRenderCacheTestSuite_test_sysex_state : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MidiRenderCacheTestSuite_test_sysex_state() : CxxTest::RealTestDescription( Tests_MidiRenderCacheTestSuite, suiteDescription_MidiRenderCacheTestSuite, 85, "test_sysex_state" ) {}
+ void runTest() { suite_MidiRenderCacheTestSuite.test_sysex_state(); }
+} testDescription_MidiRenderCacheTestSuite_test_sysex_state;
+
+#include "test/audio/mixbus.h"
+
+static MixBusTestSuite suite_MixBusTestSuite;
+
+static CxxTest::List Tests_MixBusTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MixBusTestSuite( "test/audio/mixbus.h", 9, "MixBusTestSuite", suite_MixBusTestSuite, Tests_MixBusTestSuite );
+
+static class TestDescription_MixBusTestSuite_test_accumulate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MixBusTestSuite_test_accumulate() : CxxTest::RealTestDescription( Tests_MixBusTestSuite, suiteDescription_MixBusTestSuite, 37, "test_accumulate" ) {}
+ void runTest() { suite_MixBusTestSuite.test_accumulate(); }
+} testDescription_MixBusTestSuite_test_accumulate;
+
+static class TestDescription_MixBusTestSuite_test_clamp : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MixBusTestSuite_test_clamp() : CxxTest::RealTestDescription( Tests_MixBusTestSuite, suiteDescription_MixBusTestSuite, 70, "test_clamp" ) {}
+ void runTest() { suite_MixBusTestSuite.test_clamp(); }
+} testDescription_MixBusTestSuite_test_clamp;
+
+static class TestDescription_MixBusTestSuite_test_convert_copy : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MixBusTestSuite_test_convert_copy() : CxxTest::RealTestDescription( Tests_MixBusTestSuite, suiteDescription_MixBusTestSuite, 87, "test_convert_copy" ) {}
+ void runTest() { suite_MixBusTestSuite.test_convert_copy(); }
+} testDescription_MixBusTestSuite_test_convert_copy;
+
+static class TestDescription_MixBusTestSuite_test_convert_simple : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MixBusTestSuite_test_convert_simple() : CxxTest::RealTestDescription( Tests_MixBusTestSuite, suiteDescription_MixBusTestSuite, 92, "test_convert_simple" ) {}
+ void runTest() { suite_MixBusTestSuite.test_convert_simple(); }
+} testDescription_MixBusTestSuite_test_convert_simple;
+
+static class TestDescription_MixBusTestSuite_test_convert_interpolate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MixBusTestSuite_test_convert_interpolate() : CxxTest::RealTestDescription( Tests_MixBusTestSuite, suiteDescription_MixBusTestSuite, 97, "test_convert_interpolate" ) {}
+ void runTest() { suite_MixBusTestSuite.test_convert_interpolate(); }
+} testDescription_MixBusTestSuite_test_convert_interpolate;
+
+#include "test/audio/mixer.h"
+
+static MixerTestSuite suite_MixerTestSuite;
+
+static CxxTest::List Tests_MixerTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MixerTestSuite( "test/audio/mixer.h", 9, "MixerTestSuite", suite_MixerTestSuite, Tests_MixerTestSuite );
+
+static class TestDescription_MixerTestSuite_test_queued_settings : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MixerTestSuite_test_queued_settings() : CxxTest::RealTestDescription( Tests_MixerTestSuite, suiteDescription_MixerTestSuite, 11, "test_queued_settings" ) {}
+ void runTest() { suite_MixerTestSuite.test_queued_settings(); }
+} testDescription_MixerTestSuite_test_queued_settings;
+
+static class TestDescription_MixerTestSuite_test_output_latency : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MixerTestSuite_test_output_latency() : CxxTest::RealTestDescription( Tests_MixerTestSuite, suiteDescription_MixerTestSuite, 34, "test_output_latency" ) {}
+ void runTest() { suite_MixerTestSuite.test_output_latency(); }
+} testDescription_MixerTestSuite_test_output_latency;
+
+static class TestDescription_MixerTestSuite_test_paused_channel : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MixerTestSuite_test_paused_channel() : CxxTest::RealTestDescription( Tests_MixerTestSuite, suiteDescription_MixerTestSuite, 47, "test_paused_channel" ) {}
+ void runTest() { suite_MixerTestSuite.test_paused_channel(); }
+} testDescription_MixerTestSuite_test_paused_channel;
+
+static class TestDescription_MixerTestSuite_test_stats : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MixerTestSuite_test_stats() : CxxTest::RealTestDescription( Tests_MixerTestSuite, suiteDescription_MixerTestSuite, 65, "test_stats" ) {}
+ void runTest() { suite_MixerTestSuite.test_stats(); }
+} testDescription_MixerTestSuite_test_stats;
+
+static class TestDescription_MixerTestSuite_test_same_rate_skips_sinc : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MixerTestSuite_test_same_rate_skips_sinc() : CxxTest::RealTestDescription( Tests_MixerTestSuite, suiteDescription_MixerTestSuite, 107, "test_same_rate_skips_sinc" ) {}
+ void runTest() { suite_MixerTestSuite.test_same_rate_skips_sinc(); }
+} testDescription_MixerTestSuite_test_same_rate_skips_sinc;
+
+#include "test/audio/nuked.h"
+
+static NukedOPLTestSuite suite_NukedOPLTestSuite;
+
+static CxxTest::List Tests_NukedOPLTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_NukedOPLTestSuite( "test/audio/nuked.h", 5, "NukedOPLTestSuite", suite_NukedOPLTestSuite, Tests_NukedOPLTestSuite );
+
+static class TestDescription_NukedOPLTestSuite_test_simd_matches_scalar : public CxxTest::RealTestDescription {
+public:
+ TestDescription_NukedOPLTestSuite_test_simd_matches_scalar() : CxxTest::RealTestDescription( Tests_NukedOPLTestSuite, suiteDescription_NukedOPLTestSuite, 7, "test_simd_matches_scalar" ) {}
+ void runTest() { suite_NukedOPLTestSuite.test_simd_matches_scalar(); }
+} testDescription_NukedOPLTestSuite_test_simd_matches_scalar;
+
+#include "test/audio/rate.h"
+
+static RateConverterTestSuite suite_RateConverterTestSuite;
+
+static CxxTest::List Tests_RateConverterTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RateConverterTestSuite( "test/audio/rate.h", 8, "RateConverterTestSuite", suite_RateConverterTestSuite, Tests_RateConverterTestSuite );
+
+static class TestDescription_RateConverterTestSuite_test_upsample_2x : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RateConverterTestSuite_test_upsample_2x() : CxxTest::RealTestDescription( Tests_RateConverterTestSuite, suiteDescription_RateConverterTestSuite, 73, "test_upsample_2x" ) {}
+ void runTest() { suite_RateConverterTestSuite.test_upsample_2x(); }
+} testDescription_RateConverterTestSuite_test_upsample_2x;
+
+static class TestDescription_RateConverterTestSuite_test_upsample_4x : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RateConverterTestSuite_test_upsample_4x() : CxxTest::RealTestDescription( Tests_RateConverterTestSuite, suiteDescription_RateConverterTestSuite, 78, "test_upsample_4x" ) {}
+ void runTest() { suite_RateConverterTestSuite.test_upsample_4x(); }
+} testDescription_RateConverterTestSuite_test_upsample_4x;
+
+static class TestDescription_RateConverterTestSuite_test_sinc_dc : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RateConverterTestSuite_test_sinc_dc() : CxxTest::RealTestDescription( Tests_RateConverterTestSuite, suiteDescription_RateConverterTestSuite, 83, "test_sinc_dc" ) {}
+ void runTest() { suite_RateConverterTestSuite.test_sinc_dc(); }
+} testDescription_RateConverterTestSuite_test_sinc_dc;
+
+static class TestDescription_RateConverterTestSuite_test_sinc_same_rate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RateConverterTestSuite_test_sinc_same_rate() : CxxTest::RealTestDescription( Tests_RateConverterTestSuite, suiteDescription_RateConverterTestSuite, 100, "test_sinc_same_rate" ) {}
+ void runTest() { suite_RateConverterTestSuite.test_sinc_same_rate(); }
+} testDescription_RateConverterTestSuite_test_sinc_same_rate;
+
+static class TestDescription_RateConverterTestSuite_test_sinc_drain : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RateConverterTestSuite_test_sinc_drain() : CxxTest::RealTestDescription( Tests_RateConverterTestSuite, suiteDescription_RateConverterTestSuite, 118, "test_sinc_drain" ) {}
+ void runTest() { suite_RateConverterTestSuite.test_sinc_drain(); }
+} testDescription_RateConverterTestSuite_test_sinc_drain;
+
+#include "test/audio/raw.h"
+
+static RawStreamTestSuite suite_RawStreamTestSuite;
+
+static CxxTest::List Tests_RawStreamTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RawStreamTestSuite( "test/audio/raw.h", 8, "RawStreamTestSuite", suite_RawStreamTestSuite, Tests_RawStreamTestSuite );
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_8_bit_signed_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_8_bit_signed_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 28, "test_read_buffer_8_bit_signed_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_8_bit_signed_mono(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_8_bit_signed_mono;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_8_bit_signed_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_8_bit_signed_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 32, "test_read_buffer_8_bit_signed_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_8_bit_signed_stereo(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_8_bit_signed_stereo;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_8_bit_unsigned_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_8_bit_unsigned_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 36, "test_read_buffer_8_bit_unsigned_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_8_bit_unsigned_mono(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_8_bit_unsigned_mono;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 40, "test_read_buffer_16_bit_signed_be_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_signed_be_mono(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_mono;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 44, "test_read_buffer_16_bit_signed_be_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_signed_be_stereo(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_be_stereo;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 48, "test_read_buffer_16_bit_unsigned_be_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_unsigned_be_mono(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_mono;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 52, "test_read_buffer_16_bit_unsigned_be_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_unsigned_be_stereo(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_be_stereo;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 56, "test_read_buffer_16_bit_signed_le_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_signed_le_mono(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_mono;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 60, "test_read_buffer_16_bit_signed_le_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_signed_le_stereo(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_16_bit_signed_le_stereo;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 64, "test_read_buffer_16_bit_unsigned_le_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_unsigned_le_mono(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_mono;
+
+static class TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 68, "test_read_buffer_16_bit_unsigned_le_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_buffer_16_bit_unsigned_le_stereo(); }
+} testDescription_RawStreamTestSuite_test_read_buffer_16_bit_unsigned_le_stereo;
+
+static class TestDescription_RawStreamTestSuite_test_partial_read : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_partial_read() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 98, "test_partial_read" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_partial_read(); }
+} testDescription_RawStreamTestSuite_test_partial_read;
+
+static class TestDescription_RawStreamTestSuite_test_read_after_end : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_read_after_end() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 120, "test_read_after_end" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_read_after_end(); }
+} testDescription_RawStreamTestSuite_test_read_after_end;
+
+static class TestDescription_RawStreamTestSuite_test_rewind : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_rewind() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 144, "test_rewind" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_rewind(); }
+} testDescription_RawStreamTestSuite_test_rewind;
+
+static class TestDescription_RawStreamTestSuite_test_length : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_length() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 207, "test_length" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_length(); }
+} testDescription_RawStreamTestSuite_test_length;
+
+static class TestDescription_RawStreamTestSuite_test_seek_mono : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_seek_mono() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 284, "test_seek_mono" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_seek_mono(); }
+} testDescription_RawStreamTestSuite_test_seek_mono;
+
+static class TestDescription_RawStreamTestSuite_test_seek_stereo : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RawStreamTestSuite_test_seek_stereo() : CxxTest::RealTestDescription( Tests_RawStreamTestSuite, suiteDescription_RawStreamTestSuite, 288, "test_seek_stereo" ) {}
+ void runTest() { suite_RawStreamTestSuite.test_seek_stereo(); }
+} testDescription_RawStreamTestSuite_test_seek_stereo;
+
+#include "test/audio/seekindex.h"
+
+static SeekIndexTestSuite suite_SeekIndexTestSuite;
+
+static CxxTest::List Tests_SeekIndexTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_SeekIndexTestSuite( "test/audio/seekindex.h", 5, "SeekIndexTestSuite", suite_SeekIndexTestSuite, Tests_SeekIndexTestSuite );
+
+static class TestDescription_SeekIndexTestSuite_test_find : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SeekIndexTestSuite_test_find() : CxxTest::RealTestDescription( Tests_SeekIndexTestSuite, suiteDescription_SeekIndexTestSuite, 7, "test_find" ) {}
+ void runTest() { suite_SeekIndexTestSuite.test_find(); }
+} testDescription_SeekIndexTestSuite_test_find;
+
+static class TestDescription_SeekIndexTestSuite_test_spacing : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SeekIndexTestSuite_test_spacing() : CxxTest::RealTestDescription( Tests_SeekIndexTestSuite, suiteDescription_SeekIndexTestSuite, 26, "test_spacing" ) {}
+ void runTest() { suite_SeekIndexTestSuite.test_spacing(); }
+} testDescription_SeekIndexTestSuite_test_spacing;
+
+static class TestDescription_SeekIndexTestSuite_test_remove : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SeekIndexTestSuite_test_remove() : CxxTest::RealTestDescription( Tests_SeekIndexTestSuite, suiteDescription_SeekIndexTestSuite, 40, "test_remove" ) {}
+ void runTest() { suite_SeekIndexTestSuite.test_remove(); }
+} testDescription_SeekIndexTestSuite_test_remove;
+
+static class TestDescription_SeekIndexTestSuite_test_eviction : public CxxTest::RealTestDescription {
+public:
+ TestDescription_SeekIndexTestSuite_test_eviction() : CxxTest::RealTestDescription( Tests_SeekIndexTestSuite, suiteDescription_SeekIndexTestSuite, 53, "test_eviction" ) {}
+ void runTest() { suite_SeekIndexTestSuite.test_eviction(); }
+} testDescription_SeekIndexTestSuite_test_eviction;
+
+#include "test/audio/timestamp.h"
+
+static TimestampTestSuite suite_TimestampTestSuite;
+
+static CxxTest::List Tests_TimestampTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_TimestampTestSuite( "test/audio/timestamp.h", 5, "TimestampTestSuite", suite_TimestampTestSuite, Tests_TimestampTestSuite );
+
+static class TestDescription_TimestampTestSuite_test_diff_add_frames : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_diff_add_frames() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 8, "test_diff_add_frames" ) {}
+ void runTest() { suite_TimestampTestSuite.test_diff_add_frames(); }
+} testDescription_TimestampTestSuite_test_diff_add_frames;
+
+static class TestDescription_TimestampTestSuite_test_diff_add_msecs : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_diff_add_msecs() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 26, "test_diff_add_msecs" ) {}
+ void runTest() { suite_TimestampTestSuite.test_diff_add_msecs(); }
+} testDescription_TimestampTestSuite_test_diff_add_msecs;
+
+static class TestDescription_TimestampTestSuite_test_ticks : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_ticks() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 58, "test_ticks" ) {}
+ void runTest() { suite_TimestampTestSuite.test_ticks(); }
+} testDescription_TimestampTestSuite_test_ticks;
+
+static class TestDescription_TimestampTestSuite_test_more_add_diff : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_more_add_diff() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 85, "test_more_add_diff" ) {}
+ void runTest() { suite_TimestampTestSuite.test_more_add_diff(); }
+} testDescription_TimestampTestSuite_test_more_add_diff;
+
+static class TestDescription_TimestampTestSuite_test_negate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_negate() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 94, "test_negate" ) {}
+ void runTest() { suite_TimestampTestSuite.test_negate(); }
+} testDescription_TimestampTestSuite_test_negate;
+
+static class TestDescription_TimestampTestSuite_test_add_sub : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_add_sub() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 103, "test_add_sub" ) {}
+ void runTest() { suite_TimestampTestSuite.test_add_sub(); }
+} testDescription_TimestampTestSuite_test_add_sub;
+
+static class TestDescription_TimestampTestSuite_test_diff_with_conversion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_diff_with_conversion() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 127, "test_diff_with_conversion" ) {}
+ void runTest() { suite_TimestampTestSuite.test_diff_with_conversion(); }
+} testDescription_TimestampTestSuite_test_diff_with_conversion;
+
+static class TestDescription_TimestampTestSuite_test_convert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_convert() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 146, "test_convert" ) {}
+ void runTest() { suite_TimestampTestSuite.test_convert(); }
+} testDescription_TimestampTestSuite_test_convert;
+
+static class TestDescription_TimestampTestSuite_test_equals : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_equals() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 155, "test_equals" ) {}
+ void runTest() { suite_TimestampTestSuite.test_equals(); }
+} testDescription_TimestampTestSuite_test_equals;
+
+static class TestDescription_TimestampTestSuite_test_compare : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_compare() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 175, "test_compare" ) {}
+ void runTest() { suite_TimestampTestSuite.test_compare(); }
+} testDescription_TimestampTestSuite_test_compare;
+
+static class TestDescription_TimestampTestSuite_test_framerate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_framerate() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 209, "test_framerate" ) {}
+ void runTest() { suite_TimestampTestSuite.test_framerate(); }
+} testDescription_TimestampTestSuite_test_framerate;
+
+static class TestDescription_TimestampTestSuite_test_direct_query : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_direct_query() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 221, "test_direct_query" ) {}
+ void runTest() { suite_TimestampTestSuite.test_direct_query(); }
+} testDescription_TimestampTestSuite_test_direct_query;
+
+static class TestDescription_TimestampTestSuite_test_no_overflow : public CxxTest::RealTestDescription {
+public:
+ TestDescription_TimestampTestSuite_test_no_overflow() : CxxTest::RealTestDescription( Tests_TimestampTestSuite, suiteDescription_TimestampTestSuite, 242, "test_no_overflow" ) {}
+ void runTest() { suite_TimestampTestSuite.test_no_overflow(); }
+} testDescription_TimestampTestSuite_test_no_overflow;
+
+#include "test/math/fft.h"
+
+static FFTTestSuite suite_FFTTestSuite;
+
+static CxxTest::List Tests_FFTTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_FFTTestSuite( "test/math/fft.h", 6, "FFTTestSuite", suite_FFTTestSuite, Tests_FFTTestSuite );
+
+static class TestDescription_FFTTestSuite_test_dft : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FFTTestSuite_test_dft() : CxxTest::RealTestDescription( Tests_FFTTestSuite, suiteDescription_FFTTestSuite, 36, "test_dft" ) {}
+ void runTest() { suite_FFTTestSuite.test_dft(); }
+} testDescription_FFTTestSuite_test_dft;
+
+static class TestDescription_FFTTestSuite_test_shared_tables : public CxxTest::RealTestDescription {
+public:
+ TestDescription_FFTTestSuite_test_shared_tables() : CxxTest::RealTestDescription( Tests_FFTTestSuite, suiteDescription_FFTTestSuite, 45, "test_shared_tables" ) {}
+ void runTest() { suite_FFTTestSuite.test_shared_tables(); }
+} testDescription_FFTTestSuite_test_shared_tables;
+
+#include "test/math/matrix4.h"
+
+static Matrix4TestSuite suite_Matrix4TestSuite;
+
+static CxxTest::List Tests_Matrix4TestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_Matrix4TestSuite( "test/math/matrix4.h", 5, "Matrix4TestSuite", suite_Matrix4TestSuite, Tests_Matrix4TestSuite );
+
+static class TestDescription_Matrix4TestSuite_test_multiply : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Matrix4TestSuite_test_multiply() : CxxTest::RealTestDescription( Tests_Matrix4TestSuite, suiteDescription_Matrix4TestSuite, 13, "test_multiply" ) {}
+ void runTest() { suite_Matrix4TestSuite.test_multiply(); }
+} testDescription_Matrix4TestSuite_test_multiply;
+
+static class TestDescription_Matrix4TestSuite_test_inverse : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Matrix4TestSuite_test_inverse() : CxxTest::RealTestDescription( Tests_Matrix4TestSuite, suiteDescription_Matrix4TestSuite, 29, "test_inverse" ) {}
+ void runTest() { suite_Matrix4TestSuite.test_inverse(); }
+} testDescription_Matrix4TestSuite_test_inverse;
+
+static class TestDescription_Matrix4TestSuite_test_transformPoints : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Matrix4TestSuite_test_transformPoints() : CxxTest::RealTestDescription( Tests_Matrix4TestSuite, suiteDescription_Matrix4TestSuite, 56, "test_transformPoints" ) {}
+ void runTest() { suite_Matrix4TestSuite.test_transformPoints(); }
+} testDescription_Matrix4TestSuite_test_transformPoints;
+
+#include "test/math/quat.h"
+
+static QuatTestSuite suite_QuatTestSuite;
+
+static CxxTest::List Tests_QuatTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_QuatTestSuite( "test/math/quat.h", 5, "QuatTestSuite", suite_QuatTestSuite, Tests_QuatTestSuite );
+
+static class TestDescription_QuatTestSuite_test_Quaternion : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuatTestSuite_test_Quaternion() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 8, "test_Quaternion" ) {}
+ void runTest() { suite_QuatTestSuite.test_Quaternion(); }
+} testDescription_QuatTestSuite_test_Quaternion;
+
+static class TestDescription_QuatTestSuite_test_Normalize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuatTestSuite_test_Normalize() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 19, "test_Normalize" ) {}
+ void runTest() { suite_QuatTestSuite.test_Normalize(); }
+} testDescription_QuatTestSuite_test_Normalize;
+
+static class TestDescription_QuatTestSuite_test_quatMatrix : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuatTestSuite_test_quatMatrix() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 35, "test_quatMatrix" ) {}
+ void runTest() { suite_QuatTestSuite.test_quatMatrix(); }
+} testDescription_QuatTestSuite_test_quatMatrix;
+
+static class TestDescription_QuatTestSuite_test_quatRotationXYZ : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuatTestSuite_test_quatRotationXYZ() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 53, "test_quatRotationXYZ" ) {}
+ void runTest() { suite_QuatTestSuite.test_quatRotationXYZ(); }
+} testDescription_QuatTestSuite_test_quatRotationXYZ;
+
+static class TestDescription_QuatTestSuite_test_quatAngleBetween : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuatTestSuite_test_quatAngleBetween() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 80, "test_quatAngleBetween" ) {}
+ void runTest() { suite_QuatTestSuite.test_quatAngleBetween(); }
+} testDescription_QuatTestSuite_test_quatAngleBetween;
+
+static class TestDescription_QuatTestSuite_test_invert : public CxxTest::RealTestDescription {
+public:
+ TestDescription_QuatTestSuite_test_invert() : CxxTest::RealTestDescription( Tests_QuatTestSuite, suiteDescription_QuatTestSuite, 91, "test_invert" ) {}
+ void runTest() { suite_QuatTestSuite.test_invert(); }
+} testDescription_QuatTestSuite_test_invert;
+
+#include "test/math/ray.h"
+
+static RayTestSuite suite_RayTestSuite;
+
+static CxxTest::List Tests_RayTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_RayTestSuite( "test/math/ray.h", 5, "RayTestSuite", suite_RayTestSuite, Tests_RayTestSuite );
+
+static class TestDescription_RayTestSuite_test_Ray : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RayTestSuite_test_Ray() : CxxTest::RealTestDescription( Tests_RayTestSuite, suiteDescription_RayTestSuite, 8, "test_Ray" ) {}
+ void runTest() { suite_RayTestSuite.test_Ray(); }
+} testDescription_RayTestSuite_test_Ray;
+
+static class TestDescription_RayTestSuite_test_translate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RayTestSuite_test_translate() : CxxTest::RealTestDescription( Tests_RayTestSuite, suiteDescription_RayTestSuite, 23, "test_translate" ) {}
+ void runTest() { suite_RayTestSuite.test_translate(); }
+} testDescription_RayTestSuite_test_translate;
+
+static class TestDescription_RayTestSuite_test_intersectTriangle : public CxxTest::RealTestDescription {
+public:
+ TestDescription_RayTestSuite_test_intersectTriangle() : CxxTest::RealTestDescription( Tests_RayTestSuite, suiteDescription_RayTestSuite, 38, "test_intersectTriangle" ) {}
+ void runTest() { suite_RayTestSuite.test_intersectTriangle(); }
+} testDescription_RayTestSuite_test_intersectTriangle;
+
+#include "test/math/rotation3d.h"
+
+static Rotation3DTestSuite suite_Rotation3DTestSuite;
+
+static CxxTest::List Tests_Rotation3DTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_Rotation3DTestSuite( "test/math/rotation3d.h", 5, "Rotation3DTestSuite", suite_Rotation3DTestSuite, Tests_Rotation3DTestSuite );
+
+static class TestDescription_Rotation3DTestSuite_test_eulerXYX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerXYX() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 7, "test_eulerXYX" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerXYX(); }
+} testDescription_Rotation3DTestSuite_test_eulerXYX;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerXYZ : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerXYZ() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 23, "test_eulerXYZ" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerXYZ(); }
+} testDescription_Rotation3DTestSuite_test_eulerXYZ;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerXZX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerXZX() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 39, "test_eulerXZX" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerXZX(); }
+} testDescription_Rotation3DTestSuite_test_eulerXZX;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerXZY : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerXZY() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 55, "test_eulerXZY" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerXZY(); }
+} testDescription_Rotation3DTestSuite_test_eulerXZY;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerYXY : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerYXY() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 71, "test_eulerYXY" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerYXY(); }
+} testDescription_Rotation3DTestSuite_test_eulerYXY;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerYXZ : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerYXZ() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 87, "test_eulerYXZ" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerYXZ(); }
+} testDescription_Rotation3DTestSuite_test_eulerYXZ;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerYZX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerYZX() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 103, "test_eulerYZX" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerYZX(); }
+} testDescription_Rotation3DTestSuite_test_eulerYZX;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerYZY : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerYZY() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 119, "test_eulerYZY" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerYZY(); }
+} testDescription_Rotation3DTestSuite_test_eulerYZY;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerZXY : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerZXY() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 135, "test_eulerZXY" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerZXY(); }
+} testDescription_Rotation3DTestSuite_test_eulerZXY;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerZXZ : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerZXZ() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 151, "test_eulerZXZ" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerZXZ(); }
+} testDescription_Rotation3DTestSuite_test_eulerZXZ;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerZYX : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerZYX() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 167, "test_eulerZYX" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerZYX(); }
+} testDescription_Rotation3DTestSuite_test_eulerZYX;
+
+static class TestDescription_Rotation3DTestSuite_test_eulerZYZ : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Rotation3DTestSuite_test_eulerZYZ() : CxxTest::RealTestDescription( Tests_Rotation3DTestSuite, suiteDescription_Rotation3DTestSuite, 183, "test_eulerZYZ" ) {}
+ void runTest() { suite_Rotation3DTestSuite.test_eulerZYZ(); }
+} testDescription_Rotation3DTestSuite_test_eulerZYZ;
+
+#include "test/math/utils.h"
+
+static MathUtilsTestSuite suite_MathUtilsTestSuite;
+
+static CxxTest::List Tests_MathUtilsTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_MathUtilsTestSuite( "test/math/utils.h", 7, "MathUtilsTestSuite", suite_MathUtilsTestSuite, Tests_MathUtilsTestSuite );
+
+static class TestDescription_MathUtilsTestSuite_test_rad2deg : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MathUtilsTestSuite_test_rad2deg() : CxxTest::RealTestDescription( Tests_MathUtilsTestSuite, suiteDescription_MathUtilsTestSuite, 10, "test_rad2deg" ) {}
+ void runTest() { suite_MathUtilsTestSuite.test_rad2deg(); }
+} testDescription_MathUtilsTestSuite_test_rad2deg;
+
+static class TestDescription_MathUtilsTestSuite_test_deg2rad : public CxxTest::RealTestDescription {
+public:
+ TestDescription_MathUtilsTestSuite_test_deg2rad() : CxxTest::RealTestDescription( Tests_MathUtilsTestSuite, suiteDescription_MathUtilsTestSuite, 23, "test_deg2rad" ) {}
+ void runTest() { suite_MathUtilsTestSuite.test_deg2rad(); }
+} testDescription_MathUtilsTestSuite_test_deg2rad;
+
+#include "test/math/vector3d.h"
+
+static Vector3dTestSuite suite_Vector3dTestSuite;
+
+static CxxTest::List Tests_Vector3dTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_Vector3dTestSuite( "test/math/vector3d.h", 5, "Vector3dTestSuite", suite_Vector3dTestSuite, Tests_Vector3dTestSuite );
+
+static class TestDescription_Vector3dTestSuite_test_Vector3d : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_Vector3d() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 8, "test_Vector3d" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_Vector3d(); }
+} testDescription_Vector3dTestSuite_test_Vector3d;
+
+static class TestDescription_Vector3dTestSuite_test_set : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_set() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 28, "test_set" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_set(); }
+} testDescription_Vector3dTestSuite_test_set;
+
+static class TestDescription_Vector3dTestSuite_test_crossProduct : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_crossProduct() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 37, "test_crossProduct" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_crossProduct(); }
+} testDescription_Vector3dTestSuite_test_crossProduct;
+
+static class TestDescription_Vector3dTestSuite_test_length : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_length() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 48, "test_length" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_length(); }
+} testDescription_Vector3dTestSuite_test_length;
+
+static class TestDescription_Vector3dTestSuite_test_interpolate : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_interpolate() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 59, "test_interpolate" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_interpolate(); }
+} testDescription_Vector3dTestSuite_test_interpolate;
+
+static class TestDescription_Vector3dTestSuite_test_setValue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_setValue() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 72, "test_setValue" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_setValue(); }
+} testDescription_Vector3dTestSuite_test_setValue;
+
+static class TestDescription_Vector3dTestSuite_test_getValue : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_getValue() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 87, "test_getValue" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_getValue(); }
+} testDescription_Vector3dTestSuite_test_getValue;
+
+static class TestDescription_Vector3dTestSuite_test_dotProduct : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_dotProduct() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 95, "test_dotProduct" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_dotProduct(); }
+} testDescription_Vector3dTestSuite_test_dotProduct;
+
+static class TestDescription_Vector3dTestSuite_test_dotProductOrthogonal : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_dotProductOrthogonal() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 104, "test_dotProductOrthogonal" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_dotProductOrthogonal(); }
+} testDescription_Vector3dTestSuite_test_dotProductOrthogonal;
+
+static class TestDescription_Vector3dTestSuite_test_normalizeTrivial : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_normalizeTrivial() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 113, "test_normalizeTrivial" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_normalizeTrivial(); }
+} testDescription_Vector3dTestSuite_test_normalizeTrivial;
+
+static class TestDescription_Vector3dTestSuite_test_normalize : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_normalize() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 126, "test_normalize" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_normalize(); }
+} testDescription_Vector3dTestSuite_test_normalize;
+
+static class TestDescription_Vector3dTestSuite_test_magnitude : public CxxTest::RealTestDescription {
+public:
+ TestDescription_Vector3dTestSuite_test_magnitude() : CxxTest::RealTestDescription( Tests_Vector3dTestSuite, suiteDescription_Vector3dTestSuite, 138, "test_magnitude" ) {}
+ void runTest() { suite_Vector3dTestSuite.test_magnitude(); }
+} testDescription_Vector3dTestSuite_test_magnitude;
+
+#include "test/image/blending.h"
+
+static BlendBlitUnfilteredTestSuite suite_BlendBlitUnfilteredTestSuite;
+
+static CxxTest::List Tests_BlendBlitUnfilteredTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_BlendBlitUnfilteredTestSuite( "test/image/blending.h", 801, "BlendBlitUnfilteredTestSuite", suite_BlendBlitUnfilteredTestSuite, Tests_BlendBlitUnfilteredTestSuite );
+
+static class TestDescription_BlendBlitUnfilteredTestSuite_test_blend_speed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BlendBlitUnfilteredTestSuite_test_blend_speed() : CxxTest::RealTestDescription( Tests_BlendBlitUnfilteredTestSuite, suiteDescription_BlendBlitUnfilteredTestSuite, 803, "test_blend_speed" ) {}
+ void runTest() { suite_BlendBlitUnfilteredTestSuite.test_blend_speed(); }
+} testDescription_BlendBlitUnfilteredTestSuite_test_blend_speed;
+
+static class TestDescription_BlendBlitUnfilteredTestSuite_test_blend_blit_unfiltered : public CxxTest::RealTestDescription {
+public:
+ TestDescription_BlendBlitUnfilteredTestSuite_test_blend_blit_unfiltered() : CxxTest::RealTestDescription( Tests_BlendBlitUnfilteredTestSuite, suiteDescription_BlendBlitUnfilteredTestSuite, 912, "test_blend_blit_unfiltered" ) {}
+ void runTest() { suite_BlendBlitUnfilteredTestSuite.test_blend_blit_unfiltered(); }
+} testDescription_BlendBlitUnfilteredTestSuite_test_blend_blit_unfiltered;
+
+#include "test/image/gif.h"
+
+static GIFDecoderTestSuite suite_GIFDecoderTestSuite;
+
+static CxxTest::List Tests_GIFDecoderTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_GIFDecoderTestSuite( "test/image/gif.h", 11, "GIFDecoderTestSuite", suite_GIFDecoderTestSuite, Tests_GIFDecoderTestSuite );
+
+static class TestDescription_GIFDecoderTestSuite_test_load_gif_2x2 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_GIFDecoderTestSuite_test_load_gif_2x2() : CxxTest::RealTestDescription( Tests_GIFDecoderTestSuite, suiteDescription_GIFDecoderTestSuite, 13, "test_load_gif_2x2" ) {}
+ void runTest() { suite_GIFDecoderTestSuite.test_load_gif_2x2(); }
+} testDescription_GIFDecoderTestSuite_test_load_gif_2x2;
+
+#include "test/image/image_cache.h"
+
+static DecodedImageCacheTestSuite suite_DecodedImageCacheTestSuite;
+
+static CxxTest::List Tests_DecodedImageCacheTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_DecodedImageCacheTestSuite( "test/image/image_cache.h", 39, "DecodedImageCacheTestSuite", suite_DecodedImageCacheTestSuite, Tests_DecodedImageCacheTestSuite );
+
+static class TestDescription_DecodedImageCacheTestSuite_test_memory_cache : public CxxTest::RealTestDescription {
+public:
+ TestDescription_DecodedImageCacheTestSuite_test_memory_cache() : CxxTest::RealTestDescription( Tests_DecodedImageCacheTestSuite, suiteDescription_DecodedImageCacheTestSuite, 41, "test_memory_cache" ) {}
+ void runTest() { suite_DecodedImageCacheTestSuite.test_memory_cache(); }
+} testDescription_DecodedImageCacheTestSuite_test_memory_cache;
+
+#include "test/image/jpeg.h"
+
+static JPEGDecoderTestSuite suite_JPEGDecoderTestSuite;
+
+static CxxTest::List Tests_JPEGDecoderTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_JPEGDecoderTestSuite( "test/image/jpeg.h", 33, "JPEGDecoderTestSuite", suite_JPEGDecoderTestSuite, Tests_JPEGDecoderTestSuite );
+
+static class TestDescription_JPEGDecoderTestSuite_test_decode : public CxxTest::RealTestDescription {
+public:
+ TestDescription_JPEGDecoderTestSuite_test_decode() : CxxTest::RealTestDescription( Tests_JPEGDecoderTestSuite, suiteDescription_JPEGDecoderTestSuite, 110, "test_decode" ) {}
+ void runTest() { suite_JPEGDecoderTestSuite.test_decode(); }
+} testDescription_JPEGDecoderTestSuite_test_decode;
+
+static class TestDescription_JPEGDecoderTestSuite_test_row_listener : public CxxTest::RealTestDescription {
+public:
+ TestDescription_JPEGDecoderTestSuite_test_row_listener() : CxxTest::RealTestDescription( Tests_JPEGDecoderTestSuite, suiteDescription_JPEGDecoderTestSuite, 148, "test_row_listener" ) {}
+ void runTest() { suite_JPEGDecoderTestSuite.test_row_listener(); }
+} testDescription_JPEGDecoderTestSuite_test_row_listener;
+
+static class TestDescription_JPEGDecoderTestSuite_test_decode_speed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_JPEGDecoderTestSuite_test_decode_speed() : CxxTest::RealTestDescription( Tests_JPEGDecoderTestSuite, suiteDescription_JPEGDecoderTestSuite, 181, "test_decode_speed" ) {}
+ void runTest() { suite_JPEGDecoderTestSuite.test_decode_speed(); }
+} testDescription_JPEGDecoderTestSuite_test_decode_speed;
+
+#include "test/image/png.h"
+
+static PNGDecoderTestSuite suite_PNGDecoderTestSuite;
+
+static CxxTest::List Tests_PNGDecoderTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_PNGDecoderTestSuite( "test/image/png.h", 33, "PNGDecoderTestSuite", suite_PNGDecoderTestSuite, Tests_PNGDecoderTestSuite );
+
+static class TestDescription_PNGDecoderTestSuite_test_output_format : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PNGDecoderTestSuite_test_output_format() : CxxTest::RealTestDescription( Tests_PNGDecoderTestSuite, suiteDescription_PNGDecoderTestSuite, 77, "test_output_format" ) {}
+ void runTest() { suite_PNGDecoderTestSuite.test_output_format(); }
+} testDescription_PNGDecoderTestSuite_test_output_format;
+
+static class TestDescription_PNGDecoderTestSuite_test_row_listener : public CxxTest::RealTestDescription {
+public:
+ TestDescription_PNGDecoderTestSuite_test_row_listener() : CxxTest::RealTestDescription( Tests_PNGDecoderTestSuite, suiteDescription_PNGDecoderTestSuite, 116, "test_row_listener" ) {}
+ void runTest() { suite_PNGDecoderTestSuite.test_row_listener(); }
+} testDescription_PNGDecoderTestSuite_test_row_listener;
+
+#include "test/graphics/crossblit.h"
+
+static CrossBlitKernelsTestSuite suite_CrossBlitKernelsTestSuite;
+
+static CxxTest::List Tests_CrossBlitKernelsTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_CrossBlitKernelsTestSuite( "test/graphics/crossblit.h", 39, "CrossBlitKernelsTestSuite", suite_CrossBlitKernelsTestSuite, Tests_CrossBlitKernelsTestSuite );
+
+static class TestDescription_CrossBlitKernelsTestSuite_test_conversions : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrossBlitKernelsTestSuite_test_conversions() : CxxTest::RealTestDescription( Tests_CrossBlitKernelsTestSuite, suiteDescription_CrossBlitKernelsTestSuite, 108, "test_conversions" ) {}
+ void runTest() { suite_CrossBlitKernelsTestSuite.test_conversions(); }
+} testDescription_CrossBlitKernelsTestSuite_test_conversions;
+
+static class TestDescription_CrossBlitKernelsTestSuite_test_map : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrossBlitKernelsTestSuite_test_map() : CxxTest::RealTestDescription( Tests_CrossBlitKernelsTestSuite, suiteDescription_CrossBlitKernelsTestSuite, 122, "test_map" ) {}
+ void runTest() { suite_CrossBlitKernelsTestSuite.test_map(); }
+} testDescription_CrossBlitKernelsTestSuite_test_map;
+
+static class TestDescription_CrossBlitKernelsTestSuite_test_in_place : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrossBlitKernelsTestSuite_test_in_place() : CxxTest::RealTestDescription( Tests_CrossBlitKernelsTestSuite, suiteDescription_CrossBlitKernelsTestSuite, 132, "test_in_place" ) {}
+ void runTest() { suite_CrossBlitKernelsTestSuite.test_in_place(); }
+} testDescription_CrossBlitKernelsTestSuite_test_in_place;
+
+static class TestDescription_CrossBlitKernelsTestSuite_test_crossblit_speed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_CrossBlitKernelsTestSuite_test_crossblit_speed() : CxxTest::RealTestDescription( Tests_CrossBlitKernelsTestSuite, suiteDescription_CrossBlitKernelsTestSuite, 158, "test_crossblit_speed" ) {}
+ void runTest() { suite_CrossBlitKernelsTestSuite.test_crossblit_speed(); }
+} testDescription_CrossBlitKernelsTestSuite_test_crossblit_speed;
+
+#include "test/graphics/managed_surface.h"
+
+static ManagedSurfaceTestSuite suite_ManagedSurfaceTestSuite;
+
+static CxxTest::List Tests_ManagedSurfaceTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ManagedSurfaceTestSuite( "test/graphics/managed_surface.h", 6, "ManagedSurfaceTestSuite", suite_ManagedSurfaceTestSuite, Tests_ManagedSurfaceTestSuite );
+
+static class TestDescription_ManagedSurfaceTestSuite_test_palette_map : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ManagedSurfaceTestSuite_test_palette_map() : CxxTest::RealTestDescription( Tests_ManagedSurfaceTestSuite, suiteDescription_ManagedSurfaceTestSuite, 19, "test_palette_map" ) {}
+ void runTest() { suite_ManagedSurfaceTestSuite.test_palette_map(); }
+} testDescription_ManagedSurfaceTestSuite_test_palette_map;
+
+static class TestDescription_ManagedSurfaceTestSuite_test_blit_clut8 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ManagedSurfaceTestSuite_test_blit_clut8() : CxxTest::RealTestDescription( Tests_ManagedSurfaceTestSuite, suiteDescription_ManagedSurfaceTestSuite, 40, "test_blit_clut8" ) {}
+ void runTest() { suite_ManagedSurfaceTestSuite.test_blit_clut8(); }
+} testDescription_ManagedSurfaceTestSuite_test_blit_clut8;
+
+static class TestDescription_ManagedSurfaceTestSuite_test_trans_blit_clut8 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ManagedSurfaceTestSuite_test_trans_blit_clut8() : CxxTest::RealTestDescription( Tests_ManagedSurfaceTestSuite, suiteDescription_ManagedSurfaceTestSuite, 71, "test_trans_blit_clut8" ) {}
+ void runTest() { suite_ManagedSurfaceTestSuite.test_trans_blit_clut8(); }
+} testDescription_ManagedSurfaceTestSuite_test_trans_blit_clut8;
+
+static class TestDescription_ManagedSurfaceTestSuite_test_trans_blit_clut8_to_clut8 : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ManagedSurfaceTestSuite_test_trans_blit_clut8_to_clut8() : CxxTest::RealTestDescription( Tests_ManagedSurfaceTestSuite, suiteDescription_ManagedSurfaceTestSuite, 96, "test_trans_blit_clut8_to_clut8" ) {}
+ void runTest() { suite_ManagedSurfaceTestSuite.test_trans_blit_clut8_to_clut8(); }
+} testDescription_ManagedSurfaceTestSuite_test_trans_blit_clut8_to_clut8;
+
+#include "test/graphics/rowkernels.h"
+
+static ScalerRowKernelsTestSuite suite_ScalerRowKernelsTestSuite;
+
+static CxxTest::List Tests_ScalerRowKernelsTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ScalerRowKernelsTestSuite( "test/graphics/rowkernels.h", 56, "ScalerRowKernelsTestSuite", suite_ScalerRowKernelsTestSuite, Tests_ScalerRowKernelsTestSuite );
+
+static class TestDescription_ScalerRowKernelsTestSuite_test_hq_patterns : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ScalerRowKernelsTestSuite_test_hq_patterns() : CxxTest::RealTestDescription( Tests_ScalerRowKernelsTestSuite, suiteDescription_ScalerRowKernelsTestSuite, 173, "test_hq_patterns" ) {}
+ void runTest() { suite_ScalerRowKernelsTestSuite.test_hq_patterns(); }
+} testDescription_ScalerRowKernelsTestSuite_test_hq_patterns;
+
+static class TestDescription_ScalerRowKernelsTestSuite_test_edge_unchanged : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ScalerRowKernelsTestSuite_test_edge_unchanged() : CxxTest::RealTestDescription( Tests_ScalerRowKernelsTestSuite, suiteDescription_ScalerRowKernelsTestSuite, 180, "test_edge_unchanged" ) {}
+ void runTest() { suite_ScalerRowKernelsTestSuite.test_edge_unchanged(); }
+} testDescription_ScalerRowKernelsTestSuite_test_edge_unchanged;
+
+static class TestDescription_ScalerRowKernelsTestSuite_test_scaler_output : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ScalerRowKernelsTestSuite_test_scaler_output() : CxxTest::RealTestDescription( Tests_ScalerRowKernelsTestSuite, suiteDescription_ScalerRowKernelsTestSuite, 189, "test_scaler_output" ) {}
+ void runTest() { suite_ScalerRowKernelsTestSuite.test_scaler_output(); }
+} testDescription_ScalerRowKernelsTestSuite_test_scaler_output;
+
+static class TestDescription_ScalerRowKernelsTestSuite_test_scaler_speed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ScalerRowKernelsTestSuite_test_scaler_speed() : CxxTest::RealTestDescription( Tests_ScalerRowKernelsTestSuite, suiteDescription_ScalerRowKernelsTestSuite, 200, "test_scaler_speed" ) {}
+ void runTest() { suite_ScalerRowKernelsTestSuite.test_scaler_speed(); }
+} testDescription_ScalerRowKernelsTestSuite_test_scaler_speed;
+
+#include "test/graphics/scaleblit.h"
+
+static ScaleBlitKernelsTestSuite suite_ScaleBlitKernelsTestSuite;
+
+static CxxTest::List Tests_ScaleBlitKernelsTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_ScaleBlitKernelsTestSuite( "test/graphics/scaleblit.h", 38, "ScaleBlitKernelsTestSuite", suite_ScaleBlitKernelsTestSuite, Tests_ScaleBlitKernelsTestSuite );
+
+static class TestDescription_ScaleBlitKernelsTestSuite_test_scale_generic : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ScaleBlitKernelsTestSuite_test_scale_generic() : CxxTest::RealTestDescription( Tests_ScaleBlitKernelsTestSuite, suiteDescription_ScaleBlitKernelsTestSuite, 111, "test_scale_generic" ) {}
+ void runTest() { suite_ScaleBlitKernelsTestSuite.test_scale_generic(); }
+} testDescription_ScaleBlitKernelsTestSuite_test_scale_generic;
+
+static class TestDescription_ScaleBlitKernelsTestSuite_test_scale : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ScaleBlitKernelsTestSuite_test_scale() : CxxTest::RealTestDescription( Tests_ScaleBlitKernelsTestSuite, suiteDescription_ScaleBlitKernelsTestSuite, 139, "test_scale" ) {}
+ void runTest() { suite_ScaleBlitKernelsTestSuite.test_scale(); }
+} testDescription_ScaleBlitKernelsTestSuite_test_scale;
+
+static class TestDescription_ScaleBlitKernelsTestSuite_test_rotoscale : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ScaleBlitKernelsTestSuite_test_rotoscale() : CxxTest::RealTestDescription( Tests_ScaleBlitKernelsTestSuite, suiteDescription_ScaleBlitKernelsTestSuite, 155, "test_rotoscale" ) {}
+ void runTest() { suite_ScaleBlitKernelsTestSuite.test_rotoscale(); }
+} testDescription_ScaleBlitKernelsTestSuite_test_rotoscale;
+
+static class TestDescription_ScaleBlitKernelsTestSuite_test_scaleblit_speed : public CxxTest::RealTestDescription {
+public:
+ TestDescription_ScaleBlitKernelsTestSuite_test_scaleblit_speed() : CxxTest::RealTestDescription( Tests_ScaleBlitKernelsTestSuite, suiteDescription_ScaleBlitKernelsTestSuite, 174, "test_scaleblit_speed" ) {}
+ void runTest() { suite_ScaleBlitKernelsTestSuite.test_scaleblit_speed(); }
+} testDescription_ScaleBlitKernelsTestSuite_test_scaleblit_speed;
+
+#include "test/graphics/yuv_to_rgb.h"
+
+static YUVToRGBTestSuite suite_YUVToRGBTestSuite;
+
+static CxxTest::List Tests_YUVToRGBTestSuite = { 0, 0 };
+CxxTest::StaticSuiteDescription suiteDescription_YUVToRGBTestSuite( "test/graphics/yuv_to_rgb.h", 23, "YUVToRGBTestSuite", suite_YUVToRGBTestSuite, Tests_YUVToRGBTestSuite );
+
+static class TestDescription_YUVToRGBTestSuite_test_all_chroma : public CxxTest::RealTestDescription {
+public:
+ TestDescription_YUVToRGBTestSuite_test_all_chroma() : CxxTest::RealTestDescription( Tests_YUVToRGBTestSuite, suiteDescription_YUVToRGBTestSuite, 82, "test_all_chroma" ) {}
+ void runTest() { suite_YUVToRGBTestSuite.test_all_chroma(); }
+} testDescription_YUVToRGBTestSuite_test_all_chroma;
+
+static class TestDescription_YUVToRGBTestSuite_test_subsampling : public CxxTest::RealTestDescription {
+public:
+ TestDescription_YUVToRGBTestSuite_test_subsampling() : CxxTest::RealTestDescription( Tests_YUVToRGBTestSuite, suiteDescription_YUVToRGBTestSuite, 113, "test_subsampling" ) {}
+ void runTest() { suite_YUVToRGBTestSuite.test_subsampling(); }
+} testDescription_YUVToRGBTestSuite_test_subsampling;
+
+static class TestDescription_YUVToRGBTestSuite_test_sub_area : public CxxTest::RealTestDescription {
+public:
+ TestDescription_YUVToRGBTestSuite_test_sub_area() : CxxTest::RealTestDescription( Tests_YUVToRGBTestSuite, suiteDescription_YUVToRGBTestSuite, 154, "test_sub_area" ) {}
+ void runTest() { suite_YUVToRGBTestSuite.test_sub_area(); }
+} testDescription_YUVToRGBTestSuite_test_sub_area;
+
+static class TestDescription_YUVToRGBTestSuite_test_yuv_surface : public CxxTest::RealTestDescription {
+public:
+ TestDescription_YUVToRGBTestSuite_test_yuv_surface() : CxxTest::RealTestDescription( Tests_YUVToRGBTestSuite, suiteDescription_YUVToRGBTestSuite, 191, "test_yuv_surface" ) {}
+ void runTest() { suite_YUVToRGBTestSuite.test_yuv_surface(); }
+} testDescription_YUVToRGBTestSuite_test_yuv_surface;
+
+#include <cxxtest/Root.cpp>
@@ -0,0 +1,338 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Decodes all frames of a video with the null backend and reports the
+ * frame rate, the time of the decoding stages and the peak memory use.
+ * Build it with 'make videobench' and run it without arguments for the
+ * options.
+ */
+
+#define FORBIDDEN_SYMBOL_ALLOW_ALL
+
+#include "null_osystem.cpp"
+
+#include "backends/graphics/null/null-graphics.h"
+#include "backends/mixer/null/null-mixer.h"
+
+#include "common/crc.h"
+#include "common/cyclecounter.h"
+#include "common/fs.h"
+#include "common/stream.h"
+
+#include "graphics/blit.h"
+#include "graphics/surface.h"
+
+#include "video/3do_decoder.h"
+#include "video/avi_decoder.h"
+#include "video/bink_decoder.h"
+#include "video/decode_profiler.h"
+#include "video/dxa_decoder.h"
+#include "video/flic_decoder.h"
+#include "video/hnm_decoder.h"
+#include "video/mkv_decoder.h"
+#include "video/mpegps_decoder.h"
+#include "video/mve_decoder.h"
+#include "video/paco_decoder.h"
+#include "video/psx_decoder.h"
+#include "video/qt_decoder.h"
+#include "video/smk_decoder.h"
+#include "video/theora_decoder.h"
+
+#include "test/instrset_detect.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef POSIX
+#include <sys/resource.h>
+#endif
+
+namespace {
+
+/**
+ * The null backend with a screen and a mixer, which decoders of videos
+ * with sound and YUV-based decoders need, and which reports the SIMD
+ * instruction sets of the CPU.
+ */
+class BenchSystem : public OSystem_NULL {
+public:
+	BenchSystem() : OSystem_NULL(false) {}
+
+	/**
+	 * Like the tests, this doesn't go through initBackend(), which wants
+	 * all the managers. The mixer needs g_system to be set.
+	 */
+	void initManagers() {
+		_graphicsManager = new NullGraphicsManager();
+		_mixerManager = new NullMixerManager();
+		_mixerManager->init();
+	}
+
+	bool hasFeature(Feature f) override {
+		switch (f) {
+#ifdef SCUMMVM_SSE2
+		case kFeatureCpuSSE2:
+			return instrset_detect() >= 2;
+		case kFeatureCpuSSE41:
+			return instrset_detect() >= 5;
+		case kFeatureCpuAVX2:
+			return instrset_detect() >= 8;
+#endif
+		default:
+			return OSystem_NULL::hasFeature(f);
+		}
+	}
+};
+
+struct FormatName {
+	const char *name;
+	Graphics::PixelFormat format;
+};
+
+const FormatName formats[] = {
+	{ "rgb565",   Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0) },
+	{ "rgb555",   Graphics::PixelFormat(2, 5, 5, 5, 0, 10, 5, 0, 0) },
+	{ "rgb888",   Graphics::PixelFormat(3, 8, 8, 8, 0, 16, 8, 0, 0) },
+	{ "argb8888", Graphics::PixelFormat(4, 8, 8, 8, 8, 16, 8, 0, 24) },
+	{ "rgba8888", Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0) },
+	{ "abgr8888", Graphics::PixelFormat(4, 8, 8, 8, 8, 0, 8, 16, 24) },
+	{ "bgra8888", Graphics::PixelFormat(4, 8, 8, 8, 8, 8, 16, 24, 0) }
+};
+
+struct KernelName {
+	const char *name;
+	Graphics::BlitKernelSet set;
+};
+
+const KernelName kernels[] = {
+	{ "generic", Graphics::kBlitKernelsGeneric },
+	{ "sse2",    Graphics::kBlitKernelsSSE2 },
+	{ "avx2",    Graphics::kBlitKernelsAVX2 },
+	{ "neon",    Graphics::kBlitKernelsNEON }
+};
+
+void usage() {
+	fprintf(stderr,
+	        "Usage: videobench [options] <file>\n"
+	        "  --format <name>    Output format of YUV-based videos: rgb565, rgb555, rgb888,\n"
+	        "                     argb8888, rgba8888, abgr8888 or bgra8888\n"
+	        "  --frames <n>       Stop after n frames\n"
+	        "  --kernels <name>   Blitting kernels: generic, sse2, avx2 or neon\n"
+	        "  --checksum         Print a CRC-32 of the pixels of all frames\n");
+}
+
+bool hasExtension(const Common::String &name, const char *ext) {
+	return name.hasSuffixIgnoreCase(Common::String(".") + ext);
+}
+
+/** Pick a decoder by the extension of the file name. */
+Video::VideoDecoder *createDecoder(const Common::String &name, const Graphics::PixelFormat &format) {
+	if (hasExtension(name, "avi"))
+		return new Video::AVIDecoder();
+#ifdef USE_BINK
+	if (hasExtension(name, "bik"))
+		return new Video::BinkDecoder();
+#endif
+	if (hasExtension(name, "dxa"))
+		return new Video::DXADecoder();
+	if (hasExtension(name, "fli") || hasExtension(name, "flc"))
+		return new Video::FlicDecoder();
+#ifdef USE_HNM
+	if (hasExtension(name, "hnm"))
+		return new Video::HNMDecoder(format);
+#endif
+#ifdef USE_VPX
+	if (hasExtension(name, "mkv"))
+		return new Video::MKVDecoder();
+#endif
+	if (hasExtension(name, "mpg") || hasExtension(name, "vob"))
+		return new Video::MPEGPSDecoder();
+	if (hasExtension(name, "mve"))
+		return new Video::MveDecoder();
+#ifdef USE_THEORADEC
+	if (hasExtension(name, "ogv"))
+		return new Video::TheoraDecoder();
+#endif
+	if (hasExtension(name, "pac"))
+		return new Video::PacoDecoder();
+	if (hasExtension(name, "str"))
+		return new Video::PSXStreamDecoder(Video::PSXStreamDecoder::kCD2x);
+	if (hasExtension(name, "mov") || hasExtension(name, "qt") || hasExtension(name, "mp4"))
+		return new Video::QuickTimeDecoder();
+	if (hasExtension(name, "smk"))
+		return new Video::SmackerDecoder();
+	if (hasExtension(name, "stream"))
+		return new Video::ThreeDOMovieDecoder();
+	return nullptr;
+}
+
+uint32 frameChecksum(const Common::CRC32 &crc, const Graphics::Surface &frame, const byte *palette) {
+	uint32 remainder = crc.getInitRemainder();
+	for (int y = 0; y < frame.h; y++) {
+		const byte *row = (const byte *)frame.getBasePtr(0, y);
+		for (int x = 0; x < frame.w * frame.format.bytesPerPixel; x++)
+			remainder = crc.processByte(row[x], remainder);
+	}
+	if (palette && frame.format.isCLUT8()) {
+		for (int i = 0; i < 256 * 3; i++)
+			remainder = crc.processByte(palette[i], remainder);
+	}
+	return crc.finalize(remainder);
+}
+
+double peakMemoryMB() {
+#ifdef POSIX
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) == 0)
+		return usage.ru_maxrss / 1024.0; // In kilobytes on Linux
+#endif
+	return 0.0;
+}
+
+} // End of anonymous namespace
+
+int main(int argc, char *argv[]) {
+	const char *fileName = nullptr;
+	Graphics::PixelFormat format = formats[3].format;
+	const char *formatName = formats[3].name;
+	int kernelIndex = -1;
+	uint maxFrames = 0;
+	bool checksum = false;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--format") && i + 1 < argc) {
+			formatName = argv[++i];
+			int f = 0;
+			while (f < ARRAYSIZE(formats) && strcmp(formats[f].name, formatName))
+				f++;
+			if (f == ARRAYSIZE(formats)) {
+				usage();
+				return 1;
+			}
+			format = formats[f].format;
+		} else if (!strcmp(argv[i], "--frames") && i + 1 < argc) {
+			maxFrames = atoi(argv[++i]);
+		} else if (!strcmp(argv[i], "--kernels") && i + 1 < argc) {
+			const char *name = argv[++i];
+			kernelIndex = 0;
+			while (kernelIndex < ARRAYSIZE(kernels) && strcmp(kernels[kernelIndex].name, name))
+				kernelIndex++;
+			if (kernelIndex == ARRAYSIZE(kernels)) {
+				usage();
+				return 1;
+			}
+		} else if (!strcmp(argv[i], "--checksum")) {
+			checksum = true;
+		} else if (argv[i][0] != '-' && !fileName) {
+			fileName = argv[i];
+		} else {
+			usage();
+			return 1;
+		}
+	}
+
+	if (!fileName) {
+		usage();
+		return 1;
+	}
+
+	BenchSystem *system = new BenchSystem();
+	g_system = system;
+	system->initManagers();
+	g_system->initSize(320, 200, &format);
+
+	if (kernelIndex >= 0 && !Graphics::setBlitKernels(kernels[kernelIndex].set)) {
+		fprintf(stderr, "The %s kernels are not available\n", kernels[kernelIndex].name);
+		return 1;
+	}
+
+	Video::VideoDecoder *decoder = createDecoder(fileName, format);
+	if (!decoder) {
+		fprintf(stderr, "No decoder for %s\n", fileName);
+		return 1;
+	}
+
+	Common::SeekableReadStream *stream = Common::FSNode(Common::Path(fileName, Common::Path::kNativeSeparator)).createReadStream();
+	if (!stream || !decoder->loadStream(stream)) {
+		fprintf(stderr, "Could not load %s\n", fileName);
+		delete decoder;
+		return 1;
+	}
+	decoder->setOutputPixelFormat(format);
+
+	const Common::CRC32 crc;
+	uint32 combined = crc.getInitRemainder();
+	uint frames = 0;
+	uint skipped = 0;
+
+	Video::DecodeProfiler::reset();
+	Video::DecodeProfiler::setEnabled(true);
+	const uint32 startMillis = g_system->getMillis();
+	const uint64 startCycles = Common::getCycleCount();
+
+	while (!decoder->endOfVideo() && (!maxFrames || frames < maxFrames)) {
+		const Graphics::Surface *frame = decoder->decodeNextFrame();
+		if (!frame) {
+			// Some decoders return no frame for frames without changes,
+			// give up on the ones which never get to the end
+			if (++skipped > 1000)
+				break;
+			continue;
+		}
+		skipped = 0;
+		frames++;
+
+		if (checksum) {
+			const uint32 frameCrc = frameChecksum(crc, *frame, decoder->getPalette());
+			for (int i = 0; i < 4; i++)
+				combined = crc.processByte((frameCrc >> (i * 8)) & 0xFF, combined);
+		}
+	}
+
+	const uint64 totalCycles = Common::getCycleCount() - startCycles;
+	const uint32 totalMillis = MAX<uint32>(g_system->getMillis() - startMillis, 1);
+	Video::DecodeProfiler::setEnabled(false);
+
+	printf("%s: %u frames of %dx%d in %u ms, %.2f fps\n", fileName, frames, decoder->getWidth(), decoder->getHeight(),
+	       totalMillis, frames * 1000.0 / totalMillis);
+	printf("Output format %s%s%s\n", decoder->getPixelFormat().toString().c_str(),
+	       kernelIndex >= 0 ? ", kernels " : "", kernelIndex >= 0 ? kernels[kernelIndex].name : "");
+
+	// The stages are measured in cycles, which are converted with the
+	// duration of the whole run
+	const double msPerCycle = totalCycles ? (double)totalMillis / totalCycles : 0.0;
+	uint64 stageCycles = 0;
+	for (int i = 0; i < Video::DecodeProfiler::kStageCount; i++) {
+		const Video::DecodeProfiler::Stage stage = (Video::DecodeProfiler::Stage)i;
+		const uint64 cycles = Video::DecodeProfiler::getCycles(stage);
+		stageCycles += cycles;
+		printf("  %-14s %10.1f ms\n", Video::DecodeProfiler::getStageName(stage), cycles * msPerCycle);
+	}
+	printf("  %-14s %10.1f ms\n", "other", (totalCycles > stageCycles ? totalCycles - stageCycles : 0) * msPerCycle);
+	printf("Peak memory %.1f MB\n", peakMemoryMB());
+	if (checksum)
+		printf("Checksum %08x\n", crc.finalize(combined));
+
+	delete decoder;
+	g_system->destroy();
+	return 0;
+}
@@ -0,0 +1,158 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#ifdef SCUMMVM_NEON
+
+#include <arm_neon.h>
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("neon"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("fpu=neon")
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+namespace Video {
+
+/** IDCT_TRANSFORM of bink_decoder.cpp on four columns or rows at once, see bink_decoder-sse2.cpp. */
+template <bool kRow>
+static FORCEINLINE void neon_idctTransform(int32x4_t *d, const int32x4_t *s) {
+	const int32x4_t a0 = vaddq_s32(s[0], s[4]);
+	const int32x4_t a1 = vsubq_s32(s[0], s[4]);
+	const int32x4_t a2 = vaddq_s32(s[2], s[6]);
+	const int32x4_t a3 = vshrq_n_s32(vmulq_n_s32(vsubq_s32(s[2], s[6]), 2896), 11);
+	const int32x4_t a4 = vaddq_s32(s[5], s[3]);
+	const int32x4_t a5 = vsubq_s32(s[5], s[3]);
+	const int32x4_t a6 = vaddq_s32(s[1], s[7]);
+	const int32x4_t a7 = vsubq_s32(s[1], s[7]);
+	const int32x4_t b0 = vaddq_s32(a4, a6);
+	const int32x4_t b1 = vshrq_n_s32(vmulq_n_s32(vaddq_s32(a5, a7), 3784), 11);
+	const int32x4_t b2 = vaddq_s32(vsubq_s32(vshrq_n_s32(vmulq_n_s32(a5, -5352), 11), b0), b1);
+	const int32x4_t b3 = vsubq_s32(vshrq_n_s32(vmulq_n_s32(vsubq_s32(a6, a4), 2896), 11), b2);
+	const int32x4_t b4 = vsubq_s32(vaddq_s32(vshrq_n_s32(vmulq_n_s32(a7, 2217), 11), b3), b1);
+
+	const int32x4_t a02 = vaddq_s32(a0, a2);
+	const int32x4_t a0m2 = vsubq_s32(a0, a2);
+	const int32x4_t a13m2 = vsubq_s32(vaddq_s32(a1, a3), a2);
+	const int32x4_t a1m32 = vaddq_s32(vsubq_s32(a1, a3), a2);
+	d[0] = vaddq_s32(a02, b0);
+	d[1] = vaddq_s32(a13m2, b2);
+	d[2] = vaddq_s32(a1m32, b3);
+	d[3] = vsubq_s32(a0m2, b4);
+	d[4] = vaddq_s32(a0m2, b4);
+	d[5] = vsubq_s32(a1m32, b3);
+	d[6] = vsubq_s32(a13m2, b2);
+	d[7] = vsubq_s32(a02, b0);
+
+	if (kRow) {
+		const int32x4_t round = vdupq_n_s32(0x7F);
+		for (int i = 0; i < 8; i++)
+			d[i] = vshrq_n_s32(vaddq_s32(d[i], round), 8);
+	}
+}
+
+static FORCEINLINE void neon_transpose4x4(int32x4_t *d, int32x4_t s0, int32x4_t s1, int32x4_t s2, int32x4_t s3) {
+	const int32x4x2_t t01 = vtrnq_s32(s0, s1);
+	const int32x4x2_t t23 = vtrnq_s32(s2, s3);
+	d[0] = vcombine_s32(vget_low_s32(t01.val[0]), vget_low_s32(t23.val[0]));
+	d[1] = vcombine_s32(vget_low_s32(t01.val[1]), vget_low_s32(t23.val[1]));
+	d[2] = vcombine_s32(vget_high_s32(t01.val[0]), vget_high_s32(t23.val[0]));
+	d[3] = vcombine_s32(vget_high_s32(t01.val[1]), vget_high_s32(t23.val[1]));
+}
+
+/** The IDCT of an 8x8 block, laid out like sse2_idct() does. */
+static FORCEINLINE void neon_idct(int32x4_t *out, const int32 *block) {
+	int32x4_t s[8], d[8], cols[16];
+	for (int h = 0; h < 2; h++) {
+		for (int i = 0; i < 8; i++)
+			s[i] = vld1q_s32(block + 8 * i + 4 * h);
+		neon_idctTransform<false>(d, s);
+		for (int i = 0; i < 8; i++)
+			cols[2 * i + h] = d[i];
+	}
+
+	for (int g = 0; g < 2; g++) {
+		for (int h = 0; h < 2; h++)
+			neon_transpose4x4(s + 4 * h, cols[8 * g + h], cols[8 * g + 2 + h], cols[8 * g + 4 + h], cols[8 * g + 6 + h]);
+		neon_idctTransform<true>(d, s);
+		for (int h = 0; h < 2; h++) {
+			int32x4_t rows[4];
+			neon_transpose4x4(rows, d[4 * h], d[4 * h + 1], d[4 * h + 2], d[4 * h + 3]);
+			for (int i = 0; i < 4; i++)
+				out[2 * (4 * g + i) + h] = rows[i];
+		}
+	}
+}
+
+/** The low bytes of the eight values starting at column 0 of a row. */
+static FORCEINLINE uint8x8_t neon_lowBytes(int32x4_t lo, int32x4_t hi) {
+	return vmovn_u16(vcombine_u16(vmovn_u32(vreinterpretq_u32_s32(lo)), vmovn_u32(vreinterpretq_u32_s32(hi))));
+}
+
+void binkIDCTPutNEON(byte *dest, uint pitch, const int32 *block) {
+	int32x4_t out[16];
+	neon_idct(out, block);
+
+	// Like the generic code, store the low byte without clamping
+	for (int i = 0; i < 8; i++, dest += pitch)
+		vst1_u8(dest, neon_lowBytes(out[2 * i], out[2 * i + 1]));
+}
+
+void binkIDCTAddNEON(byte *dest, uint pitch, const int32 *block) {
+	int32x4_t out[16];
+	neon_idct(out, block);
+
+	for (int i = 0; i < 8; i++, dest += pitch)
+		vst1_u8(dest, vadd_u8(vld1_u8(dest), neon_lowBytes(out[2 * i], out[2 * i + 1])));
+}
+
+void binkScaledPatternNEON(byte *dest, uint pitch, const byte *patterns, byte col0, byte col1) {
+	static const uint8_t bitValues[16] = { 1, 1, 2, 2, 4, 4, 8, 8, 16, 16, 32, 32, 64, 64, 128, 128 };
+	const uint8x16_t bits = vld1q_u8(bitValues);
+	const uint8x16_t c0 = vdupq_n_u8(col0);
+	const uint8x16_t c1 = vdupq_n_u8(col1);
+
+	for (int j = 0; j < 8; j++, dest += pitch << 1) {
+		const uint8x16_t row = vbslq_u8(vtstq_u8(vdupq_n_u8(patterns[j]), bits), c1, c0);
+		vst1q_u8(dest, row);
+		vst1q_u8(dest + pitch, row);
+	}
+}
+
+} // End of namespace Video
+
+#if !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__aarch64__) && !defined(__ARM_NEON)
+
+#endif // SCUMMVM_NEON
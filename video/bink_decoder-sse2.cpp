@@ -0,0 +1,180 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "common/scummsys.h"
+
+#include <emmintrin.h>
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute push (__attribute__((target("sse2"))), apply_to=function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse2")
+#endif
+
+#endif // !defined(__x86_64__)
+
+namespace Video {
+
+/**
+ * Multiply 32-bit lanes by a positive constant below 2^16, exact modulo
+ * 2^32 like the int arithmetic of IDCT_TRANSFORM. SSE2 only multiplies
+ * 16-bit values, so the product is put together from the two halves.
+ */
+static FORCEINLINE __m128i sse2_mul(__m128i x, int c) {
+	const __m128i cc = _mm_set1_epi16((int16)c);
+	return _mm_add_epi32(_mm_mullo_epi16(x, cc), _mm_slli_epi32(_mm_mulhi_epu16(x, cc), 16));
+}
+
+/** IDCT_TRANSFORM of bink_decoder.cpp on four columns or rows at once. */
+template <bool kRow>
+static FORCEINLINE void sse2_idctTransform(__m128i *d, const __m128i *s) {
+	const __m128i a0 = _mm_add_epi32(s[0], s[4]);
+	const __m128i a1 = _mm_sub_epi32(s[0], s[4]);
+	const __m128i a2 = _mm_add_epi32(s[2], s[6]);
+	const __m128i a3 = _mm_srai_epi32(sse2_mul(_mm_sub_epi32(s[2], s[6]), 2896), 11);
+	const __m128i a4 = _mm_add_epi32(s[5], s[3]);
+	const __m128i a5 = _mm_sub_epi32(s[5], s[3]);
+	const __m128i a6 = _mm_add_epi32(s[1], s[7]);
+	const __m128i a7 = _mm_sub_epi32(s[1], s[7]);
+	const __m128i b0 = _mm_add_epi32(a4, a6);
+	const __m128i b1 = _mm_srai_epi32(sse2_mul(_mm_add_epi32(a5, a7), 3784), 11);
+	const __m128i b2 = _mm_add_epi32(_mm_sub_epi32(_mm_srai_epi32(_mm_sub_epi32(_mm_setzero_si128(), sse2_mul(a5, 5352)), 11), b0), b1);
+	const __m128i b3 = _mm_sub_epi32(_mm_srai_epi32(sse2_mul(_mm_sub_epi32(a6, a4), 2896), 11), b2);
+	const __m128i b4 = _mm_sub_epi32(_mm_add_epi32(_mm_srai_epi32(sse2_mul(a7, 2217), 11), b3), b1);
+
+	const __m128i a02 = _mm_add_epi32(a0, a2);
+	const __m128i a0m2 = _mm_sub_epi32(a0, a2);
+	const __m128i a13m2 = _mm_sub_epi32(_mm_add_epi32(a1, a3), a2);
+	const __m128i a1m32 = _mm_add_epi32(_mm_sub_epi32(a1, a3), a2);
+	d[0] = _mm_add_epi32(a02, b0);
+	d[1] = _mm_add_epi32(a13m2, b2);
+	d[2] = _mm_add_epi32(a1m32, b3);
+	d[3] = _mm_sub_epi32(a0m2, b4);
+	d[4] = _mm_add_epi32(a0m2, b4);
+	d[5] = _mm_sub_epi32(a1m32, b3);
+	d[6] = _mm_sub_epi32(a13m2, b2);
+	d[7] = _mm_sub_epi32(a02, b0);
+
+	if (kRow) {
+		const __m128i round = _mm_set1_epi32(0x7F);
+		for (int i = 0; i < 8; i++)
+			d[i] = _mm_srai_epi32(_mm_add_epi32(d[i], round), 8);
+	}
+}
+
+static FORCEINLINE void sse2_transpose4x4(__m128i *d, const __m128i &s0, const __m128i &s1, const __m128i &s2, const __m128i &s3) {
+	const __m128i t0 = _mm_unpacklo_epi32(s0, s1);
+	const __m128i t1 = _mm_unpacklo_epi32(s2, s3);
+	const __m128i t2 = _mm_unpackhi_epi32(s0, s1);
+	const __m128i t3 = _mm_unpackhi_epi32(s2, s3);
+	d[0] = _mm_unpacklo_epi64(t0, t1);
+	d[1] = _mm_unpackhi_epi64(t0, t1);
+	d[2] = _mm_unpacklo_epi64(t2, t3);
+	d[3] = _mm_unpackhi_epi64(t2, t3);
+}
+
+/**
+ * The IDCT of an 8x8 block, with out[2 * i + h] holding the four values
+ * of row i starting at column 4 * h.
+ */
+static FORCEINLINE void sse2_idct(__m128i *out, const int32 *block) {
+	// The column pass, with the lanes being columns. Skipping columns
+	// without AC coefficients the way IDCTCol() does makes no difference
+	// to the result.
+	__m128i s[8], d[8], cols[16];
+	for (int h = 0; h < 2; h++) {
+		for (int i = 0; i < 8; i++)
+			s[i] = _mm_loadu_si128((const __m128i *)(block + 8 * i + 4 * h));
+		sse2_idctTransform<false>(d, s);
+		for (int i = 0; i < 8; i++)
+			cols[2 * i + h] = d[i];
+	}
+
+	// The row pass, with the lanes being rows
+	for (int g = 0; g < 2; g++) {
+		for (int h = 0; h < 2; h++)
+			sse2_transpose4x4(s + 4 * h, cols[8 * g + h], cols[8 * g + 2 + h], cols[8 * g + 4 + h], cols[8 * g + 6 + h]);
+		sse2_idctTransform<true>(d, s);
+		for (int h = 0; h < 2; h++) {
+			__m128i rows[4];
+			sse2_transpose4x4(rows, d[4 * h], d[4 * h + 1], d[4 * h + 2], d[4 * h + 3]);
+			for (int i = 0; i < 4; i++)
+				out[2 * (4 * g + i) + h] = rows[i];
+		}
+	}
+}
+
+/** The low 16 bits of the eight values starting at column 0 of a row. */
+static FORCEINLINE __m128i sse2_low16(const __m128i &lo, const __m128i &hi) {
+	return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16), _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16));
+}
+
+void binkIDCTPutSSE2(byte *dest, uint pitch, const int32 *block) {
+	__m128i out[16];
+	sse2_idct(out, block);
+
+	// Like the generic code, store the low byte without clamping
+	const __m128i lowByte = _mm_set1_epi16(0xFF);
+	for (int i = 0; i < 8; i++, dest += pitch) {
+		const __m128i row = _mm_and_si128(sse2_low16(out[2 * i], out[2 * i + 1]), lowByte);
+		_mm_storel_epi64((__m128i *)dest, _mm_packus_epi16(row, row));
+	}
+}
+
+void binkIDCTAddSSE2(byte *dest, uint pitch, const int32 *block) {
+	__m128i out[16];
+	sse2_idct(out, block);
+
+	const __m128i lowByte = _mm_set1_epi16(0xFF);
+	for (int i = 0; i < 8; i++, dest += pitch) {
+		const __m128i old = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)dest), _mm_setzero_si128());
+		const __m128i row = _mm_and_si128(_mm_add_epi16(old, sse2_low16(out[2 * i], out[2 * i + 1])), lowByte);
+		_mm_storel_epi64((__m128i *)dest, _mm_packus_epi16(row, row));
+	}
+}
+
+void binkScaledPatternSSE2(byte *dest, uint pitch, const byte *patterns, byte col0, byte col1) {
+	const __m128i bits = _mm_setr_epi8(1, 1, 2, 2, 4, 4, 8, 8, 16, 16, 32, 32, 64, 64, (char)128, (char)128);
+	const __m128i c0 = _mm_set1_epi8((char)col0);
+	const __m128i c1 = _mm_set1_epi8((char)col1);
+
+	for (int j = 0; j < 8; j++, dest += pitch << 1) {
+		const __m128i set = _mm_cmpeq_epi8(_mm_and_si128(_mm_set1_epi8((char)patterns[j]), bits), bits);
+		const __m128i row = _mm_or_si128(_mm_and_si128(set, c1), _mm_andnot_si128(set, c0));
+		_mm_storeu_si128((__m128i *)dest, row);
+		_mm_storeu_si128((__m128i *)(dest + pitch), row);
+	}
+}
+
+} // End of namespace Video
+
+#if !defined(__x86_64__)
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // !defined(__x86_64__)
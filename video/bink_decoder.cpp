@@ -45,6 +45,7 @@
 
 #include "video/binkdata.h"
 #include "video/bink_decoder.h"
+#include "video/decode_profiler.h"
 
 static const uint32 kBIKfID = MKTAG('B', 'I', 'K', 'f');
 static const uint32 kBIKgID = MKTAG('B', 'I', 'K', 'g');
@@ -61,6 +62,64 @@ static const uint32 kDCStartBits = 11;
 
 namespace Video {
 
+#ifdef SCUMMVM_SSE2
+// Defined in bink_decoder-sse2.cpp
+void binkIDCTPutSSE2(byte *dest, uint pitch, const int32 *block);
+void binkIDCTAddSSE2(byte *dest, uint pitch, const int32 *block);
+void binkScaledPatternSSE2(byte *dest, uint pitch, const byte *patterns, byte col0, byte col1);
+#endif
+
+#ifdef SCUMMVM_NEON
+// Defined in bink_decoder-neon.cpp
+void binkIDCTPutNEON(byte *dest, uint pitch, const int32 *block);
+void binkIDCTAddNEON(byte *dest, uint pitch, const int32 *block);
+void binkScaledPatternNEON(byte *dest, uint pitch, const byte *patterns, byte col0, byte col1);
+#endif
+
+namespace {
+
+typedef void (*IDCTKernel)(byte *dest, uint pitch, const int32 *block);
+typedef void (*ScaledPatternKernel)(byte *dest, uint pitch, const byte *patterns, byte col0, byte col1);
+
+// The SIMD versions of the block functions, or null for the generic code
+IDCTKernel idctPutKernel = nullptr;
+IDCTKernel idctAddKernel = nullptr;
+ScaledPatternKernel scaledPatternKernel = nullptr;
+bool binkKernelsSelected = false;
+
+void selectBinkKernels() {
+	if (binkKernelsSelected)
+		return;
+
+#if defined(SCUMMVM_SSE2)
+#if defined(__x86_64__) || defined(_M_X64)
+	const bool useSSE2 = true;
+#else
+	const bool useSSE2 = g_system->hasFeature(OSystem::kFeatureCpuSSE2);
+#endif
+	if (useSSE2) {
+		idctPutKernel = binkIDCTPutSSE2;
+		idctAddKernel = binkIDCTAddSSE2;
+		scaledPatternKernel = binkScaledPatternSSE2;
+	}
+#elif defined(SCUMMVM_NEON)
+#if defined(__aarch64__)
+	const bool useNEON = true;
+#else
+	const bool useNEON = g_system->hasFeature(OSystem::kFeatureCpuNEON);
+#endif
+	if (useNEON) {
+		idctPutKernel = binkIDCTPutNEON;
+		idctAddKernel = binkIDCTAddNEON;
+		scaledPatternKernel = binkScaledPatternNEON;
+	}
+#endif
+
+	binkKernelsSelected = true;
+}
+
+} // End of anonymous namespace
+
 BinkDecoder::BinkDecoder() {
 	_bink = 0;
 }
@@ -246,6 +305,8 @@ BinkDecoder::BinkVideoTrack::BinkVideoTrack(uint32 width, uint32 height, uint32
 		_frameCount(frameCount), _frameRate(frameRate), _swapPlanes(swapPlanes), _hasAlpha(hasAlpha), _id(id), _surface(nullptr) {
 	_curFrame = -1;
 
+	selectBinkKernels();
+
 	for (int i = 0; i < 16; i++)
 		_huffman[i] = 0;
 
@@ -481,6 +542,7 @@ void BinkDecoder::BinkVideoTrack::decodePacket(VideoFrame &frame) {
 	// Convert the YUV data we have to our format
 	// The width used here is the surface-width, and not the video-width
 	// to allow for odd-sized videos.
+	DecodeProfiler::Scope profile(DecodeProfiler::kStageColorConvert);
 	if (_hasAlpha) {
 		assert(_curPlanes[0] && _curPlanes[1] && _curPlanes[2] && _curPlanes[3]);
 		YUVToRGBMan.convert420Alpha(_surface, Graphics::YUVToRGBManager::kScaleITU, _curPlanes[0], _curPlanes[1], _curPlanes[2], _curPlanes[3],
@@ -504,6 +566,8 @@ void BinkDecoder::BinkVideoTrack::decodePlane(VideoFrame &video, int planeIdx, b
 	uint32 width       = blockWidth  * 8;
 	uint32 height      = blockHeight * 8;
 
+	// Reading the coefficients of the blocks is part of their transform
+	DecodeProfiler::Scope profile(DecodeProfiler::kStageTransform);
 	DecodeContext ctx;
 
 	ctx.video     = &video;
@@ -523,22 +587,28 @@ void BinkDecoder::BinkVideoTrack::decodePlane(VideoFrame &video, int planeIdx, b
 		ctx.coordScaledMap4[i] = ((i & 7) * 2 + 1) + (((i >> 3) * 2 + 1) * ctx.pitch);
 	}
 
-	for (int i = 0; i < kSourceMAX; i++) {
-		_bundles[i].countLength = _bundles[i].countLengths[isChroma ? 1 : 0];
+	{
+		DecodeProfiler::Scope bundleProfile(DecodeProfiler::kStageBitstream);
+		for (int i = 0; i < kSourceMAX; i++) {
+			_bundles[i].countLength = _bundles[i].countLengths[isChroma ? 1 : 0];
 
-		readBundle(video, (Source) i);
+			readBundle(video, (Source) i);
+		}
 	}
 
 	for (ctx.blockY = 0; ctx.blockY < blockHeight; ctx.blockY++) {
-		readBlockTypes              (video, _bundles[kSourceBlockTypes]);
-		readBlockTypes              (video, _bundles[kSourceSubBlockTypes]);
-		readColors                  (video, _bundles[kSourceColors]);
-		readPatterns                (video, _bundles[kSourcePattern]);
-		readMotionValues            (video, _bundles[kSourceXOff]);
-		readMotionValues            (video, _bundles[kSourceYOff]);
-		readDCS<kDCStartBits, false>(video, _bundles[kSourceIntraDC]);
-		readDCS<kDCStartBits, true> (video, _bundles[kSourceInterDC]);
-		readRuns                    (video, _bundles[kSourceRun]);
+		{
+			DecodeProfiler::Scope bundleProfile(DecodeProfiler::kStageBitstream);
+			readBlockTypes              (video, _bundles[kSourceBlockTypes]);
+			readBlockTypes              (video, _bundles[kSourceSubBlockTypes]);
+			readColors                  (video, _bundles[kSourceColors]);
+			readPatterns                (video, _bundles[kSourcePattern]);
+			readMotionValues            (video, _bundles[kSourceXOff]);
+			readMotionValues            (video, _bundles[kSourceYOff]);
+			readDCS<kDCStartBits, false>(video, _bundles[kSourceIntraDC]);
+			readDCS<kDCStartBits, true> (video, _bundles[kSourceInterDC]);
+			readRuns                    (video, _bundles[kSourceRun]);
+		}
 
 		ctx.dest = ctx.destStart + 8 * ctx.blockY * ctx.pitch;
 		ctx.prev = ctx.prevStart + 8 * ctx.blockY * ctx.pitch;
@@ -842,6 +912,13 @@ void BinkDecoder::BinkVideoTrack::blockScaledPattern(DecodeContext &ctx) {
 	for (int i = 0; i < 2; i++)
 		col[i] = getBundleValue(kSourceColors);
 
+	if (scaledPatternKernel) {
+		// The patterns are plain bytes in the bundle, see getBundleValue()
+		scaledPatternKernel(ctx.dest, ctx.pitch, _bundles[kSourcePattern].curPtr, col[0], col[1]);
+		_bundles[kSourcePattern].curPtr += 8;
+		return;
+	}
+
 	byte *dest1 = ctx.dest;
 	byte *dest2 = ctx.dest + ctx.pitch;
 	for (int j = 0; j < 8; j++, dest1 += (ctx.pitch << 1) - 16, dest2 += (ctx.pitch << 1) - 16) {
@@ -1475,6 +1552,11 @@ void BinkDecoder::BinkVideoTrack::IDCT(int32 *block) {
 void BinkDecoder::BinkVideoTrack::IDCTAdd(DecodeContext &ctx, int32 *block) {
 	int i, j;
 
+	if (idctAddKernel) {
+		idctAddKernel(ctx.dest, ctx.pitch, block);
+		return;
+	}
+
 	IDCT(block);
 	byte *dest = ctx.dest;
 	for (i = 0; i < 8; i++, dest += ctx.pitch, block += 8)
@@ -1485,6 +1567,12 @@ void BinkDecoder::BinkVideoTrack::IDCTAdd(DecodeContext &ctx, int32 *block) {
 void BinkDecoder::BinkVideoTrack::IDCTPut(DecodeContext &ctx, int32 *block) {
 	int i;
 	int32 temp[64];
+
+	if (idctPutKernel) {
+		idctPutKernel(ctx.dest, ctx.pitch, block);
+		return;
+	}
+
 	for (i = 0; i < 8; i++)
 		IDCTCol(&temp[i], &block[i]);
 	for (i = 0; i < 8; i++) {
@@ -0,0 +1,76 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "video/decode_profiler.h"
+
+#include "common/cyclecounter.h"
+
+namespace Video {
+
+bool DecodeProfiler::_enabled = false;
+int DecodeProfiler::_current = -1;
+uint64 DecodeProfiler::_start = 0;
+uint64 DecodeProfiler::_cycles[kStageCount] = { 0, 0, 0 };
+
+void DecodeProfiler::setEnabled(bool enabled) {
+	_enabled = enabled;
+	_current = -1;
+}
+
+void DecodeProfiler::reset() {
+	for (int i = 0; i < kStageCount; i++)
+		_cycles[i] = 0;
+}
+
+const char *DecodeProfiler::getStageName(Stage stage) {
+	switch (stage) {
+	case kStageBitstream:
+		return "bitstream";
+	case kStageTransform:
+		return "transform";
+	case kStageColorConvert:
+		return "color convert";
+	default:
+		return "unknown";
+	}
+}
+
+int DecodeProfiler::enter(Stage stage) {
+	const uint64 now = Common::getCycleCount();
+	if (_current >= 0)
+		_cycles[_current] += now - _start;
+
+	const int previous = _current;
+	_current = stage;
+	_start = now;
+	return previous;
+}
+
+void DecodeProfiler::leave(int previous) {
+	const uint64 now = Common::getCycleCount();
+	if (_current >= 0)
+		_cycles[_current] += now - _start;
+
+	_current = previous;
+	_start = now;
+}
+
+} // End of namespace Video
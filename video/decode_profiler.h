@@ -0,0 +1,89 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef VIDEO_DECODE_PROFILER_H
+#define VIDEO_DECODE_PROFILER_H
+
+#include "common/scummsys.h"
+
+namespace Video {
+
+/**
+ * Measures the time decoders spend in the stages of decoding frames, for
+ * benchmarking them, see test/videobench.cpp.
+ *
+ * Decoders mark the stages with Scope objects, which cost a check of a
+ * flag while profiling is off. Scopes nest: the time of an inner stage
+ * is not counted for the outer one. The times are in the units of
+ * Common::getCycleCount(), summed up over all decoders, and only make
+ * sense with one thread decoding.
+ */
+class DecodeProfiler {
+public:
+	enum Stage {
+		kStageBitstream,    ///< Reading and entropy decoding bitstreams
+		kStageTransform,    ///< Reconstructing blocks: inverse transforms, prediction, copying
+		kStageColorConvert, ///< Converting the frame to the output format
+		kStageCount
+	};
+
+	class Scope {
+	public:
+		explicit Scope(Stage stage) : _active(_enabled) {
+			if (_active)
+				_previous = enter(stage);
+		}
+
+		~Scope() {
+			if (_active)
+				leave(_previous);
+		}
+
+	private:
+		bool _active;
+		int _previous;
+	};
+
+	/** Start or stop measuring. */
+	static void setEnabled(bool enabled);
+	static bool isEnabled() { return _enabled; }
+
+	/** Set the times of all stages back to zero. */
+	static void reset();
+
+	/** The time spent in the stage since the last reset. */
+	static uint64 getCycles(Stage stage) { return _cycles[stage]; }
+
+	static const char *getStageName(Stage stage);
+
+private:
+	static int enter(Stage stage);
+	static void leave(int previous);
+
+	static bool _enabled;
+	static int _current;
+	static uint64 _start;
+	static uint64 _cycles[kStageCount];
+};
+
+} // End of namespace Video
+
+#endif
@@ -4,6 +4,7 @@ MODULE_OBJS := \
 	3do_decoder.o \
 	avi_decoder.o \
 	coktel_decoder.o \
+	decode_profiler.o \
 	dxa_decoder.o \
 	flic_decoder.o \
 	mpegps_decoder.o \
@@ -19,6 +20,14 @@ MODULE_OBJS := \
 ifdef USE_BINK
 MODULE_OBJS += \
 	bink_decoder.o
+ifdef SCUMMVM_NEON
+MODULE_OBJS += \
+	bink_decoder-neon.o
+endif
+ifdef SCUMMVM_SSE2
+MODULE_OBJS += \
+	bink_decoder-sse2.o
+endif
 endif
 
 ifdef USE_HNM
@@ -333,6 +333,8 @@ QuickTimeDecoder::VideoTrackHandler::VideoTrackHandler(QuickTimeDecoder *decoder
 	_curEdit = 0;
 	_curFrame = -1;
 	_delayedFrameToBufferTo = -1;
+	_packetBufferStart = _packetBufferEnd = 0;
+	_lastPacketSample = -1;
 	enterNewEditListEntry(true, true); // might set _curFrame
 
 	if (decoder->_qtvrType == QTVRType::OBJECT)
@@ -625,6 +627,13 @@ Common::String QuickTimeDecoder::getAliasPath() {
 
 Audio::Timestamp QuickTimeDecoder::VideoTrackHandler::getFrameTime(uint frame) const {
 	// TODO: This probably doesn't work right with edit lists
+	if (!_parent->sampleIndex.empty()) {
+		if (frame < _parent->sampleIndex.size())
+			return Audio::Timestamp(0, _parent->timeScale).addFrames(_parent->sampleIndex[frame].time);
+
+		return Audio::Timestamp().addFrames(-1);
+	}
+
 	int cumulativeDuration = 0;
 	for (int ttsIndex = 0; ttsIndex < _parent->timeToSampleCount; ttsIndex++) {
 		const TimeToSampleEntry &tts = _parent->timeToSample[ttsIndex];
@@ -715,7 +724,62 @@ Common::Rational QuickTimeDecoder::VideoTrackHandler::getScaledHeight() const {
 	return Common::Rational(_parent->height) / _parent->scaleFactorY;
 }
 
+// Upper bound on the size of a sequential read of contiguous samples
+static const uint32 kMaxPacketReadAhead = 64 * 1024;
+
+Common::SeekableReadStream *QuickTimeDecoder::VideoTrackHandler::readIndexedPacket(uint32 sample) {
+	const Common::QuickTimeParser::Track::SampleIndexEntry *entries = _parent->sampleIndex.data();
+	uint32 sampleCount = _parent->sampleIndex.size();
+	Common::SeekableReadStream *stream = _decoder->_fd;
+
+	bool sequential = (int32)sample == _lastPacketSample + 1;
+	_lastPacketSample = sample;
+
+	if (sample < _packetBufferStart || sample >= _packetBufferEnd) {
+		_packetBufferStart = _packetBufferEnd = 0;
+
+		// Only playing forward makes reading ahead worthwhile; seeks and
+		// reverse playback read the sample on its own.
+		uint32 runEnd = sample + 1;
+		uint32 runSize = entries[sample].size;
+		if (sequential && !_reversed) {
+			while (runEnd < sampleCount && entries[runEnd].offset == entries[runEnd - 1].offset + entries[runEnd - 1].size &&
+					runSize + entries[runEnd].size <= kMaxPacketReadAhead) {
+				runSize += entries[runEnd].size;
+				runEnd++;
+			}
+		}
+
+		stream->seek(entries[sample].offset);
+		if (runEnd == sample + 1)
+			return stream->readStream(entries[sample].size);
+
+		_packetBuffer.resize(runSize);
+		if (stream->read(_packetBuffer.data(), runSize) != runSize)
+			return nullptr;
+
+		_packetBufferStart = sample;
+		_packetBufferEnd = runEnd;
+	}
+
+	uint32 size = entries[sample].size;
+	byte *data = (byte *)malloc(size);
+	if (!data)
+		return nullptr;
+
+	memcpy(data, _packetBuffer.data() + (entries[sample].offset - entries[_packetBufferStart].offset), size);
+	return new Common::MemoryReadStream(data, size, DisposeAfterUse::YES);
+}
+
 Common::SeekableReadStream *QuickTimeDecoder::VideoTrackHandler::getNextFramePacket(uint32 &descId) {
+	if (!_parent->sampleIndex.empty()) {
+		if (_curFrame < 0 || (uint32)_curFrame >= _parent->sampleIndex.size())
+			error("Could not find data for frame %d", _curFrame);
+
+		descId = _parent->sampleIndex[_curFrame].descId;
+		return readIndexedPacket(_curFrame);
+	}
+
 	// First, we have to track down which chunk holds the sample and which sample in the chunk contains the frame we are looking for.
 	int32 totalSampleCount = 0;
 	int32 sampleInChunk = 0;
@@ -761,6 +825,13 @@ Common::SeekableReadStream *QuickTimeDecoder::VideoTrackHandler::getNextFramePac
 }
 
 uint32 QuickTimeDecoder::VideoTrackHandler::getCurFrameDuration() {
+	if (!_parent->sampleIndex.empty()) {
+		if (_curFrame < 0 || (uint32)_curFrame >= _parent->sampleIndex.size())
+			error("Cannot find duration for frame %d", _curFrame);
+
+		return _parent->sampleIndex[_curFrame].duration;
+	}
+
 	uint32 curFrameIndex = 0;
 	for (int32 i = 0; i < _parent->timeToSampleCount; i++) {
 		curFrameIndex += _parent->timeToSample[i].count;
@@ -776,6 +847,9 @@ uint32 QuickTimeDecoder::VideoTrackHandler::getCurFrameDuration() {
 }
 
 uint32 QuickTimeDecoder::VideoTrackHandler::findKeyFrame(uint32 frame) const {
+	if (frame < _parent->sampleIndex.size())
+		return _parent->sampleIndex[frame].keyframe;
+
 	for (int i = _parent->keyframeCount - 1; i >= 0; i--)
 		if (_parent->keyframes[i] <= frame)
 			return _parent->keyframes[i];
@@ -808,24 +882,36 @@ void QuickTimeDecoder::VideoTrackHandler::enterNewEditListEntry(bool bufferFrame
 	// Track down where the mediaTime is in the media
 	// This is basically time -> frame mapping
 	// Note that this code uses first frame = 0
-	for (int32 i = 0; i < _parent->timeToSampleCount; i++) {
-		uint32 duration = _parent->timeToSample[i].count * _parent->timeToSample[i].duration;
+	if (!_parent->sampleIndex.empty()) {
+		frameNum = _parent->findSampleAtTime(mediaTime);
+
+		// If we didn't get to the exact media time, mark an override for
+		// the time.
+		if (frameNum < _parent->sampleIndex.size()) {
+			const Common::QuickTimeParser::Track::SampleIndexEntry &entry = _parent->sampleIndex[frameNum];
+			if (entry.time != mediaTime)
+				_durationOverride = entry.time + entry.duration - mediaTime;
+		}
+	} else {
+		for (int32 i = 0; i < _parent->timeToSampleCount; i++) {
+			uint32 duration = _parent->timeToSample[i].count * _parent->timeToSample[i].duration;
 
-		if (totalDuration + duration >= mediaTime) {
-			uint32 frameInc = (mediaTime - totalDuration) / _parent->timeToSample[i].duration;
-			frameNum += frameInc;
-			totalDuration += frameInc * _parent->timeToSample[i].duration;
+			if (totalDuration + duration >= mediaTime) {
+				uint32 frameInc = (mediaTime - totalDuration) / _parent->timeToSample[i].duration;
+				frameNum += frameInc;
+				totalDuration += frameInc * _parent->timeToSample[i].duration;
 
-			// If we didn't get to the exact media time, mark an override for
-			// the time.
-			if (totalDuration != mediaTime)
-				_durationOverride = totalDuration + _parent->timeToSample[i].duration - mediaTime;
+				// If we didn't get to the exact media time, mark an override for
+				// the time.
+				if (totalDuration != mediaTime)
+					_durationOverride = totalDuration + _parent->timeToSample[i].duration - mediaTime;
 
-			break;
-		}
+				break;
+			}
 
-		frameNum += _parent->timeToSample[i].count;
-		totalDuration += duration;
+			frameNum += _parent->timeToSample[i].count;
+			totalDuration += duration;
+		}
 	}
 
 	if (bufferFrames) {
@@ -367,7 +367,14 @@ private:
 		Graphics::Surface *_ditherFrame;
 		const Graphics::Surface *forceDither(const Graphics::Surface &frame);
 
+		// Sequential samples that are contiguous in the file, read in one go
+		Common::Array<byte> _packetBuffer;
+		uint32 _packetBufferStart;  // first sample in the buffer
+		uint32 _packetBufferEnd;    // one past the last sample in the buffer
+		int32 _lastPacketSample;
+
 		Common::SeekableReadStream *getNextFramePacket(uint32 &descId);
+		Common::SeekableReadStream *readIndexedPacket(uint32 sample);
 		uint32 getCurFrameDuration();            // media time
 		uint32 findKeyFrame(uint32 frame) const;
 		bool isEmptyEdit() const;
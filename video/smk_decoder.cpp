@@ -32,6 +32,7 @@
 
 #include "video/smk_decoder.h"
 
+#include "common/array.h"
 #include "common/endian.h"
 #include "common/util.h"
 #include "common/stream.h"
@@ -166,14 +167,27 @@ private:
 		SMK_NODE = 0x80000000
 	};
 
-	uint32 decodeTree(uint32 prefix, int length);
+	enum {
+		kLookupBits = 10,
+		kSubLookupBits = 6,
+		kLookupSubTable = 0x80000000
+	};
+
+	uint32 decodeTree();
+	void buildLookup(uint32 node, uint32 code, int length, uint32 table, int tableBits);
 
 	uint32  _treeSize;
 	uint32 *_tree;
 	uint32  _last[3];
 
-	uint32 _prefixtree[256];
-	byte _prefixlength[256];
+	/**
+	 * The codes by their first kLookupBits bits, which are followed by
+	 * tables for the next kSubLookupBits bits of the longer codes. An entry
+	 * holds the code length in bits 24-30 and the index of the leaf in _tree
+	 * in bits 0-23, or it is a kLookupSubTable entry holding the index of
+	 * the next table instead.
+	 */
+	Common::Array<uint32> _lookup;
 
 	/* Used during construction */
 	SmackerBitStream &_bs;
@@ -184,17 +198,18 @@ private:
 
 BigHuffmanTree::BigHuffmanTree(SmackerBitStream &bs, int allocSize)
 	: _bs(bs) {
+	_lookup.resize(1 << kLookupBits);
+
 	uint32 bit = _bs.getBit();
 	if (!bit) {
 		_tree = new uint32[1];
 		_tree[0] = 0;
 		_last[0] = _last[1] = _last[2] = 0;
+		for (uint32 i = 0; i < _lookup.size(); ++i)
+			_lookup[i] = 0;
 		return;
 	}
 
-	for (uint32 i = 0; i < 256; ++i)
-		_prefixtree[i] = _prefixlength[i] = 0;
-
 	_loBytes = new SmallHuffmanTree(_bs);
 	_hiBytes = new SmallHuffmanTree(_bs);
 
@@ -206,7 +221,7 @@ BigHuffmanTree::BigHuffmanTree(SmackerBitStream &bs, int allocSize)
 
 	_treeSize = 0;
 	_tree = new uint32[allocSize / 4];
-	decodeTree(0, 0);
+	decodeTree();
 	(void)_bs.getBit();
 
 	for (uint32 i = 0; i < 3; ++i) {
@@ -218,6 +233,8 @@ BigHuffmanTree::BigHuffmanTree(SmackerBitStream &bs, int allocSize)
 
 	delete _loBytes;
 	delete _hiBytes;
+
+	buildLookup(0, 0, 0, 0, kLookupBits);
 }
 
 BigHuffmanTree::~BigHuffmanTree() {
@@ -228,7 +245,7 @@ void BigHuffmanTree::reset() {
 	_tree[_last[0]] = _tree[_last[1]] = _tree[_last[2]] = 0;
 }
 
-uint32 BigHuffmanTree::decodeTree(uint32 prefix, int length) {
+uint32 BigHuffmanTree::decodeTree() {
 	uint32 bit = _bs.getBit();
 
 	if (!bit) { // Leaf
@@ -239,13 +256,6 @@ uint32 BigHuffmanTree::decodeTree(uint32 prefix, int length) {
 
 		_tree[_treeSize] = v;
 
-		if (length <= 8) {
-			for (int i = 0; i < 256; i += (1 << length)) {
-				_prefixtree[prefix | i] = _treeSize;
-				_prefixlength[prefix | i] = length;
-			}
-		}
-
 		for (int i = 0; i < 3; ++i) {
 			if (_markers[i] == v) {
 				_last[i] = _treeSize;
@@ -259,34 +269,48 @@ uint32 BigHuffmanTree::decodeTree(uint32 prefix, int length) {
 
 	uint32 t = _treeSize++;
 
-	if (length == 8) {
-		_prefixtree[prefix] = t;
-		_prefixlength[prefix] = 8;
-	}
-
-	uint32 r1 = decodeTree(prefix, length + 1);
+	uint32 r1 = decodeTree();
 
 	_tree[t] = SMK_NODE | r1;
 
-	uint32 r2 = decodeTree(prefix | (1 << length), length + 1);
+	uint32 r2 = decodeTree();
 	return r1+r2+1;
 }
 
+void BigHuffmanTree::buildLookup(uint32 node, uint32 code, int length, uint32 table, int tableBits) {
+	if (!(_tree[node] & SMK_NODE)) {
+		// The leaves refer to _tree, since the values of the last used
+		// codes change while decoding
+		for (uint32 i = code; i < (1u << tableBits); i += 1 << length)
+			_lookup[table + i] = node | (length << 24);
+		return;
+	}
+
+	if (length == tableBits) {
+		uint32 subTable = _lookup.size();
+		_lookup.resize(subTable + (1 << kSubLookupBits));
+		_lookup[table + code] = kLookupSubTable | (length << 24) | subTable;
+		buildLookup(node, 0, 0, subTable, kSubLookupBits);
+		return;
+	}
+
+	buildLookup(node + 1, code, length + 1, table, tableBits);
+	buildLookup(node + 1 + (_tree[node] & ~SMK_NODE), code | (1 << length), length + 1, table, tableBits);
+}
+
 uint32 BigHuffmanTree::getCode(SmackerBitStream &bs) {
 	// Peeking data out of bounds is well-defined and returns 0 bits.
 	// This is for convenience when using speed-up techniques reading
 	// more bits than actually available.
-	byte peek = bs.peekBits<8>();
-	uint32 *p = &_tree[_prefixtree[peek]];
-	bs.skip(_prefixlength[peek]);
-
-	while (*p & SMK_NODE) {
-		if (bs.getBit())
-			p += (*p) & ~SMK_NODE;
-		p++;
+	const uint32 *lookup = _lookup.data();
+	uint32 entry = lookup[bs.peekBits<kLookupBits>()];
+	while (entry & kLookupSubTable) {
+		bs.skip((entry >> 24) & 0x7f);
+		entry = lookup[(entry & 0xffffff) + bs.peekBits<kSubLookupBits>()];
 	}
+	bs.skip(entry >> 24);
 
-	uint32 v = *p;
+	uint32 v = _tree[entry & 0xffffff];
 	if (v != _tree[_last[0]]) {
 		_tree[_last[2]] = _tree[_last[1]];
 		_tree[_last[1]] = _tree[_last[0]];
@@ -301,6 +325,7 @@ SmackerDecoder::SmackerDecoder() {
 	_firstFrameStart = 0;
 	_frameTypes = 0;
 	_frameSizes = 0;
+	_fullFrameDirty = false;
 }
 
 SmackerDecoder::~SmackerDecoder() {
@@ -464,27 +489,33 @@ const Graphics::Surface *SmackerDecoder::forceSeekToFrame(uint frame) {
 	if (seekFrame >= getFrameCount())
 		return nullptr;
 
-	if (!rewind())
-		return nullptr;
-
-	stopAudio();
 	SmackerVideoTrack *videoTrack = (SmackerVideoTrack *)getTrack(0);
-	uint32 startPos = _fileStream->pos();
-	uint32 offset = 0;
-	for (uint32 i = 0; i < seekFrame; i++) {
-		videoTrack->increaseCurFrame();
-		// Frames with palette data contain palette entries which use
-		// the previous palette as their base. Therefore, we need to
-		// parse all palette entries up to the requested frame
-		if (_frameTypes[videoTrack->getCurFrame()] & 1) {
-			_fileStream->seek(startPos + offset, SEEK_SET);
-			videoTrack->unpackPalette(_fileStream);
+
+	{
+		// The frames decoded ahead are dropped once the track is moved
+		DecodeAheadLock lock(this);
+
+		if (!rewind())
+			return nullptr;
+
+		stopAudio();
+		uint32 startPos = _fileStream->pos();
+		uint32 offset = 0;
+		for (uint32 i = 0; i < seekFrame; i++) {
+			videoTrack->increaseCurFrame();
+			// Frames with palette data contain palette entries which use
+			// the previous palette as their base. Therefore, we need to
+			// parse all palette entries up to the requested frame
+			if (_frameTypes[videoTrack->getCurFrame()] & 1) {
+				_fileStream->seek(startPos + offset, SEEK_SET);
+				videoTrack->unpackPalette(_fileStream);
+			}
+			offset += _frameSizes[i] & ~3;
 		}
-		offset += _frameSizes[i] & ~3;
-	}
 
-	if (!_fileStream->seek(startPos + offset, SEEK_SET))
-		return nullptr;
+		if (!_fileStream->seek(startPos + offset, SEEK_SET))
+			return nullptr;
+	}
 
 	const Graphics::Surface *surface = nullptr;
 	while (getCurFrame() < (int)frame) {
@@ -642,6 +673,14 @@ void SmackerDecoder::SmackerVideoTrack::readTrees(SmackerBitStream &bs, uint32 m
 	_TypeTree = new BigHuffmanTree(bs, typeSize);
 }
 
+// The bytes of a row of a mono block which take the high color, by bits
+static const uint32 kMonoRowMasks[16] = {
+	0x00000000, 0x000000FF, 0x0000FF00, 0x0000FFFF,
+	0x00FF0000, 0x00FF00FF, 0x00FFFF00, 0x00FFFFFF,
+	0xFF000000, 0xFF0000FF, 0xFF00FF00, 0xFF00FFFF,
+	0xFFFF0000, 0xFFFF00FF, 0xFFFFFF00, 0xFFFFFFFF
+};
+
 void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 	_MMapTree->reset();
 	_MClrTree->reset();
@@ -659,10 +698,12 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 
 	byte *out;
 	uint type, run, j, mode;
-	uint32 p1, p2, clr, map;
-	byte hi, lo;
+	uint32 p1, p2, clr, map, row;
+	uint32 hi, lo;
 	uint i;
 
+	// The rows of the blocks are written as whole 32-bit values, which
+	// hold the pixels from left to right in little endian order
 	while (block < blocks) {
 		type = _TypeTree->getCode(bs);
 		run = getBlockRun((type >> 2) & 0x3f);
@@ -673,14 +714,12 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 				clr = _MClrTree->getCode(bs);
 				map = _MMapTree->getCode(bs);
 				out = (byte *)_surface->getPixels() + (block / bw) * (stride * 4 * doubleY) + (block % bw) * 4;
-				hi = clr >> 8;
-				lo = clr & 0xff;
+				hi = (clr >> 8) * 0x01010101;
+				lo = (clr & 0xff) * 0x01010101;
 				for (i = 0; i < 4; i++) {
+					row = (hi & kMonoRowMasks[map & 0xf]) | (lo & ~kMonoRowMasks[map & 0xf]);
 					for (j = 0; j < doubleY; j++) {
-						out[0] = (map & 1) ? hi : lo;
-						out[1] = (map & 2) ? hi : lo;
-						out[2] = (map & 4) ? hi : lo;
-						out[3] = (map & 8) ? hi : lo;
+						WRITE_LE_UINT32(out, row);
 						out += stride;
 					}
 					map >>= 4;
@@ -712,29 +751,25 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 						for (i = 0; i < 4; ++i) {
 							p1 = _FullTree->getCode(bs);
 							p2 = _FullTree->getCode(bs);
+							row = p2 | (p1 << 16);
 							for (j = 0; j < doubleY; ++j) {
-								out[2] = p1 & 0xff;
-								out[3] = p1 >> 8;
-								out[0] = p2 & 0xff;
-								out[1] = p2 >> 8;
+								WRITE_LE_UINT32(out, row);
 								out += stride;
 							}
 						}
 						break;
 					case 1:
 						p1 = _FullTree->getCode(bs);
-						out[0] = out[1] = p1 & 0xFF;
-						out[2] = out[3] = p1 >> 8;
+						row = ((p1 & 0xff) * 0x0101) | ((p1 >> 8) * 0x01010000);
+						WRITE_LE_UINT32(out, row);
 						out += stride;
-						out[0] = out[1] = p1 & 0xFF;
-						out[2] = out[3] = p1 >> 8;
+						WRITE_LE_UINT32(out, row);
 						out += stride;
 						p2 = _FullTree->getCode(bs);
-						out[0] = out[1] = p2 & 0xFF;
-						out[2] = out[3] = p2 >> 8;
+						row = ((p2 & 0xff) * 0x0101) | ((p2 >> 8) * 0x01010000);
+						WRITE_LE_UINT32(out, row);
 						out += stride;
-						out[0] = out[1] = p2 & 0xFF;
-						out[2] = out[3] = p2 >> 8;
+						WRITE_LE_UINT32(out, row);
 						out += stride;
 						break;
 					case 2:
@@ -744,18 +779,9 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 							// https://ffmpeg.org/pipermail/ffmpeg-devel/2008-December/044246.html
 							p2 = _FullTree->getCode(bs);
 							p1 = _FullTree->getCode(bs);
-							for (j = 0; j < doubleY; ++j) {
-								out[0] = p1 & 0xff;
-								out[1] = p1 >> 8;
-								out[2] = p2 & 0xff;
-								out[3] = p2 >> 8;
-								out += stride;
-							}
-							for (j = 0; j < doubleY; ++j) {
-								out[0] = p1 & 0xff;
-								out[1] = p1 >> 8;
-								out[2] = p2 & 0xff;
-								out[3] = p2 >> 8;
+							row = p1 | (p2 << 16);
+							for (j = 0; j < doubleY * 2; ++j) {
+								WRITE_LE_UINT32(out, row);
 								out += stride;
 							}
 						}
@@ -772,17 +798,19 @@ void SmackerDecoder::SmackerVideoTrack::decodeFrame(SmackerBitStream &bs) {
 				block++;
 			break;
 		case SMK_BLOCK_FILL:
-			uint32 col;
 			mode = type >> 8;
-			while (run-- && block < blocks) {
+			while (run && block < blocks) {
+				// Fill the blocks up to the end of the run or of the row at once
+				uint count = MIN<uint>(MIN<uint>(run, bw - block % bw), blocks - block);
 				out = (byte *)_surface->getPixels() + (block / bw) * (stride * 4 * doubleY) + (block % bw) * 4;
-				col = mode * 0x01010101;
 				for (i = 0; i < 4 * doubleY; ++i) {
-					out[0] = out[1] = out[2] = out[3] = col;
+					memset(out, mode, count * 4);
 					out += stride;
 				}
-				_dirtyBlocks.set(block);
-				++block;
+				for (i = 0; i < count; ++i)
+					_dirtyBlocks.set(block + i);
+				block += count;
+				run -= count;
 			}
 			break;
 		default:
@@ -966,7 +994,23 @@ Common::Rational SmackerDecoder::getFrameRate() const {
 	return videoTrack->getFrameRate();
 }
 
+const Graphics::Surface *SmackerDecoder::decodeNextFrame() {
+	_fullFrameDirty = true;
+	return VideoDecoder::decodeNextFrame();
+}
+
 const Common::Rect *SmackerDecoder::getNextDirtyRect() {
+	// The dirty blocks are those of the frame decoded last, which is not
+	// the one returned while decoding ahead
+	if (isDecodingAhead()) {
+		if (!_fullFrameDirty)
+			return nullptr;
+
+		_fullFrameDirty = false;
+		_fullFrameRect = Common::Rect(getWidth(), getHeight());
+		return &_fullFrameRect;
+	}
+
 	SmackerVideoTrack *videoTrack = (SmackerVideoTrack *)getTrack(0);
 
 	return videoTrack->getNextDirtyRect();
@@ -86,6 +86,7 @@ public:
 
 	Common::Rational getFrameRate() const;
 
+	virtual const Graphics::Surface *decodeNextFrame();
 	virtual const Common::Rect *getNextDirtyRect();
 
 protected:
@@ -222,6 +223,10 @@ protected:
 
 private:
 	uint32 _firstFrameStart;
+
+	// While decoding ahead, only whole frames are reported as dirty
+	bool _fullFrameDirty;
+	Common::Rect _fullFrameRect;
 };
 
 } // End of namespace Video
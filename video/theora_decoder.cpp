@@ -34,6 +34,7 @@
  */
 
 #include "video/theora_decoder.h"
+#include "video/decode_profiler.h"
 
 #include "audio/audiostream.h"
 #include "audio/decoders/raw.h"
@@ -306,7 +307,14 @@ TheoraDecoder::TheoraVideoTrack::~TheoraVideoTrack() {
 }
 
 bool TheoraDecoder::TheoraVideoTrack::decodePacket(ogg_packet &oggPacket) {
-	if (th_decode_packetin(_theoraDecode, &oggPacket, 0) == 0) {
+	int result;
+	{
+		// libtheora reads the bitstream and rebuilds the blocks in one go
+		DecodeProfiler::Scope profile(DecodeProfiler::kStageTransform);
+		result = th_decode_packetin(_theoraDecode, &oggPacket, 0);
+	}
+
+	if (result == 0) {
 		_curFrame++;
 
 		// Convert YUV data to RGB data
@@ -338,6 +346,8 @@ enum TheoraYUVBuffers {
 };
 
 void TheoraDecoder::TheoraVideoTrack::translateYUVtoRGBA(th_ycbcr_buffer &YUVBuffer) {
+	DecodeProfiler::Scope profile(DecodeProfiler::kStageColorConvert);
+
 	// Width and height of all buffers have to be divisible by 2.
 	assert((YUVBuffer[kBufferY].width & 1) == 0);
 	assert((YUVBuffer[kBufferY].height & 1) == 0);
@@ -362,15 +372,30 @@ void TheoraDecoder::TheoraVideoTrack::translateYUVtoRGBA(th_ycbcr_buffer &YUVBuf
 		                      _surface->getBasePtr(_x, _y), _surface->format);
 	}
 
+	// Only the picture region is shown, so only convert that part of the
+	// frame. The region is widened to even coordinates for the subsampled
+	// chroma planes.
+	const int left = _x & ~1;
+	const int top = _y & ~1;
+	const int right = MIN<int>((_x + _width + 1) & ~1, YUVBuffer[kBufferY].width);
+	const int bottom = MIN<int>((_y + _height + 1) & ~1, YUVBuffer[kBufferY].height);
+	const int uvShiftX = (YUVBuffer[kBufferU].width == YUVBuffer[kBufferY].width) ? 0 : 1;
+	const int uvShiftY = (YUVBuffer[kBufferU].height == YUVBuffer[kBufferY].height) ? 0 : 1;
+
+	Graphics::Surface area = _surface->getSubArea(Common::Rect(left, top, right, bottom));
+	const byte *ySrc = YUVBuffer[kBufferY].data + top * YUVBuffer[kBufferY].stride + left;
+	const byte *uSrc = YUVBuffer[kBufferU].data + (top >> uvShiftY) * YUVBuffer[kBufferU].stride + (left >> uvShiftX);
+	const byte *vSrc = YUVBuffer[kBufferV].data + (top >> uvShiftY) * YUVBuffer[kBufferV].stride + (left >> uvShiftX);
+
 	switch (_theoraPixelFormat) {
 	case TH_PF_420:
-		YUVToRGBMan.convert420(_surface, Graphics::YUVToRGBManager::kScaleITU, YUVBuffer[kBufferY].data, YUVBuffer[kBufferU].data, YUVBuffer[kBufferV].data, YUVBuffer[kBufferY].width, YUVBuffer[kBufferY].height, YUVBuffer[kBufferY].stride, YUVBuffer[kBufferU].stride);
+		YUVToRGBMan.convert420(&area, Graphics::YUVToRGBManager::kScaleITU, ySrc, uSrc, vSrc, right - left, bottom - top, YUVBuffer[kBufferY].stride, YUVBuffer[kBufferU].stride);
 		break;
 	case TH_PF_422:
-		YUVToRGBMan.convert422(_surface, Graphics::YUVToRGBManager::kScaleITU, YUVBuffer[kBufferY].data, YUVBuffer[kBufferU].data, YUVBuffer[kBufferV].data, YUVBuffer[kBufferY].width, YUVBuffer[kBufferY].height, YUVBuffer[kBufferY].stride, YUVBuffer[kBufferU].stride);
+		YUVToRGBMan.convert422(&area, Graphics::YUVToRGBManager::kScaleITU, ySrc, uSrc, vSrc, right - left, bottom - top, YUVBuffer[kBufferY].stride, YUVBuffer[kBufferU].stride);
 		break;
 	case TH_PF_444:
-		YUVToRGBMan.convert444(_surface, Graphics::YUVToRGBManager::kScaleITU, YUVBuffer[kBufferY].data, YUVBuffer[kBufferU].data, YUVBuffer[kBufferV].data, YUVBuffer[kBufferY].width, YUVBuffer[kBufferY].height, YUVBuffer[kBufferY].stride, YUVBuffer[kBufferU].stride);
+		YUVToRGBMan.convert444(&area, Graphics::YUVToRGBManager::kScaleITU, ySrc, uSrc, vSrc, right - left, bottom - top, YUVBuffer[kBufferY].stride, YUVBuffer[kBufferU].stride);
 		break;
 	default:
 		error("Unsupported Theora pixel format");
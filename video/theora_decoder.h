@@ -57,6 +57,9 @@ namespace Video {
  *  - pegasus
  *  - sword25
  *  - wintermute
+ *
+ * For HD videos, setDecodeAhead() moves the decoding and the color
+ * conversion off the thread that shows the frames.
  */
 class TheoraDecoder : public VideoDecoder {
 public:
@@ -26,10 +26,134 @@
 
 #include "common/rational.h"
 #include "common/file.h"
+#include "common/list.h"
+#include "common/mutex.h"
+#include "common/profiler.h"
 #include "common/system.h"
+#include "common/timer.h"
+
+#include "graphics/surface.h"
 
 namespace Video {
 
+namespace {
+
+enum {
+	kDecodeAheadTimerInterval = 10 * 1000
+};
+
+// Decoders are only added and removed with the mutex held, and the timer
+// holds it while filling them, so a decoder never stops decoding ahead
+// while it is being filled.
+Common::Mutex *g_decodeAheadMutex = nullptr;
+Common::List<VideoDecoder *> *g_decodeAheadDecoders = nullptr;
+bool g_decodeAheadTimerInstalled = false;
+
+void decodeAheadTimerProc(void *refCon) {
+	fillDecodeAheadVideos();
+}
+
+/** Holds a mutex if there is one. */
+class OptionalStackLock {
+public:
+	OptionalStackLock(Common::Mutex *mutex) : _mutex(mutex) {
+		if (_mutex)
+			_mutex->lock();
+	}
+
+	~OptionalStackLock() {
+		if (_mutex)
+			_mutex->unlock();
+	}
+
+private:
+	Common::Mutex *_mutex;
+};
+
+} // End of anonymous namespace
+
+/**
+ * The queue of frames decoded ahead, along with what the track looked like
+ * before each of them, which is what the decoder reports until the frame
+ * is taken from the queue.
+ */
+struct VideoDecoder::DecodeAheadState {
+	struct TrackState {
+		int curFrame;
+		uint32 nextFrameStartTime;
+		bool endOfTrack;
+
+		void update(const VideoTrack *track) {
+			curFrame = track->getCurFrame();
+			nextFrameStartTime = track->getNextFrameStartTime();
+			endOfTrack = track->endOfTrack();
+		}
+	};
+
+	struct Frame {
+		Frame() : hasSurface(false), hasDirtyPalette(false) {}
+
+		Graphics::Surface surface;
+		bool hasSurface;
+		bool hasDirtyPalette;
+		byte palette[256 * 3];
+		TrackState before;
+	};
+
+	DecodeAheadState(VideoTrack *videoTrack, uint queueSize) : track(videoTrack), registered(false), frames(queueSize + 1), readPos(0), count(0) {
+		last.update(track);
+	}
+
+	~DecodeAheadState() {
+		for (auto &frame : frames)
+			frame.surface.free();
+	}
+
+	/** What the decoder reports about the next frame. */
+	TrackState next() const {
+		Common::StackLock lock(queueMutex);
+		return count ? frames[readPos].before : last;
+	}
+
+	Frame *pop() {
+		Common::StackLock lock(queueMutex);
+		if (!count)
+			return nullptr;
+
+		Frame *frame = &frames[readPos];
+		readPos = (readPos + 1) % frames.size();
+		count--;
+		return frame;
+	}
+
+	/** Drop the queued frames after the track was moved, with decodeMutex held. */
+	void flush() {
+		TrackState state;
+		state.update(track);
+
+		Common::StackLock lock(queueMutex);
+		count = 0;
+		last = state;
+	}
+
+	VideoTrack *const track;
+	bool registered;
+
+	/** Held while decoding, i.e. while touching the tracks. */
+	Common::Mutex decodeMutex;
+
+	/**
+	 * Held while accessing the queue below, but never for long. The slot
+	 * before readPos holds the frame returned last, so that one is only
+	 * overwritten after the next call to decodeNextFrame().
+	 */
+	mutable Common::Mutex queueMutex;
+	Common::Array<Frame> frames;
+	uint readPos;
+	uint count;
+	TrackState last;
+};
+
 VideoDecoder::VideoDecoder() {
 	_startTime = 0;
 	_dirtyPalette = false;
@@ -48,9 +172,16 @@ VideoDecoder::VideoDecoder() {
 	_canSetDither = true;
 	_canSetDefaultFormat = true;
 	_videoCodecAccuracy = Image::CodecAccuracy::Default;
+	_decodeAhead = nullptr;
+}
+
+VideoDecoder::~VideoDecoder() {
+	stopDecodeAhead();
 }
 
 void VideoDecoder::close() {
+	stopDecodeAhead();
+
 	if (isPlaying())
 		stop();
 
@@ -133,6 +264,8 @@ void VideoDecoder::pauseVideo(bool pause) {
 		return;
 	}
 
+	OptionalStackLock lock(_decodeAhead ? &_decodeAhead->decodeMutex : nullptr);
+
 	if (_pauseLevel == 1 && pause) {
 		_pauseStartTime = g_system->getMillis(); // Store the starting time from pausing to keep it for later
 
@@ -208,10 +341,15 @@ Graphics::PixelFormat VideoDecoder::getPixelFormat() const {
 }
 
 const Graphics::Surface *VideoDecoder::decodeNextFrame() {
+	PROFILE_ZONE("VideoDecoder::decodeNextFrame");
+
 	_needsUpdate = false;
 	_canSetDither = false;
 	_canSetDefaultFormat = false;
 
+	if (_decodeAhead)
+		return takeDecodedFrame();
+
 	readNextPacket();
 
 	// If we have no next video track at this point, there shouldn't be
@@ -237,6 +375,10 @@ bool VideoDecoder::setReverse(bool reverse) {
 	if (reverse && hasAudio())
 		return false;
 
+	// The frames decoded ahead are in the other direction
+	if (reverse && _decodeAhead)
+		return false;
+
 	// Attempt to make sure all the tracks are in the requested direction
 	for (auto &track : _tracks) {
 		if (track->getTrackType() == Track::kTrackTypeVideo && ((VideoTrack *)track)->isReversed() != reverse) {
@@ -257,6 +399,9 @@ const byte *VideoDecoder::getPalette() {
 }
 
 int VideoDecoder::getCurFrame() const {
+	if (_decodeAhead)
+		return _decodeAhead->next().curFrame;
+
 	int32 frame = -1;
 
 	for (const auto &track : _tracks)
@@ -298,13 +443,30 @@ uint32 VideoDecoder::getTime() const {
 }
 
 uint32 VideoDecoder::getTimeToNextFrame() const {
-	if (endOfVideo() || _needsUpdate || !_nextVideoTrack)
+	if (endOfVideo() || _needsUpdate)
 		return 0;
 
+	uint32 nextFrameStartTime;
+	bool reversed;
+
+	if (_decodeAhead) {
+		const DecodeAheadState::TrackState next = _decodeAhead->next();
+		if (next.endOfTrack)
+			return 0;
+
+		nextFrameStartTime = next.nextFrameStartTime;
+		reversed = false;
+	} else {
+		if (!_nextVideoTrack)
+			return 0;
+
+		nextFrameStartTime = _nextVideoTrack->getNextFrameStartTime();
+		reversed = _nextVideoTrack->isReversed();
+	}
+
 	uint32 currentTime = getTime();
-	uint32 nextFrameStartTime = _nextVideoTrack->getNextFrameStartTime();
 
-	if (_nextVideoTrack->isReversed()) {
+	if (reversed) {
 		// For reversed videos, we need to handle the time difference the opposite way.
 		if (nextFrameStartTime >= currentTime)
 			return 0;
@@ -321,8 +483,12 @@ uint32 VideoDecoder::getTimeToNextFrame() const {
 
 bool VideoDecoder::endOfVideo() const {
 	for (const auto &track : _tracks) {
-		bool videoEndTimeReached = _endTimeSet && track->getTrackType() == Track::kTrackTypeVideo && ((const VideoTrack *)track)->getNextFrameStartTime() >= (uint)_endTime.msecs();
-		bool endReached = track->endOfTrack() || (isPlaying() && videoEndTimeReached);
+		bool endReached;
+		if (track->getTrackType() == Track::kTrackTypeVideo)
+			endReached = hasVideoTrackEnded((const VideoTrack *)track);
+		else
+			endReached = track->endOfTrack();
+
 		if (!endReached)
 			return false;
 	}
@@ -345,6 +511,8 @@ bool VideoDecoder::rewind() {
 	if (!isRewindable())
 		return false;
 
+	OptionalStackLock lock(_decodeAhead ? &_decodeAhead->decodeMutex : nullptr);
+
 	// Stop all tracks so they can be rewound
 	if (isPlaying())
 		stopAudio();
@@ -353,6 +521,9 @@ bool VideoDecoder::rewind() {
 		if (!track->rewind())
 			return false;
 
+	if (_decodeAhead)
+		_decodeAhead->flush();
+
 	// Now that we've rewound, start all tracks again
 	if (isPlaying())
 		startAudio();
@@ -379,6 +550,8 @@ bool VideoDecoder::seek(const Audio::Timestamp &time) {
 	if (!isSeekable())
 		return false;
 
+	OptionalStackLock lock(_decodeAhead ? &_decodeAhead->decodeMutex : nullptr);
+
 	// Stop all tracks so they can be seek'ed
 	if (isPlaying())
 		stopAudio();
@@ -392,6 +565,9 @@ bool VideoDecoder::seek(const Audio::Timestamp &time) {
 		if (!track->seek(time))
 			return false;
 
+	if (_decodeAhead)
+		_decodeAhead->flush();
+
 	_lastTimeChange = time;
 
 	// Now that we've seek'ed, start all tracks again
@@ -464,6 +640,7 @@ void VideoDecoder::stop() {
 	_pauseLevel = 0;
 
 	// Reset the pause state of the tracks too
+	OptionalStackLock lock(_decodeAhead ? &_decodeAhead->decodeMutex : nullptr);
 	for (auto &track : _tracks)
 		track->pause(false);
 }
@@ -583,6 +760,200 @@ void VideoDecoder::setVideoCodecAccuracy(Image::CodecAccuracy accuracy) {
 	}
 }
 
+bool VideoDecoder::setDecodeAhead(uint frames) {
+	if (!frames) {
+		if (_decodeAhead && _decodeAhead->registered) {
+			Common::StackLock lock(*g_decodeAheadMutex);
+			g_decodeAheadDecoders->remove(this);
+			_decodeAhead->registered = false;
+		}
+		return true;
+	}
+
+	if (_decodeAhead) {
+		// The queue stays until close()
+		if (_decodeAhead->frames.size() != frames + 1)
+			return false;
+	} else {
+		VideoTrack *videoTrack = nullptr;
+
+		for (auto &track : _tracks) {
+			if (track->getTrackType() == Track::kTrackTypeVideo) {
+				// We only allow this when one video track is present
+				if (videoTrack)
+					return false;
+
+				videoTrack = (VideoTrack *)track;
+			}
+		}
+
+		if (!videoTrack || videoTrack->isReversed())
+			return false;
+
+		_decodeAhead = new DecodeAheadState(videoTrack, frames);
+	}
+
+	if (_decodeAhead->registered)
+		return true;
+
+	// The first decoder is set up from the main thread, before the timer
+	// runs, so creating the shared state lazily is safe
+	if (!g_decodeAheadMutex) {
+		g_decodeAheadMutex = new Common::Mutex();
+		g_decodeAheadDecoders = new Common::List<VideoDecoder *>();
+	}
+
+	{
+		Common::StackLock lock(*g_decodeAheadMutex);
+		g_decodeAheadDecoders->push_back(this);
+		_decodeAhead->registered = true;
+	}
+
+	if (!g_decodeAheadTimerInstalled) {
+		Common::TimerManager *timer = g_system->getTimerManager();
+		g_decodeAheadTimerInstalled = timer && timer->installTimerProc(&decodeAheadTimerProc, kDecodeAheadTimerInterval, nullptr, "videoDecodeAhead");
+	}
+
+	return true;
+}
+
+VideoDecoder::DecodeAheadLock::DecodeAheadLock(VideoDecoder *decoder) : _decoder(decoder), _locked(decoder->_decodeAhead != nullptr) {
+	if (_locked)
+		_decoder->_decodeAhead->decodeMutex.lock();
+}
+
+VideoDecoder::DecodeAheadLock::~DecodeAheadLock() {
+	if (_locked) {
+		_decoder->_decodeAhead->flush();
+		_decoder->_decodeAhead->decodeMutex.unlock();
+	}
+}
+
+void VideoDecoder::stopDecodeAhead() {
+	if (!_decodeAhead)
+		return;
+
+	setDecodeAhead(0);
+	delete _decodeAhead;
+	_decodeAhead = nullptr;
+}
+
+bool VideoDecoder::fillDecodeAhead() {
+	Common::StackLock lock(_decodeAhead->decodeMutex);
+
+	// The output format is settled by the first call to decodeNextFrame()
+	if (_canSetDefaultFormat)
+		return false;
+
+	if (!queueDecodedFrame())
+		return false;
+
+	Common::StackLock queueLock(_decodeAhead->queueMutex);
+	return !_decodeAhead->last.endOfTrack && _decodeAhead->count + 1 < _decodeAhead->frames.size();
+}
+
+bool VideoDecoder::queueDecodedFrame() {
+	// Called with decodeMutex held, so only this changes the tracks and
+	// the end of the queue
+	DecodeAheadState &state = *_decodeAhead;
+
+	uint writePos;
+	{
+		Common::StackLock lock(state.queueMutex);
+		if (state.last.endOfTrack || state.count + 1 >= state.frames.size())
+			return false;
+
+		writePos = (state.readPos + state.count) % state.frames.size();
+	}
+
+	DecodeAheadState::Frame &frame = state.frames[writePos];
+	frame.before = state.last;
+
+	readNextPacket();
+
+	if (!_nextVideoTrack) {
+		Common::StackLock lock(state.queueMutex);
+		state.last.endOfTrack = true;
+		return false;
+	}
+
+	const Graphics::Surface *surface = _nextVideoTrack->decodeNextFrame();
+
+	frame.hasSurface = (surface != nullptr);
+	if (surface) {
+		if (frame.surface.w != surface->w || frame.surface.h != surface->h || frame.surface.format != surface->format)
+			frame.surface.create(surface->w, surface->h, surface->format);
+		frame.surface.copyRectToSurface(*surface, 0, 0, Common::Rect(surface->w, surface->h));
+	}
+
+	frame.hasDirtyPalette = _nextVideoTrack->hasDirtyPalette();
+	if (frame.hasDirtyPalette)
+		memcpy(frame.palette, _nextVideoTrack->getPalette(), sizeof(frame.palette));
+
+	findNextVideoTrack();
+
+	DecodeAheadState::TrackState last;
+	last.update(state.track);
+
+	Common::StackLock lock(state.queueMutex);
+	state.last = last;
+	state.count++;
+	return true;
+}
+
+const Graphics::Surface *VideoDecoder::takeDecodedFrame() {
+	DecodeAheadState::Frame *frame = _decodeAhead->pop();
+
+	if (!frame) {
+		// Decoding has not kept up: decode the frame right away, after
+		// what the timer may have queued in the meantime
+		Common::StackLock lock(_decodeAhead->decodeMutex);
+		frame = _decodeAhead->pop();
+		if (!frame && queueDecodedFrame())
+			frame = _decodeAhead->pop();
+	}
+
+	if (!frame)
+		return 0;
+
+	if (frame->hasDirtyPalette) {
+		_palette = frame->palette;
+		_dirtyPalette = true;
+	}
+
+	return frame->hasSurface ? &frame->surface : 0;
+}
+
+bool VideoDecoder::hasVideoTrackEnded(const VideoTrack *track) const {
+	uint32 nextFrameStartTime;
+	bool endOfTrack;
+
+	if (_decodeAhead) {
+		const DecodeAheadState::TrackState next = _decodeAhead->next();
+		nextFrameStartTime = next.nextFrameStartTime;
+		endOfTrack = next.endOfTrack;
+	} else {
+		nextFrameStartTime = _endTimeSet ? track->getNextFrameStartTime() : 0;
+		endOfTrack = track->endOfTrack();
+	}
+
+	bool videoEndTimeReached = _endTimeSet && nextFrameStartTime >= (uint)_endTime.msecs();
+	return endOfTrack || (isPlaying() && videoEndTimeReached);
+}
+
+bool fillDecodeAheadVideos() {
+	if (!g_decodeAheadMutex)
+		return false;
+
+	Common::StackLock lock(*g_decodeAheadMutex);
+
+	bool moreRoom = false;
+	for (auto &decoder : *g_decodeAheadDecoders)
+		moreRoom |= decoder->fillDecodeAhead();
+
+	return moreRoom;
+}
+
 VideoDecoder::Track::Track() {
 	_paused = false;
 }
@@ -947,7 +1318,13 @@ void VideoDecoder::setEndFrame(uint frame) {
 }
 
 void VideoDecoder::resetStartTime() {
-	if (_nextVideoTrack) {
+	if (_decodeAhead) {
+		const DecodeAheadState::TrackState next = _decodeAhead->next();
+		if (!next.endOfTrack && isPlaying()) {
+			Audio::Timestamp curTime = _decodeAhead->track->getFrameTime(next.curFrame);
+			_startTime = g_system->getMillis() - (curTime.msecs() / _playbackRate).toInt();
+		}
+	} else if (_nextVideoTrack) {
 		Audio::Timestamp curTime = _nextVideoTrack->getFrameTime(_nextVideoTrack->getCurFrame());
 		if (isPlaying()) {
 			_startTime = g_system->getMillis() - (curTime.msecs() / _playbackRate).toInt();
@@ -1036,11 +1413,7 @@ bool VideoDecoder::hasFramesLeft() const {
 		if (track->getTrackType() != Track::kTrackTypeVideo)
 			continue;
 
-		const VideoTrack *videoTrack = (const VideoTrack *)track;
-
-		bool videoEndTimeReached = _endTimeSet && videoTrack->getNextFrameStartTime() >= (uint)_endTime.msecs();
-		bool endReached = videoTrack->endOfTrack() || (isPlaying() && videoEndTimeReached);
-		if (!endReached)
+		if (!hasVideoTrackEnded((const VideoTrack *)track))
 			return true;
 	}
 
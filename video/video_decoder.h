@@ -53,7 +53,7 @@ namespace Video {
 class VideoDecoder {
 public:
 	VideoDecoder();
-	virtual ~VideoDecoder() {}
+	virtual ~VideoDecoder();
 
 	/////////////////////////////////////////
 	// Opening/Closing a Video
@@ -424,6 +424,27 @@ public:
 	 */
 	virtual void setVideoCodecAccuracy(Image::CodecAccuracy accuracy);
 
+	/**
+	 * Decode frames ahead of time, from a background timer.
+	 *
+	 * Once the first frame has been decoded, up to the given number of
+	 * frames are decoded ahead into a queue that decodeNextFrame() then
+	 * takes them from, so that a slow frame does not hold up the caller.
+	 * This costs one more copy of every frame.
+	 *
+	 * This should be called after loadStream(). While it is on, the tracks
+	 * are decoded from another thread, so they must only be accessed
+	 * through the functions of this class. Turning it off stops decoding
+	 * in the background, but the frames already queued are still returned.
+	 * close() turns it off for good.
+	 *
+	 * @note This only works for videos with a single video track played
+	 *       forward, and setReverse() fails while it is on.
+	 * @param frames The number of frames to decode ahead, or 0 to stop
+	 * @return true on success, false otherwise
+	 */
+	bool setDecodeAhead(uint frames);
+
 	/////////////////////////////////////////
 	// Audio Control
 	/////////////////////////////////////////
@@ -1030,6 +1051,24 @@ protected:
 
 	Image::CodecAccuracy _videoCodecAccuracy;
 
+	/** Whether setDecodeAhead() queues frames decoded ahead. */
+	bool isDecodingAhead() const { return _decodeAhead != nullptr; }
+
+	/**
+	 * Stops decoding ahead while decoders move their tracks outside of
+	 * rewind() and seek(), and drops the frames decoded ahead when it
+	 * goes out of scope.
+	 */
+	class DecodeAheadLock {
+	public:
+		DecodeAheadLock(VideoDecoder *decoder);
+		~DecodeAheadLock();
+
+	private:
+		VideoDecoder *_decoder;
+		bool _locked;
+	};
+
 private:
 	uint32 _pauseLevel;
 	uint32 _pauseStartTime;
@@ -1038,8 +1077,29 @@ private:
 	Audio::Mixer::SoundType _soundType;
 
 	AudioTrack *_mainAudioTrack;
+
+	// Decode-ahead, see setDecodeAhead()
+	struct DecodeAheadState;
+	DecodeAheadState *_decodeAhead;
+
+	friend bool fillDecodeAheadVideos();
+	bool fillDecodeAhead();
+	bool queueDecodedFrame();
+	const Graphics::Surface *takeDecodedFrame();
+	void stopDecodeAhead();
+	bool hasVideoTrackEnded(const VideoTrack *track) const;
 };
 
+/**
+ * Decode one more frame ahead for every video decoder with decode-ahead.
+ *
+ * This is what the background timer does; it only needs to be called
+ * directly where there is no timer.
+ *
+ * @return true if some decoder still has room left in its queue.
+ */
+bool fillDecodeAheadVideos();
+
 } // End of namespace Video
 
 #endif